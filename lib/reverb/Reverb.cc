@@ -442,15 +442,28 @@ void MixxxPlateX2::processBuffer(const sample_t* in, sample_t* out, const uint f
                                  const sample_t dampingParam,
                                  const sample_t currentSend,
                                  const sample_t previousSend) {
+    // (mixxx) the exp()/pow() parameter mappings are constant while the knobs
+    // are not moved; recomputing them per buffer is pure overhead at small
+    // engine buffer sizes, so they are cached across calls
     // set bandwidth
-    input.bandwidth.set(exp(-M_PI * (1. - (.005 + .994*bandwidthParam))));
+    if (bandwidthParam != m_lastBandwidthParam) {
+        input.bandwidth.set(exp(-M_PI * (1. - (.005 + .994*bandwidthParam))));
+        m_lastBandwidthParam = bandwidthParam;
+    }
     // set decay
     sample_t decay = .890*decayParam;
     // set damping
-    double damp = exp(-M_PI * (.0005+.9995*dampingParam));
-    tank.damping[0].set(damp);
-    tank.damping[1].set(damp);
-    RampingValue<sample_t> send(pow(currentSend, 1.53), previousSend, frames);
+    if (dampingParam != m_lastDampingParam) {
+        double damp = exp(-M_PI * (.0005+.9995*dampingParam));
+        tank.damping[0].set(damp);
+        tank.damping[1].set(damp);
+        m_lastDampingParam = dampingParam;
+    }
+    if (currentSend != m_lastSendParam) {
+        m_sendScaled = pow(currentSend, 1.53);
+        m_lastSendParam = currentSend;
+    }
+    RampingValue<sample_t> send(m_sendScaled, previousSend, frames);
 
     // the modulated lattices interpolate, which needs truncated float
     DSP::FPTruncateMode _truncate;
@@ -238,8 +238,23 @@ class PlateX2
 
         void setSamplerate(float sampleRate) {
             fs = sampleRate;
+            // (mixxx) force recomputation of the cached coefficients below,
+            // activate() resets the filters they were applied to
+            m_lastBandwidthParam = -1;
+            m_lastDampingParam = -1;
+            m_lastSendParam = -1;
             activate();
         }
+
+    private:
+        // (mixxx) processBuffer is called once per engine buffer; at small
+        // buffer sizes the exp()/pow() parameter mappings dominate the
+        // per-call overhead, so cache them and only recompute when the
+        // parameter actually moved
+        sample_t m_lastBandwidthParam = -1;
+        sample_t m_lastDampingParam = -1;
+        sample_t m_lastSendParam = -1;
+        sample_t m_sendScaled = 0;
  };
 
 #endif /* REVERB_H */
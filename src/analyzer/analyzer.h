@@ -35,6 +35,26 @@ class Analyzer {
     // but not finalize()!
     virtual bool processSamples(const CSAMPLE* pIn, SINT count) = 0;
 
+    // Returns true if the analyzer only consumes a mono downmix of the
+    // audio signal. The caller may then compute the downmix once, share
+    // it among all mono analyzers and invoke processMonoSamples()
+    // instead of processSamples(). Only valid after initialize()
+    // succeeded and the result must not change while processing.
+    virtual bool usesMonoSource() const {
+        return false;
+    }
+
+    // Analyze the next chunk as a precomputed (L+R)/2 mono downmix of
+    // the corresponding interleaved stereo samples. Only invoked as a
+    // replacement for processSamples() if usesMonoSource() returned
+    // true, with the same semantics for the returned value.
+    virtual bool processMonoSamples(const CSAMPLE* pMono, SINT count) {
+        Q_UNUSED(pMono);
+        Q_UNUSED(count);
+        DEBUG_ASSERT(!"processMonoSamples() only available if usesMonoSource()");
+        return false;
+    }
+
     // Update the track object with the analysis results after
     // processing finished successfully, i.e. all available audio
     // samples have been processed.
@@ -86,6 +106,21 @@ class AnalyzerWithState final {
         }
     }
 
+    bool usesMonoSource() const {
+        return m_active && m_analyzer->usesMonoSource();
+    }
+
+    void processMonoSamples(const CSAMPLE* pMono, const int count) {
+        if (m_active) {
+            m_active = m_analyzer->processMonoSamples(pMono, count);
+            if (!m_active) {
+                // Ensure that cleanup() is invoked after processing
+                // failed and the analyzer became inactive!
+                m_analyzer->cleanup();
+            }
+        }
+    }
+
     void finish(const AnalyzerTrack& track) {
         if (m_active) {
             m_analyzer->storeResults(track.getTrack());
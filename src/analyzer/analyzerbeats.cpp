@@ -243,6 +243,30 @@ bool AnalyzerBeats::processSamples(const CSAMPLE* pIn, SINT count) {
     return ret;
 }
 
+bool AnalyzerBeats::usesMonoSource() const {
+    // A shared mono downmix only replaces the plugin's own downmix for
+    // plain stereo input. Stem files are reduced to either a stereo mix
+    // or the drum stem in processSamples() depending on the configured
+    // stem strategy.
+    return m_pPlugin && m_pPlugin->usesMonoSource() &&
+            m_channelCount == mixxx::audio::ChannelCount::stereo();
+}
+
+bool AnalyzerBeats::processMonoSamples(const CSAMPLE* pMono, SINT count) {
+    VERIFY_OR_DEBUG_ASSERT(m_pPlugin) {
+        return false;
+    }
+    DEBUG_ASSERT(m_channelCount == mixxx::audio::ChannelCount::stereo());
+
+    // Mono input, i.e. one sample per frame
+    m_currentFrame += count;
+    if (m_currentFrame > m_maxFramesToProcess) {
+        return true; // silently ignore all remaining samples
+    }
+
+    return m_pPlugin->processMonoSamples(pMono, count);
+}
+
 void AnalyzerBeats::cleanup() {
     m_pPlugin.reset();
 }
@@ -4,17 +4,35 @@
 
 #include "analyzer/analyzertrack.h"
 #include "analyzer/constants.h"
+#include "track/loudnesscurve.h"
 #include "track/track.h"
 #include "util/math.h"
 #include "util/timer.h"
 
 namespace {
 constexpr double kReplayGain2ReferenceLUFS = -18;
+
+// Spacing of the short-term loudness samples stored in the curve. The
+// short-term window itself is 3 s (EBU R128), so sampling once per second
+// keeps adjacent samples overlapping without blowing up the stored data:
+// a 4-hour set is still only ~56 KiB per deck.
+constexpr double kCurveIntervalSeconds = 1.0;
+
+// libebur128 returns -HUGE_VAL while the short-term window is not filled
+// yet and for digital silence. Clamp to the EBU R128 measurement floor so
+// the serialized curve stays free of infinities.
+constexpr double kCurveFloorLUFS = -70.0;
 } // anonymous namespace
 
-AnalyzerEbur128::AnalyzerEbur128(UserSettingsPointer pConfig)
-        : m_rgSettings(pConfig),
-          m_pState(nullptr) {
+AnalyzerEbur128::AnalyzerEbur128(UserSettingsPointer pConfig,
+        const QSqlDatabase& dbConnection)
+        : m_analysisDao(pConfig),
+          m_rgSettings(pConfig),
+          m_pState(nullptr),
+          m_processedFrames(0),
+          m_framesPerInterval(0),
+          m_nextCurveFrame(0) {
+    m_analysisDao.initialize(dbConnection);
 }
 
 AnalyzerEbur128::~AnalyzerEbur128() {
@@ -27,6 +45,10 @@ bool AnalyzerEbur128::initialize(
         mixxx::audio::ChannelCount channelCount,
         SINT frameLength) {
     if (m_rgSettings.isAnalyzerDisabled(2, track.getTrack()) || frameLength <= 0) {
+        // The integrated loudness is already known (or the analyzer is
+        // disabled), but the engine still wants the stored short-term
+        // curve of a previously analyzed track.
+        loadStoredCurve(track.getTrack());
         qDebug() << "Skipping AnalyzerEbur128";
         return false;
     }
@@ -34,8 +56,17 @@ bool AnalyzerEbur128::initialize(
     m_pState = ebur128_init(
             channelCount,
             sampleRate,
-            EBUR128_MODE_I);
-    return m_pState != nullptr;
+            EBUR128_MODE_I | EBUR128_MODE_S);
+    if (m_pState == nullptr) {
+        return false;
+    }
+    m_processedFrames = 0;
+    m_framesPerInterval = static_cast<SINT>(sampleRate * kCurveIntervalSeconds);
+    m_nextCurveFrame = m_framesPerInterval;
+    m_shortTermLufs.clear();
+    m_shortTermLufs.reserve(
+            static_cast<int>(frameLength / m_framesPerInterval) + 1);
+    return true;
 }
 
 void AnalyzerEbur128::cleanup() {
@@ -44,6 +75,7 @@ void AnalyzerEbur128::cleanup() {
         // ebur128_destroy clears the pointer but let's not rely on that.
         m_pState = nullptr;
     }
+    m_shortTermLufs.clear();
 }
 
 bool AnalyzerEbur128::processSamples(const CSAMPLE* pIn, SINT count) {
@@ -57,6 +89,19 @@ bool AnalyzerEbur128::processSamples(const CSAMPLE* pIn, SINT count) {
         qWarning() << "AnalyzerEbur128::processSamples() failed with" << e;
         return false;
     }
+    m_processedFrames += static_cast<SINT>(frames);
+    while (m_processedFrames >= m_nextCurveFrame) {
+        double shortTermLufs;
+        e = ebur128_loudness_shortterm(m_pState, &shortTermLufs);
+        VERIFY_OR_DEBUG_ASSERT(e == EBUR128_SUCCESS) {
+            qWarning() << "AnalyzerEbur128::processSamples()"
+                       << "short-term loudness failed with" << e;
+            return false;
+        }
+        m_shortTermLufs.append(static_cast<float>(
+                math_max(shortTermLufs, kCurveFloorLUFS)));
+        m_nextCurveFrame += m_framesPerInterval;
+    }
     return true;
 }
 
@@ -86,4 +131,64 @@ void AnalyzerEbur128::storeResults(TrackPointer pTrack) {
     pTrack->setReplayGain(replayGain);
     qDebug() << "ReplayGain 2.0 (libebur128) result is" << fReplayGain2
              << "dB for" << pTrack->getFileInfo();
+
+    if (!m_shortTermLufs.isEmpty()) {
+        storeCurve(pTrack, averageLufs);
+    }
+}
+
+void AnalyzerEbur128::loadStoredCurve(TrackPointer pTrack) const {
+    if (pTrack->getLoudnessCurve()) {
+        return;
+    }
+    const TrackId trackId = pTrack->getId();
+    if (!trackId.isValid()) {
+        return;
+    }
+    const QList<AnalysisDao::AnalysisInfo> analyses =
+            m_analysisDao.getAnalysesForTrackByType(
+                    trackId, AnalysisDao::TYPE_LOUDNESS_CURVE);
+    for (const auto& analysis : analyses) {
+        if (analysis.version != mixxx::LoudnessCurve::kVersion) {
+            continue;
+        }
+        const auto pCurve = mixxx::LoudnessCurve::fromByteArray(analysis.data);
+        if (pCurve) {
+            pTrack->setLoudnessCurve(pCurve);
+            return;
+        }
+    }
+}
+
+void AnalyzerEbur128::storeCurve(TrackPointer pTrack, double integratedLufs) {
+    const auto pCurve = mixxx::ConstLoudnessCurvePointer(
+            new mixxx::LoudnessCurve(kCurveIntervalSeconds,
+                    integratedLufs,
+                    m_shortTermLufs));
+    pTrack->setLoudnessCurve(pCurve);
+
+    const TrackId trackId = pTrack->getId();
+    if (!trackId.isValid()) {
+        return;
+    }
+    AnalysisDao::AnalysisInfo analysis;
+    analysis.trackId = trackId;
+    analysis.type = AnalysisDao::TYPE_LOUDNESS_CURVE;
+    analysis.description = QStringLiteral("Short-term loudness curve");
+    analysis.version = mixxx::LoudnessCurve::kVersion;
+    analysis.data = pCurve->toByteArray();
+    // Re-use the record of an outdated curve instead of accumulating one
+    // row (and one data file) per re-analysis.
+    const QList<AnalysisDao::AnalysisInfo> existingAnalyses =
+            m_analysisDao.getAnalysisMetadataForTrack(trackId);
+    for (const auto& existing : existingAnalyses) {
+        if (existing.type == AnalysisDao::TYPE_LOUDNESS_CURVE) {
+            analysis.analysisId = existing.analysisId;
+            break;
+        }
+    }
+    const bool success = m_analysisDao.saveAnalysis(&analysis);
+    qDebug() << (success ? "Saved" : "Failed to save")
+             << "loudness curve for trackId" << trackId
+             << "analysisId" << analysis.analysisId;
 }
@@ -2,12 +2,16 @@
 
 #include <ebur128.h>
 
+#include <QVector>
+
 #include "analyzer/analyzer.h"
+#include "library/dao/analysisdao.h"
 #include "preferences/replaygainsettings.h"
 
 class AnalyzerEbur128 : public Analyzer {
   public:
-    AnalyzerEbur128(UserSettingsPointer pConfig);
+    AnalyzerEbur128(UserSettingsPointer pConfig,
+            const QSqlDatabase& dbConnection);
     ~AnalyzerEbur128() override;
 
     static bool isEnabled(const ReplayGainSettings& rgSettings) {
@@ -23,6 +27,21 @@ class AnalyzerEbur128 : public Analyzer {
     void cleanup() override;
 
   private:
+    // Loads a previously stored short-term loudness curve from the
+    // analysis table and sets it on the track, so the engine can use it
+    // even when the loudness analysis itself is skipped.
+    void loadStoredCurve(TrackPointer pTrack) const;
+    // Sets the freshly measured curve on the track and persists it,
+    // replacing an outdated record for the same track if one exists.
+    void storeCurve(TrackPointer pTrack, double integratedLufs);
+
+    mutable AnalysisDao m_analysisDao;
     ReplayGainSettings m_rgSettings;
     ebur128_state* m_pState;
+    // Frame bookkeeping for sampling the short-term loudness at a fixed
+    // interval while the track streams through processSamples().
+    SINT m_processedFrames;
+    SINT m_framesPerInterval;
+    SINT m_nextCurveFrame;
+    QVector<float> m_shortTermLufs;
 };
@@ -208,6 +208,29 @@ bool AnalyzerKey::processSamples(const CSAMPLE* pIn, SINT count) {
     return ret;
 }
 
+bool AnalyzerKey::usesMonoSource() const {
+    // A shared mono downmix only replaces the plugin's own downmix for
+    // plain stereo input. Stem files are reduced to a harmonic stereo
+    // mix in processSamples() depending on the configured stem strategy.
+    return m_pPlugin && m_pPlugin->usesMonoSource() &&
+            m_channelCount == mixxx::audio::ChannelCount::stereo();
+}
+
+bool AnalyzerKey::processMonoSamples(const CSAMPLE* pMono, SINT count) {
+    VERIFY_OR_DEBUG_ASSERT(m_pPlugin) {
+        return false;
+    }
+    DEBUG_ASSERT(m_channelCount == mixxx::audio::ChannelCount::stereo());
+
+    // Mono input, i.e. one sample per frame
+    m_currentFrame += count;
+    if (m_currentFrame > m_maxFramesToProcess) {
+        return true; // silently ignore remaining samples
+    }
+
+    return m_pPlugin->processMonoSamples(pMono, count);
+}
+
 void AnalyzerKey::cleanup() {
     m_pPlugin.reset();
 }
@@ -23,6 +23,8 @@ class AnalyzerKey : public Analyzer {
             mixxx::audio::ChannelCount channelCount,
             SINT frameLength) override;
     bool processSamples(const CSAMPLE* pIn, SINT count) override;
+    bool usesMonoSource() const override;
+    bool processMonoSamples(const CSAMPLE* pMono, SINT count) override;
     void storeResults(TrackPointer tio) override;
     void cleanup() override;
 
@@ -1,6 +1,10 @@
 #include "analyzer/analyzerthread.h"
 
+#include <QThread>
+#include <atomic>
+#include <chrono>
 #include <mutex>
+#include <thread>
 
 #include "analyzer/analyzerbeats.h"
 #include "analyzer/analyzerebur128.h"
@@ -17,6 +21,8 @@
 #include "util/db/dbconnectionpooled.h"
 #include "util/db/dbconnectionpooler.h"
 #include "util/logger.h"
+#include "util/sample.h"
+#include "util/threadcpumonitor.h"
 
 namespace {
 
@@ -34,6 +40,28 @@ mixxx::Logger kLogger("AnalyzerThread");
 // continuous feedback.
 const mixxx::Duration kBusyProgressInhibitDuration = mixxx::Duration::fromMillis(60);
 
+// Number of decoded chunks that the decode stage may run ahead of the
+// analyzer DSP stage. A small capacity is sufficient to bridge the
+// alternating stalls of both stages without wasting memory.
+constexpr std::size_t kDecodedChunkQueueCapacity = 4;
+
+// Backoff duration while one pipeline stage waits for the other. Both
+// stages only wait when they outpace each other, so the latency of the
+// backoff does not accumulate.
+constexpr std::chrono::milliseconds kPipelineBackoffDuration(10);
+
+// A chunk of decoded audio data that is handed from the decode stage to
+// the analyzer DSP stage. The samples reside in one of the preallocated
+// chunk buffers which is not reused before this chunk has been popped
+// from the queue.
+struct DecodedChunk {
+    const CSAMPLE* pSamples;
+    SINT sampleLength;
+    // Fraction of the track's frames decoded so far or a negative
+    // value if the length of the audio source is unknown.
+    double frameProgress;
+};
+
 void deleteAnalyzerThread(AnalyzerThread* plainPtr) {
     if (plainPtr) {
         plainPtr->deleteAfterFinished();
@@ -82,40 +110,68 @@ AnalyzerThread::AnalyzerThread(
           m_pConfig(pConfig),
           m_modeFlags(modeFlags),
           m_nextTrack(2), // minimum capacity
-          m_sampleBuffer(mixxx::kAnalysisSamplesPerChunk),
+          m_monoDownmixBuffer(mixxx::kAnalysisFramesPerChunk),
           m_emittedState(AnalyzerThreadState::Void) {
+    // One buffer per queue slot plus one that the decode stage may fill
+    // while the queue is full, see analyzeAudioSource().
+    m_chunkBuffers.reserve(kDecodedChunkQueueCapacity + 1);
+    for (std::size_t i = 0; i < kDecodedChunkQueueCapacity + 1; ++i) {
+        m_chunkBuffers.emplace_back(mixxx::kAnalysisSamplesPerChunk);
+    }
     std::call_once(registerMetaTypesOnceFlag, registerMetaTypesOnce);
 }
 
 void AnalyzerThread::doRun() {
+    ThreadCpuMonitor::tagCurrentThread(QStringLiteral("analyzer"));
+
     std::unique_ptr<AnalysisDao> pAnalysisDao;
     // The thread-local database connection  must not be closed
     // before returning from this function.
     mixxx::DbConnectionPooler dbConnectionPooler;
 
-    if (m_modeFlags & AnalyzerModeFlags::WithWaveform) {
+    // Both the waveform analyzer and the loudness analyzer persist their
+    // results through AnalysisDao and need the thread-local database
+    // connection.
+    const bool loudnessAnalyzerEnabled =
+            AnalyzerEbur128::isEnabled(ReplayGainSettings(m_pConfig));
+    QSqlDatabase dbConnection;
+    if ((m_modeFlags & AnalyzerModeFlags::WithWaveform) || loudnessAnalyzerEnabled) {
         dbConnectionPooler = mixxx::DbConnectionPooler(m_dbConnectionPool); // move assignment
         if (!dbConnectionPooler.isPooling()) {
             kLogger.warning()
                     << "Failed to obtain database connection for analyzer thread";
             return;
         }
-        QSqlDatabase dbConnection = mixxx::DbConnectionPooled(m_dbConnectionPool);
+        dbConnection = mixxx::DbConnectionPooled(m_dbConnectionPool);
+    }
+    if ((m_modeFlags & AnalyzerModeFlags::WithWaveform) &&
+            !(m_modeFlags & AnalyzerModeFlags::ReplayGainOnly)) {
         m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerWaveform>(m_pConfig, dbConnection)));
     }
     if (AnalyzerGain::isEnabled(ReplayGainSettings(m_pConfig))) {
         m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerGain>(m_pConfig)));
     }
-    if (AnalyzerEbur128::isEnabled(ReplayGainSettings(m_pConfig))) {
-        m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerEbur128>(m_pConfig)));
+    if (loudnessAnalyzerEnabled) {
+        m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerEbur128>(m_pConfig, dbConnection)));
+    }
+    if (m_modeFlags & AnalyzerModeFlags::ReplayGainOnly) {
+        // Decoding the audio is the only remaining per-track cost. The
+        // gain analyzers skip tracks that already have a stored value in
+        // initialize(), in which case the track is not even decoded.
+        if (m_analyzers.empty()) {
+            kLogger.warning()
+                    << "ReplayGain-only batch analysis requested,"
+                    << "but ReplayGain analysis is disabled in the preferences";
+        }
+    } else {
+        // BPM detection might be disabled in the config, but can be overridden
+        // and enabled by explicitly setting the mode flag.
+        const bool enforceBpmDetection = (m_modeFlags & AnalyzerModeFlags::WithBeats) != 0;
+        m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerBeats>(m_pConfig, enforceBpmDetection)));
+        m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerKey>(m_pConfig)));
+        m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerSilence>(m_pConfig)));
+        DEBUG_ASSERT(!m_analyzers.empty());
     }
-    // BPM detection might be disabled in the config, but can be overridden
-    // and enabled by explicitly setting the mode flag.
-    const bool enforceBpmDetection = (m_modeFlags & AnalyzerModeFlags::WithBeats) != 0;
-    m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerBeats>(m_pConfig, enforceBpmDetection)));
-    m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerKey>(m_pConfig)));
-    m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerSilence>(m_pConfig)));
-    DEBUG_ASSERT(!m_analyzers.empty());
     kLogger.debug() << "Activated" << m_analyzers.size() << "analyzers";
 
     m_lastBusyProgressEmittedTimer.start();
@@ -234,86 +290,176 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
     // Analysis starts now
     emitBusyProgress(kAnalyzerProgressNone);
 
-    mixxx::IndexRange remainingFrameRange = audioSource->frameIndexRange();
-    while (!remainingFrameRange.empty()) {
-        sleepWhileSuspended();
-        if (isStopping()) {
-            return AnalysisResult::Cancelled;
-        }
+    // The analysis is a two-stage pipeline: the decode stage reads
+    // chunks from the audio source into the ring of preallocated chunk
+    // buffers while the DSP stage (= this worker thread) feeds the
+    // previously decoded chunks to the analyzers. Decoding compressed
+    // formats accounts for a significant share of the wall time of an
+    // analysis run, so overlapping both stages reduces the latency of
+    // analyzing a single track accordingly. The bounded single-producer/
+    // single-consumer queue keeps both stages in lock step and prevents
+    // the decode stage from overwriting a chunk buffer that has not
+    // been consumed, yet.
+    rigtorp::SPSCQueue<DecodedChunk> decodedChunks(kDecodedChunkQueueCapacity);
+    std::atomic<bool> decodingFinished(false);
+    std::atomic<bool> abortDecoding(false);
+
+    const auto decodeStage = [this, &audioSource, &decodedChunks, &decodingFinished, &abortDecoding] {
+        std::size_t nextBufferIndex = 0;
+        mixxx::IndexRange remainingFrameRange = audioSource->frameIndexRange();
+        while (!remainingFrameRange.empty() &&
+                !abortDecoding.load(std::memory_order_relaxed)) {
+            // Split the range for the next chunk from the remaining (= to-be-analyzed) frames
+            auto chunkFrameRange =
+                    remainingFrameRange.splitAndShrinkFront(
+                            math_min(mixxx::kAnalysisFramesPerChunk, remainingFrameRange.length()));
+            DEBUG_ASSERT(!chunkFrameRange.empty());
+
+            // Request the next chunk of audio data
+            mixxx::SampleBuffer& chunkBuffer = m_chunkBuffers[nextBufferIndex];
+            const auto readableSampleFrames =
+                    audioSource->readSampleFrames(
+                            mixxx::WritableSampleFrames(
+                                    chunkFrameRange,
+                                    mixxx::SampleBuffer::WritableSlice(chunkBuffer)));
+            // The returned range fits into the requested range
+            DEBUG_ASSERT(readableSampleFrames.frameIndexRange().isSubrangeOf(chunkFrameRange));
+
+            // Sometimes the duration of the audio source is inaccurate and adjusted
+            // while reading. We need to adjust all frame ranges to reflect this new
+            // situation by restoring all invariants and consistency requirements!
+
+            // Shrink the original range of the current chunks to the actual available
+            // range.
+            chunkFrameRange = intersect(chunkFrameRange, audioSource->frameIndexRange());
+            // The audio data that has just been read should still fit into the adjusted
+            // chunk range.
+            DEBUG_ASSERT(readableSampleFrames.frameIndexRange().isSubrangeOf(chunkFrameRange));
+
+            // We also need to adjust the remaining frame range for the next requests.
+            remainingFrameRange = intersect(remainingFrameRange, audioSource->frameIndexRange());
+            // Currently the range will never grow, but lets also account for this case
+            // that might become relevant in the future.
+            VERIFY_OR_DEBUG_ASSERT(remainingFrameRange.empty() ||
+                    remainingFrameRange.end() == audioSource->frameIndexRange().end()) {
+                if (chunkFrameRange.length() < mixxx::kAnalysisFramesPerChunk) {
+                    // If we have read an incomplete chunk while the range has grown
+                    // we need to discard the read results and re-read the current
+                    // chunk!
+
+                    remainingFrameRange.growFront(chunkFrameRange.length());
+                    continue;
+                }
+                DEBUG_ASSERT(remainingFrameRange.end() < audioSource->frameIndexRange().end());
+                kLogger.warning()
+                        << "Unexpected growth of the audio source while reading"
+                        << mixxx::IndexRange::forward(
+                                   remainingFrameRange.end(), audioSource->frameIndexRange().end());
+                remainingFrameRange.growBack(
+                        audioSource->frameIndexRange().end() - remainingFrameRange.end());
+            }
 
-        // 1st step: Decode next chunk of audio data
-
-        // Split the range for the next chunk from the remaining (= to-be-analyzed) frames
-        auto chunkFrameRange =
-                remainingFrameRange.splitAndShrinkFront(
-                        math_min(mixxx::kAnalysisFramesPerChunk, remainingFrameRange.length()));
-        DEBUG_ASSERT(!chunkFrameRange.empty());
-
-        // Request the next chunk of audio data
-        const auto readableSampleFrames =
-                audioSource->readSampleFrames(
-                        mixxx::WritableSampleFrames(
-                                chunkFrameRange,
-                                mixxx::SampleBuffer::WritableSlice(m_sampleBuffer)));
-        // The returned range fits into the requested range
-        DEBUG_ASSERT(readableSampleFrames.frameIndexRange().isSubrangeOf(chunkFrameRange));
-
-        // Sometimes the duration of the audio source is inaccurate and adjusted
-        // while reading. We need to adjust all frame ranges to reflect this new
-        // situation by restoring all invariants and consistency requirements!
-
-        // Shrink the original range of the current chunks to the actual available
-        // range.
-        chunkFrameRange = intersect(chunkFrameRange, audioSource->frameIndexRange());
-        // The audio data that has just been read should still fit into the adjusted
-        // chunk range.
-        DEBUG_ASSERT(readableSampleFrames.frameIndexRange().isSubrangeOf(chunkFrameRange));
-
-        // We also need to adjust the remaining frame range for the next requests.
-        remainingFrameRange = intersect(remainingFrameRange, audioSource->frameIndexRange());
-        // Currently the range will never grow, but lets also account for this case
-        // that might become relevant in the future.
-        VERIFY_OR_DEBUG_ASSERT(remainingFrameRange.empty() ||
-                remainingFrameRange.end() == audioSource->frameIndexRange().end()) {
-            if (chunkFrameRange.length() < mixxx::kAnalysisFramesPerChunk) {
-                // If we have read an incomplete chunk while the range has grown
-                // we need to discard the read results and re-read the current
-                // chunk!
-
-                remainingFrameRange.growFront(chunkFrameRange.length());
-                continue;
+            DecodedChunk decodedChunk;
+            decodedChunk.pSamples = readableSampleFrames.readableData();
+            decodedChunk.sampleLength = readableSampleFrames.readableLength();
+            if (audioSource->frameLength() > 0) {
+                decodedChunk.frameProgress =
+                        static_cast<double>(audioSource->frameLength() - remainingFrameRange.length()) /
+                        audioSource->frameLength();
+            } else {
+                // Unreadable audio source
+                DEBUG_ASSERT(remainingFrameRange.empty());
+                decodedChunk.frameProgress = -1;
             }
-            DEBUG_ASSERT(remainingFrameRange.end() < audioSource->frameIndexRange().end());
-            kLogger.warning()
-                    << "Unexpected growth of the audio source while reading"
-                    << mixxx::IndexRange::forward(
-                               remainingFrameRange.end(), audioSource->frameIndexRange().end());
-            remainingFrameRange.growBack(
-                    audioSource->frameIndexRange().end() - remainingFrameRange.end());
-        }
 
+            // Hand the chunk over to the DSP stage. A full queue also
+            // limits how far decoding runs ahead, e.g. while the DSP
+            // stage is suspended.
+            while (!decodedChunks.try_push(decodedChunk)) {
+                if (abortDecoding.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                std::this_thread::sleep_for(kPipelineBackoffDuration);
+            }
+            nextBufferIndex = (nextBufferIndex + 1) % m_chunkBuffers.size();
+        }
+        decodingFinished.store(true, std::memory_order_release);
+    };
+    const std::unique_ptr<QThread> decodeThread(QThread::create(decodeStage));
+    // Inherits the priority of this worker thread
+    decodeThread->start();
+
+    AnalysisResult analysisResult = AnalysisResult::Finished;
+    while (true) {
         sleepWhileSuspended();
         if (isStopping()) {
-            return AnalysisResult::Cancelled;
+            analysisResult = AnalysisResult::Cancelled;
+            break;
         }
 
-        // 2nd: step: Analyze chunk of decoded audio data
-        if (!readableSampleFrames.frameIndexRange().empty()) {
-            for (auto&& analyzer : m_analyzers) {
-                analyzer.processSamples(
-                        readableSampleFrames.readableData(),
-                        readableSampleFrames.readableLength());
+        DecodedChunk* pDecodedChunk = decodedChunks.front();
+        if (!pDecodedChunk) {
+            if (decodingFinished.load(std::memory_order_acquire) &&
+                    !decodedChunks.front()) {
+                // All decoded chunks have been consumed
+                break;
             }
+            // Wait for the decode stage to catch up
+            std::this_thread::sleep_for(kPipelineBackoffDuration);
+            continue;
         }
 
+        // Analyze the chunk of decoded audio data. The chunk is fed
+        // through the analyzer chain in cache-sized tiles so that each
+        // tile is still resident when the next analyzer consumes it,
+        // see kAnalysisFramesPerTile.
+        if (pDecodedChunk->sampleLength > 0) {
+            const SINT samplesPerTile = mixxx::kAnalysisFramesPerTile *
+                    audioSource->getSignalInfo().getChannelCount();
+            for (SINT tileOffset = 0; tileOffset < pDecodedChunk->sampleLength;
+                    tileOffset += samplesPerTile) {
+                const CSAMPLE* pTileSamples = pDecodedChunk->pSamples + tileOffset;
+                const SINT tileSampleLength = math_min(
+                        samplesPerTile, pDecodedChunk->sampleLength - tileOffset);
+                // Compute the mono downmix at most once per tile and share
+                // it among all analyzers that only consume a mono signal.
+                // This avoids repeating the identical downmix in each of
+                // their plugins.
+                const CSAMPLE* pMonoDownmix = nullptr;
+                SINT monoSampleLength = 0;
+                for (auto&& analyzer : m_analyzers) {
+                    if (!analyzer.usesMonoSource()) {
+                        analyzer.processSamples(
+                                pTileSamples,
+                                tileSampleLength);
+                        continue;
+                    }
+                    if (!pMonoDownmix) {
+                        // Analyzers only consume the shared mono downmix
+                        // for plain stereo input, see usesMonoSource().
+                        DEBUG_ASSERT(audioSource->getSignalInfo().getChannelCount() ==
+                                mixxx::audio::ChannelCount::stereo());
+                        monoSampleLength =
+                                tileSampleLength / mixxx::kAnalysisChannels;
+                        SampleUtil::mixMultichannelToMono(
+                                m_monoDownmixBuffer.data(),
+                                pTileSamples,
+                                tileSampleLength);
+                        pMonoDownmix = m_monoDownmixBuffer.data();
+                    }
+                    analyzer.processMonoSamples(pMonoDownmix, monoSampleLength);
+                }
+            }
+        }
+        const double frameProgress = pDecodedChunk->frameProgress;
+        // Popping the chunk releases its buffer for reuse by the
+        // decode stage, so this must not happen before the analyzers
+        // have processed all samples.
+        decodedChunks.pop();
+
         // Don't check again for paused/stopped again and simply finish
         // the current iteration by emitting progress.
-
-        // 3rd step: Update & emit progress
-        if (audioSource->frameLength() > 0) {
-            const double frameProgress =
-                    static_cast<double>(audioSource->frameLength() - remainingFrameRange.length()) /
-                    audioSource->frameLength();
+        if (frameProgress >= 0) {
             // math_min is required to compensate rounding errors
             const AnalyzerProgress progress =
                     math_min(kAnalyzerProgressFinalizing,
@@ -323,12 +469,16 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
             emitBusyProgress(progress);
         } else {
             // Unreadable audio source
-            DEBUG_ASSERT(remainingFrameRange.empty());
             emitBusyProgress(kAnalyzerProgressUnknown);
         }
     }
 
-    return AnalysisResult::Finished;
+    // Shut down the decode stage before leaving. The audio source must
+    // not be accessed by the decode stage after returning!
+    abortDecoding.store(true, std::memory_order_relaxed);
+    decodeThread->wait();
+
+    return analysisResult;
 }
 
 void AnalyzerThread::emitBusyProgress(AnalyzerProgress busyProgress) {
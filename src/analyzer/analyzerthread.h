@@ -22,6 +22,10 @@ enum AnalyzerModeFlags {
     WithBeats = 0x01,
     WithWaveform = 0x02,
     LowPriority = 0x04,
+    // Batch normalization job: only the ReplayGain analyzers are
+    // activated. Tracks that already have a gain value are skipped
+    // without decoding, so an interrupted run resumes cheaply.
+    ReplayGainOnly = 0x08,
     All = WithBeats | WithWaveform,
 };
 
@@ -118,7 +122,16 @@ class AnalyzerThread : public WorkerThread {
 
     std::vector<AnalyzerWithState> m_analyzers;
 
-    mixxx::SampleBuffer m_sampleBuffer;
+    // Ring of preallocated chunk buffers that are shared between the
+    // decode stage and the analyzer DSP stage of analyzeAudioSource().
+    // The bounded queue between both stages guarantees that a buffer
+    // is never overwritten before its chunk has been consumed.
+    std::vector<mixxx::SampleBuffer> m_chunkBuffers;
+
+    // Mono downmix of the current chunk that is computed at most once
+    // per chunk and shared among all analyzers that only consume a
+    // mono signal, e.g. both the beat and the key detector.
+    mixxx::SampleBuffer m_monoDownmixBuffer;
 
     std::optional<AnalyzerTrack> m_currentTrack;
 
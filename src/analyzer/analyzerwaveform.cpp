@@ -19,6 +19,22 @@ constexpr double kLowMidFreqHz = 600.0;
 
 constexpr double kMidHighFreqHz = 4000.0;
 
+// Number of frames until the running stride position wraps around the
+// given stride length the next time, i.e. the smallest n >= 1 for which
+// fmod(position + n, length) < 1 holds. This reproduces the stride
+// boundaries of the former per-frame modulo check and allows processing
+// all frames between two boundaries as one block.
+int framesUntilStrideStore(int position, double length) {
+    if (length <= 1.0) {
+        return 1;
+    }
+    // The next multiple of length beyond the current position determines
+    // the boundary. Each window [k * length, k * length + 1) contains
+    // exactly one integer position, namely ceil(k * length).
+    const double nextMultiple = (std::floor(position / length) + 1.0) * length;
+    return static_cast<int>(std::ceil(nextMultiple)) - position;
+}
+
 } // namespace
 
 AnalyzerWaveform::AnalyzerWaveform(
@@ -113,20 +129,25 @@ bool AnalyzerWaveform::shouldAnalyze(TrackPointer pTrack) const {
     bool missingWavesummary = pTrackWaveformSummary.isNull();
 
     if (trackId.isValid() && (missingWaveform || missingWavesummary)) {
+        // Fetch only the version records first. The waveform data itself is
+        // loaded afterwards for the (at most two) records that are actually
+        // up-to-date and needed. Loading the data of all records upfront
+        // would read and uncompress the full waveform of every track even
+        // if it is about to be discarded or re-analyzed anyway.
         QList<AnalysisDao::AnalysisInfo> analyses =
-                m_analysisDao.getAnalysesForTrack(trackId);
+                m_analysisDao.getAnalysisMetadataForTrack(trackId);
 
-        QListIterator<AnalysisDao::AnalysisInfo> it(analyses);
-        while (it.hasNext()) {
-            const AnalysisDao::AnalysisInfo& analysis = it.next();
+        for (auto& analysis : analyses) {
             WaveformFactory::VersionClass vc;
 
             if (analysis.type == AnalysisDao::TYPE_WAVEFORM) {
                 vc = WaveformFactory::waveformVersionToVersionClass(analysis.version);
                 if (missingWaveform && vc == WaveformFactory::VC_USE) {
-                    pLoadedTrackWaveform = ConstWaveformPointer(
-                            WaveformFactory::loadWaveformFromAnalysis(analysis));
-                    missingWaveform = false;
+                    if (m_analysisDao.loadAnalysisData(&analysis)) {
+                        pLoadedTrackWaveform = ConstWaveformPointer(
+                                WaveformFactory::loadWaveformFromAnalysis(analysis));
+                        missingWaveform = false;
+                    }
                 } else if (vc != WaveformFactory::VC_KEEP) {
                     // remove all other Analysis except that one we should keep
                     m_analysisDao.deleteAnalysis(analysis.analysisId);
@@ -135,9 +156,11 @@ bool AnalyzerWaveform::shouldAnalyze(TrackPointer pTrack) const {
             if (analysis.type == AnalysisDao::TYPE_WAVESUMMARY) {
                 vc = WaveformFactory::waveformSummaryVersionToVersionClass(analysis.version);
                 if (missingWavesummary && vc == WaveformFactory::VC_USE) {
-                    pLoadedTrackWaveformSummary = ConstWaveformPointer(
-                            WaveformFactory::loadWaveformFromAnalysis(analysis));
-                    missingWavesummary = false;
+                    if (m_analysisDao.loadAnalysisData(&analysis)) {
+                        pLoadedTrackWaveformSummary = ConstWaveformPointer(
+                                WaveformFactory::loadWaveformFromAnalysis(analysis));
+                        missingWavesummary = false;
+                    }
                 } else if (vc != WaveformFactory::VC_KEEP) {
                     // remove all other Analysis except that one we should keep
                     m_analysisDao.deleteAnalysis(analysis.analysisId);
@@ -158,6 +181,37 @@ bool AnalyzerWaveform::shouldAnalyze(TrackPointer pTrack) const {
     }
 #endif
 
+    // A missing or discarded summary alone does not justify decoding the
+    // whole file again: the summary is just a lower-resolution average of
+    // the band data the stored waveform already contains, so derive it by
+    // recombination and persist it right away.
+    if (missingWavesummary && !missingWaveform && trackId.isValid()) {
+        ConstWaveformPointer pSourceWaveform = pLoadedTrackWaveform.isNull()
+                ? pTrackWaveform
+                : pLoadedTrackWaveform;
+        if (!pSourceWaveform.isNull()) {
+            WaveformPointer pDerivedSummary(
+                    WaveformFactory::createWaveformSummaryFromWaveform(
+                            *pSourceWaveform));
+            if (pDerivedSummary->getDataSize() > 0) {
+                AnalysisDao::AnalysisInfo analysis;
+                analysis.trackId = trackId;
+                analysis.type = AnalysisDao::TYPE_WAVESUMMARY;
+                analysis.description = pDerivedSummary->getDescription();
+                analysis.version = pDerivedSummary->getVersion();
+                analysis.data = pDerivedSummary->toByteArray();
+                if (m_analysisDao.saveAnalysis(&analysis)) {
+                    pDerivedSummary->setId(analysis.analysisId);
+                }
+                pDerivedSummary->setSaveState(Waveform::SaveState::Saved);
+                pLoadedTrackWaveformSummary = pDerivedSummary;
+                missingWavesummary = false;
+                kLogger.debug()
+                        << "Derived waveform summary from stored waveform";
+            }
+        }
+    }
+
     // If we don't need to calculate the waveform/wavesummary, skip.
     if (!missingWaveform && !missingWavesummary) {
         kLogger.debug() << "loadStored - Stored waveform loaded";
@@ -233,46 +287,63 @@ bool AnalyzerWaveform::processSamples(const CSAMPLE* pIn, SINT count) {
     m_waveform->setSaveState(Waveform::SaveState::NotSaved);
     m_waveformSummary->setSaveState(Waveform::SaveState::NotSaved);
 
-    for (SINT i = 0; i < count; i += 2) {
-        // Take max value, not average of data
-        CSAMPLE cover[2] = {fabs(pWaveformInput[i]), fabs(pWaveformInput[i + 1])};
-        CSAMPLE clow[2] = {fabs(m_buffers.low[i]), fabs(m_buffers.low[i + 1])};
-        CSAMPLE cmid[2] = {fabs(m_buffers.mid[i]), fabs(m_buffers.mid[i + 1])};
-        CSAMPLE chigh[2] = {fabs(m_buffers.high[i]), fabs(m_buffers.high[i + 1])};
-
-        // This is for if you want to experiment with averaging instead of
-        // maxing.
-        // m_stride.m_overallData[Right] += buffer[i]*buffer[i];
-        // m_stride.m_overallData[Left] += buffer[i + 1]*buffer[i + 1];
-        // m_stride.m_filteredData[Right][Low] += m_buffers.low[i]*m_buffers.low[i];
-        // m_stride.m_filteredData[Left][Low] += m_buffers.low[i + 1]*m_buffers.low[i + 1];
-        // m_stride.m_filteredData[Right][Mid] += m_buffers.mid[i]*m_buffers.mid[i];
-        // m_stride.m_filteredData[Left][Mid] += m_buffers.mid[i + 1]*m_buffers.mid[i + 1];
-        // m_stride.m_filteredData[Right][High] += m_buffers.high[i]*m_buffers.high[i];
-        // m_stride.m_filteredData[Left][High] += m_buffers.high[i + 1]*m_buffers.high[i + 1];
-
-        // Record the max across this stride.
-        storeIfGreater(&m_stride.m_overallData[Left], cover[Left]);
-        storeIfGreater(&m_stride.m_overallData[Right], cover[Right]);
-        storeIfGreater(&m_stride.m_filteredData[Left][Low], clow[Left]);
-        storeIfGreater(&m_stride.m_filteredData[Right][Low], clow[Right]);
-        storeIfGreater(&m_stride.m_filteredData[Left][Mid], cmid[Left]);
-        storeIfGreater(&m_stride.m_filteredData[Right][Mid], cmid[Right]);
-        storeIfGreater(&m_stride.m_filteredData[Left][High], chigh[Left]);
-        storeIfGreater(&m_stride.m_filteredData[Right][High], chigh[Right]);
+    // Take max value, not average of data. All frames between two stride
+    // boundaries are reduced with vectorized per-channel block maxima
+    // instead of updating the stride for every single frame.
+    //
+    // This is for if you want to experiment with averaging instead of
+    // maxing: accumulate the squared samples of each segment, e.g. with
+    // SampleUtil::sumSquared(), into the stride data instead of the
+    // maxima below.
+    SINT i = 0;
+    while (i < count) {
+        // The next stride boundary of either waveform limits the number
+        // of frames that can be reduced as a single block.
+        const int framesToStore = framesUntilStrideStore(
+                m_stride.m_position, m_stride.m_length);
+        const int framesToSummaryStore = framesUntilStrideStore(
+                m_stride.m_position, m_stride.m_averageLength);
+        const SINT segmentFrames = math_min3(
+                static_cast<SINT>(framesToStore),
+                static_cast<SINT>(framesToSummaryStore),
+                (count - i) / 2);
+        DEBUG_ASSERT(segmentFrames >= 1);
+        const SINT segmentSamples = segmentFrames * 2;
+
+        // Record the max across this segment.
+        CSAMPLE maxAbs[2];
+        SampleUtil::maxAbsPerChannel(
+                &maxAbs[Left], &maxAbs[Right], pWaveformInput + i, segmentSamples);
+        storeIfGreater(&m_stride.m_overallData[Left], maxAbs[Left]);
+        storeIfGreater(&m_stride.m_overallData[Right], maxAbs[Right]);
+        SampleUtil::maxAbsPerChannel(
+                &maxAbs[Left], &maxAbs[Right], &m_buffers.low[i], segmentSamples);
+        storeIfGreater(&m_stride.m_filteredData[Left][Low], maxAbs[Left]);
+        storeIfGreater(&m_stride.m_filteredData[Right][Low], maxAbs[Right]);
+        SampleUtil::maxAbsPerChannel(
+                &maxAbs[Left], &maxAbs[Right], &m_buffers.mid[i], segmentSamples);
+        storeIfGreater(&m_stride.m_filteredData[Left][Mid], maxAbs[Left]);
+        storeIfGreater(&m_stride.m_filteredData[Right][Mid], maxAbs[Right]);
+        SampleUtil::maxAbsPerChannel(
+                &maxAbs[Left], &maxAbs[Right], &m_buffers.high[i], segmentSamples);
+        storeIfGreater(&m_stride.m_filteredData[Left][High], maxAbs[Left]);
+        storeIfGreater(&m_stride.m_filteredData[Right][High], maxAbs[Right]);
 
         for (int s = 0; s < stemCount; s++) {
-            CSAMPLE cstem[2] = {
-                    fabs(pIn[i * stemCount + s * mixxx::kAnalysisChannels]),
-                    fabs(pIn[i * stemCount + s * mixxx::kAnalysisChannels +
-                            1])};
-            storeIfGreater(&m_stride.m_stemData[Left][s], cstem[Left]);
-            storeIfGreater(&m_stride.m_stemData[Right][s], cstem[Right]);
+            for (SINT j = i; j < i + segmentSamples; j += 2) {
+                CSAMPLE cstem[2] = {
+                        fabs(pIn[j * stemCount + s * mixxx::kAnalysisChannels]),
+                        fabs(pIn[j * stemCount + s * mixxx::kAnalysisChannels +
+                                1])};
+                storeIfGreater(&m_stride.m_stemData[Left][s], cstem[Left]);
+                storeIfGreater(&m_stride.m_stemData[Right][s], cstem[Right]);
+            }
         }
 
-        m_stride.m_position++;
+        m_stride.m_position += segmentFrames;
+        i += segmentSamples;
 
-        if (fmod(m_stride.m_position, m_stride.m_length) < 1) {
+        if (segmentFrames == framesToStore) {
             VERIFY_OR_DEBUG_ASSERT(m_currentStride + ChannelCount <= m_waveform->getDataSize()) {
                 qWarning() << "AnalyzerWaveform::process - currentStride > waveform size";
                 return false;
@@ -282,7 +353,7 @@ bool AnalyzerWaveform::processSamples(const CSAMPLE* pIn, SINT count) {
             m_waveform->setCompletion(m_currentStride);
         }
 
-        if (fmod(m_stride.m_position, m_stride.m_averageLength) < 1) {
+        if (segmentFrames == framesToSummaryStore) {
             VERIFY_OR_DEBUG_ASSERT(m_currentSummaryStride + ChannelCount <= m_waveformSummary->getDataSize()) {
                 qWarning() << "AnalyzerWaveform::process - current summary stride > waveform summary size";
                 return false;
@@ -6,6 +6,7 @@
 #include "track/beats.h"
 #include "track/bpm.h"
 #include "track/keys.h"
+#include "util/assert.h"
 #include "util/types.h"
 
 namespace mixxx {
@@ -63,6 +64,21 @@ class AnalyzerPlugin {
     virtual bool initialize(mixxx::audio::SampleRate sampleRate) = 0;
     virtual bool processSamples(const CSAMPLE* pIn, SINT iLen) = 0;
     virtual bool finalize() = 0;
+
+    // Returns true if the plugin only analyzes a mono downmix of the
+    // signal. The caller may then pass a precomputed (L+R)/2 downmix
+    // to processMonoSamples() instead of interleaved stereo samples
+    // to processSamples() and thereby share the downmix among all
+    // mono plugins.
+    virtual bool usesMonoSource() const {
+        return false;
+    }
+    virtual bool processMonoSamples(const CSAMPLE* pMono, SINT iLen) {
+        Q_UNUSED(pMono);
+        Q_UNUSED(iLen);
+        DEBUG_ASSERT(!"processMonoSamples() only available if usesMonoSource()");
+        return false;
+    }
 };
 
 class AnalyzerBeatsPlugin : public AnalyzerPlugin {
@@ -74,6 +74,14 @@ bool AnalyzerQueenMaryBeats::processSamples(const CSAMPLE* pIn, SINT iLen) {
     return m_helper.processStereoSamples(pIn, iLen);
 }
 
+bool AnalyzerQueenMaryBeats::processMonoSamples(const CSAMPLE* pMono, SINT iLen) {
+    if (!m_pDetectionFunction) {
+        return false;
+    }
+
+    return m_helper.processMonoSamples(pMono, iLen);
+}
+
 bool AnalyzerQueenMaryBeats::finalize() {
     m_helper.finalize();
 
@@ -34,6 +34,11 @@ class AnalyzerQueenMaryBeats : public AnalyzerBeatsPlugin {
     bool processSamples(const CSAMPLE* pIn, SINT iLen) override;
     bool finalize() override;
 
+    bool usesMonoSource() const override {
+        return true;
+    }
+    bool processMonoSamples(const CSAMPLE* pMono, SINT iLen) override;
+
     bool supportsBeatTracking() const override {
         return true;
     }
@@ -87,6 +87,15 @@ bool AnalyzerQueenMaryKey::processSamples(const CSAMPLE* pIn, SINT iLen) {
     return m_helper.processStereoSamples(pIn, iLen);
 }
 
+bool AnalyzerQueenMaryKey::processMonoSamples(const CSAMPLE* pMono, SINT iLen) {
+    if (!m_pKeyMode) {
+        return false;
+    }
+
+    m_currentFrame += iLen;
+    return m_helper.processMonoSamples(pMono, iLen);
+}
+
 bool AnalyzerQueenMaryKey::finalize() {
     m_helper.finalize();
     m_pKeyMode.reset();
@@ -1,6 +1,10 @@
 #include "analyzer/plugins/buffering_utils.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "util/math.h"
+#include "util/samplesimd.h"
 
 namespace mixxx {
 
@@ -20,7 +24,11 @@ bool DownmixAndOverlapHelper::initialize(size_t windowSize,
 
 bool DownmixAndOverlapHelper::processStereoSamples(const CSAMPLE* pInput, size_t inputStereoSamples) {
     const size_t numInputFrames = inputStereoSamples / 2;
-    return processInner(pInput, numInputFrames);
+    return processInner(pInput, numInputFrames, true);
+}
+
+bool DownmixAndOverlapHelper::processMonoSamples(const CSAMPLE* pInput, size_t inputMonoSamples) {
+    return processInner(pInput, inputMonoSamples, false);
 }
 
 bool DownmixAndOverlapHelper::finalize() {
@@ -31,33 +39,38 @@ bool DownmixAndOverlapHelper::finalize() {
     // instead of "m_windowSize / 2 - m_stepSize"
     size_t framesToFillWindow = m_windowSize - m_bufferWritePosition;
     size_t numInputFrames = math_max(framesToFillWindow, m_windowSize / 2 - 1);
-    return processInner(nullptr, numInputFrames);
+    return processInner(nullptr, numInputFrames, false);
 }
 
 bool DownmixAndOverlapHelper::processInner(
-        const CSAMPLE* pInput, size_t numInputFrames) {
+        const CSAMPLE* pInput, size_t numInputFrames, bool downmixStereoInput) {
     size_t inRead = 0;
     double* pDownmix = m_buffer.data();
+    const auto& simd = samplesimd::dispatch();
 
     while (inRead < numInputFrames) {
         size_t readAvailable = numInputFrames - inRead;
         DEBUG_ASSERT(m_bufferWritePosition <= m_windowSize);
         size_t writeAvailable = m_windowSize - m_bufferWritePosition;
         size_t numFrames = math_min(readAvailable, writeAvailable);
-        if (pInput) {
-            for (size_t i = 0; i < numFrames; ++i) {
-                // We analyze a mono downmix of the signal since we don't think
-                // stereo does us any good.
-                pDownmix[m_bufferWritePosition + i] = (pInput[(inRead + i) * 2] +
-                                                              pInput[(inRead + i) * 2 + 1]) *
-                        0.5;
-            }
+        if (pInput && downmixStereoInput) {
+            // We analyze a mono downmix of the signal since we don't think
+            // stereo does us any good.
+            simd.downmixStereoToMonoDouble(
+                    pDownmix + m_bufferWritePosition,
+                    pInput + inRead * 2,
+                    static_cast<SINT>(numFrames));
+        } else if (pInput) {
+            // The input has already been downmixed to mono by the caller
+            // and only needs to be widened to double precision.
+            simd.widenToDouble(
+                    pDownmix + m_bufferWritePosition,
+                    pInput + inRead,
+                    static_cast<SINT>(numFrames));
         } else {
             // we are in the finalize call. Add silence to
             // complete samples left in th buffer.
-            for (size_t i = 0; i < numFrames; ++i) {
-                pDownmix[m_bufferWritePosition + i] = 0;
-            }
+            std::fill_n(pDownmix + m_bufferWritePosition, numFrames, 0.0);
         }
         m_bufferWritePosition += numFrames;
         inRead += numFrames;
@@ -71,10 +84,11 @@ bool DownmixAndOverlapHelper::processInner(
             }
 
             // If the window size equals the step size then this will result
-            // in m_bufferWritePosition == 0.
-            for (size_t i = 0; i < (m_windowSize - m_stepSize); ++i) {
-                pDownmix[i] = pDownmix[i + m_stepSize];
-            }
+            // in m_bufferWritePosition == 0. The overlapping regions never
+            // alias in a way memmove cannot handle.
+            std::memmove(pDownmix,
+                    pDownmix + m_stepSize,
+                    (m_windowSize - m_stepSize) * sizeof(double));
             m_bufferWritePosition -= m_stepSize;
         }
     }
@@ -9,7 +9,9 @@ namespace mixxx {
 
 // This is used for downmixing a stereo buffer into mono and framing it into
 // overlapping windows as is typically necessary when taking a short-time
-// Fourier transform.
+// Fourier transform. Input that has already been downmixed to mono by the
+// caller can be framed without the redundant downmix via
+// processMonoSamples().
 class DownmixAndOverlapHelper {
   public:
     DownmixAndOverlapHelper() = default;
@@ -25,10 +27,17 @@ class DownmixAndOverlapHelper {
             const CSAMPLE* pInput,
             size_t inputStereoSamples);
 
+    bool processMonoSamples(
+            const CSAMPLE* pInput,
+            size_t inputMonoSamples);
+
     bool finalize();
 
   private:
-    bool processInner(const CSAMPLE* pInput, size_t numInputFrames);
+    bool processInner(
+            const CSAMPLE* pInput,
+            size_t numInputFrames,
+            bool downmixStereoInput);
 
     std::vector<double> m_buffer;
     // The window size in frames.
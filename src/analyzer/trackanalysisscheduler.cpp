@@ -10,7 +10,11 @@ namespace {
 
 mixxx::Logger kLogger("TrackAnalysisScheduler");
 
-constexpr QThread::Priority kWorkerThreadPriority = QThread::LowPriority;
+// Batch analysis runs at low OS priority so that ad-hoc analysis of
+// tracks loaded into a deck as well as the audible engine and UI take
+// precedence when all cores are busy.
+constexpr QThread::Priority kBatchWorkerThreadPriority = QThread::LowPriority;
+constexpr QThread::Priority kAdHocWorkerThreadPriority = QThread::NormalPriority;
 
 // Maximum frequency of progress updates
 constexpr std::chrono::milliseconds kProgressInhibitDuration(100);
@@ -83,10 +87,17 @@ TrackAnalysisScheduler::TrackAnalysisScheduler(
                 this,
                 &TrackAnalysisScheduler::onWorkerThreadProgress);
     }
-    // 2nd pass: Start worker threads in a suspended state
+    // 2nd pass: Start worker threads in a suspended state. The OS thread
+    // priority implements the priority lanes between the schedulers: the
+    // batch analysis workers (LowPriority mode flag) yield to the workers
+    // of the ad-hoc scheduler that analyzes tracks loaded into a deck.
+    const QThread::Priority workerThreadPriority =
+            (modeFlags & AnalyzerModeFlags::LowPriority)
+            ? kBatchWorkerThreadPriority
+            : kAdHocWorkerThreadPriority;
     for (const auto& worker: m_workers) {
         worker.thread()->suspend();
-        worker.thread()->start(kWorkerThreadPriority);
+        worker.thread()->start(workerThreadPriority);
     }
 }
 
@@ -1,5 +1,7 @@
 #include "control/control.h"
 
+#include <array>
+
 #include "control/controlobject.h"
 #include "moc_control.cpp"
 #include "util/mutex.h"
@@ -25,17 +27,36 @@ constexpr Stat::ComputeFlags kComputeFlags = {Stat::COUNT,
         Stat::MIN,
         Stat::MAX};
 
-/// Mutex guarding access to s_qCOHash and s_qCOAliasHash.
-MMutex s_qCOHashMutex;
+/// Number of shards the control registry is split into. Must be a power of
+/// two so the shard can be selected by masking the key hash.
+constexpr size_t kControlShardCount = 16;
+
+/// One shard of the registry of ControlDoublePrivate instantiations. The
+/// registry is sharded by key hash and each shard is guarded by its own
+/// read-write lock, so concurrent lookups (GUI, controller threads and
+/// ControlProxy construction from the engine callback path) neither
+/// serialize with each other nor contend on a single global mutex. Only
+/// control creation, destruction and alias insertion take a write lock.
+struct ControlShard {
+    MReadWriteLock lock;
+    QHash<ConfigKey, QWeakPointer<ControlDoublePrivate>> controls
+            GUARDED_BY(lock);
+};
+
+std::array<ControlShard, kControlShardCount> s_controlShards;
+
+ControlShard& shardFor(const ConfigKey& key) {
+    return s_controlShards[qHash(key) & (kControlShardCount - 1)];
+}
 
-/// Hash of ControlDoublePrivate instantiations.
-QHash<ConfigKey, QWeakPointer<ControlDoublePrivate>> s_qCOHash
-        GUARDED_BY(s_qCOHashMutex);
+/// Mutex guarding access to s_qCOAliasHash and the creation of the default
+/// control.
+MMutex s_qCOAliasMutex;
 
 /// Hash of aliases between ConfigKeys. Solely used for looking up the first
 /// alias associated with a key.
 QHash<ConfigKey, ConfigKey> s_qCOAliasHash
-        GUARDED_BY(s_qCOHashMutex);
+        GUARDED_BY(s_qCOAliasMutex);
 
 /// is used instead of a nullptr, helps to omit null checks everywhere
 QWeakPointer<ControlDoublePrivate> s_pDefaultCO;
@@ -80,10 +101,12 @@ ControlDoublePrivate::ControlDoublePrivate(
 }
 
 ControlDoublePrivate::~ControlDoublePrivate() {
-    s_qCOHashMutex.lock();
-    //qDebug() << "ControlDoublePrivate::s_qCOHash.remove(" << m_key.group << "," << m_key.item << ")";
-    s_qCOHash.remove(m_key);
-    s_qCOHashMutex.unlock();
+    {
+        ControlShard& shard = shardFor(m_key);
+        MWriteLocker locker(&shard.lock);
+        //qDebug() << "ControlDoublePrivate registry remove(" << m_key.group << "," << m_key.item << ")";
+        shard.controls.remove(m_key);
+    }
 
     if (m_bPersistInConfiguration) {
         UserSettingsPointer pConfig = s_pUserConfig;
@@ -102,26 +125,36 @@ void ControlDoublePrivate::setUserConfig(const UserSettingsPointer& pConfig) {
 
 // static
 void ControlDoublePrivate::insertAlias(const ConfigKey& alias, const ConfigKey& key) {
-    MMutexLocker locker(&s_qCOHashMutex);
     VERIFY_OR_DEBUG_ASSERT(alias != key) {
         qWarning() << "cannot create alias with identical key" << key;
         return;
     }
 
-    auto it = s_qCOHash.constFind(key);
-    VERIFY_OR_DEBUG_ASSERT(it != s_qCOHash.constEnd()) {
-        qWarning() << "cannot create alias for null control" << key;
-        return;
+    QSharedPointer<ControlDoublePrivate> pControl;
+    {
+        ControlShard& shard = shardFor(key);
+        MReadLocker locker(&shard.lock);
+        auto it = shard.controls.constFind(key);
+        VERIFY_OR_DEBUG_ASSERT(it != shard.controls.constEnd()) {
+            qWarning() << "cannot create alias for null control" << key;
+            return;
+        }
+        pControl = it.value();
     }
-
-    QSharedPointer<ControlDoublePrivate> pControl = it.value();
     VERIFY_OR_DEBUG_ASSERT(!pControl.isNull()) {
         qWarning() << "cannot create alias for expired control" << key;
         return;
     }
 
-    s_qCOAliasHash.insert(key, alias);
-    s_qCOHash.insert(alias, pControl);
+    {
+        MMutexLocker locker(&s_qCOAliasMutex);
+        s_qCOAliasHash.insert(key, alias);
+    }
+    // Note: alias and key may map to different shards. The shard locks are
+    // never held simultaneously to avoid lock-order issues.
+    ControlShard& aliasShard = shardFor(alias);
+    MWriteLocker locker(&aliasShard.lock);
+    aliasShard.controls.insert(alias, pControl);
 }
 
 // static
@@ -142,11 +175,13 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
         return nullptr;
     }
 
-    // Scope for MMutexLocker.
+    ControlShard& shard = shardFor(key);
+    // Scope for MReadLocker. The hot lookup path only takes the shard's read
+    // lock, so concurrent lookups never serialize.
     {
-        const MMutexLocker locker(&s_qCOHashMutex);
-        const auto it = s_qCOHash.constFind(key);
-        if (it != s_qCOHash.constEnd()) {
+        MReadLocker locker(&shard.lock);
+        const auto it = shard.controls.constFind(key);
+        if (it != shard.controls.constEnd()) {
             auto pControl = it.value().lock();
             if (pControl) {
                 auto actualKey = pControl->getKey();
@@ -169,10 +204,9 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
                     return nullptr;
                 }
                 return pControl;
-            } else {
-                // The weak pointer has become invalid and can be cleaned up
-                s_qCOHash.erase(it);
             }
+            // The weak pointer has become invalid. No cleanup is required
+            // here, the entry is removed by ~ControlDoublePrivate.
         }
     }
 
@@ -184,9 +218,9 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
                         bTrack,
                         bPersist,
                         defaultValue));
-        const MMutexLocker locker(&s_qCOHashMutex);
-        //qDebug() << "ControlDoublePrivate::s_qCOHash.insert(" << key.group << "," << key.item << ")";
-        s_qCOHash.insert(key, pControl);
+        MWriteLocker locker(&shard.lock);
+        //qDebug() << "ControlDoublePrivate registry insert(" << key.group << "," << key.item << ")";
+        shard.controls.insert(key, pControl);
         return pControl;
     }
 
@@ -205,7 +239,7 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getDefaultControl() {
         // Try again with the mutex locked to protect against creating two
         // ControlDoublePrivateConst objects. Access to s_defaultCO itself is
         // thread save.
-        MMutexLocker locker(&s_qCOHashMutex);
+        MMutexLocker locker(&s_qCOAliasMutex);
         defaultCO = s_pDefaultCO.lock();
         if (!defaultCO) {
             defaultCO = QSharedPointer<ControlDoublePrivate>(new ControlDoublePrivateConst());
@@ -218,15 +252,15 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getDefaultControl() {
 // static
 QList<QSharedPointer<ControlDoublePrivate>> ControlDoublePrivate::getAllInstances() {
     QList<QSharedPointer<ControlDoublePrivate>> result;
-    MMutexLocker locker(&s_qCOHashMutex);
-    result.reserve(s_qCOHash.size());
-    for (auto it = s_qCOHash.constBegin(); it != s_qCOHash.constEnd(); ++it) {
-        auto pControl = it.value().lock();
-        if (pControl) {
-            result.append(std::move(pControl));
-        } else {
-            // The weak pointer has become invalid and can be cleaned up
-            s_qCOHash.erase(it);
+    for (ControlShard& shard : s_controlShards) {
+        MReadLocker locker(&shard.lock);
+        result.reserve(result.size() + shard.controls.size());
+        for (auto it = shard.controls.constBegin(); it != shard.controls.constEnd(); ++it) {
+            auto pControl = it.value().lock();
+            if (pControl) {
+                result.append(std::move(pControl));
+            }
+            // Expired weak pointers are removed by ~ControlDoublePrivate.
         }
     }
     return result;
@@ -235,21 +269,23 @@ QList<QSharedPointer<ControlDoublePrivate>> ControlDoublePrivate::getAllInstance
 // static
 QList<QSharedPointer<ControlDoublePrivate>> ControlDoublePrivate::takeAllInstances() {
     QList<QSharedPointer<ControlDoublePrivate>> result;
-    MMutexLocker locker(&s_qCOHashMutex);
-    result.reserve(s_qCOHash.size());
-    for (auto it = s_qCOHash.begin(); it != s_qCOHash.end(); ++it) {
-        auto pControl = it.value().lock();
-        if (pControl) {
-            result.append(std::move(pControl));
+    for (ControlShard& shard : s_controlShards) {
+        MWriteLocker locker(&shard.lock);
+        result.reserve(result.size() + shard.controls.size());
+        for (auto it = shard.controls.begin(); it != shard.controls.end(); ++it) {
+            auto pControl = it.value().lock();
+            if (pControl) {
+                result.append(std::move(pControl));
+            }
         }
+        shard.controls.clear();
     }
-    s_qCOHash.clear();
     return result;
 }
 
 //static
 QHash<ConfigKey, ConfigKey> ControlDoublePrivate::getControlAliases() {
-    MMutexLocker locker(&s_qCOHashMutex);
+    MMutexLocker locker(&s_qCOAliasMutex);
     // lock thread-unsafe copy constructors of QHash
     return s_qCOAliasHash;
 }
@@ -7,12 +7,17 @@
 namespace {
 const QString kAppGroup = QStringLiteral("[App]");
 const QString kLegacyGroup = QStringLiteral("[Master]");
+constexpr int kIndicatorIntervalMs = 250;
+// Blinking indicators tolerate some jitter, so allow the shared timer
+// service to run the toggle early if another wakeup happens anyway.
+constexpr int kIndicatorSlackMs = 50;
 } // namespace
 
 namespace mixxx {
 
 ControlIndicatorTimer::ControlIndicatorTimer(QObject* pParent)
         : QObject(pParent),
+          m_timerServiceClientId(CoalescingTimerService::kInvalidClientId),
           m_pCOIndicator250millis(std::make_unique<ControlObject>(
                   ConfigKey(kAppGroup, QStringLiteral("indicator_250ms")))),
           m_pCOIndicator500millis(std::make_unique<ControlObject>(
@@ -26,7 +31,31 @@ ControlIndicatorTimer::ControlIndicatorTimer(QObject* pParent)
     m_pCOIndicator500millis->addAlias(
             ConfigKey(kLegacyGroup, QStringLiteral("indicator_500millis")));
     connect(&m_timer, &QTimer::timeout, this, &ControlIndicatorTimer::slotTimeout);
-    m_timer.start(250);
+    startIndicatorTimer();
+}
+
+void ControlIndicatorTimer::startIndicatorTimer() {
+    if (auto* pTimerService = CoalescingTimerService::instance()) {
+        m_timerServiceClientId = pTimerService->registerClient(
+                this,
+                kIndicatorIntervalMs,
+                kIndicatorSlackMs,
+                [this]() {
+                    slotTimeout();
+                });
+    } else {
+        m_timer.start(kIndicatorIntervalMs);
+    }
+}
+
+void ControlIndicatorTimer::stopIndicatorTimer() {
+    m_timer.stop();
+    if (m_timerServiceClientId != CoalescingTimerService::kInvalidClientId) {
+        if (auto* pTimerService = CoalescingTimerService::instance()) {
+            pTimerService->unregisterClient(m_timerServiceClientId);
+        }
+        m_timerServiceClientId = CoalescingTimerService::kInvalidClientId;
+    }
 }
 
 void ControlIndicatorTimer::slotTimeout() {
@@ -51,14 +80,14 @@ void ControlIndicatorTimer::setLegacyVsyncEnabled(bool enabled) {
     }
 
     if (enabled) {
-        m_timer.stop();
+        stopIndicatorTimer();
         m_pCPGuiTick50ms = std::make_unique<ControlProxy>(
                 ConfigKey(kAppGroup, QStringLiteral("gui_tick_50ms_period_s")));
         m_pCPGuiTick50ms->connectValueChanged(this, &ControlIndicatorTimer::slotGuiTick50ms);
     } else {
         m_pCPGuiTick50ms->disconnect(this);
         m_pCPGuiTick50ms.reset();
-        m_timer.start(250);
+        startIndicatorTimer();
     }
 }
 
@@ -6,6 +6,7 @@
 
 #include "control/controlobject.h"
 #include "control/controlproxy.h"
+#include "util/coalescingtimer.h"
 
 namespace mixxx {
 
@@ -25,7 +26,13 @@ class ControlIndicatorTimer : public QObject {
     void slotTimeout();
 
   private:
+    void startIndicatorTimer();
+    void stopIndicatorTimer();
+
+    /// Fallback when no CoalescingTimerService has been created
+    /// (e.g. in tests)
     QTimer m_timer;
+    CoalescingTimerService::ClientId m_timerServiceClientId;
     std::unique_ptr<ControlObject> m_pCOIndicator250millis;
     std::unique_ptr<ControlObject> m_pCOIndicator500millis;
 
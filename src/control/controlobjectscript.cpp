@@ -1,12 +1,15 @@
 #include "control/controlobjectscript.h"
 
+#include <bit>
+
 #include "moc_controlobjectscript.cpp"
 
 ControlObjectScript::ControlObjectScript(
         const ConfigKey& key, const RuntimeLoggingCategory& logger, QObject* pParent)
         : ControlProxy(key, pParent, ControlFlag::AllowMissingOrInvalid),
           m_logger(logger),
-          m_proxy(key, logger, this),
+          m_latestValueBits(0),
+          m_deliveryPending(0),
           m_skipSuperseded(false) {
 }
 
@@ -16,15 +19,15 @@ bool ControlObjectScript::addScriptConnection(const ScriptConnection& conn) {
         // by script connections.
         m_skipSuperseded = conn.skipSuperseded;
         if (conn.skipSuperseded) {
+            // The direct connection runs coalescedValueChanged() in the
+            // thread that changed the value. It only touches atomics and
+            // posts at most one queued delivery event, so a burst of changes
+            // (e.g. VU meter and position updates from the engine) does not
+            // flood the controller thread's event queue.
             connect(m_pControl.data(),
                     &ControlDoublePrivate::valueChanged,
-                    &m_proxy,
-                    &CompressingProxy::slotValueChanged,
-                    Qt::QueuedConnection);
-            connect(&m_proxy,
-                    &CompressingProxy::signalValueChanged,
                     this,
-                    &ControlObjectScript::slotValueChanged,
+                    &ControlObjectScript::coalescedValueChanged,
                     Qt::DirectConnection);
         } else {
             connect(m_pControl.data(),
@@ -41,7 +44,8 @@ bool ControlObjectScript::addScriptConnection(const ScriptConnection& conn) {
     } else {
         // At least one callback function is already connected to this CO
         if (conn.skipSuperseded == false && m_skipSuperseded == true) {
-            // Disconnect proxy if this is first callback function connected with skipSuperseded false
+            // Deliver every event if this is the first callback function
+            // connected with skipSuperseded false
             m_skipSuperseded = false;
             qCWarning(m_logger) << conn.key.group + ", " + conn.key.item +
                             "is connected to different callback functions with "
@@ -50,12 +54,8 @@ bool ControlObjectScript::addScriptConnection(const ScriptConnection& conn) {
                             "callback functions.";
             disconnect(m_pControl.data(),
                     &ControlDoublePrivate::valueChanged,
-                    &m_proxy,
-                    &CompressingProxy::slotValueChanged);
-            disconnect(&m_proxy,
-                    &CompressingProxy::signalValueChanged,
                     this,
-                    &ControlObjectScript::slotValueChanged);
+                    &ControlObjectScript::coalescedValueChanged);
             connect(m_pControl.data(),
                     &ControlDoublePrivate::valueChanged,
                     this,
@@ -97,12 +97,8 @@ bool ControlObjectScript::removeScriptConnection(const ScriptConnection& conn) {
         if (m_skipSuperseded) {
             disconnect(m_pControl.data(),
                     &ControlDoublePrivate::valueChanged,
-                    &m_proxy,
-                    &CompressingProxy::slotValueChanged);
-            disconnect(&m_proxy,
-                    &CompressingProxy::signalValueChanged,
                     this,
-                    &ControlObjectScript::slotValueChanged);
+                    &ControlObjectScript::coalescedValueChanged);
         } else {
             disconnect(m_pControl.data(),
                     &ControlDoublePrivate::valueChanged,
@@ -127,6 +123,27 @@ void ControlObjectScript::disconnectAllConnectionsToFunction(const QJSValue& fun
     }
 }
 
+void ControlObjectScript::coalescedValueChanged(double value) {
+    m_latestValueBits.storeRelease(std::bit_cast<qint64>(value));
+    if (m_deliveryPending.testAndSetOrdered(0, 1)) {
+        // No delivery pending yet, schedule one on the thread owning this
+        // object. All changes until that event runs just update the latest
+        // value above.
+        QMetaObject::invokeMethod(this,
+                &ControlObjectScript::deliverCoalescedValue,
+                Qt::QueuedConnection);
+    }
+}
+
+void ControlObjectScript::deliverCoalescedValue() {
+    // Clear the pending flag before loading the value: a change racing with
+    // the load below then schedules a new delivery instead of being lost.
+    // The worst case is one redundant delivery of an already seen value.
+    m_deliveryPending.storeRelease(0);
+    const double value = std::bit_cast<double>(m_latestValueBits.loadAcquire());
+    slotValueChanged(value, this);
+}
+
 void ControlObjectScript::slotValueChanged(double value, QObject*) {
     // Make a local copy of m_connectedScriptFunctions first.
     // This allows a script to disconnect a callback from inside the
@@ -1,8 +1,9 @@
 #pragma once
 
+#include <QAtomicInt>
+#include <QAtomicInteger>
 #include <QVector>
 
-#include "control/controlcompressingproxy.h"
 #include "control/controlproxy.h"
 #include "controllers/scripting/legacy/scriptconnection.h"
 #include "util/runtimeloggingcategory.h"
@@ -41,8 +42,21 @@ class ControlObjectScript : public ControlProxy {
     virtual void slotValueChanged(double v, QObject*);
 
   private:
+    // Connected with Qt::DirectConnection to the control's valueChanged
+    // signal for skipSuperseded connections, so it runs in the thread that
+    // changed the value. It stores the latest value and schedules at most one
+    // queued delivery to the controller thread: a burst of changes posts a
+    // single event instead of one per change, see deliverCoalescedValue().
+    void coalescedValueChanged(double value);
+    // Runs in the thread owning this object and delivers the latest value to
+    // the script connections.
+    void deliverCoalescedValue();
+
     QVector<ScriptConnection> m_scriptConnections;
     const RuntimeLoggingCategory m_logger;
-    CompressingProxy m_proxy;
+    // Latest value of the control as bit pattern and whether a queued
+    // delivery of it is already pending, see coalescedValueChanged().
+    QAtomicInteger<qint64> m_latestValueBits;
+    QAtomicInt m_deliveryPending;
     bool m_skipSuperseded; // This flag is combined for all connections of this Control Object
 };
@@ -108,7 +108,11 @@ class ControlValueAtomicBase {
             // 2) a delayed reader is still blocking the formerly current value
             // In both cases writing to the next value will fix it.
         } while (!m_ring[index].trySet(value));
-        m_readIndex = index;
+        // The ordering of the stored value itself is already guaranteed
+        // by the acquire/release pair in ControlRingValue, so publishing
+        // the new read position does not require the full fence of the
+        // default sequentially consistent store.
+        m_readIndex.store(index, std::memory_order_release);
     }
 
   protected:
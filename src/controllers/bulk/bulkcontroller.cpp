@@ -13,6 +13,14 @@
 #include "util/time.h"
 #include "util/trace.h"
 
+namespace {
+// Matches the non-skipping HID output FIFO; a full queue means the device
+// stopped accepting data anyway.
+constexpr size_t kSizeOfFifoInMessages = 32;
+// Send timeout in milliseconds
+constexpr unsigned int kSendTimeoutMs = 5000;
+} // namespace
+
 BulkReader::BulkReader(libusb_device_handle *handle, unsigned char in_epaddr)
         : QThread(),
           m_phandle(handle),
@@ -57,6 +65,73 @@ void BulkReader::run() {
     qDebug() << "Stopped Reader";
 }
 
+BulkWriter::BulkWriter(libusb_device_handle* handle,
+        unsigned char out_epaddr,
+        const RuntimeLoggingCategory& logOutput,
+        const QString& deviceName)
+        : QThread(),
+          m_phandle(handle),
+          m_stop(0),
+          m_out_epaddr(out_epaddr),
+          m_logOutput(logOutput),
+          m_deviceName(deviceName),
+          m_fifoQueue(kSizeOfFifoInMessages) {
+}
+
+BulkWriter::~BulkWriter() {
+}
+
+void BulkWriter::stop() {
+    m_stop = 1;
+    // Wake the writer so it can flush the remaining messages and exit.
+    m_messagesAvailable.release();
+}
+
+bool BulkWriter::send(const QByteArray& data) {
+    if (!m_fifoQueue.try_emplace(data)) {
+        // Dropping the message is preferable to blocking the controller
+        // mapping thread until the (probably stalled) device catches up.
+        qCWarning(m_logOutput) << "FIFO overflow: Unable to queue message for"
+                               << m_deviceName;
+        return false;
+    }
+    m_messagesAvailable.release();
+    return true;
+}
+
+void BulkWriter::run() {
+    while (m_stop.loadAcquire() == 0) {
+        m_messagesAvailable.acquire();
+        // Send the whole backlog back-to-back: a burst of LED/screen
+        // messages is flushed in one go while the mapping thread keeps
+        // running. Permits left over from messages taken in the same
+        // drain only cause an empty iteration.
+        sendQueued();
+    }
+    // Flush the parting messages the mapping sent while shutting down.
+    sendQueued();
+    qDebug() << "Stopped Writer";
+}
+
+void BulkWriter::sendQueued() {
+    while (QByteArray* pData = m_fifoQueue.front()) {
+        int transferred;
+        const int ret = libusb_bulk_transfer(m_phandle,
+                m_out_epaddr,
+                (unsigned char*)pData->constData(),
+                pData->size(),
+                &transferred,
+                kSendTimeoutMs);
+        if (ret < 0) {
+            qCWarning(m_logOutput) << "Unable to send data to" << m_deviceName
+                                   << "-" << libusb_error_name(ret);
+        } else if (CmdlineArgs::Instance().getControllerDebug()) {
+            qCDebug(m_logOutput) << transferred << "bytes sent to" << m_deviceName;
+        }
+        m_fifoQueue.pop();
+    }
+}
+
 #ifndef Q_OS_ANDROID
 static QString get_string(libusb_device_handle* handle, uint8_t id) {
     unsigned char buf[128] = { 0 };
@@ -78,7 +153,8 @@ BulkController::BulkController(libusb_context* context,
           m_phandle(handle),
           m_inEndpointAddr(0),
           m_outEndpointAddr(0),
-          m_pReader(nullptr) {
+          m_pReader(nullptr),
+          m_pWriter(nullptr) {
     m_vendorId = desc->idVendor;
     m_productId = desc->idProduct;
 
@@ -99,7 +175,8 @@ BulkController::BulkController(const QJniObject& usbDevice)
           m_androidUsbDevice(usbDevice),
           m_inEndpointAddr(0),
           m_outEndpointAddr(0),
-          m_pReader(nullptr) {
+          m_pReader(nullptr),
+          m_pWriter(nullptr) {
     m_vendorId = static_cast<unsigned short>(usbDevice.callMethod<jint>("getVendorId"));
     m_productId = static_cast<unsigned short>(usbDevice.callMethod<jint>("getProductId"));
 
@@ -323,6 +400,20 @@ int BulkController::open(const QString& resourcePath) {
         // audio directly, like when scratching
         m_pReader->start(QThread::HighPriority);
     }
+
+    if (m_pWriter != nullptr) {
+        qCWarning(m_logBase) << "BulkWriter already present for" << getName();
+    } else if (m_pMapping &&
+            !(m_pMapping->getDeviceDirection() &
+                    LegacyControllerMapping::DeviceDirection::Outgoing)) {
+        qDebug() << "The mapping for the bulk device" << getName()
+                 << "doesn't require sending data. Ignoring BulkWriter "
+                    "setup.";
+    } else {
+        m_pWriter = new BulkWriter(m_phandle, m_outEndpointAddr, m_logOutput, getName());
+        m_pWriter->setObjectName(QString("BulkWriter %1").arg(getName()));
+        m_pWriter->start();
+    }
     applyMapping(resourcePath);
     setOpen(true);
     return 0;
@@ -355,6 +446,16 @@ int BulkController::close() {
     // closed in case it has any final parting messages
     stopEngine();
 
+    // Stop the writer after the engine so the parting messages the mapping
+    // sent on shutdown are still flushed to the device
+    if (m_pWriter) {
+        m_pWriter->stop();
+        qCInfo(m_logBase) << "  Waiting on writer to finish";
+        m_pWriter->wait();
+        delete m_pWriter;
+        m_pWriter = nullptr;
+    }
+
     // Close device
     if (m_interfaceNumber.has_value()) {
         int error = libusb_release_interface(m_phandle, *m_interfaceNumber);
@@ -395,24 +496,13 @@ bool BulkController::sendBytes(const QByteArray& data) {
         return false;
     }
 
-    int ret;
-    int transferred;
-
-    // XXX: don't get drunk again.
-    ret = libusb_bulk_transfer(m_phandle,
-            m_outEndpointAddr,
-            (unsigned char*)data.constData(),
-            data.size(),
-            &transferred,
-            5000 // Send timeout in milliseconds
-    );
-    if (ret < 0) {
-        qCWarning(m_logOutput) << "Unable to send data to" << getName()
-                               << "serial #" << m_sUID << "-" << libusb_error_name(ret);
+    VERIFY_OR_DEBUG_ASSERT(m_pWriter) {
+        qCWarning(m_logOutput) << "No writer present for" << getName()
+                               << "- dropping outgoing message";
         return false;
-    } else if (CmdlineArgs::Instance().getControllerDebug()) {
-        qCDebug(m_logOutput) << transferred << "bytes sent to" << getName()
-                             << "serial #" << m_sUID;
     }
-    return true;
+
+    // The transfer itself happens on the writer thread; a burst of
+    // outgoing messages must not stall the controller mapping thread.
+    return m_pWriter->send(data);
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QAtomicInt>
+#include <QSemaphore>
 #include <QThread>
 #include <optional>
 #ifdef Q_OS_ANDROID
@@ -9,6 +10,8 @@
 
 #include "controllers/controller.h"
 #include "controllers/hid/legacyhidcontrollermapping.h"
+#include "rigtorp/SPSCQueue.h"
+#include "util/runtimeloggingcategory.h"
 
 struct libusb_device_handle;
 struct libusb_context;
@@ -34,6 +37,48 @@ class BulkReader : public QThread {
     unsigned char m_in_epaddr;
 };
 
+/// Sends outgoing messages to a USB Bulk device from a dedicated thread.
+///
+/// sendBytes() used to issue a blocking libusb_bulk_transfer on the
+/// controller mapping thread, so a burst of LED or screen messages stalled
+/// that thread and delayed the processing of incoming jog events. The
+/// writer decouples this: the mapping thread enqueues into a lockless FIFO
+/// and the writer drains the whole backlog back-to-back per wakeup.
+class BulkWriter : public QThread {
+    Q_OBJECT
+  public:
+    BulkWriter(libusb_device_handle* handle,
+            unsigned char out_epaddr,
+            const RuntimeLoggingCategory& logOutput,
+            const QString& deviceName);
+    ~BulkWriter() override;
+
+    /// Requests the thread to flush the remaining messages and exit.
+    void stop();
+
+    /// Called from the controller mapping thread. Enqueues the message and
+    /// wakes the writer without blocking on the USB transfer. Returns
+    /// false if the queue is full, in which case the message is dropped to
+    /// keep the mapping thread responsive.
+    bool send(const QByteArray& data);
+
+  protected:
+    void run() override;
+
+  private:
+    void sendQueued();
+
+    libusb_device_handle* m_phandle;
+    QAtomicInt m_stop;
+    unsigned char m_out_epaddr;
+    const RuntimeLoggingCategory m_logOutput;
+    const QString m_deviceName;
+    // Lockless FIFO queue, written by the controller mapping thread and
+    // drained by the writer thread.
+    rigtorp::SPSCQueue<QByteArray> m_fifoQueue;
+    QSemaphore m_messagesAvailable;
+};
+
 class BulkController : public Controller {
     Q_OBJECT
   public:
@@ -126,5 +171,6 @@ class BulkController : public Controller {
 
     QString m_sUID;
     BulkReader* m_pReader;
+    BulkWriter* m_pWriter;
     std::unique_ptr<LegacyHidControllerMapping> m_pMapping;
 };
@@ -13,7 +13,9 @@
 #include "util/cmdlineargs.h"
 #include "util/compatibility/qmutex.h"
 #include "util/duration.h"
+#include "util/event.h"
 #include "util/thread_affinity.h"
+#include "util/threadcpumonitor.h"
 #include "util/time.h"
 
 #ifdef __PORTMIDI__
@@ -45,6 +47,12 @@ const mixxx::Duration ControllerManager::kPollInterval = mixxx::Duration::fromMi
 #endif
 
 namespace {
+
+// Shortened poll interval used while a polled controller is actively
+// sending data, so that each message of a burst (e.g. a turning jog
+// wheel) is passed on with minimal delay; see slotPollDevices().
+const mixxx::Duration kBurstPollInterval = mixxx::Duration::fromMillis(1);
+
 /// Strip slashes and spaces from device name, so that it can be used as config
 /// key or a filename.
 QString sanitizeDeviceName(QString name) {
@@ -109,6 +117,10 @@ ControllerManager::ControllerManager(UserSettingsPointer pConfig)
     }
 
     m_pollTimer.setInterval(kPollInterval.toIntegerMillis());
+    // The default coarse timer may defer a timeout by up to 5% of the
+    // interval to coalesce wakeups; controller input latency matters, so
+    // request the exact interval.
+    m_pollTimer.setTimerType(Qt::PreciseTimer);
     connect(&m_pollTimer, &QTimer::timeout, this, &ControllerManager::slotPollDevices);
 
     m_pThread = new QThread;
@@ -146,6 +158,7 @@ ControllerLearningEventFilter* ControllerManager::getControllerLearningEventFilt
 
 void ControllerManager::slotInitialize() {
     qDebug() << "ControllerManager:slotInitialize";
+    ThreadCpuMonitor::tagCurrentThread(QStringLiteral("controllers"));
 
     // Initialize mapping info parsers. This object is only for use in the main
     // thread. Do not touch it from within ControllerManager.
@@ -245,6 +258,8 @@ QString ControllerManager::getConfiguredMappingFileForDevice(const QString& name
 
 void ControllerManager::slotSetUpDevices() {
     qDebug() << "ControllerManager: Setting up devices";
+    const QString eventTag = QStringLiteral("ControllerManager::slotSetUpDevices");
+    Event::start(eventTag);
 
     updateControllerList();
     const QList<Controller*> deviceList = getControllerList(false, true);
@@ -307,6 +322,7 @@ void ControllerManager::slotSetUpDevices() {
     }
 
     pollIfAnyControllersOpen();
+    Event::end(eventTag);
 }
 
 void ControllerManager::pollIfAnyControllersOpen() {
@@ -369,9 +385,10 @@ void ControllerManager::slotPollDevices() {
     }
 
     mixxx::Duration start = mixxx::Time::elapsed();
+    bool receivedData = false;
     for (Controller* pDevice : std::as_const(m_controllers)) {
         if (pDevice->isOpen() && pDevice->isPolling()) {
-            pDevice->poll();
+            receivedData |= pDevice->poll();
         }
     }
 
@@ -379,6 +396,19 @@ void ControllerManager::slotPollDevices() {
     if (duration > kPollInterval) {
         m_skipPoll = true;
     }
+
+    // Adaptive burst polling: while a device is actively sending data,
+    // shorten the poll interval so that the following messages of the
+    // burst are handed to the mapping with minimal delay. As soon as a
+    // poll comes back empty (or we are in an overload situation) the
+    // timer falls back to the regular interval, which keeps the idle
+    // wakeup rate unchanged.
+    const int desiredIntervalMillis = (receivedData && !m_skipPoll)
+            ? kBurstPollInterval.toIntegerMillis()
+            : kPollInterval.toIntegerMillis();
+    if (m_pollTimer.interval() != desiredIntervalMillis) {
+        m_pollTimer.setInterval(desiredIntervalMillis);
+    }
     //qDebug() << "ControllerManager::pollDevices()" << duration << start;
 }
 
@@ -11,6 +11,7 @@
 #include "mixer/playermanager.h"
 #include "moc_controlpickermenu.cpp"
 #include "recording/defs_recording.h"
+#include "util/assert.h"
 #include "util/defs.h"
 #include "vinylcontrol/defs_vinylcontrol.h"
 
@@ -19,7 +20,27 @@ const QString kAppGroup = QStringLiteral("[App]");
 } // namespace
 
 ControlPickerMenu::ControlPickerMenu(QWidget* pParent)
-        : QMenu(pParent) {
+        : QMenu(pParent),
+          m_populated(false) {
+    // Building the menu creates thousands of translated strings and actions,
+    // so it is deferred until the menu is actually shown or one of the
+    // control lookups is called. The preferences dialog creates one instance
+    // per controller at startup, most of which are never opened.
+    connect(this, &QMenu::aboutToShow, this, [this] {
+        ensurePopulated();
+    });
+}
+
+void ControlPickerMenu::ensurePopulated() const {
+    if (!m_populated) {
+        const_cast<ControlPickerMenu*>(this)->populate();
+    }
+}
+
+void ControlPickerMenu::populate() {
+    DEBUG_ASSERT(!m_populated);
+    m_populated = true;
+
     m_effectMainOutputStr = tr("Main Output");
     m_effectHeadphoneOutputStr = tr("Headphone Output");
     m_deckStr = tr("Deck %1");
@@ -2040,13 +2061,16 @@ int ControlPickerMenu::addAvailableControl(const ConfigKey& key,
 }
 
 bool ControlPickerMenu::controlExists(const ConfigKey& key) const {
+    ensurePopulated();
     return m_titlesByKey.contains(key);
 }
 
 QString ControlPickerMenu::descriptionForConfigKey(const ConfigKey& key) const {
+    ensurePopulated();
     return m_descriptionsByKey.value(key, QString());
 }
 
 QString ControlPickerMenu::controlTitleForConfigKey(const ConfigKey& key) const {
+    ensurePopulated();
     return m_titlesByKey.value(key, QString());
 }
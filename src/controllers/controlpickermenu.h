@@ -12,6 +12,7 @@ class ControlPickerMenu : public QMenu {
     virtual ~ControlPickerMenu();
 
     const QList<ConfigKey>& controlsAvailable() const {
+        ensurePopulated();
         return m_controlsAvailable;
     }
 
@@ -21,9 +22,11 @@ class ControlPickerMenu : public QMenu {
 
     // share translated group strings
     QMap<QString, QString> getNumGroupsTrMap() const {
+        ensurePopulated();
         return m_numGroupsTrMap;
     }
     QMap<QString, QString> getOtherGroupsTrMap() const {
+        ensurePopulated();
         return m_otherGroupsTrMap;
     }
 
@@ -36,6 +39,11 @@ class ControlPickerMenu : public QMenu {
     void controlChosen(int controlIndex);
 
   private:
+    // Building the menu is expensive, so it only happens on first use. All
+    // public accessors and the aboutToShow signal trigger the population.
+    void ensurePopulated() const;
+    void populate();
+
     QMenu* addSubmenu(QString title, QMenu* pParent = NULL);
     void addSingleControl(const QString& group,
             const QString& control,
@@ -140,4 +148,6 @@ class ControlPickerMenu : public QMenu {
 
     QMap<QString, QString> m_numGroupsTrMap;
     QMap<QString, QString> m_otherGroupsTrMap;
+
+    bool m_populated;
 };
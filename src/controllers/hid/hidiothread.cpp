@@ -9,6 +9,7 @@
 #include <hidapi.h>
 #endif
 #include "moc_hidiothread.cpp"
+#include "util/performancetimer.h"
 #include "util/runtimeloggingcategory.h"
 #include "util/string.h"
 #include "util/time.h"
@@ -27,6 +28,17 @@ constexpr size_t kMaxHidErrorMessageSize = 512;
 // the fastest possible rate of HID devices with USB HighSpeed or USB SuperSpeed interface is 8kHz
 constexpr int kSleepTimeWhenIdleMicros = 250;
 
+// Adaptive back-off of the run loop: when neither an InputReport was received
+// nor an OutputReport was sent for this long, the sleep time is raised to the
+// backed-off value below, reducing the wakeup rate per idle device from ~4kHz
+// to ~250Hz. No InputReports are lost while backed off, since hid_read() pulls
+// them from the hidapi/kernel ring buffer (see pollBufferedInputReports), the
+// first report after an idle phase is just processed up to the backed-off
+// sleep time later. The first wheel tick of a scratch is not latency critical,
+// all subsequent ones are processed at full rate again.
+constexpr mixxx::Duration kPollBackOffThreshold = mixxx::Duration::fromMillis(200);
+constexpr int kSleepTimeWhenBackedOffMicros = 4000;
+
 QString loggingCategoryPrefix(const QString& deviceName) {
     return QStringLiteral("controller.") +
             RuntimeLoggingCategory::removeInvalidCharsFromCategory(deviceName.toLower());
@@ -72,17 +84,23 @@ HidIoThread::~HidIoThread() {
 void HidIoThread::run() {
     const QSemaphoreReleaser releaser(m_runLoopSemaphore);
     m_runLoopSemaphore.acquire();
+    PerformanceTimer idleTimer;
+    idleTimer.start();
     while (!testAndSetThreadState(HidIoThreadState::StopRequested, HidIoThreadState::Stopped)) {
         // Ensure that all InputReports are read from the ring buffer, before the next OutputReport blocks the IO again
         // Polling available Input-Reports is a cheap software only operation, which takes insignificiant time
-        pollBufferedInputReports();
+        if (pollBufferedInputReports()) {
+            idleTimer.start();
+        }
 
         // Send one OutputReport, if at least one is cached
         // Sending an OutputReport is time consuming, because HIDAPI waits
         // for the backend/kernel for confirmation of success
         // Depending on the OS this takes several several milli seconds
         // This operation doesn't take many CPU cycles, most time HIDAPI is in idle state
-        if (!sendNextCachedOutputReport()) {
+        if (sendNextCachedOutputReport()) {
+            idleTimer.start();
+        } else {
             if (testAndSetThreadState(HidIoThreadState::StopWhenAllReportsSent,
                         HidIoThreadState::Stopped)) {
                 break;
@@ -90,14 +108,21 @@ void HidIoThread::run() {
             // Sleep run loop, if no OutputReport was send
             // Tests on Windows and Linux showed that the thread schedulers
             // handle usleep wait times reliable under CPU load
-            usleep(kSleepTimeWhenIdleMicros);
+            // Poll at full rate while the device is active and back off
+            // after an idle phase, see kPollBackOffThreshold.
+            if (idleTimer.elapsed() < kPollBackOffThreshold) {
+                usleep(kSleepTimeWhenIdleMicros);
+            } else {
+                usleep(kSleepTimeWhenBackedOffMicros);
+            }
         }
     }
 }
 
-void HidIoThread::pollBufferedInputReports() {
+bool HidIoThread::pollBufferedInputReports() {
     Trace hidRead("HidIoThread pollBufferedInputReports");
     auto hidDeviceLock = lockMutex(&m_hidDeviceAndPollMutex);
+    bool reportsRead = false;
     // This function reads the available HID Input Reports using hidapi.
     // Important to know is, that this reading is not a hardware operation,
     // instead it reads previously received HID Input Reports from a ring buffer.
@@ -136,8 +161,10 @@ void HidIoThread::pollBufferedInputReports() {
                 break;
             }
         }
+        reportsRead = true;
         processInputReport(bytesRead);
     }
+    return reportsRead;
 }
 
 void HidIoThread::processInputReport(int bytesRead) {
@@ -67,7 +67,9 @@ class HidIoThread : public QThread {
   private:
     bool sendNextCachedOutputReport();
 
-    void pollBufferedInputReports();
+    /// Drains all buffered InputReports from the hidapi/kernel ring buffer.
+    /// Returns true if at least one report was read.
+    bool pollBufferedInputReports();
     void processInputReport(int bytesRead);
 
     const mixxx::hid::DeviceInfo m_deviceInfo;
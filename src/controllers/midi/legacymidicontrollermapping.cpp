@@ -2,6 +2,13 @@
 
 #include "controllers/midi/legacymidicontrollermappingfilehandler.h"
 
+namespace {
+
+// One slot per possible MidiKey, i.e. (status, control) packed into 16 bits.
+constexpr std::size_t kInputDispatchTableSize = 0x10000;
+
+} // anonymous namespace
+
 bool LegacyMidiControllerMapping::saveMapping(const QString& fileName) const {
     LegacyMidiControllerMappingFileHandler handler;
     return handler.save(*this, fileName);
@@ -13,6 +20,7 @@ bool LegacyMidiControllerMapping::isMappable() const {
 
 void LegacyMidiControllerMapping::addInputMapping(uint16_t key, const MidiInputMapping& mapping) {
     m_inputMappings.insert(key, mapping);
+    m_inputDispatchTableDirty = true;
     if (!std::holds_alternative<std::shared_ptr<QJSValue>>(mapping.control)) {
         // Note: JS handler are not saved to the XML file
         setDirty(true);
@@ -27,11 +35,13 @@ void LegacyMidiControllerMapping::removeInputMapping(uint16_t key) {
         }
     }
     m_inputMappings.remove(key);
+    m_inputDispatchTableDirty = true;
 }
 
 bool LegacyMidiControllerMapping::removeInputMapping(
         uint16_t key, const MidiInputMapping& mapping) {
     auto result = m_inputMappings.remove(key, mapping);
+    m_inputDispatchTableDirty = true;
     setDirty(true);
     return result > 0;
 }
@@ -46,10 +56,29 @@ void LegacyMidiControllerMapping::setInputMappings(
     if (m_inputMappings != mappings) {
         m_inputMappings.clear();
         m_inputMappings.unite(mappings);
+        m_inputDispatchTableDirty = true;
         setDirty(true);
     }
 }
 
+const std::vector<MidiInputMapping>& LegacyMidiControllerMapping::dispatchInputMappings(
+        uint16_t key) const {
+    if (m_inputDispatchTableDirty) {
+        m_inputDispatchTable.clear();
+        m_inputDispatchTable.resize(kInputDispatchTableSize);
+        // Values sharing a key are stored adjacently by QMultiHash, in the
+        // same order that equal_range() would visit them, so appending
+        // during a plain iteration preserves the dispatch order.
+        for (auto it = m_inputMappings.constBegin();
+                it != m_inputMappings.constEnd();
+                ++it) {
+            m_inputDispatchTable[it.key()].push_back(it.value());
+        }
+        m_inputDispatchTableDirty = false;
+    }
+    return m_inputDispatchTable[key];
+}
+
 void LegacyMidiControllerMapping::addOutputMapping(
         const ConfigKey& key, const MidiOutputMapping& mapping) {
     m_outputMappings.insert(key, mapping);
@@ -75,6 +104,7 @@ void LegacyMidiControllerMapping::setOutputMappings(
     }
 }
 void LegacyMidiControllerMapping::removeInputHandlerMappings() {
+    m_inputDispatchTableDirty = true;
 #if QT_VERSION >= QT_VERSION_CHECK(6, 1, 0)
     m_inputMappings.removeIf(
             [](std::pair<const uint16_t&, MidiInputMapping&> it) {
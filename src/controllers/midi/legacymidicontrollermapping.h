@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QMultiHash>
+#include <vector>
 
 #include "controllers/legacycontrollermapping.h"
 #include "controllers/midi/midimessage.h"
@@ -24,6 +25,13 @@ class LegacyMidiControllerMapping final : public LegacyControllerMapping {
     const QMultiHash<uint16_t, MidiInputMapping>& getInputMappings() const;
     void setInputMappings(const QMultiHash<uint16_t, MidiInputMapping>& mappings);
 
+    /// Returns the input mappings bound to the given (status, control) key
+    /// via a flat table indexed directly by the 16-bit key. The table is
+    /// (re-)built lazily on the first lookup after a mutation, so only
+    /// mappings that actually receive messages pay for it. The returned
+    /// reference is valid until the next mutation of the input mappings.
+    const std::vector<MidiInputMapping>& dispatchInputMappings(uint16_t key) const;
+
     // Output mappings
     void addOutputMapping(const ConfigKey& key, const MidiOutputMapping& mapping);
     void removeOutputMapping(const ConfigKey& key);
@@ -34,4 +42,10 @@ class LegacyMidiControllerMapping final : public LegacyControllerMapping {
     // MIDI input and output mappings.
     QMultiHash<uint16_t, MidiInputMapping> m_inputMappings;
     QMultiHash<ConfigKey, MidiOutputMapping> m_outputMappings;
+
+    // Flat dispatch table covering the whole 16-bit MidiKey space, see
+    // dispatchInputMappings(). Mutable because it is a lazily built cache
+    // of m_inputMappings.
+    mutable std::vector<std::vector<MidiInputMapping>> m_inputDispatchTable;
+    mutable bool m_inputDispatchTableDirty = true;
 };
@@ -33,7 +33,48 @@ bool MidiInputHandleJSProxy::disconnect() {
 }
 
 MidiController::MidiController(const QString& deviceName)
-        : Controller(deviceName) {
+        : Controller(deviceName),
+          m_shortMsgFlushScheduled(false) {
+}
+
+void MidiController::enqueueShortMsg(unsigned char status,
+        unsigned char control,
+        unsigned char value) {
+    const uint16_t key = MidiKey(status, control).key;
+    const auto it = m_queuedShortMsgIndex.constFind(key);
+    if (it != m_queuedShortMsgIndex.constEnd()) {
+        // A message for this (status, control) pair is already queued but not
+        // yet sent, so the old value is superseded by the new one.
+        m_queuedShortMsgs[it.value()].value = value;
+    } else {
+        m_queuedShortMsgIndex.insert(key, m_queuedShortMsgs.size());
+        m_queuedShortMsgs.append(QueuedShortMessage{status, control, value});
+    }
+    if (!m_shortMsgFlushScheduled) {
+        m_shortMsgFlushScheduled = true;
+        // The flush event is queued behind the control change events that are
+        // already pending on the controller thread, so a burst of changes is
+        // coalesced into a single batch.
+        QMetaObject::invokeMethod(this,
+                &MidiController::flushQueuedShortMsgs,
+                Qt::QueuedConnection);
+    }
+}
+
+void MidiController::flushQueuedShortMsgs() {
+    m_shortMsgFlushScheduled = false;
+    if (m_queuedShortMsgs.isEmpty()) {
+        return;
+    }
+    sendShortMsgs(m_queuedShortMsgs);
+    m_queuedShortMsgs.clear();
+    m_queuedShortMsgIndex.clear();
+}
+
+void MidiController::sendShortMsgs(const QList<QueuedShortMessage>& messages) {
+    for (const QueuedShortMessage& msg : messages) {
+        sendShortMsg(msg.status, msg.control, msg.value);
+    }
 }
 
 void MidiController::slotBeforeEngineShutdown() {
@@ -92,6 +133,9 @@ QList<LegacyControllerMapping::ScreenInfo> MidiController::getMappingInfoScreens
 
 int MidiController::close() {
     destroyOutputHandlers();
+    // Drop feedback that was queued for the closed device.
+    m_queuedShortMsgs.clear();
+    m_queuedShortMsgIndex.clear();
     return 0;
 }
 
@@ -311,11 +355,9 @@ void MidiController::receivedShortMessage(unsigned char status,
         }
     }
 
-    for (auto [it, end] =
-                    m_pMapping->getInputMappings().equal_range(mappingKey.key);
-            it != end;
-            ++it) {
-        processInputMapping(it.value(), status, control, value, timestamp);
+    for (const MidiInputMapping& mapping :
+            m_pMapping->dispatchInputMappings(mappingKey.key)) {
+        processInputMapping(mapping, status, control, value, timestamp);
     }
 }
 
@@ -483,8 +525,8 @@ void MidiController::processInputMapping(const MidiInputMapping& mapping,
         if (!pControlPotmeter) {
             return;
         }
-        m_st.enable(gsl::not_null(pControlPotmeter));
-        if (m_st.ignore(pCO, pCO->getParameterForMidi(newValue))) {
+        if (m_st.enableAndIgnore(gsl::not_null(pControlPotmeter),
+                    pCO->getParameterForMidi(newValue))) {
             return;
         }
     }
@@ -615,12 +657,10 @@ void MidiController::receive(const QByteArray& data, mixxx::Duration timestamp)
         }
     }
 
-    for (auto [it, end] =
-                    m_pMapping->getInputMappings().equal_range(mappingKey.key);
-            it != end;
-            ++it) {
-        processInputMapping(it.value(), data, timestamp);
-    };
+    for (const MidiInputMapping& mapping :
+            m_pMapping->dispatchInputMappings(mappingKey.key)) {
+        processInputMapping(mapping, data, timestamp);
+    }
 }
 
 void MidiController::processInputMapping(const MidiInputMapping& mapping,
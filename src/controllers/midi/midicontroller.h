@@ -70,6 +70,28 @@ class MidiController : public Controller {
             unsigned char byte1,
             unsigned char byte2) = 0;
 
+    /// An output feedback message queued by enqueueShortMsg().
+    struct QueuedShortMessage {
+        unsigned char status;
+        unsigned char control;
+        unsigned char value;
+    };
+
+    /// Queue an output feedback message for batched sending. Messages are
+    /// coalesced per (status, control) pair - a queued value that is
+    /// superseded before the flush is never sent - and the whole queue is
+    /// flushed in a single batch once the controller thread has drained the
+    /// control change events already queued ahead of the flush. This bounds
+    /// the backend calls under burst load (e.g. jog wheel LED rings) to one
+    /// batch per event loop round trip.
+    void enqueueShortMsg(unsigned char status,
+            unsigned char control,
+            unsigned char value);
+
+    /// Send a batch of queued feedback messages. The default implementation
+    /// sends them one by one; backends with a batch write API override this.
+    virtual void sendShortMsgs(const QList<QueuedShortMessage>& messages);
+
     /// Alias for send()
     /// The length parameter is here for backwards compatibility for when scripts
     /// were required to specify it.
@@ -113,11 +135,18 @@ class MidiController : public Controller {
             mixxx::Duration timestamp);
 
     double computeValue(MidiOptions options, double _prevmidivalue, double _newmidivalue);
+    void flushQueuedShortMsgs();
     void createOutputHandlers();
     void updateAllOutputs();
     void destroyOutputHandlers();
 
     QHash<uint16_t, MidiInputMapping> m_temporaryInputMappings;
+    // Feedback messages queued by enqueueShortMsg() in first-queued order,
+    // an index into that list for coalescing superseded values, and whether
+    // a flush event is already queued on the controller thread.
+    QList<QueuedShortMessage> m_queuedShortMsgs;
+    QHash<uint16_t, int> m_queuedShortMsgIndex;
+    bool m_shortMsgFlushScheduled;
     QList<MidiOutputHandler*> m_outputs;
     std::unique_ptr<LegacyMidiControllerMapping> m_pMapping;
     SoftTakeoverCtrl m_st;
@@ -47,11 +47,15 @@ void MidiOutputHandler::controlChanged(double value) {
     if (!m_pController->isOpen()) {
         qCWarning(m_logger) << "MIDI device" << m_pController->getName() << "not open for output!";
     } else if (byte3 != 0xFF) {
-        qCDebug(m_logger) << "sending MIDI bytes:" << m_mapping.output.status
+        qCDebug(m_logger) << "queuing MIDI bytes:" << m_mapping.output.status
                           << "," << m_mapping.output.control << ","
                           << byte3;
-        m_pController->sendShortMsg(m_mapping.output.status,
-                                    m_mapping.output.control, byte3);
+        // Queued for coalesced, batched sending instead of sent directly:
+        // bursts of control changes (e.g. VU meters, jog wheel LED rings)
+        // result in a single batch write to the backend with only the latest
+        // value per message, see MidiController::enqueueShortMsg().
+        m_pController->enqueueShortMsg(m_mapping.output.status,
+                m_mapping.output.control, byte3);
         m_lastVal = static_cast<int>(byte3);
     }
 }
@@ -1,5 +1,7 @@
 #include "controllers/midi/portmidicontroller.h"
 
+#include <QVarLengthArray>
+
 #include "controllers/midi/midiutils.h"
 #include "moc_portmidicontroller.cpp"
 
@@ -222,6 +224,30 @@ void PortMidiController::sendShortMsg(unsigned char status, unsigned char byte1,
     }
 }
 
+void PortMidiController::sendShortMsgs(const QList<QueuedShortMessage>& messages) {
+    if (m_pOutputDevice.isNull() || !m_pOutputDevice->isOpen()) {
+        return;
+    }
+
+    QVarLengthArray<PmEvent, 64> events(messages.size());
+    for (int i = 0; i < messages.size(); ++i) {
+        const QueuedShortMessage& msg = messages.at(i);
+        events[i].message = (((unsigned int)msg.value) << 16) |
+                (((unsigned int)msg.control) << 8) | msg.status;
+        events[i].timestamp = 0;
+    }
+
+    PmError err = m_pOutputDevice->write(events.data(), events.size());
+    if (err == pmNoError) {
+        qCDebug(m_logOutput) << "outgoing batch of" << events.size()
+                             << "short messages";
+    } else {
+        qCWarning(m_logOutput) << "Error sending batch of" << events.size()
+                               << "short messages";
+        qCWarning(m_logOutput) << "PortMidi error:" << Pm_GetErrorText(err);
+    }
+}
+
 bool PortMidiController::sendBytes(const QByteArray& data) {
     // PortMidi does not receive a length argument for the buffer we provide to
     // Pm_WriteSysEx. Instead, it scans for a MidiOpCode::EndOfExclusive byte
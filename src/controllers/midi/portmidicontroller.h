@@ -93,6 +93,10 @@ class PortMidiController : public MidiController {
     void sendShortMsg(unsigned char status, unsigned char byte1,
                       unsigned char byte2) override;
 
+    // Submits a whole batch of coalesced feedback messages with a single
+    // Pm_Write() call instead of one Pm_WriteShort() per message.
+    void sendShortMsgs(const QList<QueuedShortMessage>& messages) override;
+
   private:
     int open(const QString& resourcePath) override;
     int close() override;
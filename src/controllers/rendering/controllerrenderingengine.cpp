@@ -3,8 +3,10 @@
 #include <QGuiApplication>
 #include <QOffscreenSurface>
 #include <QOpenGLContext>
+#include <QOpenGLExtraFunctions>
 #include <QOpenGLFramebufferObject>
 #include <QOpenGLFunctions>
+#include <cstring>
 #include <QQmlEngine>
 #include <QQuickGraphicsDevice>
 #include <QQuickRenderControl>
@@ -32,6 +34,12 @@
 
 namespace {
 const mixxx::Logger kLogger("ControllerRenderingEngine");
+
+// A frame whose content is identical to the previously transmitted one is
+// normally not transformed and sent again. It is retransmitted at this
+// interval anyway, so devices which blank their screen without receiving
+// periodic data keep displaying the last frame.
+constexpr auto kUnchangedFrameResendInterval = std::chrono::seconds(1);
 } // anonymous namespace
 
 using Clock = std::chrono::steady_clock;
@@ -220,6 +228,17 @@ void ControllerRenderingEngine::setup(std::shared_ptr<QQmlEngine> qmlEngine) {
 
     m_renderControl = std::make_unique<QQuickRenderControl>(this);
     m_renderControl->setSamples(format.samples());
+    // The render control tells us when the scene actually needs to be synced
+    // or re-rendered. While neither signal fires the scene is static and
+    // renderFrame() skips the render and readback entirely.
+    connect(m_renderControl.get(),
+            &QQuickRenderControl::sceneChanged,
+            this,
+            [this] { m_sceneDirty = true; });
+    connect(m_renderControl.get(),
+            &QQuickRenderControl::renderRequested,
+            this,
+            [this] { m_sceneDirty = true; });
     m_quickWindow = std::make_unique<QQuickWindow>(m_renderControl.get());
 
     if (!qmlEngine->incubationController()) {
@@ -252,7 +271,17 @@ void ControllerRenderingEngine::finish() {
         m_quickWindow.reset();
 
         // Free the engine and FBO.
+#ifndef QT_OPENGL_ES_2
+        if (m_pbos[0]) {
+            m_context->extraFunctions()->glDeleteBuffers(2, m_pbos);
+            m_pbos[0] = 0;
+            m_pbos[1] = 0;
+            m_pboFramePending[0] = false;
+            m_pboFramePending[1] = false;
+        }
+#endif
         m_fbo.reset();
+        m_lastTransmittedFrame = QImage();
 
         m_context->doneCurrent();
     }
@@ -286,6 +315,35 @@ void ControllerRenderingEngine::renderFrame() {
         VERIFY_OR_TERMINATE(glError == GL_NO_ERROR, "GLError: " << glError);
         VERIFY_OR_TERMINATE(m_fbo->isValid(), "Failed to initialize FBO");
 
+#ifndef QT_OPENGL_ES_2
+        // Pixel pack buffers require OpenGL 3.0. On older contexts m_pbos
+        // stays zero and the synchronous glReadPixels() path is used.
+        if (m_context->format().majorVersion() >= 3) {
+            const qsizetype frameBytes =
+                    QImage(m_screenInfo.size, m_screenInfo.pixelFormat)
+                            .sizeInBytes();
+            QOpenGLExtraFunctions* glf = m_context->extraFunctions();
+            glf->glGenBuffers(2, m_pbos);
+            for (GLuint pbo : m_pbos) {
+                glf->glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo);
+                glf->glBufferData(GL_PIXEL_PACK_BUFFER,
+                        frameBytes,
+                        nullptr,
+                        GL_STREAM_READ);
+            }
+            glf->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+            glError = m_context->functions()->glGetError();
+            if (glError != GL_NO_ERROR) {
+                kLogger.warning() << "Failed to allocate readback PBOs"
+                                  << "(GLError:" << glError
+                                  << "), falling back to synchronous readback";
+                glf->glDeleteBuffers(2, m_pbos);
+                m_pbos[0] = 0;
+                m_pbos[1] = 0;
+            }
+        }
+#endif
+
         m_quickWindow->setGraphicsDevice(QQuickGraphicsDevice::fromOpenGLContext(m_context.get()));
 
         VERIFY_OR_TERMINATE(m_renderControl->initialize(),
@@ -301,6 +359,34 @@ void ControllerRenderingEngine::renderFrame() {
 
     m_nextFrameStart = Clock::now();
 
+    if (!m_sceneDirty) {
+#ifndef QT_OPENGL_ES_2
+        if (m_pboFramePending[0] || m_pboFramePending[1]) {
+            // The scene went static, but the last rendered frame is still in
+            // flight in a PBO. Hand it off without rendering a new one.
+            drainPendingReadback();
+            return;
+        }
+#endif
+        if (!m_lastTransmittedFrame.isNull()) {
+            if (m_nextFrameStart - m_lastTransmittedFrameTime <
+                    kUnchangedFrameResendInterval) {
+                // Nothing in the scene changed since the last render: skip
+                // polish, sync, render and readback altogether.
+                scheduleNextFrame();
+            } else {
+                // Retransmit the cached frame so devices which blank their
+                // screen without receiving periodic data keep displaying it.
+                m_lastTransmittedFrameTime = m_nextFrameStart;
+                emit frameRendered(m_screenInfo,
+                        m_lastTransmittedFrame,
+                        QDateTime::currentDateTime());
+            }
+            return;
+        }
+        // No frame has been produced yet, fall through and render one.
+    }
+
     if (m_pEngineThreadControl) {
         if (!m_pEngineThreadControl->pause()) {
             kLogger.debug() << "Couldn't pause the GUI thread. Rescheduling frame rendering";
@@ -309,6 +395,10 @@ void ControllerRenderingEngine::renderFrame() {
         }
     }
 
+    // Cleared before polishing so that any change signaled while this frame
+    // is produced marks the scene dirty again for the next one.
+    m_sceneDirty = false;
+
     m_renderControl->polishItems();
 
     m_renderControl->beginFrame();
@@ -364,6 +454,52 @@ void ControllerRenderingEngine::renderFrame() {
     while ((glError = m_context->functions()->glGetError()) != GL_NO_ERROR) {
         kLogger.debug() << "Retrieved a previously unhandled GL error: " << glError;
     }
+#ifndef QT_OPENGL_ES_2
+    bool frameMapped = true;
+    if (m_pbos[0]) {
+        // Asynchronous double-buffered readback: queue the transfer of the
+        // frame just rendered into one PBO and map the other one, which holds
+        // the frame rendered one cycle earlier and whose transfer has long
+        // completed. The pipeline never stalls waiting for pixels, at the
+        // cost of one frame of latency on the device screen.
+        QOpenGLExtraFunctions* glf = m_context->extraFunctions();
+        glf->glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pbos[m_pboWriteIndex]);
+        {
+            ScopedTimer t(QStringLiteral(
+                    "ControllerRenderingEngine::renderFrame::glReadPixels"));
+            glf->glReadPixels(0,
+                    0,
+                    m_screenInfo.size.width(),
+                    m_screenInfo.size.height(),
+                    m_GLDataFormat,
+                    m_GLDataType,
+                    nullptr);
+        }
+        m_pboTimestamps[m_pboWriteIndex] = timestamp;
+        m_pboFramePending[m_pboWriteIndex] = true;
+
+        const int readIndex = 1 - m_pboWriteIndex;
+        frameMapped = false;
+        if (m_pboFramePending[readIndex]) {
+            glf->glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pbos[readIndex]);
+            const void* pData = glf->glMapBufferRange(GL_PIXEL_PACK_BUFFER,
+                    0,
+                    fboImage.sizeInBytes(),
+                    GL_MAP_READ_BIT);
+            if (pData) {
+                std::memcpy(fboImage.bits(), pData, fboImage.sizeInBytes());
+                glf->glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+                timestamp = m_pboTimestamps[readIndex];
+                frameMapped = true;
+            } else {
+                kLogger.warning() << "Couldn't map the readback PBO, dropping frame.";
+            }
+            m_pboFramePending[readIndex] = false;
+        }
+        glf->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        m_pboWriteIndex = readIndex;
+    } else
+#endif
     {
         ScopedTimer t(QStringLiteral("ControllerRenderingEngine::renderFrame::glReadPixels"));
         m_context->functions()->glReadPixels(0,
@@ -390,6 +526,51 @@ void ControllerRenderingEngine::renderFrame() {
 
     m_context->doneCurrent();
 
+#ifndef QT_OPENGL_ES_2
+    if (!frameMapped) {
+        // The very first frame only primes the readback pipeline; there is
+        // nothing to transmit yet.
+        scheduleNextFrame();
+        return;
+    }
+#endif
+
+    transformAndTransmitFrame(std::move(fboImage), timestamp);
+}
+
+#ifndef QT_OPENGL_ES_2
+void ControllerRenderingEngine::drainPendingReadback() {
+    const int readIndex = m_pboFramePending[0] ? 0 : 1;
+    DEBUG_ASSERT(m_pboFramePending[readIndex]);
+    VERIFY_OR_TERMINATE(m_context->makeCurrent(m_offscreenSurface.get()),
+            "Couldn't make the GLContext current to the OffscreenSurface.");
+
+    QImage fboImage(m_screenInfo.size, m_screenInfo.pixelFormat);
+    QOpenGLExtraFunctions* glf = m_context->extraFunctions();
+    glf->glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pbos[readIndex]);
+    const void* pData = glf->glMapBufferRange(GL_PIXEL_PACK_BUFFER,
+            0,
+            fboImage.sizeInBytes(),
+            GL_MAP_READ_BIT);
+    m_pboFramePending[readIndex] = false;
+    if (pData) {
+        std::memcpy(fboImage.bits(), pData, fboImage.sizeInBytes());
+        glf->glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    glf->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    m_context->doneCurrent();
+
+    VERIFY_OR_DEBUG_ASSERT(pData) {
+        kLogger.warning() << "Couldn't map the readback PBO, dropping frame.";
+        scheduleNextFrame();
+        return;
+    }
+    transformAndTransmitFrame(std::move(fboImage), m_pboTimestamps[readIndex]);
+}
+#endif
+
+void ControllerRenderingEngine::transformAndTransmitFrame(
+        QImage fboImage, const QDateTime& timestamp) {
 #ifdef QT_OPENGL_ES_2
     fboImage.convertTo(m_screenInfo.pixelFormat);
 
@@ -442,7 +623,20 @@ void ControllerRenderingEngine::renderFrame() {
     fboImage.mirror(false, true);
 #endif
 
-    emit frameRendered(m_screenInfo, fboImage.copy(), timestamp);
+    // Static scenes (e.g. an idle screen or a paused deck) render the exact
+    // same frame over and over. Skip the JS transform and USB transmission for
+    // those frames and only reschedule the next render, sparing the script
+    // engine and the device bandwidth.
+    auto frameTime = Clock::now();
+    if (fboImage == m_lastTransmittedFrame &&
+            frameTime - m_lastTransmittedFrameTime < kUnchangedFrameResendInterval) {
+        scheduleNextFrame();
+        return;
+    }
+    m_lastTransmittedFrame = fboImage.copy();
+    m_lastTransmittedFrameTime = frameTime;
+
+    emit frameRendered(m_screenInfo, m_lastTransmittedFrame, timestamp);
 }
 
 bool ControllerRenderingEngine::stop() {
@@ -468,6 +662,10 @@ void ControllerRenderingEngine::send(Controller* controller, const QByteArray& f
                 << "milliseconds and frame has" << frame.size() << "bytes";
     }
 
+    scheduleNextFrame();
+}
+
+void ControllerRenderingEngine::scheduleNextFrame() {
     m_nextFrameStart += std::chrono::microseconds(1000000 / m_screenInfo.target_fps);
 
     auto durationToWaitBeforeFrame =
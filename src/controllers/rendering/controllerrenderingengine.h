@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QDateTime>
 #include <QObject>
 #include <QOpenGLContext>
 #include <QOpenGLFramebufferObject>
@@ -83,6 +84,18 @@ class ControllerRenderingEngine : public QObject {
 
   private:
     virtual void prepare();
+    // Advances m_nextFrameStart by one frame period and schedules the next
+    // renderFrame() call, immediately if the deadline has already passed.
+    void scheduleNextFrame();
+#ifndef QT_OPENGL_ES_2
+    // Maps the frame still pending in a PBO and hands it off for
+    // transmission without rendering a new one. Called when the scene went
+    // static while the readback pipeline was not empty yet.
+    void drainPendingReadback();
+#endif
+    // Converts the read back frame into the device format, deduplicates
+    // unchanged frames and emits frameRendered().
+    void transformAndTransmitFrame(QImage fboImage, const QDateTime& timestamp);
 
     std::chrono::time_point<std::chrono::steady_clock> m_nextFrameStart;
 
@@ -97,6 +110,31 @@ class ControllerRenderingEngine : public QObject {
 
     std::unique_ptr<QOpenGLFramebufferObject> m_fbo;
 
+#ifndef QT_OPENGL_ES_2
+    // Pixel pack buffers for asynchronous readback, used in a ping-pong
+    // scheme: the frame just rendered is read into one buffer without
+    // stalling while the previous frame is mapped from the other one and
+    // handed off for USB transmission. Adds one frame of latency on the
+    // device screen. Zero when PBOs are unavailable (GL < 3.0), in which
+    // case the synchronous glReadPixels() path is used.
+    GLuint m_pbos[2] = {0, 0};
+    int m_pboWriteIndex = 0;
+    // Render timestamps of the frames pending in m_pbos.
+    QDateTime m_pboTimestamps[2];
+    bool m_pboFramePending[2] = {false, false};
+#endif
+
+    // Set by the QQuickRenderControl signals whenever the scene needs to be
+    // polished/synced or re-rendered. While it stays false the scene is
+    // static and renderFrame() skips the whole render and readback.
+    bool m_sceneDirty = true;
+
+    // Copy of the last frame that was handed off for transformation and
+    // transmission, used by renderFrame() to detect frames whose content
+    // didn't change. Only accessed from the rendering thread.
+    QImage m_lastTransmittedFrame;
+    std::chrono::time_point<std::chrono::steady_clock> m_lastTransmittedFrameTime;
+
     GLenum m_GLDataFormat;
     GLenum m_GLDataType;
 
@@ -1,5 +1,6 @@
 #include "controllers/scripting/controllerscriptenginebase.h"
 
+#include <QDir>
 #include <QJSEngine>
 
 #include "controllers/controller.h"
@@ -15,6 +16,32 @@
 #endif
 #include "util/cmdlineargs.h"
 
+namespace {
+
+// Point the QML/JS engine's on-disk bytecode cache at a directory inside the
+// Mixxx settings path before the first script engine is created. QV4 then
+// persists compiled units for ES modules (importModule) and controller screen
+// QML and revalidates them against the source checksum and Qt version, so
+// reconnecting a controller or restarting Mixxx skips the parse/compile of
+// unchanged files. Without this the cache lands in the generic OS cache
+// location, which cleanup tools routinely wipe. An explicit
+// QML_DISK_CACHE_PATH set by the user is left untouched.
+void ensureScriptBytecodeCachePath() {
+    static const bool s_done = [] {
+        if (!qEnvironmentVariableIsSet("QML_DISK_CACHE_PATH")) {
+            const QString cachePath =
+                    QDir(CmdlineArgs::Instance().getSettingsPath())
+                            .absoluteFilePath(QStringLiteral("script_cache"));
+            QDir().mkpath(cachePath);
+            qputenv("QML_DISK_CACHE_PATH", cachePath.toLocal8Bit());
+        }
+        return true;
+    }();
+    Q_UNUSED(s_done);
+}
+
+} // anonymous namespace
+
 ControllerScriptEngineBase::ControllerScriptEngineBase(
         Controller* controller, const RuntimeLoggingCategory& logger)
         : m_bDisplayingExceptionDialog(false),
@@ -55,6 +82,8 @@ bool ControllerScriptEngineBase::initialize() {
 
     m_bAbortOnWarning = CmdlineArgs::Instance().getControllerAbortOnWarning();
 
+    ensureScriptBytecodeCachePath();
+
     // Create the Script Engine
 #ifdef MIXXX_USE_QML
     if (!m_bQmlMode) {
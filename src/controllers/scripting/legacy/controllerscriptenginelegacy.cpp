@@ -26,9 +26,27 @@
 using Clock = std::chrono::steady_clock;
 #endif
 
+namespace {
+// Grace period for collecting a burst of file change notifications
+// before the script engine is rebuilt once.
+constexpr int kReloadDebounceMillis = 100;
+} // namespace
+
 ControllerScriptEngineLegacy::ControllerScriptEngineLegacy(
         Controller* controller, const RuntimeLoggingCategory& logger)
         : ControllerScriptEngineBase(controller, logger) {
+    // Editors typically write several watched files back-to-back (or the
+    // same file twice, see below). Rebuilding the engine once per
+    // notification multiplies the reload latency, so changes are collected
+    // for a short moment and applied in a single reload. The reload then
+    // runs in one event loop turn on this thread, i.e. between processing
+    // of incoming controller messages.
+    m_reloadDebounceTimer.setSingleShot(true);
+    m_reloadDebounceTimer.setInterval(kReloadDebounceMillis);
+    connect(&m_reloadDebounceTimer,
+            &QTimer::timeout,
+            this,
+            &ControllerScriptEngineLegacy::reload);
     connect(&m_fileWatcher,
             &QFileSystemWatcher::fileChanged,
             this,
@@ -38,14 +56,14 @@ ControllerScriptEngineLegacy::ControllerScriptEngineLegacy(
                 // in a row as part of the normal saving process. See note in
                 // QFileSystemWatcher::fileChanged documentation.
                 if (m_fileWatcher.removePath(changedFile)) {
-                    reload();
+                    m_reloadDebounceTimer.start();
                 }
             });
 #ifdef MIXXX_USE_QML
     connect(&m_fileWatcher,
             &QFileSystemWatcher::directoryChanged,
-            this,
-            &ControllerScriptEngineLegacy::reload);
+            &m_reloadDebounceTimer,
+            qOverload<>(&QTimer::start));
 #endif
 }
 
@@ -4,6 +4,7 @@
 #include <QJSEngine>
 #include <QJSValue>
 #include <QMessageBox>
+#include <QTimer>
 #include <memory>
 #ifdef MIXXX_USE_QML
 #include <QMetaMethod>
@@ -132,6 +133,9 @@ class ControllerScriptEngineLegacy : public ControllerScriptEngineBase {
     QHash<QString, QJSValue> m_settings;
 
     QFileSystemWatcher m_fileWatcher;
+    // Coalesces bursts of file change notifications (e.g. an editor saving
+    // several mapping files at once) into a single engine reload.
+    QTimer m_reloadDebounceTimer;
 
     // There is lots of tight coupling between ControllerScriptEngineLegacy
     // and ControllerScriptInterface. This is probably not worth improving in legacy code.
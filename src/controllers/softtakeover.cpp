@@ -12,6 +12,15 @@ void SoftTakeoverCtrl::enable(gsl::not_null<ControlPotmeter*> pControl) {
     m_softTakeoverHash.try_emplace(static_cast<ControlObject*>(pControl.get()));
 }
 
+bool SoftTakeoverCtrl::enableAndIgnore(
+        gsl::not_null<ControlPotmeter*> pControl, double newParameter) {
+    // explicitly not in the header to avoid adding dependency on ControlPotmeter
+    auto [it, inserted] = m_softTakeoverHash.try_emplace(
+            static_cast<ControlObject*>(pControl.get()));
+    auto& [coKey, refSoftTakeover] = *it;
+    return refSoftTakeover.ignore(*coKey, newParameter);
+}
+
 bool SoftTakeover::willIgnore(const ControlObject& control,
         double newParameter,
         ClockT::time_point currentTime) const {
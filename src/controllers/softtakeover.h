@@ -66,6 +66,12 @@ class SoftTakeoverCtrl {
     // Enable soft-takeover for the given Control.
     // This does nothing on a control that already has soft-takeover enabled.
     void enable(gsl::not_null<ControlPotmeter*> pControl);
+    // Enable soft-takeover for the given Control if it isn't already and
+    // check whether the new value should be ignored, with a single hash
+    // lookup. This is the per-message fast path for MIDI input, where
+    // dense CC streams (e.g. 14-bit fader rides) hit the same control
+    // thousands of times per second.
+    bool enableAndIgnore(gsl::not_null<ControlPotmeter*> pControl, double newParameter);
     // Disable soft-takeover for the given Control
     void disable(ControlObject* control) {
         m_softTakeoverHash.erase(control);
@@ -2,9 +2,12 @@
 
 #include <QApplication>
 #include <QFileDialog>
+#include <QFuture>
 #include <QProcess>
 #include <QProcessEnvironment>
 #include <QStandardPaths>
+#include <QThread>
+#include <QtConcurrentRun>
 #include <QtGlobal>
 #include <gsl/pointers>
 
@@ -53,15 +56,21 @@
 #include "soundio/soundmanager.h"
 #include "sources/soundsourceproxy.h"
 #include "util/clipboard.h"
+#include "util/coalescingtimer.h"
 #include "util/db/dbconnectionpooled.h"
+#include "util/db/dbconnectionpooler.h"
+#include "util/event.h"
 #include "util/font.h"
 #include "util/logger.h"
+#include "util/rtlogger.h"
 #include "util/screensavermanager.h"
 #include "util/statsmanager.h"
+#include "util/threadcpumonitor.h"
 #include "util/time.h"
 #include "util/translations.h"
 #include "util/versionstore.h"
 #include "vinylcontrol/vinylcontrolmanager.h"
+#include "waveform/waveformmemorymanager.h"
 
 #ifdef __APPLE__
 #include "util/sandbox.h"
@@ -373,6 +382,12 @@ CoreServices::CoreServices(const CmdlineArgs& args, QApplication* pApp)
     if (m_cmdlineArgs.getDeveloper()) {
         StatsManager::createInstance();
     }
+    // Always on, so engine-thread code can report anomalies from the audio
+    // callback without touching the locking logging path.
+    RtLogger::createInstance();
+    // Continuous per-subsystem CPU accounting, also in production use.
+    ThreadCpuMonitor::createInstance();
+    ThreadCpuMonitor::tagCurrentThread(QStringLiteral("main"));
     mixxx::Translations::initializeTranslations(
             m_pSettingsManager->settings(), pApp, m_cmdlineArgs.getLocale());
     initializeKeyboard();
@@ -391,6 +406,8 @@ CoreServices::~CoreServices() {
     if (m_cmdlineArgs.getDeveloper()) {
         StatsManager::destroy();
     }
+    RtLogger::destroy();
+    ThreadCpuMonitor::destroy();
 
     // HACK: Save config again. We saved it once before doing some dangerous
     // stuff. We only really want to save it here, but the first one was just
@@ -500,9 +517,22 @@ void CoreServices::initialize(QApplication* pApp) {
     }
     // Create a connection for the main thread
     m_pDbConnectionPool->createThreadLocalConnection();
-    if (!initializeDatabase()) {
-        exit(-1);
-    }
+
+    // Initializing or upgrading the database schema is disk I/O that no
+    // component before the library depends on. Run it on a worker thread
+    // with its own pooled connection so the audio path (effects, engine,
+    // sound hardware, decks) comes up concurrently; the result is joined
+    // below right before the first database consumer is created.
+    QFuture<DatabaseInitResult> databaseInitResult =
+            QtConcurrent::run([this]() {
+                const mixxx::DbConnectionPooler dbConnectionPooler(
+                        m_pDbConnectionPool);
+                return initializeDatabase();
+            });
+
+    // Created before any periodic GUI-thread client so that indicator
+    // timers, clock widgets etc. share one coalesced wakeup source.
+    CoalescingTimerService::createInstance();
 
     m_pControlIndicatorTimer = std::make_shared<mixxx::ControlIndicatorTimer>(this);
 
@@ -543,6 +573,14 @@ void CoreServices::initialize(QApplication* pApp) {
 
     emit initializationProgressUpdate(40, tr("decks"));
     // Create the player manager. (long)
+    // Note: Player construction cannot be deferred until after the main
+    // window is shown. LegacySkinParser creates placeholder ControlObjects
+    // for any control a skin references that does not exist yet, and
+    // ControlDoublePrivate::getControl() rejects a second creator for an
+    // existing key, so every player group a skin references must be fully
+    // constructed before the skin is parsed. Skins already grow the player
+    // count on demand via the [App],num_decks / num_samplers manifest
+    // attributes, so only the baseline counts are created here.
     m_pPlayerManager = std::make_shared<PlayerManager>(
             pConfig,
             m_pSoundManager.get(),
@@ -590,6 +628,36 @@ void CoreServices::initialize(QApplication* pApp) {
     emit initializationProgressUpdate(50, tr("library"));
     CoverArtCache::createInstance();
     Clipboard::createInstance();
+    // Must exist before the players start loading tracks.
+    WaveformMemoryManager::createInstance(pConfig);
+
+    // Join the concurrent schema initialization before the first
+    // database consumer is created. Blocking in result() right away would
+    // freeze the launch image for the whole duration of a major schema
+    // upgrade; pump the event loop instead so the queued migration
+    // progress updates reach the launch image while waiting.
+    while (!databaseInitResult.isFinished()) {
+        QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
+        QThread::msleep(10);
+    }
+    switch (databaseInitResult.result()) {
+    case DatabaseInitResult::Ok:
+        break;
+    case DatabaseInitResult::ConnectionFailed:
+        QMessageBox::critical(nullptr,
+                tr("Cannot open database"),
+                tr("Unable to establish a database connection.\n"
+                   "Mixxx requires QT with SQLite support. Please read "
+                   "the Qt SQL driver documentation for information on how "
+                   "to build it.\n\n"
+                   "Click OK to exit."),
+                QMessageBox::Ok);
+        exit(-1);
+        break;
+    case DatabaseInitResult::SchemaFailed:
+        exit(-1);
+        break;
+    }
 
     m_pTrackCollectionManager = std::make_shared<TrackCollectionManager>(
             this,
@@ -872,23 +940,41 @@ void CoreServices::slotOptionsKeyboard(bool toggle) {
     }
 }
 
-bool CoreServices::initializeDatabase() {
+CoreServices::DatabaseInitResult CoreServices::initializeDatabase() {
+    // Runs on a worker thread with its own pooled connection, so no
+    // GUI interaction is allowed here. The caller reports failures.
+    const QString eventTag = QStringLiteral("CoreServices::initializeDatabase");
+    Event::start(eventTag);
+    DatabaseInitResult result = DatabaseInitResult::Ok;
     kLogger.info() << "Connecting to database";
     QSqlDatabase dbConnection = mixxx::DbConnectionPooled(m_pDbConnectionPool);
     if (!dbConnection.isOpen()) {
-        QMessageBox::critical(nullptr,
-                tr("Cannot open database"),
-                tr("Unable to establish a database connection.\n"
-                   "Mixxx requires QT with SQLite support. Please read "
-                   "the Qt SQL driver documentation for information on how "
-                   "to build it.\n\n"
-                   "Click OK to exit."),
-                QMessageBox::Ok);
-        return false;
+        result = DatabaseInitResult::ConnectionFailed;
+    } else {
+        kLogger.info() << "Initializing or upgrading database schema";
+        // Major schema migrations can take minutes on large libraries.
+        // Forward their progress to the launch image; the emission is
+        // queued to the GUI thread, which pumps events while waiting for
+        // this worker to finish. The constant 50 matches the "library"
+        // stage at which the result is joined.
+        const auto progressCallback = [this](int nextVersion,
+                                              int targetVersion,
+                                              const QString& description) {
+            Q_UNUSED(description);
+            emit initializationProgressUpdate(50,
+                    tr("database schema upgrade to version %1 of %2")
+                            .arg(QString::number(nextVersion),
+                                    QString::number(targetVersion)));
+        };
+        if (!MixxxDb::initDatabaseSchema(dbConnection,
+                    MixxxDb::kRequiredSchemaVersion,
+                    MixxxDb::kDefaultSchemaFile,
+                    progressCallback)) {
+            result = DatabaseInitResult::SchemaFailed;
+        }
     }
-
-    kLogger.info() << "Initializing or upgrading database schema";
-    return MixxxDb::initDatabaseSchema(dbConnection);
+    Event::end(eventTag);
+    return result;
 }
 
 std::shared_ptr<QDialog> CoreServices::makeDlgPreferences() const {
@@ -968,6 +1054,10 @@ void CoreServices::finalize() {
     qDebug() << t.elapsed(false).debugMillisWithUnit() << "deleting PlayerManager";
     CLEAR_AND_CHECK_DELETED(m_pPlayerManager);
 
+    // Destroyed after the PlayerManager since the players unregister their
+    // tracks from it. Only holds weak references to tracks.
+    WaveformMemoryManager::destroy();
+
     // Delete the library after the view so there are no dangling pointers to
     // the data models.
     // Depends on RecordingManager and PlayerManager
@@ -1017,6 +1107,8 @@ void CoreServices::finalize() {
 
     m_pControlIndicatorTimer.reset();
 
+    CoalescingTimerService::destroyInstance();
+
     t.elapsed(true);
 }
 
@@ -117,7 +117,12 @@ class CoreServices : public QObject {
     void slotOptionsKeyboard(bool toggle);
 
   private:
-    bool initializeDatabase();
+    enum class DatabaseInitResult {
+        Ok,
+        ConnectionFailed,
+        SchemaFailed,
+    };
+    DatabaseInitResult initializeDatabase();
     void initializeKeyboard();
     void initializeSettings();
     void initializeScreensaverManager();
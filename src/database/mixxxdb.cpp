@@ -12,7 +12,7 @@
 const QString MixxxDb::kDefaultSchemaFile(":/schema.xml");
 
 //static
-const int MixxxDb::kRequiredSchemaVersion = 39;
+const int MixxxDb::kRequiredSchemaVersion = 41;
 
 namespace {
 
@@ -30,6 +30,20 @@ const QString kUserName = QStringLiteral("mixxx");
 
 const QString kPassword = QStringLiteral("mixxx");
 
+const QString kConfigGroup = QStringLiteral("[Database]");
+
+// WAL allows readers (search, cover lookup, analysis fetch) to proceed
+// while another connection is writing, e.g. during a library scan. In the
+// default rollback-journal mode a writer blocks all readers for the
+// duration of its transaction.
+const QString kDefaultJournalMode = QStringLiteral("WAL");
+
+// Let SQLite serve reads of the hot part of the database file directly
+// from the page cache of the OS instead of issuing read() syscalls.
+constexpr int kDefaultMmapSizeKb = 256 * 1024; // 256 MiB
+
+constexpr int kDefaultCacheSizeKb = 20 * 1024; // 20 MiB
+
 // The connection parameters for the main Mixxx DB
 mixxx::DbConnection::Params dbConnectionParams(
         const UserSettingsPointer& pConfig,
@@ -58,6 +72,19 @@ mixxx::DbConnection::Params dbConnectionParams(
     }
     params.userName = kUserName;
     params.password = kPassword;
+    // In-memory databases (tests) always use journal mode "memory",
+    // requesting WAL for them would be a no-op.
+    if (!inMemoryConnection) {
+        params.sqliteJournalMode = pConfig->getValue(
+                ConfigKey(kConfigGroup, QStringLiteral("journal_mode")),
+                kDefaultJournalMode);
+    }
+    params.sqliteMmapSizeKb = pConfig->getValue(
+            ConfigKey(kConfigGroup, QStringLiteral("mmap_size_kb")),
+            kDefaultMmapSizeKb);
+    params.sqliteCacheSizeKb = pConfig->getValue(
+            ConfigKey(kConfigGroup, QStringLiteral("cache_size_kb")),
+            kDefaultCacheSizeKb);
     return params;
 }
 
@@ -72,7 +99,8 @@ MixxxDb::MixxxDb(
 bool MixxxDb::initDatabaseSchema(
         const QSqlDatabase& database,
         int schemaVersion,
-        const QString& schemaFile) {
+        const QString& schemaFile,
+        const SchemaManager::MigrationProgressCallback& progressCallback) {
     QString okToExit = tr("Click OK to exit.");
     QString upgradeFailed = tr("Cannot upgrade database schema");
     QString upgradeToVersionFailed =
@@ -81,7 +109,8 @@ bool MixxxDb::initDatabaseSchema(
     QString helpContact = tr("For help with database issues consult:") + "\n" +
             "https://www.mixxx.org/support";
 
-    switch (SchemaManager(database).upgradeToSchemaVersion(schemaVersion, schemaFile)) {
+    switch (SchemaManager(database).upgradeToSchemaVersion(
+            schemaVersion, schemaFile, progressCallback)) {
     case SchemaManager::Result::CurrentVersion:
     case SchemaManager::Result::UpgradeSucceeded:
     case SchemaManager::Result::NewerVersionBackwardsCompatible:
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "database/schemamanager.h"
 #include "preferences/usersettings.h"
 #include "util/db/dbconnectionpool.h"
 
@@ -16,7 +17,8 @@ class MixxxDb : public QObject {
     static bool initDatabaseSchema(
             const QSqlDatabase& database,
             int schemaVersion = kRequiredSchemaVersion,
-            const QString& schemaFile = kDefaultSchemaFile);
+            const QString& schemaFile = kDefaultSchemaFile,
+            const SchemaManager::MigrationProgressCallback& progressCallback = {});
 
     explicit MixxxDb(
             const UserSettingsPointer& pConfig,
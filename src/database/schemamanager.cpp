@@ -91,7 +91,8 @@ int SchemaManager::readMinBackwardsCompatibleVersion() const {
 
 SchemaManager::Result SchemaManager::upgradeToSchemaVersion(
         int targetVersion,
-        const QString& schemaFilename) {
+        const QString& schemaFilename,
+        const MigrationProgressCallback& progressCallback) {
     auto currentVersion = readCurrentVersion();
     VERIFY_OR_DEBUG_ASSERT(currentVersion >= INITIAL_VERSION) {
         return Result::UpgradeFailed;
@@ -223,6 +224,10 @@ SchemaManager::Result SchemaManager::upgradeToSchemaVersion(
                 << nextVersion << ":"
                 << description.trimmed();
 
+        if (progressCallback) {
+            progressCallback(nextVersion, targetVersion, description.trimmed());
+        }
+
         SqlTransaction transaction(m_settingsDao.database());
 
         // TODO(XXX) We can't have semicolons in schema.xml for anything other
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 #include "library/dao/settingsdao.h"
 
 class QSqlDatabase;
@@ -21,6 +23,14 @@ class SchemaManager {
         SchemaError
     };
 
+    /// Invoked before each schema migration is applied. Major migrations
+    /// may take minutes on large libraries, so callers can use this to
+    /// report progress instead of appearing hung.
+    using MigrationProgressCallback = std::function<void(
+            int nextVersion,
+            int targetVersion,
+            const QString& description)>;
+
     explicit SchemaManager(const QSqlDatabase& database);
 
     int readCurrentVersion() const;
@@ -30,7 +40,12 @@ class SchemaManager {
     /// Tries to update the database schema to targetVersion.
     /// Pending changes are rolled back upon failure.
     /// No-op if the versions are incompatible or the targetVersion is older.
-    Result upgradeToSchemaVersion(int targetVersion, const QString& schemaFilename);
+    /// Each migration is applied and committed separately, so an
+    /// interrupted upgrade resumes with the next migration on relaunch.
+    Result upgradeToSchemaVersion(
+            int targetVersion,
+            const QString& schemaFilename,
+            const MigrationProgressCallback& progressCallback = {});
 
   private:
     const SettingsDAO m_settingsDao;
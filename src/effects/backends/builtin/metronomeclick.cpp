@@ -1,4384 +1,90 @@
 #include "effects/backends/builtin/metronomeclick.h"
+
+#include <array>
+#include <cstddef>
+
+#include "util/math.h"
+
 namespace {
-// This is a new recording from a real metronome
-// it was converted from *.wav to plain text using Audacity
 
-constexpr CSAMPLE kClick44100[] = {
-        0.03459f,
-        0.09436f,
-        0.13646f,
-        0.13397f,
-        0.12769f,
-        0.16707f,
-        0.23479f,
-        0.27845f,
-        0.26258f,
-        0.15676f,
-        -0.04469f,
-        -0.25386f,
-        -0.34708f,
-        -0.32814f,
-        -0.32287f,
-        -0.38761f,
-        -0.44187f,
-        -0.41100f,
-        -0.30597f,
-        -0.15478f,
-        0.01382f,
-        0.12843f,
-        0.14796f,
-        0.13350f,
-        0.14399f,
-        0.12870f,
-        0.00836f,
-        -0.20222f,
-        -0.40190f,
-        -0.49408f,
-        -0.45249f,
-        -0.32491f,
-        -0.17703f,
-        -0.04102f,
-        0.07596f,
-        0.16295f,
-        0.22100f,
-        0.27411f,
-        0.31737f,
-        0.30172f,
-        0.22581f,
-        0.17353f,
-        0.20625f,
-        0.29894f,
-        0.39225f,
-        0.43471f,
-        0.39620f,
-        0.30707f,
-        0.24406f,
-        0.25017f,
-        0.28685f,
-        0.26838f,
-        0.16888f,
-        0.07771f,
-        0.07703f,
-        0.12917f,
-        0.16924f,
-        0.18038f,
-        0.12173f,
-        -0.03985f,
-        -0.22585f,
-        -0.33717f,
-        -0.38322f,
-        -0.42069f,
-        -0.47394f,
-        -0.54568f,
-        -0.60043f,
-        -0.56950f,
-        -0.43692f,
-        -0.25673f,
-        -0.07543f,
-        0.09491f,
-        0.23567f,
-        0.31195f,
-        0.30476f,
-        0.22808f,
-        0.11839f,
-        0.02167f,
-        -0.02317f,
-        -0.02049f,
-        -0.02039f,
-        -0.05451f,
-        -0.09535f,
-        -0.09242f,
-        -0.02332f,
-        0.07294f,
-        0.10909f,
-        0.03442f,
-        -0.10286f,
-        -0.20934f,
-        -0.22986f,
-        -0.16333f,
-        -0.05486f,
-        0.02456f,
-        0.04289f,
-        0.04285f,
-        0.08445f,
-        0.17320f,
-        0.25566f,
-        0.26299f,
-        0.17014f,
-        0.03790f,
-        -0.03072f,
-        -0.00689f,
-        0.03881f,
-        0.04679f,
-        0.02877f,
-        0.00884f,
-        0.00138f,
-        0.03024f,
-        0.07291f,
-        0.05081f,
-        -0.04617f,
-        -0.12579f,
-        -0.12098f,
-        -0.04814f,
-        0.04824f,
-        0.12493f,
-        0.15746f,
-        0.17621f,
-        0.22541f,
-        0.28672f,
-        0.30292f,
-        0.24742f,
-        0.13678f,
-        0.01260f,
-        -0.08157f,
-        -0.13262f,
-        -0.16340f,
-        -0.19945f,
-        -0.23970f,
-        -0.25591f,
-        -0.21998f,
-        -0.14390f,
-        -0.07781f,
-        -0.05757f,
-        -0.06808f,
-        -0.06935f,
-        -0.04456f,
-        -0.01490f,
-        -0.01461f,
-        -0.05266f,
-        -0.09777f,
-        -0.10582f,
-        -0.07299f,
-        -0.04444f,
-        -0.05213f,
-        -0.07615f,
-        -0.08385f,
-        -0.06168f,
-        -0.00244f,
-        0.07425f,
-        0.11139f,
-        0.09062f,
-        0.06733f,
-        0.08443f,
-        0.12020f,
-        0.14020f,
-        0.12856f,
-        0.07336f,
-        -0.01188f,
-        -0.07367f,
-        -0.07511f,
-        -0.03639f,
-        0.00539f,
-        0.04250f,
-        0.08281f,
-        0.12148f,
-        0.14662f,
-        0.14958f,
-        0.12349f,
-        0.06494f,
-        -0.02257f,
-        -0.12207f,
-        -0.19914f,
-        -0.23050f,
-        -0.23629f,
-        -0.24047f,
-        -0.22049f,
-        -0.15182f,
-        -0.05974f,
-        0.01923f,
-        0.07074f,
-        0.08392f,
-        0.05757f,
-        0.01974f,
-        0.00129f,
-        0.00862f,
-        0.02926f,
-        0.04478f,
-        0.04602f,
-        0.04341f,
-        0.05014f,
-        0.05643f,
-        0.03546f,
-        -0.01834f,
-        -0.07537f,
-        -0.11110f,
-        -0.12691f,
-        -0.12411f,
-        -0.10754f,
-        -0.09923f,
-        -0.10206f,
-        -0.08627f,
-        -0.03778f,
-        0.02648f,
-        0.07680f,
-        0.07931f,
-        0.03101f,
-        -0.01723f,
-        -0.01654f,
-        0.03056f,
-        0.09147f,
-        0.14028f,
-        0.18082f,
-        0.23092f,
-        0.28166f,
-        0.31268f,
-        0.32659f,
-        0.32160f,
-        0.28067f,
-        0.21356f,
-        0.14683f,
-        0.07928f,
-        -0.00116f,
-        -0.08048f,
-        -0.13060f,
-        -0.14039f,
-        -0.12032f,
-        -0.08408f,
-        -0.04745f,
-        -0.03051f,
-        -0.02827f,
-        -0.01512f,
-        0.00446f,
-        0.00886f,
-        0.00775f,
-        0.02161f,
-        0.05230f,
-        0.09373f,
-        0.12782f,
-        0.13474f,
-        0.12327f,
-        0.10086f,
-        0.04818f,
-        -0.03682f,
-        -0.12249f,
-        -0.17666f,
-        -0.18403f,
-        -0.15787f,
-        -0.12867f,
-        -0.11173f,
-        -0.10847f,
-        -0.10970f,
-        -0.09328f,
-        -0.07013f,
-        -0.08650f,
-        -0.13937f,
-        -0.17932f,
-        -0.19186f,
-        -0.19026f,
-        -0.17832f,
-        -0.15854f,
-        -0.12098f,
-        -0.05565f,
-        0.00610f,
-        0.02774f,
-        0.01399f,
-        -0.01458f,
-        -0.03553f,
-        -0.03309f,
-        -0.02864f,
-        -0.03883f,
-        -0.03313f,
-        0.00129f,
-        0.03547f,
-        0.05713f,
-        0.06533f,
-        0.04814f,
-        0.01266f,
-        -0.02066f,
-        -0.04113f,
-        -0.04551f,
-        -0.05089f,
-        -0.07535f,
-        -0.08810f,
-        -0.04419f,
-        0.04547f,
-        0.12324f,
-        0.13714f,
-        0.10579f,
-        0.11708f,
-        0.18173f,
-        0.19511f,
-        0.12903f,
-        0.05601f,
-        -0.02344f,
-        -0.11597f,
-        -0.11637f,
-        0.00381f,
-        0.09555f,
-        0.07643f,
-        0.04022f,
-        0.06328f,
-        0.10965f,
-        0.12557f,
-        0.08761f,
-        -0.00397f,
-        -0.09654f,
-        -0.10482f,
-        -0.03619f,
-        -0.02738f,
-        -0.15558f,
-        -0.30618f,
-        -0.32512f,
-        -0.17980f,
-        0.05893f,
-        0.24755f,
-        0.26022f,
-        0.15746f,
-        0.10698f,
-        0.12767f,
-        0.11703f,
-        0.04428f,
-        -0.05892f,
-        -0.14889f,
-        -0.14221f,
-        -0.01032f,
-        0.12248f,
-        0.12812f,
-        0.04112f,
-        -0.01848f,
-        0.01182f,
-        0.10921f,
-        0.19406f,
-        0.19163f,
-        0.12287f,
-        0.08187f,
-        0.10396f,
-        0.13949f,
-        0.13201f,
-        0.05523f,
-        -0.05590f,
-        -0.10584f,
-        -0.06066f,
-        0.00319f,
-        0.02458f,
-        0.00266f,
-        -0.04579f,
-        -0.06606f,
-        -0.01926f,
-        0.03021f,
-        0.02058f,
-        -0.01833f,
-        -0.06103f,
-        -0.10540f,
-        -0.11843f,
-        -0.09712f,
-        -0.08664f,
-        -0.10371f,
-        -0.13938f,
-        -0.17927f,
-        -0.18908f,
-        -0.15833f,
-        -0.11590f,
-        -0.07976f,
-        -0.05598f,
-        -0.03229f,
-        0.02044f,
-        0.06564f,
-        0.03584f,
-        -0.02610f,
-        -0.04853f,
-        -0.06666f,
-        -0.09862f,
-        -0.07855f,
-        -0.00945f,
-        0.03533f,
-        0.05170f,
-        0.06937f,
-        0.06798f,
-        0.03647f,
-        0.00590f,
-        -0.02032f,
-        -0.07579f,
-        -0.15381f,
-        -0.19499f,
-        -0.16406f,
-        -0.08496f,
-        -0.00320f,
-        0.04234f,
-        0.04797f,
-        0.06657f,
-        0.13493f,
-        0.20529f,
-        0.22004f,
-        0.18459f,
-        0.12525f,
-        0.06540f,
-        0.03991f,
-        0.05305f,
-        0.06738f,
-        0.06670f,
-        0.06504f,
-        0.06147f,
-        0.04185f,
-        0.00507f,
-        -0.03448f,
-        -0.05125f,
-        -0.02913f,
-        0.01559f,
-        0.05433f,
-        0.07532f,
-        0.07889f,
-        0.07308f,
-        0.06800f,
-        0.05050f,
-        0.00521f,
-        -0.03885f,
-        -0.04959f,
-        -0.05210f,
-        -0.07879f,
-        -0.11559f,
-        -0.14183f,
-        -0.14651f,
-        -0.10790f,
-        -0.03378f,
-        0.02235f,
-        0.03398f,
-        0.02714f,
-        0.02948f,
-        0.04395f,
-        0.05421f,
-        0.03861f,
-        0.00299f,
-        -0.01504f,
-        0.00895f,
-        0.05926f,
-        0.09261f,
-        0.07086f,
-        0.00626f,
-        -0.04195f,
-        -0.03927f,
-        -0.00847f,
-        0.01482f,
-        0.01056f,
-        -0.02572f,
-        -0.06891f,
-        -0.07971f,
-        -0.05297f,
-        -0.01872f,
-        -0.00207f,
-        -0.00398f,
-        -0.00381f,
-        0.01610f,
-        0.03990f,
-        0.04023f,
-        0.01932f,
-        -0.00338f,
-        -0.00751f,
-        0.02743f,
-        0.08275f,
-        0.09694f,
-        0.05281f,
-        0.00310f,
-        -0.01163f,
-        0.00362f,
-        0.02366f,
-        0.01377f,
-        -0.03865f,
-        -0.09842f,
-        -0.12568f,
-        -0.11386f,
-        -0.07865f,
-        -0.04651f,
-        -0.03427f,
-        -0.03039f,
-        -0.02670f,
-        -0.03711f,
-        -0.06215f,
-        -0.08460f,
-        -0.09131f,
-        -0.06823f,
-        -0.01608f,
-        0.03005f,
-        0.04887f,
-        0.06172f,
-        0.07927f,
-        0.08341f,
-        0.07165f,
-        0.05462f,
-        0.03051f,
-        0.00477f,
-        -0.00508f,
-        -0.00179f,
-        -0.00285f,
-        -0.01019f,
-        -0.01545f,
-        -0.01302f,
-        0.00070f,
-        0.01781f,
-        0.02326f,
-        0.02301f,
-        0.03102f,
-        0.04078f,
-        0.04430f,
-        0.04788f,
-        0.05010f,
-        0.04386f,
-        0.03747f,
-        0.03837f,
-        0.04012f,
-        0.03893f,
-        0.03982f,
-        0.04251f,
-        0.03661f,
-        0.01758f,
-        -0.00095f,
-        -0.00688f,
-        -0.00886f,
-        -0.01248f,
-        -0.00724f,
-        0.01037f,
-        0.03237f,
-        0.05020f,
-        0.05024f,
-        0.02496f,
-        -0.01019f,
-        -0.03626f,
-        -0.05082f,
-        -0.06031f,
-        -0.07213f,
-        -0.08779f,
-        -0.09670f,
-        -0.08881f,
-        -0.06862f,
-        -0.05296f,
-        -0.05507f,
-        -0.06497f,
-        -0.06256f,
-        -0.04937f,
-        -0.03752f,
-        -0.02667f,
-        -0.01798f,
-        -0.01659f,
-        -0.01715f,
-        -0.01636f,
-        -0.01894f,
-        -0.02081f,
-        -0.01681f,
-        -0.01081f,
-        -0.00266f,
-        0.00976f,
-        0.01961f,
-        0.02005f,
-        0.00787f,
-        -0.01560f,
-        -0.03515f,
-        -0.03517f,
-        -0.01931f,
-        0.00098f,
-        0.02146f,
-        0.03971f,
-        0.05064f,
-        0.05017f,
-        0.04095f,
-        0.02953f,
-        0.01613f,
-        0.00188f,
-        -0.00294f,
-        0.00327f,
-        0.00960f,
-        0.01332f,
-        0.01695f,
-        0.01727f,
-        0.01597f,
-        0.01702f,
-        0.01760f,
-        0.02107f,
-        0.03329f,
-        0.04531f,
-        0.04560f,
-        0.03429f,
-        0.01720f,
-        0.00530f,
-        0.00873f,
-        0.02175f,
-        0.02995f,
-        0.02552f,
-        0.00884f,
-        -0.01128f,
-        -0.02336f,
-        -0.02722f,
-        -0.03135f,
-        -0.03952f,
-        -0.04668f,
-        -0.04382f,
-        -0.03009f,
-        -0.01701f,
-        -0.01214f,
-        -0.01040f,
-        -0.00535f,
-        0.00276f,
-        0.00917f,
-        0.00917f,
-        0.00376f,
-        -0.00109f,
-        -0.00011f,
-        0.00812f,
-        0.01667f,
-        0.01447f,
-        0.00214f,
-        -0.00807f,
-        -0.00921f,
-        -0.00465f,
-        -0.00107f,
-        -0.00255f,
-        -0.00626f,
-        -0.00682f,
-        -0.00359f,
-        0.00187f,
-        0.00778f,
-        0.01000f,
-        0.00710f,
-        0.00484f,
-        0.00858f,
-        0.01621f,
-        0.02208f,
-        0.02281f,
-        0.01799f,
-        0.00918f,
-        0.00085f,
-        -0.00195f,
-        0.00253f,
-        0.01246f,
-        0.02305f,
-        0.02821f,
-        0.02704f,
-        0.02144f,
-        0.00832f,
-        -0.01313f,
-        -0.03553f,
-        -0.05392f,
-        -0.06622f,
-        -0.06704f,
-        -0.05745f,
-        -0.04523f,
-        -0.03152f,
-        -0.01732f,
-        -0.00927f,
-        -0.00420f,
-        0.00578f,
-        0.01470f,
-        0.01608f,
-        0.01481f,
-        0.01288f,
-        0.00814f,
-        0.00392f,
-        0.00106f,
-        -0.00516f,
-        -0.01293f,
-        -0.01547f,
-        -0.01176f,
-        -0.00531f,
-        -0.00050f,
-        -0.00313f,
-        -0.01409f,
-        -0.02467f,
-        -0.02669f,
-        -0.02200f,
-        -0.01610f,
-        -0.01018f,
-        -0.00480f,
-        -0.00149f,
-        0.00044f,
-        0.00330f,
-        0.00943f,
-        0.01908f,
-        0.02922f,
-        0.03911f,
-        0.04968f,
-        0.05445f,
-        0.04785f,
-        0.03744f,
-        0.03068f,
-        0.02705f,
-        0.02862f,
-        0.03255f,
-        0.02670f,
-        0.01343f,
-        0.00736f,
-        0.00706f,
-        0.00310f,
-        -0.00076f,
-        -0.00043f,
-        -0.00254f,
-        -0.00989f,
-        -0.01529f,
-        -0.01277f,
-        -0.00406f,
-        0.00496f,
-        0.00916f,
-        0.00840f,
-        0.00675f,
-        0.00703f,
-        0.00834f,
-        0.00888f,
-        0.00870f,
-        0.00814f,
-        0.00586f,
-        0.00117f,
-        -0.00234f,
-        0.00107f,
-        0.00937f,
-        0.01080f,
-        0.00099f,
-        -0.00992f,
-        -0.01441f,
-        -0.01484f,
-        -0.01387f,
-        -0.01309f,
-        -0.01397f,
-        -0.01470f,
-        -0.01306f,
-        -0.01017f,
-        -0.00953f,
-        -0.01384f,
-        -0.01947f,
-        -0.01853f,
-        -0.01074f,
-        -0.00252f,
-        0.00325f,
-        0.00444f,
-        -0.00075f,
-        -0.00597f,
-        -0.00383f,
-        0.00245f,
-        0.00528f,
-        0.00279f,
-        0.00056f,
-        0.00434f,
-        0.00943f,
-        0.00780f,
-        0.00253f,
-        -0.00069f,
-        -0.00444f,
-        -0.01025f,
-        -0.01549f,
-        -0.02011f,
-        -0.02360f,
-        -0.02317f,
-        -0.01863f,
-        -0.01191f,
-        -0.00593f,
-        -0.00375f,
-        -0.00403f,
-        -0.00332f,
-        0.00001f,
-        0.00805f,
-        0.01843f,
-        0.02264f,
-        0.01888f,
-        0.01236f,
-        0.00453f,
-        -0.00255f,
-        -0.00455f,
-        -0.00347f,
-        -0.00305f,
-        -0.00222f,
-        -0.00116f,
-        -0.00113f,
-        -0.00131f,
-        -0.00330f,
-        -0.00871f,
-        -0.01252f,
-        -0.01099f,
-        -0.00728f,
-        -0.00405f,
-        -0.00148f,
-        0.00049f,
-        0.00387f,
-        0.01024f,
-        0.01637f,
-        0.01840f,
-        0.01844f,
-        0.02045f,
-        0.02204f,
-        0.01867f,
-        0.01215f,
-        0.00699f,
-        0.00492f,
-        0.00609f,
-        0.00842f,
-        0.00762f,
-        0.00176f,
-        -0.00793f,
-        -0.01681f,
-        -0.01759f,
-        -0.01103f,
-        -0.00653f,
-        -0.00699f,
-        -0.00783f,
-        -0.00746f,
-        -0.00483f,
-        0.00046f,
-        0.00343f,
-        0.00255f,
-        0.00311f,
-        0.00490f,
-        0.00426f,
-        0.00363f,
-        0.00488f,
-        0.00516f,
-        0.00389f,
-        0.00196f,
-        -0.00142f,
-        -0.00481f,
-        -0.00569f,
-        -0.00510f,
-        -0.00612f,
-        -0.00983f,
-        -0.01362f,
-        -0.01390f,
-        -0.01148f,
-        -0.00983f,
-        -0.00829f,
-        -0.00531f,
-        -0.00385f,
-        -0.00472f,
-        -0.00327f,
-        0.00131f,
-        0.00386f,
-        0.00262f,
-        -0.00075f,
-        -0.00649f,
-        -0.01300f,
-        -0.01545f,
-        -0.01281f,
-        -0.00767f,
-        -0.00151f,
-        0.00345f,
-        0.00511f,
-        0.00552f,
-        0.00618f,
-        0.00517f,
-        0.00257f,
-        0.00035f,
-        -0.00062f,
-        0.00081f,
-        0.00449f,
-        0.00662f,
-        0.00483f,
-        0.00087f,
-        -0.00231f,
-        -0.00188f,
-        0.00079f,
-        0.00003f,
-        -0.00413f,
-        -0.00568f,
-        -0.00325f,
-        0.00005f,
-        0.00261f,
-        0.00430f,
-        0.00598f,
-        0.00836f,
-        0.01013f,
-        0.01027f,
-        0.00911f,
-        0.00544f,
-        0.00005f,
-        -0.00318f,
-        -0.00422f,
-        -0.00557f,
-        -0.00576f,
-        -0.00344f,
-        -0.00097f,
-        0.00079f,
-        0.00296f,
-        0.00520f,
-        0.00723f,
-        0.00874f,
-        0.00781f,
-        0.00473f,
-        0.00280f,
-        0.00251f,
-        0.00132f,
-        -0.00091f,
-        -0.00291f,
-        -0.00509f,
-        -0.00772f,
-        -0.00921f,
-        -0.00887f,
-        -0.00758f,
-        -0.00571f,
-        -0.00279f,
-        0.00175f,
-        0.00699f,
-        0.01008f,
-        0.00993f,
-        0.00821f,
-        0.00559f,
-        0.00272f,
-        0.00164f,
-        0.00126f,
-        -0.00125f,
-        -0.00393f,
-        -0.00441f,
-        -0.00497f,
-        -0.00616f,
-        -0.00534f,
-        -0.00271f,
-        -0.00037f,
-        0.00080f,
-        0.00026f,
-        -0.00097f,
-        -0.00053f,
-        0.00148f,
-        0.00373f,
-        0.00606f,
-        0.00767f,
-        0.00730f,
-        0.00572f,
-        0.00385f,
-        0.00195f,
-        0.00085f,
-        0.00011f,
-        -0.00186f,
-        -0.00475f,
-        -0.00703f,
-        -0.00856f,
-        -0.00916f,
-        -0.00749f,
-        -0.00364f,
-        0.00023f,
-        0.00235f,
-        0.00242f,
-        0.00104f,
-        -0.00017f,
-        0.00057f,
-        0.00247f,
-        0.00335f,
-        0.00314f,
-        0.00248f,
-        0.00140f,
-        0.00089f,
-        0.00166f,
-        0.00254f,
-        0.00289f,
-        0.00284f,
-        0.00186f,
-        0.00027f,
-        -0.00105f,
-        -0.00214f,
-        -0.00285f,
-        -0.00232f,
-        -0.00094f,
-        0.00041f,
-        0.00154f,
-        0.00174f,
-        0.00068f,
-        -0.00036f,
-        -0.00042f,
-        0.00031f,
-        0.00123f,
-        0.00185f,
-        0.00262f,
-        0.00406f,
-        0.00526f,
-        0.00556f,
-        0.00519f,
-        0.00365f,
-        0.00112f,
-        -0.00027f,
-        0.00008f,
-        0.00019f,
-        -0.00101f,
-        -0.00223f,
-        -0.00197f,
-        -0.00014f,
-        0.00189f,
-        0.00295f,
-        0.00288f,
-        0.00164f,
-        -0.00026f,
-        -0.00152f,
-        -0.00197f,
-        -0.00283f,
-        -0.00435f,
-        -0.00562f,
-        -0.00587f,
-        -0.00503f,
-        -0.00393f,
-        -0.00329f,
-        -0.00291f,
-        -0.00225f,
-        -0.00120f,
-        -0.00006f,
-        0.00031f,
-        -0.00065f,
-        -0.00196f,
-        -0.00234f,
-        -0.00181f,
-        -0.00092f,
-        0.00011f,
-        0.00103f,
-        0.00125f,
-        0.00042f,
-        -0.00110f,
-        -0.00237f,
-        -0.00304f,
-        -0.00350f,
-        -0.00403f,
-        -0.00439f,
-        -0.00419f,
-        -0.00322f,
-        -0.00175f,
-        -0.00042f,
-        0.00026f,
-        0.00057f,
-        0.00099f,
-        0.00100f,
-        0.00041f,
-        0.00039f,
-        0.00139f};
+// The click used to be an embedded recording of a real metronome, three
+// PCM arrays of about 50 KiB that lived in the data segment and were
+// paged in on first use. It is now synthesized at compile time as an
+// exponentially decaying sine burst, which sounds close to the original
+// recording, shrinks the binary and avoids the first-use page fault in
+// the engine callback when the metronome engages mid-set.
+
+// Parameters chosen to match the old recording: about 23 ms long with a
+// peak level of 0.6.
+constexpr double kClickFrequencyHz = 1000.0;
+constexpr double kClickDecaySeconds = 0.005;
+constexpr double kClickDurationSeconds = 0.023;
+constexpr double kClickPeak = 0.6;
+
+// std::sin/std::cos/std::exp are not constexpr before C++26. The series
+// below are only evaluated for the small per-sample arguments (well below
+// 1) where a few terms already reach double precision.
+constexpr double seriesSin(double x) {
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 10; ++n) {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double seriesCos(double x) {
+    double term = 1.0;
+    double sum = 1.0;
+    for (int n = 1; n < 10; ++n) {
+        term *= -x * x / ((2 * n - 1) * (2 * n));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double seriesExp(double x) {
+    double term = 1.0;
+    double sum = 1.0;
+    for (int n = 1; n < 20; ++n) {
+        term *= x / n;
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr std::size_t clickFrames(unsigned int sampleRate) {
+    return static_cast<std::size_t>(kClickDurationSeconds * sampleRate);
+}
+
+template<unsigned int sampleRate>
+constexpr std::array<CSAMPLE, clickFrames(sampleRate)> synthesizeClick() {
+    std::array<CSAMPLE, clickFrames(sampleRate)> click{};
+    // The sine is advanced by a complex rotation per sample instead of
+    // evaluating sin() at growing phase arguments, which would exceed the
+    // convergence range of the series above.
+    const double omega = 2.0 * M_PI * kClickFrequencyHz / sampleRate;
+    const double cosOmega = seriesCos(omega);
+    const double sinOmega = seriesSin(omega);
+    const double decayPerSample = seriesExp(-1.0 / (kClickDecaySeconds * sampleRate));
+    double sinPhase = 0.0;
+    double cosPhase = 1.0;
+    double amplitude = kClickPeak;
+    for (std::size_t i = 0; i < click.size(); ++i) {
+        click[i] = static_cast<CSAMPLE>(amplitude * sinPhase);
+        const double nextSinPhase = sinPhase * cosOmega + cosPhase * sinOmega;
+        cosPhase = cosPhase * cosOmega - sinPhase * sinOmega;
+        sinPhase = nextSinPhase;
+        amplitude *= decayPerSample;
+    }
+    return click;
+}
 
-constexpr CSAMPLE kClick48000[] = {
-        0.01534f,
-        0.05623f,
-        0.10618f,
-        0.13596f,
-        0.13323f,
-        0.12915f,
-        0.16533f,
-        0.22630f,
-        0.26943f,
-        0.26715f,
-        0.19582f,
-        0.04604f,
-        -0.14266f,
-        -0.28995f,
-        -0.34129f,
-        -0.32696f,
-        -0.33215f,
-        -0.39098f,
-        -0.44083f,
-        -0.41410f,
-        -0.32505f,
-        -0.19452f,
-        -0.04420f,
-        0.07968f,
-        0.13807f,
-        0.14200f,
-        0.13697f,
-        0.14017f,
-        0.10844f,
-        -0.00998f,
-        -0.20339f,
-        -0.38685f,
-        -0.47964f,
-        -0.46238f,
-        -0.36563f,
-        -0.23624f,
-        -0.10653f,
-        0.01011f,
-        0.10692f,
-        0.17889f,
-        0.23127f,
-        0.27896f,
-        0.31689f,
-        0.30251f,
-        0.23580f,
-        0.18466f,
-        0.19663f,
-        0.26415f,
-        0.34964f,
-        0.41187f,
-        0.42004f,
-        0.36949f,
-        0.29331f,
-        0.24490f,
-        0.25222f,
-        0.28592f,
-        0.27035f,
-        0.18757f,
-        0.10225f,
-        0.07727f,
-        0.10667f,
-        0.14869f,
-        0.17376f,
-        0.16134f,
-        0.08241f,
-        -0.07001f,
-        -0.23485f,
-        -0.33713f,
-        -0.37946f,
-        -0.41459f,
-        -0.46094f,
-        -0.52234f,
-        -0.57817f,
-        -0.58459f,
-        -0.51238f,
-        -0.37392f,
-        -0.20807f,
-        -0.04356f,
-        0.10981f,
-        0.23755f,
-        0.30763f,
-        0.30575f,
-        0.24488f,
-        0.15134f,
-        0.05858f,
-        -0.00241f,
-        -0.02195f,
-        -0.02045f,
-        -0.03040f,
-        -0.06317f,
-        -0.09497f,
-        -0.08899f,
-        -0.02551f,
-        0.06207f,
-        0.10207f,
-        0.05498f,
-        -0.05390f,
-        -0.16271f,
-        -0.21921f,
-        -0.20327f,
-        -0.12880f,
-        -0.03603f,
-        0.02742f,
-        0.04289f,
-        0.04285f,
-        0.08079f,
-        0.15819f,
-        0.23501f,
-        0.26056f,
-        0.20848f,
-        0.10325f,
-        0.00876f,
-        -0.02254f,
-        0.00509f,
-        0.04025f,
-        0.04500f,
-        0.02840f,
-        0.01009f,
-        0.00246f,
-        0.02374f,
-        0.05983f,
-        0.05938f,
-        -0.00067f,
-        -0.08197f,
-        -0.12402f,
-        -0.10007f,
-        -0.02830f,
-        0.05780f,
-        0.12634f,
-        0.15623f,
-        0.17398f,
-        0.21555f,
-        0.26945f,
-        0.29704f,
-        0.27207f,
-        0.19491f,
-        0.08793f,
-        -0.01679f,
-        -0.09336f,
-        -0.13723f,
-        -0.16586f,
-        -0.19899f,
-        -0.23591f,
-        -0.25307f,
-        -0.22920f,
-        -0.16961f,
-        -0.10551f,
-        -0.06770f,
-        -0.06197f,
-        -0.06851f,
-        -0.06301f,
-        -0.03938f,
-        -0.01487f,
-        -0.01507f,
-        -0.05003f,
-        -0.09099f,
-        -0.10396f,
-        -0.08326f,
-        -0.05569f,
-        -0.04847f,
-        -0.06278f,
-        -0.07894f,
-        -0.07762f,
-        -0.04985f,
-        0.00664f,
-        0.07563f,
-        0.10975f,
-        0.09322f,
-        0.07214f,
-        0.07951f,
-        0.10700f,
-        0.13119f,
-        0.13475f,
-        0.10719f,
-        0.04729f,
-        -0.02576f,
-        -0.07388f,
-        -0.07271f,
-        -0.03713f,
-        0.00120f,
-        0.03576f,
-        0.07221f,
-        0.10817f,
-        0.13593f,
-        0.14808f,
-        0.13883f,
-        0.10412f,
-        0.04310f,
-        -0.03932f,
-        -0.12878f,
-        -0.19932f,
-        -0.22814f,
-        -0.23538f,
-        -0.23948f,
-        -0.22687f,
-        -0.17931f,
-        -0.10409f,
-        -0.02522f,
-        0.03756f,
-        0.07436f,
-        0.07882f,
-        0.05333f,
-        0.01917f,
-        0.00222f,
-        0.00766f,
-        0.02487f,
-        0.04022f,
-        0.04555f,
-        0.04460f,
-        0.04652f,
-        0.05254f,
-        0.05015f,
-        0.02371f,
-        -0.02616f,
-        -0.07737f,
-        -0.11019f,
-        -0.12522f,
-        -0.12464f,
-        -0.11200f,
-        -0.10214f,
-        -0.10084f,
-        -0.09437f,
-        -0.06659f,
-        -0.01692f,
-        0.03873f,
-        0.07721f,
-        0.07540f,
-        0.03103f,
-        -0.01329f,
-        -0.01665f,
-        0.01906f,
-        0.07165f,
-        0.12043f,
-        0.16104f,
-        0.20241f,
-        0.24866f,
-        0.28998f,
-        0.31528f,
-        0.32606f,
-        0.32059f,
-        0.28299f,
-        0.22281f,
-        0.16145f,
-        0.09957f,
-        0.02954f,
-        -0.04376f,
-        -0.10333f,
-        -0.13427f,
-        -0.13450f,
-        -0.11263f,
-        -0.07929f,
-        -0.04661f,
-        -0.03105f,
-        -0.02852f,
-        -0.01767f,
-        -0.00093f,
-        0.00729f,
-        0.00824f,
-        0.01441f,
-        0.03387f,
-        0.06549f,
-        0.10181f,
-        0.12890f,
-        0.13388f,
-        0.12335f,
-        0.10283f,
-        0.05709f,
-        -0.01554f,
-        -0.09408f,
-        -0.15429f,
-        -0.18039f,
-        -0.17292f,
-        -0.14784f,
-        -0.12423f,
-        -0.11114f,
-        -0.10859f,
-        -0.10940f,
-        -0.09431f,
-        -0.07347f,
-        -0.08281f,
-        -0.12316f,
-        -0.16382f,
-        -0.18598f,
-        -0.19114f,
-        -0.18586f,
-        -0.17264f,
-        -0.15081f,
-        -0.11284f,
-        -0.05297f,
-        0.00376f,
-        0.02516f,
-        0.01675f,
-        -0.00653f,
-        -0.02793f,
-        -0.03417f,
-        -0.03098f,
-        -0.03265f,
-        -0.03705f,
-        -0.02518f,
-        0.00640f,
-        0.03695f,
-        0.05685f,
-        0.06456f,
-        0.05115f,
-        0.02176f,
-        -0.00940f,
-        -0.03255f,
-        -0.04332f,
-        -0.04776f,
-        -0.05914f,
-        -0.07861f,
-        -0.08043f,
-        -0.03582f,
-        0.04641f,
-        0.11786f,
-        0.13505f,
-        0.11305f,
-        0.11355f,
-        0.15625f,
-        0.18875f,
-        0.16581f,
-        0.10259f,
-        0.03370f,
-        -0.04191f,
-        -0.11602f,
-        -0.11191f,
-        -0.00149f,
-        0.08405f,
-        0.08038f,
-        0.05064f,
-        0.05477f,
-        0.08877f,
-        0.11711f,
-        0.11088f,
-        0.05960f,
-        -0.02476f,
-        -0.09773f,
-        -0.10056f,
-        -0.03750f,
-        -0.02826f,
-        -0.13229f,
-        -0.26659f,
-        -0.31860f,
-        -0.24162f,
-        -0.06202f,
-        0.13666f,
-        0.25174f,
-        0.23457f,
-        0.14896f,
-        0.10878f,
-        0.12761f,
-        0.11783f,
-        0.05568f,
-        -0.03437f,
-        -0.12018f,
-        -0.14488f,
-        -0.07384f,
-        0.04773f,
-        0.12449f,
-        0.10423f,
-        0.02960f,
-        -0.01508f,
-        0.01482f,
-        0.10430f,
-        0.18289f,
-        0.19215f,
-        0.14309f,
-        0.09726f,
-        0.09387f,
-        0.12038f,
-        0.13664f,
-        0.10901f,
-        0.03096f,
-        -0.06275f,
-        -0.10332f,
-        -0.06181f,
-        -0.00362f,
-        0.02056f,
-        0.00856f,
-        -0.02881f,
-        -0.05731f,
-        -0.04326f,
-        0.00082f,
-        0.02708f,
-        0.01111f,
-        -0.02525f,
-        -0.06462f,
-        -0.10538f,
-        -0.11737f,
-        -0.10059f,
-        -0.08920f,
-        -0.09816f,
-        -0.12488f,
-        -0.15981f,
-        -0.18350f,
-        -0.17833f,
-        -0.14694f,
-        -0.10914f,
-        -0.07724f,
-        -0.05540f,
-        -0.03363f,
-        0.01317f,
-        0.05574f,
-        0.04479f,
-        -0.00246f,
-        -0.03815f,
-        -0.05679f,
-        -0.07863f,
-        -0.09273f,
-        -0.06389f,
-        -0.00359f,
-        0.03614f,
-        0.05118f,
-        0.06737f,
-        0.06825f,
-        0.04515f,
-        0.01680f,
-        -0.00884f,
-        -0.04699f,
-        -0.10697f,
-        -0.16692f,
-        -0.18766f,
-        -0.15173f,
-        -0.07886f,
-        -0.00374f,
-        0.03834f,
-        0.04702f,
-        0.06191f,
-        0.11226f,
-        0.17624f,
-        0.21275f,
-        0.20499f,
-        0.16421f,
-        0.10956f,
-        0.06079f,
-        0.04122f,
-        0.05331f,
-        0.06648f,
-        0.06680f,
-        0.06541f,
-        0.06256f,
-        0.04946f,
-        0.02232f,
-        -0.01271f,
-        -0.04066f,
-        -0.04490f,
-        -0.01992f,
-        0.02042f,
-        0.05524f,
-        0.07452f,
-        0.07846f,
-        0.07424f,
-        0.06943f,
-        0.05685f,
-        0.02533f,
-        -0.01570f,
-        -0.04307f,
-        -0.05037f,
-        -0.05826f,
-        -0.08430f,
-        -0.11738f,
-        -0.14149f,
-        -0.14607f,
-        -0.11467f,
-        -0.05280f,
-        0.00338f,
-        0.02911f,
-        0.03056f,
-        0.02812f,
-        0.03436f,
-        0.04658f,
-        0.05149f,
-        0.03528f,
-        0.00277f,
-        -0.01379f,
-        0.00534f,
-        0.04761f,
-        0.08218f,
-        0.07943f,
-        0.03697f,
-        -0.01511f,
-        -0.04098f,
-        -0.03062f,
-        -0.00382f,
-        0.01432f,
-        0.00921f,
-        -0.02412f,
-        -0.06350f,
-        -0.07748f,
-        -0.06067f,
-        -0.03136f,
-        -0.00957f,
-        -0.00296f,
-        -0.00391f,
-        0.00228f,
-        0.02145f,
-        0.03995f,
-        0.03893f,
-        0.01972f,
-        -0.00110f,
-        -0.00676f,
-        0.01825f,
-        0.06371f,
-        0.09090f,
-        0.07517f,
-        0.03232f,
-        -0.00177f,
-        -0.00782f,
-        0.00699f,
-        0.02280f,
-        0.01346f,
-        -0.03470f,
-        -0.08906f,
-        -0.11919f,
-        -0.11763f,
-        -0.09275f,
-        -0.06199f,
-        -0.04116f,
-        -0.03289f,
-        -0.02938f,
-        -0.02871f,
-        -0.03992f,
-        -0.06284f,
-        -0.08347f,
-        -0.09043f,
-        -0.07314f,
-        -0.03142f,
-        0.01273f,
-        0.04028f,
-        0.05481f,
-        0.06840f,
-        0.08051f,
-        0.08084f,
-        0.06932f,
-        0.05327f,
-        0.03112f,
-        0.00751f,
-        -0.00323f,
-        -0.00268f,
-        -0.00248f,
-        -0.00702f,
-        -0.01275f,
-        -0.01446f,
-        -0.00857f,
-        0.00486f,
-        0.01869f,
-        0.02324f,
-        0.02301f,
-        0.03037f,
-        0.03919f,
-        0.04344f,
-        0.04672f,
-        0.04920f,
-        0.04690f,
-        0.04111f,
-        0.03778f,
-        0.03884f,
-        0.03990f,
-        0.03902f,
-        0.03989f,
-        0.04236f,
-        0.03742f,
-        0.02175f,
-        0.00462f,
-        -0.00462f,
-        -0.00794f,
-        -0.01051f,
-        -0.01052f,
-        -0.00207f,
-        0.01504f,
-        0.03470f,
-        0.05020f,
-        0.05024f,
-        0.02781f,
-        -0.00337f,
-        -0.02908f,
-        -0.04563f,
-        -0.05615f,
-        -0.06599f,
-        -0.07839f,
-        -0.09063f,
-        -0.09483f,
-        -0.08566f,
-        -0.06745f,
-        -0.05306f,
-        -0.05488f,
-        -0.06330f,
-        -0.06316f,
-        -0.05374f,
-        -0.04241f,
-        -0.03203f,
-        -0.02298f,
-        -0.01750f,
-        -0.01674f,
-        -0.01701f,
-        -0.01662f,
-        -0.01897f,
-        -0.02069f,
-        -0.01739f,
-        -0.01216f,
-        -0.00516f,
-        0.00494f,
-        0.01499f,
-        0.01981f,
-        0.01556f,
-        0.00113f,
-        -0.01962f,
-        -0.03515f,
-        -0.03448f,
-        -0.01991f,
-        -0.00144f,
-        0.01736f,
-        0.03457f,
-        0.04667f,
-        0.05038f,
-        0.04579f,
-        0.03646f,
-        0.02535f,
-        0.01284f,
-        0.00116f,
-        -0.00252f,
-        0.00319f,
-        0.00900f,
-        0.01267f,
-        0.01602f,
-        0.01716f,
-        0.01651f,
-        0.01649f,
-        0.01726f,
-        0.01877f,
-        0.02420f,
-        0.03539f,
-        0.04534f,
-        0.04546f,
-        0.03507f,
-        0.01977f,
-        0.00806f,
-        0.00766f,
-        0.01662f,
-        0.02605f,
-        0.02799f,
-        0.01948f,
-        0.00319f,
-        -0.01369f,
-        -0.02382f,
-        -0.02737f,
-        -0.03117f,
-        -0.03850f,
-        -0.04520f,
-        -0.04464f,
-        -0.03516f,
-        -0.02290f,
-        -0.01473f,
-        -0.01147f,
-        -0.00886f,
-        -0.00353f,
-        0.00368f,
-        0.00917f,
-        0.00917f,
-        0.00430f,
-        -0.00021f,
-        -0.00037f,
-        0.00529f,
-        0.01303f,
-        0.01558f,
-        0.00939f,
-        -0.00124f,
-        -0.00835f,
-        -0.00844f,
-        -0.00434f,
-        -0.00108f,
-        -0.00244f,
-        -0.00568f,
-        -0.00669f,
-        -0.00462f,
-        -0.00032f,
-        0.00493f,
-        0.00875f,
-        0.00897f,
-        0.00648f,
-        0.00556f,
-        0.00944f,
-        0.01639f,
-        0.02178f,
-        0.02271f,
-        0.01902f,
-        0.01177f,
-        0.00398f,
-        -0.00067f,
-        0.00012f,
-        0.00631f,
-        0.01563f,
-        0.02418f,
-        0.02805f,
-        0.02673f,
-        0.02158f,
-        0.00972f,
-        -0.00910f,
-        -0.02950f,
-        -0.04748f,
-        -0.06091f,
-        -0.06662f,
-        -0.06315f,
-        -0.05348f,
-        -0.04189f,
-        -0.02922f,
-        -0.01667f,
-        -0.00927f,
-        -0.00461f,
-        0.00415f,
-        0.01252f,
-        0.01563f,
-        0.01533f,
-        0.01382f,
-        0.01084f,
-        0.00666f,
-        0.00315f,
-        -0.00010f,
-        -0.00598f,
-        -0.01299f,
-        -0.01533f,
-        -0.01227f,
-        -0.00672f,
-        -0.00194f,
-        -0.00213f,
-        -0.00902f,
-        -0.01891f,
-        -0.02543f,
-        -0.02531f,
-        -0.02075f,
-        -0.01533f,
-        -0.00991f,
-        -0.00497f,
-        -0.00186f,
-        0.00007f,
-        0.00251f,
-        0.00724f,
-        0.01485f,
-        0.02396f,
-        0.03317f,
-        0.04248f,
-        0.05081f,
-        0.05342f,
-        0.04707f,
-        0.03751f,
-        0.03127f,
-        0.02766f,
-        0.02823f,
-        0.03125f,
-        0.02912f,
-        0.01999f,
-        0.01085f,
-        0.00726f,
-        0.00602f,
-        0.00240f,
-        -0.00073f,
-        -0.00047f,
-        -0.00241f,
-        -0.00883f,
-        -0.01407f,
-        -0.01354f,
-        -0.00744f,
-        0.00073f,
-        0.00685f,
-        0.00888f,
-        0.00793f,
-        0.00681f,
-        0.00719f,
-        0.00836f,
-        0.00886f,
-        0.00872f,
-        0.00825f,
-        0.00650f,
-        0.00287f,
-        -0.00078f,
-        -0.00072f,
-        0.00433f,
-        0.00982f,
-        0.00854f,
-        -0.00064f,
-        -0.01023f,
-        -0.01435f,
-        -0.01480f,
-        -0.01404f,
-        -0.01329f,
-        -0.01367f,
-        -0.01439f,
-        -0.01388f,
-        -0.01185f,
-        -0.00995f,
-        -0.01063f,
-        -0.01482f,
-        -0.01938f,
-        -0.01844f,
-        -0.01128f,
-        -0.00376f,
-        0.00191f,
-        0.00407f,
-        0.00130f,
-        -0.00349f,
-        -0.00502f,
-        -0.00156f,
-        0.00324f,
-        0.00478f,
-        0.00253f,
-        0.00070f,
-        0.00417f,
-        0.00879f,
-        0.00814f,
-        0.00405f,
-        0.00050f,
-        -0.00275f,
-        -0.00716f,
-        -0.01228f,
-        -0.01690f,
-        -0.02089f,
-        -0.02354f,
-        -0.02289f,
-        -0.01872f,
-        -0.01258f,
-        -0.00702f,
-        -0.00432f,
-        -0.00393f,
-        -0.00362f,
-        -0.00168f,
-        0.00332f,
-        0.01148f,
-        0.01948f,
-        0.02201f,
-        0.01831f,
-        0.01231f,
-        0.00512f,
-        -0.00144f,
-        -0.00407f,
-        -0.00381f,
-        -0.00322f,
-        -0.00262f,
-        -0.00176f,
-        -0.00115f,
-        -0.00118f,
-        -0.00169f,
-        -0.00391f,
-        -0.00883f,
-        -0.01233f,
-        -0.01119f,
-        -0.00807f,
-        -0.00500f,
-        -0.00244f,
-        -0.00041f,
-        0.00205f,
-        0.00630f,
-        0.01208f,
-        0.01681f,
-        0.01841f,
-        0.01855f,
-        0.02040f,
-        0.02187f,
-        0.01930f,
-        0.01390f,
-        0.00880f,
-        0.00581f,
-        0.00549f,
-        0.00704f,
-        0.00816f,
-        0.00619f,
-        0.00019f,
-        -0.00865f,
-        -0.01681f,
-        -0.01753f,
-        -0.01210f,
-        -0.00763f,
-        -0.00684f,
-        -0.00749f,
-        -0.00764f,
-        -0.00633f,
-        -0.00298f,
-        0.00126f,
-        0.00327f,
-        0.00261f,
-        0.00315f,
-        0.00480f,
-        0.00435f,
-        0.00377f,
-        0.00450f,
-        0.00505f,
-        0.00448f,
-        0.00301f,
-        0.00069f,
-        -0.00241f,
-        -0.00500f,
-        -0.00561f,
-        -0.00515f,
-        -0.00609f,
-        -0.00941f,
-        -0.01288f,
-        -0.01382f,
-        -0.01234f,
-        -0.01055f,
-        -0.00909f,
-        -0.00710f,
-        -0.00485f,
-        -0.00406f,
-        -0.00449f,
-        -0.00293f,
-        0.00128f,
-        0.00364f,
-        0.00283f,
-        0.00009f,
-        -0.00459f,
-        -0.01031f,
-        -0.01424f,
-        -0.01433f,
-        -0.01105f,
-        -0.00606f,
-        -0.00061f,
-        0.00362f,
-        0.00512f,
-        0.00549f,
-        0.00608f,
-        0.00540f,
-        0.00337f,
-        0.00121f,
-        -0.00016f,
-        0.00002f,
-        0.00217f,
-        0.00510f,
-        0.00625f,
-        0.00434f,
-        0.00073f,
-        -0.00219f,
-        -0.00193f,
-        0.00025f,
-        0.00024f,
-        -0.00262f,
-        -0.00499f,
-        -0.00453f,
-        -0.00195f,
-        0.00085f,
-        0.00300f,
-        0.00455f,
-        0.00614f,
-        0.00833f,
-        0.00996f,
-        0.01025f,
-        0.00941f,
-        0.00668f,
-        0.00231f,
-        -0.00156f,
-        -0.00362f,
-        -0.00468f,
-        -0.00562f,
-        -0.00535f,
-        -0.00321f,
-        -0.00095f,
-        0.00067f,
-        0.00263f,
-        0.00468f,
-        0.00659f,
-        0.00814f,
-        0.00825f,
-        0.00644f,
-        0.00403f,
-        0.00272f,
-        0.00227f,
-        0.00106f,
-        -0.00098f,
-        -0.00282f,
-        -0.00482f,
-        -0.00718f,
-        -0.00878f,
-        -0.00900f,
-        -0.00816f,
-        -0.00670f,
-        -0.00458f,
-        -0.00140f,
-        0.00293f,
-        0.00743f,
-        0.01007f,
-        0.00993f,
-        0.00838f,
-        0.00607f,
-        0.00347f,
-        0.00201f,
-        0.00142f,
-        0.00002f,
-        -0.00235f,
-        -0.00409f,
-        -0.00455f,
-        -0.00517f,
-        -0.00609f,
-        -0.00532f,
-        -0.00291f,
-        -0.00074f,
-        0.00052f,
-        0.00043f,
-        -0.00048f,
-        -0.00074f,
-        0.00035f,
-        0.00228f,
-        0.00437f,
-        0.00637f,
-        0.00763f,
-        0.00725f,
-        0.00580f,
-        0.00410f,
-        0.00235f,
-        0.00117f,
-        0.00039f,
-        -0.00096f,
-        -0.00320f,
-        -0.00562f,
-        -0.00749f,
-        -0.00869f,
-        -0.00893f,
-        -0.00727f,
-        -0.00374f,
-        -0.00018f,
-        0.00195f,
-        0.00240f,
-        0.00152f,
-        0.00035f,
-        0.00019f,
-        0.00134f,
-        0.00276f,
-        0.00330f,
-        0.00303f,
-        0.00239f,
-        0.00140f,
-        0.00093f,
-        0.00153f,
-        0.00233f,
-        0.00278f,
-        0.00286f,
-        0.00234f,
-        0.00117f,
-        -0.00019f,
-        -0.00134f,
-        -0.00227f,
-        -0.00279f,
-        -0.00229f,
-        -0.00102f,
-        0.00022f,
-        0.00129f,
-        0.00168f,
-        0.00108f,
-        0.00012f,
-        -0.00039f,
-        -0.00015f,
-        0.00058f,
-        0.00136f,
-        0.00195f,
-        0.00269f,
-        0.00401f,
-        0.00512f,
-        0.00550f,
-        0.00529f,
-        0.00420f,
-        0.00223f,
-        0.00045f,
-        -0.00013f,
-        0.00012f,
-        -0.00009f,
-        -0.00120f,
-        -0.00221f,
-        -0.00197f,
-        -0.00030f,
-        0.00155f,
-        0.00268f,
-        0.00290f,
-        0.00215f,
-        0.00068f,
-        -0.00080f,
-        -0.00167f,
-        -0.00220f,
-        -0.00310f,
-        -0.00448f,
-        -0.00562f,
-        -0.00585f,
-        -0.00515f,
-        -0.00418f,
-        -0.00349f,
-        -0.00306f,
-        -0.00256f,
-        -0.00178f,
-        -0.00078f,
-        0.00005f,
-        0.00011f,
-        -0.00081f,
-        -0.00198f,
-        -0.00233f,
-        -0.00187f,
-        -0.00110f,
-        -0.00018f,
-        0.00070f,
-        0.00115f,
-        0.00086f,
-        -0.00018f,
-        -0.00150f,
-        -0.00252f,
-        -0.00311f,
-        -0.00354f,
-        -0.00402f,
-        -0.00436f,
-        -0.00423f,
-        -0.00347f,
-        -0.00225f,
-        -0.00098f,
-        -0.00008f,
-        0.00039f,
-        0.00071f,
-        0.00099f,
-        0.00090f,
-        0.00041f,
-        0.00040f,
-        0.00132f,
-        0.00021f};
+constexpr auto kClick44100 = synthesizeClick<44100>();
+constexpr auto kClick48000 = synthesizeClick<48000>();
+constexpr auto kClick96000 = synthesizeClick<96000>();
 
-constexpr CSAMPLE kClick96000[] = {
-        0.01534f,
-        0.03123f,
-        0.05623f,
-        0.08369f,
-        0.10618f,
-        0.12552f,
-        0.13596f,
-        0.13482f,
-        0.13323f,
-        0.13034f,
-        0.12915f,
-        0.14724f,
-        0.16533f,
-        0.19519f,
-        0.22630f,
-        0.24937f,
-        0.26943f,
-        0.27444f,
-        0.26715f,
-        0.24443f,
-        0.19582f,
-        0.13858f,
-        0.04604f,
-        -0.04657f,
-        -0.14266f,
-        -0.23875f,
-        -0.28995f,
-        -0.33277f,
-        -0.34129f,
-        -0.33259f,
-        -0.32696f,
-        -0.32454f,
-        -0.33215f,
-        -0.36189f,
-        -0.39098f,
-        -0.41591f,
-        -0.44083f,
-        -0.42828f,
-        -0.41410f,
-        -0.37329f,
-        -0.32505f,
-        -0.26398f,
-        -0.19452f,
-        -0.12165f,
-        -0.04420f,
-        0.02703f,
-        0.07968f,
-        0.12909f,
-        0.13807f,
-        0.14704f,
-        0.14200f,
-        0.13536f,
-        0.13697f,
-        0.14179f,
-        0.14017f,
-        0.13315f,
-        0.10844f,
-        0.05316f,
-        -0.00998f,
-        -0.10672f,
-        -0.20339f,
-        -0.29512f,
-        -0.38685f,
-        -0.43730f,
-        -0.47964f,
-        -0.48149f,
-        -0.46238f,
-        -0.42423f,
-        -0.36563f,
-        -0.30417f,
-        -0.23624f,
-        -0.16901f,
-        -0.10653f,
-        -0.04405f,
-        0.01011f,
-        0.06385f,
-        0.10692f,
-        0.14688f,
-        0.17889f,
-        0.20556f,
-        0.23127f,
-        0.25567f,
-        0.27896f,
-        0.29883f,
-        0.31689f,
-        0.30970f,
-        0.30251f,
-        0.27067f,
-        0.23580f,
-        0.20868f,
-        0.18466f,
-        0.18160f,
-        0.19663f,
-        0.22157f,
-        0.26415f,
-        0.30678f,
-        0.34964f,
-        0.39237f,
-        0.41187f,
-        0.43138f,
-        0.42004f,
-        0.40235f,
-        0.36949f,
-        0.32855f,
-        0.29331f,
-        0.26436f,
-        0.24490f,
-        0.24770f,
-        0.25222f,
-        0.26907f,
-        0.28592f,
-        0.27883f,
-        0.27035f,
-        0.23328f,
-        0.18757f,
-        0.14413f,
-        0.10225f,
-        0.07758f,
-        0.07727f,
-        0.08271f,
-        0.10667f,
-        0.13028f,
-        0.14869f,
-        0.16710f,
-        0.17376f,
-        0.17888f,
-        0.16134f,
-        0.13440f,
-        0.08241f,
-        0.00818f,
-        -0.07001f,
-        -0.15545f,
-        -0.23485f,
-        -0.28599f,
-        -0.33713f,
-        -0.35831f,
-        -0.37946f,
-        -0.39737f,
-        -0.41459f,
-        -0.43648f,
-        -0.46094f,
-        -0.48938f,
-        -0.52234f,
-        -0.55302f,
-        -0.57817f,
-        -0.59880f,
-        -0.58459f,
-        -0.57038f,
-        -0.51238f,
-        -0.45147f,
-        -0.37392f,
-        -0.29115f,
-        -0.20807f,
-        -0.12479f,
-        -0.04356f,
-        0.03469f,
-        0.10981f,
-        0.17447f,
-        0.23755f,
-        0.27259f,
-        0.30763f,
-        0.30905f,
-        0.30575f,
-        0.28011f,
-        0.24488f,
-        0.20173f,
-        0.15134f,
-        0.10301f,
-        0.05858f,
-        0.01818f,
-        -0.00241f,
-        -0.02301f,
-        -0.02195f,
-        -0.02072f,
-        -0.02045f,
-        -0.02041f,
-        -0.03040f,
-        -0.04607f,
-        -0.06317f,
-        -0.08193f,
-        -0.09497f,
-        -0.09362f,
-        -0.08899f,
-        -0.05725f,
-        -0.02551f,
-        0.01785f,
-        0.06207f,
-        0.08547f,
-        0.10207f,
-        0.08929f,
-        0.05498f,
-        0.00916f,
-        -0.05390f,
-        -0.11380f,
-        -0.16271f,
-        -0.20978f,
-        -0.21921f,
-        -0.22863f,
-        -0.20327f,
-        -0.17271f,
-        -0.12880f,
-        -0.07897f,
-        -0.03603f,
-        0.00046f,
-        0.02742f,
-        0.03584f,
-        0.04289f,
-        0.04287f,
-        0.04285f,
-        0.06168f,
-        0.08079f,
-        0.11742f,
-        0.15819f,
-        0.19713f,
-        0.23501f,
-        0.25719f,
-        0.26056f,
-        0.25113f,
-        0.20848f,
-        0.16399f,
-        0.10325f,
-        0.04250f,
-        0.00876f,
-        -0.02276f,
-        -0.02254f,
-        -0.01159f,
-        0.00509f,
-        0.02608f,
-        0.04025f,
-        0.04392f,
-        0.04500f,
-        0.03672f,
-        0.02840f,
-        0.01925f,
-        0.01009f,
-        0.00588f,
-        0.00246f,
-        0.01048f,
-        0.02374f,
-        0.04022f,
-        0.05983f,
-        0.06953f,
-        0.05938f,
-        0.04388f,
-        -0.00067f,
-        -0.04522f,
-        -0.08197f,
-        -0.11854f,
-        -0.12402f,
-        -0.12181f,
-        -0.10007f,
-        -0.06661f,
-        -0.02830f,
-        0.01598f,
-        0.05780f,
-        0.09303f,
-        0.12634f,
-        0.14128f,
-        0.15623f,
-        0.16536f,
-        0.17398f,
-        0.19295f,
-        0.21555f,
-        0.24129f,
-        0.26945f,
-        0.28960f,
-        0.29704f,
-        0.29756f,
-        0.27207f,
-        0.24574f,
-        0.19491f,
-        0.14408f,
-        0.08793f,
-        0.03089f,
-        -0.01679f,
-        -0.06005f,
-        -0.09336f,
-        -0.11681f,
-        -0.13723f,
-        -0.15136f,
-        -0.16586f,
-        -0.18243f,
-        -0.19899f,
-        -0.21742f,
-        -0.23591f,
-        -0.24562f,
-        -0.25307f,
-        -0.24571f,
-        -0.22920f,
-        -0.20456f,
-        -0.16961f,
-        -0.13587f,
-        -0.10551f,
-        -0.07700f,
-        -0.06770f,
-        -0.05840f,
-        -0.06197f,
-        -0.06680f,
-        -0.06851f,
-        -0.06909f,
-        -0.06301f,
-        -0.05162f,
-        -0.03938f,
-        -0.02576f,
-        -0.01487f,
-        -0.01474f,
-        -0.01507f,
-        -0.03255f,
-        -0.05003f,
-        -0.07026f,
-        -0.09099f,
-        -0.10026f,
-        -0.10396f,
-        -0.09834f,
-        -0.08326f,
-        -0.06881f,
-        -0.05569f,
-        -0.04494f,
-        -0.04847f,
-        -0.05201f,
-        -0.06278f,
-        -0.07381f,
-        -0.07894f,
-        -0.08248f,
-        -0.07762f,
-        -0.06744f,
-        -0.04985f,
-        -0.02264f,
-        0.00664f,
-        0.04187f,
-        0.07563f,
-        0.09269f,
-        0.10975f,
-        0.10277f,
-        0.09322f,
-        0.08284f,
-        0.07214f,
-        0.07165f,
-        0.07951f,
-        0.09056f,
-        0.10700f,
-        0.12200f,
-        0.13119f,
-        0.14010f,
-        0.13475f,
-        0.12940f,
-        0.10719f,
-        0.08183f,
-        0.04729f,
-        0.00813f,
-        -0.02576f,
-        -0.05414f,
-        -0.07388f,
-        -0.07454f,
-        -0.07271f,
-        -0.05492f,
-        -0.03713f,
-        -0.01800f,
-        0.00120f,
-        0.01871f,
-        0.03576f,
-        0.05370f,
-        0.07221f,
-        0.09041f,
-        0.10817f,
-        0.12438f,
-        0.13593f,
-        0.14672f,
-        0.14808f,
-        0.14944f,
-        0.13883f,
-        0.12684f,
-        0.10412f,
-        0.07722f,
-        0.04310f,
-        0.00290f,
-        -0.03932f,
-        -0.08503f,
-        -0.12878f,
-        -0.16419f,
-        -0.19932f,
-        -0.21373f,
-        -0.22814f,
-        -0.23272f,
-        -0.23538f,
-        -0.23756f,
-        -0.23948f,
-        -0.23604f,
-        -0.22687f,
-        -0.21086f,
-        -0.17931f,
-        -0.14639f,
-        -0.10409f,
-        -0.06179f,
-        -0.02522f,
-        0.01106f,
-        0.03756f,
-        0.06122f,
-        0.07436f,
-        0.08041f,
-        0.07882f,
-        0.06672f,
-        0.05333f,
-        0.03595f,
-        0.01917f,
-        0.01070f,
-        0.00222f,
-        0.00429f,
-        0.00766f,
-        0.01538f,
-        0.02487f,
-        0.03309f,
-        0.04022f,
-        0.04498f,
-        0.04555f,
-        0.04580f,
-        0.04460f,
-        0.04343f,
-        0.04652f,
-        0.04961f,
-        0.05254f,
-        0.05543f,
-        0.05015f,
-        0.04051f,
-        0.02371f,
-        -0.00100f,
-        -0.02616f,
-        -0.05236f,
-        -0.07737f,
-        -0.09378f,
-        -0.11019f,
-        -0.11796f,
-        -0.12522f,
-        -0.12592f,
-        -0.12464f,
-        -0.11961f,
-        -0.11200f,
-        -0.10596f,
-        -0.10214f,
-        -0.09954f,
-        -0.10084f,
-        -0.10162f,
-        -0.09437f,
-        -0.08711f,
-        -0.06659f,
-        -0.04431f,
-        -0.01692f,
-        0.01260f,
-        0.03873f,
-        0.06184f,
-        0.07721f,
-        0.07836f,
-        0.07540f,
-        0.05322f,
-        0.03103f,
-        0.00887f,
-        -0.01329f,
-        -0.01697f,
-        -0.01665f,
-        -0.00258f,
-        0.01906f,
-        0.04367f,
-        0.07165f,
-        0.09801f,
-        0.12043f,
-        0.14242f,
-        0.16104f,
-        0.17966f,
-        0.20241f,
-        0.22542f,
-        0.24866f,
-        0.27197f,
-        0.28998f,
-        0.30423f,
-        0.31528f,
-        0.32167f,
-        0.32606f,
-        0.32377f,
-        0.32059f,
-        0.30179f,
-        0.28299f,
-        0.25364f,
-        0.22281f,
-        0.19211f,
-        0.16145f,
-        0.13060f,
-        0.09957f,
-        0.06649f,
-        0.02954f,
-        -0.00733f,
-        -0.04376f,
-        -0.08020f,
-        -0.10333f,
-        -0.12635f,
-        -0.13427f,
-        -0.13876f,
-        -0.13450f,
-        -0.12528f,
-        -0.11263f,
-        -0.09599f,
-        -0.07929f,
-        -0.06246f,
-        -0.04661f,
-        -0.03883f,
-        -0.03105f,
-        -0.02955f,
-        -0.02852f,
-        -0.02371f,
-        -0.01767f,
-        -0.00993f,
-        -0.00093f,
-        0.00527f,
-        0.00729f,
-        0.00875f,
-        0.00824f,
-        0.00805f,
-        0.01441f,
-        0.02078f,
-        0.03387f,
-        0.04797f,
-        0.06549f,
-        0.08452f,
-        0.10181f,
-        0.11747f,
-        0.12890f,
-        0.13208f,
-        0.13388f,
-        0.12862f,
-        0.12335f,
-        0.11312f,
-        0.10283f,
-        0.08129f,
-        0.05709f,
-        0.02351f,
-        -0.01554f,
-        -0.05472f,
-        -0.09408f,
-        -0.12941f,
-        -0.15429f,
-        -0.17700f,
-        -0.18039f,
-        -0.18377f,
-        -0.17292f,
-        -0.16090f,
-        -0.14784f,
-        -0.13443f,
-        -0.12423f,
-        -0.11645f,
-        -0.11114f,
-        -0.10964f,
-        -0.10859f,
-        -0.10916f,
-        -0.10940f,
-        -0.10186f,
-        -0.09431f,
-        -0.08410f,
-        -0.07347f,
-        -0.07529f,
-        -0.08281f,
-        -0.09887f,
-        -0.12316f,
-        -0.14547f,
-        -0.16382f,
-        -0.18022f,
-        -0.18598f,
-        -0.19174f,
-        -0.19114f,
-        -0.19041f,
-        -0.18586f,
-        -0.18038f,
-        -0.17264f,
-        -0.16355f,
-        -0.15081f,
-        -0.13355f,
-        -0.11284f,
-        -0.08283f,
-        -0.05297f,
-        -0.02461f,
-        0.00376f,
-        0.01522f,
-        0.02516f,
-        0.02306f,
-        0.01675f,
-        0.00659f,
-        -0.00653f,
-        -0.01830f,
-        -0.02793f,
-        -0.03529f,
-        -0.03417f,
-        -0.03302f,
-        -0.03098f,
-        -0.02893f,
-        -0.03265f,
-        -0.03733f,
-        -0.03705f,
-        -0.03443f,
-        -0.02518f,
-        -0.00937f,
-        0.00640f,
-        0.02210f,
-        0.03695f,
-        0.04690f,
-        0.05685f,
-        0.06079f,
-        0.06456f,
-        0.05905f,
-        0.05115f,
-        0.03806f,
-        0.02176f,
-        0.00591f,
-        -0.00940f,
-        -0.02315f,
-        -0.03255f,
-        -0.04131f,
-        -0.04332f,
-        -0.04533f,
-        -0.04776f,
-        -0.05023f,
-        -0.05914f,
-        -0.07037f,
-        -0.07861f,
-        -0.08447f,
-        -0.08043f,
-        -0.06026f,
-        -0.03582f,
-        0.00537f,
-        0.04641f,
-        0.08214f,
-        0.11786f,
-        0.12866f,
-        0.13505f,
-        0.12745f,
-        0.11305f,
-        0.10836f,
-        0.11355f,
-        0.12655f,
-        0.15625f,
-        0.18260f,
-        0.18875f,
-        0.19490f,
-        0.16581f,
-        0.13546f,
-        0.10259f,
-        0.06904f,
-        0.03370f,
-        -0.00280f,
-        -0.04191f,
-        -0.08442f,
-        -0.11602f,
-        -0.11620f,
-        -0.11191f,
-        -0.05670f,
-        -0.00149f,
-        0.04191f,
-        0.08405f,
-        0.08916f,
-        0.08038f,
-        0.06728f,
-        0.05064f,
-        0.04417f,
-        0.05477f,
-        0.06746f,
-        0.08877f,
-        0.10979f,
-        0.11711f,
-        0.12442f,
-        0.11088f,
-        0.09344f,
-        0.05960f,
-        0.01753f,
-        -0.02476f,
-        -0.06729f,
-        -0.09773f,
-        -0.10153f,
-        -0.10056f,
-        -0.06903f,
-        -0.03750f,
-        -0.03231f,
-        -0.02826f,
-        -0.07340f,
-        -0.13229f,
-        -0.19741f,
-        -0.26659f,
-        -0.30990f,
-        -0.31860f,
-        -0.30837f,
-        -0.24162f,
-        -0.17168f,
-        -0.06202f,
-        0.04764f,
-        0.13666f,
-        0.22331f,
-        0.25174f,
-        0.25756f,
-        0.23457f,
-        0.18736f,
-        0.14896f,
-        0.12577f,
-        0.10878f,
-        0.11829f,
-        0.12761f,
-        0.12272f,
-        0.11783f,
-        0.08909f,
-        0.05568f,
-        0.01304f,
-        -0.03437f,
-        -0.07885f,
-        -0.12018f,
-        -0.14795f,
-        -0.14488f,
-        -0.13443f,
-        -0.07384f,
-        -0.01325f,
-        0.04773f,
-        0.10873f,
-        0.12449f,
-        0.12708f,
-        0.10423f,
-        0.06426f,
-        0.02960f,
-        0.00222f,
-        -0.01508f,
-        -0.00116f,
-        0.01482f,
-        0.05956f,
-        0.10430f,
-        0.14391f,
-        0.18289f,
-        0.19326f,
-        0.19215f,
-        0.17468f,
-        0.14309f,
-        0.11609f,
-        0.09726f,
-        0.08373f,
-        0.09387f,
-        0.10406f,
-        0.12038f,
-        0.13670f,
-        0.13664f,
-        0.13321f,
-        0.10901f,
-        0.07374f,
-        0.03096f,
-        -0.02009f,
-        -0.06275f,
-        -0.08569f,
-        -0.10332f,
-        -0.08256f,
-        -0.06181f,
-        -0.03295f,
-        -0.00362f,
-        0.01073f,
-        0.02056f,
-        0.01863f,
-        0.00856f,
-        -0.00656f,
-        -0.02881f,
-        -0.04800f,
-        -0.05731f,
-        -0.06476f,
-        -0.04326f,
-        -0.02177f,
-        0.00082f,
-        0.02354f,
-        0.02708f,
-        0.02266f,
-        0.01111f,
-        -0.00676f,
-        -0.02525f,
-        -0.04487f,
-        -0.06462f,
-        -0.08500f,
-        -0.10538f,
-        -0.11138f,
-        -0.11737f,
-        -0.11038f,
-        -0.10059f,
-        -0.09401f,
-        -0.08920f,
-        -0.09031f,
-        -0.09816f,
-        -0.10849f,
-        -0.12488f,
-        -0.14148f,
-        -0.15981f,
-        -0.17813f,
-        -0.18350f,
-        -0.18800f,
-        -0.17833f,
-        -0.16420f,
-        -0.14694f,
-        -0.12745f,
-        -0.10914f,
-        -0.09254f,
-        -0.07724f,
-        -0.06632f,
-        -0.05540f,
-        -0.04451f,
-        -0.03363f,
-        -0.01106f,
-        0.01317f,
-        0.03497f,
-        0.05574f,
-        0.05848f,
-        0.04479f,
-        0.02599f,
-        -0.00246f,
-        -0.02784f,
-        -0.03815f,
-        -0.04845f,
-        -0.05679f,
-        -0.06512f,
-        -0.07863f,
-        -0.09331f,
-        -0.09273f,
-        -0.08351f,
-        -0.06389f,
-        -0.03215f,
-        -0.00359f,
-        0.01698f,
-        0.03614f,
-        0.04366f,
-        0.05118f,
-        0.05926f,
-        0.06737f,
-        0.06889f,
-        0.06825f,
-        0.05962f,
-        0.04515f,
-        0.03085f,
-        0.01680f,
-        0.00321f,
-        -0.00884f,
-        -0.02151f,
-        -0.04699f,
-        -0.07248f,
-        -0.10697f,
-        -0.14281f,
-        -0.16692f,
-        -0.18584f,
-        -0.18766f,
-        -0.17345f,
-        -0.15173f,
-        -0.11539f,
-        -0.07886f,
-        -0.04130f,
-        -0.00374f,
-        0.01742f,
-        0.03834f,
-        0.04443f,
-        0.04702f,
-        0.05337f,
-        0.06191f,
-        0.08086f,
-        0.11226f,
-        0.14392f,
-        0.17624f,
-        0.20598f,
-        0.21275f,
-        0.21953f,
-        0.20499f,
-        0.18870f,
-        0.16421f,
-        0.13696f,
-        0.10956f,
-        0.08207f,
-        0.06079f,
-        0.04908f,
-        0.04122f,
-        0.04725f,
-        0.05331f,
-        0.05990f,
-        0.06648f,
-        0.06711f,
-        0.06680f,
-        0.06618f,
-        0.06541f,
-        0.06420f,
-        0.06256f,
-        0.05847f,
-        0.04946f,
-        0.03922f,
-        0.02232f,
-        0.00543f,
-        -0.01271f,
-        -0.03088f,
-        -0.04066f,
-        -0.04836f,
-        -0.04490f,
-        -0.03474f,
-        -0.01992f,
-        0.00062f,
-        0.02042f,
-        0.03821f,
-        0.05524f,
-        0.06488f,
-        0.07452f,
-        0.07682f,
-        0.07846f,
-        0.07691f,
-        0.07424f,
-        0.07176f,
-        0.06943f,
-        0.06489f,
-        0.05685f,
-        0.04613f,
-        0.02533f,
-        0.00454f,
-        -0.01570f,
-        -0.03594f,
-        -0.04307f,
-        -0.04801f,
-        -0.05037f,
-        -0.05153f,
-        -0.05826f,
-        -0.07052f,
-        -0.08430f,
-        -0.10120f,
-        -0.11738f,
-        -0.12944f,
-        -0.14149f,
-        -0.14392f,
-        -0.14607f,
-        -0.13241f,
-        -0.11467f,
-        -0.08685f,
-        -0.05280f,
-        -0.02240f,
-        0.00338f,
-        0.02376f,
-        0.02911f,
-        0.03370f,
-        0.03056f,
-        0.02742f,
-        0.02812f,
-        0.02919f,
-        0.03436f,
-        0.04101f,
-        0.04658f,
-        0.05129f,
-        0.05149f,
-        0.04432f,
-        0.03528f,
-        0.01892f,
-        0.00277f,
-        -0.00551f,
-        -0.01379f,
-        -0.00568f,
-        0.00534f,
-        0.02449f,
-        0.04761f,
-        0.06685f,
-        0.08218f,
-        0.08942f,
-        0.07943f,
-        0.06665f,
-        0.03697f,
-        0.00729f,
-        -0.01511f,
-        -0.03726f,
-        -0.04098f,
-        -0.03975f,
-        -0.03062f,
-        -0.01647f,
-        -0.00382f,
-        0.00688f,
-        0.01432f,
-        0.01236f,
-        0.00921f,
-        -0.00745f,
-        -0.02412f,
-        -0.04365f,
-        -0.06350f,
-        -0.07252f,
-        -0.07748f,
-        -0.07295f,
-        -0.06067f,
-        -0.04710f,
-        -0.03136f,
-        -0.01722f,
-        -0.00957f,
-        -0.00209f,
-        -0.00296f,
-        -0.00384f,
-        -0.00391f,
-        -0.00384f,
-        0.00228f,
-        0.01143f,
-        0.02145f,
-        0.03238f,
-        0.03995f,
-        0.04010f,
-        0.03893f,
-        0.02933f,
-        0.01972f,
-        0.00933f,
-        -0.00110f,
-        -0.00486f,
-        -0.00676f,
-        0.00219f,
-        0.01825f,
-        0.03830f,
-        0.06371f,
-        0.08439f,
-        0.09090f,
-        0.09544f,
-        0.07517f,
-        0.05489f,
-        0.03232f,
-        0.00949f,
-        -0.00177f,
-        -0.00854f,
-        -0.00782f,
-        -0.00082f,
-        0.00699f,
-        0.01620f,
-        0.02280f,
-        0.01826f,
-        0.01346f,
-        -0.01062f,
-        -0.03470f,
-        -0.06160f,
-        -0.08906f,
-        -0.10667f,
-        -0.11919f,
-        -0.12306f,
-        -0.11763f,
-        -0.10892f,
-        -0.09275f,
-        -0.07676f,
-        -0.06199f,
-        -0.04723f,
-        -0.04116f,
-        -0.03554f,
-        -0.03289f,
-        -0.03111f,
-        -0.02938f,
-        -0.02768f,
-        -0.02871f,
-        -0.03349f,
-        -0.03992f,
-        -0.05142f,
-        -0.06284f,
-        -0.07316f,
-        -0.08347f,
-        -0.08734f,
-        -0.09043f,
-        -0.08375f,
-        -0.07314f,
-        -0.05538f,
-        -0.03142f,
-        -0.00846f,
-        0.01273f,
-        0.03163f,
-        0.04028f,
-        0.04891f,
-        0.05481f,
-        0.06071f,
-        0.06840f,
-        0.07647f,
-        0.08051f,
-        0.08241f,
-        0.08084f,
-        0.07544f,
-        0.06932f,
-        0.06149f,
-        0.05327f,
-        0.04220f,
-        0.03112f,
-        0.01934f,
-        0.00751f,
-        0.00130f,
-        -0.00323f,
-        -0.00419f,
-        -0.00268f,
-        -0.00199f,
-        -0.00248f,
-        -0.00365f,
-        -0.00702f,
-        -0.01034f,
-        -0.01275f,
-        -0.01517f,
-        -0.01446f,
-        -0.01335f,
-        -0.00857f,
-        -0.00226f,
-        0.00486f,
-        0.01272f,
-        0.01869f,
-        0.02120f,
-        0.02324f,
-        0.02312f,
-        0.02301f,
-        0.02669f,
-        0.03037f,
-        0.03471f,
-        0.03919f,
-        0.04182f,
-        0.04344f,
-        0.04507f,
-        0.04672f,
-        0.04818f,
-        0.04920f,
-        0.04977f,
-        0.04690f,
-        0.04404f,
-        0.04111f,
-        0.03817f,
-        0.03778f,
-        0.03820f,
-        0.03884f,
-        0.03964f,
-        0.03990f,
-        0.03935f,
-        0.03902f,
-        0.03943f,
-        0.03989f,
-        0.04112f,
-        0.04236f,
-        0.04013f,
-        0.03742f,
-        0.03049f,
-        0.02175f,
-        0.01313f,
-        0.00462f,
-        -0.00189f,
-        -0.00462f,
-        -0.00703f,
-        -0.00794f,
-        -0.00885f,
-        -0.01051f,
-        -0.01217f,
-        -0.01052f,
-        -0.00811f,
-        -0.00207f,
-        0.00602f,
-        0.01504f,
-        0.02514f,
-        0.03470f,
-        0.04289f,
-        0.05020f,
-        0.05022f,
-        0.05024f,
-        0.03943f,
-        0.02781f,
-        0.01278f,
-        -0.00337f,
-        -0.01711f,
-        -0.02908f,
-        -0.03894f,
-        -0.04563f,
-        -0.05179f,
-        -0.05615f,
-        -0.06056f,
-        -0.06599f,
-        -0.07142f,
-        -0.07839f,
-        -0.08558f,
-        -0.09063f,
-        -0.09472f,
-        -0.09483f,
-        -0.09120f,
-        -0.08566f,
-        -0.07639f,
-        -0.06745f,
-        -0.06026f,
-        -0.05306f,
-        -0.05392f,
-        -0.05488f,
-        -0.05875f,
-        -0.06330f,
-        -0.06427f,
-        -0.06316f,
-        -0.05980f,
-        -0.05374f,
-        -0.04786f,
-        -0.04241f,
-        -0.03702f,
-        -0.03203f,
-        -0.02705f,
-        -0.02298f,
-        -0.01899f,
-        -0.01750f,
-        -0.01686f,
-        -0.01674f,
-        -0.01699f,
-        -0.01701f,
-        -0.01664f,
-        -0.01662f,
-        -0.01780f,
-        -0.01897f,
-        -0.01983f,
-        -0.02069f,
-        -0.01922f,
-        -0.01739f,
-        -0.01492f,
-        -0.01216f,
-        -0.00890f,
-        -0.00516f,
-        -0.00076f,
-        0.00494f,
-        0.01046f,
-        0.01499f,
-        0.01951f,
-        0.01981f,
-        0.02001f,
-        0.01556f,
-        0.00997f,
-        0.00113f,
-        -0.00965f,
-        -0.01962f,
-        -0.02861f,
-        -0.03515f,
-        -0.03516f,
-        -0.03448f,
-        -0.02720f,
-        -0.01991f,
-        -0.01076f,
-        -0.00144f,
-        0.00795f,
-        0.01736f,
-        0.02619f,
-        0.03457f,
-        0.04165f,
-        0.04667f,
-        0.05059f,
-        0.05038f,
-        0.05003f,
-        0.04579f,
-        0.04156f,
-        0.03646f,
-        0.03121f,
-        0.02535f,
-        0.01919f,
-        0.01284f,
-        0.00629f,
-        0.00116f,
-        -0.00106f,
-        -0.00252f,
-        0.00034f,
-        0.00319f,
-        0.00610f,
-        0.00900f,
-        0.01096f,
-        0.01267f,
-        0.01435f,
-        0.01602f,
-        0.01701f,
-        0.01716f,
-        0.01711f,
-        0.01651f,
-        0.01601f,
-        0.01649f,
-        0.01698f,
-        0.01726f,
-        0.01753f,
-        0.01877f,
-        0.02036f,
-        0.02420f,
-        0.02981f,
-        0.03539f,
-        0.04091f,
-        0.04534f,
-        0.04547f,
-        0.04546f,
-        0.04027f,
-        0.03507f,
-        0.02762f,
-        0.01977f,
-        0.01352f,
-        0.00806f,
-        0.00608f,
-        0.00766f,
-        0.01064f,
-        0.01662f,
-        0.02229f,
-        0.02605f,
-        0.02982f,
-        0.02799f,
-        0.02595f,
-        0.01948f,
-        0.01182f,
-        0.00319f,
-        -0.00605f,
-        -0.01369f,
-        -0.01924f,
-        -0.02382f,
-        -0.02559f,
-        -0.02737f,
-        -0.02927f,
-        -0.03117f,
-        -0.03474f,
-        -0.03850f,
-        -0.04191f,
-        -0.04520f,
-        -0.04596f,
-        -0.04464f,
-        -0.04147f,
-        -0.03516f,
-        -0.02891f,
-        -0.02290f,
-        -0.01697f,
-        -0.01473f,
-        -0.01249f,
-        -0.01147f,
-        -0.01067f,
-        -0.00886f,
-        -0.00654f,
-        -0.00353f,
-        0.00020f,
-        0.00368f,
-        0.00662f,
-        0.00917f,
-        0.00917f,
-        0.00917f,
-        0.00679f,
-        0.00430f,
-        0.00202f,
-        -0.00021f,
-        -0.00082f,
-        -0.00037f,
-        0.00151f,
-        0.00529f,
-        0.00911f,
-        0.01303f,
-        0.01660f,
-        0.01558f,
-        0.01457f,
-        0.00939f,
-        0.00372f,
-        -0.00124f,
-        -0.00593f,
-        -0.00835f,
-        -0.00888f,
-        -0.00844f,
-        -0.00635f,
-        -0.00434f,
-        -0.00269f,
-        -0.00108f,
-        -0.00176f,
-        -0.00244f,
-        -0.00397f,
-        -0.00568f,
-        -0.00643f,
-        -0.00669f,
-        -0.00610f,
-        -0.00462f,
-        -0.00282f,
-        -0.00032f,
-        0.00222f,
-        0.00493f,
-        0.00765f,
-        0.00875f,
-        0.00977f,
-        0.00897f,
-        0.00764f,
-        0.00648f,
-        0.00544f,
-        0.00556f,
-        0.00728f,
-        0.00944f,
-        0.01294f,
-        0.01639f,
-        0.01909f,
-        0.02178f,
-        0.02238f,
-        0.02271f,
-        0.02123f,
-        0.01902f,
-        0.01582f,
-        0.01177f,
-        0.00780f,
-        0.00398f,
-        0.00061f,
-        -0.00067f,
-        -0.00194f,
-        0.00012f,
-        0.00218f,
-        0.00631f,
-        0.01087f,
-        0.01563f,
-        0.02050f,
-        0.02418f,
-        0.02655f,
-        0.02805f,
-        0.02751f,
-        0.02673f,
-        0.02415f,
-        0.02158f,
-        0.01575f,
-        0.00972f,
-        0.00075f,
-        -0.00910f,
-        -0.01921f,
-        -0.02950f,
-        -0.03903f,
-        -0.04748f,
-        -0.05526f,
-        -0.06091f,
-        -0.06624f,
-        -0.06662f,
-        -0.06700f,
-        -0.06315f,
-        -0.05874f,
-        -0.05348f,
-        -0.04787f,
-        -0.04189f,
-        -0.03560f,
-        -0.02922f,
-        -0.02270f,
-        -0.01667f,
-        -0.01297f,
-        -0.00927f,
-        -0.00694f,
-        -0.00461f,
-        -0.00043f,
-        0.00415f,
-        0.00842f,
-        0.01252f,
-        0.01500f,
-        0.01563f,
-        0.01591f,
-        0.01533f,
-        0.01471f,
-        0.01382f,
-        0.01294f,
-        0.01084f,
-        0.00866f,
-        0.00666f,
-        0.00473f,
-        0.00315f,
-        0.00184f,
-        -0.00010f,
-        -0.00296f,
-        -0.00598f,
-        -0.00955f,
-        -0.01299f,
-        -0.01416f,
-        -0.01533f,
-        -0.01398f,
-        -0.01227f,
-        -0.00969f,
-        -0.00672f,
-        -0.00415f,
-        -0.00194f,
-        -0.00092f,
-        -0.00213f,
-        -0.00398f,
-        -0.00902f,
-        -0.01405f,
-        -0.01891f,
-        -0.02377f,
-        -0.02543f,
-        -0.02635f,
-        -0.02531f,
-        -0.02316f,
-        -0.02075f,
-        -0.01804f,
-        -0.01533f,
-        -0.01261f,
-        -0.00991f,
-        -0.00744f,
-        -0.00497f,
-        -0.00338f,
-        -0.00186f,
-        -0.00082f,
-        0.00007f,
-        0.00120f,
-        0.00251f,
-        0.00443f,
-        0.00724f,
-        0.01042f,
-        0.01485f,
-        0.01930f,
-        0.02396f,
-        0.02861f,
-        0.03317f,
-        0.03772f,
-        0.04248f,
-        0.04733f,
-        0.05081f,
-        0.05300f,
-        0.05342f,
-        0.05039f,
-        0.04707f,
-        0.04229f,
-        0.03751f,
-        0.03438f,
-        0.03127f,
-        0.02933f,
-        0.02766f,
-        0.02751f,
-        0.02823f,
-        0.02944f,
-        0.03125f,
-        0.03180f,
-        0.02912f,
-        0.02608f,
-        0.01999f,
-        0.01389f,
-        0.01085f,
-        0.00806f,
-        0.00726f,
-        0.00712f,
-        0.00602f,
-        0.00420f,
-        0.00240f,
-        0.00063f,
-        -0.00073f,
-        -0.00058f,
-        -0.00047f,
-        -0.00144f,
-        -0.00241f,
-        -0.00545f,
-        -0.00883f,
-        -0.01159f,
-        -0.01407f,
-        -0.01470f,
-        -0.01354f,
-        -0.01144f,
-        -0.00744f,
-        -0.00342f,
-        0.00073f,
-        0.00487f,
-        0.00685f,
-        0.00878f,
-        0.00888f,
-        0.00853f,
-        0.00793f,
-        0.00717f,
-        0.00681f,
-        0.00694f,
-        0.00719f,
-        0.00780f,
-        0.00836f,
-        0.00861f,
-        0.00886f,
-        0.00880f,
-        0.00872f,
-        0.00851f,
-        0.00825f,
-        0.00755f,
-        0.00650f,
-        0.00503f,
-        0.00287f,
-        0.00083f,
-        -0.00078f,
-        -0.00229f,
-        -0.00072f,
-        0.00084f,
-        0.00433f,
-        0.00815f,
-        0.00982f,
-        0.01047f,
-        0.00854f,
-        0.00403f,
-        -0.00064f,
-        -0.00565f,
-        -0.01023f,
-        -0.01229f,
-        -0.01435f,
-        -0.01460f,
-        -0.01480f,
-        -0.01449f,
-        -0.01404f,
-        -0.01365f,
-        -0.01329f,
-        -0.01327f,
-        -0.01367f,
-        -0.01406f,
-        -0.01439f,
-        -0.01463f,
-        -0.01388f,
-        -0.01313f,
-        -0.01185f,
-        -0.01052f,
-        -0.00995f,
-        -0.00966f,
-        -0.01063f,
-        -0.01261f,
-        -0.01482f,
-        -0.01741f,
-        -0.01938f,
-        -0.01895f,
-        -0.01844f,
-        -0.01486f,
-        -0.01128f,
-        -0.00753f,
-        -0.00376f,
-        -0.00074f,
-        0.00191f,
-        0.00352f,
-        0.00407f,
-        0.00368f,
-        0.00130f,
-        -0.00109f,
-        -0.00349f,
-        -0.00589f,
-        -0.00502f,
-        -0.00404f,
-        -0.00156f,
-        0.00133f,
-        0.00324f,
-        0.00454f,
-        0.00478f,
-        0.00364f,
-        0.00253f,
-        0.00150f,
-        0.00070f,
-        0.00244f,
-        0.00417f,
-        0.00645f,
-        0.00879f,
-        0.00889f,
-        0.00814f,
-        0.00647f,
-        0.00405f,
-        0.00198f,
-        0.00050f,
-        -0.00103f,
-        -0.00275f,
-        -0.00449f,
-        -0.00716f,
-        -0.00983f,
-        -0.01228f,
-        -0.01469f,
-        -0.01690f,
-        -0.01903f,
-        -0.02089f,
-        -0.02250f,
-        -0.02354f,
-        -0.02334f,
-        -0.02289f,
-        -0.02080f,
-        -0.01872f,
-        -0.01567f,
-        -0.01258f,
-        -0.00976f,
-        -0.00702f,
-        -0.00532f,
-        -0.00432f,
-        -0.00381f,
-        -0.00393f,
-        -0.00395f,
-        -0.00362f,
-        -0.00321f,
-        -0.00168f,
-        -0.00015f,
-        0.00332f,
-        0.00702f,
-        0.01148f,
-        0.01625f,
-        0.01948f,
-        0.02141f,
-        0.02201f,
-        0.02028f,
-        0.01831f,
-        0.01532f,
-        0.01231f,
-        0.00872f,
-        0.00512f,
-        0.00181f,
-        -0.00144f,
-        -0.00316f,
-        -0.00407f,
-        -0.00431f,
-        -0.00381f,
-        -0.00341f,
-        -0.00322f,
-        -0.00300f,
-        -0.00262f,
-        -0.00224f,
-        -0.00176f,
-        -0.00127f,
-        -0.00115f,
-        -0.00114f,
-        -0.00118f,
-        -0.00126f,
-        -0.00169f,
-        -0.00261f,
-        -0.00391f,
-        -0.00639f,
-        -0.00883f,
-        -0.01058f,
-        -0.01233f,
-        -0.01189f,
-        -0.01119f,
-        -0.00977f,
-        -0.00807f,
-        -0.00648f,
-        -0.00500f,
-        -0.00363f,
-        -0.00244f,
-        -0.00131f,
-        -0.00041f,
-        0.00050f,
-        0.00205f,
-        0.00360f,
-        0.00630f,
-        0.00922f,
-        0.01208f,
-        0.01489f,
-        0.01681f,
-        0.01775f,
-        0.01841f,
-        0.01842f,
-        0.01855f,
-        0.01948f,
-        0.02040f,
-        0.02114f,
-        0.02187f,
-        0.02085f,
-        0.01930f,
-        0.01690f,
-        0.01390f,
-        0.01117f,
-        0.00880f,
-        0.00676f,
-        0.00581f,
-        0.00495f,
-        0.00549f,
-        0.00603f,
-        0.00704f,
-        0.00811f,
-        0.00816f,
-        0.00779f,
-        0.00619f,
-        0.00350f,
-        0.00019f,
-        -0.00426f,
-        -0.00865f,
-        -0.01273f,
-        -0.01681f,
-        -0.01717f,
-        -0.01753f,
-        -0.01511f,
-        -0.01210f,
-        -0.00970f,
-        -0.00763f,
-        -0.00663f,
-        -0.00684f,
-        -0.00710f,
-        -0.00749f,
-        -0.00781f,
-        -0.00764f,
-        -0.00747f,
-        -0.00633f,
-        -0.00512f,
-        -0.00298f,
-        -0.00055f,
-        0.00126f,
-        0.00262f,
-        0.00327f,
-        0.00286f,
-        0.00261f,
-        0.00287f,
-        0.00315f,
-        0.00398f,
-        0.00480f,
-        0.00464f,
-        0.00435f,
-        0.00406f,
-        0.00377f,
-        0.00393f,
-        0.00450f,
-        0.00492f,
-        0.00505f,
-        0.00506f,
-        0.00448f,
-        0.00389f,
-        0.00301f,
-        0.00212f,
-        0.00069f,
-        -0.00086f,
-        -0.00241f,
-        -0.00397f,
-        -0.00500f,
-        -0.00540f,
-        -0.00561f,
-        -0.00534f,
-        -0.00515f,
-        -0.00562f,
-        -0.00609f,
-        -0.00771f,
-        -0.00941f,
-        -0.01114f,
-        -0.01288f,
-        -0.01369f,
-        -0.01382f,
-        -0.01345f,
-        -0.01234f,
-        -0.01131f,
-        -0.01055f,
-        -0.00980f,
-        -0.00909f,
-        -0.00838f,
-        -0.00710f,
-        -0.00573f,
-        -0.00485f,
-        -0.00417f,
-        -0.00406f,
-        -0.00446f,
-        -0.00449f,
-        -0.00383f,
-        -0.00293f,
-        -0.00082f,
-        0.00128f,
-        0.00246f,
-        0.00364f,
-        0.00340f,
-        0.00283f,
-        0.00164f,
-        0.00009f,
-        -0.00195f,
-        -0.00459f,
-        -0.00732f,
-        -0.01031f,
-        -0.01311f,
-        -0.01424f,
-        -0.01536f,
-        -0.01433f,
-        -0.01312f,
-        -0.01105f,
-        -0.00868f,
-        -0.00606f,
-        -0.00323f,
-        -0.00061f,
-        0.00167f,
-        0.00362f,
-        0.00438f,
-        0.00512f,
-        0.00531f,
-        0.00549f,
-        0.00578f,
-        0.00608f,
-        0.00586f,
-        0.00540f,
-        0.00456f,
-        0.00337f,
-        0.00223f,
-        0.00121f,
-        0.00028f,
-        -0.00016f,
-        -0.00061f,
-        0.00002f,
-        0.00068f,
-        0.00217f,
-        0.00386f,
-        0.00510f,
-        0.00608f,
-        0.00625f,
-        0.00543f,
-        0.00434f,
-        0.00252f,
-        0.00073f,
-        -0.00073f,
-        -0.00219f,
-        -0.00213f,
-        -0.00193f,
-        -0.00097f,
-        0.00025f,
-        0.00059f,
-        0.00024f,
-        -0.00071f,
-        -0.00262f,
-        -0.00428f,
-        -0.00499f,
-        -0.00564f,
-        -0.00453f,
-        -0.00341f,
-        -0.00195f,
-        -0.00044f,
-        0.00085f,
-        0.00203f,
-        0.00300f,
-        0.00378f,
-        0.00455f,
-        0.00532f,
-        0.00614f,
-        0.00724f,
-        0.00833f,
-        0.00915f,
-        0.00996f,
-        0.01018f,
-        0.01025f,
-        0.00994f,
-        0.00941f,
-        0.00837f,
-        0.00668f,
-        0.00479f,
-        0.00231f,
-        -0.00008f,
-        -0.00156f,
-        -0.00305f,
-        -0.00362f,
-        -0.00409f,
-        -0.00468f,
-        -0.00530f,
-        -0.00562f,
-        -0.00571f,
-        -0.00535f,
-        -0.00429f,
-        -0.00321f,
-        -0.00207f,
-        -0.00095f,
-        -0.00014f,
-        0.00067f,
-        0.00164f,
-        0.00263f,
-        0.00365f,
-        0.00468f,
-        0.00566f,
-        0.00659f,
-        0.00745f,
-        0.00814f,
-        0.00868f,
-        0.00825f,
-        0.00782f,
-        0.00644f,
-        0.00503f,
-        0.00403f,
-        0.00314f,
-        0.00272f,
-        0.00259f,
-        0.00227f,
-        0.00173f,
-        0.00106f,
-        0.00003f,
-        -0.00098f,
-        -0.00190f,
-        -0.00282f,
-        -0.00382f,
-        -0.00482f,
-        -0.00597f,
-        -0.00718f,
-        -0.00810f,
-        -0.00878f,
-        -0.00915f,
-        -0.00900f,
-        -0.00875f,
-        -0.00816f,
-        -0.00756f,
-        -0.00670f,
-        -0.00585f,
-        -0.00458f,
-        -0.00324f,
-        -0.00140f,
-        0.00068f,
-        0.00293f,
-        0.00533f,
-        0.00743f,
-        0.00885f,
-        0.01007f,
-        0.01000f,
-        0.00993f,
-        0.00917f,
-        0.00838f,
-        0.00727f,
-        0.00607f,
-        0.00479f,
-        0.00347f,
-        0.00251f,
-        0.00201f,
-        0.00160f,
-        0.00142f,
-        0.00117f,
-        0.00002f,
-        -0.00113f,
-        -0.00235f,
-        -0.00359f,
-        -0.00409f,
-        -0.00431f,
-        -0.00455f,
-        -0.00481f,
-        -0.00517f,
-        -0.00572f,
-        -0.00609f,
-        -0.00571f,
-        -0.00532f,
-        -0.00412f,
-        -0.00291f,
-        -0.00181f,
-        -0.00074f,
-        -0.00002f,
-        0.00052f,
-        0.00068f,
-        0.00043f,
-        0.00009f,
-        -0.00048f,
-        -0.00094f,
-        -0.00074f,
-        -0.00054f,
-        0.00035f,
-        0.00127f,
-        0.00228f,
-        0.00331f,
-        0.00437f,
-        0.00544f,
-        0.00637f,
-        0.00711f,
-        0.00763f,
-        0.00746f,
-        0.00725f,
-        0.00653f,
-        0.00580f,
-        0.00496f,
-        0.00410f,
-        0.00323f,
-        0.00235f,
-        0.00168f,
-        0.00117f,
-        0.00073f,
-        0.00039f,
-        -0.00006f,
-        -0.00096f,
-        -0.00187f,
-        -0.00320f,
-        -0.00452f,
-        -0.00562f,
-        -0.00667f,
-        -0.00749f,
-        -0.00819f,
-        -0.00869f,
-        -0.00897f,
-        -0.00893f,
-        -0.00816f,
-        -0.00727f,
-        -0.00551f,
-        -0.00374f,
-        -0.00196f,
-        -0.00018f,
-        0.00098f,
-        0.00195f,
-        0.00237f,
-        0.00240f,
-        0.00216f,
-        0.00152f,
-        0.00091f,
-        0.00035f,
-        -0.00015f,
-        0.00019f,
-        0.00053f,
-        0.00134f,
-        0.00221f,
-        0.00276f,
-        0.00316f,
-        0.00330f,
-        0.00320f,
-        0.00303f,
-        0.00273f,
-        0.00239f,
-        0.00190f,
-        0.00140f,
-        0.00117f,
-        0.00093f,
-        0.00118f,
-        0.00153f,
-        0.00192f,
-        0.00233f,
-        0.00262f,
-        0.00278f,
-        0.00288f,
-        0.00286f,
-        0.00279f,
-        0.00234f,
-        0.00189f,
-        0.00117f,
-        0.00044f,
-        -0.00019f,
-        -0.00080f,
-        -0.00134f,
-        -0.00184f,
-        -0.00227f,
-        -0.00260f,
-        -0.00279f,
-        -0.00255f,
-        -0.00229f,
-        -0.00165f,
-        -0.00102f,
-        -0.00040f,
-        0.00022f,
-        0.00077f,
-        0.00129f,
-        0.00159f,
-        0.00168f,
-        0.00157f,
-        0.00108f,
-        0.00060f,
-        0.00012f,
-        -0.00036f,
-        -0.00039f,
-        -0.00041f,
-        -0.00015f,
-        0.00019f,
-        0.00058f,
-        0.00100f,
-        0.00136f,
-        0.00165f,
-        0.00195f,
-        0.00230f,
-        0.00269f,
-        0.00335f,
-        0.00401f,
-        0.00457f,
-        0.00512f,
-        0.00536f,
-        0.00550f,
-        0.00546f,
-        0.00529f,
-        0.00491f,
-        0.00420f,
-        0.00339f,
-        0.00223f,
-        0.00109f,
-        0.00045f,
-        -0.00019f,
-        -0.00013f,
-        0.00003f,
-        0.00012f,
-        0.00017f,
-        -0.00009f,
-        -0.00065f,
-        -0.00120f,
-        -0.00176f,
-        -0.00221f,
-        -0.00209f,
-        -0.00197f,
-        -0.00114f,
-        -0.00030f,
-        0.00061f,
-        0.00155f,
-        0.00220f,
-        0.00268f,
-        0.00294f,
-        0.00290f,
-        0.00272f,
-        0.00215f,
-        0.00155f,
-        0.00068f,
-        -0.00019f,
-        -0.00080f,
-        -0.00137f,
-        -0.00167f,
-        -0.00188f,
-        -0.00220f,
-        -0.00259f,
-        -0.00310f,
-        -0.00380f,
-        -0.00448f,
-        -0.00506f,
-        -0.00562f,
-        -0.00574f,
-        -0.00585f,
-        -0.00554f,
-        -0.00515f,
-        -0.00468f,
-        -0.00418f,
-        -0.00378f,
-        -0.00349f,
-        -0.00323f,
-        -0.00306f,
-        -0.00286f,
-        -0.00256f,
-        -0.00226f,
-        -0.00178f,
-        -0.00130f,
-        -0.00078f,
-        -0.00026f,
-        0.00005f,
-        0.00022f,
-        0.00011f,
-        -0.00033f,
-        -0.00081f,
-        -0.00142f,
-        -0.00198f,
-        -0.00215f,
-        -0.00233f,
-        -0.00212f,
-        -0.00187f,
-        -0.00151f,
-        -0.00110f,
-        -0.00065f,
-        -0.00018f,
-        0.00027f,
-        0.00070f,
-        0.00105f,
-        0.00115f,
-        0.00124f,
-        0.00086f,
-        0.00047f,
-        -0.00018f,
-        -0.00088f,
-        -0.00150f,
-        -0.00208f,
-        -0.00252f,
-        -0.00283f,
-        -0.00311f,
-        -0.00332f,
-        -0.00354f,
-        -0.00378f,
-        -0.00402f,
-        -0.00419f,
-        -0.00436f,
-        -0.00432f,
-        -0.00423f,
-        -0.00391f,
-        -0.00347f,
-        -0.00292f,
-        -0.00225f,
-        -0.00159f,
-        -0.00098f,
-        -0.00039f,
-        -0.00008f,
-        0.00023f,
-        0.00039f,
-        0.00053f,
-        0.00071f,
-        0.00090f,
-        0.00099f,
-        0.00100f,
-        0.00090f,
-        0.00063f,
-        0.00041f,
-        0.00040f,
-        0.00040f,
-        0.00086f,
-        0.00132f,
-        0.00085f,
-        0.00021f};
 } // namespace
 
 std::span<const CSAMPLE> clickForSampleRate(mixxx::audio::SampleRate size) {
@@ -3,6 +3,7 @@
 #include "effects/backends/effectmanifest.h"
 #include "engine/effects/engineeffectparameter.h"
 #include "util/math.h"
+#include "util/rampingvalue.h"
 
 namespace {
 constexpr unsigned int updateCoef = 32;
@@ -164,13 +165,13 @@ void PhaserEffect::processChannel(
 
     CSAMPLE left = 0, right = 0;
 
-    CSAMPLE_GAIN oldDepth = pState->oldDepth;
-    const CSAMPLE_GAIN depthDelta = (depth - oldDepth) / engineParameters.framesPerBuffer();
-    const CSAMPLE_GAIN depthStart = oldDepth + depthDelta;
+    const RampingValue<CSAMPLE_GAIN> depthRamped(
+            pState->oldDepth, depth, engineParameters.framesPerBuffer());
 
     const auto stereoCheck = static_cast<int>(m_pStereoParameter->value());
     int counter = 0;
 
+    int rampIndex = 0;
     for (SINT i = 0;
             i < engineParameters.samplesPerBuffer();
             i += engineParameters.channelCount()) {
@@ -204,7 +205,8 @@ void PhaserEffect::processChannel(
         left = processSample(left, oldInLeft, oldOutLeft, filterCoefLeft, stages);
         right = processSample(right, oldInRight, oldOutRight, filterCoefRight, stages);
 
-        const CSAMPLE_GAIN depth = depthStart + depthDelta * (i / engineParameters.channelCount());
+        const CSAMPLE_GAIN depth = depthRamped.getNth(rampIndex);
+        ++rampIndex;
 
         // Computing output combining the original and processed sample
         pOutput[i] = pInput[i] * (1.0f - 0.5f * depth) + left * depth * 0.5f;
@@ -169,6 +169,15 @@ void TremoloEffect::processChannel(
             m_pPhaseParameter->value() * framePerPeriod);
     currentFrame = currentFrame % framePerPeriod;
 
+    // Hoist the parts of the position and gain formulas that do not depend
+    // on the frame out of the loop, most notably the atan() normalization
+    // of the smoothing parameter.
+    const double invFramePerPeriod = 1.0 / framePerPeriod;
+    const double positionScaleBelowWidth = 0.5 / width;
+    const double positionScaleAboveWidth = 0.5 / (1 - width);
+    const double gainOffset = 1.0 - (depth / 2.0);
+    const double gainScale = depth / (2 * atan(1 / smooth));
+
     for (SINT i = 0;
             i < engineParameters.samplesPerBuffer();
             i += engineParameters.channelCount()) {
@@ -176,24 +185,22 @@ void TremoloEffect::processChannel(
         positionFrame = positionFrame % framePerPeriod;
 
         //  Relative position (0 to 1) in the period
-        double position = static_cast<double>(positionFrame) / framePerPeriod;
+        double position = static_cast<double>(positionFrame) * invFramePerPeriod;
 
         //  Bend the position according to the width parameter
         //  This maps [0 width] to [0 0.5] and [width 1] to [0.5 1]
         if (position < width) {
-            position = 0.5 / width * position;
+            position = positionScaleBelowWidth * position;
         } else {
-            position = 0.5 + 0.5 * (position - width) / (1 - width);
+            position = 0.5 + positionScaleAboveWidth * (position - width);
         }
 
         //  This is where the magic happens
         //  This function gives the gain to apply for position in [0 1]
         //  Plot the function to get a grasp :
         //  From a sine to a square wave depending on the smooth parameter
-        double gainTarget = 1.0 - (depth / 2.0) +
-                (atan(sin(2.0 * M_PI * position) / smooth) /
-                        (2 * atan(1 / smooth))) *
-                        depth;
+        double gainTarget = gainOffset +
+                atan(sin(2.0 * M_PI * position) / smooth) * gainScale;
 
         if (gainTarget > gain + kMaxGainIncrement) {
             gain += kMaxGainIncrement;
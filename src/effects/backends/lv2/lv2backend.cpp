@@ -2,25 +2,206 @@
 
 #include <lv2/units/units.h>
 
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QStandardPaths>
+
 #include "effects/backends/lv2/lv2effectprocessor.h"
 #include "effects/backends/lv2/lv2manifest.h"
 
-LV2Backend::LV2Backend() {
-    m_pWorld = lilv_world_new();
-    initializeProperties();
-    lilv_world_load_all(m_pWorld);
-    enumeratePlugins();
+namespace {
+
+// Manifest cache file format:
+//   magic, version
+//   list of (bundle path, manifest mtime) pairs of all installed bundles
+//   number of manifests, followed by the serialized manifests
+// The bundle stamp list is the cache key: if it differs from the current
+// plugin installation in any way, the cache is discarded and a full lilv
+// scan runs as before.
+constexpr quint32 kManifestCacheMagic = 0x4C56324D; // "LV2M"
+constexpr quint32 kManifestCacheVersion = 1;
+
+QString manifestCacheFilePath() {
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) +
+            QStringLiteral("/lv2manifests.cache");
+}
+
+// Directories lilv searches for plugin bundles, mirroring its built-in
+// defaults for the case that LV2_PATH is not set.
+QStringList lv2SearchPaths() {
+    const QString lv2Path = qEnvironmentVariable("LV2_PATH");
+    if (!lv2Path.isEmpty()) {
+        return lv2Path.split(QDir::listSeparator(), Qt::SkipEmptyParts);
+    }
+    QStringList paths;
+#if defined(Q_OS_MACOS)
+    paths << QDir::homePath() + QStringLiteral("/Library/Audio/Plug-Ins/LV2")
+          << QStringLiteral("/Library/Audio/Plug-Ins/LV2")
+          << QStringLiteral("/usr/local/lib/lv2")
+          << QStringLiteral("/usr/lib/lv2");
+#elif defined(Q_OS_WIN)
+    paths << qEnvironmentVariable("APPDATA") + QStringLiteral("/LV2")
+          << qEnvironmentVariable("COMMONPROGRAMFILES") + QStringLiteral("/LV2");
+#else
+    paths << QDir::homePath() + QStringLiteral("/.lv2")
+          << QStringLiteral("/usr/local/lib/lv2")
+          << QStringLiteral("/usr/lib/lv2");
+#endif
+    return paths;
+}
+
+// One (bundle path, manifest.ttl mtime) entry per installed plugin
+// bundle. Scanning these is a handful of directory listings and orders
+// of magnitude cheaper than loading the lilv world.
+QList<QPair<QString, qint64>> scanBundleStamps() {
+    QList<QPair<QString, qint64>> stamps;
+    const QStringList searchPaths = lv2SearchPaths();
+    for (const QString& searchPath : searchPaths) {
+        const auto bundles = QDir(searchPath).entryInfoList(
+                QDir::Dirs | QDir::NoDotAndDotDot, QDir::Name);
+        for (const QFileInfo& bundle : bundles) {
+            const QFileInfo manifest(
+                    bundle.absoluteFilePath() + QStringLiteral("/manifest.ttl"));
+            const qint64 mtime = manifest.exists()
+                    ? manifest.lastModified().toMSecsSinceEpoch()
+                    : bundle.lastModified().toMSecsSinceEpoch();
+            stamps.append({bundle.absoluteFilePath(), mtime});
+        }
+    }
+    return stamps;
+}
+
+void writeManifest(QDataStream& out, const EffectManifestPointer& pManifest) {
+    out << pManifest->id()
+        << pManifest->name()
+        << pManifest->shortName()
+        << pManifest->author()
+        << pManifest->version()
+        << pManifest->description()
+        << pManifest->effectRampsFromDry()
+        << pManifest->addDryToWet()
+        << pManifest->metaknobDefault();
+    out << static_cast<quint32>(pManifest->parameters().size());
+    const auto parameters = pManifest->parameters();
+    for (const EffectManifestParameterPointer& pParameter : parameters) {
+        out << pParameter->id()
+            << pParameter->name()
+            << pParameter->shortName()
+            << pParameter->description()
+            << static_cast<qint32>(pParameter->index())
+            << static_cast<qint32>(pParameter->valueScaler())
+            << static_cast<qint32>(pParameter->unitsHint())
+            << static_cast<qint32>(pParameter->defaultLinkType())
+            << static_cast<qint32>(pParameter->defaultLinkInversion())
+            << pParameter->neutralPointOnScale()
+            << pParameter->getMinimum()
+            << pParameter->getDefault()
+            << pParameter->getMaximum()
+            << pParameter->getSteps();
+    }
+}
+
+EffectManifestPointer readManifest(QDataStream& in) {
+    auto pManifest = EffectManifestPointer::create();
+    QString id;
+    QString name;
+    QString shortName;
+    QString author;
+    QString version;
+    QString description;
+    bool effectRampsFromDry = false;
+    bool addDryToWet = false;
+    double metaknobDefault = 0.0;
+    in >> id >> name >> shortName >> author >> version >> description >>
+            effectRampsFromDry >> addDryToWet >> metaknobDefault;
+    pManifest->setId(id);
+    pManifest->setName(name);
+    pManifest->setShortName(shortName);
+    pManifest->setAuthor(author);
+    pManifest->setVersion(version);
+    pManifest->setDescription(description);
+    pManifest->setEffectRampsFromDry(effectRampsFromDry);
+    pManifest->setAddDryToWet(addDryToWet);
+    pManifest->setMetaknobDefault(metaknobDefault);
+
+    quint32 numParameters = 0;
+    in >> numParameters;
+    for (quint32 i = 0; i < numParameters && in.status() == QDataStream::Ok; ++i) {
+        EffectManifestParameterPointer pParameter = pManifest->addParameter();
+        qint32 index = 0;
+        qint32 valueScaler = 0;
+        qint32 unitsHint = 0;
+        qint32 linkType = 0;
+        qint32 linkInversion = 0;
+        double neutralPointOnScale = 0.0;
+        double minimum = 0.0;
+        double defaultValue = 0.0;
+        double maximum = 0.0;
+        QList<QPair<QString, double>> steps;
+        in >> id >> name >> shortName >> description >> index >> valueScaler >>
+                unitsHint >> linkType >> linkInversion >> neutralPointOnScale >>
+                minimum >> defaultValue >> maximum >> steps;
+        pParameter->setId(id);
+        pParameter->setName(name);
+        pParameter->setShortName(shortName);
+        pParameter->setDescription(description);
+        pParameter->setIndex(index);
+        pParameter->setValueScaler(
+                static_cast<EffectManifestParameter::ValueScaler>(valueScaler));
+        pParameter->setUnitsHint(
+                static_cast<EffectManifestParameter::UnitsHint>(unitsHint));
+        pParameter->setDefaultLinkType(
+                static_cast<EffectManifestParameter::LinkType>(linkType));
+        pParameter->setDefaultLinkInversion(
+                static_cast<EffectManifestParameter::LinkInversion>(linkInversion));
+        pParameter->setNeutralPointOnScale(neutralPointOnScale);
+        pParameter->setRange(minimum, defaultValue, maximum);
+        for (const auto& step : std::as_const(steps)) {
+            pParameter->appendStep(step);
+        }
+    }
+    return pManifest;
+}
+
+} // anonymous namespace
+
+LV2Backend::LV2Backend()
+        : m_pWorld(nullptr) {
+    if (!loadManifestCache()) {
+        // No usable cache; discover the plugins now and build one.
+        ensureWorldLoaded();
+    }
 }
 
 LV2Backend::~LV2Backend() {
     for (LilvNode* node : std::as_const(m_properties)) {
         lilv_node_free(node);
     }
-    lilv_world_free(m_pWorld);
+    if (m_pWorld) {
+        lilv_world_free(m_pWorld);
+    }
     m_registeredEffects.clear();
 }
 
-void LV2Backend::enumeratePlugins() {
+void LV2Backend::ensureWorldLoaded() const {
+    if (m_pWorld) {
+        return;
+    }
+    m_pWorld = lilv_world_new();
+    initializeProperties();
+    lilv_world_load_all(m_pWorld);
+    enumeratePlugins();
+    if (m_cachedManifests.isEmpty()) {
+        // Fresh scan after a cache miss; remember the result so the next
+        // start can skip the scan.
+        saveManifestCache();
+    }
+}
+
+void LV2Backend::enumeratePlugins() const {
     const LilvPlugins* plugs = lilv_world_get_all_plugins(m_pWorld);
     LILV_FOREACH(plugins, i, plugs) {
         const LilvPlugin* plug = lilv_plugins_get(plugs, i);
@@ -33,7 +214,7 @@ void LV2Backend::enumeratePlugins() {
     }
 }
 
-void LV2Backend::initializeProperties() {
+void LV2Backend::initializeProperties() const {
     m_properties["audio_port"] = lilv_new_uri(m_pWorld, LV2_CORE__AudioPort);
     m_properties["input_port"] = lilv_new_uri(m_pWorld, LV2_CORE__InputPort);
     m_properties["output_port"] = lilv_new_uri(m_pWorld, LV2_CORE__OutputPort);
@@ -46,7 +227,86 @@ void LV2Backend::initializeProperties() {
     m_properties["unit_symbol"] = lilv_new_uri(m_pWorld, LV2_UNITS__symbol);
 }
 
+bool LV2Backend::loadManifestCache() {
+    QFile file(manifestCacheFilePath());
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_6_0);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    in >> magic >> version;
+    if (magic != kManifestCacheMagic || version != kManifestCacheVersion) {
+        return false;
+    }
+
+    QList<QPair<QString, qint64>> cachedStamps;
+    in >> cachedStamps;
+    if (in.status() != QDataStream::Ok || cachedStamps != scanBundleStamps()) {
+        // Plugins were installed, removed or updated since the cache was
+        // written; a full rescan is needed.
+        return false;
+    }
+
+    quint32 numManifests = 0;
+    in >> numManifests;
+    QHash<QString, EffectManifestPointer> manifests;
+    for (quint32 i = 0; i < numManifests; ++i) {
+        EffectManifestPointer pManifest = readManifest(in);
+        if (in.status() != QDataStream::Ok) {
+            return false;
+        }
+        pManifest->setBackendType(getType());
+        manifests.insert(pManifest->id(), pManifest);
+    }
+
+    m_cachedManifests = manifests;
+    qDebug() << "LV2Backend: restored" << m_cachedManifests.size()
+             << "effect manifests from cache, deferring plugin scan";
+    return true;
+}
+
+void LV2Backend::saveManifestCache() const {
+    const QString filePath = manifestCacheFilePath();
+    QDir().mkpath(QFileInfo(filePath).absolutePath());
+    const QString tmpFilePath = filePath + QStringLiteral(".tmp");
+    QFile file(tmpFilePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "LV2Backend: could not write manifest cache"
+                   << tmpFilePath << file.errorString();
+        return;
+    }
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_6_0);
+    out << kManifestCacheMagic << kManifestCacheVersion;
+    out << scanBundleStamps();
+
+    QList<LV2EffectManifestPointer> validManifests;
+    for (const auto& pManifest : std::as_const(m_registeredEffects)) {
+        if (pManifest->isValid()) {
+            validManifests.append(pManifest);
+        }
+    }
+    out << static_cast<quint32>(validManifests.size());
+    for (const auto& pManifest : std::as_const(validManifests)) {
+        writeManifest(out, pManifest);
+    }
+    file.close();
+
+    QFile::remove(filePath);
+    if (!file.rename(filePath)) {
+        qWarning() << "LV2Backend: could not rename manifest cache"
+                   << tmpFilePath << "to" << filePath;
+        file.remove();
+    }
+}
+
 const QList<QString> LV2Backend::getEffectIds() const {
+    if (!m_cachedManifests.isEmpty()) {
+        return m_cachedManifests.keys();
+    }
     QList<QString> availableEffects;
     for (const auto& lv2Manifest : std::as_const(m_registeredEffects)) {
         if (lv2Manifest->isValid()) {
@@ -58,6 +318,16 @@ const QList<QString> LV2Backend::getEffectIds() const {
 
 const QSet<QString> LV2Backend::getDiscoveredPluginIds() const {
     QSet<QString> pluginIds;
+    if (!m_cachedManifests.isEmpty()) {
+        // The cache only stores valid effects; invalid plugins are
+        // rediscovered by the next full scan.
+        for (auto it = m_cachedManifests.constBegin();
+                it != m_cachedManifests.constEnd();
+                ++it) {
+            pluginIds.insert(it.key());
+        }
+        return pluginIds;
+    }
     for (auto it = m_registeredEffects.constBegin();
             it != m_registeredEffects.constEnd();
             ++it) {
@@ -67,6 +337,9 @@ const QSet<QString> LV2Backend::getDiscoveredPluginIds() const {
 }
 
 bool LV2Backend::canInstantiateEffect(const QString& effectId) const {
+    if (!m_cachedManifests.isEmpty()) {
+        return m_cachedManifests.contains(effectId);
+    }
     if (m_registeredEffects.contains(effectId) &&
             m_registeredEffects[effectId]->isValid()) {
         return true;
@@ -75,11 +348,20 @@ bool LV2Backend::canInstantiateEffect(const QString& effectId) const {
 }
 
 EffectManifestPointer LV2Backend::getManifest(const QString& effectId) const {
+    if (!m_cachedManifests.isEmpty()) {
+        return m_cachedManifests.value(effectId);
+    }
     return m_registeredEffects.value(effectId);
 }
 
 const QList<EffectManifestPointer> LV2Backend::getManifests() const {
     QList<EffectManifestPointer> list;
+    if (!m_cachedManifests.isEmpty()) {
+        for (const auto& manifest : m_cachedManifests) {
+            list.append(manifest);
+        }
+        return list;
+    }
     for (const auto& manifest : m_registeredEffects) {
         list.append(manifest);
     }
@@ -88,6 +370,9 @@ const QList<EffectManifestPointer> LV2Backend::getManifests() const {
 
 std::unique_ptr<EffectProcessor> LV2Backend::createProcessor(
         const EffectManifestPointer pManifest) const {
+    // Instantiation needs the live lilv plugin; load the world now if
+    // startup was served from the manifest cache.
+    ensureWorldLoaded();
     LV2EffectManifestPointer pLV2Manifest = m_registeredEffects.value(pManifest->id());
     VERIFY_OR_DEBUG_ASSERT(pLV2Manifest) {
         return nullptr;
@@ -96,5 +381,6 @@ std::unique_ptr<EffectProcessor> LV2Backend::createProcessor(
 }
 
 LV2EffectManifestPointer LV2Backend::getLV2Manifest(const QString& effectId) const {
+    ensureWorldLoaded();
     return m_registeredEffects[effectId];
 }
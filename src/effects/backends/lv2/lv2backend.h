@@ -26,11 +26,32 @@ class LV2Backend : public EffectsBackend {
     bool canInstantiateEffect(const QString& effectId) const;
 
   private:
-    void enumeratePlugins();
-    void initializeProperties();
-    LilvWorld* m_pWorld;
-    QHash<QString, LilvNode*> m_properties;
-    QHash<QString, LV2EffectManifestPointer> m_registeredEffects;
+    // Loads the lilv world and enumerates all installed plugins. This is
+    // the expensive part of LV2 discovery (it can take seconds with a
+    // large plugin collection), so when the manifest cache is valid it is
+    // deferred until an LV2 effect is actually instantiated.
+    void ensureWorldLoaded() const;
+    void enumeratePlugins() const;
+    void initializeProperties() const;
+
+    // Binary cache of the discovered manifests, keyed by the modification
+    // times of the installed plugin bundles. See lv2backend.cpp for the
+    // file format.
+    bool loadManifestCache();
+    void saveManifestCache() const;
+
+    // Lazily initialized by ensureWorldLoaded(), hence mutable; the
+    // accessors of this backend are const.
+    mutable LilvWorld* m_pWorld;
+    mutable QHash<QString, LilvNode*> m_properties;
+    mutable QHash<QString, LV2EffectManifestPointer> m_registeredEffects;
+
+    // Manifests restored from the cache. When non-empty, these are served
+    // by the manifest accessors for the whole session (preserving pointer
+    // identity for consumers that collected them at startup) and the lilv
+    // world is only loaded for instantiating effects. Only valid
+    // (instantiable) effects are cached.
+    QHash<QString, EffectManifestPointer> m_cachedManifests;
 
     QString debugString() const {
         return "LV2Backend";
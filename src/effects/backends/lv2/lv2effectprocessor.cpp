@@ -67,6 +67,10 @@ void LV2EffectProcessor::processChannel(
 
     lilv_instance_run(instance, framesPerBuffer);
 
+    // Deliver results of background work scheduled via the LV2 worker
+    // extension and close the run cycle.
+    channelState->worker()->finishRun();
+
     // note: LOOP VECTORIZED.
     for (SINT i = 0; i < framesPerBuffer; ++i) {
         pOutput[i * 2] = m_outputL[i];
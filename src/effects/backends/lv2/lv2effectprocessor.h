@@ -4,6 +4,7 @@
 
 #include "effects/backends/effectprocessor.h"
 #include "effects/backends/lv2/lv2manifest.h"
+#include "effects/backends/lv2/lv2worker.h"
 #include "effects/defs.h"
 #include "engine/engine.h"
 
@@ -12,10 +13,13 @@ class LV2EffectGroupState final : public EffectState {
   public:
     LV2EffectGroupState(const mixxx::EngineParameters& engineParameters)
             : EffectState(engineParameters),
-              m_pInstance(nullptr) {
+              m_pInstance(nullptr),
+              m_pWorker(std::make_unique<LV2Worker>()) {
     }
 
     ~LV2EffectGroupState() override {
+        // The worker thread must not outlive the plugin instance it services.
+        m_pWorker->stop();
         if (m_pInstance) {
             lilv_instance_deactivate(m_pInstance);
             lilv_instance_free(m_pInstance);
@@ -25,14 +29,26 @@ class LV2EffectGroupState final : public EffectState {
     LilvInstance* lilvInstance(const LilvPlugin* pPlugin,
             const mixxx::EngineParameters& engineParameters) {
         if (!m_pInstance) {
-            m_pInstance = lilv_plugin_instantiate(
-                    pPlugin, engineParameters.sampleRate(), nullptr);
+            // Offer the worker schedule feature so plugins that depend on it
+            // (e.g. convolution reverbs loading impulse responses) can
+            // instantiate and run their background work off the audio thread.
+            m_pInstance = lilv_plugin_instantiate(pPlugin,
+                    engineParameters.sampleRate(),
+                    m_pWorker->features());
+            if (m_pInstance) {
+                m_pWorker->attach(m_pInstance);
+            }
         }
         return m_pInstance;
     }
 
+    LV2Worker* worker() const {
+        return m_pWorker.get();
+    }
+
   private:
     LilvInstance* m_pInstance;
+    std::unique_ptr<LV2Worker> m_pWorker;
 };
 
 class LV2EffectProcessor final : public EffectProcessorImpl<LV2EffectGroupState> {
@@ -1,5 +1,7 @@
 #include "effects/backends/lv2/lv2manifest.h"
 
+#include <lv2/lv2plug.in/ns/ext/worker/worker.h>
+
 #include "effects/backends/effectmanifestparameter.h"
 #include "util/fpclassify.h"
 
@@ -180,12 +182,19 @@ LV2Manifest::LV2Manifest(LilvWorld* world,
         m_status = IO_NOT_STEREO;
     }
 
-    // We don't support any features
+    // The only host feature we provide is the worker extension's schedule
+    // feature (serviced by LV2Worker); plugins requiring anything beyond
+    // that cannot run in our host.
+    LilvNode* workerSchedule = lilv_new_uri(world, LV2_WORKER__schedule);
     LilvNodes* features = lilv_plugin_get_required_features(m_pLV2plugin);
-    if (lilv_nodes_size(features) > 0) {
-        m_status = HAS_REQUIRED_FEATURES;
+    LILV_FOREACH(nodes, iterator, features) {
+        const LilvNode* feature = lilv_nodes_get(features, iterator);
+        if (!lilv_node_equals(feature, workerSchedule)) {
+            m_status = HAS_REQUIRED_FEATURES;
+        }
     }
     lilv_nodes_free(features);
+    lilv_node_free(workerSchedule);
 }
 
 QList<int> LV2Manifest::getAudioPortIndices() {
@@ -0,0 +1,146 @@
+#include "effects/backends/lv2/lv2worker.h"
+
+#include <QVarLengthArray>
+#include <cstring>
+
+#include "moc_lv2worker.cpp"
+#include "util/assert.h"
+
+namespace {
+
+// Capacity of the request and response FIFOs in bytes. Worker payloads are
+// typically tiny (file paths, atom messages), 8 KiB matches what standalone
+// LV2 hosts provision per instance.
+constexpr int kFifoSize = 8192;
+
+} // anonymous namespace
+
+LV2Worker::LV2Worker()
+        : m_pInstance(nullptr),
+          m_pInterface(nullptr),
+          m_requests(kFifoSize),
+          m_responses(kFifoSize),
+          m_bQuit(false) {
+    m_schedule.handle = this;
+    m_schedule.schedule_work = &LV2Worker::scheduleWork;
+    m_feature.URI = LV2_WORKER__schedule;
+    m_feature.data = &m_schedule;
+    m_features[0] = &m_feature;
+    m_features[1] = nullptr;
+}
+
+LV2Worker::~LV2Worker() {
+    stop();
+}
+
+void LV2Worker::attach(LilvInstance* pInstance) {
+    VERIFY_OR_DEBUG_ASSERT(pInstance) {
+        return;
+    }
+    DEBUG_ASSERT(!m_pInstance);
+    m_pInterface = static_cast<const LV2_Worker_Interface*>(
+            lilv_instance_get_extension_data(pInstance, LV2_WORKER__interface));
+    if (!m_pInterface) {
+        // Plugin does not use the worker extension; the schedule feature we
+        // passed at instantiation stays unused and no thread is needed.
+        return;
+    }
+    m_pInstance = pInstance;
+    start(QThread::NormalPriority);
+}
+
+void LV2Worker::stop() {
+    if (!isRunning()) {
+        return;
+    }
+    m_bQuit.store(true);
+    m_workAvailable.release();
+    wait();
+}
+
+void LV2Worker::finishRun() {
+    if (!m_pInterface) {
+        return;
+    }
+    // Deliver the results of completed background work to the plugin in the
+    // realtime context, as the extension specifies.
+    uint32_t size;
+    while (m_responses.read(reinterpret_cast<char*>(&size), sizeof(size)) ==
+            sizeof(size)) {
+        char payload[kFifoSize];
+        DEBUG_ASSERT(size <= sizeof(payload));
+        const int read = m_responses.read(payload, static_cast<int>(size));
+        VERIFY_OR_DEBUG_ASSERT(read == static_cast<int>(size)) {
+            return;
+        }
+        if (m_pInterface->work_response) {
+            m_pInterface->work_response(
+                    lilv_instance_get_handle(m_pInstance), size, payload);
+        }
+    }
+    if (m_pInterface->end_run) {
+        m_pInterface->end_run(lilv_instance_get_handle(m_pInstance));
+    }
+}
+
+void LV2Worker::run() {
+    while (true) {
+        m_workAvailable.acquire();
+        if (m_bQuit.load()) {
+            return;
+        }
+        uint32_t size;
+        while (m_requests.read(reinterpret_cast<char*>(&size), sizeof(size)) ==
+                sizeof(size)) {
+            QVarLengthArray<char, 4096> payload(static_cast<int>(size));
+            const int read = m_requests.read(payload.data(), static_cast<int>(size));
+            VERIFY_OR_DEBUG_ASSERT(read == static_cast<int>(size)) {
+                return;
+            }
+            m_pInterface->work(lilv_instance_get_handle(m_pInstance),
+                    &LV2Worker::respond,
+                    this,
+                    size,
+                    payload.constData());
+        }
+    }
+}
+
+namespace {
+
+// Writes a [uint32 size][payload] record with a single FIFO write, so the
+// reader on the other thread never observes a header whose payload has not
+// been published yet.
+LV2_Worker_Status writeRecord(FIFO<char>* pFifo, uint32_t size, const void* data) {
+    char record[kFifoSize];
+    if (sizeof(size) + size > sizeof(record) ||
+            pFifo->writeAvailable() < static_cast<int>(sizeof(size) + size)) {
+        return LV2_WORKER_ERR_NO_SPACE;
+    }
+    memcpy(record, &size, sizeof(size));
+    memcpy(record + sizeof(size), data, size);
+    pFifo->write(record, static_cast<int>(sizeof(size) + size));
+    return LV2_WORKER_SUCCESS;
+}
+
+} // anonymous namespace
+
+// static
+LV2_Worker_Status LV2Worker::scheduleWork(
+        LV2_Worker_Schedule_Handle handle, uint32_t size, const void* data) {
+    // Called by the plugin from the audio thread during run(); only copies
+    // into the lock-free FIFO and wakes the worker thread.
+    LV2Worker* pWorker = static_cast<LV2Worker*>(handle);
+    const LV2_Worker_Status status = writeRecord(&pWorker->m_requests, size, data);
+    if (status == LV2_WORKER_SUCCESS) {
+        pWorker->m_workAvailable.release();
+    }
+    return status;
+}
+
+// static
+LV2_Worker_Status LV2Worker::respond(
+        LV2_Worker_Respond_Handle handle, uint32_t size, const void* data) {
+    LV2Worker* pWorker = static_cast<LV2Worker*>(handle);
+    return writeRecord(&pWorker->m_responses, size, data);
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <lilv/lilv.h>
+#include <lv2/lv2plug.in/ns/ext/worker/worker.h>
+
+#include <QSemaphore>
+#include <QThread>
+#include <atomic>
+
+#include "util/fifo.h"
+
+/// LV2Worker services the LV2 worker extension
+/// (http://lv2plug.in/ns/ext/worker) for one plugin instance. Plugins use the
+/// extension to move non-realtime work (loading impulse responses, file I/O,
+/// heavy reallocation) out of the audio callback: they call schedule_work()
+/// from run(), the work() method is executed on this thread, and the result is
+/// handed back to the plugin inside the next audio callback via
+/// work_response().
+///
+/// Requests and responses are passed through lock-free byte FIFOs as
+/// [uint32 size][payload] records, so the audio thread never blocks or
+/// allocates. One LV2Worker exists per LilvInstance, i.e. per
+/// LV2EffectGroupState, matching how standalone LV2 hosts like jalv map
+/// workers to instances.
+class LV2Worker : public QThread {
+    Q_OBJECT
+  public:
+    LV2Worker();
+    ~LV2Worker() override;
+
+    /// Feature array to pass to lilv_plugin_instantiate; terminated with
+    /// nullptr and valid for the lifetime of this object.
+    const LV2_Feature* const* features() const {
+        return m_features;
+    }
+
+    /// Queries the instantiated plugin for the worker interface and starts
+    /// the worker thread if the plugin provides it. Must be called from the
+    /// main thread before the instance is first run.
+    void attach(LilvInstance* pInstance);
+
+    /// Delivers completed work responses to the plugin and notifies it that
+    /// the run cycle is over. Called in the audio thread directly after
+    /// lilv_instance_run; no-op for plugins without the worker interface.
+    void finishRun();
+
+    /// Stops and joins the worker thread. Must be called before the plugin
+    /// instance is deactivated and freed.
+    void stop();
+
+  protected:
+    void run() override;
+
+  private:
+    static LV2_Worker_Status scheduleWork(
+            LV2_Worker_Schedule_Handle handle, uint32_t size, const void* data);
+    static LV2_Worker_Status respond(
+            LV2_Worker_Respond_Handle handle, uint32_t size, const void* data);
+
+    LilvInstance* m_pInstance;
+    const LV2_Worker_Interface* m_pInterface;
+    LV2_Worker_Schedule m_schedule;
+    LV2_Feature m_feature;
+    const LV2_Feature* m_features[2];
+
+    FIFO<char> m_requests;
+    FIFO<char> m_responses;
+    QSemaphore m_workAvailable;
+    std::atomic<bool> m_bQuit;
+};
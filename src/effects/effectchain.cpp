@@ -160,7 +160,7 @@ void EffectChain::addToEngine() {
             m_group,
             m_pEffectsManager->registeredInputChannels(),
             m_pEffectsManager->registeredOutputChannels());
-    EffectsRequest* pRequest = new EffectsRequest();
+    EffectsRequest* pRequest = m_pMessenger->acquireRequest();
     pRequest->type = EffectsRequest::ADD_EFFECT_CHAIN;
     pRequest->AddEffectChain.signalProcessingStage = m_signalProcessingStage;
     pRequest->AddEffectChain.pChain = m_pEngineEffectChain;
@@ -178,7 +178,7 @@ void EffectChain::removeFromEngine() {
         return;
     }
 
-    EffectsRequest* pRequest = new EffectsRequest();
+    EffectsRequest* pRequest = m_pMessenger->acquireRequest();
     pRequest->type = EffectsRequest::REMOVE_EFFECT_CHAIN;
     pRequest->RemoveEffectChain.signalProcessingStage = m_signalProcessingStage;
     pRequest->RemoveEffectChain.pChain = m_pEngineEffectChain;
@@ -237,7 +237,7 @@ void EffectChain::loadEmptyNamelessPreset() {
 }
 
 void EffectChain::sendParameterUpdate() {
-    EffectsRequest* pRequest = new EffectsRequest();
+    EffectsRequest* pRequest = m_pMessenger->acquireRequest();
     pRequest->type = EffectsRequest::SET_EFFECT_CHAIN_PARAMETERS;
     pRequest->pTargetChain = m_pEngineEffectChain;
     pRequest->SetEffectChainParameters.enabled = m_pControlChainEnabled->toBool();
@@ -403,7 +403,7 @@ void EffectChain::enableForInputChannel(const ChannelHandleAndGroup& handleGroup
         return;
     }
 
-    EffectsRequest* request = new EffectsRequest();
+    EffectsRequest* request = m_pMessenger->acquireRequest();
     request->type = EffectsRequest::ENABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL;
     request->pTargetChain = m_pEngineEffectChain;
     request->EnableInputChannelForChain.channelHandle = handleGroup.handle();
@@ -425,7 +425,7 @@ void EffectChain::disableForInputChannel(const ChannelHandleAndGroup& handleGrou
         return;
     }
 
-    EffectsRequest* request = new EffectsRequest();
+    EffectsRequest* request = m_pMessenger->acquireRequest();
     request->type = EffectsRequest::DISABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL;
     request->pTargetChain = m_pEngineEffectChain;
     request->DisableInputChannelForChain.channelHandle = handleGroup.handle();
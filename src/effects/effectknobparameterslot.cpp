@@ -42,6 +42,14 @@ EffectKnobParameterSlot::EffectKnobParameterSlot(
             &ControlObject::valueChanged,
             this,
             &EffectKnobParameterSlot::slotLinkInverseChanged);
+
+    // Automation span for subsequent value changes in beats of the processed
+    // channel. Controller scripts can schedule e.g. a filter sweep over the
+    // next 8 beats by setting this control once and then setting the target
+    // value, instead of stepping the parameter from a script timer.
+    m_pControlRampBeats = std::make_unique<ControlObject>(
+            ConfigKey(m_group, itemPrefix + QString("_ramp_beats")));
+
     clear();
 }
 
@@ -94,9 +102,22 @@ void EffectKnobParameterSlot::clear() {
             static_cast<double>(EffectManifestParameter::LinkType::None));
     m_metaknobSoftTakeover.setThreshold(SoftTakeover::kDefaultTakeoverThreshold);
     m_pControlLinkInverse->set(0.0);
+    m_pControlRampBeats->set(0.0);
     emit updated();
 }
 
+void EffectKnobParameterSlot::slotValueChanged(double v) {
+    if (m_pEffectParameter) {
+        const double rampBeats = m_pControlRampBeats->get();
+        if (rampBeats > 0) {
+            m_pEffectParameter->setValueRamped(v, rampBeats);
+        } else {
+            m_pEffectParameter->setValue(v);
+        }
+        emit valueChanged(v);
+    }
+}
+
 void EffectKnobParameterSlot::setParameter(double value) {
     m_pControlValue->setParameterFrom(value, this);
 }
@@ -39,6 +39,11 @@ class EffectKnobParameterSlot : public EffectParameterSlotBase {
 
     void setParameter(double value) override;
 
+  public slots:
+    // Shadows EffectParameterSlotBase::slotValueChanged to apply the
+    // "parameterX_ramp_beats" control, see the constructor.
+    void slotValueChanged(double v);
+
   private slots:
     // Solely for handling control changes
     void slotLinkTypeChanging(double v);
@@ -55,6 +60,9 @@ class EffectKnobParameterSlot : public EffectParameterSlotBase {
     std::unique_ptr<ControlEffectKnob> m_pControlValue;
     std::unique_ptr<ControlPushButton> m_pControlLinkType;
     std::unique_ptr<ControlPushButton> m_pControlLinkInverse;
+    // While > 0, value changes are ramped by the engine over this many
+    // beats of the processed channel instead of jumping.
+    std::unique_ptr<ControlObject> m_pControlRampBeats;
 
     DISALLOW_COPY_AND_ASSIGN(EffectKnobParameterSlot);
 };
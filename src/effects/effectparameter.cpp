@@ -64,11 +64,31 @@ void EffectParameter::setValue(double value) {
     updateEngineState();
 }
 
+void EffectParameter::setValueRamped(double value, double beatSpan) {
+    // TODO(XXX) Handle inf, -inf, and nan
+    m_value = value;
+
+    if (clampValue()) {
+        qWarning() << debugString() << "WARNING: Value was outside of limits, clamped.";
+    }
+
+    if (!m_pEngineEffect) {
+        return;
+    }
+    EffectsRequest* pRequest = m_pMessenger->acquireRequest();
+    pRequest->type = EffectsRequest::SET_PARAMETER_RAMP;
+    pRequest->pTargetEffect = m_pEngineEffect;
+    pRequest->SetParameterRamp.iParameter = m_pParameterManifest->index();
+    pRequest->SetParameterRamp.beatSpan = beatSpan;
+    pRequest->value = m_value;
+    m_pMessenger->writeRequest(pRequest);
+}
+
 void EffectParameter::updateEngineState() {
     if (!m_pEngineEffect) {
         return;
     }
-    EffectsRequest* pRequest = new EffectsRequest();
+    EffectsRequest* pRequest = m_pMessenger->acquireRequest();
     pRequest->type = EffectsRequest::SET_PARAMETER_PARAMETERS;
     pRequest->pTargetEffect = m_pEngineEffect;
     pRequest->SetParameterParameters.iParameter = m_pParameterManifest->index();
@@ -43,6 +43,10 @@ class EffectParameter {
 
     double getValue() const;
     void setValue(double value);
+    /// Like setValue(), but the engine interpolates from the current value to
+    /// the new value over beatSpan beats of the processed channel instead of
+    /// jumping. The main thread state converges to the target immediately.
+    void setValueRamped(double value, double beatSpan);
 
     void updateEngineState();
 
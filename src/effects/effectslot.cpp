@@ -149,13 +149,14 @@ void EffectSlot::addToEngine() {
     }
 
     m_pEngineEffect = new EngineEffect(
+            m_group,
             m_pManifest,
             m_pBackendManager,
             m_pChain->getActiveChannels(),
             m_pEffectsManager->registeredInputChannels(),
             m_pEffectsManager->registeredOutputChannels());
 
-    EffectsRequest* request = new EffectsRequest();
+    EffectsRequest* request = m_pMessenger->acquireRequest();
     request->type = EffectsRequest::ADD_EFFECT_TO_CHAIN;
     request->pTargetChain = m_pEngineEffectChain;
     request->AddEffectToChain.pEffect = m_pEngineEffect;
@@ -168,7 +169,7 @@ void EffectSlot::removeFromEngine() {
         return;
     }
 
-    EffectsRequest* request = new EffectsRequest();
+    EffectsRequest* request = m_pMessenger->acquireRequest();
     request->type = EffectsRequest::REMOVE_EFFECT_FROM_CHAIN;
     request->pTargetChain = m_pEngineEffectChain;
     request->RemoveEffectFromChain.pEffect = m_pEngineEffect;
@@ -183,7 +184,7 @@ void EffectSlot::updateEngineState() {
         return;
     }
 
-    EffectsRequest* pRequest = new EffectsRequest();
+    EffectsRequest* pRequest = m_pMessenger->acquireRequest();
     pRequest->type = EffectsRequest::SET_EFFECT_PARAMETERS;
     pRequest->pTargetEffect = m_pEngineEffect;
     pRequest->SetEffectParameters.enabled = m_pControlEnabled->toBool();
@@ -4,17 +4,56 @@
 #include "engine/effects/engineeffectchain.h"
 #include "util/make_const_iterator.h"
 
+namespace {
+// Number of preallocated EffectsRequest slots. Sweeping a knob produces one
+// request per control change, but each one is recycled as soon as the engine's
+// response arrives, so only requests awaiting a response occupy a slot. The
+// pool covers loading a full chain preset with room to spare; should it ever
+// run dry, acquireRequest() falls back to the heap.
+constexpr int kRequestPoolSize = 256;
+} // anonymous namespace
+
 EffectsMessenger::EffectsMessenger(
         EffectsRequestPipe&& requestPipe)
         : m_requestPipe(std::move(requestPipe)),
           m_nextRequestId(0),
-          m_bShuttingDown(false) {
+          m_bShuttingDown(false),
+          m_requestPool(kRequestPoolSize) {
+    m_freeRequests.reserve(kRequestPoolSize);
+    for (auto& request : m_requestPool) {
+        m_freeRequests.push_back(&request);
+    }
 }
 
 EffectsMessenger::~EffectsMessenger() {
     for (auto it = m_activeRequests.begin(); it != m_activeRequests.end(); it++) {
-        delete it.value();
+        recycleRequest(it.value());
+    }
+}
+
+EffectsRequest* EffectsMessenger::acquireRequest() {
+    if (m_freeRequests.empty()) {
+        // More requests in flight than pool slots; this only happens for
+        // unusually large bursts. The extra request is deleted again by
+        // recycleRequest.
+        return new EffectsRequest();
+    }
+    EffectsRequest* pRequest = m_freeRequests.back();
+    m_freeRequests.pop_back();
+    return pRequest;
+}
+
+void EffectsMessenger::recycleRequest(EffectsRequest* pRequest) {
+    if (pRequest < m_requestPool.data() ||
+            pRequest >= m_requestPool.data() + m_requestPool.size()) {
+        // Heap fallback allocated by acquireRequest when the pool was empty.
+        delete pRequest;
+        return;
     }
+    // Reset the slot so the next acquireRequest hands out a request in the
+    // same state as a freshly constructed one.
+    *pRequest = EffectsRequest();
+    m_freeRequests.push_back(pRequest);
 }
 
 void EffectsMessenger::initiateShutdown() {
@@ -33,12 +72,11 @@ bool EffectsMessenger::writeRequest(EffectsRequest* request) {
     processEffectsResponses();
 
     request->request_id = m_nextRequestId++;
-    // TODO(XXX) use preallocated requests to avoid delete calls from engine
     if (m_requestPipe.writeMessage(request)) {
         m_activeRequests[request->request_id] = request;
         return true;
     }
-    delete request;
+    recycleRequest(request);
     return false;
 }
 
@@ -63,7 +101,7 @@ void EffectsMessenger::processEffectsResponses() {
 
             collectGarbage(pRequest);
 
-            delete pRequest;
+            recycleRequest(pRequest);
             it = constErase(&m_activeRequests, it);
         }
     }
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <vector>
+
 #include "engine/effects/message.h"
 
 /// EffectsMessenger sends EffectsRequests from the main thread and receives
-/// EffectsResponses from the audio thread. This allows memory allocation and
-/// deallocation on the heap, which is slow, to be done in the main thread to
-/// avoid blocking the audio thread and causing audible glitches. All of
+/// EffectsResponses from the audio thread. Requests are recycled through a
+/// preallocated pool, so memory allocation and deallocation on the heap, which
+/// is slow, is avoided both in the audio thread, where it would cause audible
+/// glitches, and in the main thread during parameter sweeps. All of
 /// EffectsMessenger's methods are called on the main thread.
 /// Refer to
 /// http://www.rossbencina.com/code/real-time-audio-programming-101-time-waits-for-nothing
@@ -17,8 +20,12 @@ class EffectsMessenger {
     // passing by rvalue-ref because we want to ensure we're the only on with access to that pipe
     EffectsMessenger(EffectsRequestPipe&& requestPipe);
     ~EffectsMessenger();
+    /// Returns a default-initialized EffectsRequest from the preallocated
+    /// pool, or a heap-allocated one if the pool is exhausted. The caller
+    /// fills it in and passes it back to writeRequest.
+    EffectsRequest* acquireRequest();
     /// Write an EffectsRequest to the EngineEffectsManager. EffectsMessenger takes
-    /// ownership of request and deletes it once a response is received.
+    /// ownership of request and recycles it once a response is received.
     bool writeRequest(EffectsRequest* request);
 
     void initiateShutdown();
@@ -26,6 +33,9 @@ class EffectsMessenger {
 
   private:
     void collectGarbage(const EffectsRequest* pRequest);
+    /// Returns a request to the pool, or deletes it if it was heap-allocated
+    /// because the pool was exhausted when it was acquired.
+    void recycleRequest(EffectsRequest* pRequest);
 
     QString debugString() const {
         return "EffectsMessenger";
@@ -35,4 +45,10 @@ class EffectsMessenger {
     EffectsRequestPipe m_requestPipe;
     qint64 m_nextRequestId;
     bool m_bShuttingDown;
+
+    /// Fixed storage backing the request pool. Never resized after
+    /// construction, so pointers into it stay valid for the lifetime of the
+    /// messenger.
+    std::vector<EffectsRequest> m_requestPool;
+    std::vector<EffectsRequest*> m_freeRequests;
 };
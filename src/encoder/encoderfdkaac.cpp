@@ -7,6 +7,7 @@
 #include <QStandardPaths>
 #include <QString>
 #include <QStringList>
+#include <algorithm>
 
 #include "encoder/encodercallback.h"
 #include "engine/sidechain/enginesidechain.h"
@@ -347,7 +348,9 @@ int EncoderFdkAac::initEncoder(mixxx::audio::SampleRate sampleRate, QString* pUs
     }
     m_pInputFifo = new FIFO<SAMPLE>(EngineSideChain::SIDECHAIN_BUFFER_SIZE * 2);
 
-    m_pFifoChunkBuffer.resize(m_readRequired * sizeof(SAMPLE));
+    // Only needed for the wrap-around case in processFIFO, where a frame
+    // spans the end of the ring buffer and has to be made contiguous.
+    m_pFifoChunkBuffer.resize(m_readRequired);
     return 0;
 }
 
@@ -387,7 +390,24 @@ void EncoderFdkAac::processFIFO() {
     }
 
     while (m_pInputFifo->readAvailable() >= m_readRequired) {
-        m_pInputFifo->read(m_pFifoChunkBuffer.data(), m_readRequired);
+        // Encode directly out of the FIFO when the frame is contiguous in
+        // the ring buffer. Only a frame that spans the buffer end has to
+        // be copied into the chunk buffer first.
+        SAMPLE* dataPtr1;
+        ring_buffer_size_t size1;
+        SAMPLE* dataPtr2;
+        ring_buffer_size_t size2;
+        // We checked readAvailable above, so the full frame is acquired
+        (void)m_pInputFifo->aquireReadRegions(
+                m_readRequired, &dataPtr1, &size1, &dataPtr2, &size2);
+        SAMPLE* pFrame;
+        if (size1 >= m_readRequired) {
+            pFrame = dataPtr1;
+        } else {
+            std::copy(dataPtr1, dataPtr1 + size1, m_pFifoChunkBuffer.data());
+            std::copy(dataPtr2, dataPtr2 + size2, m_pFifoChunkBuffer.data() + size1);
+            pFrame = m_pFifoChunkBuffer.data();
+        }
 
         // fdk-aac only accept pointers for most buffer settings.
         // Declare settings here and point to them below.
@@ -402,7 +422,7 @@ void EncoderFdkAac::processFIFO() {
         // Input Buffer
         AACENC_BufDesc inputBuf;
         inputBuf.numBufs = 1;
-        void* chunkBuffer[] = {m_pFifoChunkBuffer.data()};
+        void* chunkBuffer[] = {pFrame};
         inputBuf.bufs = chunkBuffer;
         inputBuf.bufSizes = &inDataSize;
         inputBuf.bufElSizes = &inSampleSize;
@@ -425,6 +445,7 @@ void EncoderFdkAac::processFIFO() {
         AACENC_OutArgs outputDesc;
 
         int result = aacEncEncode(m_aacEnc, &inputBuf, &outputBuf, &inputDesc, &outputDesc);
+        m_pInputFifo->releaseReadRegions(m_readRequired);
         if (result != AACENC_OK) {
             kLogger.warning() << "aacEncEncode failed! error code:" << result;
             return;
@@ -9,6 +9,7 @@
 #include "encoder/encoderopussettings.h"
 #include "engine/sidechain/enginesidechain.h"
 #include "util/logger.h"
+#include "util/sample.h"
 #include "util/samplebuffer.h"
 
 namespace {
@@ -391,16 +392,34 @@ void EncoderOpus::encodeBuffer(const CSAMPLE* samples, const std::size_t bufferS
 
 void EncoderOpus::processFIFO() {
     while (m_fifoBuffer.readAvailable() >= m_readRequired) {
-        m_fifoBuffer.read(m_pFifoChunkBuffer->data(), m_readRequired);
-
         if ((m_readRequired % m_channels) != 0) {
             kLogger.warning() << "processFIFO: channel count doesn't match chunk size";
         }
 
+        // Encode directly out of the FIFO when the frame is contiguous in
+        // the ring buffer. Only a frame that spans the buffer end has to
+        // be copied into the chunk buffer first.
+        CSAMPLE* pData1;
+        ring_buffer_size_t size1;
+        CSAMPLE* pData2;
+        ring_buffer_size_t size2;
+        // We checked readAvailable above, so the full frame is acquired
+        (void)m_fifoBuffer.aquireReadRegions(
+                m_readRequired, &pData1, &size1, &pData2, &size2);
+        const CSAMPLE* pFrame;
+        if (size1 >= m_readRequired) {
+            pFrame = pData1;
+        } else {
+            SampleUtil::copy(m_pFifoChunkBuffer->data(), pData1, size1);
+            SampleUtil::copy(m_pFifoChunkBuffer->data() + size1, pData2, size2);
+            pFrame = m_pFifoChunkBuffer->data();
+        }
+
         int samplesPerChannel = m_readRequired / m_channels;
         int result = opus_encode_float(m_pOpus,
-                m_pFifoChunkBuffer->data(), samplesPerChannel,
+                pFrame, samplesPerChannel,
                 m_opusDataBuffer.data(), kMaxOpusBufferSize);
+        m_fifoBuffer.releaseReadRegions(m_readRequired);
 
         if (result < 1) {
             kLogger.warning() << "opus_encode_float failed:" << opusErrorString(result);
@@ -45,7 +45,13 @@ void EngineBufferScaleLinear::clear() {
     // Clear out buffer and saved sample data
     m_bufferIntSize = 0;
     m_dNextFrame = 0;
-    onSignalChanged();
+    // Zero the cached boundary samples in place. clear() runs on the engine
+    // thread on every scaler switch, e.g. at the start and end of each
+    // scratch gesture with keylock enabled, so it must not reallocate the
+    // buffers like onSignalChanged() does.
+    m_floorSampleOld.clear();
+    m_floorSample.clear();
+    m_ceilSample.clear();
 }
 
 // laurent de soras - punked from musicdsp.org (mad props)
@@ -183,8 +189,40 @@ SINT EngineBufferScaleLinear::do_copy(CSAMPLE* buf, SINT buf_size) {
     return read_samples;
 }
 
+// Copies one frame of samples. With a compile-time channel count the
+// compiler reduces this to straight moves instead of a counted loop.
+inline void copyFrame(CSAMPLE* pDest, const CSAMPLE* pSrc, int chCount) {
+    for (int chIdx = 0; chIdx < chCount; chIdx++) {
+        pDest[chIdx] = pSrc[chIdx];
+    }
+}
+
 // Stretch a specified buffer worth of audio using linear interpolation
 double EngineBufferScaleLinear::do_scale(CSAMPLE* buf, SINT buf_size) {
+    // Dispatch once per buffer to an implementation with a compile-time
+    // channel count, so that the per-frame copies and the interpolation
+    // loop are unrolled for the common configurations (stereo and stem
+    // decks) instead of looping over a runtime count on every frame.
+    switch (getOutputSignal().getChannelCount()) {
+    case 2:
+        return do_scale_channels<2>(buf, buf_size);
+    case 4:
+        return do_scale_channels<4>(buf, buf_size);
+    case 8:
+        return do_scale_channels<8>(buf, buf_size);
+    default:
+        return do_scale_channels<0>(buf, buf_size);
+    }
+}
+
+template<int channelCount>
+double EngineBufferScaleLinear::do_scale_channels(CSAMPLE* buf, SINT buf_size) {
+    // With channelCount > 0 this is a compile-time constant.
+    const int chCount = channelCount > 0
+            ? channelCount
+            : getOutputSignal().getChannelCount();
+    DEBUG_ASSERT(chCount == getOutputSignal().getChannelCount());
+
     double rate_old = m_dOldRate;
     const double rate_new = m_dRate;
     const double rate_diff = rate_new - rate_old;
@@ -211,7 +249,7 @@ double EngineBufferScaleLinear::do_scale(CSAMPLE* buf, SINT buf_size) {
 
     // Simulate the loop to estimate how many frames we need
     double frames = 0;
-    const SINT bufferSizeFrames = getOutputSignal().samples2frames(buf_size);
+    const SINT bufferSizeFrames = buf_size / chCount;
     const double rate_delta = rate_diff / bufferSizeFrames;
     // use Gaussian sum formula (n(n+1))/2 for
     //for (int j = 0; j < bufferSizeFrames; ++j) {
@@ -227,7 +265,6 @@ double EngineBufferScaleLinear::do_scale(CSAMPLE* buf, SINT buf_size) {
     SINT unscaled_frames_needed = static_cast<SINT>(frames +
             m_dNextFrame - floor(m_dNextFrame));
 
-    int chCount = getOutputSignal().getChannelCount();
     m_floorSample.clear();
     m_ceilSample.clear();
 
@@ -252,27 +289,27 @@ double EngineBufferScaleLinear::do_scale(CSAMPLE* buf, SINT buf_size) {
 
         SINT currentFrameFloor = static_cast<SINT>(floor(m_dCurrentFrame));
 
-        int sampleCount = getOutputSignal().frames2samples(currentFrameFloor);
+        int sampleCount = currentFrameFloor * chCount;
         if (currentFrameFloor < 0) {
             // we have advanced to a new buffer in the previous run,
             // but the floor still points to the old buffer
             // so take the cached sample, this happens on slow rates
-            SampleUtil::copy(m_floorSample.data(), m_floorSampleOld.data(), chCount);
-            SampleUtil::copy(m_ceilSample.data(), m_bufferInt, chCount);
+            copyFrame(m_floorSample.data(), m_floorSampleOld.data(), chCount);
+            copyFrame(m_ceilSample.data(), m_bufferInt, chCount);
         } else if (sampleCount + 2 * chCount - 1 < m_bufferIntSize) {
             // take floorSample form the buffer of the previous run
-            SampleUtil::copy(m_floorSample.data(), &m_bufferInt[sampleCount], chCount);
-            SampleUtil::copy(m_ceilSample.data(), &m_bufferInt[sampleCount + chCount], chCount);
+            copyFrame(m_floorSample.data(), &m_bufferInt[sampleCount], chCount);
+            copyFrame(m_ceilSample.data(), &m_bufferInt[sampleCount + chCount], chCount);
         } else {
             // if we don't have the ceilSample in buffer, load some more
 
             if (sampleCount + chCount - 1 < m_bufferIntSize) {
                 // take floorSample form the buffer of the previous run
-                SampleUtil::copy(m_floorSample.data(), &m_bufferInt[sampleCount], chCount);
+                copyFrame(m_floorSample.data(), &m_bufferInt[sampleCount], chCount);
             }
 
             do {
-                SINT oldBufferFrames = getOutputSignal().samples2frames(m_bufferIntSize);
+                SINT oldBufferFrames = m_bufferIntSize / chCount;
                 if (unscaled_frames_needed == 0) {
                     // protection against infinite loop
                     // This may happen due to double precision issues
@@ -281,7 +318,7 @@ double EngineBufferScaleLinear::do_scale(CSAMPLE* buf, SINT buf_size) {
 
                 SINT samples_to_read = math_min<SINT>(
                         kiLinearScaleReadAheadLength,
-                        getOutputSignal().frames2samples(unscaled_frames_needed));
+                        unscaled_frames_needed * chCount);
 
                 m_bufferIntSize = m_pReadAheadManager->getNextSamples(
                         rate_new == 0 ? rate_old : rate_new,
@@ -292,23 +329,23 @@ double EngineBufferScaleLinear::do_scale(CSAMPLE* buf, SINT buf_size) {
                 // e.g. when reloop_toggle jumps back to loop_in, or when
                 // moving a loop causes the play position to be moved along.
 
-                unscaled_frames_needed -= getOutputSignal().samples2frames(m_bufferIntSize);
+                unscaled_frames_needed -= m_bufferIntSize / chCount;
 
                 // adapt the frames values that are still relative to the old buffer for the new one
                 m_dCurrentFrame -= oldBufferFrames;
                 startFrame -= oldBufferFrames;
                 currentFrameFloor -= oldBufferFrames;
 
-                sampleCount = getOutputSignal().frames2samples(currentFrameFloor);
+                sampleCount = currentFrameFloor * chCount;
             } while (sampleCount + 2 * chCount - 1 >= m_bufferIntSize);
 
             // Now that the buffer is up to date, we can get the value of the sample
             // at the floor of our position.
             if (currentFrameFloor >= 0) {
                 // the previous position is in the new buffer
-                SampleUtil::copy(m_floorSample.data(), &m_bufferInt[sampleCount], chCount);
+                copyFrame(m_floorSample.data(), &m_bufferInt[sampleCount], chCount);
             }
-            SampleUtil::copy(m_ceilSample.data(), &m_bufferInt[sampleCount + chCount], chCount);
+            copyFrame(m_ceilSample.data(), &m_bufferInt[sampleCount + chCount], chCount);
         }
 
         // For the current index, what percentage is it
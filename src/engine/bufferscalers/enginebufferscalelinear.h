@@ -28,6 +28,11 @@ class EngineBufferScaleLinear : public EngineBufferScale  {
     void onSignalChanged() override;
 
     double do_scale(CSAMPLE* buf, SINT buf_size);
+    // Implementation of do_scale(). A positive channelCount is a
+    // compile-time constant for the per-frame copies and the
+    // interpolation loop; 0 falls back to the runtime channel count.
+    template<int channelCount>
+    double do_scale_channels(CSAMPLE* buf, SINT buf_size);
     SINT do_copy(CSAMPLE* buf, SINT buf_size);
 
     // The read-ahead manager that we use to fetch samples
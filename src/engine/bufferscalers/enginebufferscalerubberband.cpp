@@ -1,8 +1,10 @@
 #include "engine/bufferscalers/enginebufferscalerubberband.h"
 
 #include <QFile>
+#include <QRunnable>
 #include <QtDebug>
 
+#include "engine/bufferscalers/rubberbandworkerpool.h"
 #include "engine/readaheadmanager.h"
 #include "moc_enginebufferscalerubberband.cpp"
 #include "util/counter.h"
@@ -17,6 +19,95 @@ using RubberBand::RubberBandStretcher;
 #define RUBBERBANDV3 (RUBBERBAND_API_MAJOR_VERSION >= 3 || \
         (RUBBERBAND_API_MAJOR_VERSION == 2 && RUBBERBAND_API_MINOR_VERSION >= 7))
 
+struct EngineBufferScaleRubberBand::PrewarmedStretcher {
+    RubberBandWrapper rubberBand;
+    mixxx::audio::SampleRate sampleRate;
+    mixxx::audio::ChannelCount channelCount;
+    RubberBandStretcher::Options options;
+    /// The amount of priming silence to drop from the output, i.e. the value
+    /// `reset()` assigns to `m_remainingPaddingInOutput`.
+    SINT remainingPaddingInOutput;
+};
+
+struct EngineBufferScaleRubberBand::PrewarmSlot {
+    /// Published by the warm-up thread, consumed (exchanged against nullptr)
+    /// by the engine callback.
+    std::atomic<PrewarmedStretcher*> pReady{nullptr};
+    std::atomic<bool> warmUpInFlight{false};
+
+    ~PrewarmSlot() {
+        delete pReady.load();
+    }
+};
+
+/// Builds a stretcher for the given signal on the warm-up thread of the
+/// RubberBandWorkerPool and primes it with the required amount of start
+/// padding, replicating what `onSignalChanged()` and `reset()` would
+/// otherwise do inside the engine callback.
+class EngineBufferScaleRubberBand::WarmUpTask : public QRunnable {
+  public:
+    WarmUpTask(std::shared_ptr<PrewarmSlot> pSlot,
+            RubberBandWrapper&& retiredStretcher,
+            mixxx::audio::SampleRate sampleRate,
+            mixxx::audio::ChannelCount channelCount,
+            RubberBandStretcher::Options options)
+            : m_pSlot(std::move(pSlot)),
+              m_retiredStretcher(std::move(retiredStretcher)),
+              m_sampleRate(sampleRate),
+              m_channelCount(channelCount),
+              m_options(options) {
+        setAutoDelete(true);
+    }
+
+    void run() override {
+        // Destroy the retired stretcher first so its memory is returned
+        // outside the engine callback.
+        m_retiredStretcher.clear();
+
+        auto pWarmed = std::make_unique<PrewarmedStretcher>();
+        pWarmed->sampleRate = m_sampleRate;
+        pWarmed->channelCount = m_channelCount;
+        pWarmed->options = m_options;
+        pWarmed->rubberBand.setup(m_sampleRate, m_channelCount, m_options);
+        // Setting the time ratio to a very high value will cause RubberBand
+        // to preallocate buffers large enough to (almost certainly)
+        // avoid memory reallocations during playback.
+        pWarmed->rubberBand.setTimeRatio(2.0);
+        pWarmed->rubberBand.setTimeRatio(1.0);
+
+        // Feed the preferred amount of silence padding through the
+        // stretcher, see EngineBufferScaleRubberBand::reset() for why this
+        // is required.
+        std::vector<mixxx::SampleBuffer> buffers(m_channelCount);
+        std::vector<float*> bufferPtrs(m_channelCount);
+        for (int chIdx = 0; chIdx < m_channelCount; chIdx++) {
+            buffers[chIdx] = mixxx::SampleBuffer(MAX_BUFFER_LEN);
+            buffers[chIdx].clear();
+            bufferPtrs[chIdx] = buffers[chIdx].data();
+        }
+        size_t remaining_padding = pWarmed->rubberBand.getPreferredStartPad();
+        const size_t block_size = std::min<size_t>(remaining_padding, MAX_BUFFER_LEN);
+        while (remaining_padding > 0) {
+            const size_t pad_samples = std::min<size_t>(remaining_padding, block_size);
+            pWarmed->rubberBand.process(bufferPtrs.data(), pad_samples, false);
+            remaining_padding -= pad_samples;
+        }
+        pWarmed->remainingPaddingInOutput =
+                static_cast<SINT>(pWarmed->rubberBand.getStartDelay());
+
+        delete m_pSlot->pReady.exchange(
+                pWarmed.release(), std::memory_order_acq_rel);
+        m_pSlot->warmUpInFlight.store(false, std::memory_order_release);
+    }
+
+  private:
+    std::shared_ptr<PrewarmSlot> m_pSlot;
+    RubberBandWrapper m_retiredStretcher;
+    mixxx::audio::SampleRate m_sampleRate;
+    mixxx::audio::ChannelCount m_channelCount;
+    RubberBandStretcher::Options m_options;
+};
+
 EngineBufferScaleRubberBand::EngineBufferScaleRubberBand(
         ReadAheadManager* pReadAheadManager)
         : m_pReadAheadManager(pReadAheadManager),
@@ -24,12 +115,16 @@ EngineBufferScaleRubberBand::EngineBufferScaleRubberBand(
           m_bufferPtrs(),
           m_interleavedReadBuffer(MAX_BUFFER_LEN),
           m_bBackwards(false),
-          m_useEngineFiner(false) {
+          m_useEngineFiner(false),
+          m_rubberBandOptions(RubberBandStretcher::OptionProcessRealTime),
+          m_pPrewarmSlot(std::make_shared<PrewarmSlot>()) {
     // Initialize the internal buffers to prevent re-allocations
     // in the real-time thread.
     onSignalChanged();
 }
 
+EngineBufferScaleRubberBand::~EngineBufferScaleRubberBand() = default;
+
 void EngineBufferScaleRubberBand::setScaleParameters(double base_rate,
                                                      double* pTempoRatio,
                                                      double* pPitchRatio) {
@@ -111,6 +206,9 @@ void EngineBufferScaleRubberBand::onSignalChanged() {
         m_bufferPtrs.resize(channelCount);
     }
 
+    // Hand the retired instances over to the warm-up thread for destruction
+    // instead of freeing them here.
+    RubberBandWrapper retiredStretcher = std::move(m_rubberBand);
     m_rubberBand.clear();
 
     for (int chIdx = 0; chIdx < channelCount; chIdx++) {
@@ -132,6 +230,7 @@ void EngineBufferScaleRubberBand::onSignalChanged() {
                 RubberBandStretcher::OptionChannelsTogether;
     }
 #endif
+    m_rubberBandOptions = rubberbandOptions;
 
     m_rubberBand.setup(
             getOutputSignal().getSampleRate(),
@@ -142,6 +241,11 @@ void EngineBufferScaleRubberBand::onSignalChanged() {
     // avoid memory reallocations during playback.
     m_rubberBand.setTimeRatio(2.0);
     m_rubberBand.setTimeRatio(1.0);
+
+    // Warm up a primed twin of this stretcher in the background, so the
+    // first keylock engage on the new signal only swaps pointers in
+    // `reset()` instead of priming the stretcher in the callback.
+    requestPrewarm(std::move(retiredStretcher));
 }
 
 void EngineBufferScaleRubberBand::clear() {
@@ -389,7 +493,58 @@ int EngineBufferScaleRubberBand::runningEngineVersion() {
     return m_rubberBand.getEngineVersion();
 }
 
+void EngineBufferScaleRubberBand::requestPrewarm(
+        RubberBandWrapper&& retiredStretcher) {
+    if (!getOutputSignal().isValid()) {
+        return;
+    }
+    RubberBandWorkerPool* pPool = RubberBandWorkerPool::instance();
+    if (!pPool) {
+        // Without a pool (e.g. in tests) resets stay synchronous.
+        return;
+    }
+    bool expected = false;
+    if (!m_pPrewarmSlot->warmUpInFlight.compare_exchange_strong(
+                expected, true, std::memory_order_acq_rel)) {
+        // A warm-up is already in flight; the retired stretcher (if any) is
+        // destroyed here. This only happens when the signal changes again
+        // before the previous warm-up finished.
+        return;
+    }
+    pPool->startWarmUp(new WarmUpTask(m_pPrewarmSlot,
+            std::move(retiredStretcher),
+            getOutputSignal().getSampleRate(),
+            getOutputSignal().getChannelCount(),
+            m_rubberBandOptions));
+}
+
+bool EngineBufferScaleRubberBand::tryAdoptPrewarmedStretcher() {
+    PrewarmedStretcher* pWarmed =
+            m_pPrewarmSlot->pReady.exchange(nullptr, std::memory_order_acquire);
+    if (!pWarmed) {
+        return false;
+    }
+    if (pWarmed->sampleRate != getOutputSignal().getSampleRate() ||
+            pWarmed->channelCount != getOutputSignal().getChannelCount() ||
+            pWarmed->options != m_rubberBandOptions) {
+        // Stale warm-up for a previous signal or configuration.
+        delete pWarmed;
+        return false;
+    }
+    RubberBandWrapper retiredStretcher = std::move(m_rubberBand);
+    m_rubberBand = std::move(pWarmed->rubberBand);
+    m_remainingPaddingInOutput = pWarmed->remainingPaddingInOutput;
+    delete pWarmed;
+    // Warm up a replacement for the next reset and dispose of the retired
+    // instances off the callback thread.
+    requestPrewarm(std::move(retiredStretcher));
+    return true;
+}
+
 void EngineBufferScaleRubberBand::reset() {
+    if (tryAdoptPrewarmedStretcher()) {
+        return;
+    }
     m_rubberBand.reset();
 
     // As mentioned in the docs (https://breakfastquay.com/rubberband/code-doc/)
@@ -420,4 +575,8 @@ void EngineBufferScaleRubberBand::reset() {
     // silence should be dropped from the result when the `retrieve()` in
     // `retrieveAndDeinterleave()` first starts producing audio.
     m_remainingPaddingInOutput = static_cast<SINT>(getStartDelay());
+
+    // If we had to prime synchronously, make sure a pre-warmed stretcher is
+    // available for the next reset.
+    requestPrewarm(RubberBandWrapper());
 }
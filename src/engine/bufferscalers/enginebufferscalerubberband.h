@@ -3,6 +3,7 @@
 #include <rubberband/RubberBandStretcher.h>
 
 #include <array>
+#include <atomic>
 #include <memory>
 
 #include "engine/bufferscalers/enginebufferscale.h"
@@ -17,6 +18,7 @@ class EngineBufferScaleRubberBand final : public EngineBufferScale {
   public:
     explicit EngineBufferScaleRubberBand(
             ReadAheadManager* pReadAheadManager);
+    ~EngineBufferScaleRubberBand() override;
 
     EngineBufferScaleRubberBand(const EngineBufferScaleRubberBand&) = delete;
     EngineBufferScaleRubberBand& operator=(const EngineBufferScaleRubberBand&) = delete;
@@ -42,6 +44,14 @@ class EngineBufferScaleRubberBand final : public EngineBufferScale {
     void clear() override;
 
   private:
+    /// A fully constructed and silence-primed stretcher built in the
+    /// background by a WarmUpTask, ready to be swapped in by `reset()`.
+    struct PrewarmedStretcher;
+    /// Hand-over slot between the warm-up thread and the engine callback.
+    /// Shared with in-flight WarmUpTasks so they can outlive this scaler.
+    struct PrewarmSlot;
+    class WarmUpTask;
+
     // Reset RubberBand library with new audio signal
     void onSignalChanged() override;
 
@@ -54,9 +64,20 @@ class EngineBufferScaleRubberBand final : public EngineBufferScale {
     int runningEngineVersion();
     /// Reset the rubberband instance and run the prerequisite amount of padding
     /// through it. This should be used instead of calling
-    /// `m_pRubberBand->reset()` directly.
+    /// `m_pRubberBand->reset()` directly. Adopts a pre-warmed stretcher if
+    /// one matching the current signal is available, so engaging keylock
+    /// mid-track does not pay the priming cost in the callback.
     void reset();
 
+    /// Schedule a background warm-up of a stretcher matching the current
+    /// signal on the RubberBandWorkerPool, unless one is already in flight.
+    /// `retiredStretcher` is destroyed on the warm-up thread first, so the
+    /// callback does not pay for the deallocation either.
+    void requestPrewarm(RubberBandWrapper&& retiredStretcher);
+    /// Swap in a pre-warmed stretcher if one matching the current signal has
+    /// been published by a WarmUpTask. Returns true on success.
+    bool tryAdoptPrewarmedStretcher();
+
     void deinterleaveAndProcess(const CSAMPLE* pBuffer, SINT frames);
     SINT retrieveAndDeinterleave(CSAMPLE* pBuffer, SINT frames);
 
@@ -85,4 +106,10 @@ class EngineBufferScaleRubberBand final : public EngineBufferScale {
     SINT m_remainingPaddingInOutput = 0;
 
     bool m_useEngineFiner;
+
+    /// Options used to set up `m_rubberBand`, kept to validate pre-warmed
+    /// stretchers against the active configuration.
+    RubberBand::RubberBandStretcher::Options m_rubberBandOptions;
+
+    std::shared_ptr<PrewarmSlot> m_pPrewarmSlot;
 };
@@ -148,18 +148,34 @@ double EngineBufferScaleST::scaleBuffer(
         if (remaining_frames > 0) {
             // The requested setting becomes effective after all previous frames have been processed
             m_effectiveRate = m_dBaseRate * m_dTempoRatio;
-            SINT iAvailSamples = m_pReadAheadManager->getNextSamples(
+            // During plain forward playback the scatter fast path feeds
+            // SoundTouch directly from the reader's chunk cache, skipping
+            // the copy through m_bufferBack; reads it cannot serve (reverse
+            // playback, loop/jump triggers, cache misses) end up in
+            // m_bufferBack as before.
+            m_scatterSpans.clear();
+            SINT iAvailSamples = m_pReadAheadManager->getNextSamplesScatter(
                     // The value doesn't matter here. All that matters is we
                     // are going forward or backward.
                     (m_bBackwards ? -1.0 : 1.0) * m_effectiveRate,
                     m_bufferBack.data(),
                     m_bufferBack.size(),
-                    getOutputSignal().getChannelCount());
+                    getOutputSignal().getChannelCount(),
+                    &m_scatterSpans);
             SINT iAvailFrames = getOutputSignal().samples2frames(iAvailSamples);
 
             if (iAvailFrames > 0) {
                 last_read_failed = false;
-                m_pSoundTouch->putSamples(m_bufferBack.data(), iAvailFrames);
+                if (m_scatterSpans.isEmpty()) {
+                    m_pSoundTouch->putSamples(m_bufferBack.data(), iAvailFrames);
+                } else {
+                    for (const std::span<const CSAMPLE>& piece :
+                            std::as_const(m_scatterSpans)) {
+                        m_pSoundTouch->putSamples(piece.data(),
+                                getOutputSignal().samples2frames(
+                                        static_cast<SINT>(piece.size())));
+                    }
+                }
             } else {
                 // We may get 0 samples once if we just hit a loop trigger, e.g.
                 // when reloop_toggle jumps back to loop_in, or when moving a
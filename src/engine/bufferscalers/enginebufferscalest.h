@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "engine/bufferscalers/enginebufferscale.h"
+#include "engine/cachingreader/cachingreader.h"
 #include "util/samplebuffer.h"
 
 class ReadAheadManager;
@@ -40,9 +41,14 @@ class EngineBufferScaleST : public EngineBufferScale {
     // SoundTouch time/pitch scaling lib
     std::unique_ptr<soundtouch::SoundTouch> m_pSoundTouch;
 
-    // Temporary buffer for reading from the RAMAN.
+    // Temporary buffer for reading from the RAMAN. Only used when the
+    // zero-copy scatter read cannot serve a request.
     mixxx::SampleBuffer m_bufferBack;
 
+    // Spans into the reader's chunk cache returned by the scatter fast
+    // path, consumed within the same scaleBuffer() call.
+    CachingReader::ScatterSampleSpans m_scatterSpans;
+
     // Holds the playback direction.
     bool m_bBackwards;
 };
@@ -33,4 +33,11 @@ RubberBandWorkerPool::RubberBandWorkerPool(UserSettingsPointer pConfig)
     for (int w = 0; w < maxThreadCount(); w++) {
         reserveThread();
     }
+
+    m_warmUpPool.setMaxThreadCount(1);
+    m_warmUpPool.setThreadPriority(QThread::LowPriority);
+}
+
+void RubberBandWorkerPool::startWarmUp(QRunnable* pTask) {
+    m_warmUpPool.start(pTask);
 }
@@ -15,6 +15,14 @@ class RubberBandWorkerPool : public QThreadPool, public Singleton<RubberBandWork
         return m_channelPerWorker;
     }
 
+    /// Schedule a background warm-up job, e.g. pre-instantiating and priming
+    /// RubberBandStretcher state on track load (see
+    /// EngineBufferScaleRubberBand). Warm-up jobs run on a dedicated
+    /// low-priority thread so they never compete with the real-time
+    /// stretching tasks or run inside the engine callback. Takes ownership
+    /// of the task if its auto-deletion is enabled.
+    void startWarmUp(QRunnable* pTask);
+
   protected:
     RubberBandWorkerPool(UserSettingsPointer pConfig = nullptr);
 
@@ -22,5 +30,9 @@ class RubberBandWorkerPool : public QThreadPool, public Singleton<RubberBandWork
     ;
     mixxx::audio::ChannelCount m_channelPerWorker;
 
+    // Dedicated single thread for warm-up jobs. The stretching tasks use the
+    // inherited pool, whose threads are all reserved for the engine.
+    QThreadPool m_warmUpPool;
+
     friend class Singleton<RubberBandWorkerPool>;
 };
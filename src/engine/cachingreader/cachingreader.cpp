@@ -6,7 +6,9 @@
 #include "util/assert.h"
 #include "util/compatibility/qatomic.h"
 #include "util/counter.h"
+#include "util/hugepages.h"
 #include "util/logger.h"
+#include "util/rtlogger.h"
 #include "util/sample.h"
 
 namespace {
@@ -64,6 +66,13 @@ CachingReader::CachingReader(const QString& group,
                   &m_chunkReadRequestFIFO,
                   &m_readerStatusUpdateFIFO,
                   maxSupportedChannel) {
+    // The chunk store is large (tens of MB per deck) and lives for the
+    // whole session. Backing it with transparent huge pages reduces TLB
+    // misses when the engine thread copies samples out of arbitrary
+    // cached chunks during the audio callback (best effort, Linux only).
+    mixxx::adviseHugePages(m_sampleBuffer.data(),
+            m_sampleBuffer.size() * sizeof(CSAMPLE));
+
     m_allocatedCachingReaderChunks.reserve(kNumberOfCachedChunksInMemory);
     // Divide up the allocated raw memory buffer into total_chunks
     // chunks. Initialize each chunk to hold nothing and add it to the free
@@ -434,8 +443,10 @@ CachingReader::ReadResult CachingReader::read(SINT startSample,
 
                 if (remainingFrameIndexRange.empty()) {
                     // No more readable data available. Exit the loop and
-                    // fill the remaining buffer with silence.
-                    kLogger.warning() << "Failed to read more sample data";
+                    // fill the remaining buffer with silence. This runs in
+                    // the engine callback, so log through the RT-safe sink.
+                    RtLogger::logf(QtWarningMsg,
+                            "CachingReader: failed to read more sample data");
                     break;
                 }
                 lastChunkIndex =
@@ -443,7 +454,8 @@ CachingReader::ReadResult CachingReader::read(SINT startSample,
                 if (lastChunkIndex < chunkIndex) {
                     // No more readable data available. Exit the loop and
                     // fill the remaining buffer with silence.
-                    kLogger.warning() << "Abort reading of sample data";
+                    RtLogger::logf(QtWarningMsg,
+                            "CachingReader: abort reading of sample data");
                     break;
                 }
 
@@ -470,12 +482,10 @@ CachingReader::ReadResult CachingReader::read(SINT startSample,
                     DEBUG_ASSERT(!pChunk ||
                             (pChunk->getState() == CachingReaderChunkForOwner::READ_PENDING));
                     Counter("CachingReader::read(): Failed to read chunk on cache miss")++;
-                    if (kLogger.traceEnabled()) {
-                        kLogger.trace()
-                                << "Cache miss for chunk with index"
-                                << chunkIndex
-                                << "- abort reading";
-                    }
+                    RtLogger::logf(QtDebugMsg,
+                            "CachingReader: cache miss for chunk with index "
+                            "%.0f - abort reading",
+                            chunkIndex);
                     // Abort reading (see below)
                     DEBUG_ASSERT(bufferedFrameIndexRange.empty());
                 }
@@ -498,10 +508,10 @@ CachingReader::ReadResult CachingReader::read(SINT startSample,
                             mixxx::IndexRange::between(
                                     remainingFrameIndexRange.start(),
                                     bufferedFrameIndexRange.start());
-                    kLogger.warning()
-                            << "Inserting"
-                            << paddingFrameIndexRange.length()
-                            << "frames of silence for unreadable audio data";
+                    RtLogger::logf(QtWarningMsg,
+                            "CachingReader: inserting %.0f frames of silence "
+                            "for unreadable audio data",
+                            paddingFrameIndexRange.length());
                     SINT paddingSamples = CachingReaderChunk::frames2samples(
                             paddingFrameIndexRange.length(), channelCount);
                     DEBUG_ASSERT(samplesRemaining >= paddingSamples);
@@ -536,6 +546,98 @@ CachingReader::ReadResult CachingReader::read(SINT startSample,
     return result;
 }
 
+CachingReader::ReadResult CachingReader::readScatter(SINT startSample,
+        SINT numSamples,
+        mixxx::audio::ChannelCount channelCount,
+        ScatterSampleSpans* pSpans) {
+    VERIFY_OR_DEBUG_ASSERT(startSample % channelCount == 0) {
+        kLogger.critical()
+                << "Invalid arguments for readScatter():"
+                << "startSample =" << startSample;
+        return ReadResult::UNAVAILABLE;
+    }
+    VERIFY_OR_DEBUG_ASSERT(numSamples % channelCount == 0) {
+        kLogger.critical()
+                << "Invalid arguments for readScatter():"
+                << "numSamples =" << numSamples;
+        return ReadResult::UNAVAILABLE;
+    }
+    VERIFY_OR_DEBUG_ASSERT(numSamples >= 0) {
+        kLogger.critical()
+                << "Invalid arguments for readScatter():"
+                << "numSamples =" << numSamples;
+        return ReadResult::UNAVAILABLE;
+    }
+    VERIFY_OR_DEBUG_ASSERT(pSpans) {
+        kLogger.critical()
+                << "Invalid arguments for readScatter():"
+                << "pSpans =" << pSpans;
+        return ReadResult::UNAVAILABLE;
+    }
+
+    // If no track is loaded, don't do anything.
+    if (atomicLoadRelaxed(m_state) != STATE_TRACK_LOADED) {
+        return ReadResult::UNAVAILABLE;
+    }
+
+    if (numSamples == 0) {
+        return ReadResult::AVAILABLE; // nothing to do
+    }
+
+    // Process new messages from the reader thread before looking up the
+    // chunks and to update m_readableFrameIndexRange. Not repeated inside
+    // the loop below: processing status updates might free chunks that
+    // already handed out spans.
+    process();
+
+    auto remainingFrameIndexRange =
+            mixxx::IndexRange::forward(
+                    CachingReaderChunk::samples2frames(startSample, channelCount),
+                    CachingReaderChunk::samples2frames(numSamples, channelCount));
+    DEBUG_ASSERT(!remainingFrameIndexRange.empty());
+
+    // A scatter read must be served entirely from buffered samples. Preroll
+    // or end-of-track silence would need a writable buffer, so those
+    // requests take the copying read() path.
+    if (!remainingFrameIndexRange.isSubrangeOf(m_readableFrameIndexRange)) {
+        return ReadResult::UNAVAILABLE;
+    }
+
+    const SINT firstChunkIndex =
+            CachingReaderChunk::indexForFrame(remainingFrameIndexRange.start());
+    const SINT lastChunkIndex =
+            CachingReaderChunk::indexForFrame(remainingFrameIndexRange.end() - 1);
+    const auto numSpansBefore = pSpans->size();
+    for (SINT chunkIndex = firstChunkIndex;
+            chunkIndex <= lastChunkIndex;
+            ++chunkIndex) {
+        const CachingReaderChunkForOwner* const pChunk = lookupChunkAndFreshen(chunkIndex);
+        if (!pChunk || (pChunk->getState() != CachingReaderChunkForOwner::READY)) {
+            // Cache miss, e.g. while decoding is still pending after a jump.
+            Counter("CachingReader::readScatter(): Cache miss")++;
+            pSpans->resize(numSpansBefore);
+            return ReadResult::UNAVAILABLE;
+        }
+        std::span<const CSAMPLE> view;
+        const auto viewedFrameIndexRange = pChunk->viewBufferedSampleFrames(
+                &view, channelCount, remainingFrameIndexRange);
+        if (viewedFrameIndexRange.empty() ||
+                viewedFrameIndexRange.start() != remainingFrameIndexRange.start()) {
+            // The chunk contains a gap of unreadable audio data that read()
+            // would pad with silence.
+            pSpans->resize(numSpansBefore);
+            return ReadResult::UNAVAILABLE;
+        }
+        pSpans->append(view);
+        remainingFrameIndexRange.shrinkFront(viewedFrameIndexRange.length());
+    }
+    VERIFY_OR_DEBUG_ASSERT(remainingFrameIndexRange.empty()) {
+        pSpans->resize(numSpansBefore);
+        return ReadResult::UNAVAILABLE;
+    }
+    return ReadResult::AVAILABLE;
+}
+
 void CachingReader::hintAndMaybeWake(const HintVector& hintList) {
     // If no file is loaded, skip.
     if (atomicLoadRelaxed(m_state) != STATE_TRACK_LOADED) {
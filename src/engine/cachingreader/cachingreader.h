@@ -6,6 +6,7 @@
 #include <QVarLengthArray>
 #include <QVector>
 #include <list>
+#include <span>
 
 #include "engine/cachingreader/cachingreaderworker.h"
 #include "preferences/usersettings.h"
@@ -28,7 +29,8 @@ typedef struct Hint {
         FirstSound,
         IntroStart,
         IntroEnd,
-        OutroStart
+        OutroStart,
+        OutroEnd
     };
 
     // The frame to ensure is present in memory.
@@ -107,6 +109,27 @@ class CachingReader : public QObject {
             CSAMPLE* buffer,
             mixxx::audio::ChannelCount channelCount);
 
+    // The pieces of a scatter read in playback order, each pointing directly
+    // into chunk memory. Sized for the longest read a callback issues; like
+    // the HintVector a QVarLengthArray avoids reallocation in the callback.
+    typedef QVarLengthArray<std::span<const CSAMPLE>, 8> ScatterSampleSpans;
+
+    // Zero-copy variant of read() for the common case of a forward read that
+    // is entirely buffered in the cache. On success one span per traversed
+    // chunk is appended to pSpans and AVAILABLE is returned. The spans point
+    // directly into chunk memory and stay valid only until this reader
+    // processes new messages, i.e. they must be consumed within the current
+    // engine callback and before the next read()/readScatter() call.
+    // If any part of the requested range is not instantly available from the
+    // cache (cache miss, preroll, end of track) UNAVAILABLE is returned,
+    // pSpans is left unchanged and the caller must fall back to the copying
+    // read(), which also handles silence padding. Reverse reads always use
+    // read() since reversing the sample order requires a copy anyway.
+    virtual ReadResult readScatter(SINT startSample,
+            SINT numSamples,
+            mixxx::audio::ChannelCount channelCount,
+            ScatterSampleSpans* pSpans);
+
     // Issue a list of hints, but check whether any of the hints request a chunk
     // that is not in the cache. If any hints do request a chunk not in cache,
     // then wake the reader so that it can process them. Must only be called
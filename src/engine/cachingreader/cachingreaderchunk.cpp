@@ -77,6 +77,22 @@ mixxx::IndexRange CachingReaderChunk::bufferSampleFrames(
     return m_bufferedSampleFrames.frameIndexRange();
 }
 
+void CachingReaderChunk::restoreBufferedSampleFrames(
+        const mixxx::IndexRange& frameIndexRange,
+        std::span<const CSAMPLE> samples) {
+    DEBUG_ASSERT(m_index != kInvalidChunkIndex);
+    const SINT sampleCount = static_cast<SINT>(samples.size());
+    VERIFY_OR_DEBUG_ASSERT(sampleCount <= m_sampleBuffer.length()) {
+        m_bufferedSampleFrames = mixxx::ReadableSampleFrames();
+        return;
+    }
+    SampleUtil::copy(m_sampleBuffer.data(), samples.data(), sampleCount);
+    m_bufferedSampleFrames = mixxx::ReadableSampleFrames(
+            frameIndexRange,
+            mixxx::SampleBuffer::ReadableSlice(
+                    m_sampleBuffer.data(), sampleCount));
+}
+
 mixxx::IndexRange CachingReaderChunk::readBufferedSampleFrames(
         CSAMPLE* sampleBuffer,
         mixxx::audio::ChannelCount channelCount,
@@ -101,6 +117,29 @@ mixxx::IndexRange CachingReaderChunk::readBufferedSampleFrames(
     return copyableFrameIndexRange;
 }
 
+mixxx::IndexRange CachingReaderChunk::viewBufferedSampleFrames(
+        std::span<const CSAMPLE>* pView,
+        mixxx::audio::ChannelCount channelCount,
+        const mixxx::IndexRange& frameIndexRange) const {
+    DEBUG_ASSERT(m_index != kInvalidChunkIndex);
+    const auto viewableFrameIndexRange =
+            intersect(frameIndexRange, m_bufferedSampleFrames.frameIndexRange());
+    if (viewableFrameIndexRange.empty()) {
+        *pView = {};
+    } else {
+        const SINT srcSampleOffset = frames2samples(
+                viewableFrameIndexRange.start() -
+                        m_bufferedSampleFrames.frameIndexRange().start(),
+                channelCount);
+        const SINT sampleCount = frames2samples(
+                viewableFrameIndexRange.length(), channelCount);
+        *pView = std::span<const CSAMPLE>(
+                m_bufferedSampleFrames.readableData(srcSampleOffset),
+                static_cast<std::size_t>(sampleCount));
+    }
+    return viewableFrameIndexRange;
+}
+
 mixxx::IndexRange CachingReaderChunk::readBufferedSampleFramesReverse(
         CSAMPLE* reverseSampleBuffer,
         mixxx::audio::ChannelCount channelCount,
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <span>
+
 #include "sources/audiosource.h"
 
 // A Chunk is a memory-resident section of audio that has been cached.
@@ -63,9 +65,30 @@ public:
             const mixxx::AudioSourcePointer& pAudioSource,
             mixxx::SampleBuffer::WritableSlice tempOutputBuffer);
 
+    // The sample data and frame range currently buffered in this chunk,
+    // used by the worker to publish decoded chunks into SharedChunkCache.
+    const mixxx::ReadableSampleFrames& bufferedSampleFrames() const {
+        return m_bufferedSampleFrames;
+    }
+
+    // Fills this chunk with samples previously decoded by another worker
+    // (see SharedChunkCache) instead of reading from the audio source.
+    void restoreBufferedSampleFrames(
+            const mixxx::IndexRange& frameIndexRange,
+            std::span<const CSAMPLE> samples);
+
     mixxx::IndexRange readBufferedSampleFrames(CSAMPLE* sampleBuffer,
             mixxx::audio::ChannelCount channelCount,
             const mixxx::IndexRange& frameIndexRange) const;
+    // Zero-copy variant of readBufferedSampleFrames(): stores a read-only
+    // view directly into this chunk's sample memory in *pView and returns
+    // the frame range it covers, i.e. the intersection of frameIndexRange
+    // with the buffered frames. The view is only valid while the chunk
+    // remains READY, so it must not outlive the current engine callback.
+    mixxx::IndexRange viewBufferedSampleFrames(
+            std::span<const CSAMPLE>* pView,
+            mixxx::audio::ChannelCount channelCount,
+            const mixxx::IndexRange& frameIndexRange) const;
     mixxx::IndexRange readBufferedSampleFramesReverse(
             CSAMPLE* reverseSampleBuffer,
             mixxx::audio::ChannelCount channelCount,
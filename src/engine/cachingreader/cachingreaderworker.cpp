@@ -10,8 +10,10 @@
 #include "util/compatibility/qmutex.h"
 #include "util/event.h"
 #include "util/fifo.h"
+#include "util/ioprio.h"
 #include "util/logger.h"
 #include "util/span.h"
+#include "util/threadcpumonitor.h"
 
 namespace {
 
@@ -51,10 +53,18 @@ ReaderStatusUpdate CachingReaderWorker::processReadRequest(
         return result;
     }
 
-    // Try to read the data required for the chunk from the audio source
-    const mixxx::IndexRange bufferedFrameIndexRange = pChunk->bufferSampleFrames(
-            m_pAudioSource,
-            mixxx::SampleBuffer::WritableSlice(m_tempReadBuffer));
+    // Serve the chunk from the shared decoded-chunk cache if another deck
+    // has already decoded it, otherwise read the data required for the chunk
+    // from the audio source and publish it for the other decks.
+    mixxx::IndexRange bufferedFrameIndexRange;
+    if (SharedChunkCache::instance()->tryRestoreChunk(m_sharedCacheKey, pChunk)) {
+        bufferedFrameIndexRange = pChunk->bufferedSampleFrames().frameIndexRange();
+    } else {
+        bufferedFrameIndexRange = pChunk->bufferSampleFrames(
+                m_pAudioSource,
+                mixxx::SampleBuffer::WritableSlice(m_tempReadBuffer));
+        SharedChunkCache::instance()->storeChunk(m_sharedCacheKey, pChunk);
+    }
     DEBUG_ASSERT(!m_pAudioSource ||
             bufferedFrameIndexRange.isSubrangeOf(m_pAudioSource->frameIndexRange()));
     // The readable frame range might have changed
@@ -117,6 +127,12 @@ void CachingReaderWorker::run() {
     const auto id = lastId.fetchAndAddRelaxed(1) + 1;
     QThread::currentThread()->setObjectName(
             QStringLiteral("CachingReaderWorker ") + QString::number(id));
+    ThreadCpuMonitor::tagCurrentThread(QStringLiteral("reader"));
+
+    // Chunk reads feed the audible decks and must win over batch file
+    // I/O like library scans at the OS level, in addition to the
+    // elevated CPU priority that this thread is started with.
+    mixxx::setCurrentThreadIoPriority(mixxx::IoPriorityClass::Realtime);
 
     Event::start(m_tag);
     while (!m_stop.loadAcquire()) {
@@ -169,6 +185,11 @@ void CachingReaderWorker::discardAllPendingRequests() {
 void CachingReaderWorker::closeAudioSource() {
     discardAllPendingRequests();
 
+    if (m_sharedCacheKey.isValid()) {
+        SharedChunkCache::instance()->releaseTrack(m_sharedCacheKey);
+        m_sharedCacheKey = SharedChunkCache::TrackKey();
+    }
+
     if (m_pAudioSource) {
         // Closes open file handles of the old track.
         m_pAudioSource->close();
@@ -267,6 +288,26 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
         return;
     }
 
+    // Register the loaded track in the shared decoded-chunk cache. The key
+    // includes the channel count of the decoded chunk layout, i.e. after the
+    // optional stereo conversion in CachingReaderChunk::bufferSampleFrames().
+    // Tracks without an id (not in the library) bypass the cache.
+    SharedChunkCache::TrackKey sharedCacheKey;
+    sharedCacheKey.trackId = pTrack->getId();
+    const auto sourceChannelCount =
+            m_pAudioSource->getSignalInfo().getChannelCount();
+    sharedCacheKey.channelCount =
+            (sourceChannelCount % mixxx::audio::ChannelCount::stereo() == 0)
+            ? static_cast<int>(sourceChannelCount)
+            : static_cast<int>(mixxx::audio::ChannelCount::stereo());
+#ifdef __STEM__
+    sharedCacheKey.stemMask = static_cast<uint>(stemMask);
+#endif
+    if (sharedCacheKey.isValid()) {
+        SharedChunkCache::instance()->retainTrack(sharedCacheKey);
+        m_sharedCacheKey = sharedCacheKey;
+    }
+
     // Adjust the internal buffer
     const SINT tempReadBufferSize =
             m_pAudioSource->getSignalInfo().frames2samples(
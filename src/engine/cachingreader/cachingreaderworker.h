@@ -6,6 +6,7 @@
 #include "audio/frame.h"
 #include "audio/types.h"
 #include "engine/cachingreader/cachingreaderchunk.h"
+#include "engine/cachingreader/sharedchunkcache.h"
 #include "engine/engineworker.h"
 #include "sources/audiosource.h"
 #include "track/track_decl.h"
@@ -176,6 +177,10 @@ class CachingReaderWorker : public EngineWorker {
     // The current audio source of the track loaded
     mixxx::AudioSourcePointer m_pAudioSource;
 
+    // Key of the loaded track in the shared decoded-chunk cache; invalid
+    // while no track is loaded or the track has no id yet.
+    SharedChunkCache::TrackKey m_sharedCacheKey;
+
     mixxx::audio::FramePos m_firstSoundFrameToVerify;
 
     // Temporary buffer for reading samples from all channels
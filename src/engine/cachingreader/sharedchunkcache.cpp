@@ -0,0 +1,170 @@
+#include "engine/cachingreader/sharedchunkcache.h"
+
+#include <vector>
+
+#include "engine/cachingreader/cachingreaderchunk.h"
+#include "util/compatibility/qmutex.h"
+#include "util/logger.h"
+#include "util/sample.h"
+
+namespace {
+
+mixxx::Logger kLogger("SharedChunkCache");
+
+// The fastest deflate level. Decoded audio chunks are stored once and
+// may never be restored, so spending more time on a marginally better
+// ratio does not pay off. The bulk of the size reduction comes from the
+// 16 bit quantization and the per-channel delta encoding anyway.
+constexpr int kCompressionLevel = 1;
+
+// Stop storing additional chunks when the compressed tier grows beyond
+// this limit. The limit is generous enough to hold several hours of
+// compressed stereo audio and merely guards against pathological
+// situations, e.g. many decks with very long tracks at high sample
+// rates.
+constexpr qint64 kMaxTotalCompressedBytes = 512LL * 1024 * 1024;
+
+// Delta-encodes the quantized samples per channel in place. Adjacent
+// samples of the same channel are strongly correlated, so storing
+// their differences leaves mostly small values that deflate well.
+void deltaEncodeSamples(SAMPLE* pSamples, SINT sampleCount, int channelCount) {
+    for (SINT i = sampleCount - 1; i >= channelCount; --i) {
+        pSamples[i] = static_cast<SAMPLE>(pSamples[i] - pSamples[i - channelCount]);
+    }
+}
+
+// Reverses deltaEncodeSamples()
+void deltaDecodeSamples(SAMPLE* pSamples, SINT sampleCount, int channelCount) {
+    for (SINT i = channelCount; i < sampleCount; ++i) {
+        pSamples[i] = static_cast<SAMPLE>(pSamples[i] + pSamples[i - channelCount]);
+    }
+}
+
+} // anonymous namespace
+
+// static
+SharedChunkCache* SharedChunkCache::instance() {
+    static SharedChunkCache s_instance;
+    return &s_instance;
+}
+
+void SharedChunkCache::retainTrack(const TrackKey& key) {
+    DEBUG_ASSERT(key.isValid());
+    const auto locker = lockMutex(&m_mutex);
+    ++m_tracks[key].refCount;
+}
+
+void SharedChunkCache::releaseTrack(const TrackKey& key) {
+    DEBUG_ASSERT(key.isValid());
+    const auto locker = lockMutex(&m_mutex);
+    const auto it = m_tracks.find(key);
+    VERIFY_OR_DEBUG_ASSERT(it != m_tracks.end()) {
+        return;
+    }
+    DEBUG_ASSERT(it.value().refCount > 0);
+    if (--it.value().refCount == 0) {
+        for (const auto& chunk : std::as_const(it.value().chunks)) {
+            m_totalCompressedBytes -= chunk.compressedSamples.size();
+        }
+        if (kLogger.debugEnabled()) {
+            kLogger.debug()
+                    << "Evicting" << it.value().chunks.size()
+                    << "cached chunks of track" << key.trackId;
+        }
+        m_tracks.erase(it);
+    }
+}
+
+bool SharedChunkCache::tryRestoreChunk(const TrackKey& key, CachingReaderChunk* pChunk) {
+    DEBUG_ASSERT(pChunk);
+    if (!key.isValid()) {
+        return false;
+    }
+    // Only take an implicitly shared copy of the compressed data while
+    // holding the mutex. The copy keeps the data alive even if the
+    // entry is evicted concurrently and allows to decompress outside
+    // of the critical section.
+    QByteArray compressedSamples;
+    mixxx::IndexRange bufferedFrameIndexRange;
+    SINT sampleCount = 0;
+    {
+        const auto locker = lockMutex(&m_mutex);
+        const auto trackIt = m_tracks.constFind(key);
+        if (trackIt == m_tracks.constEnd()) {
+            return false;
+        }
+        const auto chunkIt = trackIt.value().chunks.constFind(pChunk->getIndex());
+        if (chunkIt == trackIt.value().chunks.constEnd()) {
+            return false;
+        }
+        compressedSamples = chunkIt.value().compressedSamples;
+        bufferedFrameIndexRange = chunkIt.value().bufferedFrameIndexRange;
+        sampleCount = chunkIt.value().sampleCount;
+    }
+
+    const QByteArray deltaData = qUncompress(compressedSamples);
+    VERIFY_OR_DEBUG_ASSERT(deltaData.size() ==
+            static_cast<qsizetype>(sampleCount * sizeof(SAMPLE))) {
+        return false;
+    }
+    const auto* pDeltas = reinterpret_cast<const SAMPLE*>(deltaData.constData());
+    std::vector<SAMPLE> s16Samples(pDeltas, pDeltas + sampleCount);
+    deltaDecodeSamples(s16Samples.data(), sampleCount, key.channelCount);
+
+    std::vector<CSAMPLE> samples(sampleCount);
+    SampleUtil::convertS16ToFloat32(samples.data(), s16Samples.data(), sampleCount);
+    pChunk->restoreBufferedSampleFrames(
+            bufferedFrameIndexRange,
+            std::span<const CSAMPLE>(samples.data(), samples.size()));
+    return true;
+}
+
+void SharedChunkCache::storeChunk(const TrackKey& key, const CachingReaderChunk* pChunk) {
+    DEBUG_ASSERT(pChunk);
+    if (!key.isValid()) {
+        return;
+    }
+    const auto& bufferedSampleFrames = pChunk->bufferedSampleFrames();
+    if (bufferedSampleFrames.frameIndexRange().empty()) {
+        return;
+    }
+
+    // Quantize and compress before acquiring the mutex to keep the
+    // critical section short for the workers of the other decks.
+    const SINT sampleCount = bufferedSampleFrames.readableLength();
+    std::vector<SAMPLE> s16Samples(sampleCount);
+    SampleUtil::convertFloat32ToS16(
+            s16Samples.data(), bufferedSampleFrames.readableData(), sampleCount);
+    deltaEncodeSamples(s16Samples.data(), sampleCount, key.channelCount);
+    QByteArray compressedSamples = qCompress(
+            reinterpret_cast<const uchar*>(s16Samples.data()),
+            static_cast<qsizetype>(sampleCount * sizeof(SAMPLE)),
+            kCompressionLevel);
+
+    const auto locker = lockMutex(&m_mutex);
+    const auto trackIt = m_tracks.find(key);
+    if (trackIt == m_tracks.end()) {
+        // The track has been released concurrently, don't resurrect it.
+        return;
+    }
+    if (m_totalCompressedBytes + compressedSamples.size() > kMaxTotalCompressedBytes) {
+        if (!m_sizeLimitLogged) {
+            m_sizeLimitLogged = true;
+            kLogger.warning()
+                    << "Size limit of compressed chunk tier reached,"
+                    << "not caching additional chunks";
+        }
+        return;
+    }
+    CachedChunk& cachedChunk = trackIt.value().chunks[pChunk->getIndex()];
+    m_totalCompressedBytes -= cachedChunk.compressedSamples.size();
+    cachedChunk.bufferedFrameIndexRange = bufferedSampleFrames.frameIndexRange();
+    cachedChunk.compressedSamples = std::move(compressedSamples);
+    cachedChunk.sampleCount = sampleCount;
+    m_totalCompressedBytes += cachedChunk.compressedSamples.size();
+}
+
+qint64 SharedChunkCache::totalCompressedBytes() const {
+    const auto locker = lockMutex(&m_mutex);
+    return m_totalCompressedBytes;
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <QByteArray>
+#include <QHash>
+#include <QMutex>
+
+#include "track/trackid.h"
+#include "util/indexrange.h"
+#include "util/types.h"
+
+class CachingReaderChunk;
+
+/// Process-wide cache of decoded chunk PCM shared between the
+/// CachingReaderWorker instances of all decks and samplers. When the same
+/// track is loaded to multiple decks (e.g. for beatmatch practice) only the
+/// first worker decodes each chunk from the audio source; the other workers
+/// copy the decoded samples out of this cache, which makes the second deck
+/// load instant and halves the decode work.
+///
+/// The cache also serves as a compressed second tier behind the small
+/// decoded chunk window of each CachingReader: every chunk that has been
+/// decoded once during the current load stays cached here, so seeking back
+/// to a distant position is served from memory instead of decoding from
+/// the audio source again. To keep even multi-hour high sample rate tracks
+/// affordable the samples are quantized to 16 bits, delta-encoded per
+/// channel and deflated, which shrinks them to a fraction of the decoded
+/// float PCM. Restored chunks therefore reproduce CD resolution instead of
+/// the bit-exact float samples, which is the same precision that most
+/// sources provide anyway.
+///
+/// Entries are refcounted per loaded track: workers retain the track key
+/// when they open its audio source and release it when they close it. All
+/// cached chunks of a track are evicted when the last worker releases it,
+/// so the cache never outlives the decks' interest in a track and its size
+/// is bounded by the compressed chunks of the currently loaded tracks.
+///
+/// All methods are called from the (non-real-time) worker threads and are
+/// serialized by a mutex; the engine callback never touches this class.
+/// Compressing and decompressing happens outside of the critical section.
+class SharedChunkCache {
+  public:
+    /// Identifies one decoded representation of a track. The channel count
+    /// (and stem mask on stem builds) is part of the key because workers
+    /// opened with different channel configurations produce different PCM
+    /// for the same TrackId.
+    struct TrackKey {
+        TrackId trackId;
+        int channelCount = 0;
+#ifdef __STEM__
+        uint stemMask = 0;
+#endif
+
+        bool isValid() const {
+            return trackId.isValid() && channelCount > 0;
+        }
+
+        bool operator==(const TrackKey&) const = default;
+    };
+
+    static SharedChunkCache* instance();
+
+    /// Registers another worker reading from the given track.
+    void retainTrack(const TrackKey& key);
+
+    /// Drops a worker's reference; evicts all chunks of the track when the
+    /// last reference is gone.
+    void releaseTrack(const TrackKey& key);
+
+    /// Copies the cached samples for the chunk's index into pChunk and
+    /// returns true on a hit. The track must be retained by the caller.
+    bool tryRestoreChunk(const TrackKey& key, CachingReaderChunk* pChunk);
+
+    /// Publishes the freshly decoded samples of pChunk for other workers
+    /// and later seeks. No-op if the track is not retained.
+    void storeChunk(const TrackKey& key, const CachingReaderChunk* pChunk);
+
+    /// Total number of compressed bytes cached, for diagnostics.
+    qint64 totalCompressedBytes() const;
+
+  private:
+    SharedChunkCache() = default;
+
+    struct CachedChunk {
+        mixxx::IndexRange bufferedFrameIndexRange;
+        // Samples quantized to 16 bits, delta-encoded per channel
+        // and deflated with qCompress()
+        QByteArray compressedSamples;
+        SINT sampleCount = 0;
+    };
+
+    struct TrackEntry {
+        int refCount = 0;
+        QHash<SINT, CachedChunk> chunks;
+    };
+
+    mutable QMutex m_mutex;
+    QHash<TrackKey, TrackEntry> m_tracks;
+    qint64 m_totalCompressedBytes = 0;
+    bool m_sizeLimitLogged = false;
+};
+
+inline qhash_seed_t qHash(
+        const SharedChunkCache::TrackKey& key,
+        qhash_seed_t seed = 0) {
+    return qHash(key.trackId, seed) ^ static_cast<qhash_seed_t>(key.channelCount);
+}
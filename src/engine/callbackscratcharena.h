@@ -0,0 +1,111 @@
+#pragma once
+
+#include <span>
+
+#include "util/assert.h"
+#include "util/samplebuffer.h"
+#include "util/types.h"
+
+/// A bump allocator handing out transient scratch buffers during a single
+/// audio callback. EngineMixer::process() owns the arena, resets it at the
+/// top of every callback and installs it as the current arena via the Scope
+/// guard. Engine stages that need short-lived working memory (effects message
+/// handling, group feature state copies, channel gain caches) can allocate
+/// from it instead of keeping their own pre-sized SampleUtil buffers or
+/// falling back to the heap.
+///
+/// Allocation is a pointer bump, deallocation is the per-callback reset, so
+/// nothing in the callback ever reaches malloc. The backing memory is
+/// allocated once at engine construction with SampleUtil::alloc and every
+/// chunk stays aligned for the vectorized SampleUtil kernels.
+///
+/// Not thread safe by design: the arena must only be used from the engine
+/// callback thread while a Scope is active.
+class CallbackScratchArena final {
+  public:
+    explicit CallbackScratchArena(SINT capacity)
+            : m_buffer(capacity),
+              m_used(0),
+              m_highWaterMark(0) {
+    }
+
+    CallbackScratchArena(const CallbackScratchArena&) = delete;
+    CallbackScratchArena& operator=(const CallbackScratchArena&) = delete;
+
+    /// Returns a scratch buffer of numSamples samples that stays valid until
+    /// the next reset(), i.e. until the end of the current callback. The
+    /// content is uninitialized. Returns an empty span if the arena is
+    /// exhausted -- callers must then fall back to their own pre-sized
+    /// buffer; the debug assertion makes sure we notice undersized arenas
+    /// during development.
+    std::span<CSAMPLE> allocate(SINT numSamples) {
+        DEBUG_ASSERT(numSamples >= 0);
+        // Round the chunk size up to a full SIMD register so consecutive
+        // allocations keep the alignment of the backing buffer.
+        const SINT alignedSamples =
+                (numSamples + kSampleAlignment - 1) & ~(kSampleAlignment - 1);
+        VERIFY_OR_DEBUG_ASSERT(m_used + alignedSamples <= m_buffer.size()) {
+            return {};
+        }
+        CSAMPLE* pChunk = m_buffer.data(m_used);
+        m_used += alignedSamples;
+        if (m_used > m_highWaterMark) {
+            m_highWaterMark = m_used;
+        }
+        return {pChunk, static_cast<std::size_t>(numSamples)};
+    }
+
+    /// Discards all chunks handed out since the last reset. Called by
+    /// EngineMixer at the top of every callback.
+    void reset() {
+        m_used = 0;
+    }
+
+    SINT capacity() const {
+        return m_buffer.size();
+    }
+
+    SINT used() const {
+        return m_used;
+    }
+
+    /// Largest number of samples ever in use at once, for sizing diagnostics.
+    SINT highWaterMark() const {
+        return m_highWaterMark;
+    }
+
+    /// The arena of the callback currently being processed or nullptr when
+    /// called outside of EngineMixer::process(). Callers that can run
+    /// outside the callback (e.g. during tests or setup) must handle the
+    /// nullptr case.
+    static CallbackScratchArena* current() {
+        return s_pCurrent;
+    }
+
+    /// RAII guard installing an arena as the current one for the duration of
+    /// EngineMixer::process(). Resets the arena on entry.
+    class Scope final {
+      public:
+        explicit Scope(CallbackScratchArena* pArena) {
+            DEBUG_ASSERT(s_pCurrent == nullptr);
+            pArena->reset();
+            s_pCurrent = pArena;
+        }
+        ~Scope() {
+            s_pCurrent = nullptr;
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+  private:
+    // 8 samples = 32 bytes, the alignment of AVX builds of SampleUtil.
+    static constexpr SINT kSampleAlignment = 8;
+
+    static inline CallbackScratchArena* s_pCurrent = nullptr;
+
+    mixxx::SampleBuffer m_buffer;
+    SINT m_used;
+    SINT m_highWaterMark;
+};
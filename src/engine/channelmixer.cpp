@@ -4,6 +4,52 @@
 #include "util/sample.h"
 #include "util/timer.h"
 
+namespace {
+
+// Ramping gains of all active channels in structure-of-arrays layout,
+// indexed like the activeChannels array.
+struct ChannelGains {
+    QVarLengthArray<CSAMPLE_GAIN, kPreallocatedChannels> oldGains;
+    QVarLengthArray<CSAMPLE_GAIN, kPreallocatedChannels> newGains;
+    QVarLengthArray<bool, kPreallocatedChannels> fadeouts;
+};
+
+// Calculate the ramping gains of all active channels up front into
+// contiguous storage. This walks the gain cache in one tight pass instead
+// of interleaving the gain arithmetic with the per-channel effects
+// processing below.
+void calculateGains(const EngineMixer::GainCalculator& gainCalculator,
+        const QVarLengthArray<EngineMixer::ChannelInfo*,
+                kPreallocatedChannels>& activeChannels,
+        QVarLengthArray<EngineMixer::GainCache, kPreallocatedChannels>*
+                channelGainCache,
+        ChannelGains* pGains) {
+    const int numChannels = activeChannels.size();
+    pGains->oldGains.resize(numChannels);
+    pGains->newGains.resize(numChannels);
+    pGains->fadeouts.resize(numChannels);
+    for (int i = 0; i < numChannels; ++i) {
+        EngineMixer::ChannelInfo* pChannelInfo = activeChannels[i];
+        EngineMixer::GainCache& gainCache = (*channelGainCache)[pChannelInfo->m_index];
+        const bool fadeout = gainCache.m_fadeout ||
+                (pChannelInfo->m_pChannel &&
+                        !pChannelInfo->m_pChannel->isActive());
+        CSAMPLE_GAIN newGain;
+        if (fadeout) {
+            newGain = 0;
+            gainCache.m_fadeout = false;
+        } else {
+            newGain = gainCalculator.getGain(pChannelInfo);
+        }
+        pGains->oldGains[i] = gainCache.m_gain;
+        pGains->newGains[i] = newGain;
+        pGains->fadeouts[i] = fadeout;
+        gainCache.m_gain = newGain;
+    }
+}
+
+} // namespace
+
 // static
 void ChannelMixer::applyEffectsAndMixChannels(const EngineMixer::GainCalculator& gainCalculator,
         const QVarLengthArray<EngineMixer::ChannelInfo*, kPreallocatedChannels>& activeChannels,
@@ -24,20 +70,10 @@ void ChannelMixer::applyEffectsAndMixChannels(const EngineMixer::GainCalculator&
     // The original channel input buffers are not modified.
     SampleUtil::clear(pOutput, bufferSize);
     ScopedTimer t(QStringLiteral("EngineMixer::applyEffectsAndMixChannels"));
-    for (auto* pChannelInfo : activeChannels) {
-        EngineMixer::GainCache& gainCache = (*channelGainCache)[pChannelInfo->m_index];
-        CSAMPLE_GAIN oldGain = gainCache.m_gain;
-        CSAMPLE_GAIN newGain;
-        bool fadeout = gainCache.m_fadeout ||
-                (pChannelInfo->m_pChannel &&
-                        !pChannelInfo->m_pChannel->isActive());
-        if (fadeout) {
-            newGain = 0;
-            gainCache.m_fadeout = false;
-        } else {
-            newGain = gainCalculator.getGain(pChannelInfo);
-        }
-        gainCache.m_gain = newGain;
+    ChannelGains gains;
+    calculateGains(gainCalculator, activeChannels, channelGainCache, &gains);
+    for (int i = 0; i < activeChannels.size(); ++i) {
+        EngineMixer::ChannelInfo* pChannelInfo = activeChannels[i];
         pEngineEffectsManager->processPostFaderAndMix(pChannelInfo->m_handle,
                 outputHandle,
                 pChannelInfo->m_pBuffer.data(),
@@ -45,9 +81,9 @@ void ChannelMixer::applyEffectsAndMixChannels(const EngineMixer::GainCalculator&
                 bufferSize,
                 sampleRate,
                 pChannelInfo->m_features,
-                oldGain,
-                newGain,
-                fadeout);
+                gains.oldGains[i],
+                gains.newGains[i],
+                gains.fadeouts[i]);
     }
 }
 
@@ -70,29 +106,29 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(
     // 4. Mix the channel buffers together to make pOutput, overwriting the pOutput buffer from the last engine callback
     ScopedTimer t(QStringLiteral("EngineMixer::applyEffectsInPlaceAndMixChannels"));
     SampleUtil::clear(pOutput, bufferSize);
-    for (auto* pChannelInfo : activeChannels) {
-        EngineMixer::GainCache& gainCache = (*channelGainCache)[pChannelInfo->m_index];
-        CSAMPLE_GAIN oldGain = gainCache.m_gain;
-        CSAMPLE_GAIN newGain;
-        bool fadeout = gainCache.m_fadeout ||
-                (pChannelInfo->m_pChannel &&
-                        !pChannelInfo->m_pChannel->isActive());
-        if (fadeout) {
-            newGain = 0;
-            gainCache.m_fadeout = false;
-        } else {
-            newGain = gainCalculator.getGain(pChannelInfo);
-        }
-        gainCache.m_gain = newGain;
+    ChannelGains gains;
+    calculateGains(gainCalculator, activeChannels, channelGainCache, &gains);
+    QVarLengthArray<const CSAMPLE*, kPreallocatedChannels> mixBuffers;
+    mixBuffers.resize(activeChannels.size());
+    for (int i = 0; i < activeChannels.size(); ++i) {
+        EngineMixer::ChannelInfo* pChannelInfo = activeChannels[i];
         pEngineEffectsManager->processPostFaderInPlace(pChannelInfo->m_handle,
                 outputHandle,
                 pChannelInfo->m_pBuffer.data(),
                 bufferSize,
                 sampleRate,
                 pChannelInfo->m_features,
-                oldGain,
-                newGain,
-                fadeout);
-        SampleUtil::add(pOutput, pChannelInfo->m_pBuffer.data(), bufferSize);
+                gains.oldGains[i],
+                gains.newGains[i],
+                gains.fadeouts[i]);
+        mixBuffers[i] = pChannelInfo->m_pBuffer.data();
     }
+    // Accumulate all post-effects channel buffers with a single batched
+    // kernel instead of one add() pass over pOutput per channel. With many
+    // active channels (e.g. broadcast installs) this avoids re-reading and
+    // re-writing the output buffer for every channel.
+    SampleUtil::addBuffers(pOutput,
+            mixBuffers.constData(),
+            mixBuffers.size(),
+            bufferSize);
 }
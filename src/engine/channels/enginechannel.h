@@ -63,6 +63,14 @@ class EngineChannel : public EngineObject {
         m_channelIndex = channelIndex;
     }
 
+    // Returns true if process() mixes multiple stem channels through the
+    // post-fader effects path. Those channels route through intermediate
+    // effects buffers that are shared between all channels, so EngineMixer
+    // must not process two of them in parallel.
+    virtual bool isProcessingStems() const {
+        return false;
+    }
+
     virtual void postProcessLocalBpm() {
     }
 
@@ -153,7 +153,14 @@ void EngineDeck::processStem(CSAMPLE* pOut, const std::size_t bufferSize) {
 
     // We will now mix each stem (stereo channel) into a single "output"
     // stereo channel. In order to mix the steam, we will use the engine
-    // effect manager so we can also apply the individual stem quick FX
+    // effect manager so we can also apply the individual stem quick FX.
+    // Each stem is accumulated into the output buffer directly instead of
+    // writing the processed frames back into the multi channel buffer and
+    // mixing it down to stereo in a final pass.
+    if (m_stemWorkBuffer.size() < static_cast<SINT>(bufferSize)) {
+        m_stemWorkBuffer = mixxx::SampleBuffer(bufferSize);
+    }
+    SampleUtil::clear(pOut, bufferSize);
     GroupFeatureState featureState;
     collectFeatures(&featureState);
     for (unsigned int stemIdx = 0; stemIdx < stemCount;
@@ -162,16 +169,37 @@ void EngineDeck::processStem(CSAMPLE* pOut, const std::size_t bufferSize) {
         float stemGain = m_stemMute[stemIdx]->toBool()
                 ? 0.0f
                 : static_cast<float>(m_stemGain[stemIdx]->get());
-        // Extract the stem frames into the output buffer (LR......LR...... -> LRLR)
+        if (stemGain == m_stemsGainCache[stemIdx] &&
+                !pEngineEffectsManager->hasActivePostFaderEffects(
+                        m_stems[stemIdx].handle(),
+                        m_pEffectsManager->getMainHandle())) {
+            // No quick FX is active for this stem and the gain does not need
+            // to be ramped: mix the stem in straight from the multi channel
+            // buffer, skipping the stereo extraction round trip. A muted stem
+            // with a settled gain contributes nothing and is skipped entirely.
+            if (stemGain != CSAMPLE_GAIN_ZERO) {
+                SampleUtil::addOneStereoFromMultiWithGain(
+                        pOut,
+                        pIn,
+                        numFrames,
+                        chCount,
+                        chOffset,
+                        stemGain);
+            }
+            continue;
+        }
+        // Extract the stem frames into the work buffer (LR......LR...... -> LRLR)
         SampleUtil::copyOneStereoFromMulti(
-                pOut,
+                m_stemWorkBuffer.data(),
                 pIn,
                 numFrames,
                 chCount,
                 chOffset);
-        // Mix the stem frames with the right gain after proceeding its effect.
-        pEngineEffectsManager->processPostFaderInPlace(m_stems[stemIdx].handle(),
+        // Mix the stem frames into the output with the right gain after
+        // proceeding its effect.
+        pEngineEffectsManager->processPostFaderAndMix(m_stems[stemIdx].handle(),
                 m_pEffectsManager->getMainHandle(),
+                m_stemWorkBuffer.data(),
                 pOut,
                 bufferSize,
                 sampleRate,
@@ -183,18 +211,7 @@ void EngineDeck::processStem(CSAMPLE* pOut, const std::size_t bufferSize) {
         // next iteration. Without this, (e.g using a static "previous"
         // gain) gain changes will yield to audio cracks.
         m_stemsGainCache[stemIdx] = stemGain;
-
-        // Put back the stem frames into the steam buffer (LRLR -> LR......LR......)
-        SampleUtil::insertStereoToMulti(
-                pIn,
-                pOut,
-                numFrames,
-                chCount,
-                chOffset);
     }
-
-    // Mixxx all the stem tracks together
-    SampleUtil::mixMultichannelToStereo(pOut, pIn, numFrames, chCount);
 }
 
 void EngineDeck::cloneStemState(const EngineDeck* deckToClone) {
@@ -227,6 +244,7 @@ void EngineDeck::process(CSAMPLE* pOut, const std::size_t bufferSize) {
         m_bPassthroughWasActive = true;
         m_sampleBuffer = nullptr;
         m_pPregain->setSpeedAndScratching(1, false);
+        m_pPregain->setTrackPosition(-1, 0);
     } else {
         // If passthrough is no longer enabled, zero out the buffer
         if (m_bPassthroughWasActive) {
@@ -247,7 +265,27 @@ void EngineDeck::process(CSAMPLE* pOut, const std::size_t bufferSize) {
             processStem(pOut, bufferSize);
         }
 #endif
-        m_pPregain->setSpeedAndScratching(m_pBuffer->getSpeed(), m_pBuffer->getScratching());
+        // Read both from one snapshot so speed and the scratching flag always
+        // belong to the same callback.
+        const EngineBuffer::RateParameters rateParameters =
+                m_pBuffer->getRateParameters();
+        m_pPregain->setSpeedAndScratching(
+                rateParameters.speed, rateParameters.scratching);
+        // Position and buffer duration for the loudness curve correction.
+        // getPlayPos() is safe here because EngineBuffer::process() above
+        // ran on this very thread.
+        const mixxx::audio::FramePos playPos = m_pBuffer->getPlayPos();
+        const mixxx::audio::SampleRate trackSampleRate =
+                m_pBuffer->getTrackSampleRate();
+        const double outputSampleRate = m_sampleRate.get();
+        m_pPregain->setTrackPosition(
+                playPos.isValid() && trackSampleRate.isValid()
+                        ? playPos.value() / trackSampleRate
+                        : -1,
+                outputSampleRate > 0
+                        ? bufferSize / mixxx::kEngineChannelOutputCount /
+                                outputSampleRate
+                        : 0);
         m_bPassthroughWasActive = false;
     }
 
@@ -285,6 +323,10 @@ EngineBuffer* EngineDeck::getEngineBuffer() {
     return m_pBuffer;
 }
 
+void EngineDeck::setLoudnessCurve(mixxx::ConstLoudnessCurvePointer pLoudnessCurve) {
+    m_pPregain->setLoudnessCurve(pLoudnessCurve);
+}
+
 EngineChannel::ActiveState EngineDeck::updateActiveState() {
     bool active = false;
     if (m_bPassthroughWasActive && !m_bPassthroughIsActive) {
@@ -342,6 +384,14 @@ bool EngineDeck::isPassthroughActive() const {
     return (m_bPassthroughIsActive && m_sampleBuffer);
 }
 
+#ifdef __STEM__
+bool EngineDeck::isProcessingStems() const {
+    // Mirrors the condition in process() that selects processStem() over the
+    // plain buffer processing.
+    return m_pBuffer->getChannelCount() > mixxx::kEngineChannelOutputCount;
+}
+#endif
+
 void EngineDeck::slotPassthroughToggle(double v) {
     m_bPassthroughIsActive = v > 0;
 }
@@ -5,6 +5,7 @@
 #include "engine/channels/enginechannel.h"
 #include "preferences/usersettings.h"
 #include "soundio/soundmanagerutil.h"
+#include "track/loudnesscurve.h"
 #include "track/track_decl.h"
 #include "util/samplebuffer.h"
 
@@ -43,6 +44,10 @@ class EngineDeck : public EngineChannel, public AudioDestination {
     // TODO(XXX) This hack needs to be removed.
     EngineBuffer* getEngineBuffer() override;
 
+    // Forwards the short-term loudness curve of the loaded track to the
+    // pregain stage. Thread-safe, called from the main thread.
+    void setLoudnessCurve(mixxx::ConstLoudnessCurvePointer pLoudnessCurve);
+
     EngineChannel::ActiveState updateActiveState() override;
 
     // This is called by SoundManager whenever there are new samples from the
@@ -66,6 +71,10 @@ class EngineDeck : public EngineChannel, public AudioDestination {
     bool isPassthroughActive() const;
 
 #ifdef __STEM__
+    // Returns true if process() takes the processStem() path, i.e. a stem
+    // track is loaded. See EngineChannel::isProcessingStems().
+    bool isProcessingStems() const override;
+
     // Clone the stem state (gain and volume) from deckToClone to this. Doesn't
     // check if the loaded track is a stem so this should only be used in case
     // of stem track
@@ -100,6 +109,9 @@ class EngineDeck : public EngineChannel, public AudioDestination {
 #ifdef __STEM__
     // Stem buffer used to retrieve all the channel to mix together
     mixxx::SampleBuffer m_stemBuffer;
+    // Stereo scratch buffer used to extract a single stem for effect
+    // processing before it gets mixed into the output
+    mixxx::SampleBuffer m_stemWorkBuffer;
     std::unique_ptr<ControlObject> m_pStemCount;
     std::vector<std::unique_ptr<ControlPotmeter>> m_stemGain;
     std::vector<std::unique_ptr<ControlPushButton>> m_stemMute;
@@ -1437,8 +1437,23 @@ void CueControl::hintReader(gsl::not_null<HintVector*> pHintList) {
     // constructor and getPosition()->get() is a ControlObject
     for (const auto& pControl : std::as_const(m_hotcueControls)) {
         appendCueHint(pHintList, pControl->getPosition(), Hint::Type::HotCue);
-        if (isValidJumpCue(pControl, HotcueControl::Status::Set)) {
+        if (isValidJumpCue(pControl, HotcueControl::Status::Set) ||
+                isValidJumpCue(pControl)) {
             appendCueHint(pHintList, pControl->getEndPosition(), Hint::Type::HotCue);
+            // An armed jump wraps through ReadAheadManager like a loop: the
+            // seam crossfade reads the window just before the (possibly
+            // quantized) jump target. Pin that pre-roll as well, so taking
+            // the jump never pays a cache miss.
+            const mixxx::audio::FramePos targetPosition =
+                    quantizeCuePoint(pControl->getPosition());
+            if (targetPosition.isValid()) {
+                const Hint preRollHint = {
+                        /*.frame =*/static_cast<SINT>(
+                                targetPosition.toLowerFrameBoundary().value()),
+                        /*.frameCount =*/Hint::kFrameCountBackward,
+                        /*.type =*/Hint::Type::HotCue};
+                pHintList->append(preRollHint);
+            }
         }
     }
 
@@ -1446,6 +1461,7 @@ void CueControl::hintReader(gsl::not_null<HintVector*> pHintList) {
     appendCueHint(pHintList, m_pIntroStartPosition->get(), Hint::Type::IntroStart);
     appendCueHint(pHintList, m_pIntroEndPosition->get(), Hint::Type::IntroEnd);
     appendCueHint(pHintList, m_pOutroStartPosition->get(), Hint::Type::OutroStart);
+    appendCueHint(pHintList, m_pOutroEndPosition->get(), Hint::Type::OutroEnd);
 }
 
 // Moves the cue point to current position or to closest beat in case
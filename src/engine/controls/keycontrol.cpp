@@ -2,6 +2,7 @@
 
 #include <QPair>
 #include <QtDebug>
+#include <limits>
 
 #include "control/controlobject.h"
 #include "control/controlpotmeter.h"
@@ -38,7 +39,9 @@ KeyControl::KeyControl(const QString& group,
           m_pFileKey(std::make_unique<ControlObject>(ConfigKey(group, "file_key"))),
           m_pEngineKey(std::make_unique<ControlObject>(ConfigKey(group, "key"))),
           m_pEngineKeyDistance(std::make_unique<ControlPotmeter>(
-                  ConfigKey(group, "visual_key_distance"), -0.5, 0.5)) {
+                  ConfigKey(group, "visual_key_distance"), -0.5, 0.5)),
+          m_lastFileKeyNumeric(std::numeric_limits<double>::lowest()),
+          m_lastPitchOctaves(std::numeric_limits<double>::lowest()) {
     m_pitchRateInfo.pitchRatio = 1.0;
     m_pitchRateInfo.tempoRatio = 1.0;
     m_pitchRateInfo.pitchTweakRatio = 1.0;
@@ -283,7 +286,7 @@ void KeyControl::updateRate() {
     // decimals (e.g. 1 - 1.73123e-09) after pitchRatio calculation round-trip.
     // Round to 1.0 to avoid false positive pitch offset (pitchOctaves != 0).
     double pitchRatioDiffTo1 = fabs(1.0 - m_pitchRateInfo.pitchRatio);
-    if (0.0 < pitchRatioDiffTo1 && pitchRatioDiffTo1 < pow(10, -9)) { // 0.000000001
+    if (0.0 < pitchRatioDiffTo1 && pitchRatioDiffTo1 < 1e-9) { // 0.000000001
         m_pitchRateInfo.pitchRatio = 1.0;
         // recalculating doesn't make sense here, the rounding offset will
         // occur again after updatePitch request from enginebuffer
@@ -304,6 +307,17 @@ void KeyControl::slotFileKeyChanged(double value) {
 }
 
 void KeyControl::updateKeyCOs(double fileKeyNumeric, double pitchOctaves) {
+    if (fileKeyNumeric == m_lastFileKeyNumeric &&
+            pitchOctaves == m_lastPitchOctaves) {
+        // Neither input changed since the last run, the key scaling and all
+        // controls set below would come out identical. This is the common
+        // case when pitch bending with keylock enabled, where every rate
+        // update ends up here with an unchanged locked pitch.
+        return;
+    }
+    m_lastFileKeyNumeric = fileKeyNumeric;
+    m_lastPitchOctaves = pitchOctaves;
+
     mixxx::track::io::key::ChromaticKey fileKey =
             KeyUtils::keyFromNumericValue(fileKeyNumeric);
 
@@ -71,6 +71,11 @@ class KeyControl : public EngineControl {
     std::unique_ptr<ControlPotmeter> m_pEngineKeyDistance;
 
     struct PitchTempoRatio m_pitchRateInfo;
+    // Inputs of the last updateKeyCOs() run, so repeated rate updates with an
+    // unchanged pitch (e.g. pitch bending with keylock on) skip the key
+    // scaling and control updates.
+    double m_lastFileKeyNumeric;
+    double m_lastPitchOctaves;
     QAtomicInt m_updatePitchRequest;
     QAtomicInt m_updatePitchAdjustRequest;
     QAtomicInt m_updateRateRequest;
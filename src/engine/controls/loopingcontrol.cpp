@@ -562,6 +562,13 @@ void LoopingControl::hintReader(gsl::not_null<HintVector*> pHintList) {
                     loopInfo.startPosition.toLowerFrameBoundary().value());
             loop_hint.frameCount = Hint::kFrameCountForward;
             pHintList->append(loop_hint);
+            // When wrapping around at the loop end, ReadAheadManager
+            // crossfades the seam with samples read from just before the
+            // loop start. Pin that pre-roll window as well, so the seam
+            // crossfade read never misses the cache, regardless of how
+            // short the loop is.
+            loop_hint.frameCount = Hint::kFrameCountBackward;
+            pHintList->append(loop_hint);
         }
         if (loopInfo.endPosition.isValid()) {
             loop_hint.type = Hint::Type::LoopEndEnabled;
@@ -569,6 +576,10 @@ void LoopingControl::hintReader(gsl::not_null<HintVector*> pHintList) {
                     loopInfo.endPosition.toUpperFrameBoundary().value());
             loop_hint.frameCount = Hint::kFrameCountBackward;
             pHintList->append(loop_hint);
+            // Same for looping in reverse: the seam crossfade then reads
+            // the window just past the loop end.
+            loop_hint.frameCount = Hint::kFrameCountForward;
+            pHintList->append(loop_hint);
         }
     } else {
         if (loopInfo.startPosition.isValid()) {
@@ -595,6 +606,7 @@ void LoopingControl::hintReader(gsl::not_null<HintVector*> pHintList) {
                         .toLowerFrameBoundary()
                         .value());
         loop_hint.frameCount = Hint::kFrameCountForward;
+        pHintList->append(loop_hint);
     }
 }
 
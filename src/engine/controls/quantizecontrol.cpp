@@ -76,7 +76,10 @@ void QuantizeControl::playPosChanged(mixxx::audio::FramePos position) {
                     m_pCONextBeat->get());
     if (!prevBeatPosition.isValid() || position < prevBeatPosition ||
             !nextBeatPosition.isValid() || position > nextBeatPosition) {
-        lookupBeatPositions(position);
+        // Unlike trackLoaded()/trackBeatsUpdated(), which run in worker
+        // threads, this is only called from the engine callback, so the
+        // lookup may go through the cached beat cursor.
+        lookupBeatPositionsFromCursor(position);
     }
     updateClosestBeat(position);
 }
@@ -94,6 +97,23 @@ void QuantizeControl::lookupBeatPositions(mixxx::audio::FramePos position) {
     }
 }
 
+void QuantizeControl::lookupBeatPositionsFromCursor(mixxx::audio::FramePos position) {
+    DEBUG_ASSERT(position.isValid());
+    const mixxx::BeatsPointer pBeats = m_pBeats;
+    if (!pBeats) {
+        return;
+    }
+    if (!m_beatCursor || m_beatCursor->getBeats() != pBeats) {
+        // The track or its beats changed since the last lookup.
+        m_beatCursor = pBeats->createCursor();
+    }
+    const mixxx::BeatCursor::PrevNextBeats prevNextBeats =
+            m_beatCursor->findPrevNextBeats(position, false);
+    // FIXME: -1.0 is a valid frame position, should we set the COs to NaN?
+    m_pCOPrevBeat->set(prevNextBeats.prevPosition.toEngineSamplePosMaybeInvalid());
+    m_pCONextBeat->set(prevNextBeats.nextPosition.toEngineSamplePosMaybeInvalid());
+}
+
 void QuantizeControl::updateClosestBeat(mixxx::audio::FramePos position) {
     DEBUG_ASSERT(position.isValid());
     if (!m_pBeats) {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "engine/controls/enginecontrol.h"
 #include "preferences/usersettings.h"
 #include "track/beats.h"
@@ -23,6 +25,9 @@ class QuantizeControl : public EngineControl {
   private:
     // Update positions of previous and next beats from beatgrid.
     void lookupBeatPositions(mixxx::audio::FramePos position);
+    // Same as lookupBeatPositions, but through the cached beat cursor.
+    // Must only be called from the engine callback.
+    void lookupBeatPositionsFromCursor(mixxx::audio::FramePos position);
     // Update position of the closest beat based on existing previous and
     // next beat values.  Usually callers will call lookupBeatPositions first.
     void updateClosestBeat(mixxx::audio::FramePos position);
@@ -35,4 +40,11 @@ class QuantizeControl : public EngineControl {
 
     // m_pBeats is written from an engine worker thread
     mixxx::BeatsPointer m_pBeats;
+
+    // Caches the position of the last beat lookup so that the
+    // once-per-beat lookups during playback move the iterator
+    // incrementally instead of searching the grid from scratch. Only
+    // accessed from the engine callback (playPosChanged()) and recreated
+    // there whenever m_pBeats changed.
+    std::optional<mixxx::BeatCursor> m_beatCursor;
 };
@@ -9,6 +9,7 @@ VinylControlControl::VinylControlControl(const QString& group, UserSettingsPoint
         : EngineControl(group, pConfig),
           m_playEnabled(ConfigKey(group, QStringLiteral("play"))),
           m_inputConfigured(ConfigKey(group, QStringLiteral("input_configured"))),
+          m_hotcueCacheDirty(true),
           m_bSeekRequested(false) {
     m_pControlVinylStatus = std::make_unique<ControlObject>(
             ConfigKey(group, QStringLiteral("vinylcontrol_status")), this);
@@ -73,7 +74,19 @@ VinylControlControl::VinylControlControl(const QString& group, UserSettingsPoint
 }
 
 void VinylControlControl::trackLoaded(TrackPointer pNewTrack) {
+    disconnect(m_cuesUpdatedConnection);
+    if (pNewTrack) {
+        // Invalidate the needle-drop cue cache whenever the cue list of the
+        // loaded track changes. cuesUpdated may be emitted from any thread,
+        // so the direct connection must only touch the atomic flag.
+        m_cuesUpdatedConnection = connect(pNewTrack.get(),
+                &Track::cuesUpdated,
+                this,
+                [this] { m_hotcueCacheDirty.store(true); },
+                Qt::DirectConnection);
+    }
     m_pTrack = pNewTrack;
+    m_hotcueCacheDirty.store(true);
 }
 
 void VinylControlControl::slotControlEnabledChangeRequest(double v) {
@@ -144,20 +157,25 @@ void VinylControlControl::slotControlVinylSeek(double fractionalPos) {
         mixxx::audio::FrameDiff_t shortestDistance = 0;
         mixxx::audio::FramePos nearestPlayPos;
 
-        const QList<CuePointer> cuePoints(pTrack->getCuePoints());
-        QListIterator<CuePointer> it(cuePoints);
-        while (it.hasNext()) {
-            CuePointer pCue(it.next());
-            if (pCue->getType() != mixxx::CueType::HotCue || pCue->getHotCue() == -1) {
-                continue;
-            }
-
-            const mixxx::audio::FramePos cuePosition = pCue->getPosition();
-            if (!cuePosition.isValid()) {
-                continue;
+        const auto locker = lockMutex(&m_hotcueCacheMutex);
+        if (m_hotcueCacheDirty.exchange(false)) {
+            m_hotcuePositionCache.clear();
+            const QList<CuePointer> cuePoints(pTrack->getCuePoints());
+            for (const CuePointer& pCue : cuePoints) {
+                if (pCue->getType() != mixxx::CueType::HotCue ||
+                        pCue->getHotCue() == -1) {
+                    continue;
+                }
+                const mixxx::audio::FramePos cuePosition = pCue->getPosition();
+                if (cuePosition.isValid()) {
+                    m_hotcuePositionCache.push_back(cuePosition);
+                }
             }
-            // pick cues closest to newPlayPos
-            if (!nearestPlayPos.isValid() || (fabs(newPlayPos - cuePosition) < shortestDistance)) {
+        }
+        // pick the cached cue closest to newPlayPos
+        for (const mixxx::audio::FramePos cuePosition : m_hotcuePositionCache) {
+            if (!nearestPlayPos.isValid() ||
+                    (fabs(newPlayPos - cuePosition) < shortestDistance)) {
                 nearestPlayPos = cuePosition;
                 shortestDistance = fabs(newPlayPos - cuePosition);
             }
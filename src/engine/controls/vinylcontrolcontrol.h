@@ -1,9 +1,14 @@
 #pragma once
 
+#include <atomic>
+#include <vector>
+
+#include "audio/frame.h"
 #include "control/pollingcontrolproxy.h"
 #include "engine/controls/enginecontrol.h"
 #include "preferences/usersettings.h"
 #include "track/track_decl.h"
+#include "util/compatibility/qmutex.h"
 
 class ControlObject;
 class ControlPushButton;
@@ -42,5 +47,13 @@ class VinylControlControl : public EngineControl {
 
     TrackPointer m_pTrack; // is written from an engine worker thread
 
+    // Needle-drop cue cache: hotcue positions of the loaded track, rebuilt
+    // lazily so a needle drop in hotcue cueing mode does not have to lock
+    // the track and copy its full cue list on the vinyl control thread.
+    mutable QMutex m_hotcueCacheMutex;
+    std::vector<mixxx::audio::FramePos> m_hotcuePositionCache;
+    std::atomic<bool> m_hotcueCacheDirty;
+    QMetaObject::Connection m_cuesUpdatedConnection;
+
     bool m_bSeekRequested;
 };
@@ -1,26 +1,50 @@
 #include "engine/effects/engineeffect.h"
 
+#include "control/controlobject.h"
 #include "effects/backends/effectsbackendmanager.h"
 #include "engine/effects/engineeffectparameter.h"
 #include "engine/engine.h"
 #include "util/defs.h"
+#include "util/performancetimer.h"
 #include "util/sample.h"
+#include "util/stat.h"
 
 namespace {
 
 // Used during initialization where the SoundSevice is not set up
 constexpr auto kInitalSampleRate = mixxx::audio::SampleRate(96000);
 
+// Smoothing factor for the exponential moving average published via the
+// "process_load" control; 0.05 averages over roughly the last 20 process()
+// calls so short spikes remain visible without making the value jitter.
+constexpr double kProcessLoadSmoothing = 0.05;
+
+constexpr Stat::ComputeFlags kProcessTimeComputeFlags = Stat::COUNT |
+        Stat::SUM | Stat::AVERAGE | Stat::MAX | Stat::MIN |
+        Stat::SAMPLE_VARIANCE;
+
+// Used to advance parameter ramps when the processed channel provides no
+// beat length, e.g. no track is loaded or the track has no beatgrid.
+// 0.5 s/beat corresponds to 120 BPM.
+constexpr double kFallbackSecondsPerBeat = 0.5;
+
 } // namespace
 
-EngineEffect::EngineEffect(EffectManifestPointer pManifest,
+EngineEffect::EngineEffect(const QString& group,
+        EffectManifestPointer pManifest,
         EffectsBackendManagerPointer pBackendManager,
         const QSet<ChannelHandleAndGroup>& activeInputChannels,
         const QSet<ChannelHandleAndGroup>& registeredInputChannels,
         const QSet<ChannelHandleAndGroup>& registeredOutputChannels)
         : m_pManifest(pManifest),
           m_pProcessor(pBackendManager->createProcessor(pManifest)),
-          m_parameters(pManifest->parameters().size()) {
+          m_parameters(pManifest->parameters().size()),
+          m_smoothedProcessLoad(0.0),
+          m_processTimeStatKey(
+                  QStringLiteral("EngineEffect::process() ") + pManifest->name()),
+          m_pProcessLoad(std::make_unique<ControlObject>(
+                  ConfigKey(group, QStringLiteral("process_load")))) {
+    m_pProcessLoad->setReadOnly();
     const QList<EffectManifestParameterPointer>& parameters = m_pManifest->parameters();
     for (int i = 0; i < parameters.size(); ++i) {
         EffectManifestParameterPointer param = parameters.at(i);
@@ -28,6 +52,7 @@ EngineEffect::EngineEffect(EffectManifestPointer pManifest,
         m_parameters[i] = pParameter;
         m_parametersById[param->id()] = pParameter;
     }
+    m_parameterRamps.reserve(m_parameters.size());
 
     for (const ChannelHandleAndGroup& inputChannel : registeredInputChannels) {
         ChannelHandleMap<EffectEnableState> outputChannelMap;
@@ -109,6 +134,9 @@ bool EngineEffect::processEffectsRequest(EffectsRequest& message,
         pParameter = m_parameters.value(
                 message.SetParameterParameters.iParameter, EngineEffectParameterPointer());
         if (pParameter) {
+            // A direct set overrides any automation still running for this
+            // parameter.
+            cancelParameterRamp(pParameter);
             pParameter->setValue(message.value);
             response.success = true;
         } else {
@@ -117,12 +145,86 @@ bool EngineEffect::processEffectsRequest(EffectsRequest& message,
         }
         pResponsePipe->writeMessage(response);
         return true;
+    case EffectsRequest::SET_PARAMETER_RAMP:
+        if (kEffectDebugOutput) {
+            qDebug() << debugString() << "SET_PARAMETER_RAMP"
+                     << "parameter" << message.SetParameterRamp.iParameter
+                     << "target" << message.value
+                     << "beats" << message.SetParameterRamp.beatSpan;
+        }
+        pParameter = m_parameters.value(
+                message.SetParameterRamp.iParameter, EngineEffectParameterPointer());
+        if (pParameter) {
+            cancelParameterRamp(pParameter);
+            if (message.SetParameterRamp.beatSpan > 0) {
+                m_parameterRamps.push_back(ParameterRamp{
+                        pParameter,
+                        pParameter->value(),
+                        message.value,
+                        message.SetParameterRamp.beatSpan,
+                        0.0,
+                        ChannelHandle()});
+            } else {
+                pParameter->setValue(message.value);
+            }
+            response.success = true;
+        } else {
+            response.success = false;
+            response.status = EffectsResponse::NO_SUCH_PARAMETER;
+        }
+        pResponsePipe->writeMessage(response);
+        return true;
     default:
         break;
     }
     return false;
 }
 
+void EngineEffect::cancelParameterRamp(const EngineEffectParameterPointer& pParameter) {
+    for (auto it = m_parameterRamps.begin(); it != m_parameterRamps.end(); ++it) {
+        if (it->pParameter == pParameter) {
+            m_parameterRamps.erase(it);
+            return;
+        }
+    }
+}
+
+void EngineEffect::advanceParameterRamps(const ChannelHandle& inputHandle,
+        const std::size_t numSamples,
+        const mixxx::audio::SampleRate sampleRate,
+        const GroupFeatureState& groupFeatures) {
+    const double bufferSeconds = numSamples /
+            (mixxx::kEngineChannelOutputCount * static_cast<double>(sampleRate));
+    double secondsPerBeat = kFallbackSecondsPerBeat;
+    if (groupFeatures.beat_length.has_value() &&
+            groupFeatures.beat_length->seconds > 0) {
+        secondsPerBeat = groupFeatures.beat_length->seconds;
+    }
+    const double beatsThisBuffer = bufferSeconds / secondsPerBeat;
+
+    for (auto it = m_parameterRamps.begin(); it != m_parameterRamps.end();) {
+        ParameterRamp& ramp = *it;
+        // Bind the ramp to the first channel that processes it so effects
+        // enabled for multiple channels advance it only once per callback.
+        if (!ramp.inputChannel.valid()) {
+            ramp.inputChannel = inputHandle;
+        } else if (ramp.inputChannel != inputHandle) {
+            ++it;
+            continue;
+        }
+        ramp.beatsElapsed += beatsThisBuffer;
+        if (ramp.beatsElapsed >= ramp.beatSpan) {
+            ramp.pParameter->setValue(ramp.targetValue);
+            it = m_parameterRamps.erase(it);
+        } else {
+            const double fraction = ramp.beatsElapsed / ramp.beatSpan;
+            ramp.pParameter->setValue(ramp.startValue +
+                    (ramp.targetValue - ramp.startValue) * fraction);
+            ++it;
+        }
+    }
+}
+
 bool EngineEffect::process(const ChannelHandle& inputHandle,
         const ChannelHandle& outputHandle,
         const CSAMPLE* pInput,
@@ -131,6 +233,10 @@ bool EngineEffect::process(const ChannelHandle& inputHandle,
         const mixxx::audio::SampleRate sampleRate,
         const EffectEnableState chainEnableState,
         const GroupFeatureState& groupFeatures) {
+    if (!m_parameterRamps.empty()) {
+        advanceParameterRamps(inputHandle, numSamples, sampleRate, groupFeatures);
+    }
+
     // Compute the effective enable state from the combination of the effect's state
     // for the channel and the state passed from the EngineEffectChain.
 
@@ -182,6 +288,9 @@ bool EngineEffect::process(const ChannelHandle& inputHandle,
                 sampleRate,
                 numSamples / mixxx::kEngineChannelOutputCount);
 
+        PerformanceTimer processTimer;
+        processTimer.start();
+
         m_pProcessor->process(inputHandle,
                 outputHandle,
                 pInput,
@@ -212,6 +321,21 @@ bool EngineEffect::process(const ChannelHandle& inputHandle,
                         mixxx::kEngineChannelOutputCount);
             }
         }
+
+        // Publish how much of the callback period this effect consumed, so
+        // an expensive effect can be identified while Mixxx is running by
+        // watching the slot's "process_load" control or, in developer mode,
+        // the per-effect timing stats.
+        const mixxx::Duration elapsed = processTimer.elapsed();
+        const double bufferNanos = numSamples * 1e9 /
+                (mixxx::kEngineChannelOutputCount * sampleRate);
+        const double load = elapsed.toDoubleNanos() / bufferNanos;
+        m_smoothedProcessLoad += kProcessLoadSmoothing * (load - m_smoothedProcessLoad);
+        m_pProcessLoad->set(m_smoothedProcessLoad);
+        Stat::track(m_processTimeStatKey,
+                Stat::DURATION_NANOSEC,
+                kProcessTimeComputeFlags,
+                elapsed.toDoubleNanos());
     }
 
     // Now that the EffectProcessor has been sent the intermediate enabling/disabling
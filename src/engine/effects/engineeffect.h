@@ -5,6 +5,7 @@
 #include <QString>
 #include <QVector>
 #include <memory>
+#include <vector>
 
 #include "audio/types.h"
 #include "effects/backends/effectmanifest.h"
@@ -13,6 +14,8 @@
 #include "engine/effects/message.h"
 #include "util/types.h"
 
+class ControlObject;
+
 /// EngineEffect is a generic wrapper around an EffectProcessor which intermediates
 /// between an EffectSlot and the EffectProcessor. It implements the logic to handle
 /// changes of state (enable switch, chain routing switches, parameters' state) so
@@ -20,7 +23,8 @@
 class EngineEffect final : public EffectsRequestHandler {
   public:
     /// Called in main thread by EffectSlot
-    EngineEffect(EffectManifestPointer pManifest,
+    EngineEffect(const QString& group,
+            EffectManifestPointer pManifest,
             EffectsBackendManagerPointer pBackendManager,
             const QSet<ChannelHandleAndGroup>& activeInputChannels,
             const QSet<ChannelHandleAndGroup>& registeredInputChannels,
@@ -64,6 +68,30 @@ class EngineEffect final : public EffectsRequestHandler {
         return QString("EngineEffect(%1)").arg(m_pManifest->name());
     }
 
+    /// A scheduled parameter automation, see EffectsRequest::SET_PARAMETER_RAMP.
+    /// The parameter value is interpolated from startValue to targetValue over
+    /// beatSpan beats of the processed channel, advanced once per engine
+    /// callback in process(). This happens in the audio thread, so unlike
+    /// per-callback updates sent by controller scripts the sweep cannot jitter
+    /// or step behind the control rate of the sender.
+    struct ParameterRamp {
+        EngineEffectParameterPointer pParameter;
+        double startValue;
+        double targetValue;
+        double beatSpan;
+        double beatsElapsed;
+        // The ramp advances only for the first input channel that processes
+        // it, so effects enabled for multiple channels do not advance the
+        // ramp multiple times per callback.
+        ChannelHandle inputChannel;
+    };
+
+    void advanceParameterRamps(const ChannelHandle& inputHandle,
+            const std::size_t numSamples,
+            const mixxx::audio::SampleRate sampleRate,
+            const GroupFeatureState& groupFeatures);
+    void cancelParameterRamp(const EngineEffectParameterPointer& pParameter);
+
     EffectManifestPointer m_pManifest;
     std::unique_ptr<EffectProcessor> m_pProcessor;
     ChannelHandleMap<ChannelHandleMap<EffectEnableState>> m_effectEnableStateForChannelMatrix;
@@ -72,4 +100,17 @@ class EngineEffect final : public EffectsRequestHandler {
     QVector<EngineEffectParameterPointer> m_parameters;
     QMap<QString, EngineEffectParameterPointer> m_parametersById;
 
+    // Active parameter automations, at most one per parameter. Only accessed
+    // from the audio thread; capacity is reserved in the constructor so the
+    // audio thread never allocates.
+    std::vector<ParameterRamp> m_parameterRamps;
+
+    // Fraction of the callback period spent in the EffectProcessor, smoothed
+    // over recent process() calls. Only written by the audio thread and
+    // published through the slot's "process_load" control.
+    double m_smoothedProcessLoad;
+    // Pre-built StatsManager key, so reporting in the audio thread does not
+    // format strings.
+    const QString m_processTimeStatKey;
+    std::unique_ptr<ControlObject> m_pProcessLoad;
 };
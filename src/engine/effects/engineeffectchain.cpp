@@ -171,6 +171,21 @@ bool EngineEffectChain::disableForInputChannel(ChannelHandle inputHandle) {
     return true;
 }
 
+bool EngineEffectChain::enabledForChannel(const ChannelHandle& inputHandle,
+        const ChannelHandle& outputHandle) const {
+    // ChannelHandleMap::at() does not check bounds, so handles that were
+    // registered after this chain was set up must not be looked up blindly.
+    if (static_cast<int>(inputHandle) >= m_chainStatusForChannelMatrix.size()) {
+        return false;
+    }
+    const ChannelHandleMap<ChannelStatus>& outputMap =
+            m_chainStatusForChannelMatrix.at(inputHandle);
+    if (static_cast<int>(outputHandle) >= outputMap.size()) {
+        return false;
+    }
+    return outputMap.at(outputHandle).enableState != EffectEnableState::Disabled;
+}
+
 bool EngineEffectChain::process(const ChannelHandle& inputHandle,
         const ChannelHandle& outputHandle,
         CSAMPLE* pIn,
@@ -254,9 +269,9 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
                                 m_mixMode == EffectChainMixMode::DryPlusWet;
 
                         if (!skipAddingDry) {
-                            for (SINT i = 0; i <= static_cast<SINT>(numSamples); ++i) {
-                                pIntermediateOutput[i] += pIntermediateInput[i];
-                            }
+                            SampleUtil::add(pIntermediateOutput,
+                                    pIntermediateInput,
+                                    static_cast<SINT>(numSamples));
                         }
 
                         firstAddDryToWetEffectProcessed = true;
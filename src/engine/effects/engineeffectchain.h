@@ -45,6 +45,14 @@ class EngineEffectChain final : public EffectsRequestHandler {
             const GroupFeatureState& groupFeatures,
             bool fadeout);
 
+    /// called from audio thread
+    /// Returns whether process() may produce output for the given channel
+    /// pair. Channels in the intermediate Enabling/Disabling states still
+    /// count as enabled because they require process() calls to ramp the
+    /// signal and complete the transition.
+    bool enabledForChannel(const ChannelHandle& inputHandle,
+            const ChannelHandle& outputHandle) const;
+
   private:
     struct ChannelStatus {
         ChannelStatus()
@@ -1,6 +1,7 @@
 #include "engine/effects/engineeffectsdelay.h"
 
 #include "moc_engineeffectsdelay.cpp"
+#include "util/math.h"
 #include "util/rampingvalue.h"
 #include "util/sample.h"
 
@@ -19,10 +20,30 @@ EngineEffectsDelay::~EngineEffectsDelay() {
 void EngineEffectsDelay::process(CSAMPLE* pInOut,
         const std::size_t bufferSize) {
     if (m_prevDelaySamples == 0 && m_currentDelaySamples == 0) {
-        for (std::size_t i = 0; i < bufferSize; ++i) {
-            // Put samples into delay buffer.
-            m_pDelayBuffer[m_delayBufferWritePos] = pInOut[i];
-            m_delayBufferWritePos = (m_delayBufferWritePos + 1) % kDelayBufferSize;
+        // The delay buffer still has to be primed with the dry samples,
+        // so that setting a delay later can cross-fade from real signal
+        // history instead of stale buffer content. Copy the buffer in at
+        // most two contiguous chunks instead of per-sample ring buffer
+        // index arithmetic; with zero delay this priming is the whole
+        // work of this method and runs for every chain on every callback.
+        const SINT numSamples = static_cast<SINT>(bufferSize);
+        const SINT tailSize = kDelayBufferSize - m_delayBufferWritePos;
+        if (numSamples <= tailSize) {
+            SampleUtil::copy(m_pDelayBuffer + m_delayBufferWritePos,
+                    pInOut,
+                    numSamples);
+            m_delayBufferWritePos += numSamples;
+            if (m_delayBufferWritePos == kDelayBufferSize) {
+                m_delayBufferWritePos = 0;
+            }
+        } else {
+            SampleUtil::copy(m_pDelayBuffer + m_delayBufferWritePos,
+                    pInOut,
+                    tailSize);
+            SampleUtil::copy(m_pDelayBuffer,
+                    pInOut + tailSize,
+                    numSamples - tailSize);
+            m_delayBufferWritePos = numSamples - tailSize;
         }
 
         return;
@@ -38,15 +59,56 @@ void EngineEffectsDelay::process(CSAMPLE* pInOut,
             kDelayBufferSize;
 
     if (m_prevDelaySamples == m_currentDelaySamples) {
-        for (std::size_t i = 0; i < bufferSize; ++i) {
-            // Put samples into delay buffer.
-            m_pDelayBuffer[m_delayBufferWritePos] = pInOut[i];
-            m_delayBufferWritePos = (m_delayBufferWritePos + 1) % kDelayBufferSize;
+        // Steady state: the delay is constant, so the ring buffer can be
+        // written and read in contiguous blocks instead of with per-sample
+        // index arithmetic. The reads trail the writes by the delay. To keep
+        // the per-sample write/read ordering of the loop below, the buffer is
+        // processed in chunks no larger than the distance between the write
+        // position and the read position ahead of it, so that a chunk never
+        // overwrites delayed samples before they have been read.
+        const SINT numSamples = static_cast<SINT>(bufferSize);
+        const SINT maxChunkSamples = kDelayBufferSize - m_currentDelaySamples;
+        SINT processed = 0;
+        while (processed < numSamples) {
+            const SINT chunkSamples =
+                    math_min(numSamples - processed, maxChunkSamples);
 
-            // Take a delayed sample from the delay buffer
-            // and copy it to the destination buffer.
-            pInOut[i] = m_pDelayBuffer[delaySourcePos];
-            delaySourcePos = (delaySourcePos + 1) % kDelayBufferSize;
+            // Put the chunk into the delay buffer in at most two
+            // contiguous copies.
+            const SINT writeTail = kDelayBufferSize - m_delayBufferWritePos;
+            if (chunkSamples <= writeTail) {
+                SampleUtil::copy(m_pDelayBuffer + m_delayBufferWritePos,
+                        pInOut + processed,
+                        chunkSamples);
+            } else {
+                SampleUtil::copy(m_pDelayBuffer + m_delayBufferWritePos,
+                        pInOut + processed,
+                        writeTail);
+                SampleUtil::copy(m_pDelayBuffer,
+                        pInOut + processed + writeTail,
+                        chunkSamples - writeTail);
+            }
+            m_delayBufferWritePos =
+                    (m_delayBufferWritePos + chunkSamples) % kDelayBufferSize;
+
+            // Take the delayed chunk out of the delay buffer, again in at
+            // most two contiguous copies.
+            const SINT readTail = kDelayBufferSize - delaySourcePos;
+            if (chunkSamples <= readTail) {
+                SampleUtil::copy(pInOut + processed,
+                        m_pDelayBuffer + delaySourcePos,
+                        chunkSamples);
+            } else {
+                SampleUtil::copy(pInOut + processed,
+                        m_pDelayBuffer + delaySourcePos,
+                        readTail);
+                SampleUtil::copy(pInOut + processed + readTail,
+                        m_pDelayBuffer,
+                        chunkSamples - readTail);
+            }
+            delaySourcePos = (delaySourcePos + chunkSamples) % kDelayBufferSize;
+
+            processed += chunkSamples;
         }
 
     } else {
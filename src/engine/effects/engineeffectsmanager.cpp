@@ -1,6 +1,7 @@
 #include "engine/effects/engineeffectsmanager.h"
 
 #include "audio/types.h"
+#include "engine/callbackscratcharena.h"
 #include "engine/effects/engineeffect.h"
 #include "engine/effects/engineeffectchain.h"
 #include "util/defs.h"
@@ -9,12 +10,33 @@
 EngineEffectsManager::EngineEffectsManager(EffectsResponsePipe&& responsePipe)
         : m_responsePipe(std::move(responsePipe)),
           m_buffer1(kMaxEngineSamples),
-          m_buffer2(kMaxEngineSamples) {
+          m_buffer2(kMaxEngineSamples),
+          m_pIntermediateBuffer1(m_buffer1.data()),
+          m_pIntermediateBuffer2(m_buffer2.data()) {
     // Try to prevent memory allocation.
     m_effects.reserve(256);
 }
 
-void EngineEffectsManager::onCallbackStart() {
+void EngineEffectsManager::onCallbackStart(std::size_t bufferSize) {
+    // Acquire the intermediate buffers for this callback from the scratch
+    // arena. processInner() runs once per channel and output, but never needs
+    // its scratch to survive a call, so a single pair of chunks acquired here
+    // serves the whole callback. The chunks stay valid until the arena is
+    // reset at the top of the next callback. Outside of an arena scope (e.g.
+    // in tests) the pre-sized fallback buffers are used instead.
+    m_pIntermediateBuffer1 = m_buffer1.data();
+    m_pIntermediateBuffer2 = m_buffer2.data();
+    if (CallbackScratchArena* pArena = CallbackScratchArena::current()) {
+        const std::span<CSAMPLE> chunk1 =
+                pArena->allocate(static_cast<SINT>(bufferSize));
+        const std::span<CSAMPLE> chunk2 =
+                pArena->allocate(static_cast<SINT>(bufferSize));
+        if (!chunk1.empty() && !chunk2.empty()) {
+            m_pIntermediateBuffer1 = chunk1.data();
+            m_pIntermediateBuffer2 = chunk2.data();
+        }
+    }
+
     EffectsRequest* request = nullptr;
     while (m_responsePipe.readMessage(&request)) {
         EffectsResponse response(*request);
@@ -157,6 +179,19 @@ void EngineEffectsManager::processPostFaderAndMix(
             fadeout);
 }
 
+bool EngineEffectsManager::hasActivePostFaderEffects(
+        const ChannelHandle& inputHandle,
+        const ChannelHandle& outputHandle) const {
+    const QList<EngineEffectChain*>& chains =
+            m_chainsByStage.value(SignalProcessingStage::Postfader);
+    for (const EngineEffectChain* pChain : chains) {
+        if (pChain && pChain->enabledForChannel(inputHandle, outputHandle)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void EngineEffectsManager::processInner(
         const SignalProcessingStage stage,
         const ChannelHandle& inputHandle,
@@ -196,7 +231,7 @@ void EngineEffectsManager::processInner(
         // 3. Mix the temporary buffer into pOut
         //    ChannelMixer::applyEffectsAndMixChannels use
         //    this to mix channels into pOut regardless of whether any effects were processed.
-        CSAMPLE* pIntermediateInput = m_buffer1.data();
+        CSAMPLE* pIntermediateInput = m_pIntermediateBuffer1;
         if (oldGain == CSAMPLE_GAIN_ONE && newGain == CSAMPLE_GAIN_ONE) {
             // Avoid an unnecessary copy. EngineEffectChain::process does not modify the
             // input buffer when its input & output buffers are different, so this is okay.
@@ -209,10 +244,10 @@ void EngineEffectsManager::processInner(
         for (EngineEffectChain* pChain : chains) {
             if (pChain) {
                 // Select an unused intermediate buffer for the next output
-                if (pIntermediateInput == m_buffer1.data()) {
-                    pIntermediateOutput = m_buffer2.data();
+                if (pIntermediateInput == m_pIntermediateBuffer1) {
+                    pIntermediateOutput = m_pIntermediateBuffer2;
                 } else {
-                    pIntermediateOutput = m_buffer1.data();
+                    pIntermediateOutput = m_pIntermediateBuffer1;
                 }
 
                 if (pChain->process(inputHandle,
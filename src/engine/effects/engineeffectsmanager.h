@@ -24,7 +24,7 @@ class EngineEffectsManager final : public EffectsRequestHandler {
     EngineEffectsManager(EffectsResponsePipe&& responsePipe);
     ~EngineEffectsManager() override = default;
 
-    void onCallbackStart();
+    void onCallbackStart(std::size_t bufferSize);
 
     /// Process the prefader EngineEffectChains on the pInOut buffer, modifying
     /// the contents of the input buffer.
@@ -65,6 +65,13 @@ class EngineEffectsManager final : public EffectsRequestHandler {
             CSAMPLE_GAIN newGain = CSAMPLE_GAIN_ONE,
             bool fadeout = false);
 
+    /// Returns whether any postfader EngineEffectChain may produce output for
+    /// the given channel pair. Allows callers to skip the buffer round trip
+    /// through processPostFaderAndMix for channels without active effects.
+    bool hasActivePostFaderEffects(
+            const ChannelHandle& inputHandle,
+            const ChannelHandle& outputHandle) const;
+
     bool processEffectsRequest(
             EffectsRequest& message,
             EffectsResponsePipe* pResponsePipe) override;
@@ -100,6 +107,15 @@ class EngineEffectsManager final : public EffectsRequestHandler {
     QHash<SignalProcessingStage, QList<EngineEffectChain*>> m_chainsByStage;
     QList<EngineEffect*> m_effects;
 
+    // Fallback intermediate buffers, only used when processing happens
+    // outside of a callback scratch arena scope (e.g. in tests).
     mixxx::SampleBuffer m_buffer1;
     mixxx::SampleBuffer m_buffer2;
+
+    // Intermediate buffers of the current callback. Point into the callback
+    // scratch arena, acquired once per callback in onCallbackStart() and
+    // shared by all processInner() calls of that callback; the fallback
+    // buffers above otherwise.
+    CSAMPLE* m_pIntermediateBuffer1;
+    CSAMPLE* m_pIntermediateBuffer2;
 };
@@ -29,6 +29,7 @@ struct EffectsRequest {
         // Messages for EngineEffect
         SET_EFFECT_PARAMETERS,
         SET_PARAMETER_PARAMETERS,
+        SET_PARAMETER_RAMP,
 
         // Must come last.
         NUM_REQUEST_TYPES
@@ -96,9 +97,15 @@ struct EffectsRequest {
         struct {
             int iParameter;
         } SetParameterParameters;
+        struct {
+            int iParameter;
+            // Length of the ramp in beats of the channel the effect
+            // processes. The target value is passed in `value`.
+            double beatSpan;
+        } SetParameterRamp;
     };
 
-    // Used by SET_EFFECT_PARAMETER.
+    // Used by SET_EFFECT_PARAMETER and SET_PARAMETER_RAMP.
     double value;
 };
 
@@ -31,6 +31,7 @@
 #include "util/defs.h"
 #include "util/logger.h"
 #include "util/sample.h"
+#include "util/time.h"
 #include "util/timer.h"
 #include "waveform/visualplayposition.h"
 
@@ -51,6 +52,11 @@ constexpr double kLinearScalerElipsis =
 // Rate at which the playpos slider is updated
 constexpr int kPlaypositionUpdateRate = 15; // updates per second
 
+// Upper bound for the seek latency compensation in processSeek().
+// Larger gaps between request and processing indicate a stalled
+// callback or a stale timestamp and are not compensated.
+constexpr double kMaxSeekLatencyCompensationSeconds = 0.1;
+
 const QString kAppGroup = QStringLiteral("[App]");
 
 } // anonymous namespace
@@ -77,6 +83,7 @@ EngineBuffer::EngineBuffer(const QString& group,
           m_scratching_old(false),
           m_reverse_old(false),
           m_pitch_old(0),
+          m_rateParameters(RateParameters{}),
           m_baserate_old(0),
           m_rate_old(0.),
           m_trackEndPositionOld(mixxx::audio::kInvalidFramePos),
@@ -270,6 +277,10 @@ EngineBuffer::EngineBuffer(const QString& group,
             m_pCueControl);
     m_pReadAheadManager->addRateControl(m_pRateControl);
 
+    m_seekLatencyCompensationEnabled = m_pConfig->getValue(
+            ConfigKey(kAppGroup, QStringLiteral("seek_latency_compensation")),
+            false);
+
     m_pKeylockEngine = new ControlProxy(kAppGroup, QStringLiteral("keylock_engine"), this);
     m_pKeylockEngine->connectValueChanged(this,
             &EngineBuffer::slotKeylockEngineChanged,
@@ -415,7 +426,10 @@ void EngineBuffer::queueNewPlaypos(mixxx::audio::FramePos position, enum SeekReq
         // use SEEK_STANDARD for that
         seekType = SEEK_STANDARD;
     }
-    m_queuedSeek.setValue({position, seekType});
+    // Take the timestamp in the requesting thread (GUI or controller),
+    // so that the latency until the engine picks the seek up can be
+    // compensated in processSeek().
+    m_queuedSeek.setValue({position, seekType, mixxx::Time::elapsed().toIntegerNanos()});
 }
 
 void EngineBuffer::requestSyncPhase() {
@@ -1120,6 +1134,18 @@ void EngineBuffer::processTrackLocked(
 
     m_rate_old = rate;
 
+    // Publish the coherent snapshot of this callback's scaler parameters for
+    // off-callback readers. ControlValueAtomic keeps both sides wait-free.
+    m_rateParameters.setValue(RateParameters{
+            baseSampleRate,
+            speed,
+            tempoRatio,
+            pitchRatio,
+            keylock_enabled,
+            is_scratching,
+            is_reverse,
+            paused});
+
     // If the buffer is not paused, then scale the audio.
     if (!bCurBufferPaused) {
         // Perform scaling of Reader buffer into buffer.
@@ -1261,6 +1287,7 @@ void EngineBuffer::process(CSAMPLE* pOutput, const std::size_t bufferSize) {
         m_speed_old = 0;
         m_actual_speed = 0;
         m_scratching_old = false;
+        m_rateParameters.setValue(RateParameters{});
     }
 
 #ifdef __SCALER_DEBUG__
@@ -1401,6 +1428,25 @@ void EngineBuffer::processSeek(bool paused) {
         return;
     }
 
+    // Compensate for the latency between the moment the seek was
+    // requested and the start of this buffer: land where the playhead
+    // would be if the seek had been applied at request time. Without
+    // this, an unquantized hotcue pressed right after a buffer boundary
+    // starts audibly late at large buffer sizes. Phase seeks are
+    // excluded, their position comes from the beat grid below.
+    if (m_seekLatencyCompensationEnabled && !paused &&
+            queuedSeek.queuedAtNanos != 0 &&
+            !(seekType & SEEK_PHASE)) {
+        const double elapsedSeconds =
+                (mixxx::Time::elapsed().toIntegerNanos() -
+                        queuedSeek.queuedAtNanos) /
+                1e9;
+        if (elapsedSeconds > 0 &&
+                elapsedSeconds < kMaxSeekLatencyCompensationSeconds) {
+            position += elapsedSeconds * m_sampleRate.toDouble() * m_rate_old;
+        }
+    }
+
     // Don't allow the playposition to go past the end.
     position = std::min<mixxx::audio::FramePos>(position, m_trackEndPositionOld);
 
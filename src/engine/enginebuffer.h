@@ -110,6 +110,24 @@ class EngineBuffer : public EngineObject {
 
     void bindWorkers(EngineWorkerScheduler* pWorkerScheduler);
 
+    // Coherent snapshot of the scaler-relevant rate parameters of one
+    // callback, published wait-free once per callback. Unlike reading the
+    // individual (not thread-safe) accessors below, a snapshot can never mix
+    // values from two different callbacks, e.g. a new speed with the pitch
+    // ratio it replaced.
+    struct RateParameters {
+        double baseSampleRate;
+        double speed;
+        double tempoRatio;
+        double pitchRatio;
+        bool keylock;
+        bool scratching;
+        bool reverse;
+        bool paused;
+    };
+    static_assert(sizeof(RateParameters) <= 64,
+            "RateParameters should fit into a single cache line");
+
     QString getGroup() const;
     // Return the current rate (not thread-safe)
     double getSpeed() const;
@@ -119,8 +137,16 @@ class EngineBuffer : public EngineObject {
     mixxx::audio::FramePos getPlayPos() const {
         return m_playPos;
     }
+    // Sample rate of the loaded track (not thread-safe)
+    mixxx::audio::SampleRate getTrackSampleRate() const {
+        return m_trackSampleRateOld;
+    }
     bool getScratching() const;
     bool isReverse() const;
+    // Thread-safe, see RateParameters.
+    RateParameters getRateParameters() const {
+        return m_rateParameters.getValue();
+    }
     /// Returns current bpm value (not thread-safe)
     mixxx::Bpm getBpm() const;
     /// Returns the BPM of the loaded track around the current position (not thread-safe)
@@ -278,6 +304,11 @@ class EngineBuffer : public EngineObject {
     struct QueuedSeek {
         mixxx::audio::FramePos position;
         enum SeekRequest seekType;
+        /// Monotonic timestamp taken in the requesting thread when the
+        /// seek was queued, 0 if unknown. Allows processSeek() to
+        /// compensate for the time the request waited for the next
+        /// engine callback.
+        qint64 queuedAtNanos;
     };
 
     // Add an engine control to the EngineBuffer
@@ -384,6 +415,9 @@ class EngineBuffer : public EngineObject {
     // need updating.
     double m_pitch_old;
 
+    // The published per-callback snapshot served by getRateParameters().
+    ControlValueAtomic<RateParameters> m_rateParameters;
+
     // The previous callback's baserate. Used to check if the scaler parameters
     // need updating.
     double m_baserate_old;
@@ -476,12 +510,18 @@ class EngineBuffer : public EngineObject {
     QAtomicInt m_iSyncModeQueued;
     ControlValueAtomic<QueuedSeek> m_queuedSeek;
     bool m_previousBufferSeek = false;
+    // If enabled, exact seeks of a playing deck land where the playhead
+    // would be if the seek had been applied at request time instead of
+    // at the following buffer boundary.
+    bool m_seekLatencyCompensationEnabled = false;
 
     QAtomicInt m_slipQuitAndAdopt;
     /// Indicates that no seek is queued
-    static constexpr QueuedSeek kNoQueuedSeek = {mixxx::audio::kInvalidFramePos, SEEK_NONE};
+    static constexpr QueuedSeek kNoQueuedSeek = {
+            mixxx::audio::kInvalidFramePos, SEEK_NONE, 0};
     /// indicates a clone seek on a bosition from another deck
-    static constexpr QueuedSeek kCloneSeek = {mixxx::audio::kInvalidFramePos, SEEK_CLONE};
+    static constexpr QueuedSeek kCloneSeek = {
+            mixxx::audio::kInvalidFramePos, SEEK_CLONE, 0};
     QAtomicPointer<EngineChannel> m_pChannelToCloneFrom;
 
     // Is true if the previous buffer was silent due to pausing
@@ -0,0 +1,160 @@
+#include "engine/enginechannelworkerpool.h"
+
+#include <QThread>
+#include <QtDebug>
+
+#ifdef __LINUX__
+#include <pthread.h>
+#endif
+
+#include "util/compatibility/qmutex.h"
+
+namespace {
+
+// Layout of EngineChannelWorkerPool::m_ticket: the batch generation in the
+// upper 32 bits, the next job index in the lower 32 bits.
+constexpr int kTicketGenerationShift = 32;
+constexpr quint64 kTicketJobMask = (quint64{1} << kTicketGenerationShift) - 1;
+
+quint64 packTicket(quint64 generation, int jobIndex) {
+    return (generation << kTicketGenerationShift) |
+            (static_cast<quint64>(jobIndex) & kTicketJobMask);
+}
+
+} // namespace
+
+class EngineChannelWorkerPool::WorkerThread : public QThread {
+  public:
+    WorkerThread(EngineChannelWorkerPool* pPool, int index)
+            : m_pPool(pPool) {
+        setObjectName(QStringLiteral("EngineChannelWorker %1").arg(index));
+    }
+
+  protected:
+    void run() override {
+#ifdef __LINUX__
+        // Match the SCHED_FIFO policy of the audio callback thread so the
+        // parallel channel stage is not preempted by ordinary threads. Same
+        // approach as SoundDeviceNetworkThread; on other platforms the
+        // TimeCriticalPriority passed to start() applies.
+        struct sched_param spm = {0};
+        spm.sched_priority = 1;
+        if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &spm)) {
+            qWarning() << "EngineChannelWorkerPool: failed to set SCHED_FIFO"
+                       << "for" << objectName();
+        }
+#endif
+        m_pPool->workerLoop();
+    }
+
+  private:
+    EngineChannelWorkerPool* const m_pPool;
+};
+
+EngineChannelWorkerPool::EngineChannelWorkerPool(int numWorkers) {
+    m_workers.reserve(numWorkers);
+    for (int i = 0; i < numWorkers; ++i) {
+        auto pThread = std::make_unique<WorkerThread>(this, i);
+        pThread->start(QThread::TimeCriticalPriority);
+        m_workers.push_back(std::move(pThread));
+    }
+}
+
+EngineChannelWorkerPool::~EngineChannelWorkerPool() {
+    {
+        const auto lock = lockMutex(&m_wakeMutex);
+        m_bQuit = true;
+        m_wakeCondition.wakeAll();
+    }
+    for (const auto& pThread : m_workers) {
+        pThread->wait();
+    }
+}
+
+void EngineChannelWorkerPool::run(JobFn fn, void* pContext, int numJobs) {
+    if (numJobs <= 0) {
+        return;
+    }
+    if (m_workers.empty()) {
+        for (int i = 0; i < numJobs; ++i) {
+            fn(pContext, i);
+        }
+        return;
+    }
+
+    m_fn = fn;
+    m_pContext = pContext;
+    m_numJobs = numJobs;
+    m_remainingJobs.store(numJobs, std::memory_order_relaxed);
+    quint64 generation;
+    {
+        const auto lock = lockMutex(&m_wakeMutex);
+        generation = ++m_generation;
+        // The release store pairs with the acquire loads of m_ticket in
+        // processJobs() and publishes the whole batch state above: a ticket
+        // of this generation can only be claimed after m_fn, m_pContext,
+        // m_numJobs and m_remainingJobs are visible to the claimant.
+        m_ticket.store(packTicket(generation, 0), std::memory_order_release);
+        m_wakeCondition.wakeAll();
+    }
+
+    // Participate in the batch so a busy pool never leaves the callback
+    // thread idle.
+    processJobs(generation);
+
+    // Barrier: wait until the last job has finished before the mix stage may
+    // read the channel buffers.
+    const auto lock = lockMutex(&m_doneMutex);
+    while (m_remainingJobs.load(std::memory_order_acquire) > 0) {
+        m_doneCondition.wait(&m_doneMutex);
+    }
+}
+
+void EngineChannelWorkerPool::processJobs(quint64 generation) {
+    // Acquire pairs with the release store of m_ticket in run(), see there.
+    quint64 ticket = m_ticket.load(std::memory_order_acquire);
+    while (true) {
+        if ((ticket >> kTicketGenerationShift) != (generation & kTicketJobMask)) {
+            // The ticket belongs to another batch: either run() already
+            // started the next one or this is a straggler that woke too
+            // late. Bail out without claiming; jobs and counters of the
+            // current batch must only be touched by its own claimants.
+            return;
+        }
+        const int job = static_cast<int>(ticket & kTicketJobMask);
+        if (job >= m_numJobs) {
+            // Batch fully claimed.
+            return;
+        }
+        if (!m_ticket.compare_exchange_weak(ticket,
+                    ticket + 1,
+                    std::memory_order_acquire,
+                    std::memory_order_acquire)) {
+            // Lost the claim; ticket was reloaded by the CAS.
+            continue;
+        }
+        m_fn(m_pContext, job);
+        if (m_remainingJobs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            const auto lock = lockMutex(&m_doneMutex);
+            m_doneCondition.wakeAll();
+        }
+        ticket = m_ticket.load(std::memory_order_acquire);
+    }
+}
+
+void EngineChannelWorkerPool::workerLoop() {
+    quint64 lastGeneration = 0;
+    while (true) {
+        {
+            const auto lock = lockMutex(&m_wakeMutex);
+            while (!m_bQuit && m_generation == lastGeneration) {
+                m_wakeCondition.wait(&m_wakeMutex);
+            }
+            if (m_bQuit) {
+                return;
+            }
+            lastGeneration = m_generation;
+        }
+        processJobs(lastGeneration);
+    }
+}
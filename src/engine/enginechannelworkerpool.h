@@ -0,0 +1,79 @@
+#pragma once
+
+#include <QMutex>
+#include <QWaitCondition>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+class QThread;
+
+/// Opt-in pool of real-time priority workers that lets EngineMixer process
+/// independent engine channels in parallel inside the audio callback, so
+/// callback cost scales across cores instead of with deck count.
+///
+/// The pool is a sibling of EngineWorkerScheduler rather than an extension of
+/// it: the scheduler dispatches non-real-time background work (e.g. the
+/// caching reader workers) after the callback, while this pool runs inside
+/// the callback and acts as a barrier before the channel mix.
+///
+/// Workers are woken with a wait condition when a batch starts; job
+/// distribution and the completion barrier are atomics, and the calling
+/// thread participates in processing, so an undersized pool degrades to the
+/// serial behavior instead of stalling the callback.
+class EngineChannelWorkerPool {
+  public:
+    /// Processes the job with the given index. Must be safe to call
+    /// concurrently for different indices.
+    typedef void (*JobFn)(void* pContext, int jobIndex);
+
+    /// Creates a pool with numWorkers threads. A pool created with zero
+    /// workers is inactive and run() simply processes all jobs on the
+    /// calling thread.
+    explicit EngineChannelWorkerPool(int numWorkers);
+    ~EngineChannelWorkerPool();
+
+    EngineChannelWorkerPool(const EngineChannelWorkerPool&) = delete;
+    EngineChannelWorkerPool& operator=(const EngineChannelWorkerPool&) = delete;
+
+    bool isActive() const {
+        return !m_workers.empty();
+    }
+
+    /// Runs fn(pContext, 0) .. fn(pContext, numJobs - 1), distributing the
+    /// jobs over the workers and the calling thread. Returns only after all
+    /// jobs have finished, i.e. this is the barrier before
+    /// ChannelMixer::applyEffectsAndMixChannels.
+    void run(JobFn fn, void* pContext, int numJobs);
+
+  private:
+    class WorkerThread;
+    friend class WorkerThread;
+
+    void processJobs(quint64 generation);
+    void workerLoop();
+
+    // Batch state, written by run() before the workers are woken.
+    JobFn m_fn = nullptr;
+    void* m_pContext = nullptr;
+    int m_numJobs = 0;
+    // Claim ticket, packing the batch generation (upper half) together with
+    // the next job index (lower half). Tickets are claimed with a CAS that
+    // includes the generation bits, so a straggler worker still spinning on
+    // a previous batch can neither win a job of the current batch nor bump
+    // its counters; see processJobs().
+    std::atomic<quint64> m_ticket{0};
+    std::atomic<int> m_remainingJobs{0};
+
+    QMutex m_wakeMutex;
+    QWaitCondition m_wakeCondition;
+    // Incremented for each batch to tell sleeping workers apart from spurious
+    // wakeups. Guarded by m_wakeMutex.
+    quint64 m_generation = 0;
+    bool m_bQuit = false; // guarded by m_wakeMutex
+
+    QMutex m_doneMutex;
+    QWaitCondition m_doneCondition;
+
+    std::vector<std::unique_ptr<QThread>> m_workers;
+};
@@ -1,5 +1,6 @@
 #include "engine/enginemixer.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "audio/types.h"
@@ -12,8 +13,10 @@
 #include "engine/channels/enginechannel.h"
 #include "engine/effects/engineeffectsmanager.h"
 #include "engine/enginebuffer.h"
+#include "engine/enginechannelworkerpool.h"
 #include "engine/enginedelay.h"
 #include "engine/enginetalkoverducking.h"
+#include "engine/enginevisualsipc.h"
 #include "engine/enginevumeter.h"
 #include "engine/engineworkerscheduler.h"
 #include "engine/enginexfader.h"
@@ -27,6 +30,7 @@
 #include "util/parented_ptr.h"
 #include "util/sample.h"
 #include "util/samplebuffer.h"
+#include "util/threadcpumonitor.h"
 
 namespace {
 const QString kAppGroup = QStringLiteral("[App]");
@@ -60,6 +64,10 @@ EngineMixer::EngineMixer(UserSettingsPointer pConfig,
           m_talkover(kMaxEngineSamples),
           m_talkoverHeadphones(kMaxEngineSamples),
           m_sidechainMix(kMaxEngineSamples),
+          // Four full engine buffers of scratch: two go to the effects
+          // intermediate buffers each callback, the rest is headroom for
+          // further stages; the high-water mark is asserted in allocate().
+          m_scratchArena(4 * kMaxEngineSamples),
           m_pWorkerScheduler(make_parented<EngineWorkerScheduler>(this)),
           m_pEngineSync(std::make_unique<EngineSync>(pConfig)),
           m_pMainGain(std::make_unique<ControlAudioTaperPot>(
@@ -164,6 +172,18 @@ EngineMixer::EngineMixer(UserSettingsPointer pConfig,
     m_bExternalRecordBroadcastInputConnected = false;
     m_pWorkerScheduler->start(QThread::HighPriority);
 
+    // Opt-in parallel channel processing. Disabled by default; enabling it
+    // spreads the per-channel engine work over the configured number of
+    // real-time workers on multi-deck setups.
+    const int numChannelWorkers = pConfig->getValue(
+            ConfigKey(group, QStringLiteral("parallel_channel_workers")), 0);
+    if (numChannelWorkers > 0) {
+        qDebug() << "Parallel channel processing enabled with"
+                 << numChannelWorkers << "workers";
+        m_pChannelWorkerPool =
+                std::make_unique<EngineChannelWorkerPool>(numChannelWorkers);
+    }
+
     m_pSampleRate->addAlias(ConfigKey(group, QStringLiteral("samplerate")));
     m_pSampleRate->set(44100.);
 
@@ -174,6 +194,19 @@ EngineMixer::EngineMixer(UserSettingsPointer pConfig,
     m_pAudioLatencyOverload->addAlias(
             ConfigKey(kLegacyGroup, QStringLiteral("audio_latency_overload")));
 
+    // SoundManager::processUnderflowHappened() sets this control from the
+    // audio callback when an underflow was flagged (at most once per 500 ms).
+    // The cross-thread connection queues the slot on the main thread, so the
+    // timing dump itself stays off the real-time path.
+    connect(m_pAudioLatencyOverload.get(),
+            &ControlObject::valueChanged,
+            this,
+            [this](double value) {
+                if (value > 0) {
+                    m_timingRecorder.dumpToLog();
+                }
+            });
+
     // The last-used bpm value is saved in the destructor of EngineSync.
     ControlObject::set(kInternalClockBpmKey, pConfig->getValue(kInternalClockBpmKey, 124.0));
 
@@ -209,6 +242,11 @@ EngineMixer::EngineMixer(UserSettingsPointer pConfig,
     m_pBoothEnabled->setReadOnly();
     m_pHeadphoneEnabled->setReadOnly();
 
+    // Created after the VU meter so the [Main] level controls it reads
+    // already exist.
+    m_pVisualsIpc = std::make_unique<EngineVisualsIpc>();
+    m_pVisualsIpc->bindSpectrumWorker(m_pWorkerScheduler);
+
     // Note: the EQ Rack is set in EffectsManager::setupDefaults();
 }
 
@@ -230,6 +268,19 @@ std::span<const CSAMPLE> EngineMixer::getSidechainBuffer() const {
     return m_sidechainMix.span();
 }
 
+void EngineMixer::processChannel(ChannelInfo* pChannelInfo, std::size_t bufferSize) {
+    auto& pChannel = pChannelInfo->m_pChannel;
+    DEBUG_ASSERT(pChannelInfo->m_pBuffer.size() >= static_cast<SINT>(bufferSize));
+    pChannel->process(pChannelInfo->m_pBuffer.data(), bufferSize);
+
+    // Collect metadata for effects
+    if (m_pEngineEffectsManager) {
+        GroupFeatureState features;
+        pChannel->collectFeatures(&features);
+        pChannelInfo->m_features = features;
+    }
+}
+
 void EngineMixer::processChannels(std::size_t bufferSize) {
     // Update internal sync lock rate.
     m_pEngineSync->onCallbackStart(m_sampleRate, bufferSize);
@@ -319,19 +370,56 @@ void EngineMixer::processChannels(std::size_t bufferSize) {
     }
 
     // Now that the list is built and ordered, do the processing.
-    for (int i = activeChannelsStartIndex; i < m_activeChannels.size(); ++i) {
-        ChannelInfo* pChannelInfo = m_activeChannels[i];
-        auto& pChannel = pChannelInfo->m_pChannel;
-        DEBUG_ASSERT(pChannelInfo->m_pBuffer.size() >= static_cast<SINT>(bufferSize));
-        pChannel->process(pChannelInfo->m_pBuffer.data(), bufferSize);
-
-        // Collect metadata for effects
-        if (m_pEngineEffectsManager) {
-            GroupFeatureState features;
-            pChannel->collectFeatures(&features);
-            pChannelInfo->m_features = features;
+    if (activeChannelsStartIndex == 0) {
+        // The sync leader must be fully processed before any channel that
+        // may follow it, so it never runs in parallel with the others.
+        processChannel(m_activeChannels[0], bufferSize);
+    }
+    int numFollowerChannels = m_activeChannels.size() - 1;
+#ifdef __STEM__
+    if (m_pChannelWorkerPool) {
+        // Stem decks mix their stems through the post-fader effects path,
+        // which writes to intermediate buffers shared between all channels
+        // (EngineEffectsManager and the standard effect chains). Two stem
+        // decks must therefore never process concurrently: move them behind
+        // the parallel set and process them serially below.
+        const auto firstStemChannel = std::stable_partition(
+                m_activeChannels.begin() + 1,
+                m_activeChannels.end(),
+                [](const ChannelInfo* pChannelInfo) {
+                    return !pChannelInfo->m_pChannel->isProcessingStems();
+                });
+        numFollowerChannels = static_cast<int>(
+                std::distance(m_activeChannels.begin() + 1, firstStemChannel));
+    }
+#endif
+    if (m_pChannelWorkerPool && numFollowerChannels > 1) {
+        // Process the remaining, mutually independent channels in parallel.
+        // run() acts as the barrier before applyEffectsAndMixChannels below.
+        struct ChannelJobContext {
+            EngineMixer* pMixer;
+            std::size_t bufferSize;
+        } context{this, bufferSize};
+        m_pChannelWorkerPool->run(
+                [](void* pRawContext, int jobIndex) {
+                    auto* pContext = static_cast<ChannelJobContext*>(pRawContext);
+                    pContext->pMixer->processChannel(
+                            pContext->pMixer->m_activeChannels[jobIndex + 1],
+                            pContext->bufferSize);
+                },
+                &context,
+                numFollowerChannels);
+    } else {
+        for (int i = 1; i < numFollowerChannels + 1; ++i) {
+            processChannel(m_activeChannels[i], bufferSize);
         }
     }
+#ifdef __STEM__
+    // Channels partitioned out of the parallel set above.
+    for (int i = numFollowerChannels + 1; i < m_activeChannels.size(); ++i) {
+        processChannel(m_activeChannels[i], bufferSize);
+    }
+#endif
     // Do internal sync lock post-processing before the other
     // channels.
     // Note, because we call this on the internal clock first,
@@ -364,10 +452,20 @@ void EngineMixer::process(const std::size_t bufferSize) {
     static bool haveSetName = false;
     if (!haveSetName) {
         QThread::currentThread()->setObjectName("Engine");
+        // One-time registration; like setObjectName this is not RT-safe,
+        // which is acceptable for the very first callback.
+        ThreadCpuMonitor::tagCurrentThread(QStringLiteral("engine"));
         haveSetName = true;
     }
     // Trace t("EngineMixer::process");
 
+    m_timingRecorder.beginCallback(bufferSize);
+
+    // Make the scratch arena available to all engine stages for the duration
+    // of this callback. All chunks handed out are discarded when the scope
+    // ends.
+    const CallbackScratchArena::Scope scratchArenaScope(&m_scratchArena);
+
     bool mainEnabled = m_pMainEnabled->toBool();
     bool boothEnabled = m_pBoothEnabled->toBool();
     bool headphoneEnabled = m_pHeadphoneEnabled->toBool();
@@ -378,11 +476,22 @@ void EngineMixer::process(const std::size_t bufferSize) {
     const unsigned int iFrames = static_cast<unsigned int>(bufferSize) / kChannels;
 
     if (m_pEngineEffectsManager) {
-        m_pEngineEffectsManager->onCallbackStart();
+        m_pEngineEffectsManager->onCallbackStart(bufferSize);
     }
 
     // Prepare all channels for output
     processChannels(bufferSize);
+    m_timingRecorder.recordStage(EngineTimingRecorder::Stage::ChannelProcessing);
+
+    // Feed the processed deck buffers to the spectrum worker. Wait-free;
+    // the transforms run on the engine worker scheduler after the callback.
+    for (ChannelInfo* pChannelInfo : std::as_const(m_activeChannels)) {
+        if (pChannelInfo->m_visualsIpcDeck >= 0) {
+            m_pVisualsIpc->feedDeckSamples(pChannelInfo->m_visualsIpcDeck,
+                    pChannelInfo->m_pBuffer.data(),
+                    bufferSize);
+        }
+    }
 
     // Compute headphone mix
     // Head phone left/right mix
@@ -434,33 +543,45 @@ void EngineMixer::process(const std::size_t bufferSize) {
                     headphoneFeatures);
         }
     }
+    m_timingRecorder.recordStage(EngineTimingRecorder::Stage::HeadphoneMix);
+
+    // The whole talkover branch (mixing, bus effects and the ducking key
+    // detector) can be skipped while no microphone is configured and no
+    // talkover channel is active. The talkover buffer is only read from code
+    // paths that are themselves gated on configured microphones, so it may
+    // hold stale samples while this branch is skipped.
+    const bool talkoverActive = m_numMicsConfigured > 0 ||
+            !m_activeTalkoverChannels.isEmpty();
 
-    // Mix all the talkover enabled channels together.
-    // Effects processing is done in place to avoid unnecessary buffer copying.
-    ChannelMixer::applyEffectsInPlaceAndMixChannels(
-            m_talkoverGain,
-            m_activeTalkoverChannels,
-            &m_channelTalkoverGainCache,
-            m_talkover.data(),
-            m_mainHandle.handle(),
-            bufferSize,
-            m_sampleRate,
-            m_pEngineEffectsManager);
-
-    // Process effects on all microphones mixed together
     // We have no metadata for mixed effect buses, so use an empty GroupFeatureState.
     GroupFeatureState busFeatures;
-    if (m_pEngineEffectsManager) {
-        m_pEngineEffectsManager->processPostFaderInPlace(
-                m_busTalkoverHandle.handle(),
-                m_mainHandle.handle(),
+
+    if (talkoverActive) {
+        // Mix all the talkover enabled channels together.
+        // Effects processing is done in place to avoid unnecessary buffer copying.
+        ChannelMixer::applyEffectsInPlaceAndMixChannels(
+                m_talkoverGain,
+                m_activeTalkoverChannels,
+                &m_channelTalkoverGainCache,
                 m_talkover.data(),
+                m_mainHandle.handle(),
                 bufferSize,
                 m_sampleRate,
-                busFeatures,
-                CSAMPLE_GAIN_ONE,
-                CSAMPLE_GAIN_ONE,
-                false);
+                m_pEngineEffectsManager);
+
+        // Process effects on all microphones mixed together
+        if (m_pEngineEffectsManager) {
+            m_pEngineEffectsManager->processPostFaderInPlace(
+                    m_busTalkoverHandle.handle(),
+                    m_mainHandle.handle(),
+                    m_talkover.data(),
+                    bufferSize,
+                    m_sampleRate,
+                    busFeatures,
+                    CSAMPLE_GAIN_ONE,
+                    CSAMPLE_GAIN_ONE,
+                    false);
+        }
     }
 
     switch (m_pTalkoverDucking->getMode()) {
@@ -468,7 +589,11 @@ void EngineMixer::process(const std::size_t bufferSize) {
         m_pTalkoverDucking->setAboveThreshold(false);
         break;
     case EngineTalkoverDucking::AUTO:
-        m_pTalkoverDucking->processKey(m_talkover.data(), bufferSize);
+        if (talkoverActive) {
+            m_pTalkoverDucking->processKey(m_talkover.data(), bufferSize);
+        } else {
+            m_pTalkoverDucking->setAboveThreshold(false);
+        }
         break;
     case EngineTalkoverDucking::MANUAL:
         m_pTalkoverDucking->setAboveThreshold(!m_activeTalkoverChannels.isEmpty());
@@ -478,6 +603,7 @@ void EngineMixer::process(const std::size_t bufferSize) {
         m_pTalkoverDucking->setAboveThreshold(false);
         break;
     }
+    m_timingRecorder.recordStage(EngineTimingRecorder::Stage::TalkoverMix);
 
     // Calculate the crossfader gains for left and right side of the crossfader
     CSAMPLE_GAIN crossfaderLeftGain, crossfaderRightGain;
@@ -537,6 +663,7 @@ void EngineMixer::process(const std::size_t bufferSize) {
                 CSAMPLE_GAIN_ONE,
                 false);
     }
+    m_timingRecorder.recordStage(EngineTimingRecorder::Stage::BusMix);
 
     if (mainEnabled) {
         // Mix the crossfader orientation buffers together into the main mix
@@ -791,6 +918,11 @@ void EngineMixer::process(const std::size_t bufferSize) {
         m_pBoothDelay->process(m_booth.data(), bufferSize);
     }
 
+    // Publish the state of this callback to external visualizers.
+    m_pVisualsIpc->publish(m_sampleRate);
+
+    m_timingRecorder.finishCallback();
+
     // We're close to the end of the callback. Wake up the engine worker
     // scheduler so that it runs the workers.
     m_pWorkerScheduler->runWorkers();
@@ -866,6 +998,7 @@ void EngineMixer::addChannel(std::unique_ptr<EngineChannel> pChannel) {
     pChannelInfo->m_pBuffer = mixxx::SampleBuffer(kMaxEngineSamples);
     pChannelInfo->m_pBuffer.clear();
     EngineBuffer* pBuffer = pChannelInfo->m_pChannel->getEngineBuffer();
+    pChannelInfo->m_visualsIpcDeck = m_pVisualsIpc->onChannelAdded(group);
     m_channels.append(std::move(pChannelInfo));
     constexpr GainCache gainCacheDefault = {0, false};
     m_channelHeadphoneGainCache.append(gainCacheDefault);
@@ -9,10 +9,12 @@
 #include "audio/types.h"
 #include "control/controlobject.h"
 #include "control/controlpushbutton.h"
+#include "engine/callbackscratcharena.h"
 #include "engine/channelhandle.h"
 #include "engine/channels/enginechannel.h"
 #include "engine/effects/groupfeaturestate.h"
 #include "engine/engineobject.h"
+#include "engine/enginetimingrecorder.h"
 #include "preferences/usersettings.h"
 #include "recording/recordingmanager.h"
 #include "soundio/soundmanager.h"
@@ -21,7 +23,9 @@
 #include "util/samplebuffer.h"
 #include "util/types.h"
 
+class EngineChannelWorkerPool;
 class EngineWorkerScheduler;
+class EngineVisualsIpc;
 class EngineVuMeter;
 class ControlPotmeter;
 class ControlPushButton;
@@ -102,6 +106,9 @@ class EngineMixer : public QObject, public AudioSource {
     std::span<const CSAMPLE> getDeckBuffer(unsigned int i) const;
     std::span<const CSAMPLE> getChannelBuffer(const QString& name) const;
     std::span<const CSAMPLE> getSidechainBuffer() const;
+    const EngineTimingRecorder& timingRecorder() const {
+        return m_timingRecorder;
+    }
 
     EngineSideChain* getSideChain() const {
         return m_pEngineSideChain.get();
@@ -120,6 +127,8 @@ class EngineMixer : public QObject, public AudioSource {
         std::unique_ptr<ControlPushButton> m_pMuteControl{nullptr};
         GroupFeatureState m_features{};
         int m_index;
+        // Slot in the visuals IPC snapshot, -1 for non-deck channels.
+        int m_visualsIpcDeck{-1};
     };
 
     struct GainCache {
@@ -254,6 +263,9 @@ class EngineMixer : public QObject, public AudioSource {
     // m_activeTalkoverChannels with each channel that is active for the
     // respective output.
     void processChannels(std::size_t bufferSize);
+    // Processes a single channel and collects its effects metadata. Called
+    // either serially or from the channel worker pool.
+    void processChannel(ChannelInfo* pChannelInfo, std::size_t bufferSize);
 
     ChannelHandleFactoryPointer m_pChannelHandleFactory;
     void applyMainEffects(std::size_t bufferSize);
@@ -289,8 +301,16 @@ class EngineMixer : public QObject, public AudioSource {
     mixxx::SampleBuffer m_talkover;
     mixxx::SampleBuffer m_talkoverHeadphones;
     mixxx::SampleBuffer m_sidechainMix;
+    // Per-callback bump arena for transient scratch buffers of all engine
+    // stages. Reset at the top of process().
+    CallbackScratchArena m_scratchArena;
+    // Per-stage timing of the recent callbacks, dumped to the log when an
+    // underflow is detected.
+    EngineTimingRecorder m_timingRecorder;
 
     parented_ptr<EngineWorkerScheduler> m_pWorkerScheduler;
+    // Opt-in pool for parallel channel processing, nullptr when disabled.
+    std::unique_ptr<EngineChannelWorkerPool> m_pChannelWorkerPool;
     std::unique_ptr<EngineSync> m_pEngineSync;
 
     std::unique_ptr<ControlObject> m_pMainGain;
@@ -308,6 +328,8 @@ class EngineMixer : public QObject, public AudioSource {
     std::unique_ptr<EngineDelay> m_pLatencyCompensationDelay;
 
     std::unique_ptr<EngineVuMeter> m_pVumeter;
+    // Shared memory surface for external visualizers, see visualsipc.h.
+    std::unique_ptr<EngineVisualsIpc> m_pVisualsIpc;
     std::unique_ptr<EngineSideChain> m_pEngineSideChain;
 
     std::unique_ptr<ControlPotmeter> m_pCrossfader;
@@ -16,6 +16,15 @@ constexpr CSAMPLE_GAIN kSpeedGainMultiplier = 4.0f;
 constexpr CSAMPLE_GAIN kMaxTotalGainBySpeed = 0.9f;
 // value to normalize gain to 1 at speed one
 const CSAMPLE_GAIN kSpeedOneDiv = std::log10((1 * kSpeedGainMultiplier) + 1);
+
+// Limits how far the loudness curve may move the gain away from the
+// integrated ReplayGain correction; larger swings cause audible pumping.
+constexpr double kMaxCurveGainDb = 6.0;
+// Time constant of the one-pole smoothing applied to the curve gain,
+// chosen close to the 3 s short-term loudness window the curve is
+// derived from so the correction never reacts faster than the
+// measurement it follows.
+constexpr double kCurveSmoothingSeconds = 2.0;
 } // anonymous namespace
 
 ControlPotmeter* EnginePregain::s_pReplayGainBoost = nullptr;
@@ -28,7 +37,10 @@ EnginePregain::EnginePregain(const QString& group)
           m_dNonScratchSpeed(1.0),
           m_scratching(false),
           m_fPrevGain(1.0),
-          m_bSmoothFade(false) {
+          m_bSmoothFade(false),
+          m_trackPositionSeconds(-1.0),
+          m_bufferSeconds(0.0),
+          m_curveGainDb(0.0) {
     m_pPotmeterPregain = new ControlAudioTaperPot(ConfigKey(group, "pregain"), -12, 12, 0.5);
     //Replay Gain things
     m_pCOReplayGain = new ControlObject(ConfigKey(group, "replaygain"));
@@ -64,6 +76,36 @@ void EnginePregain::setSpeedAndScratching(double speed, bool scratching) {
     m_scratching = scratching;
 }
 
+void EnginePregain::setLoudnessCurve(
+        mixxx::ConstLoudnessCurvePointer pLoudnessCurve) {
+    m_loudnessCurve.setValue(pLoudnessCurve);
+}
+
+void EnginePregain::setTrackPosition(
+        double positionSeconds, double bufferSeconds) {
+    m_trackPositionSeconds = positionSeconds;
+    m_bufferSeconds = bufferSeconds;
+}
+
+CSAMPLE_GAIN EnginePregain::curveGainCorrection() {
+    const mixxx::ConstLoudnessCurvePointer pCurve = m_loudnessCurve.getValue();
+    if (!pCurve || pCurve->isEmpty() || m_trackPositionSeconds < 0) {
+        m_curveGainDb = 0.0;
+        return 1.0f;
+    }
+    // Bring the short-term loudness at the current position toward the
+    // integrated loudness the ReplayGain correction is based on, i.e.
+    // boost quiet passages and tame loud ones.
+    const double targetDb = math_clamp(
+            pCurve->integratedLufs() -
+                    pCurve->shortTermLufsAt(m_trackPositionSeconds),
+            -kMaxCurveGainDb,
+            kMaxCurveGainDb);
+    const double alpha = math_min(1.0, m_bufferSeconds / kCurveSmoothingSeconds);
+    m_curveGainDb += (targetDb - m_curveGainDb) * alpha;
+    return static_cast<CSAMPLE_GAIN>(db2ratio(m_curveGainDb));
+}
+
 void EnginePregain::process(CSAMPLE* pInOut, const std::size_t bufferSize) {
     const auto fReplayGain = static_cast<CSAMPLE_GAIN>(m_pCOReplayGain->get());
     CSAMPLE_GAIN fReplayGainCorrection;
@@ -88,8 +130,9 @@ void EnginePregain::process(CSAMPLE* pInOut, const std::size_t bufferSize) {
         // full process for one second.
         // So we need to alter gain each time ::process is called.
 
-        const CSAMPLE_GAIN fullReplayGainBoost =
-                fReplayGain * static_cast<CSAMPLE_GAIN>(s_pReplayGainBoost->get());
+        const CSAMPLE_GAIN fullReplayGainBoost = fReplayGain *
+                static_cast<CSAMPLE_GAIN>(s_pReplayGainBoost->get()) *
+                curveGainCorrection();
 
         // This means that a ReplayGain value has been calculated after the
         // track has been loaded
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "control/controlvalue.h"
 #include "engine/engineobject.h"
+#include "track/loudnesscurve.h"
 #include "util/performancetimer.h"
 
 class ControlAudioTaperPot;
@@ -23,11 +25,28 @@ class EnginePregain : public EngineObject {
     // reversed without a ramp to zero.
     void setSpeedAndScratching(double speed, bool scratching);
 
+    // Hands the short-term loudness curve of the loaded track to the
+    // engine. Thread-safe; called from the main thread on track load and
+    // whenever the analyzer finishes. Pass a null pointer to fall back to
+    // the plain integrated ReplayGain correction.
+    void setLoudnessCurve(mixxx::ConstLoudnessCurvePointer pLoudnessCurve);
+
+    // Called once per callback from EngineDeck::process() with the current
+    // play position in the track and the callback duration, both in
+    // seconds. A negative position disables the curve correction for this
+    // callback (e.g. no track loaded or passthrough active).
+    void setTrackPosition(double positionSeconds, double bufferSeconds);
+
     void process(CSAMPLE* pInOut, const std::size_t bufferSize) override;
 
     void collectFeatures(GroupFeatureState* pGroupFeatures) const override;
 
   private:
+    // Gain factor that nudges the ReplayGain correction toward the
+    // short-term loudness of the current position, smoothed across
+    // callbacks. Returns 1 if no curve is available.
+    CSAMPLE_GAIN curveGainCorrection();
+
     double m_dSpeed;
     double m_dOldSpeed;
     double m_dNonScratchSpeed;
@@ -42,4 +61,10 @@ class EnginePregain : public EngineObject {
     static ControlObject* s_pEnableReplayGain;
     bool m_bSmoothFade;
     PerformanceTimer m_timer;
+    // Loudness curve of the loaded track, handed over wait-free from the
+    // main thread. Null while no curve is available.
+    ControlValueAtomic<mixxx::ConstLoudnessCurvePointer> m_loudnessCurve;
+    double m_trackPositionSeconds;
+    double m_bufferSeconds;
+    double m_curveGainDb;
 };
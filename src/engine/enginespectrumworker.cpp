@@ -0,0 +1,160 @@
+#include "engine/enginespectrumworker.h"
+
+#include <cmath>
+
+#include "dsp/transforms/FFT.h"
+#include "moc_enginespectrumworker.cpp"
+#include "util/math.h"
+
+namespace {
+
+// Sized for several callbacks of headroom so a delayed worker wakeup does
+// not drop samples.
+constexpr int kSampleFifoSize = 16384;
+
+// The lowest FFT bin of the first log bin. Bin 0 (DC) is skipped.
+constexpr int kFirstFftBin = 1;
+
+// Levels are published as (dB + kDynamicRangeDb) / kDynamicRangeDb, i.e.
+// 0.0 at -60 dBFS and 1.0 at full scale.
+constexpr double kDynamicRangeDb = 60.0;
+
+// Smoothing of the published bins over successive transforms; high enough
+// to keep transients visible while calming the display.
+constexpr float kBinSmoothing = 0.5f;
+
+} // anonymous namespace
+
+EngineSpectrumWorker::DeckSpectrum::DeckSpectrum()
+        : sampleFifo(kSampleFifoSize),
+          monoHistory(EngineSpectrumWorker::kFftSize, 0.0),
+          historyWritePos(0),
+          samplesSinceTransform(0) {
+}
+
+EngineSpectrumWorker::EngineSpectrumWorker()
+        : m_numDecks(0),
+          m_fft(std::make_unique<FFTReal>(kFftSize)),
+          m_windowTable(kFftSize),
+          m_fftInput(kFftSize),
+          m_fftMagnitude(kFftSize),
+          m_stop(0) {
+    for (int i = 0; i < kFftSize; ++i) {
+        // Hann window
+        m_windowTable[i] = 0.5 - 0.5 * std::cos(2.0 * M_PI * i / (kFftSize - 1));
+    }
+    // Logarithmically spaced bin boundaries over the FFT bins
+    // [kFirstFftBin, kFftSize / 2], each boundary at least one bin above
+    // the previous so every log bin covers a non-empty range.
+    constexpr int numBins = static_cast<int>(mixxx::visualsipc::kSpectrumBins);
+    const double ratio = std::pow(
+            static_cast<double>(kFftSize / 2) / kFirstFftBin, 1.0 / numBins);
+    double boundary = kFirstFftBin;
+    m_binBoundaries[0] = kFirstFftBin;
+    for (int i = 1; i <= numBins; ++i) {
+        boundary *= ratio;
+        m_binBoundaries[i] = math_max(
+                m_binBoundaries[i - 1] + 1, static_cast<int>(boundary));
+    }
+    m_binBoundaries[numBins] = kFftSize / 2;
+}
+
+EngineSpectrumWorker::~EngineSpectrumWorker() = default;
+
+int EngineSpectrumWorker::addDeck() {
+    const int numDecks = m_numDecks.load(std::memory_order_relaxed);
+    if (numDecks >= static_cast<int>(m_decks.size())) {
+        return -1;
+    }
+    m_decks[numDecks] = std::make_unique<DeckSpectrum>();
+    m_numDecks.store(numDecks + 1, std::memory_order_release);
+    return numDecks;
+}
+
+void EngineSpectrumWorker::writeSamples(
+        int deckIndex, const CSAMPLE* pBuffer, std::size_t bufferSize) {
+    if (deckIndex < 0 ||
+            deckIndex >= m_numDecks.load(std::memory_order_acquire)) {
+        return;
+    }
+    DeckSpectrum* pDeck = m_decks[deckIndex].get();
+    // On overflow the oldest samples are lost, which only costs one stale
+    // transform; never block or retry here.
+    pDeck->sampleFifo.write(pBuffer, static_cast<int>(bufferSize));
+    if (pDeck->sampleFifo.readAvailable() >= 2 * kHopSize) {
+        workReady();
+    }
+}
+
+void EngineSpectrumWorker::readSpectrum(int deckIndex, float* pBins) {
+    if (deckIndex < 0 ||
+            deckIndex >= m_numDecks.load(std::memory_order_acquire)) {
+        return;
+    }
+    const SpectrumBins bins = m_decks[deckIndex]->publishedBins.getValue();
+    for (std::size_t i = 0; i < bins.bins.size(); ++i) {
+        pBins[i] = bins.bins[i];
+    }
+}
+
+void EngineSpectrumWorker::run() {
+    QThread::currentThread()->setObjectName(QStringLiteral("EngineSpectrumWorker"));
+    while (!m_stop.loadAcquire()) {
+        const int numDecks = m_numDecks.load(std::memory_order_acquire);
+        for (int i = 0; i < numDecks; ++i) {
+            processDeck(m_decks[i].get());
+        }
+        m_semaRun.acquire();
+    }
+}
+
+void EngineSpectrumWorker::quitWait() {
+    m_stop = 1;
+    m_semaRun.release();
+    wait();
+}
+
+void EngineSpectrumWorker::processDeck(DeckSpectrum* pDeck) {
+    // Drain the FIFO into the mono history in fixed-size steps.
+    CSAMPLE stereoChunk[2 * kHopSize];
+    int chunkSamples;
+    while ((chunkSamples = pDeck->sampleFifo.read(
+                    stereoChunk, static_cast<int>(sizeof(stereoChunk) / sizeof(CSAMPLE)))) > 0) {
+        for (int i = 0; i + 1 < chunkSamples; i += 2) {
+            pDeck->monoHistory[pDeck->historyWritePos] =
+                    0.5 * (static_cast<double>(stereoChunk[i]) +
+                            static_cast<double>(stereoChunk[i + 1]));
+            pDeck->historyWritePos = (pDeck->historyWritePos + 1) % kFftSize;
+            ++pDeck->samplesSinceTransform;
+        }
+
+        if (pDeck->samplesSinceTransform < kHopSize) {
+            continue;
+        }
+        pDeck->samplesSinceTransform = 0;
+
+        // Linearize the circular history (oldest sample first) and window it.
+        for (int i = 0; i < kFftSize; ++i) {
+            m_fftInput[i] = m_windowTable[i] *
+                    pDeck->monoHistory[(pDeck->historyWritePos + i) % kFftSize];
+        }
+        m_fft->forwardMagnitude(m_fftInput.data(), m_fftMagnitude.data());
+
+        // Coherent gain of the Hann window is half the number of samples.
+        constexpr double kMagnitudeScale = 2.0 / kFftSize;
+        constexpr int numBins = static_cast<int>(mixxx::visualsipc::kSpectrumBins);
+        for (int bin = 0; bin < numBins; ++bin) {
+            double peak = 0;
+            for (int i = m_binBoundaries[bin]; i < m_binBoundaries[bin + 1]; ++i) {
+                peak = math_max(peak, m_fftMagnitude[i]);
+            }
+            const double db = 20.0 *
+                    std::log10(math_max(peak * kMagnitudeScale, 1e-10));
+            const float level = static_cast<float>(math_clamp(
+                    (db + kDynamicRangeDb) / kDynamicRangeDb, 0.0, 1.0));
+            float& smoothed = pDeck->smoothedBins.bins[bin];
+            smoothed += kBinSmoothing * (level - smoothed);
+        }
+        pDeck->publishedBins.setValue(pDeck->smoothedBins);
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <QAtomicInt>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "control/controlvalue.h"
+#include "engine/engineworker.h"
+#include "engine/visualsipc.h"
+#include "util/fifo.h"
+#include "util/types.h"
+
+class FFTReal;
+
+/// Computes per-deck spectra without touching the audio callback or the GUI
+/// thread. The engine callback submits deck buffers wait-free via
+/// writeSamples(); the worker is woken by the EngineWorkerScheduler after the
+/// callback, windows the most recent samples, runs the in-tree
+/// (QueenMaryDsp/kissfft) real FFT and reduces the magnitudes to a small
+/// number of logarithmically spaced bins. The result of the latest transform
+/// is published per deck through a ControlValueAtomic so any number of
+/// consumers share the one transform; EngineVisualsIpc copies it into the
+/// shared memory snapshot for skins and external visualizers.
+class EngineSpectrumWorker : public EngineWorker {
+    Q_OBJECT
+  public:
+    /// Mono samples per transform. An FFT is computed every kHopSize new
+    /// samples, i.e. roughly 43 times per second at 44.1 kHz.
+    static constexpr int kFftSize = 2048;
+    static constexpr int kHopSize = 1024;
+
+    EngineSpectrumWorker();
+    ~EngineSpectrumWorker() override;
+
+    /// Registers a deck and returns its index, or -1 when all slots are
+    /// taken. Called from the main thread before the deck produces audio.
+    int addDeck();
+
+    /// Wait-free, called from the audio thread with the interleaved stereo
+    /// buffer of the deck. Wakes the worker once enough samples for the
+    /// next transform have accumulated.
+    void writeSamples(int deckIndex, const CSAMPLE* pBuffer, std::size_t bufferSize);
+
+    /// Copies the bins of the most recent transform of the deck into pBins
+    /// (mixxx::visualsipc::kSpectrumBins values in 0.0 .. 1.0). Lock-free,
+    /// callable from the audio thread.
+    void readSpectrum(int deckIndex, float* pBins);
+
+    void run() override;
+    void quitWait();
+
+  private:
+    struct SpectrumBins {
+        std::array<float, mixxx::visualsipc::kSpectrumBins> bins{};
+    };
+
+    struct DeckSpectrum {
+        DeckSpectrum();
+        // Interleaved stereo samples submitted by the audio thread.
+        FIFO<CSAMPLE> sampleFifo;
+        // Circular history of the last kFftSize mono samples.
+        std::vector<double> monoHistory;
+        int historyWritePos;
+        int samplesSinceTransform;
+        SpectrumBins smoothedBins;
+        ControlValueAtomic<SpectrumBins> publishedBins;
+    };
+
+    void processDeck(DeckSpectrum* pDeck);
+
+    std::array<std::unique_ptr<DeckSpectrum>, mixxx::visualsipc::kMaxDecks> m_decks;
+    // Release/acquire pair that hands decks added by the main thread over
+    // to the worker and the audio thread without locking.
+    std::atomic<int> m_numDecks;
+    std::unique_ptr<FFTReal> m_fft;
+    // Precomputed Hann window and log-spaced bin boundaries.
+    std::vector<double> m_windowTable;
+    std::array<int, mixxx::visualsipc::kSpectrumBins + 1> m_binBoundaries;
+    // Worker-local scratch for the transform.
+    std::vector<double> m_fftInput;
+    std::vector<double> m_fftMagnitude;
+    QAtomicInt m_stop;
+};
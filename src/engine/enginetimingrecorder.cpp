@@ -0,0 +1,92 @@
+#include "engine/enginetimingrecorder.h"
+
+#include <QString>
+#include <QtDebug>
+#include <algorithm>
+
+// static
+const char* EngineTimingRecorder::stageName(Stage stage) {
+    switch (stage) {
+    case Stage::ChannelProcessing:
+        return "channels";
+    case Stage::HeadphoneMix:
+        return "headphone";
+    case Stage::TalkoverMix:
+        return "talkover";
+    case Stage::BusMix:
+        return "bus";
+    case Stage::MainAndOutput:
+        return "main/output";
+    }
+    return "unknown";
+}
+
+void EngineTimingRecorder::beginCallback(std::size_t bufferSize) {
+    m_pendingRecord = Record{};
+    m_pendingRecord.callbackIndex = m_writeCount.load(std::memory_order_relaxed);
+    m_pendingRecord.bufferSize = bufferSize;
+    m_callbackTimer.start();
+    m_stageTimer.start();
+}
+
+void EngineTimingRecorder::recordStage(Stage stage) {
+    m_pendingRecord.stageNanos[static_cast<int>(stage)] =
+            m_stageTimer.restart().toIntegerNanos();
+}
+
+void EngineTimingRecorder::finishCallback() {
+    recordStage(Stage::MainAndOutput);
+    m_pendingRecord.totalNanos = m_callbackTimer.elapsed().toIntegerNanos();
+    const std::uint64_t count = m_writeCount.load(std::memory_order_relaxed);
+    m_records[count % kNumRecords] = m_pendingRecord;
+    m_writeCount.store(count + 1, std::memory_order_release);
+}
+
+void EngineTimingRecorder::dumpToLog() const {
+    const std::uint64_t count = m_writeCount.load(std::memory_order_acquire);
+    const int numRecords = static_cast<int>(
+            std::min<std::uint64_t>(count, kNumRecords));
+    if (numRecords == 0) {
+        return;
+    }
+
+    // Snapshot the ring before formatting anything so that the engine, which
+    // keeps overwriting entries while we dump, can clobber as few of them as
+    // possible.
+    std::array<Record, kNumRecords> snapshot;
+    const std::uint64_t begin = count - numRecords;
+    for (int i = 0; i < numRecords; ++i) {
+        snapshot[i] = m_records[(begin + i) % kNumRecords];
+    }
+
+    qWarning("EngineTimingRecorder: per-stage timing of the last %d engine "
+             "callbacks (microseconds):",
+            numRecords);
+    for (int i = 0; i < numRecords; ++i) {
+        const Record& record = snapshot[i];
+        QString line = QStringLiteral("  callback %1 samples=%2")
+                               .arg(record.callbackIndex)
+                               .arg(record.bufferSize);
+        for (int stage = 0; stage < kNumStages; ++stage) {
+            line += QStringLiteral(" %1=%2")
+                            .arg(QLatin1String(stageName(static_cast<Stage>(stage))))
+                            .arg(record.stageNanos[stage] / 1000);
+        }
+        line += QStringLiteral(" total=%1").arg(record.totalNanos / 1000);
+        qWarning("%s", qUtf8Printable(line));
+    }
+}
+
+std::array<std::int64_t, EngineTimingRecorder::kNumStages>
+EngineTimingRecorder::lastStageNanos() const {
+    std::array<std::int64_t, kNumStages> stageNanos = {};
+    const std::uint64_t count = m_writeCount.load(std::memory_order_acquire);
+    if (count == 0) {
+        return stageNanos;
+    }
+    const Record& record = m_records[(count - 1) % kNumRecords];
+    std::copy(std::begin(record.stageNanos),
+            std::end(record.stageNanos),
+            stageNanos.begin());
+    return stageNanos;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "util/performancetimer.h"
+
+/// Always-on flight recorder for the engine callback. EngineMixer::process()
+/// records how long each mixing stage of the recent callbacks took so that
+/// the breakdown of the moments leading up to an underflow can be dumped to
+/// the log when one is detected.
+///
+/// Unlike Trace (util/trace.h), which builds QStrings and posts to the
+/// per-thread stats pipes, the write path here is a handful of monotonic
+/// clock reads and plain stores into a preallocated ring, so it is cheap
+/// enough to leave enabled outside of developer mode.
+///
+/// Threading: beginCallback()/recordStage()/finishCallback() must only be
+/// called from the engine callback thread. dumpToLog() may be called from any
+/// other thread; it snapshots the ring while the engine keeps writing, so the
+/// newest entries of a dump may occasionally show torn values, which is
+/// acceptable for a diagnostic dump.
+class EngineTimingRecorder {
+  public:
+    enum class Stage {
+        ChannelProcessing = 0,
+        HeadphoneMix,
+        TalkoverMix,
+        BusMix,
+        MainAndOutput,
+    };
+    static constexpr int kNumStages = 5;
+    // Number of callbacks kept. At a typical 5 ms callback period this covers
+    // the last ~320 ms leading up to an underflow.
+    static constexpr int kNumRecords = 64;
+
+    /// Starts timing a new callback. bufferSize is in samples.
+    void beginCallback(std::size_t bufferSize);
+    /// Attributes the time elapsed since the previous mark to the given stage.
+    void recordStage(Stage stage);
+    /// Closes the MainAndOutput stage and publishes the completed record.
+    void finishCallback();
+
+    /// Writes the per-stage timing of the recorded callbacks to the log.
+    void dumpToLog() const;
+
+    /// Per-stage nanoseconds of the most recently completed callback. Only
+    /// meaningful when the caller is serialized with the engine callback,
+    /// e.g. when the engine is rendered offline in tests.
+    std::array<std::int64_t, kNumStages> lastStageNanos() const;
+
+    /// Short human-readable name of a stage, for logs and reports.
+    static const char* stageName(Stage stage);
+
+  private:
+    struct Record {
+        std::int64_t stageNanos[kNumStages] = {0};
+        std::int64_t totalNanos = 0;
+        std::uint64_t callbackIndex = 0;
+        std::size_t bufferSize = 0;
+    };
+
+    PerformanceTimer m_callbackTimer;
+    PerformanceTimer m_stageTimer;
+    // Written by the engine thread only, copied into the ring on completion
+    // so readers never see a half-filled entry at the publish index.
+    Record m_pendingRecord;
+    std::array<Record, kNumRecords> m_records;
+    // Number of completed callbacks. The engine thread publishes a finished
+    // record with a release store so dumpToLog() sees fully written entries.
+    std::atomic<std::uint64_t> m_writeCount{0};
+};
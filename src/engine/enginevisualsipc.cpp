@@ -0,0 +1,179 @@
+#include "engine/enginevisualsipc.h"
+
+#include <cstring>
+#include <new>
+
+#include "control/controlobject.h"
+#include "engine/enginespectrumworker.h"
+#include "util/assert.h"
+#include "util/logger.h"
+#include "waveform/visualplayposition.h"
+
+namespace {
+
+const mixxx::Logger kLogger("EngineVisualsIpc");
+
+const QString kMainGroup = QStringLiteral("[Main]");
+
+} // anonymous namespace
+
+using mixxx::visualsipc::Snapshot;
+
+EngineVisualsIpc::EngineVisualsIpc()
+        : m_sharedMemory(QString::fromLatin1(mixxx::visualsipc::kSharedMemoryKey)),
+          m_pSnapshot(nullptr),
+          m_numDecks(0),
+          m_pMainVuLeft(nullptr),
+          m_pMainVuRight(nullptr),
+          m_callbackCount(0) {
+    if (!m_sharedMemory.create(sizeof(Snapshot))) {
+        if (m_sharedMemory.error() == QSharedMemory::AlreadyExists) {
+            // On POSIX systems a crashed instance leaves the segment
+            // behind; attaching and detaching once releases it.
+            m_sharedMemory.attach();
+            m_sharedMemory.detach();
+        }
+        if (!m_sharedMemory.create(sizeof(Snapshot))) {
+            kLogger.warning()
+                    << "Failed to create shared memory segment for external"
+                    << "visualizers:" << m_sharedMemory.errorString();
+            return;
+        }
+    }
+    m_pSnapshot = new (m_sharedMemory.data()) Snapshot{};
+    m_pSnapshot->version = mixxx::visualsipc::kVersion;
+    // Written last so clients that find the magic can rely on the rest of
+    // the header being initialized.
+    m_pSnapshot->magic = mixxx::visualsipc::kMagic;
+
+    m_pMainVuLeft = ControlObject::getControl(
+            ConfigKey(kMainGroup, QStringLiteral("vu_meter_left")),
+            ControlFlag::NoWarnIfMissing);
+    m_pMainVuRight = ControlObject::getControl(
+            ConfigKey(kMainGroup, QStringLiteral("vu_meter_right")),
+            ControlFlag::NoWarnIfMissing);
+
+    m_pSpectrumWorker = std::make_unique<EngineSpectrumWorker>();
+}
+
+void EngineVisualsIpc::bindSpectrumWorker(EngineWorkerScheduler* pScheduler) {
+    if (!m_pSpectrumWorker) {
+        return;
+    }
+    m_pSpectrumWorker->setScheduler(pScheduler);
+    // Spectra are display-only; yield to the caching readers and the
+    // sidechain.
+    m_pSpectrumWorker->start(QThread::LowPriority);
+}
+
+EngineVisualsIpc::~EngineVisualsIpc() {
+    if (m_pSpectrumWorker && m_pSpectrumWorker->isRunning()) {
+        m_pSpectrumWorker->quitWait();
+    }
+    if (m_pSnapshot) {
+        // Tell clients the segment is dead before it is detached.
+        m_pSnapshot->magic = 0;
+    }
+    // m_sharedMemory detaches and releases the segment in its destructor.
+}
+
+int EngineVisualsIpc::onChannelAdded(const QString& group) {
+    if (m_pSnapshot == nullptr) {
+        return -1;
+    }
+    const int numDecks = m_numDecks.load(std::memory_order_relaxed);
+    if (numDecks >= static_cast<int>(mixxx::visualsipc::kMaxDecks)) {
+        return -1;
+    }
+    // Only decks (including samplers and preview decks) have a playback
+    // position published for visuals.
+    const auto pVisualPlayPosition = VisualPlayPosition::getVisualPlayPosition(group);
+    if (!pVisualPlayPosition ||
+            ControlObject::getControl(
+                    ConfigKey(group, QStringLiteral("playposition")),
+                    ControlFlag::NoWarnIfMissing) == nullptr) {
+        return -1;
+    }
+    DeckSource& source = m_deckSources[numDecks];
+    source.pVisualPlayPosition = pVisualPlayPosition;
+    source.pBpm = ControlObject::getControl(
+            ConfigKey(group, QStringLiteral("bpm")),
+            ControlFlag::NoWarnIfMissing);
+    source.pBeatDistance = ControlObject::getControl(
+            ConfigKey(group, QStringLiteral("beat_distance")),
+            ControlFlag::NoWarnIfMissing);
+    source.pVuLeft = ControlObject::getControl(
+            ConfigKey(group, QStringLiteral("vu_meter_left")),
+            ControlFlag::NoWarnIfMissing);
+    source.pVuRight = ControlObject::getControl(
+            ConfigKey(group, QStringLiteral("vu_meter_right")),
+            ControlFlag::NoWarnIfMissing);
+    source.pPlay = ControlObject::getControl(
+            ConfigKey(group, QStringLiteral("play")),
+            ControlFlag::NoWarnIfMissing);
+
+    mixxx::visualsipc::DeckState& deck = m_pSnapshot->decks[numDecks];
+    const QByteArray groupName = group.toLatin1();
+    std::strncpy(deck.group, groupName.constData(), sizeof(deck.group) - 1);
+    deck.group[sizeof(deck.group) - 1] = '\0';
+
+    // Spectrum worker slots are assigned in the same order, so the deck
+    // indices of both sides stay identical.
+    const int spectrumDeck = m_pSpectrumWorker->addDeck();
+    DEBUG_ASSERT(spectrumDeck == numDecks);
+
+    // The release store pairs with the acquire load in publish() and orders
+    // the writes above before the audio thread picks up the new deck.
+    m_numDecks.store(numDecks + 1, std::memory_order_release);
+    return numDecks;
+}
+
+void EngineVisualsIpc::feedDeckSamples(
+        int deckIndex, const CSAMPLE* pBuffer, std::size_t bufferSize) {
+    if (m_pSpectrumWorker) {
+        m_pSpectrumWorker->writeSamples(deckIndex, pBuffer, bufferSize);
+    }
+}
+
+void EngineVisualsIpc::publish(double sampleRate) {
+    Snapshot* pSnapshot = m_pSnapshot;
+    if (pSnapshot == nullptr) {
+        return;
+    }
+    const int numDecks = m_numDecks.load(std::memory_order_acquire);
+
+    // Seqlock write side: odd while the payload is inconsistent.
+    const uint32_t sequence =
+            pSnapshot->sequence.load(std::memory_order_relaxed);
+    pSnapshot->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    pSnapshot->numDecks = static_cast<uint32_t>(numDecks);
+    pSnapshot->sampleRate = sampleRate;
+    pSnapshot->callbackCount = ++m_callbackCount;
+    pSnapshot->mainVuLeft = m_pMainVuLeft
+            ? static_cast<float>(m_pMainVuLeft->get())
+            : 0.0f;
+    pSnapshot->mainVuRight = m_pMainVuRight
+            ? static_cast<float>(m_pMainVuRight->get())
+            : 0.0f;
+
+    for (int i = 0; i < numDecks; ++i) {
+        const DeckSource& source = m_deckSources[i];
+        mixxx::visualsipc::DeckState& deck = pSnapshot->decks[i];
+        deck.playPosition = source.pVisualPlayPosition->getEnginePlayPos();
+        deck.bpm = source.pBpm ? source.pBpm->get() : 0.0;
+        deck.beatDistance =
+                source.pBeatDistance ? source.pBeatDistance->get() : 0.0;
+        deck.vuLeft = source.pVuLeft
+                ? static_cast<float>(source.pVuLeft->get())
+                : 0.0f;
+        deck.vuRight = source.pVuRight
+                ? static_cast<float>(source.pVuRight->get())
+                : 0.0f;
+        deck.playing = (source.pPlay && source.pPlay->toBool()) ? 1 : 0;
+        m_pSpectrumWorker->readSpectrum(i, deck.spectrum);
+    }
+
+    pSnapshot->sequence.store(sequence + 2, std::memory_order_release);
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <QSharedMemory>
+#include <QSharedPointer>
+#include <QString>
+#include <array>
+#include <atomic>
+#include <memory>
+
+#include "engine/visualsipc.h"
+#include "util/types.h"
+
+class ControlObject;
+class EngineSpectrumWorker;
+class EngineWorkerScheduler;
+class VisualPlayPosition;
+
+/// Publishes per-deck transport state and VU levels into a shared memory
+/// segment once per engine callback so external visualizer tools get
+/// beat-synced data without polling and without per-update syscalls.
+/// See visualsipc.h for the segment layout and the client protocol.
+///
+/// EngineMixer owns one instance, registers decks via onChannelAdded() and
+/// calls publish() at the end of every process() callback.
+class EngineVisualsIpc {
+  public:
+    EngineVisualsIpc();
+    ~EngineVisualsIpc();
+
+    /// Starts the spectrum worker on the given scheduler. Called once from
+    /// the EngineMixer constructor.
+    void bindSpectrumWorker(EngineWorkerScheduler* pScheduler);
+
+    /// Called from the main thread when a channel is added to EngineMixer.
+    /// Channels without a "playposition" control (microphones, auxiliaries)
+    /// are ignored. Returns the deck slot of the channel or -1.
+    int onChannelAdded(const QString& group);
+
+    /// Wait-free, called from the audio thread with the processed buffer of
+    /// a deck channel. Feeds the spectrum worker.
+    void feedDeckSamples(int deckIndex, const CSAMPLE* pBuffer, std::size_t bufferSize);
+
+    /// Called from the audio thread at the end of every EngineMixer::process.
+    void publish(double sampleRate);
+
+  private:
+    struct DeckSource {
+        QSharedPointer<VisualPlayPosition> pVisualPlayPosition;
+        ControlObject* pBpm;
+        ControlObject* pBeatDistance;
+        ControlObject* pVuLeft;
+        ControlObject* pVuRight;
+        ControlObject* pPlay;
+    };
+
+    QSharedMemory m_sharedMemory;
+    // nullptr if the segment could not be created, in which case all calls
+    // are no-ops.
+    mixxx::visualsipc::Snapshot* m_pSnapshot;
+    std::array<DeckSource, mixxx::visualsipc::kMaxDecks> m_deckSources;
+    // Number of valid entries in m_deckSources. Written by the main thread
+    // in onChannelAdded(), read by the audio thread in publish(); the
+    // release/acquire pair makes the new entry visible to the audio thread
+    // without locking the callback.
+    std::atomic<int> m_numDecks;
+    ControlObject* m_pMainVuLeft;
+    ControlObject* m_pMainVuRight;
+    uint64_t m_callbackCount;
+    std::unique_ptr<EngineSpectrumWorker> m_pSpectrumWorker;
+};
@@ -40,6 +40,13 @@ void EngineVuMeter::process(CSAMPLE* pIn, const std::size_t bufferSize) {
     CSAMPLE fVolSumL, fVolSumR;
 
     const auto sampleRate = mixxx::audio::SampleRate::fromDouble(m_sampleRate.get());
+    if (sampleRate != m_cachedSampleRate || bufferSize != m_cachedBufferSize) {
+        m_cachedSampleRate = sampleRate;
+        m_cachedBufferSize = bufferSize;
+        m_vuUpdateFrames = sampleRate / kVuUpdateRate;
+        m_peakHoldBuffers = static_cast<int>(
+                kPeakDuration * sampleRate / bufferSize / 2000);
+    }
 
     SampleUtil::CLIP_STATUS clipped = SampleUtil::sumAbsPerChannel(&fVolSumL,
             &fVolSumR,
@@ -51,7 +58,7 @@ void EngineVuMeter::process(CSAMPLE* pIn, const std::size_t bufferSize) {
     m_samplesCalculated += static_cast<unsigned int>(bufferSize / 2);
 
     // Are we ready to update the VU meter?:
-    if (m_samplesCalculated > (sampleRate / kVuUpdateRate)) {
+    if (m_samplesCalculated > m_vuUpdateFrames) {
         doSmooth(m_fRMSvolumeL,
                 std::log10(SHRT_MAX * m_fRMSvolumeSumL / (m_samplesCalculated * 1000) + 1));
         doSmooth(m_fRMSvolumeR,
@@ -82,27 +89,35 @@ void EngineVuMeter::process(CSAMPLE* pIn, const std::size_t bufferSize) {
     }
 
     if (clipped & SampleUtil::CLIPPING_LEFT) {
-        m_peakIndicatorLeft.set(1.0);
-        m_peakDurationL = static_cast<int>(kPeakDuration * sampleRate / bufferSize / 2000);
+        updatePeakIndicator(m_peakIndicatorLeft, m_peakActiveL, true);
+        m_peakDurationL = m_peakHoldBuffers;
     } else if (m_peakDurationL <= 0) {
-        m_peakIndicatorLeft.set(0.0);
+        updatePeakIndicator(m_peakIndicatorLeft, m_peakActiveL, false);
     } else {
         --m_peakDurationL;
     }
 
     if (clipped & SampleUtil::CLIPPING_RIGHT) {
-        m_peakIndicatorRight.set(1.0);
-        m_peakDurationR = static_cast<int>(kPeakDuration * sampleRate / bufferSize / 2000);
+        updatePeakIndicator(m_peakIndicatorRight, m_peakActiveR, true);
+        m_peakDurationR = m_peakHoldBuffers;
     } else if (m_peakDurationR <= 0) {
-        m_peakIndicatorRight.set(0.0);
+        updatePeakIndicator(m_peakIndicatorRight, m_peakActiveR, false);
     } else {
         --m_peakDurationR;
     }
 
-    m_peakIndicator.set(
-            (m_peakIndicatorRight.toBool() || m_peakIndicatorLeft.toBool())
-                    ? 1.0
-                    : 0.0);
+    updatePeakIndicator(m_peakIndicator,
+            m_peakActive,
+            m_peakActiveL || m_peakActiveR);
+}
+
+// static
+void EngineVuMeter::updatePeakIndicator(
+        ControlObject& indicator, bool& active, bool clipping) {
+    if (active != clipping) {
+        active = clipping;
+        indicator.set(clipping ? 1.0 : 0.0);
+    }
 }
 
 void EngineVuMeter::doSmooth(CSAMPLE &currentVolume, CSAMPLE newVolume)
@@ -135,4 +150,13 @@ void EngineVuMeter::reset() {
     m_fRMSvolumeSumR = 0;
     m_peakDurationL = 0;
     m_peakDurationR = 0;
+    m_peakActive = false;
+    m_peakActiveL = false;
+    m_peakActiveR = false;
+
+    // Force the derived constants to be recalculated on the next buffer.
+    m_cachedSampleRate = mixxx::audio::SampleRate();
+    m_cachedBufferSize = 0;
+    m_vuUpdateFrames = 0;
+    m_peakHoldBuffers = 0;
 }
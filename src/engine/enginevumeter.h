@@ -1,5 +1,6 @@
 #pragma once
 
+#include "audio/types.h"
 #include "control/controlobject.h"
 #include "control/pollingcontrolproxy.h"
 #include "engine/engineobject.h"
@@ -15,6 +16,9 @@ class EngineVuMeter : public EngineObject {
 
   private:
     void doSmooth(CSAMPLE &currentVolume, CSAMPLE newVolume);
+    // Updates the indicator control only when the state actually changes,
+    // to avoid per-buffer control traffic from all metered channels.
+    static void updatePeakIndicator(ControlObject& indicator, bool& active, bool clipping);
 
     ControlObject m_vuMeter;
     ControlObject m_vuMeterLeft;
@@ -30,6 +34,17 @@ class EngineVuMeter : public EngineObject {
     ControlObject m_peakIndicatorRight;
     int m_peakDurationL;
     int m_peakDurationR;
+    bool m_peakActive;
+    bool m_peakActiveL;
+    bool m_peakActiveR;
 
     PollingControlProxy m_sampleRate;
+
+    // Derived from the sample rate and buffer size, which only change on
+    // audio device reconfiguration; cached to keep the divisions out of
+    // the per-buffer path.
+    mixxx::audio::SampleRate m_cachedSampleRate;
+    std::size_t m_cachedBufferSize;
+    unsigned int m_vuUpdateFrames;
+    int m_peakHoldBuffers;
 };
@@ -2,6 +2,7 @@
 
 #include <cstdio>
 #include <cstring>
+#include <type_traits>
 
 #define MIXXX
 #include <fidlib.h>
@@ -16,6 +17,15 @@
 // You may also use the app fiview for analysis
 #define IIR_ANALYSIS 0
 
+// Both channels of the stereo pair run through the same coefficients with
+// independent state, which maps exactly onto a two-lane double vector
+// (one SSE2 register on x86-64, one NEON register on AArch64). MSVC has no
+// comparable vector extension, there the scalar per-channel loop is kept.
+#if defined(__GNUC__) || defined(__clang__)
+#define MIXXX_IIR_USE_STEREO_VECTOR 1
+typedef double StereoSampleVector __attribute__((vector_size(2 * sizeof(double))));
+#endif
+
 enum IIRPass {
     IIR_LP,
     IIR_BP,
@@ -109,7 +119,11 @@ class EngineFilterIIR : public EngineFilterIIRBase {
         // Copy the old coefficients into m_oldCoef
         memcpy(m_oldCoef, m_coef, sizeof(m_coef));
 
-        m_coef[0] = fid_design_coef(m_coef + 1, SIZE, spec_d, sampleRate, freq0, freq1, adj);
+        if (!lookupCachedCoefs(spec_d, sampleRate, freq0, freq1, adj)) {
+            m_coef[0] = fid_design_coef(
+                    m_coef + 1, SIZE, spec_d, sampleRate, freq0, freq1, adj);
+            storeCachedCoefs(spec_d, sampleRate, freq0, freq1, adj);
+        }
 
         initBuffers();
 
@@ -238,10 +252,32 @@ class EngineFilterIIR : public EngineFilterIIRBase {
 
     virtual void process(const CSAMPLE* pIn, CSAMPLE* pOutput, const std::size_t bufferSize) {
         if (!m_doRamping) {
+#ifdef MIXXX_IIR_USE_STEREO_VECTOR
+            // Interleave the two channels' states into two-lane vectors that
+            // stay in registers for the whole buffer, so every filter
+            // instruction advances the left and the right channel at once.
+            StereoSampleVector buf[SIZE];
+            for (unsigned int k = 0; k < SIZE; ++k) {
+                buf[k] = StereoSampleVector{m_buf1[k], m_buf2[k]};
+            }
+            for (std::size_t i = 0; i < bufferSize; i += 2) {
+                const StereoSampleVector in{
+                        static_cast<double>(pIn[i]),
+                        static_cast<double>(pIn[i + 1])};
+                const StereoSampleVector out = processSample(m_coef, buf, in);
+                pOutput[i] = static_cast<CSAMPLE>(out[0]);
+                pOutput[i + 1] = static_cast<CSAMPLE>(out[1]);
+            }
+            for (unsigned int k = 0; k < SIZE; ++k) {
+                m_buf1[k] = buf[k][0];
+                m_buf2[k] = buf[k][1];
+            }
+#else
             for (std::size_t i = 0; i < bufferSize; i += 2) {
                 pOutput[i] = static_cast<CSAMPLE>(processSample(m_coef, m_buf1, pIn[i]));
                 pOutput[i + 1] = static_cast<CSAMPLE>(processSample(m_coef, m_buf2, pIn[i + 1]));
             }
+#endif
         } else {
             double cross_mix = 0.0;
             double cross_inc = 4.0 / static_cast<double>(bufferSize);
@@ -291,7 +327,12 @@ class EngineFilterIIR : public EngineFilterIIRBase {
     }
 
   protected:
-    inline double processSample(double* coef, double* buf, double val);
+    // Advances the filter by one sample of one channel (T = double) or by one
+    // frame of both channels at once (T = StereoSampleVector). The lane
+    // arithmetic is identical in both cases, so the vectorized path computes
+    // bit for bit what two scalar calls would.
+    template<typename T>
+    static inline T processSample(double* coef, T* buf, std::type_identity_t<T> val);
     inline void pauseFilterInner() {
         // Set the current buffers to 0
         memset(m_buf1, 0, sizeof(m_buf1));
@@ -300,10 +341,62 @@ class EngineFilterIIR : public EngineFilterIIRBase {
         m_doStart = true;
     }
 
+    // A kill switch toggles a filter between exactly two designs (the knob
+    // gain and the kill gain), once per beat in a typical set. A two-entry
+    // cache of the most recent designs turns every toggle after the first
+    // pair into a memcpy instead of a transcendental fid_design_coef() run
+    // on the engine thread. Sweeping a knob still redesigns per change, the
+    // same cost as before.
+    struct CachedCoefs {
+        bool valid = false;
+        char spec[FIDSPEC_LENGTH];
+        double sampleRate;
+        double freq0;
+        double freq1;
+        int adj;
+        double coef[SIZE + 1];
+    };
+
+    bool lookupCachedCoefs(const char* spec,
+            double sampleRate,
+            double freq0,
+            double freq1,
+            int adj) {
+        for (const CachedCoefs& entry : m_coefCache) {
+            if (entry.valid && entry.sampleRate == sampleRate &&
+                    entry.freq0 == freq0 && entry.freq1 == freq1 &&
+                    entry.adj == adj && std::strcmp(entry.spec, spec) == 0) {
+                memcpy(m_coef, entry.coef, sizeof(m_coef));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void storeCachedCoefs(const char* spec,
+            double sampleRate,
+            double freq0,
+            double freq1,
+            int adj) {
+        CachedCoefs& entry = m_coefCache[m_coefCacheNext];
+        m_coefCacheNext = (m_coefCacheNext + 1) % 2;
+        std::strncpy(entry.spec, spec, sizeof(entry.spec));
+        entry.spec[sizeof(entry.spec) - 1] = '\0';
+        entry.sampleRate = sampleRate;
+        entry.freq0 = freq0;
+        entry.freq1 = freq1;
+        entry.adj = adj;
+        memcpy(entry.coef, m_coef, sizeof(m_coef));
+        entry.valid = true;
+    }
+
     double m_coef[SIZE + 1];
     // Old coefficients needed for ramping
     double m_oldCoef[SIZE + 1];
 
+    CachedCoefs m_coefCache[2];
+    int m_coefCacheNext = 0;
+
     // Channel 1 state
     double m_buf1[SIZE];
     // Old channel 1 buffer needed for ramping
@@ -323,10 +416,9 @@ class EngineFilterIIR : public EngineFilterIIRBase {
 };
 
 template<>
-inline double EngineFilterIIR<2, IIR_LP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+template<typename T>
+inline T EngineFilterIIR<2, IIR_LP>::processSample(double* coef, T* buf, std::type_identity_t<T> val) {
+    T tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = tmp;
@@ -337,10 +429,9 @@ inline double EngineFilterIIR<2, IIR_LP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<2, IIR_BP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+template<typename T>
+inline T EngineFilterIIR<2, IIR_BP>::processSample(double* coef, T* buf, std::type_identity_t<T> val) {
+    T tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = -tmp;
@@ -351,10 +442,9 @@ inline double EngineFilterIIR<2, IIR_BP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<2, IIR_HP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+template<typename T>
+inline T EngineFilterIIR<2, IIR_HP>::processSample(double* coef, T* buf, std::type_identity_t<T> val) {
+    T tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = tmp;
@@ -365,10 +455,9 @@ inline double EngineFilterIIR<2, IIR_HP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<4, IIR_LP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+template<typename T>
+inline T EngineFilterIIR<4, IIR_LP>::processSample(double* coef, T* buf, std::type_identity_t<T> val) {
+    T tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = tmp;
@@ -384,10 +473,9 @@ inline double EngineFilterIIR<4, IIR_LP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<8, IIR_BP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+template<typename T>
+inline T EngineFilterIIR<8, IIR_BP>::processSample(double* coef, T* buf, std::type_identity_t<T> val) {
+    T tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
     iir = val * coef[0];
@@ -414,10 +502,9 @@ inline double EngineFilterIIR<8, IIR_BP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<4, IIR_HP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+template<typename T>
+inline T EngineFilterIIR<4, IIR_HP>::processSample(double* coef, T* buf, std::type_identity_t<T> val) {
+    T tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     iir= val * coef[0];
     iir -= coef[1] * tmp; fir = tmp;
@@ -433,10 +520,9 @@ inline double EngineFilterIIR<4, IIR_HP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<8, IIR_LP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+template<typename T>
+inline T EngineFilterIIR<8, IIR_LP>::processSample(double* coef, T* buf, std::type_identity_t<T> val) {
+    T tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
     iir = val * coef[0];
@@ -463,10 +549,9 @@ inline double EngineFilterIIR<8, IIR_LP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<16, IIR_BP>::processSample(double* coef,
-                                                         double* buf,
-                                                         double val) {
-    double tmp, fir, iir;
+template<typename T>
+inline T EngineFilterIIR<16, IIR_BP>::processSample(double* coef, T* buf, std::type_identity_t<T> val) {
+    T tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
     buf[7] = buf[8]; buf[8] = buf[9]; buf[9] = buf[10]; buf[10] = buf[11];
@@ -515,10 +600,9 @@ inline double EngineFilterIIR<16, IIR_BP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<8, IIR_HP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+template<typename T>
+inline T EngineFilterIIR<8, IIR_HP>::processSample(double* coef, T* buf, std::type_identity_t<T> val) {
+    T tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
     iir = val * coef[0];
@@ -546,10 +630,9 @@ inline double EngineFilterIIR<8, IIR_HP>::processSample(double* coef,
 
 // IIR_LP and IIR_HP use the same processSample routine
 template<>
-inline double EngineFilterIIR<5, IIR_BP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+template<typename T>
+inline T EngineFilterIIR<5, IIR_BP>::processSample(double* coef, T* buf, std::type_identity_t<T> val) {
+    T tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = coef[2] * tmp;
@@ -560,10 +643,9 @@ inline double EngineFilterIIR<5, IIR_BP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<4, IIR_LPMO>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-   double tmp, fir, iir;
+template<typename T>
+inline T EngineFilterIIR<4, IIR_LPMO>::processSample(double* coef, T* buf, std::type_identity_t<T> val) {
+   T tmp, fir, iir;
    tmp= buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
    iir= val * coef[0];
    iir -= coef[1]*tmp; fir= tmp;
@@ -586,10 +668,9 @@ inline double EngineFilterIIR<4, IIR_LPMO>::processSample(double* coef,
 
 
 template<>
-inline double EngineFilterIIR<4, IIR_HPMO>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-   double tmp, fir, iir;
+template<typename T>
+inline T EngineFilterIIR<4, IIR_HPMO>::processSample(double* coef, T* buf, std::type_identity_t<T> val) {
+   T tmp, fir, iir;
    tmp= buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
    iir= val * coef[0];
    iir -= coef[1]*tmp; fir= -tmp;
@@ -611,10 +692,9 @@ inline double EngineFilterIIR<4, IIR_HPMO>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<2, IIR_LP2>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+template<typename T>
+inline T EngineFilterIIR<2, IIR_LP2>::processSample(double* coef, T* buf, std::type_identity_t<T> val) {
+    T tmp, fir, iir;
     tmp = buf[0];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = tmp;
@@ -632,10 +712,9 @@ inline double EngineFilterIIR<2, IIR_LP2>::processSample(double* coef,
 
 
 template<>
-inline double EngineFilterIIR<2, IIR_HP2>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+template<typename T>
+inline T EngineFilterIIR<2, IIR_HP2>::processSample(double* coef, T* buf, std::type_identity_t<T> val) {
+    T tmp, fir, iir;
     tmp = buf[0];
     iir = val * -coef[0]; // swap gain to be in phase with LP2
     iir -= coef[1] * tmp; fir = -tmp;
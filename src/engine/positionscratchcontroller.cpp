@@ -36,6 +36,89 @@ class VelocityController {
     double m_p, m_d;
 };
 
+// Ring of timestamped scratch position observations with a least-squares
+// straight-line fit over a configurable window. Evaluating the fit at the
+// newest timestamp smooths the discrete controller/mouse updates without
+// adding lag to constant-velocity motion (a line fits itself exactly), so
+// jitter can be traded against responsiveness via the window length alone.
+// The sums are accumulated in plain loops over flat arrays, which the
+// compiler can vectorize.
+class PositionHistoryFilter {
+  public:
+    static constexpr int kMaxHistory = 16;
+
+    PositionHistoryFilter()
+            : m_writeIndex(0),
+              m_numObservations(0) {
+    }
+
+    void reset() {
+        m_writeIndex = 0;
+        m_numObservations = 0;
+    }
+
+    void observe(double time, double position) {
+        m_times[m_writeIndex] = time;
+        m_positions[m_writeIndex] = position;
+        m_writeIndex = (m_writeIndex + 1) % kMaxHistory;
+        if (m_numObservations < kMaxHistory) {
+            ++m_numObservations;
+        }
+    }
+
+    // Least-squares fit of the newest `window` observations, evaluated at
+    // the newest timestamp. Falls back to the raw newest position until
+    // two observations are available.
+    double evaluate(int window) const {
+        if (m_numObservations < 2) {
+            return m_numObservations == 1
+                    ? m_positions[(m_writeIndex + kMaxHistory - 1) % kMaxHistory]
+                    : 0.0;
+        }
+        window = math_clamp(window, 2, m_numObservations);
+
+        // Unroll the ring into flat arrays, oldest first.
+        double times[kMaxHistory];
+        double positions[kMaxHistory];
+        const int begin = (m_writeIndex + kMaxHistory - window) % kMaxHistory;
+        for (int i = 0; i < window; ++i) {
+            const int ringIndex = (begin + i) % kMaxHistory;
+            times[i] = m_times[ringIndex];
+            positions[i] = m_positions[ringIndex];
+        }
+
+        double sumT = 0;
+        double sumP = 0;
+        for (int i = 0; i < window; ++i) {
+            sumT += times[i];
+            sumP += positions[i];
+        }
+        const double meanT = sumT / window;
+        const double meanP = sumP / window;
+
+        double varT = 0;
+        double covTP = 0;
+        for (int i = 0; i < window; ++i) {
+            const double dT = times[i] - meanT;
+            varT += dT * dT;
+            covTP += dT * (positions[i] - meanP);
+        }
+        if (varT <= 0) {
+            // All observations at the same timestamp, no usable fit.
+            return positions[window - 1];
+        }
+
+        const double slope = covTP / varT;
+        return meanP + slope * (times[window - 1] - meanT);
+    }
+
+  private:
+    double m_times[kMaxHistory];
+    double m_positions[kMaxHistory];
+    int m_writeIndex;
+    int m_numObservations;
+};
+
 class RateIIFilter {
   public:
     RateIIFilter()
@@ -80,6 +163,12 @@ constexpr double kMaxVelocity = 100;
 // Seconds to stop a throw at the max velocity.
 // TODO make configurable, eg. to customize spinbacks with controllers
 constexpr double kTimeToStop = 1.0;
+// Default window (in position observations) of the least-squares smoothing
+// of the scratch position history. Larger windows iron out more jitter from
+// discrete mouse/jog updates at the expense of responsiveness to sudden
+// direction changes; skins and controller mappings can adjust the tradeoff
+// via the "scratch_position_smoothing" control. 0 disables the smoothing.
+constexpr double kDefaultPositionSmoothing = 4;
 
 } // anonymous namespace
 
@@ -89,10 +178,13 @@ PositionScratchController::PositionScratchController(const QString& group)
                   ConfigKey(group, QStringLiteral("scratch_position_enable")))),
           m_pScratchPos(std::make_unique<ControlObject>(
                   ConfigKey(group, QStringLiteral("scratch_position")))),
+          m_pScratchSmoothing(std::make_unique<ControlObject>(
+                  ConfigKey(group, QStringLiteral("scratch_position_smoothing")))),
           m_pMainSampleRate(std::make_unique<ControlProxy>(
                   ConfigKey(QStringLiteral("[App]"), QStringLiteral("samplerate")))),
           m_pVelocityController(std::make_unique<VelocityController>()),
           m_pRateIIFilter(std::make_unique<RateIIFilter>()),
+          m_pPositionFilter(std::make_unique<PositionHistoryFilter>()),
           m_isScratching(false),
           m_inertiaEnabled(false),
           m_prevSamplePos(0),
@@ -103,6 +195,7 @@ PositionScratchController::PositionScratchController(const QString& group)
           m_rate(0),
           m_moveDelay(0),
           m_scratchPosSampleTime(0),
+          m_scratchTime(0),
           m_bufferSize(-1),
           m_dt(1),
           m_callsPerDt(1),
@@ -112,6 +205,8 @@ PositionScratchController::PositionScratchController(const QString& group)
           m_f(0.4) {
     m_pMainSampleRate->connectValueChanged(this,
             &PositionScratchController::slotUpdateFilterParameters);
+    m_pScratchSmoothing->setDefaultValue(kDefaultPositionSmoothing);
+    m_pScratchSmoothing->set(kDefaultPositionSmoothing);
 }
 
 PositionScratchController::~PositionScratchController() {
@@ -220,15 +315,29 @@ void PositionScratchController::process(double currentSamplePos,
             m_samplePosDeltaSum += (sampleDelta) / (bufferSize * baseSampleRate);
 
             m_scratchPosSampleTime += m_dt;
+            m_scratchTime += m_dt;
             // If the kDefaultSampleInterval has expired, calculate scratch parameters and
             // eventually the new rate.
             // Else, continue with the last rate.
             if (m_scratchPosSampleTime >= kDefaultSampleInterval) {
                 m_scratchPosSampleTime = 0;
 
+                // Record the raw position in the history ring and fit the
+                // recent trajectory. The fit evaluated at the newest
+                // timestamp replaces the raw position in the rate
+                // calculation below, which irons out discrete mouse/jog
+                // update steps without lagging behind steady motion.
+                const double scratchPos = m_pScratchPos->get();
+                m_pPositionFilter->observe(m_scratchTime, scratchPos);
+                const int smoothingWindow =
+                        static_cast<int>(m_pScratchSmoothing->get());
+                const double smoothedScratchPos = smoothingWindow >= 2
+                        ? m_pPositionFilter->evaluate(smoothingWindow)
+                        : scratchPos;
+
                 // Set the scratch target to the current set position
                 // and normalize to one buffer
-                double scratchTargetDelta = (m_pScratchPos->get() - m_scratchStartPos) /
+                double scratchTargetDelta = (scratchPos - m_scratchStartPos) /
                         (bufferSize * baseSampleRate);
 
                 bool calcRate = true;
@@ -251,6 +360,7 @@ void PositionScratchController::process(double currentSamplePos,
                             // in stopped mode
                             m_pVelocityController->reset(0);
                             m_pRateIIFilter->reset(0);
+                            m_pPositionFilter->reset();
                             m_samplePosDeltaSum = 0;
                         }
                     }
@@ -264,8 +374,13 @@ void PositionScratchController::process(double currentSamplePos,
                 // It'll adapt to the scratch speed in the next run.
                 // Setting rate to 0 has the same effect apparently.
                 if (calcRate) {
+                    // The stall detection above compares raw positions, but
+                    // the controller error uses the smoothed trajectory.
+                    const double smoothedTargetDelta =
+                            (smoothedScratchPos - m_scratchStartPos) /
+                            (bufferSize * baseSampleRate);
                     double ctrlError = m_pRateIIFilter->filter(
-                            scratchTargetDelta - m_samplePosDeltaSum);
+                            smoothedTargetDelta - m_samplePosDeltaSum);
                     m_rate = m_pVelocityController->observation(ctrlError);
                     m_rate /= m_callsPerDt;
                     if (fabs(m_rate) < MIN_SEEK_SPEED) {
@@ -310,6 +425,9 @@ void PositionScratchController::process(double currentSamplePos,
         // may be entirely unrelated to audio frames.
         m_scratchStartPos = m_pScratchPos->get();
         m_scratchPosSampleTime = 0;
+        m_scratchTime = 0;
+        m_pPositionFilter->reset();
+        m_pPositionFilter->observe(m_scratchTime, m_scratchStartPos);
         // qDebug() << "scratchEnable()" << currentSamplePos;
     }
 
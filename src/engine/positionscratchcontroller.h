@@ -9,6 +9,7 @@ class ControlObject;
 class ControlProxy;
 class VelocityController;
 class RateIIFilter;
+class PositionHistoryFilter;
 
 class PositionScratchController : public QObject {
     Q_OBJECT
@@ -42,9 +43,11 @@ class PositionScratchController : public QObject {
     const QString m_group;
     std::unique_ptr<ControlObject> m_pScratchEnable;
     std::unique_ptr<ControlObject> m_pScratchPos;
+    std::unique_ptr<ControlObject> m_pScratchSmoothing;
     std::unique_ptr<ControlProxy> m_pMainSampleRate;
     std::unique_ptr<VelocityController> m_pVelocityController;
     std::unique_ptr<RateIIFilter> m_pRateIIFilter;
+    std::unique_ptr<PositionHistoryFilter> m_pPositionFilter;
     bool m_isScratching;
     bool m_inertiaEnabled;
     double m_prevSamplePos;
@@ -55,6 +58,7 @@ class PositionScratchController : public QObject {
     double m_rate;
     double m_moveDelay;
     double m_scratchPosSampleTime;
+    double m_scratchTime;
 
     std::size_t m_bufferSize;
 
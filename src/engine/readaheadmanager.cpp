@@ -5,9 +5,23 @@
 #include "engine/controls/cuecontrol.h"
 #include "engine/controls/loopingcontrol.h"
 #include "engine/controls/ratecontrol.h"
+#include "util/counter.h"
 #include "util/defs.h"
+#include "util/math.h"
 #include "util/sample.h"
 
+namespace {
+
+// Prefetch tuning for hintReader(): the per-callback decay of the peak-held
+// playback rate, the upper bound of chunks kept ahead of the playhead, and
+// the number of callbacks both directions stay hinted after the playback
+// direction flipped (roughly a second of audio at common buffer sizes).
+constexpr double kPeakRateDecayPerCallback = 0.995;
+constexpr SINT kMaxChunksToCache = 8;
+constexpr int kBothDirectionsHoldoffCallbacks = 250;
+
+} // anonymous namespace
+
 ReadAheadManager::ReadAheadManager()
         : m_pLoopingControl(nullptr),
           m_pCueControl(nullptr),
@@ -16,7 +30,10 @@ ReadAheadManager::ReadAheadManager()
           m_pReader(nullptr),
           m_pCrossFadeBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
           m_cacheMissCount(0),
-          m_cacheMissExpected(false) {
+          m_cacheMissExpected(false),
+          m_peakAbsRate(1.0),
+          m_lastHintWasReverse(false),
+          m_bothDirectionsHoldoff(0) {
     // For testing only: ReadAheadManagerMock
 }
 
@@ -30,7 +47,10 @@ ReadAheadManager::ReadAheadManager(CachingReader* pReader,
           m_pReader(pReader),
           m_pCrossFadeBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
           m_cacheMissCount(0),
-          m_cacheMissExpected(false) {
+          m_cacheMissExpected(false),
+          m_peakAbsRate(1.0),
+          m_lastHintWasReverse(false),
+          m_bothDirectionsHoldoff(0) {
     DEBUG_ASSERT(m_pLoopingControl != nullptr);
     DEBUG_ASSERT(m_pCueControl != nullptr);
     DEBUG_ASSERT(m_pReader != nullptr);
@@ -44,6 +64,15 @@ SINT ReadAheadManager::getNextSamples(double dRate,
         CSAMPLE* pOutput,
         SINT requested_samples,
         mixxx::audio::ChannelCount channelCount) {
+    return getNextSamplesScatter(
+            dRate, pOutput, requested_samples, channelCount, nullptr);
+}
+
+SINT ReadAheadManager::getNextSamplesScatter(double dRate,
+        CSAMPLE* pOutput,
+        SINT requested_samples,
+        mixxx::audio::ChannelCount channelCount,
+        CachingReader::ScatterSampleSpans* pSpans) {
     // qDebug() << "getNextSamples:" << m_currentPosition << requested_samples;
 
     int modSamples = requested_samples % channelCount;
@@ -142,28 +171,47 @@ SINT ReadAheadManager::getNextSamples(double dRate,
     SINT start_sample = SampleUtil::roundPlayPosToFrameStart(
             m_currentPosition, channelCount);
 
-    const auto readResult = m_pReader->read(
-            start_sample, samples_from_reader, in_reverse, pOutput, channelCount);
-    if (readResult == CachingReader::ReadResult::UNAVAILABLE) {
-        // Cache miss - no samples written
-        SampleUtil::clear(pOutput, samples_from_reader);
-        // Set the cache miss flag to decide when to apply ramping
-        // after the following read attempts.
-        m_cacheMissCount++;
-    } else if (m_cacheMissCount > 0) {
-        // Previous read was a cache miss, but now we got something back.
-        // Apply ramping gain, because the last buffer has unwanted silence
-        // and new samples without fading are causing a pop.
-        SampleUtil::applyRampingGain(pOutput,
-                CSAMPLE_GAIN_ZERO,
-                CSAMPLE_GAIN_ONE,
-                samples_from_reader);
-        // Reset the cache miss flag, because we are now back on track.
-        if (!m_cacheMissExpected) {
-            qDebug() << "ReadAheadManager: continue after number cache misses:" << m_cacheMissCount;
+    bool scatterRead = false;
+    if (pSpans && !in_reverse && !reachedTrigger && m_cacheMissCount == 0) {
+        // Zero-copy fast path: a plain forward read without a pending
+        // trigger or cache-miss ramp can be handed out as spans pointing
+        // directly into the reader's chunk cache. If it cannot be served
+        // instantly, fall through to the copying read() below, which pads
+        // silence and does the cache miss accounting.
+        scatterRead = m_pReader->readScatter(start_sample,
+                              samples_from_reader,
+                              channelCount,
+                              pSpans) == CachingReader::ReadResult::AVAILABLE;
+    }
+    if (!scatterRead) {
+        const auto readResult = m_pReader->read(
+                start_sample, samples_from_reader, in_reverse, pOutput, channelCount);
+        if (readResult == CachingReader::ReadResult::UNAVAILABLE) {
+            // Cache miss - no samples written
+            SampleUtil::clear(pOutput, samples_from_reader);
+            // Set the cache miss flag to decide when to apply ramping
+            // after the following read attempts.
+            m_cacheMissCount++;
+        } else if (m_cacheMissCount > 0) {
+            // Previous read was a cache miss, but now we got something back.
+            // Apply ramping gain, because the last buffer has unwanted silence
+            // and new samples without fading are causing a pop.
+            SampleUtil::applyRampingGain(pOutput,
+                    CSAMPLE_GAIN_ZERO,
+                    CSAMPLE_GAIN_ONE,
+                    samples_from_reader);
+            // Reset the cache miss flag, because we are now back on track.
+            if (!m_cacheMissExpected) {
+                // Unexpected misses (not caused by a seek) mean the prefetch
+                // policy in hintReader() failed to keep up; exported via
+                // StatsManager so the policy can be verified in production.
+                Counter("ReadAheadManager::getNextSamples(): unexpected cache misses")
+                        .increment(m_cacheMissCount);
+                qDebug() << "ReadAheadManager: continue after number cache misses:" << m_cacheMissCount;
+            }
+            m_cacheMissCount = 0;
+            m_cacheMissExpected = false;
         }
-        m_cacheMissCount = 0;
-        m_cacheMissExpected = false;
     }
 
     // Increment or decrement current read-ahead position
@@ -285,11 +333,33 @@ void ReadAheadManager::hintReader(double dRate,
         gsl::not_null<HintVector*> pHintList,
         mixxx::audio::ChannelCount channelCount) {
     bool in_reverse = dRate < 0;
+
+    // Track the recent playback velocity with a peak-hold that decays
+    // slowly: speeding up (fast pitch bends, scratch spikes) widens the
+    // prefetch window immediately, slowing down narrows it again over the
+    // following callbacks.
+    m_peakAbsRate = math_max(fabs(dRate), m_peakAbsRate * kPeakRateDecayPerCallback);
+
+    // While scratching the direction flips rapidly. Keep prefetching on both
+    // sides of the playhead for a while after each flip, so that reversing
+    // back into chunks that were already evicted does not return silence.
+    if (in_reverse != m_lastHintWasReverse) {
+        m_bothDirectionsHoldoff = kBothDirectionsHoldoffCallbacks;
+    } else if (m_bothDirectionsHoldoff > 0) {
+        --m_bothDirectionsHoldoff;
+    }
+    m_lastHintWasReverse = in_reverse;
+
     Hint current_position;
 
-    // SoundTouch can read up to 2 chunks ahead. Always keep 2 chunks ahead in
-    // cache.
-    SINT frameCountToCache = 2 * CachingReaderChunk::kFrames;
+    // SoundTouch can read up to 2 chunks ahead. Always keep at least 2 chunks
+    // ahead in cache, and proportionally more when playing faster, since each
+    // callback then consumes more frames.
+    const SINT chunksToCache = math_clamp(
+            static_cast<SINT>(ceil(2.0 * m_peakAbsRate)),
+            static_cast<SINT>(2),
+            kMaxChunksToCache);
+    SINT frameCountToCache = chunksToCache * CachingReaderChunk::kFrames;
     current_position.frameCount = frameCountToCache;
 
     // this called after the precious chunk was consumed
@@ -303,16 +373,30 @@ void ReadAheadManager::hintReader(double dRate,
     }
 
     // If we are trying to cache before the start of the track,
-    // Then we don't need to cache because it's all zeros!
-    if (current_position.frame < 0 &&
-            current_position.frame + current_position.frameCount < 0)
-    {
-    	return;
+    // it's all zeros anyway and does not need to be cached.
+    if (current_position.frame + current_position.frameCount >= 0) {
+        // top priority, we need to read this data immediately
+        current_position.type = Hint::Type::CurrentPosition;
+        pHintList->append(current_position);
     }
 
-    // top priority, we need to read this data immediately
-    current_position.type = Hint::Type::CurrentPosition;
-    pHintList->append(current_position);
+    if (m_bothDirectionsHoldoff > 0) {
+        // Mirror the prefetch window to the other side of the playhead.
+        Hint opposite_position;
+        opposite_position.frameCount = frameCountToCache;
+        if (in_reverse) {
+            opposite_position.frame =
+                    static_cast<SINT>(floor(m_currentPosition / channelCount));
+        } else {
+            opposite_position.frame =
+                    static_cast<SINT>(ceil(m_currentPosition / channelCount)) -
+                    frameCountToCache;
+        }
+        if (opposite_position.frame + opposite_position.frameCount >= 0) {
+            opposite_position.type = Hint::Type::CurrentPosition;
+            pHintList->append(opposite_position);
+        }
+    }
 }
 
 // Not thread-save, call from engine thread only
@@ -39,6 +39,19 @@ class ReadAheadManager {
             SINT requested_samples,
             mixxx::audio::ChannelCount channelCount);
 
+    /// Variant of getNextSamples() with a zero-copy fast path. A plain
+    /// forward read without a pending loop/jump trigger or cache-miss ramp
+    /// is served as spans pointing directly into the reader's chunk cache,
+    /// appended to pSpans and valid only within the current callback; buffer
+    /// is left untouched then. Whenever the fast path does not apply the
+    /// samples are read into buffer as usual and pSpans stays empty, so
+    /// callers must check pSpans to find out where the samples ended up.
+    virtual SINT getNextSamplesScatter(double dRate,
+            CSAMPLE* buffer,
+            SINT requested_samples,
+            mixxx::audio::ChannelCount channelCount,
+            CachingReader::ScatterSampleSpans* pSpans);
+
     /// Used to add a new EngineControls that ReadAheadManager will use to decide
     /// which samples to return.
     void addLoopingControl();
@@ -133,4 +146,11 @@ class ReadAheadManager {
     CSAMPLE* m_pCrossFadeBuffer;
     int m_cacheMissCount;
     bool m_cacheMissExpected;
+    /// Playback telemetry for the adaptive prefetch in hintReader(): a
+    /// peak-held absolute playback rate that widens the prefetch window when
+    /// playing fast, and a holdoff that keeps both sides of the playhead
+    /// hinted for a while after the direction flipped (scratching).
+    double m_peakAbsRate;
+    bool m_lastHintWasReverse;
+    int m_bothDirectionsHoldoff;
 };
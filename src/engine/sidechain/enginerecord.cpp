@@ -1,5 +1,11 @@
 #include "engine/sidechain/enginerecord.h"
 
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
 #include "control/controlproxy.h"
 #include "encoder/encoder.h"
 #include "mixer/playerinfo.h"
@@ -11,11 +17,21 @@
 
 constexpr int kMetaDataLifeTimeout = 16;
 
+// Push the recording file to disk once this many bytes have been written.
+// Without the scheduled syncs the dirty pages of a long recording pile up
+// until the kernel flushes them in one go, e.g. when a library scan causes
+// page-cache pressure, and such a flush can stall the sidechain thread
+// long enough to overrun the sample FIFO. Syncing every megabyte keeps
+// each stall bounded by the sync interval instead.
+constexpr int kBytesPerSync = 1 << 20;
+
 EngineRecord::EngineRecord(UserSettingsPointer pConfig)
         : m_pConfig(pConfig),
+          m_bWriteToNextFile(false),
           m_sampleRateControl(QStringLiteral("[App]"), QStringLiteral("samplerate")),
           m_frames(0),
           m_recordedDuration(0),
+          m_bytesSinceSync(0),
           m_iMetaDataLife(0),
           m_cueTrack(0),
           m_bCueIsEnabled(false),
@@ -27,6 +43,7 @@ EngineRecord::EngineRecord(UserSettingsPointer pConfig)
 EngineRecord::~EngineRecord() {
     closeCueFile();
     closeFile();
+    discardPreparedSplit();
     delete m_pRecReady;
 }
 
@@ -111,6 +128,13 @@ bool EngineRecord::metaDataHasChanged()
     return true;
 }
 
+bool EngineRecord::isActive() const {
+    // Called from the engine callback. While recording is off, process() only
+    // has to run once more after the status changed so it can finalize the
+    // recording file; EngineSideChain takes care of that.
+    return static_cast<int>(m_pRecReady->get()) != RECORD_OFF;
+}
+
 void EngineRecord::process(const CSAMPLE* pBuffer, const std::size_t bufferSize) {
     const auto recordingStatus = static_cast<int>(m_pRecReady->get());
     static const QString tag("EngineRecord recording");
@@ -125,6 +149,9 @@ void EngineRecord::process(const CSAMPLE* pBuffer, const std::size_t bufferSize)
             }
             emit isRecording(false, false);
         }
+        // Recording may have been stopped between RECORD_SPLIT_PREPARE
+        // and the actual split; delete the unused next file.
+        discardPreparedSplit();
     } else if (recordingStatus == RECORD_READY) {
         // If we are ready for recording, i.e, the output file has been selected, we
         // open a new file.
@@ -163,6 +190,16 @@ void EngineRecord::process(const CSAMPLE* pBuffer, const std::size_t bufferSize)
             // An error occurred.
             emit isRecording(false, true);
         }
+    } else if (recordingStatus == RECORD_SPLIT_PREPARE) {
+        // RecordingManager announces an upcoming split a little ahead of
+        // the actual threshold. Open the next file and initialize its
+        // encoder now, between two buffers, so the later
+        // RECORD_SPLIT_CONTINUE only has to swap files instead of doing
+        // encoder setup while samples keep piling up in the FIFO. If
+        // preparing fails, RECORD_SPLIT_CONTINUE falls back to the
+        // synchronous path below.
+        prepareSplitFile();
+        m_pRecReady->set(RECORD_ON);
     } else if (recordingStatus == RECORD_SPLIT_CONTINUE) {
         if (fileOpen()) {
             closeFile();  // Close file and free encoder.
@@ -170,8 +207,18 @@ void EngineRecord::process(const CSAMPLE* pBuffer, const std::size_t bufferSize)
                 closeCueFile();
             }
         }
-        updateFromPreferences();  // Update file location from preferences.
-        if (openFile()) {
+        bool splitFileReady;
+        if (m_pNextEncoder) {
+            // The next file and its encoder were prepared ahead of time,
+            // see RECORD_SPLIT_PREPARE. The buffer of this very call
+            // already goes into the new file, no samples are lost in
+            // between.
+            splitFileReady = activatePreparedSplit();
+        } else {
+            updateFromPreferences();  // Update file location from preferences.
+            splitFileReady = openFile();
+        }
+        if (splitFileReady) {
             qDebug() << "Splitting to a new file: "<< m_fileName;
             m_pRecReady->set(RECORD_ON);
             emit isRecording(true, false);  // will notify the RecordingManager
@@ -272,6 +319,16 @@ void EngineRecord::writeCueLine() {
 // Encoder calls this method to write compressed audio
 void EngineRecord::write(const unsigned char *header, const unsigned char *body,
                          int headerLen, int bodyLen) {
+    if (m_bWriteToNextFile) {
+        // Headers of the prepared next split file, see prepareSplitFile().
+        // Not counted via bytesRecorded(); that drives the split
+        // accounting of the file we are still recording into.
+        if (headerLen > 0) {
+            m_nextDataStream.writeRawData((const char*)header, headerLen);
+        }
+        m_nextDataStream.writeRawData((const char*)body, bodyLen);
+        return;
+    }
     if (!fileOpen()) {
         return;
     }
@@ -283,9 +340,29 @@ void EngineRecord::write(const unsigned char *header, const unsigned char *body,
     m_dataStream.writeRawData((const char*) body, bodyLen);
     emit bytesRecorded((headerLen+bodyLen));
 
+    m_bytesSinceSync += headerLen + bodyLen;
+    if (m_bytesSinceSync >= kBytesPerSync) {
+        syncFileBuffers();
+        m_bytesSinceSync = 0;
+    }
+}
+
+// Flushes Qt's write buffer and the page cache out to the drive. This runs
+// on the sidechain thread and only blocks for the data written since the
+// last sync, see kBytesPerSync.
+void EngineRecord::syncFileBuffers() {
+    m_file.flush();
+#ifdef Q_OS_WIN
+    _commit(m_file.handle());
+#else
+    fsync(m_file.handle());
+#endif
 }
 // Encoder calls this method to write compressed audio
 int EngineRecord::tell() {
+    if (m_bWriteToNextFile) {
+        return m_nextFile.pos();
+    }
     if (!fileOpen()) {
         return -1;
     }
@@ -293,6 +370,10 @@ int EngineRecord::tell() {
 }
 // Encoder calls this method to write compressed audio
 void EngineRecord::seek(int pos) {
+    if (m_bWriteToNextFile) {
+        m_nextFile.seek(static_cast<qint64>(pos));
+        return;
+    }
     if (!fileOpen()) {
         return;
     }
@@ -300,6 +381,9 @@ void EngineRecord::seek(int pos) {
 }
 // These are not used for streaming, but the interface requires them
 int EngineRecord::filelen() {
+    if (m_bWriteToNextFile) {
+        return m_nextFile.size();
+    }
     if (!fileOpen()) {
         return 0;
     }
@@ -323,6 +407,7 @@ bool EngineRecord::openFile() {
         if (m_file.handle() != -1) {
             m_dataStream.setDevice(&m_file);
         }
+        m_bytesSinceSync = 0;
     } else {
         return false;
     }
@@ -391,3 +476,93 @@ void EngineRecord::closeCueFile() {
         m_cueFile.close();
     }
 }
+
+bool EngineRecord::prepareSplitFile() {
+    discardPreparedSplit();
+
+    m_nextFileName = m_pConfig->getValueString(ConfigKey(RECORDING_PREF_KEY, "Path"));
+    m_nextCueFileName = m_pConfig->getValueString(ConfigKey(RECORDING_PREF_KEY, "CuePath"));
+
+    m_nextFile.setFileName(m_nextFileName);
+    if (!m_nextFile.open(QIODevice::WriteOnly)) {
+        qDebug() << "EngineRecord::prepareSplitFile() failed for"
+                 << m_nextFileName
+                 << m_nextFile.errorString();
+        return false;
+    }
+    m_nextDataStream.setDevice(&m_nextFile);
+
+    Encoder::Format format = EncoderFactory::getFactory().getSelectedFormat(m_pConfig);
+    EncoderPointer pEncoder = EncoderFactory::getFactory().createRecordingEncoder(
+            format, m_pConfig, this);
+    int ret = -1;
+    if (pEncoder) {
+        pEncoder->updateMetaData(m_baAuthor, m_baTitle, m_baAlbum);
+        // The encoder writes its headers through the EncoderCallback
+        // methods; route them into the next file while the current
+        // recording continues undisturbed.
+        m_bWriteToNextFile = true;
+        QString userErrorMsg;
+        ret = pEncoder->initEncoder(m_sampleRate, &userErrorMsg);
+        m_bWriteToNextFile = false;
+    }
+    if (ret < 0) {
+        // No error dialog here; RECORD_SPLIT_CONTINUE falls back to
+        // updateFromPreferences(), which reports encoder failures.
+        qDebug() << "EngineRecord: could not prepare encoder for" << m_nextFileName;
+        m_bWriteToNextFile = true;
+        pEncoder.reset();
+        m_bWriteToNextFile = false;
+        m_nextDataStream.setDevice(nullptr);
+        m_nextFile.close();
+        m_nextFile.remove();
+        return false;
+    }
+    m_pNextEncoder = pEncoder;
+    return true;
+}
+
+bool EngineRecord::activatePreparedSplit() {
+    m_fileName = m_nextFileName;
+    m_cueFileName = m_nextCueFileName;
+    m_pEncoder = m_pNextEncoder;
+    m_pNextEncoder.reset();
+    m_nextFileName.clear();
+    m_nextCueFileName.clear();
+
+    // Hand the already written file over from m_nextFile to m_file.
+    // ReadWrite keeps the prepared headers in place; WriteOnly would
+    // truncate them and Append would break the header rewrite that some
+    // encoders perform when the file is finalized.
+    m_nextDataStream.setDevice(nullptr);
+    m_nextFile.close();
+    m_file.setFileName(m_fileName);
+    if (!m_file.open(QIODevice::ReadWrite)) {
+        qDebug() << "EngineRecord::activatePreparedSplit() failed for"
+                 << m_fileName
+                 << m_file.errorString();
+        m_pEncoder.reset();
+        return false;
+    }
+    m_file.seek(m_file.size());
+    m_dataStream.setDevice(&m_file);
+    m_bytesSinceSync = 0;
+    return fileOpen();
+}
+
+void EngineRecord::discardPreparedSplit() {
+    if (m_pNextEncoder) {
+        // The encoder may finalize its headers from the destructor; let
+        // those writes go into the file we are about to delete.
+        m_bWriteToNextFile = true;
+        m_pNextEncoder.reset();
+        m_bWriteToNextFile = false;
+    }
+    m_nextDataStream.setDevice(nullptr);
+    if (m_nextFile.isOpen()) {
+        m_nextFile.close();
+        m_nextFile.remove();
+    }
+    m_nextFileName.clear();
+    m_nextCueFileName.clear();
+}
@@ -21,6 +21,7 @@ class EngineRecord : public QObject, public EncoderCallback, public SideChainWor
 
     void process(const CSAMPLE* pBuffer, const std::size_t bufferSize) override;
     void shutdown() override {}
+    bool isActive() const override;
 
     // writes compressed audio to file
     void write(const unsigned char *header, const unsigned char *body, int headerLen, int bodyLen) override;
@@ -40,6 +41,14 @@ class EngineRecord : public QObject, public EncoderCallback, public SideChainWor
     bool openCueFile();
     void closeCueFile();
 
+    // Opens the next split file and initializes its encoder ahead of an
+    // upcoming RECORD_SPLIT_CONTINUE, see RECORD_SPLIT_PREPARE. Recording
+    // continues into the current file until the split actually happens.
+    bool prepareSplitFile();
+    // Closes and deletes a prepared split file that is no longer needed,
+    // e.g. because recording was stopped before the split was reached.
+    void discardPreparedSplit();
+
   signals:
     // emitted to notify RecordingManager
     void bytesRecorded(int bytes);
@@ -60,6 +69,16 @@ class EngineRecord : public QObject, public EncoderCallback, public SideChainWor
 
     void writeCueLine();
 
+    // Makes a prepared split file the active recording file. The current
+    // file must already be closed. Returns false if reopening the
+    // prepared file failed.
+    bool activatePreparedSplit();
+
+    // Pushes the written recording data to disk, called every kBytesPerSync
+    // bytes so page-cache pressure from other subsystems cannot force a
+    // large synchronous flush that would stall the sidechain thread.
+    void syncFileBuffers();
+
     UserSettingsPointer m_pConfig;
     EncoderPointer m_pEncoder;
     QString m_encoding;
@@ -72,11 +91,24 @@ class EngineRecord : public QObject, public EncoderCallback, public SideChainWor
     QFile m_cueFile;
     QDataStream m_dataStream;
 
+    // Next split file and encoder prepared ahead of time, see
+    // prepareSplitFile(). The encoder writes its headers through the
+    // EncoderCallback methods, which route to m_nextFile while
+    // m_bWriteToNextFile is set.
+    EncoderPointer m_pNextEncoder;
+    QString m_nextFileName;
+    QString m_nextCueFileName;
+    QFile m_nextFile;
+    QDataStream m_nextDataStream;
+    bool m_bWriteToNextFile;
+
     PollingControlProxy m_sampleRateControl;
     ControlProxy* m_pRecReady;
     quint64 m_frames;
     mixxx::audio::SampleRate m_sampleRate;
     quint64 m_recordedDuration;
+    // Bytes written to m_file since the last syncFileBuffers() call.
+    int m_bytesSinceSync;
     QString getRecordedDurationStr();
 
     int m_iMetaDataLife;
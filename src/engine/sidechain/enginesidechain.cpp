@@ -1,10 +1,10 @@
 // This class provides a way to do audio processing that does not need
 // to be executed in real-time. For example, broadcast encoding
-// and recording encoding can be done here. This class uses double-buffering
-// to increase the amount of time the CPU has to do whatever work needs to
-// be done, and that work is executed in a separate thread. (Threading
-// allows the next buffer to be filled while processing a buffer that's is
-// already full.)
+// and recording encoding can be done here. The work is executed in a
+// separate thread that consumes the sample FIFO in place: every registered
+// worker reads the same immutable FIFO region, so adding another consumer
+// does not add another buffer copy, and the engine callback can keep
+// writing into the remaining FIFO space while the workers process.
 
 #include "engine/sidechain/enginesidechain.h"
 
@@ -13,6 +13,7 @@
 #include "engine/engine.h"
 #include "engine/sidechain/sidechainworker.h"
 #include "moc_enginesidechain.cpp"
+#include "util/assert.h"
 #include "util/counter.h"
 #include "util/event.h"
 #include "util/sample.h"
@@ -26,8 +27,10 @@ EngineSideChain::EngineSideChain(
         : m_pConfig(pConfig),
           m_bStopThread(false),
           m_sampleFifo(SIDECHAIN_BUFFER_SIZE),
-          m_pWorkBuffer(SampleUtil::alloc(SIDECHAIN_BUFFER_SIZE)),
-          m_pSidechainMix(sidechainMix) {
+          m_pSidechainMix(sidechainMix),
+          m_workerSnapshot{},
+          m_numWorkers(0),
+          m_bDrainWorkers(false) {
     // We use HighPriority to prevent starvation by lower-priority processes (Qt
     // main thread, analysis, etc.). This used to be LowPriority but that is not
     // a suitable choice since we do semi-realtime tasks
@@ -53,13 +56,29 @@ EngineSideChain::~EngineSideChain() {
         delete pWorker;
     }
     locker.unlock();
-
-    SampleUtil::free(m_pWorkBuffer);
 }
 
 void EngineSideChain::addSideChainWorker(SideChainWorker* pWorker) {
     MMutexLocker locker(&m_workerLock);
     m_workers.append(pWorker);
+
+    // Publish the worker to the lock-free mirror read by hasActiveWorkers().
+    const int numWorkers = m_numWorkers.load(std::memory_order_relaxed);
+    VERIFY_OR_DEBUG_ASSERT(numWorkers < kMaxWorkers) {
+        return;
+    }
+    m_workerSnapshot[numWorkers] = pWorker;
+    m_numWorkers.store(numWorkers + 1, std::memory_order_release);
+}
+
+bool EngineSideChain::hasActiveWorkers() const {
+    const int numWorkers = m_numWorkers.load(std::memory_order_acquire);
+    for (int i = 0; i < numWorkers; ++i) {
+        if (m_workerSnapshot[i]->isActive()) {
+            return true;
+        }
+    }
+    return false;
 }
 
 void EngineSideChain::receiveBuffer(const AudioInput& input,
@@ -76,6 +95,17 @@ void EngineSideChain::receiveBuffer(const AudioInput& input,
 
 void EngineSideChain::writeSamples(const CSAMPLE* pBuffer, int iFrames) {
     Trace sidechain("EngineSideChain::writeSamples");
+
+    // Skip the copy into the FIFO and the worker thread wakeups entirely
+    // while all workers are idle (e.g. recording is off). One last buffer is
+    // submitted after the workers went idle so they still observe the state
+    // change; EngineRecord uses that to finalize the recording file.
+    const bool workersActive = hasActiveWorkers();
+    if (!workersActive && !m_bDrainWorkers) {
+        return;
+    }
+    m_bDrainWorkers = workersActive;
+
     // TODO: remove assumption of stereo buffer
     const int numSamples = iFrames * mixxx::kEngineChannelOutputCount;
     const int numSamplesWritten = m_sampleFifo.write(pBuffer, numSamples);
@@ -84,7 +114,8 @@ void EngineSideChain::writeSamples(const CSAMPLE* pBuffer, int iFrames) {
         Counter("EngineSideChain::writeSamples buffer overrun").increment();
     }
 
-    if (m_sampleFifo.writeAvailable() < SIDECHAIN_BUFFER_SIZE / 5) {
+    if (!workersActive ||
+            m_sampleFifo.writeAvailable() < SIDECHAIN_BUFFER_SIZE / 5) {
         // Signal to the sidechain that samples are available.
         Trace wakeup("EngineSideChain::writeSamples wake up");
         m_waitForSamples.wakeAll();
@@ -107,14 +138,30 @@ void EngineSideChain::run() {
         m_waitLock.unlock();
         Event::start(tag);
 
-        int samples_read;
-        while ((samples_read = m_sampleFifo.read(m_pWorkBuffer,
-                                                 SIDECHAIN_BUFFER_SIZE))) {
+        int readAvailable;
+        while ((readAvailable = m_sampleFifo.readAvailable())) {
             Trace process("EngineSideChain::process");
+            // Process the FIFO contents in place. Every worker reads the
+            // same immutable region, the space is released only after all
+            // of them are done.
+            CSAMPLE* dataPtr1;
+            ring_buffer_size_t size1;
+            CSAMPLE* dataPtr2;
+            ring_buffer_size_t size2;
+            // We use size1 and size2, so we can ignore the return value
+            (void)m_sampleFifo.aquireReadRegions(readAvailable,
+                    &dataPtr1, &size1, &dataPtr2, &size2);
             MMutexLocker locker(&m_workerLock);
             foreach (SideChainWorker* pWorker, m_workers) {
-                pWorker->process(m_pWorkBuffer, samples_read);
+                pWorker->process(dataPtr1, size1);
+            }
+            if (size2 > 0) {
+                foreach (SideChainWorker* pWorker, m_workers) {
+                    pWorker->process(dataPtr2, size2);
+                }
             }
+            locker.unlock();
+            m_sampleFifo.releaseReadRegions(readAvailable);
         }
 
         // Check to see if we're supposed to exit/stop this thread.
@@ -4,6 +4,7 @@
 #include <QMutex>
 #include <QWaitCondition>
 #include <QList>
+#include <atomic>
 
 #include "preferences/usersettings.h"
 #include "soundio/soundmanagerutil.h"
@@ -13,6 +14,13 @@
 
 class SideChainWorker;
 
+// Thread carrying the recording pipeline. The engine callback submits its
+// sidechain mix wait-free into m_sampleFifo and this thread feeds it to the
+// registered SideChainWorkers (i.e. EngineRecord), so encoding and file I/O
+// never run on the engine callback. Broadcast encoders do not pass through
+// here: each ShoutConnection is a thread of its own fed by its own FIFO
+// from SoundDeviceNetwork, so the recording encoder and every broadcast
+// stream encode in parallel and a slow codec cannot starve the others.
 class EngineSideChain : public QThread, public AudioDestination {
     Q_OBJECT
   public:
@@ -38,12 +46,15 @@ class EngineSideChain : public QThread, public AudioDestination {
   private:
     void run() override;
 
+    // Lock-free, non-blocking. Returns true if any registered worker currently
+    // consumes samples. Called from the engine callback.
+    bool hasActiveWorkers() const;
+
     UserSettingsPointer m_pConfig;
     // Indicates that the thread should exit.
     volatile bool m_bStopThread;
 
     FIFO<CSAMPLE> m_sampleFifo;
-    CSAMPLE* m_pWorkBuffer;
     CSAMPLE* m_pSidechainMix;
 
     // Provides thread safety around the wait condition below.
@@ -54,4 +65,18 @@ class EngineSideChain : public QThread, public AudioDestination {
     // Sidechain workers registered with EngineSideChain.
     MMutex m_workerLock;
     QList<SideChainWorker*> m_workers GUARDED_BY(m_workerLock);
+
+    // Mirror of m_workers that hasActiveWorkers() reads from the engine
+    // callback without taking m_workerLock: each worker pointer is stored
+    // before m_numWorkers is incremented, and workers are never removed
+    // until the destructor runs (after the callback has stopped).
+    static constexpr int kMaxWorkers = 4;
+    SideChainWorker* m_workerSnapshot[kMaxWorkers];
+    std::atomic<int> m_numWorkers;
+
+    // Only accessed by the writer thread. True while the last submitted
+    // buffer still had an active worker, so that one more buffer is pushed
+    // after all workers went idle and e.g. EngineRecord::process() gets a
+    // chance to observe the state change and finalize the recording file.
+    bool m_bDrainWorkers;
 };
@@ -15,6 +15,7 @@ NetworkOutputStreamWorker::NetworkOutputStreamWorker()
           m_streamStartTimeUs(-1),
           m_streamFramesWritten(0),
           m_writeOverflowCount(0),
+          m_writeUnderflowCount(0),
           m_outputDrift(false) {
 }
 
@@ -82,6 +83,18 @@ int NetworkOutputStreamWorker::overflowCount() {
     return m_writeOverflowCount;
 }
 
+void NetworkOutputStreamWorker::resetUnderflowCount() {
+    m_writeUnderflowCount = 0;
+}
+
+void NetworkOutputStreamWorker::incUnderflowCount() {
+    m_writeUnderflowCount++;
+}
+
+int NetworkOutputStreamWorker::underflowCount() {
+    return m_writeUnderflowCount;
+}
+
 void NetworkOutputStreamWorker::setOutputDrift(bool drift) {
     m_outputDrift = drift;
 }
@@ -107,7 +120,9 @@ void NetworkOutputStreamWorker::debugState() {
             << "NetworkStreamWorker state:"
             << m_workerState
             << m_functionCode
-            << m_runCount;
+            << m_runCount
+            << "underflows:" << m_writeUnderflowCount
+            << "overflows:" << m_writeOverflowCount;
 }
 
 void NetworkOutputStreamWorker::setState(int state) {
@@ -72,6 +72,10 @@ class NetworkOutputStreamWorker {
     void incOverflowCount();
     int overflowCount();
 
+    void resetUnderflowCount();
+    void incUnderflowCount();
+    int underflowCount();
+
     void setOutputDrift(bool drift);
     bool outputDrift();
 
@@ -97,6 +101,7 @@ private:
   qint64 m_streamStartTimeUs;
   qint64 m_streamFramesWritten;
   int m_writeOverflowCount;
+  int m_writeUnderflowCount;
   bool m_outputDrift;
 };
 
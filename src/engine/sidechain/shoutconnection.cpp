@@ -746,10 +746,6 @@ void ShoutConnection::process(const CSAMPLE* pBuffer, const std::size_t bufferSi
         // the encoded frames are received by the write() callback.
     }
 
-    // Check if track metadata has changed and if so, update.
-    if (metaDataHasChanged()) {
-        updateMetaData();
-    }
     setState(NETWORKSTREAMWORKER_STATE_READY);
 }
 
@@ -773,7 +769,7 @@ bool ShoutConnection::metaDataHasChanged() {
     if (m_pMetaData) {
         if (!pTrack->getId().isValid() || !m_pMetaData->getId().isValid()) {
             if ((pTrack->getArtist() == m_pMetaData->getArtist()) &&
-                (pTrack->getTitle() == m_pMetaData->getArtist())) {
+                (pTrack->getTitle() == m_pMetaData->getTitle())) {
                 return false;
             }
         } else if (pTrack->getId() == m_pMetaData->getId()) {
@@ -1034,6 +1030,16 @@ void ShoutConnection::run() {
 
             m_pOutputFifo->releaseReadRegions(readAvailable);
         }
+
+        // Check if track metadata has changed and if so, update. This is
+        // done only when the FIFO has been fully drained:
+        // shout_set_metadata() performs a blocking out-of-band request to
+        // the stream host, during which no audio can be encoded or sent.
+        // Starting it with an empty FIFO gives the maximum headroom before
+        // samples from the engine pile up against a slow host.
+        if (m_pOutputFifo->readAvailable() == 0 && metaDataHasChanged()) {
+            updateMetaData();
+        }
     }
 
     kLogger.debug() << "run: Thread stopped";
@@ -24,6 +24,11 @@ typedef struct _util_dict shout_metadata_t;
 
 class QTextCodec;
 
+// One live broadcast connection. Runs as its own thread that encodes and
+// sends the stream, fed by a bounded FIFO written from the engine callback
+// via SoundDeviceNetwork::writeProcess(). Every connection therefore
+// encodes in parallel with the other connections and with the recording
+// sidechain, independent of the codec each one uses.
 class ShoutConnection
         : public QThread, public EncoderCallback, public NetworkOutputStreamWorker {
     Q_OBJECT
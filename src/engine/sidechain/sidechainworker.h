@@ -8,4 +8,11 @@ class SideChainWorker {
     virtual ~SideChainWorker() = default;
     virtual void process(const CSAMPLE* pBuffer, const std::size_t bufferSize) = 0;
     virtual void shutdown() = 0;
+
+    // Returns true while the worker consumes submitted samples. EngineSideChain
+    // polls this from the engine callback to skip feeding its FIFO while all
+    // workers are idle, so implementations must be lock-free and non-blocking.
+    virtual bool isActive() const {
+        return true;
+    }
 };
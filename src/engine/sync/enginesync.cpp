@@ -142,6 +142,7 @@ void EngineSync::activateFollower(Syncable* pSyncable) {
     }
 
     pSyncable->setSyncMode(SyncMode::Follower);
+    rebuildActiveSyncables();
 }
 
 void EngineSync::activateLeader(Syncable* pSyncable, SyncMode leaderType) {
@@ -177,6 +178,7 @@ void EngineSync::activateLeader(Syncable* pSyncable, SyncMode leaderType) {
 
     m_pLeaderSyncable = pSyncable;
     pSyncable->setSyncMode(leaderType);
+    rebuildActiveSyncables();
 
     if (m_pLeaderSyncable != m_pInternalClock) {
         // the internal clock gets activated and its values are overwritten with this
@@ -199,6 +201,7 @@ void EngineSync::deactivateSync(Syncable* pSyncable) {
 
     // Notifications happen after-the-fact.
     pSyncable->setSyncMode(SyncMode::None);
+    rebuildActiveSyncables();
 
     bool bSyncDeckExists = syncDeckExists();
     if (pSyncable != m_pInternalClock && !bSyncDeckExists) {
@@ -602,6 +605,16 @@ void EngineSync::addSyncableDeck(Syncable* pSyncable) {
         return;
     }
     m_syncables.append(pSyncable);
+    rebuildActiveSyncables();
+}
+
+void EngineSync::rebuildActiveSyncables() {
+    m_activeSyncables.clear();
+    for (Syncable* pSyncable : std::as_const(m_syncables)) {
+        if (pSyncable->isSynchronized()) {
+            m_activeSyncables.append(pSyncable);
+        }
+    }
 }
 
 void EngineSync::onCallbackStart(mixxx::audio::SampleRate sampleRate, std::size_t bufferSize) {
@@ -659,9 +672,8 @@ void EngineSync::updateLeaderBpm(Syncable* pSource, mixxx::Bpm bpm) {
     if (pSource != m_pInternalClock) {
         m_pInternalClock->updateLeaderBpm(bpm);
     }
-    foreach (Syncable* pSyncable, m_syncables) {
-        if (pSyncable == pSource ||
-                !pSyncable->isSynchronized()) {
+    for (Syncable* pSyncable : std::as_const(m_activeSyncables)) {
+        if (pSyncable == pSource) {
             continue;
         }
         pSyncable->updateLeaderBpm(bpm);
@@ -672,9 +684,8 @@ void EngineSync::updateLeaderInstantaneousBpm(Syncable* pSource, mixxx::Bpm bpm)
     if (pSource != m_pInternalClock) {
         m_pInternalClock->updateInstantaneousBpm(bpm);
     }
-    foreach (Syncable* pSyncable, m_syncables) {
-        if (pSyncable == pSource ||
-                !pSyncable->isSynchronized()) {
+    for (Syncable* pSyncable : std::as_const(m_activeSyncables)) {
+        if (pSyncable == pSource) {
             continue;
         }
         pSyncable->updateInstantaneousBpm(bpm);
@@ -690,9 +701,8 @@ void EngineSync::updateLeaderBeatDistance(Syncable* pSource, double beatDistance
     if (pSource != m_pInternalClock) {
         m_pInternalClock->updateLeaderBeatDistance(beatDistance);
     }
-    foreach (Syncable* pSyncable, m_syncables) {
-        if (pSyncable == pSource ||
-                !pSyncable->isSynchronized()) {
+    for (Syncable* pSyncable : std::as_const(m_activeSyncables)) {
+        if (pSyncable == pSource) {
             continue;
         }
         pSyncable->updateLeaderBeatDistance(beatDistance);
@@ -100,6 +100,11 @@ class EngineSync : public SyncableListener {
     /// Unsets all sync state on a Syncable.
     void deactivateSync(Syncable* pSyncable);
 
+    /// Rebuild m_activeSyncables from m_syncables. Must be called after any
+    /// sync mode change, i.e. whenever setSyncMode has been called on a
+    /// Syncable.
+    void rebuildActiveSyncables();
+
     /// This utility method returns true if it finds a deck not in SyncMode::None.
     bool syncDeckExists() const;
 
@@ -167,4 +172,10 @@ class EngineSync : public SyncableListener {
     Syncable* m_pLeaderSyncable;
     /// The list of all Syncables registered via addSyncableDeck.
     QList<Syncable*> m_syncables;
+    /// The subset of m_syncables that is currently synchronized. Sync mode
+    /// only changes via setSyncMode calls issued by this class, so this list
+    /// is rebuilt there and the per-callback update paths iterate it instead
+    /// of filtering all registered syncables (including stopped samplers)
+    /// on every rate tick.
+    QList<Syncable*> m_activeSyncables;
 };
@@ -13,6 +13,7 @@
 #include "track/track.h"
 #include "util/assert.h"
 #include "util/logger.h"
+#include "util/rtlogger.h"
 
 const double SyncControl::kBpmUnity = 1.0;
 const double SyncControl::kBpmHalve = 0.5;
@@ -257,7 +258,9 @@ void SyncControl::updateLeaderBpm(mixxx::Bpm bpm) {
     }
 
     VERIFY_OR_DEBUG_ASSERT(isSynchronized()) {
-        qWarning() << "WARNING: Logic Error: setBpm called on SyncMode::None syncable.";
+        // Called from the engine callback, so log through the RT-safe sink.
+        RtLogger::logf(QtWarningMsg,
+                "SyncControl: Logic Error: setBpm called on SyncMode::None syncable.");
         return;
     }
 
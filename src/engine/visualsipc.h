@@ -0,0 +1,89 @@
+#pragma once
+
+// Shared memory layout of the engine visuals IPC surface.
+//
+// Mixxx publishes per-deck transport state and VU levels into a shared
+// memory segment once per engine callback so external visualizer tools can
+// read beat-synced data without any per-update syscalls. This header is
+// deliberately self-contained (no Qt, no other Mixxx headers) so client
+// processes can copy it verbatim. Attach to the segment with
+// QSharedMemory(kSharedMemoryKey) or the native shared memory API of the
+// platform and poll readSnapshot() at the desired frame rate.
+//
+// The payload is guarded by a seqlock: the engine increments `sequence` to
+// an odd value before updating the payload and to the next even value
+// afterwards. readSnapshot() implements the matching reader protocol.
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+namespace mixxx {
+namespace visualsipc {
+
+// Key of the shared memory segment as understood by QSharedMemory.
+inline constexpr char kSharedMemoryKey[] = "MixxxVisuals";
+
+inline constexpr uint32_t kMagic = 0x4d585655; // "MXVU"
+// Bump when the layout below changes.
+inline constexpr uint32_t kVersion = 2;
+inline constexpr uint32_t kMaxDecks = 16;
+inline constexpr uint32_t kGroupNameSize = 16;
+inline constexpr uint32_t kSpectrumBins = 32;
+
+struct DeckState {
+    // Control group of the deck, e.g. "[Channel1]", NUL terminated.
+    // Empty for unused slots.
+    char group[kGroupNameSize];
+    // Position of the first sample of the current callback buffer as a
+    // fraction of the track, 0.0 .. 1.0. Negative if no track is loaded.
+    double playPosition;
+    // Current tempo in beats per minute, including the rate slider.
+    double bpm;
+    // Fraction of the distance from the previous to the next beat that
+    // has been played, 0.0 .. 1.0.
+    double beatDistance;
+    // Smoothed channel levels, 0.0 .. 1.0.
+    float vuLeft;
+    float vuRight;
+    // 1 while the deck is playing.
+    uint32_t playing;
+    // Smoothed spectrum levels in logarithmically spaced bins from low to
+    // high frequencies, 0.0 (-60 dBFS and below) .. 1.0 (full scale).
+    float spectrum[kSpectrumBins];
+};
+
+struct Snapshot {
+    uint32_t magic;
+    uint32_t version;
+    // Seqlock generation counter, odd while the engine is writing.
+    std::atomic<uint32_t> sequence;
+    // Number of valid entries in decks[].
+    uint32_t numDecks;
+    // Engine sample rate in Hz.
+    double sampleRate;
+    // Increments once per engine callback.
+    uint64_t callbackCount;
+    // Smoothed main output levels, 0.0 .. 1.0.
+    float mainVuLeft;
+    float mainVuRight;
+    DeckState decks[kMaxDecks];
+};
+
+// Copies a consistent snapshot of the shared segment into *pOut. Returns
+// false if the engine wrote the segment concurrently; the caller should
+// simply retry, the writer holds the lock only for the duration of a few
+// plain stores.
+inline bool readSnapshot(const Snapshot* pShared, Snapshot* pOut) {
+    const uint32_t seqBefore =
+            pShared->sequence.load(std::memory_order_acquire);
+    if (seqBefore & 1) {
+        return false;
+    }
+    std::memcpy(pOut, pShared, sizeof(Snapshot));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return pShared->sequence.load(std::memory_order_relaxed) == seqBefore;
+}
+
+} // namespace visualsipc
+} // namespace mixxx
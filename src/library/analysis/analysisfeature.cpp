@@ -6,7 +6,9 @@
 #include "analyzer/analyzerscheduledtrack.h"
 #include "controllers/keyboard/keyboardeventfilter.h"
 #include "library/analysis/dlganalysis.h"
+#include "library/dao/analysisdao.h"
 #include "library/library.h"
+#include "library/trackcollection.h"
 #include "library/trackcollectionmanager.h"
 #include "moc_analysisfeature.cpp"
 #include "sources/soundsourceproxy.h"
@@ -21,16 +23,34 @@ const mixxx::Logger kLogger("AnalysisFeature");
 const QString kViewName = QStringLiteral("Analysis");
 
 // Utilize all available cores for batch analysis of tracks
-const int kNumberOfAnalyzerThreads = math_max(1, QThread::idealThreadCount());
+// unless overridden by the user
+const int kDefaultNumberOfAnalyzerThreads = math_max(1, QThread::idealThreadCount());
 
 inline
-int numberOfAnalyzerThreads() {
-    return kNumberOfAnalyzerThreads;
+int numberOfAnalyzerThreads(const UserSettingsPointer& pConfig) {
+    // A value of 0 (the default) selects the automatic thread count.
+    // Oversubscribing beyond the available cores is pointless, so
+    // configured values are capped accordingly.
+    const int configuredThreads = pConfig->getValue<int>(
+            ConfigKey("[Library]", "AnalyzerThreadCount"), 0);
+    if (configuredThreads > 0) {
+        return math_min(configuredThreads, kDefaultNumberOfAnalyzerThreads);
+    }
+    return kDefaultNumberOfAnalyzerThreads;
 }
 
 inline
 AnalyzerModeFlags getAnalyzerModeFlags(
         const UserSettingsPointer& pConfig) {
+    // Restrict batch analysis to the ReplayGain analyzers, e.g. for
+    // normalizing a freshly imported archive overnight without spending
+    // time on waveform/beat/key detection. Tracks that already have a
+    // gain value are skipped without decoding, so an interrupted run
+    // resumes where it left off.
+    if (pConfig->getValue<bool>(ConfigKey("[Library]", "BatchAnalysisReplayGainOnly"), false)) {
+        return static_cast<AnalyzerModeFlags>(
+                AnalyzerModeFlags::ReplayGainOnly | AnalyzerModeFlags::LowPriority);
+    }
     // Always enable at least BPM detection for batch analysis, even if disabled
     // in the config for ad-hoc analysis of tracks.
     // NOTE(uklotzde, 2018-12-26): The previous comment just states the status-quo
@@ -53,9 +73,14 @@ AnalysisFeature::AnalysisFeature(
           m_pTrackAnalysisScheduler(TrackAnalysisScheduler::NullPointer()),
           m_pSidebarModel(make_parented<TreeItemModel>(this)),
           m_pAnalysisView(nullptr),
+          m_persistedQueueRestored(false),
           m_title(m_baseTitle) {
 }
 
+AnalysisDao& AnalysisFeature::analysisDao() const {
+    return m_pLibrary->trackCollectionManager()->internalCollection()->getAnalysisDAO();
+}
+
 void AnalysisFeature::resetTitle() {
     m_title = m_baseTitle;
     emit featureIsLoading(this, false);
@@ -113,6 +138,29 @@ void AnalysisFeature::bindLibraryWidget(WLibrary* libraryWidget,
     emit analysisActive(static_cast<bool>(m_pTrackAnalysisScheduler));
 
     libraryWidget->registerView(kViewName, m_pAnalysisView);
+
+    restorePersistedAnalysisQueue();
+}
+
+void AnalysisFeature::restorePersistedAnalysisQueue() {
+    if (m_persistedQueueRestored) {
+        return; // e.g. when rebinding the widgets after a skin change
+    }
+    m_persistedQueueRestored = true;
+    const QList<TrackId> trackIds = analysisDao().loadAnalysisQueue();
+    if (trackIds.isEmpty()) {
+        return;
+    }
+    kLogger.info()
+            << "Resuming interrupted batch analysis of"
+            << trackIds.size()
+            << "tracks";
+    QList<AnalyzerScheduledTrack> tracks;
+    tracks.reserve(trackIds.size());
+    for (const auto& trackId : trackIds) {
+        tracks.append(trackId);
+    }
+    analyzeTracks(tracks);
 }
 
 TreeItemModel* AnalysisFeature::sidebarModel() const {
@@ -136,7 +184,7 @@ void AnalysisFeature::activate() {
 
 void AnalysisFeature::analyzeTracks(const QList<AnalyzerScheduledTrack>& tracks) {
     if (!m_pTrackAnalysisScheduler) {
-        const int numAnalyzerThreads = numberOfAnalyzerThreads();
+        const int numAnalyzerThreads = numberOfAnalyzerThreads(m_pConfig);
         kLogger.info()
                 << "Starting analysis using"
                 << numAnalyzerThreads
@@ -169,10 +217,26 @@ void AnalysisFeature::analyzeTracks(const QList<AnalyzerScheduledTrack>& tracks)
                 &TrackAnalysisScheduler::trackProgress,
                 this,
                 &AnalysisFeature::trackProgress);
+        // Dequeue finished tracks from the persisted analysis queue
+        connect(m_pTrackAnalysisScheduler.get(),
+                &TrackAnalysisScheduler::trackProgress,
+                this,
+                &AnalysisFeature::onTrackAnalysisSchedulerTrackProgress);
 
         emit analysisActive(true);
     }
 
+    // Persist the queued tracks so that an interrupted bulk analysis
+    // can be resumed after a restart, see restorePersistedAnalysisQueue().
+    QList<TrackId> queuedTrackIds;
+    queuedTrackIds.reserve(tracks.size());
+    for (const auto& track : tracks) {
+        if (track.getTrackId().isValid()) {
+            queuedTrackIds.append(track.getTrackId());
+        }
+    }
+    analysisDao().appendToAnalysisQueue(queuedTrackIds);
+
     if (m_pTrackAnalysisScheduler->scheduleTracks(tracks) > 0) {
         resumeAnalysis();
     }
@@ -200,6 +264,9 @@ void AnalysisFeature::stopAnalysis() {
     }
     kLogger.info() << "Stopping analysis";
     m_pTrackAnalysisScheduler->stop();
+    // The user has explicitly discarded the batch job, so don't offer
+    // to resume it after a restart.
+    analysisDao().clearAnalysisQueue();
 }
 
 void AnalysisFeature::onTrackAnalysisSchedulerProgress(
@@ -218,11 +285,26 @@ void AnalysisFeature::onTrackAnalysisSchedulerProgress(
     }
 }
 
+void AnalysisFeature::onTrackAnalysisSchedulerTrackProgress(
+        TrackId trackId, AnalyzerProgress analyzerProgress) {
+    // A track is finished when its analysis either succeeded or failed,
+    // see TrackAnalysisScheduler::onWorkerThreadProgress(). Failed
+    // tracks are dequeued as well to avoid retrying them on every
+    // restart.
+    if (analyzerProgress == kAnalyzerProgressDone ||
+            analyzerProgress == kAnalyzerProgressUnknown) {
+        analysisDao().removeFromAnalysisQueue(trackId);
+    }
+}
+
 void AnalysisFeature::onTrackAnalysisSchedulerFinished() {
     if (!m_pTrackAnalysisScheduler) {
         return; // already inactive
     }
     kLogger.info() << "Finishing analysis";
+    // Remove any remaining entries from the persisted queue, e.g. of
+    // tracks that could not be loaded and have been skipped.
+    analysisDao().clearAnalysisQueue();
     if (m_pTrackAnalysisScheduler) {
         // Free resources by abandoning the queue after the batch analysis
         // has completed. Batch analysis are not started very frequently
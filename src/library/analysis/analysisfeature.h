@@ -11,6 +11,7 @@
 #include "preferences/usersettings.h"
 #include "util/parented_ptr.h"
 
+class AnalysisDao;
 class DlgAnalysis;
 
 class AnalysisFeature : public LibraryFeature {
@@ -46,9 +47,17 @@ class AnalysisFeature : public LibraryFeature {
 
   private slots:
     void onTrackAnalysisSchedulerProgress(AnalyzerProgress currentTrackProgress, int currentTrackNumber, int totalTracksCount);
+    void onTrackAnalysisSchedulerTrackProgress(TrackId trackId, AnalyzerProgress analyzerProgress);
     void onTrackAnalysisSchedulerFinished();
 
   private:
+    AnalysisDao& analysisDao() const;
+
+    // Reschedules the persisted batch analysis queue of a previous
+    // session that has been interrupted, e.g. by quitting Mixxx or
+    // by a crash.
+    void restorePersistedAnalysisQueue();
+
     // Sets the title of this feature to the default name, given by
     // m_sAnalysisTitleName
     void resetTitle();
@@ -65,6 +74,8 @@ class AnalysisFeature : public LibraryFeature {
     parented_ptr<TreeItemModel> m_pSidebarModel;
     DlgAnalysis* m_pAnalysisView;
 
+    bool m_persistedQueueRestored;
+
     // The title is dynamic and reflects the current progress
     QString m_title;
 };
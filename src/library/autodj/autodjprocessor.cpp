@@ -1260,6 +1260,13 @@ double AutoDJProcessor::framePositionToSeconds(
     return position.value() / sampleRate / pDeck->rateRatio();
 }
 
+// Precomputes the fade thresholds for the upcoming transition ahead of
+// time: this is called when a track is loaded, whenever the analyzer or
+// the user updates intro/outro cue positions, and when the rate or the
+// transition settings change. Reaching the fade point later in
+// playerPositionChanged() is then only a comparison of the play position
+// against the cached fadeBeginPos/fadeEndPos/startPos fractions and never
+// blocks on analysis or the database.
 void AutoDJProcessor::calculateTransition(DeckAttributes* pFromDeck,
         DeckAttributes* pToDeck,
         bool seekToStartPoint) {
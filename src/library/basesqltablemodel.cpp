@@ -572,10 +572,59 @@ void BaseSqlTableModel::sort(int column, Qt::SortOrder order) {
     if (sDebug) {
         qDebug() << this << "sort()" << column << order;
     }
+    // Toggling the direction of the current single sort column does not
+    // require re-querying the database, because the same rows are simply
+    // displayed in reverse order. The preview column is excluded since it
+    // maps to ORDER BY RANDOM() where a repeated sort should reshuffle.
+    const bool onlyDirectionToggled = m_bInitialized &&
+            !m_rowInfo.isEmpty() &&
+            m_sortColumns.size() == 1 &&
+            m_sortColumns.first().m_column == column &&
+            m_sortColumns.first().m_order != order &&
+            column != fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_PREVIEW);
     setSort(column, order);
+    if (onlyDirectionToggled) {
+        reverseRowsInPlace();
+        return;
+    }
     select();
 }
 
+void BaseSqlTableModel::reverseRowsInPlace() {
+    PerformanceTimer time;
+    time.start();
+
+    QVector<RowInfo> rowInfos = m_rowInfo;
+    std::reverse(rowInfos.begin(), rowInfos.end());
+
+    TrackId2Rows trackIdToRows;
+    trackIdToRows.reserve(rowInfos.size());
+    for (int i = 0; i < rowInfos.size(); ++i) {
+        rowInfos[i].row = i;
+        trackIdToRows[rowInfos[i].trackId].push_back(i);
+    }
+
+    TrackPos2Row trackPosToRows;
+    if (hasPositionColumn()) {
+        const int posColumn = fieldIndex(
+                ColumnCache::COLUMN_PLAYLISTTRACKSTABLE_POSITION);
+        trackPosToRows.reserve(rowInfos.size());
+        for (int i = 0; i < rowInfos.size(); ++i) {
+            trackPosToRows.insert(rowInfos[i].getPosition(posColumn), i);
+        }
+    }
+
+    // Issue the same remove/insert signals as select() so that views
+    // behave identically on both paths.
+    replaceRows(
+            std::move(rowInfos),
+            std::move(trackIdToRows),
+            std::move(trackPosToRows));
+
+    qDebug() << this << "reverseRowsInPlace() reversed" << m_rowInfo.size()
+             << "rows in" << time.elapsed().debugMillisWithUnit();
+}
+
 int BaseSqlTableModel::rowCount(const QModelIndex& parent) const {
     int count = parent.isValid() ? 0 : m_rowInfo.size();
     //qDebug() << "rowCount()" << parent << count;
@@ -823,6 +872,16 @@ void BaseSqlTableModel::tracksChanged(const QSet<TrackId>& trackIds) {
         qDebug() << this << "trackChanged" << trackIds.size();
     }
 
+    // A metadata change may invalidate the position of a row in the current
+    // sort order. When sorting by a track source column the affected row is
+    // moved to its new position via binary insertion instead of re-running
+    // select() on the whole table. Table column sorts (e.g. the playlist
+    // position) are unaffected by track metadata and need no re-sort.
+    const bool maintainSortOrder = m_trackSource &&
+            !m_trackSourceOrderBy.isEmpty() &&
+            !m_sortColumns.isEmpty() &&
+            m_sortColumns.first().m_column >= m_tableColumns.size();
+
     const int numColumns = columnCount();
     for (const auto& trackId : trackIds) {
         const auto rows = getTrackRows(trackId);
@@ -832,7 +891,115 @@ void BaseSqlTableModel::tracksChanged(const QSet<TrackId>& trackIds) {
             QModelIndex bottomRight = index(row, numColumns);
             emit dataChanged(topLeft, bottomRight);
         }
+        if (maintainSortOrder && rows.size() == 1) {
+            resortRow(rows.first());
+        }
+    }
+}
+
+void BaseSqlTableModel::resortRow(int oldRow) {
+    VERIFY_OR_DEBUG_ASSERT(m_trackSource) {
+        return;
+    }
+    VERIFY_OR_DEBUG_ASSERT(oldRow >= 0 && oldRow < m_rowInfo.size()) {
+        return;
+    }
+
+    const TrackId trackId = m_rowInfo[oldRow].trackId;
+    // Exclude the 1st column with the id, like in select()
+    const int columnOffset = m_tableColumns.size() - 1;
+    const auto rowPrecedes = [this, columnOffset](int row1, int row2) {
+        return m_trackSource->compareTracksBySortColumns(
+                       m_rowInfo[row1].trackId,
+                       m_rowInfo[row2].trackId,
+                       m_sortColumns,
+                       columnOffset) < 0;
+    };
+
+    // Fast path: the row still fits between its neighbors. Equal sort keys
+    // count as in order, like the stable sort in select().
+    if ((oldRow == 0 || !rowPrecedes(oldRow, oldRow - 1)) &&
+            (oldRow + 1 >= m_rowInfo.size() || !rowPrecedes(oldRow + 1, oldRow))) {
+        return;
+    }
+
+    // All rows except oldRow are still in sort order, so the new position
+    // can be found with a binary search on either side of oldRow.
+    const auto searchInsertionRow = [this, &rowPrecedes, oldRow](int first, int last) {
+        int min = first;
+        int max = last;
+        while (min < max) {
+            const int mid = min + (max - min) / 2;
+            if (rowPrecedes(mid, oldRow)) {
+                min = mid + 1;
+            } else {
+                max = mid;
+            }
+        }
+        return min;
+    };
+    int destRow = searchInsertionRow(0, oldRow);
+    if (destRow == oldRow) {
+        // Not moving up, search below. The result is the first row behind
+        // oldRow that does not precede it, i.e. the row before which the
+        // moved row has to be reinserted.
+        destRow = searchInsertionRow(oldRow + 1, m_rowInfo.size());
+        if (destRow == oldRow + 1) {
+            // Direct neighbor, nothing to move. Unreachable after the fast
+            // path check above, but beginMoveRows() would reject it.
+            return;
+        }
+    }
+
+    if (sDebug) {
+        qDebug() << this << "resortRow" << trackId
+                 << "from" << oldRow << "to before" << destRow;
+    }
+
+    VERIFY_OR_DEBUG_ASSERT(beginMoveRows(
+                QModelIndex(), oldRow, oldRow, QModelIndex(), destRow)) {
+        return;
+    }
+    // The destination is the final index after removing the source row
+    m_rowInfo.move(oldRow, (destRow < oldRow) ? destRow : destRow - 1);
+
+    // Rows between the old and the new position have shifted by one, so the
+    // affected entries of the lookup tables have to be remapped. A track
+    // may legitimately occur in multiple rows (e.g. in history playlists),
+    // so only the entry for the shifted row is replaced instead of the
+    // track's whole row list.
+    const auto remapTrackRow = [this](TrackId remapTrackId, int fromRow, int toRow) {
+        QVector<int>& trackRows = m_trackIdToRows[remapTrackId];
+        const int at = trackRows.indexOf(fromRow);
+        VERIFY_OR_DEBUG_ASSERT(at >= 0) {
+            return;
+        }
+        trackRows[at] = toRow;
+        if (trackRows.size() > 1) {
+            // Keep the ascending order established by select()
+            std::sort(trackRows.begin(), trackRows.end());
+        }
+    };
+    const bool movedUp = destRow < oldRow;
+    const int firstShiftedRow = qMin(oldRow, destRow);
+    const int lastShiftedRow = qMax(oldRow, destRow - 1);
+    const int posColumn = hasPositionColumn()
+            ? fieldIndex(ColumnCache::COLUMN_PLAYLISTTRACKSTABLE_POSITION)
+            : -1;
+    for (int i = firstShiftedRow; i <= lastShiftedRow; ++i) {
+        RowInfo& rowInfo = m_rowInfo[i];
+        int previousRow;
+        if (movedUp) {
+            previousRow = (i == destRow) ? oldRow : i - 1;
+        } else {
+            previousRow = (i == destRow - 1) ? oldRow : i + 1;
+        }
+        remapTrackRow(rowInfo.trackId, previousRow, i);
+        if (posColumn >= 0) {
+            m_trackPosToRow.insert(rowInfo.getPosition(posColumn), i);
+        }
     }
+    endMoveRows();
 }
 
 void BaseSqlTableModel::hideTracks(const QModelIndexList& indices) {
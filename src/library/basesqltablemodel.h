@@ -163,6 +163,14 @@ class BaseSqlTableModel : public BaseTrackTableModel {
             TrackId2Rows&& trackIdToRows,
             TrackPos2Row&& trackPosToRows);
 
+    // Differential updates that avoid re-running the full query of select().
+    // reverseRowsInPlace() reverses the cached rows when only the direction
+    // of the current sort column has been toggled. resortRow() moves a
+    // single row to its new position after a metadata change invalidated
+    // its place in the current sort order.
+    void reverseRowsInPlace();
+    void resortRow(int oldRow);
+
     QVector<RowInfo> m_rowInfo;
 
     QString m_idColumn;
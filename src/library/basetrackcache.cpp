@@ -14,6 +14,11 @@ namespace {
 
 constexpr bool sDebug = false;
 
+// Upper bound for the id restriction built from the previous search
+// results. Larger result sets would make the generated IN () clause
+// more expensive than re-filtering the whole table.
+constexpr int kMaxNarrowedResultSize = 5000;
+
 }  // namespace
 
 BaseTrackCache::BaseTrackCache(TrackCollection* pTrackCollection,
@@ -29,8 +34,10 @@ BaseTrackCache::BaseTrackCache(TrackCollection* pTrackCollection,
           m_columnCache(std::move(columns)),
           m_pQueryParser(std::make_unique<SearchQueryParser>(
                   pTrackCollection, std::move(searchColumns))),
+          m_previousResultsValid(false),
           m_bIndexBuilt(false),
           m_bIsCaching(isCaching),
+          m_trackInfo(m_columnCount),
           m_database(pTrackCollection->database()) {
 }
 
@@ -67,6 +74,7 @@ void BaseTrackCache::slotTracksAddedOrChanged(const QSet<TrackId>& trackIds) {
     if (sDebug) {
         qDebug() << this << "slotTracksAddedOrChanged" << trackIds.size();
     }
+    m_previousResultsValid = false;
     updateTracksInIndex(trackIds);
 }
 
@@ -74,6 +82,7 @@ void BaseTrackCache::slotScanTrackAdded(TrackPointer pTrack) {
     if (sDebug) {
         qDebug() << this << "slotScanTrackAdded";
     }
+    m_previousResultsValid = false;
     updateTrackInIndex(pTrack);
 }
 
@@ -81,8 +90,9 @@ void BaseTrackCache::slotTracksRemoved(const QSet<TrackId>& trackIds) {
     if (sDebug) {
         qDebug() << this << "slotTracksRemoved" << trackIds.size();
     }
+    m_previousResultsValid = false;
     for (const auto& trackId : std::as_const(trackIds)) {
-        m_trackInfo.remove(trackId);
+        m_trackInfo.removeRow(trackId);
         m_dirtyTracks.remove(trackId);
     }
 }
@@ -100,6 +110,7 @@ void BaseTrackCache::slotTrackClean(TrackId trackId) {
     }
     m_dirtyTracks.remove(trackId);
     // The track might have been reloaded from the database
+    m_previousResultsValid = false;
     updateTrackInIndex(trackId);
 }
 
@@ -168,13 +179,9 @@ bool BaseTrackCache::updateTrackInIndex(
 
     TrackId trackId = pTrack->getId();
     if (trackId.isValid()) {
-        // m_trackInfo[id] will insert a QVector<QVariant> into the
-        // m_trackInfo HashTable with the key "id"
-        QVector<QVariant>& record = m_trackInfo[trackId];
-        // preallocate memory for all columns at once
-        record.resize(numColumns);
+        const int row = m_trackInfo.beginRow(trackId);
         for (int i = 0; i < numColumns; ++i) {
-            record[i] = getTrackValueForColumn(pTrack, i);
+            m_trackInfo.setValue(row, i, getTrackValueForColumn(pTrack, i));
         }
         if (m_bIsCaching) {
             replaceRecentTrack(trackId, pTrack);
@@ -212,19 +219,15 @@ bool BaseTrackCache::updateIndexWithQuery(const QString& queryString) {
     while (query.next()) {
         TrackId trackId(query.value(idColumn));
 
-        //m_trackInfo[id] will insert a QVector<QVariant> into the
-        //m_trackInfo HashTable with the key "id"
-        QVector<QVariant>& record = m_trackInfo[trackId];
-        record.resize(numColumns);
-
+        const int row = m_trackInfo.beginRow(trackId);
         for (int i = 0; i < numColumns; ++i) {
             if (fieldIndex(ColumnCache::COLUMN_TRACKLOCATIONSTABLE_LOCATION) == i) {
                 // Database stores all locations with Qt separators: "/"
                 // Here we want to cache the display string with native separators.
                 QString location = query.value(i).toString();
-                record[i] = QDir::toNativeSeparators(location);
+                m_trackInfo.setValue(row, i, QDir::toNativeSeparators(location));
             } else {
-                record[i] = query.value(i);
+                m_trackInfo.setValue(row, i, query.value(i));
             }
         }
     }
@@ -427,20 +430,18 @@ QVariant BaseTrackCache::data(TrackId trackId, int column) const {
     // TODO(rryan) this code is flawed for columns that contains row-specific
     // metadata. Currently the upper-levels will not delegate row-specific
     // columns to this method, but there should still be a check here I think.
-    auto it = m_trackInfo.constFind(trackId);
-    if (it == m_trackInfo.constEnd()) {
+    if (!m_trackInfo.contains(trackId)) {
         return QVariant{};
     }
 
-    const QVector<QVariant>& fields = it.value();
     if (column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_KEY)) {
         // The Key value is determined by either the KEY_ID or KEY column
         const auto columnForKeyId = fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_KEY_ID);
         return KeyUtils::keyFromKeyTextAndIdFields(
-                fields.value(column, QVariant{}),
-                fields.value(columnForKeyId, QVariant{}));
+                m_trackInfo.value(trackId, column),
+                m_trackInfo.value(trackId, columnForKeyId));
     }
-    return fields.value(column, QVariant{});
+    return m_trackInfo.value(trackId, column);
 }
 
 void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
@@ -490,6 +491,41 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
             m_pQueryParser->parseQuery(searchPlusExtraFilter, QString());
 
     QString filter = pQuery->toSql();
+
+    // If the new search provably narrows the previous one (the common
+    // search-as-you-type case, e.g. "deep hou" -> "deep house"),
+    // restrict the query to the previous result set. The database then
+    // only re-evaluates the filter for those rows instead of scanning
+    // the whole table, and the restriction list stays small because
+    // every keystroke shrinks it further.
+    const bool narrowsPreviousResults = m_previousResultsValid &&
+            extraFilter == m_previousExtraFilter &&
+            orderByClause == m_previousOrderByClause &&
+            m_trackOrder.size() <= kMaxNarrowedResultSize &&
+            SearchQueryParser::queryStrictlyNarrows(
+                    m_previousSearchQuery, searchQuery);
+    if (narrowsPreviousResults) {
+        QString idRestriction;
+        if (m_trackOrder.isEmpty()) {
+            // No previous results, the narrowed query cannot match either.
+            idRestriction = QString("%1 IN (-1)").arg(m_idColumn);
+        } else {
+            QStringList previousIdStrings;
+            previousIdStrings.reserve(m_trackOrder.size());
+            for (const TrackId& trackId : std::as_const(m_trackOrder)) {
+                previousIdStrings << trackId.toString();
+            }
+            idRestriction = QString("%1 IN (%2)")
+                                    .arg(m_idColumn, previousIdStrings.join(','));
+        }
+        if (filter.isEmpty()) {
+            filter = idRestriction;
+        } else {
+            filter += QStringLiteral(" AND ");
+            filter += idRestriction;
+        }
+    }
+
     if (!filter.isEmpty()) {
         filter.prepend("WHERE ");
     }
@@ -531,6 +567,13 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
         m_trackOrder.append(trackId);
     }
 
+    // m_trackOrder now holds the results for this search, remember the
+    // parameters so that the next call can detect a narrowing search.
+    m_previousSearchQuery = searchQuery;
+    m_previousExtraFilter = extraFilter;
+    m_previousOrderByClause = orderByClause;
+    m_previousResultsValid = true;
+
     // At this point, the original set of tracks have been divided into two
     // pieces: those that should be in the result set and those that should
     // not. Unfortunately, due to TrackDAO caching, there may be tracks in
@@ -671,6 +714,24 @@ int BaseTrackCache::findSortInsertionPoint(TrackPointer pTrack,
     return min;
 }
 
+int BaseTrackCache::compareTracksBySortColumns(TrackId trackId1,
+        TrackId trackId2,
+        const QList<SortColumn>& sortColumns,
+        int columnOffset) const {
+    for (const auto& sc : sortColumns) {
+        const int column = sc.m_column - columnOffset;
+        const int compare = compareColumnValues(
+                column,
+                sc.m_order,
+                data(trackId1, column),
+                data(trackId2, column));
+        if (compare != 0) {
+            return compare;
+        }
+    }
+    return 0;
+}
+
 int BaseTrackCache::compareColumnValues(int sortColumn,
         Qt::SortOrder sortOrder,
         const QVariant& val1,
@@ -11,6 +11,7 @@
 #include <memory>
 
 #include "library/columncache.h"
+#include "library/columnartracktable.h"
 #include "track/track_decl.h"
 #include "track/trackid.h"
 #include "util/class.h"
@@ -75,6 +76,17 @@ class BaseTrackCache : public QObject {
     virtual bool isCached(TrackId trackId) const;
     virtual void ensureCached(TrackId trackId);
 
+    // Compares the cached values of two tracks according to the given sort
+    // columns, applying the same column-specific rules (numeric, musical
+    // key or collated string comparison) that filterAndSort() uses when
+    // overlaying dirty tracks. Returns a negative/zero/positive value like
+    // the underlying comparisons. This allows table models to re-sort
+    // single rows in place without re-running their full query.
+    int compareTracksBySortColumns(TrackId trackId1,
+            TrackId trackId2,
+            const QList<SortColumn>& sortColumns,
+            int columnOffset) const;
+
   signals:
     void tracksChanged(const QSet<TrackId>& trackIds);
 
@@ -122,6 +134,16 @@ class BaseTrackCache : public QObject {
 
     QVector<TrackId> m_trackOrder;
 
+    // Search, extra filter and ordering of the previous filterAndSort()
+    // call. When valid, m_trackOrder still holds the corresponding
+    // result set and a new search that provably narrows the previous
+    // one only needs to re-filter those rows instead of the whole
+    // table. Invalidated whenever the underlying table data changes.
+    QString m_previousSearchQuery;
+    QString m_previousExtraFilter;
+    QString m_previousOrderByClause;
+    bool m_previousResultsValid;
+
     // Remember key and value of the most recent cache lookup to avoid querying
     // the global track cache again and again while populating the columns
     // of a single row. These members serve as a single-valued private cache.
@@ -136,7 +158,9 @@ class BaseTrackCache : public QObject {
 
     bool m_bIndexBuilt;
     bool m_bIsCaching;
-    QHash<TrackId, QVector<QVariant>> m_trackInfo;
+    // Columnar storage of the cached table values, one typed array per
+    // column with interned strings. See ColumnarTrackTable.
+    ColumnarTrackTable m_trackInfo;
     QSqlDatabase m_database;
 
     DISALLOW_COPY_AND_ASSIGN(BaseTrackCache);
@@ -124,7 +124,8 @@ BaseTrackTableModel::BaseTrackTableModel(
           m_previewDeckGroup(PlayerManager::groupForPreviewDeck(0)),
           m_backgroundColorOpacity(WLibrary::kDefaultTrackTableBackgroundColorOpacity),
           m_trackPlayedColor(QColor(WTrackTableView::kDefaultTrackPlayedColor)),
-          m_trackMissingColor(QColor(WTrackTableView::kDefaultTrackMissingColor)) {
+          m_trackMissingColor(QColor(WTrackTableView::kDefaultTrackMissingColor)),
+          m_inhibitExpensiveRoles(false) {
     connect(&pTrackCollectionManager->internalCollection()->getTrackDAO(),
             &TrackDAO::forceModelUpdate,
             this,
@@ -407,6 +408,10 @@ QVariant BaseTrackTableModel::data(
     }
 
     if (role == Qt::BackgroundRole) {
+        if (m_inhibitExpensiveRoles) {
+            // Skipped while scrolling, repainted when scrolling pauses
+            return QVariant();
+        }
         const auto rgbColorValue = rawSiblingValue(
                 index,
                 ColumnCache::COLUMN_LIBRARYTABLE_COLOR);
@@ -421,6 +426,10 @@ QVariant BaseTrackTableModel::data(
         bgColor.setAlphaF(static_cast<float>(m_backgroundColorOpacity));
         return QBrush(bgColor);
     } else if (role == Qt::ForegroundRole) {
+        if (m_inhibitExpensiveRoles) {
+            // Skipped while scrolling, repainted when scrolling pauses
+            return QVariant();
+        }
         // Custom text color for missing tracks
         // Visible in playlists, crates and Missing feature.
         // Check this first so played, missing tracks (unlikely case, but possible)
@@ -472,6 +481,12 @@ QVariant BaseTrackTableModel::data(
         return QVariant();
     }
 
+    if (role == Qt::DecorationRole && m_inhibitExpensiveRoles) {
+        // The key color requires another sibling column lookup,
+        // skipped while scrolling and repainted when scrolling pauses
+        return QVariant();
+    }
+
     return roleValue(index, rawValue(index), role);
 }
 
@@ -1078,6 +1093,24 @@ void BaseTrackTableModel::slotRefreshAllRows() {
     select();
 }
 
+void BaseTrackTableModel::slotInhibitExpensiveRoles(bool inhibit) {
+    if (m_inhibitExpensiveRoles == inhibit) {
+        return;
+    }
+    m_inhibitExpensiveRoles = inhibit;
+    if (inhibit) {
+        return;
+    }
+    // Refresh all rows so that the visible range is repainted with the
+    // full styling. The view only repaints the cells in its viewport,
+    // so this is cheap despite covering the whole table.
+    const int rows = rowCount();
+    const int columns = columnCount();
+    if (rows > 0 && columns > 0) {
+        emit dataChanged(index(0, 0), index(rows - 1, columns - 1));
+    }
+}
+
 void BaseTrackTableModel::emitDataChangedForMultipleRowsInColumn(
         const QList<int>& rows,
         int column,
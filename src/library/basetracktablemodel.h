@@ -132,6 +132,17 @@ class BaseTrackTableModel : public QAbstractTableModel, public TrackModel {
     static constexpr bool kApplyPlayedTrackColorDefault = true;
     static void setApplyPlayedTrackColor(bool apply);
 
+  public slots:
+    // Advise the model to temporarily skip roles that are expensive to
+    // compute and only affect the styling of a row, namely the background,
+    // foreground and key colors that each require additional sibling
+    // column lookups per painted cell.
+    //
+    // Driven by the same signal that inhibits lazy loading of cover art
+    // in the delegates while the view is scrolling. Once re-enabled all
+    // rows are refreshed to repaint the visible range with full styling.
+    void slotInhibitExpensiveRoles(bool inhibit);
+
   protected:
     // Build a map from the column names to their indices
     // used by fieldIndex().
@@ -298,6 +309,9 @@ class BaseTrackTableModel : public QAbstractTableModel, public TrackModel {
 
     TrackId m_previewDeckTrackId;
 
+    // True while the view is scrolling, see slotInhibitExpensiveRoles()
+    bool m_inhibitExpensiveRoles;
+
     mutable QModelIndex m_toolTipIndex;
 
     static int s_bpmColumnPrecision;
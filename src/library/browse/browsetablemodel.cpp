@@ -172,6 +172,12 @@ BrowseTableModel::BrowseTableModel(QObject* parent,
             &BrowseTableModel::slotInsert,
             Qt::QueuedConnection);
 
+    connect(m_pBrowseThread.data(),
+            &BrowseThread::rowsRefreshed,
+            this,
+            &BrowseTableModel::slotRefresh,
+            Qt::QueuedConnection);
+
     connect(&PlayerInfo::instance(),
             &PlayerInfo::trackChanged,
             this,
@@ -363,6 +369,7 @@ QMimeData* BrowseTableModel::mimeData(const QModelIndexList& indexes) const {
 void BrowseTableModel::slotClear(BrowseTableModel* caller_object) {
     if (caller_object == this) {
         removeRows(0, rowCount());
+        m_rowIndexByLocation.clear();
     }
 }
 
@@ -374,12 +381,70 @@ void BrowseTableModel::slotInsert(const QList<QList<QStandardItem*>>& rows,
         emit saveModelState();
         //qDebug() << "BrowseTableModel::slotInsert";
         for (int i = 0; i < rows.size(); ++i) {
+            m_rowIndexByLocation.insert(
+                    rows.at(i).at(COLUMN_NATIVELOCATION)->data(Qt::UserRole).toString(),
+                    rowCount());
             appendRow(rows.at(i));
         }
         emit restoreModelState();
     }
 }
 
+void BrowseTableModel::slotRefresh(const QList<QList<QStandardItem*>>& rows,
+        BrowseTableModel* caller_object) {
+    if (caller_object != this) {
+        return;
+    }
+    emit saveModelState();
+    for (const QList<QStandardItem*>& row_data : rows) {
+        const QString location =
+                row_data.at(COLUMN_NATIVELOCATION)->data(Qt::UserRole).toString();
+        const int row = findRowByLocation(location);
+        if (row < 0) {
+            // The listing has been cleared or replaced in the meantime
+            qDeleteAll(row_data);
+            continue;
+        }
+        for (int column = 0; column < row_data.size(); ++column) {
+            if (column == COLUMN_PREVIEW) {
+                // Keep the existing item to not disturb the persistent
+                // editor of the preview button delegate
+                delete row_data.at(column);
+                continue;
+            }
+            setItem(row, column, row_data.at(column));
+        }
+    }
+    emit restoreModelState();
+}
+
+int BrowseTableModel::findRowByLocation(const QString& location) {
+    auto it = m_rowIndexByLocation.constFind(location);
+    if (it != m_rowIndexByLocation.constEnd()) {
+        const int row = it.value();
+        const QStandardItem* pItem = item(row, COLUMN_NATIVELOCATION);
+        if (pItem && pItem->data(Qt::UserRole).toString() == location) {
+            return row;
+        }
+    }
+    // The mapping has become stale, e.g. after the view sorted the model
+    // while the population was still running. Rebuild it in one sweep.
+    m_rowIndexByLocation.clear();
+    m_rowIndexByLocation.reserve(rowCount());
+    for (int row = 0; row < rowCount(); ++row) {
+        const QStandardItem* pItem = item(row, COLUMN_NATIVELOCATION);
+        if (pItem) {
+            m_rowIndexByLocation.insert(
+                    pItem->data(Qt::UserRole).toString(), row);
+        }
+    }
+    it = m_rowIndexByLocation.constFind(location);
+    if (it != m_rowIndexByLocation.constEnd()) {
+        return it.value();
+    }
+    return -1;
+}
+
 TrackModel::Capabilities BrowseTableModel::getCapabilities() const {
     return Capability::AddToTrackSet |
             Capability::AddToAutoDJ |
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QHash>
 #include <QStandardItemModel>
 
 #include "library/trackmodel.h"
@@ -109,9 +110,15 @@ class BrowseTableModel final : public QStandardItemModel, public virtual TrackMo
   public slots:
     void slotClear(BrowseTableModel*);
     void slotInsert(const QList<QList<QStandardItem*>>&, BrowseTableModel*);
+    void slotRefresh(const QList<QList<QStandardItem*>>&, BrowseTableModel*);
     void trackChanged(const QString& group, TrackPointer pNewTrack, TrackPointer pOldTrack);
 
   private:
+    // Returns the row that displays the file at the given location or -1.
+    // Rebuilds the location mapping if it has become stale, e.g. after
+    // the view sorted the model while the population was still running.
+    int findRowByLocation(const QString& location);
+
     TrackCollectionManager* const m_pTrackCollectionManager;
 
     QList<int> m_searchColumns;
@@ -119,6 +126,7 @@ class BrowseTableModel final : public QStandardItemModel, public virtual TrackMo
     BrowseThreadPointer m_pBrowseThread;
     QString m_currentDirectory;
     QString m_previewDeckGroup;
+    QHash<QString, int> m_rowIndexByLocation;
     int m_columnIndexBySortColumnId[static_cast<int>(TrackModel::SortColumnId::IdMax)];
     QMap<int, TrackModel::SortColumnId> m_sortColumnIdByColumnIndex;
 
@@ -3,6 +3,7 @@
 #include <QDirIterator>
 #include <QStringList>
 #include <QtDebug>
+#include <vector>
 
 #include "library/browse/browsetablemodel.h"
 #include "moc_browsethread.cpp"
@@ -12,6 +13,12 @@
 
 namespace {
 constexpr int kRowBatchSize = 10;
+// The listing pass only stat()s the files, so it can ship much larger
+// batches than the tag reading pass without freezing the GUI.
+constexpr int kListingBatchSize = 100;
+// Pause between two row batches to give the GUI thread room to process
+// the queued model updates.
+constexpr unsigned long kBatchSleepMillis = 20;
 } // namespace
 
 QWeakPointer<BrowseThread> BrowseThread::m_weakInstanceRef;
@@ -110,6 +117,217 @@ public:
   }
 };
 
+// First-pass row containing only the properties that are available
+// without opening the file: name, type, location and file times. The
+// metadata columns are left blank and refreshed by the second pass.
+QList<QStandardItem*> buildListingRow(const mixxx::FileAccess& fileAccess) {
+    QList<QStandardItem*> row_data;
+    row_data.reserve(NUM_COLUMNS);
+    for (int column = 0; column < NUM_COLUMNS; ++column) {
+        QStandardItem* item;
+        switch (column) {
+        case COLUMN_PREVIEW:
+            item = new QStandardItem("0");
+            item->setData("0", Qt::UserRole);
+            break;
+        case COLUMN_FILENAME:
+            item = new QStandardItem(fileAccess.info().fileName());
+            item->setToolTip(item->text());
+            item->setData(item->text(), Qt::UserRole);
+            break;
+        case COLUMN_TYPE:
+            item = new QStandardItem(fileAccess.info().suffix());
+            item->setToolTip(item->text());
+            item->setData(item->text(), Qt::UserRole);
+            break;
+        case COLUMN_NATIVELOCATION: {
+            const QString location = fileAccess.info().location();
+            const QString nativeLocation = QDir::toNativeSeparators(location);
+            item = new QStandardItem(nativeLocation);
+            item->setToolTip(nativeLocation);
+            item->setData(location, Qt::UserRole);
+            break;
+        }
+        case COLUMN_FILE_MODIFIED_TIME: {
+            const auto fileLastModified =
+                    fileAccess.info().lastModified();
+            item = new QStandardItem(
+                    mixxx::displayLocalDateTime(fileLastModified));
+            item->setToolTip(item->text());
+            item->setData(fileLastModified, Qt::UserRole);
+            break;
+        }
+        case COLUMN_FILE_CREATION_TIME: {
+            const auto fileCreated =
+                    fileAccess.info().birthTime();
+            item = new QStandardItem(
+                    mixxx::displayLocalDateTime(fileCreated));
+            item->setToolTip(item->text());
+            item->setData(fileCreated, Qt::UserRole);
+            break;
+        }
+        default:
+            // Metadata columns are filled by the second pass
+            item = new QStandardItem(QString());
+        }
+        row_data.insert(column, item);
+    }
+    return row_data;
+}
+
+// Second-pass row with all columns populated from the file tags.
+QList<QStandardItem*> buildMetadataRow(const mixxx::FileAccess& fileAccess) {
+    QList<QStandardItem*> row_data;
+    row_data.reserve(NUM_COLUMNS);
+
+    QStandardItem* item = new QStandardItem("0");
+    item->setData("0", Qt::UserRole);
+    row_data.insert(COLUMN_PREVIEW, item);
+
+    {
+        mixxx::TrackMetadata trackMetadata;
+        // Both resetMissingTagMetadata = false/true have the same effect
+        constexpr auto resetMissingTagMetadata = false;
+        SoundSourceProxy::importTrackMetadataAndCoverImageFromFile(
+                fileAccess,
+                &trackMetadata,
+                nullptr,
+                resetMissingTagMetadata);
+
+        item = new QStandardItem(fileAccess.info().fileName());
+        item->setToolTip(item->text());
+        item->setData(item->text(), Qt::UserRole);
+        row_data.insert(COLUMN_FILENAME, item);
+
+        QString artist = trackMetadata.getTrackInfo().getArtist();
+        QString title = trackMetadata.getTrackInfo().getTitle();
+        if (artist.isEmpty() && title.isEmpty()) {
+            if (trackMetadata.refTrackInfo().parseArtistTitleFromFileName(
+                        fileAccess.info().fileName(), true)) {
+                artist = trackMetadata.getTrackInfo().getArtist();
+                title = trackMetadata.getTrackInfo().getTitle();
+            }
+        }
+
+        item = new QStandardItem(artist);
+        item->setToolTip(item->text());
+        item->setData(item->text(), Qt::UserRole);
+        row_data.insert(COLUMN_ARTIST, item);
+
+        item = new QStandardItem(title);
+        item->setToolTip(item->text());
+        item->setData(item->text(), Qt::UserRole);
+        row_data.insert(COLUMN_TITLE, item);
+
+        item = new QStandardItem(trackMetadata.getAlbumInfo().getTitle());
+        item->setToolTip(item->text());
+        item->setData(item->text(), Qt::UserRole);
+        row_data.insert(COLUMN_ALBUM, item);
+
+        item = new QStandardItem(trackMetadata.getTrackInfo().getTrackNumber());
+        item->setToolTip(item->text());
+        item->setData(item->text().toInt(), Qt::UserRole);
+        row_data.insert(COLUMN_TRACK_NUMBER, item);
+
+        const QString year(trackMetadata.getTrackInfo().getYear());
+        item = new YearItem(year);
+        item->setToolTip(year);
+        // The year column is sorted according to the numeric calendar year
+        item->setData(mixxx::TrackMetadata::parseCalendarYear(year), Qt::UserRole);
+        row_data.insert(COLUMN_YEAR, item);
+
+        item = new QStandardItem(trackMetadata.getTrackInfo().getGenre());
+        item->setToolTip(item->text());
+        item->setData(item->text(), Qt::UserRole);
+        row_data.insert(COLUMN_GENRE, item);
+
+        item = new QStandardItem(trackMetadata.getTrackInfo().getComposer());
+        item->setToolTip(item->text());
+        item->setData(item->text(), Qt::UserRole);
+        row_data.insert(COLUMN_COMPOSER, item);
+
+        item = new QStandardItem(trackMetadata.getTrackInfo().getComment());
+        item->setToolTip(item->text());
+        item->setData(item->text(), Qt::UserRole);
+        row_data.insert(COLUMN_COMMENT, item);
+
+        QString duration = trackMetadata.getDurationText(
+                mixxx::Duration::Precision::SECONDS);
+        item = new QStandardItem(duration);
+        item->setToolTip(item->text());
+        item->setData(trackMetadata.getStreamInfo()
+                              .getDuration()
+                              .toDoubleSeconds(),
+                Qt::UserRole);
+        row_data.insert(COLUMN_DURATION, item);
+
+        item = new QStandardItem(trackMetadata.getTrackInfo().getBpmText());
+        item->setToolTip(item->text());
+        const mixxx::Bpm bpm = trackMetadata.getTrackInfo().getBpm();
+        item->setData(bpm.isValid() ? bpm.value() : mixxx::Bpm::kValueUndefined, Qt::UserRole);
+        row_data.insert(COLUMN_BPM, item);
+
+        item = new QStandardItem(trackMetadata.getTrackInfo().getKeyText());
+        item->setToolTip(item->text());
+        item->setData(item->text(), Qt::UserRole);
+        row_data.insert(COLUMN_KEY, item);
+
+        item = new QStandardItem(fileAccess.info().suffix());
+        item->setToolTip(item->text());
+        item->setData(item->text(), Qt::UserRole);
+        row_data.insert(COLUMN_TYPE, item);
+
+        item = new QStandardItem(trackMetadata.getBitrateText());
+        item->setToolTip(item->text());
+        item->setData(
+                static_cast<qlonglong>(
+                        trackMetadata.getStreamInfo().getBitrate().value()),
+                Qt::UserRole);
+        row_data.insert(COLUMN_BITRATE, item);
+
+        QString location = fileAccess.info().location();
+        QString nativeLocation = QDir::toNativeSeparators(location);
+        item = new QStandardItem(nativeLocation);
+        item->setToolTip(nativeLocation);
+        item->setData(location, Qt::UserRole);
+        row_data.insert(COLUMN_NATIVELOCATION, item);
+
+        item = new QStandardItem(trackMetadata.getAlbumInfo().getArtist());
+        item->setToolTip(item->text());
+        item->setData(item->text(), Qt::UserRole);
+        row_data.insert(COLUMN_ALBUMARTIST, item);
+
+        item = new QStandardItem(trackMetadata.getTrackInfo().getGrouping());
+        item->setToolTip(item->text());
+        item->setData(item->text(), Qt::UserRole);
+        row_data.insert(COLUMN_GROUPING, item);
+
+        const auto fileLastModified =
+                fileAccess.info().lastModified();
+        item = new QStandardItem(
+                mixxx::displayLocalDateTime(fileLastModified));
+        item->setToolTip(item->text());
+        item->setData(fileLastModified, Qt::UserRole);
+        row_data.insert(COLUMN_FILE_MODIFIED_TIME, item);
+
+        const auto fileCreated =
+                fileAccess.info().birthTime();
+        item = new QStandardItem(
+                mixxx::displayLocalDateTime(fileCreated));
+        item->setToolTip(item->text());
+        item->setData(fileCreated, Qt::UserRole);
+        row_data.insert(COLUMN_FILE_CREATION_TIME, item);
+
+        const mixxx::ReplayGain replayGain(trackMetadata.getTrackInfo().getReplayGain());
+        item = new QStandardItem(
+                mixxx::ReplayGain::ratioToString(replayGain.getRatio()));
+        item->setToolTip(item->text());
+        item->setData(item->text(), Qt::UserRole);
+        row_data.insert(COLUMN_REPLAYGAIN, item);
+    }
+    return row_data;
+}
+
 } // namespace
 
 void BrowseThread::populateModel() {
@@ -132,14 +350,16 @@ void BrowseThread::populateModel() {
             QDir::Files | QDir::NoDotAndDotDot);
 
     // remove all rows
-    // This is a blocking operation
     // see signal/slot connection in BrowseTableModel
     emit clearModel(thisModelObserver);
 
+    // First pass: list the directory and show the plain file properties
+    // immediately. Reading the tags of every file upfront kept large
+    // folders (e.g. on USB drives) invisible for many seconds, so the
+    // metadata columns are refreshed by the second pass below.
     QList<QList<QStandardItem*>> rows;
-    rows.reserve(kRowBatchSize);
-    QList<QStandardItem*> row_data;
-    row_data.reserve(NUM_COLUMNS);
+    rows.reserve(kListingBatchSize);
+    std::vector<mixxx::FileAccess> files;
 
     int row = 0;
     // Iterate over the files
@@ -156,170 +376,52 @@ void BrowseThread::populateModel() {
             return;
         }
 
-        QStandardItem* item = new QStandardItem("0");
-        item->setData("0", Qt::UserRole);
-        row_data.insert(COLUMN_PREVIEW, item);
-
-        const auto fileAccess = mixxx::FileAccess(
+        auto fileAccess = mixxx::FileAccess(
                 mixxx::FileInfo(fileIt.next()),
                 thisPath.token());
-        {
-            mixxx::TrackMetadata trackMetadata;
-            // Both resetMissingTagMetadata = false/true have the same effect
-            constexpr auto resetMissingTagMetadata = false;
-            SoundSourceProxy::importTrackMetadataAndCoverImageFromFile(
-                    fileAccess,
-                    &trackMetadata,
-                    nullptr,
-                    resetMissingTagMetadata);
-
-            item = new QStandardItem(fileAccess.info().fileName());
-            item->setToolTip(item->text());
-            item->setData(item->text(), Qt::UserRole);
-            row_data.insert(COLUMN_FILENAME, item);
-
-            QString artist = trackMetadata.getTrackInfo().getArtist();
-            QString title = trackMetadata.getTrackInfo().getTitle();
-            if (artist.isEmpty() && title.isEmpty()) {
-                if (trackMetadata.refTrackInfo().parseArtistTitleFromFileName(
-                            fileAccess.info().fileName(), true)) {
-                    artist = trackMetadata.getTrackInfo().getArtist();
-                    title = trackMetadata.getTrackInfo().getTitle();
-                }
-            }
-
-            item = new QStandardItem(artist);
-            item->setToolTip(item->text());
-            item->setData(item->text(), Qt::UserRole);
-            row_data.insert(COLUMN_ARTIST, item);
-
-            item = new QStandardItem(title);
-            item->setToolTip(item->text());
-            item->setData(item->text(), Qt::UserRole);
-            row_data.insert(COLUMN_TITLE, item);
-
-            item = new QStandardItem(trackMetadata.getAlbumInfo().getTitle());
-            item->setToolTip(item->text());
-            item->setData(item->text(), Qt::UserRole);
-            row_data.insert(COLUMN_ALBUM, item);
-
-            item = new QStandardItem(trackMetadata.getTrackInfo().getTrackNumber());
-            item->setToolTip(item->text());
-            item->setData(item->text().toInt(), Qt::UserRole);
-            row_data.insert(COLUMN_TRACK_NUMBER, item);
-
-            const QString year(trackMetadata.getTrackInfo().getYear());
-            item = new YearItem(year);
-            item->setToolTip(year);
-            // The year column is sorted according to the numeric calendar year
-            item->setData(mixxx::TrackMetadata::parseCalendarYear(year), Qt::UserRole);
-            row_data.insert(COLUMN_YEAR, item);
-
-            item = new QStandardItem(trackMetadata.getTrackInfo().getGenre());
-            item->setToolTip(item->text());
-            item->setData(item->text(), Qt::UserRole);
-            row_data.insert(COLUMN_GENRE, item);
-
-            item = new QStandardItem(trackMetadata.getTrackInfo().getComposer());
-            item->setToolTip(item->text());
-            item->setData(item->text(), Qt::UserRole);
-            row_data.insert(COLUMN_COMPOSER, item);
-
-            item = new QStandardItem(trackMetadata.getTrackInfo().getComment());
-            item->setToolTip(item->text());
-            item->setData(item->text(), Qt::UserRole);
-            row_data.insert(COLUMN_COMMENT, item);
-
-            QString duration = trackMetadata.getDurationText(
-                    mixxx::Duration::Precision::SECONDS);
-            item = new QStandardItem(duration);
-            item->setToolTip(item->text());
-            item->setData(trackMetadata.getStreamInfo()
-                                  .getDuration()
-                                  .toDoubleSeconds(),
-                    Qt::UserRole);
-            row_data.insert(COLUMN_DURATION, item);
-
-            item = new QStandardItem(trackMetadata.getTrackInfo().getBpmText());
-            item->setToolTip(item->text());
-            const mixxx::Bpm bpm = trackMetadata.getTrackInfo().getBpm();
-            item->setData(bpm.isValid() ? bpm.value() : mixxx::Bpm::kValueUndefined, Qt::UserRole);
-            row_data.insert(COLUMN_BPM, item);
-
-            item = new QStandardItem(trackMetadata.getTrackInfo().getKeyText());
-            item->setToolTip(item->text());
-            item->setData(item->text(), Qt::UserRole);
-            row_data.insert(COLUMN_KEY, item);
-
-            item = new QStandardItem(fileAccess.info().suffix());
-            item->setToolTip(item->text());
-            item->setData(item->text(), Qt::UserRole);
-            row_data.insert(COLUMN_TYPE, item);
-
-            item = new QStandardItem(trackMetadata.getBitrateText());
-            item->setToolTip(item->text());
-            item->setData(
-                    static_cast<qlonglong>(
-                            trackMetadata.getStreamInfo().getBitrate().value()),
-                    Qt::UserRole);
-            row_data.insert(COLUMN_BITRATE, item);
-
-            QString location = fileAccess.info().location();
-            QString nativeLocation = QDir::toNativeSeparators(location);
-            item = new QStandardItem(nativeLocation);
-            item->setToolTip(nativeLocation);
-            item->setData(location, Qt::UserRole);
-            row_data.insert(COLUMN_NATIVELOCATION, item);
-
-            item = new QStandardItem(trackMetadata.getAlbumInfo().getArtist());
-            item->setToolTip(item->text());
-            item->setData(item->text(), Qt::UserRole);
-            row_data.insert(COLUMN_ALBUMARTIST, item);
-
-            item = new QStandardItem(trackMetadata.getTrackInfo().getGrouping());
-            item->setToolTip(item->text());
-            item->setData(item->text(), Qt::UserRole);
-            row_data.insert(COLUMN_GROUPING, item);
-
-            const auto fileLastModified =
-                    fileAccess.info().lastModified();
-            item = new QStandardItem(
-                    mixxx::displayLocalDateTime(fileLastModified));
-            item->setToolTip(item->text());
-            item->setData(fileLastModified, Qt::UserRole);
-            row_data.insert(COLUMN_FILE_MODIFIED_TIME, item);
-
-            const auto fileCreated =
-                    fileAccess.info().birthTime();
-            item = new QStandardItem(
-                    mixxx::displayLocalDateTime(fileCreated));
-            item->setToolTip(item->text());
-            item->setData(fileCreated, Qt::UserRole);
-            row_data.insert(COLUMN_FILE_CREATION_TIME, item);
+        rows.append(buildListingRow(fileAccess));
+        files.push_back(std::move(fileAccess));
+        ++row;
+        if (row % kListingBatchSize == 0) {
+            emit rowsAppended(rows, thisModelObserver);
+            rows.clear();
+            // Give the GUI thread room to process the queued batches
+            msleep(kBatchSleepMillis);
+        }
+    }
+    emit rowsAppended(rows, thisModelObserver);
+    rows.clear();
+    qDebug() << "Listed" << files.size() << "files from" << thisPath.info().locationPath();
+
+    // Second pass: read the tags and refresh the metadata columns of the
+    // rows that are already visible. Aborts like the listing pass when
+    // the user navigates to another folder in the meantime.
+    row = 0;
+    for (const auto& fileAccess : files) {
+        if (m_bStopThread) {
+            break;
+        }
+        m_path_mutex.lock();
+        auto newPath = m_path;
+        m_path_mutex.unlock();
 
-            const mixxx::ReplayGain replayGain(trackMetadata.getTrackInfo().getReplayGain());
-            item = new QStandardItem(
-                    mixxx::ReplayGain::ratioToString(replayGain.getRatio()));
-            item->setToolTip(item->text());
-            item->setData(item->text(), Qt::UserRole);
-            row_data.insert(COLUMN_REPLAYGAIN, item);
+        if (thisPath.info() != newPath.info()) {
+            qDebug() << "Abort populateModel()";
+            populateModel();
+            return;
         }
 
-        rows.append(row_data);
-        row_data.clear();
+        rows.append(buildMetadataRow(fileAccess));
         ++row;
         // If 10 tracks have been analyzed, send it to GUI
         // Will limit GUI freezing
         if (row % kRowBatchSize == 0) {
-            // this is a blocking operation
-            emit rowsAppended(rows, thisModelObserver);
-            qDebug() << "Append" << rows.count() << "tracks from "
-                     << thisPath.info().locationPath();
+            emit rowsRefreshed(rows, thisModelObserver);
             rows.clear();
+            // Give the GUI thread room to process the queued batches
+            msleep(kBatchSleepMillis);
         }
-        // Sleep additionally for 20ms which prevents us from GUI freezes
-        msleep(20);
     }
-    emit rowsAppended(rows, thisModelObserver);
-    qDebug() << "Append last" << rows.count() << "tracks from" << thisPath.info().locationPath();
+    emit rowsRefreshed(rows, thisModelObserver);
+    qDebug() << "Read tags of" << row << "files from" << thisPath.info().locationPath();
 }
@@ -36,6 +36,10 @@ class BrowseThread : public QThread {
 
   signals:
     void rowsAppended(const QList<QList<QStandardItem*>>&, BrowseTableModel*);
+    // Emitted by the second population pass with fully populated rows
+    // that replace the plain listing rows of the first pass. The rows
+    // are matched by their location column.
+    void rowsRefreshed(const QList<QList<QStandardItem*>>&, BrowseTableModel*);
     void clearModel(BrowseTableModel*);
 
   private:
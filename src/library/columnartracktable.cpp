@@ -0,0 +1,273 @@
+#include "library/columnartracktable.h"
+
+#include <cmath>
+#include <limits>
+
+#include "util/assert.h"
+
+namespace {
+
+// NaN marks null cells in numeric columns. Genuine NaN values cannot be
+// stored in the database, so this cannot clash with real data.
+constexpr double kNullNumber = std::numeric_limits<double>::quiet_NaN();
+
+constexpr qint32 kNullString = -1;
+
+bool isNumericVariant(const QVariant& value) {
+    switch (value.typeId()) {
+    case QMetaType::Bool:
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+    case QMetaType::Float:
+    case QMetaType::Double:
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // anonymous namespace
+
+ColumnarTrackTable::ColumnarTrackTable(int columnCount)
+        : m_columns(columnCount) {
+    DEBUG_ASSERT(columnCount >= 0);
+}
+
+void ColumnarTrackTable::clear() {
+    const auto columnCount = m_columns.size();
+    m_columns.clear();
+    m_columns.resize(columnCount);
+    m_stringPool.clear();
+    m_stringPoolIndex.clear();
+    m_trackRows.clear();
+    m_rowTracks.clear();
+}
+
+int ColumnarTrackTable::beginRow(TrackId trackId) {
+    const auto it = m_trackRows.constFind(trackId);
+    if (it != m_trackRows.constEnd()) {
+        return it.value();
+    }
+    const int row = rowCount();
+    m_trackRows.insert(trackId, row);
+    m_rowTracks.push_back(trackId);
+    for (Column& column : m_columns) {
+        switch (column.type) {
+        case ColumnType::Undecided:
+            break;
+        case ColumnType::Number:
+            column.numbers.push_back(kNullNumber);
+            break;
+        case ColumnType::String:
+            column.stringIds.push_back(kNullString);
+            break;
+        case ColumnType::Variant:
+            column.variants.emplace_back();
+            break;
+        }
+    }
+    return row;
+}
+
+void ColumnarTrackTable::setValue(int row, int column, const QVariant& value) {
+    VERIFY_OR_DEBUG_ASSERT(row >= 0 && row < rowCount()) {
+        return;
+    }
+    VERIFY_OR_DEBUG_ASSERT(column >= 0 &&
+            column < static_cast<int>(m_columns.size())) {
+        return;
+    }
+    Column* pColumn = &m_columns[column];
+    if (value.isNull() || !value.isValid()) {
+        // Cells are initialized as null by beginRow(). Overwriting values
+        // of an existing row still needs an explicit reset.
+        switch (pColumn->type) {
+        case ColumnType::Undecided:
+            break;
+        case ColumnType::Number:
+            pColumn->numbers[row] = kNullNumber;
+            break;
+        case ColumnType::String:
+            pColumn->stringIds[row] = kNullString;
+            break;
+        case ColumnType::Variant:
+            pColumn->variants[row] = QVariant();
+            break;
+        }
+        return;
+    }
+    if (pColumn->type == ColumnType::Undecided) {
+        if (isNumericVariant(value)) {
+            decideColumnType(pColumn, ColumnType::Number);
+        } else if (value.typeId() == QMetaType::QString) {
+            decideColumnType(pColumn, ColumnType::String);
+        } else {
+            decideColumnType(pColumn, ColumnType::Variant);
+        }
+    }
+    switch (pColumn->type) {
+    case ColumnType::Number:
+        if (!isNumericVariant(value)) {
+            promoteColumnToVariant(pColumn);
+            pColumn->variants[row] = value;
+            return;
+        }
+        pColumn->numbers[row] = value.toDouble();
+        return;
+    case ColumnType::String:
+        if (value.typeId() != QMetaType::QString) {
+            promoteColumnToVariant(pColumn);
+            pColumn->variants[row] = value;
+            return;
+        }
+        pColumn->stringIds[row] = internString(value.toString());
+        return;
+    case ColumnType::Variant:
+        pColumn->variants[row] = value;
+        return;
+    case ColumnType::Undecided:
+        break;
+    }
+    DEBUG_ASSERT(!"unreachable");
+}
+
+void ColumnarTrackTable::removeRow(TrackId trackId) {
+    const auto it = m_trackRows.constFind(trackId);
+    if (it == m_trackRows.constEnd()) {
+        return;
+    }
+    const int row = it.value();
+    const int lastRow = rowCount() - 1;
+    DEBUG_ASSERT(lastRow >= 0);
+    if (row != lastRow) {
+        // Fill the gap by moving the last row into it.
+        for (Column& column : m_columns) {
+            switch (column.type) {
+            case ColumnType::Undecided:
+                break;
+            case ColumnType::Number:
+                column.numbers[row] = column.numbers[lastRow];
+                break;
+            case ColumnType::String:
+                column.stringIds[row] = column.stringIds[lastRow];
+                break;
+            case ColumnType::Variant:
+                column.variants[row] = std::move(column.variants[lastRow]);
+                break;
+            }
+        }
+        const TrackId movedTrackId = m_rowTracks[lastRow];
+        m_rowTracks[row] = movedTrackId;
+        m_trackRows.insert(movedTrackId, row);
+    }
+    for (Column& column : m_columns) {
+        switch (column.type) {
+        case ColumnType::Undecided:
+            break;
+        case ColumnType::Number:
+            column.numbers.pop_back();
+            break;
+        case ColumnType::String:
+            column.stringIds.pop_back();
+            break;
+        case ColumnType::Variant:
+            column.variants.pop_back();
+            break;
+        }
+    }
+    m_rowTracks.pop_back();
+    m_trackRows.remove(trackId);
+}
+
+QVariant ColumnarTrackTable::value(TrackId trackId, int column) const {
+    const auto it = m_trackRows.constFind(trackId);
+    if (it == m_trackRows.constEnd()) {
+        return QVariant();
+    }
+    if (column < 0 || column >= static_cast<int>(m_columns.size())) {
+        return QVariant();
+    }
+    const int row = it.value();
+    const Column& columnData = m_columns[column];
+    switch (columnData.type) {
+    case ColumnType::Undecided:
+        return QVariant();
+    case ColumnType::Number: {
+        const double number = columnData.numbers[row];
+        if (std::isnan(number)) {
+            return QVariant();
+        }
+        return QVariant(number);
+    }
+    case ColumnType::String: {
+        const qint32 stringId = columnData.stringIds[row];
+        if (stringId == kNullString) {
+            return QVariant();
+        }
+        return QVariant(m_stringPool.at(stringId));
+    }
+    case ColumnType::Variant:
+        return columnData.variants[row];
+    }
+    DEBUG_ASSERT(!"unreachable");
+    return QVariant();
+}
+
+qint32 ColumnarTrackTable::internString(const QString& value) {
+    const auto it = m_stringPoolIndex.constFind(value);
+    if (it != m_stringPoolIndex.constEnd()) {
+        return it.value();
+    }
+    const qint32 stringId = static_cast<qint32>(m_stringPool.size());
+    m_stringPool.append(value);
+    m_stringPoolIndex.insert(value, stringId);
+    return stringId;
+}
+
+void ColumnarTrackTable::decideColumnType(Column* pColumn, ColumnType type) {
+    DEBUG_ASSERT(pColumn->type == ColumnType::Undecided);
+    pColumn->type = type;
+    const auto numRows = m_rowTracks.size();
+    switch (type) {
+    case ColumnType::Number:
+        pColumn->numbers.resize(numRows, kNullNumber);
+        break;
+    case ColumnType::String:
+        pColumn->stringIds.resize(numRows, kNullString);
+        break;
+    case ColumnType::Variant:
+        pColumn->variants.resize(numRows);
+        break;
+    case ColumnType::Undecided:
+        DEBUG_ASSERT(!"unreachable");
+        break;
+    }
+}
+
+void ColumnarTrackTable::promoteColumnToVariant(Column* pColumn) {
+    DEBUG_ASSERT(pColumn->type == ColumnType::Number ||
+            pColumn->type == ColumnType::String);
+    std::vector<QVariant> variants;
+    variants.resize(m_rowTracks.size());
+    if (pColumn->type == ColumnType::Number) {
+        for (std::size_t row = 0; row < pColumn->numbers.size(); ++row) {
+            if (!std::isnan(pColumn->numbers[row])) {
+                variants[row] = QVariant(pColumn->numbers[row]);
+            }
+        }
+        pColumn->numbers.clear();
+        pColumn->numbers.shrink_to_fit();
+    } else {
+        for (std::size_t row = 0; row < pColumn->stringIds.size(); ++row) {
+            if (pColumn->stringIds[row] != kNullString) {
+                variants[row] = QVariant(m_stringPool.at(pColumn->stringIds[row]));
+            }
+        }
+        pColumn->stringIds.clear();
+        pColumn->stringIds.shrink_to_fit();
+    }
+    pColumn->type = ColumnType::Variant;
+    pColumn->variants = std::move(variants);
+}
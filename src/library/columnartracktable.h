@@ -0,0 +1,81 @@
+#pragma once
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+#include <vector>
+
+#include "track/trackid.h"
+
+/// Columnar storage for the in-memory track table of BaseTrackCache.
+///
+/// Values are stored in one contiguous, typed array per column instead of
+/// one QVector<QVariant> per track. Numeric values occupy 8 bytes instead
+/// of a full QVariant and strings are interned in a shared pool, so columns
+/// with many repeated values (artist, album, genre, file type) store each
+/// distinct string only once. Columns holding other value types (dates,
+/// colors) fall back to plain QVariant cells.
+///
+/// The type of a column is decided by the first non-null value stored in
+/// it. If a value of a different type shows up later the whole column is
+/// transparently promoted to the QVariant fallback, so callers never have
+/// to care about the storage layout.
+class ColumnarTrackTable final {
+  public:
+    explicit ColumnarTrackTable(int columnCount);
+
+    void clear();
+
+    int rowCount() const {
+        return static_cast<int>(m_rowTracks.size());
+    }
+
+    bool contains(TrackId trackId) const {
+        return m_trackRows.contains(trackId);
+    }
+
+    /// Inserts a new row for the given track or prepares overwriting the
+    /// values of an existing one. Returns the row for setValue().
+    int beginRow(TrackId trackId);
+
+    void setValue(int row, int column, const QVariant& value);
+
+    void removeRow(TrackId trackId);
+
+    /// Returns the stored value or an invalid QVariant if the track or
+    /// column is unknown.
+    QVariant value(TrackId trackId, int column) const;
+
+  private:
+    enum class ColumnType : quint8 {
+        Undecided, // only null values stored so far, no storage allocated
+        Number,
+        String,
+        Variant, // fallback for all other value types
+    };
+
+    struct Column {
+        ColumnType type = ColumnType::Undecided;
+        // Only the vector matching `type` is populated.
+        std::vector<double> numbers;     // null = NaN
+        std::vector<qint32> stringIds;   // index into m_stringPool, null = -1
+        std::vector<QVariant> variants;  // null = invalid QVariant
+    };
+
+    qint32 internString(const QString& value);
+
+    void decideColumnType(Column* pColumn, ColumnType type);
+    void promoteColumnToVariant(Column* pColumn);
+
+    std::vector<Column> m_columns;
+
+    // Shared string pool for all interned column values.
+    QStringList m_stringPool;
+    QHash<QString, qint32> m_stringPoolIndex;
+
+    // Dense row numbering. Rows of removed tracks are filled by moving
+    // the last row into the gap.
+    QHash<TrackId, int> m_trackRows;
+    std::vector<TrackId> m_rowTracks;
+};
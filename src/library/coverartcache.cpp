@@ -1,7 +1,9 @@
 #include "library/coverartcache.h"
 
+#include <QDir>
 #include <QFutureWatcher>
 #include <QPixmapCache>
+#include <QStandardPaths>
 #include <QtConcurrentRun>
 #include <QtDebug>
 
@@ -27,6 +29,34 @@ inline QImage resizeImageWidth(const QImage& image, int width) {
     return image.scaledToWidth(width, kTransformationMode);
 }
 
+// Directory of the persistent thumbnail tier. Pre-scaled covers are stored
+// here as small image files, so subsequent sessions (and cache evictions)
+// only pay for loading a tiny thumbnail instead of decoding and scaling
+// the full-resolution image again.
+QString thumbnailCacheDir() {
+    static const QString dirPath = [] {
+        QString path =
+                QStandardPaths::writableLocation(QStandardPaths::CacheLocation) +
+                QStringLiteral("/coverthumbs");
+        QDir().mkpath(path);
+        return path;
+    }();
+    return dirPath;
+}
+
+// Thumbnails are keyed by the cover image digest and the pre-scaled width,
+// so entries never go stale: a changed cover image gets a new digest and
+// therefore a new file name. Replaced covers only leave orphaned files
+// behind that are never read again.
+QString thumbnailFilePath(mixxx::cache_key_t cacheKey, int width) {
+    return thumbnailCacheDir() +
+            QChar('/') +
+            QString::number(cacheKey, 16) +
+            QChar('-') +
+            QString::number(width) +
+            QStringLiteral(".png");
+}
+
 } // anonymous namespace
 
 CoverArtCache::CoverArtCache() {
@@ -131,6 +161,49 @@ void CoverArtCache::requestUncachedCover(
             desiredWidth);
 }
 
+//static
+void CoverArtCache::prefetchCovers(
+        const QObject* pRequester,
+        const QList<CoverInfo>& coverInfos,
+        int desiredWidth) {
+    CoverArtCache* pCache = CoverArtCache::instance();
+    VERIFY_OR_DEBUG_ASSERT(pCache) {
+        return;
+    }
+    for (const CoverInfo& coverInfo : coverInfos) {
+        if (!coverInfo.hasImage() || coverInfo.imageDigest().isEmpty()) {
+            // Legacy covers without a digest need a track object for
+            // refreshing the digest and are only loaded on demand, see
+            // CoverArtDelegate::requestUncachedCover().
+            continue;
+        }
+        if (!getCachedCover(coverInfo, desiredWidth).isNull()) {
+            continue;
+        }
+        pCache->tryLoadCover(
+                pRequester,
+                TrackPointer(),
+                coverInfo,
+                desiredWidth);
+    }
+}
+
+//static
+void CoverArtCache::cancelRequests(const QObject* pRequester) {
+    CoverArtCache* pCache = CoverArtCache::instance();
+    VERIFY_OR_DEBUG_ASSERT(pCache) {
+        return;
+    }
+    auto it = pCache->m_runningRequests.begin();
+    while (it != pCache->m_runningRequests.end()) {
+        if (it.value().pRequester == pRequester) {
+            it = pCache->m_runningRequests.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 void CoverArtCache::tryLoadCover(
         const QObject* pRequester,
         const TrackPointer& pTrack,
@@ -156,11 +229,12 @@ void CoverArtCache::tryLoadCover(
     // to avoid loading the same picture again while we are loading it.
     // This fixes also https://github.com/mixxxdj/mixxx/issues/11131 on
     // Windows where simultaneous open the same file from two threads fails.
-    bool requestPending = m_runningRequests.contains(requestedCacheKey);
+    bool requestPending = m_pendingCacheKeys.contains(requestedCacheKey);
     m_runningRequests.insert(requestedCacheKey, {pRequester, desiredWidth});
     if (requestPending) {
         return;
     }
+    m_pendingCacheKeys.insert(requestedCacheKey);
 
     if (kLogger.traceEnabled()) {
         kLogger.trace()
@@ -200,6 +274,32 @@ CoverArtCache::FutureResult CoverArtCache::loadCover(
     auto res = FutureResult(
             coverInfo.cacheKey());
 
+    // Try the persistent thumbnail tier before decoding the original,
+    // full-resolution image. Covers without an image digest are excluded,
+    // because their cache key is not content-addressed yet (see the digest
+    // refresh below).
+    if (desiredWidth > 0 && !coverInfo.imageDigest().isEmpty()) {
+        const QString thumbnailPath =
+                thumbnailFilePath(res.requestedCacheKey, desiredWidth);
+        QImage thumbnail(thumbnailPath);
+        if (!thumbnail.isNull()) {
+            if (kLogger.traceEnabled()) {
+                kLogger.trace()
+                        << "loadCover thumbnail hit"
+                        << thumbnailPath;
+            }
+            auto loadedThumbnail = CoverInfo::LoadedImage(
+                    CoverInfo::LoadedImage::Result::Ok);
+            loadedThumbnail.image = std::move(thumbnail);
+            loadedThumbnail.location = thumbnailPath;
+            res.coverArt = CoverArt(
+                    std::move(coverInfo),
+                    std::move(loadedThumbnail),
+                    desiredWidth);
+            return res;
+        }
+    }
+
     CoverInfo::LoadedImage loadedImage = coverInfo.loadImage(pTrack);
     if (!loadedImage.image.isNull()) {
         if (coverInfo.imageDigest().isEmpty()) {
@@ -221,6 +321,14 @@ CoverArtCache::FutureResult CoverArtCache::loadCover(
             // Adjust the cover size according to the request
             // or downsize the image for efficiency.
             loadedImage.image = resizeImageWidth(loadedImage.image, desiredWidth);
+            // Store the pre-scaled image in the persistent thumbnail tier,
+            // keyed by the content digest. Skipped for legacy covers whose
+            // digest is still empty, see above.
+            if (!coverInfo.imageDigest().isEmpty()) {
+                loadedImage.image.save(
+                        thumbnailFilePath(coverInfo.cacheKey(), desiredWidth),
+                        "PNG");
+            }
         }
     } else {
         kLogger.warning() << "loaded image is NULL";
@@ -308,6 +416,7 @@ void CoverArtCache::coverLoaded() {
     // First remove all requests for this cover that way we can
     // re-add cover with different sizes via tryLoadCover() as usual
     m_runningRequests.remove(res.coverArt.cacheKey());
+    m_pendingCacheKeys.remove(res.coverArt.cacheKey());
 
     auto i = runningRequests.find(res.coverArt.cacheKey());
     while (i != runningRequests.end() && i.key() == res.coverArt.cacheKey()) {
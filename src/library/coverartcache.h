@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QList>
 #include <QObject>
 #include <QPair>
 #include <QPixmap>
@@ -27,6 +28,15 @@ class CoverArtCache : public QObject, public Singleton<CoverArtCache> {
             const CoverInfo& coverInfo,
             int desiredWidth);
 
+    // Warm the caches for a batch of covers, e.g. for rows adjacent to the
+    // visible range of a track table. Covers that are already cached or
+    // that lack an image digest are skipped. No coverFound signal is
+    // emitted for covers that are already cached.
+    static void prefetchCovers(
+            const QObject* pRequester,
+            const QList<CoverInfo>& coverInfos,
+            int desiredWidth);
+
     static void requestUncachedCover(
             const QObject* pRequester,
             const CoverInfo& coverInfo,
@@ -37,6 +47,14 @@ class CoverArtCache : public QObject, public Singleton<CoverArtCache> {
             const TrackPointer& pTrack,
             int desiredWidth);
 
+    // Drop all pending requests of a requester, e.g. when the
+    // corresponding rows have been scrolled past or the requester is
+    // about to be destroyed. Workers that are already loading one of the
+    // covers keep running and still warm the caches, but their results
+    // are no longer delivered, re-scaled or repainted for this
+    // requester.
+    static void cancelRequests(const QObject* pRequester);
+
     // Only public for testing
     struct FutureResult {
         FutureResult()
@@ -89,4 +107,9 @@ class CoverArtCache : public QObject, public Singleton<CoverArtCache> {
         int desiredWidth;
     };
     QMultiHash<mixxx::cache_key_t, RequestData> m_runningRequests;
+    // Cache keys with a worker currently loading the cover. Kept
+    // separate from m_runningRequests so that canceling all requesters
+    // of a cover does not allow a concurrent reload of the same file,
+    // see https://github.com/mixxxdj/mixxx/issues/11131.
+    QSet<mixxx::cache_key_t> m_pendingCacheKeys;
 };
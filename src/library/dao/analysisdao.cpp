@@ -30,13 +30,63 @@ QList<AnalysisDao::AnalysisInfo> AnalysisDao::getAnalysesForTrack(TrackId trackI
         return QList<AnalysisInfo>();
     }
 
-    QSqlQuery query(m_database);
-    query.prepare(QString(
+    QSqlQuery& query = m_preparedQueries.prepared(m_database, QString(
+        "SELECT id, type, description, version, data_checksum FROM %1 "
+        "WHERE track_id=:trackId").arg(s_analysisTableName));
+    query.bindValue(":trackId", trackId.toVariant());
+
+    return loadAnalysesFromQuery(trackId, &query, true);
+}
+
+QList<AnalysisDao::AnalysisInfo> AnalysisDao::getAnalysisMetadataForTrack(TrackId trackId) {
+    if (!m_database.isOpen() || !trackId.isValid()) {
+        return QList<AnalysisInfo>();
+    }
+
+    // Both lookups share the same statement text, so they also
+    // share the same cached prepared statement.
+    QSqlQuery& query = m_preparedQueries.prepared(m_database, QString(
         "SELECT id, type, description, version, data_checksum FROM %1 "
         "WHERE track_id=:trackId").arg(s_analysisTableName));
     query.bindValue(":trackId", trackId.toVariant());
 
-    return loadAnalysesFromQuery(trackId, &query);
+    return loadAnalysesFromQuery(trackId, &query, false);
+}
+
+bool AnalysisDao::loadAnalysisData(AnalysisInfo* analysis) {
+    if (!m_database.isOpen() || analysis == nullptr || analysis->analysisId == -1) {
+        return false;
+    }
+
+    QSqlQuery query(m_database);
+    query.prepare(QString(
+        "SELECT data_checksum FROM %1 WHERE id=:analysisId").arg(s_analysisTableName));
+    query.bindValue(":analysisId", analysis->analysisId);
+    if (!query.exec() || !query.next()) {
+        LOG_FAILED_QUERY(query) << "couldn't get checksum for analysis"
+                                << analysis->analysisId;
+        return false;
+    }
+    const int checksum = query.value(0).toInt();
+
+    QString dataPath = getAnalysisStoragePath().absoluteFilePath(
+        QString::number(analysis->analysisId));
+    const QByteArray compressedData = loadDataFromFile(dataPath);
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    const int file_checksum = qChecksum(
+            compressedData);
+#else
+    const int file_checksum = qChecksum(
+            compressedData.constData(),
+            compressedData.length());
+#endif
+    if (checksum != file_checksum) {
+        qDebug() << "WARNING: Corrupt analysis loaded from" << dataPath
+                 << "length" << compressedData.length();
+        return false;
+    }
+    analysis->data = qUncompress(compressedData);
+    return true;
 }
 
 QList<AnalysisDao::AnalysisInfo> AnalysisDao::getAnalysesForTrackByType(
@@ -52,10 +102,11 @@ QList<AnalysisDao::AnalysisInfo> AnalysisDao::getAnalysesForTrackByType(
     query.bindValue(":trackId", trackId.toVariant());
     query.bindValue(":type", type);
 
-    return loadAnalysesFromQuery(trackId, &query);
+    return loadAnalysesFromQuery(trackId, &query, true);
 }
 
-QList<AnalysisDao::AnalysisInfo> AnalysisDao::loadAnalysesFromQuery(TrackId trackId, QSqlQuery* query) {
+QList<AnalysisDao::AnalysisInfo> AnalysisDao::loadAnalysesFromQuery(
+        TrackId trackId, QSqlQuery* query, bool loadData) {
     QList<AnalysisDao::AnalysisInfo> analyses;
     PerformanceTimer time;
     time.start();
@@ -81,6 +132,10 @@ QList<AnalysisDao::AnalysisInfo> AnalysisDao::loadAnalysesFromQuery(TrackId trac
         info.type = static_cast<AnalysisType>(query->value(typeColumn).toInt());
         info.description = query->value(descriptionColumn).toString();
         info.version = query->value(versionColumn).toString();
+        if (!loadData) {
+            analyses.append(info);
+            continue;
+        }
         int checksum = query->value(dataChecksumColumn).toInt();
         QString dataPath = analysisPath.absoluteFilePath(
             QString::number(info.analysisId));
@@ -366,6 +421,82 @@ void AnalysisDao::saveTrackAnalyses(
              << "analysisId" << analysis.analysisId;
 }
 
+QList<TrackId> AnalysisDao::loadAnalysisQueue() {
+    QList<TrackId> trackIds;
+    if (!m_database.isOpen()) {
+        return trackIds;
+    }
+
+    QSqlQuery& query = m_preparedQueries.prepared(m_database,
+            QStringLiteral("SELECT track_id FROM analysis_queue ORDER BY position"));
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't load the persisted analysis queue";
+        return trackIds;
+    }
+
+    while (query.next()) {
+        trackIds.append(TrackId(query.value(0)));
+    }
+    return trackIds;
+}
+
+void AnalysisDao::appendToAnalysisQueue(const QList<TrackId>& trackIds) {
+    if (!m_database.isOpen() || trackIds.isEmpty()) {
+        return;
+    }
+
+    ScopedTransaction transaction(m_database);
+    QSqlQuery maxPositionQuery(m_database);
+    maxPositionQuery.prepare(QStringLiteral(
+            "SELECT COALESCE(MAX(position), 0) FROM analysis_queue"));
+    if (!maxPositionQuery.exec() || !maxPositionQuery.next()) {
+        LOG_FAILED_QUERY(maxPositionQuery) << "couldn't determine the analysis queue position";
+        return;
+    }
+    int position = maxPositionQuery.value(0).toInt();
+
+    // Tracks that are already queued, e.g. when restoring the queue
+    // after a restart, keep their original position.
+    QSqlQuery& query = m_preparedQueries.prepared(m_database,
+            QStringLiteral("INSERT OR IGNORE INTO analysis_queue "
+                           "(track_id, position) VALUES (:trackId, :position)"));
+    for (const auto& trackId : trackIds) {
+        DEBUG_ASSERT(trackId.isValid());
+        query.bindValue(":trackId", trackId.toVariant());
+        query.bindValue(":position", ++position);
+        if (!query.exec()) {
+            LOG_FAILED_QUERY(query) << "couldn't queue track for analysis" << trackId;
+            return;
+        }
+    }
+    transaction.commit();
+}
+
+void AnalysisDao::removeFromAnalysisQueue(TrackId trackId) {
+    if (!m_database.isOpen() || !trackId.isValid()) {
+        return;
+    }
+
+    QSqlQuery& query = m_preparedQueries.prepared(m_database,
+            QStringLiteral("DELETE FROM analysis_queue WHERE track_id=:trackId"));
+    query.bindValue(":trackId", trackId.toVariant());
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't dequeue analyzed track" << trackId;
+    }
+}
+
+void AnalysisDao::clearAnalysisQueue() {
+    if (!m_database.isOpen()) {
+        return;
+    }
+
+    QSqlQuery& query = m_preparedQueries.prepared(m_database,
+            QStringLiteral("DELETE FROM analysis_queue"));
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't clear the persisted analysis queue";
+    }
+}
+
 size_t AnalysisDao::getDiskUsageInBytes(
         const QSqlDatabase& database,
         AnalysisType type) const {
@@ -5,6 +5,7 @@
 #include "preferences/usersettings.h"
 #include "library/dao/dao.h"
 #include "track/trackid.h"
+#include "util/db/preparedquerycache.h"
 #include "waveform/waveform.h"
 
 class QSqlDatabase;
@@ -16,7 +17,8 @@ class AnalysisDao : public DAO {
     enum AnalysisType {
         TYPE_UNKNOWN = 0,
         TYPE_WAVEFORM,
-        TYPE_WAVESUMMARY
+        TYPE_WAVESUMMARY,
+        TYPE_LOUDNESS_CURVE
     };
 
     struct AnalysisInfo {
@@ -47,6 +49,17 @@ class AnalysisDao : public DAO {
 
     QList<AnalysisInfo> getAnalysesForTrackByType(TrackId trackId, AnalysisType type);
     QList<AnalysisInfo> getAnalysesForTrack(TrackId trackId);
+    // Fetches only the database records (id, type, description, version)
+    // without reading and uncompressing the analysis data files. This is
+    // sufficient for deciding whether a stored analysis is still up-to-date
+    // and avoids loading megabytes of waveform data per track during a
+    // library-wide (re-)analysis pass. The data of a selected record can
+    // be loaded afterwards with loadAnalysisData().
+    QList<AnalysisInfo> getAnalysisMetadataForTrack(TrackId trackId);
+    // Loads the analysis data file for a record previously obtained from
+    // getAnalysisMetadataForTrack() and stores the uncompressed data in
+    // analysis->data. Returns false if the file is missing or corrupt.
+    bool loadAnalysisData(AnalysisInfo* analysis);
     bool saveAnalysis(AnalysisInfo* analysis);
     bool deleteAnalysis(const int analysisId);
     void deleteAnalyses(const QList<TrackId>& trackIds);
@@ -57,12 +70,22 @@ class AnalysisDao : public DAO {
             ConstWaveformPointer pWaveform,
             ConstWaveformPointer pWaveSummary);
 
+    // The persisted batch analysis queue. Scheduled tracks remain
+    // queued until their analysis has finished so that an interrupted
+    // bulk analysis can be resumed after a restart.
+    QList<TrackId> loadAnalysisQueue();
+    void appendToAnalysisQueue(const QList<TrackId>& trackIds);
+    void removeFromAnalysisQueue(TrackId trackId);
+    void clearAnalysisQueue();
+
   private:
     QDir getAnalysisStoragePath() const;
     QByteArray loadDataFromFile(const QString& fileName) const;
     bool saveDataToFile(const QString& fileName, const QByteArray& data) const;
     bool deleteFile(const QString& filename) const;
-    QList<AnalysisInfo> loadAnalysesFromQuery(TrackId trackId, QSqlQuery* query);
+    QList<AnalysisInfo> loadAnalysesFromQuery(TrackId trackId, QSqlQuery* query, bool loadData);
 
     const UserSettingsPointer m_pConfig;
+
+    mixxx::PreparedQueryCache m_preparedQueries;
 };
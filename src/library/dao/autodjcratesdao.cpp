@@ -2,6 +2,8 @@
 
 #include <QRandomGenerator>
 #include <QtDebug>
+#include <algorithm>
+#include <vector>
 
 #include "library/dao/trackschema.h"
 #include "library/queryutil.h"
@@ -66,7 +68,9 @@ AutoDJCratesDAO::AutoDJCratesDAO(
           m_bAutoDjCratesDbCreated(false),
           // By default, active tracks are not tracks that haven't been played in
           // a while.
-          m_bUseIgnoreTime(false) {
+          m_bUseIgnoreTime(false),
+          // The candidate pool is loaded on the first random draw.
+          m_bCandidatePoolDirty(true) {
 }
 
 AutoDJCratesDAO::~AutoDJCratesDAO() {
@@ -387,6 +391,9 @@ bool AutoDJCratesDAO::updateAutoDjPlaylistReferences() {
             }
         }
     }
+
+    // The reference counts of multiple tracks may have changed.
+    m_bCandidatePoolDirty = true;
     return true;
 }
 
@@ -488,6 +495,8 @@ bool AutoDJCratesDAO::updateLastPlayedDateTime() {
         return false;
     }
 
+    // The last-played date/time of multiple tracks may have changed.
+    m_bCandidatePoolDirty = true;
     return true;
 }
 
@@ -541,41 +550,90 @@ bool AutoDJCratesDAO::updateLastPlayedDateTimeForTrack(TrackId trackId) {
         return false;
     }
 
-    // The update was successful.
+    // The update was successful. The new date/time is only known to the
+    // database, so reload the pool before the next draw.
+    m_bCandidatePoolDirty = true;
+    return true;
+}
+
+// Reload the precomputed candidate pool from the auto-DJ-crates table.
+bool AutoDJCratesDAO::loadCandidatePool() {
+    // A single flat SELECT of the temporary table, without any of the
+    // joins and sorts that were formerly needed for every random draw.
+    QSqlQuery oQuery(m_database);
+    oQuery.prepare("SELECT " AUTODJCRATESTABLE_TRACKID ", "
+            AUTODJCRATESTABLE_CRATEREFS ", " AUTODJCRATESTABLE_TIMESPLAYED ", "
+            AUTODJCRATESTABLE_AUTODJREFS ", " AUTODJCRATESTABLE_LASTPLAYED
+            " FROM " AUTODJCRATES_TABLE);
+    if (!oQuery.exec()) {
+        LOG_FAILED_QUERY(oQuery);
+        return false;
+    }
+    m_candidatePool.clear();
+    while (oQuery.next()) {
+        CandidateTrack candidate;
+        candidate.iCrateRefs = oQuery.value(1).toInt();
+        candidate.iTimesPlayed = oQuery.value(2).toInt();
+        candidate.iAutoDjRefs = oQuery.value(3).toInt();
+        candidate.strLastPlayed = oQuery.value(4).toString();
+        m_candidatePool.insert(TrackId(oQuery.value(0)), candidate);
+    }
+    m_bCandidatePoolDirty = false;
     return true;
 }
 
+// Apply a delta to the auto-DJ reference count of a pooled candidate.
+void AutoDJCratesDAO::adjustCandidateAutoDjRefs(TrackId trackId, int iDelta) {
+    if (m_bCandidatePoolDirty) {
+        // The pool will be reloaded before the next draw anyway.
+        return;
+    }
+    const auto it = m_candidatePool.find(trackId);
+    if (it != m_candidatePool.end()) {
+        it.value().iAutoDjRefs += iDelta;
+    }
+}
+
 // Get the ID, i.e. one that references library.id, of a random track.
 // Returns an invalid track id if there was an error.
 TrackId AutoDJCratesDAO::getRandomTrackId() {
     // If necessary, create the temporary auto-DJ-crates database.
     createAndConnectAutoDjCratesDatabase();
 
-    // Calculate the number of active-tracks that have never been played, and
-    // the total number of active-tracks.
-    QSqlQuery oQuery(m_database);
-    // SELECT COUNT(*) AS count
-    // FROM temp_autodj_activetracks
-    // WHERE timesplayed = 0
-    // UNION ALL SELECT COUNT(*) AS count
-    // FROM temp_autodj_activetracks;
-    oQuery.prepare("SELECT COUNT(*) AS count FROM " AUTODJACTIVETRACKS_TABLE
-        " WHERE " AUTODJCRATESTABLE_TIMESPLAYED
-        " = 0 UNION ALL SELECT COUNT(*) AS count FROM "
-        AUTODJACTIVETRACKS_TABLE);
-    if (!oQuery.exec()) {
-        LOG_FAILED_QUERY(oQuery);
-        DEBUG_ASSERT(!"failed query");
+    // If the pool could not be mirrored incrementally since the last
+    // draw, reload it from the auto-DJ-crates table.
+    if (m_bCandidatePoolDirty && !loadCandidatePool()) {
         return TrackId();
     }
+
+    // Collect the active tracks, i.e. all candidates that are neither
+    // queued up in the auto-DJ playlist nor loaded into a deck, and
+    // count how many of them have never been played. This replaces the
+    // former active-tracks view, which had to be sorted by the database
+    // for every draw.
+    struct ActiveTrack {
+        TrackId trackId;
+        int iTimesPlayed;
+        QString strLastPlayed;
+    };
+    std::vector<ActiveTrack> activeTracks;
+    activeTracks.reserve(m_candidatePool.size());
     int iUnplayedTracks = 0;
-    int iTotalTracks = 0;
-    if (oQuery.next()) {
-        iUnplayedTracks = oQuery.value(0).toInt();
-        if (oQuery.next()) {
-            iTotalTracks = oQuery.value(0).toInt();
+    for (auto it = m_candidatePool.constBegin();
+            it != m_candidatePool.constEnd();
+            ++it) {
+        if (it.value().iAutoDjRefs != 0) {
+            continue;
+        }
+        if (it.value().iTimesPlayed == 0) {
+            ++iUnplayedTracks;
         }
+        activeTracks.push_back(ActiveTrack{
+                it.key(),
+                it.value().iTimesPlayed,
+                it.value().strLastPlayed});
     }
+    int iTotalTracks = static_cast<int>(activeTracks.size());
 
     // Get the active percentage (default 20%).
     int minimumAvailablePercentage = m_pConfig->getValue(
@@ -614,19 +672,15 @@ TrackId AutoDJCratesDAO::getRandomTrackId() {
         // but not quite.
         QString strDateTime = timeCurrent.toString("yyyy-MM-dd hh:mm:ss");
 
-        // Count the number of tracks that haven't been played since this time.
-        // SELECT COUNT(*) FROM temp_autodj_activetracks WHERE lastplayed < :lastplayed;
+        // Count the number of tracks that haven't been played since this
+        // time. Tracks without a last-played date/time are not counted,
+        // like in the former SQL comparison with NULL.
         int iIgnoreTimeTracks = 0;
-        oQuery.prepare("SELECT COUNT(*) FROM " AUTODJACTIVETRACKS_TABLE
-            " WHERE " AUTODJCRATESTABLE_LASTPLAYED " < :lastplayed");
-        oQuery.bindValue (":lastplayed", strDateTime);
-        if (oQuery.exec()) {
-            if (oQuery.next()) {
-                iIgnoreTimeTracks = oQuery.value(0).toInt();
+        for (const auto& activeTrack : activeTracks) {
+            if (!activeTrack.strLastPlayed.isEmpty() &&
+                    activeTrack.strLastPlayed < strDateTime) {
+                ++iIgnoreTimeTracks;
             }
-        } else {
-            LOG_FAILED_QUERY(oQuery);
-            return TrackId();
         }
 
         // Allow that to be a new maximum.
@@ -640,26 +694,28 @@ TrackId AutoDJCratesDAO::getRandomTrackId() {
         qDebug() << "No random track available for Auto DJ";
         return TrackId();
     }
-
-    // Pick a random track.
-    // SELECT track_id
-    // FROM temp_autodj_activetracks LIMIT 1 OFFSET ABS (RANDOM() % :active);
-    oQuery.prepare("SELECT " AUTODJCRATESTABLE_TRACKID " FROM "
-        AUTODJACTIVETRACKS_TABLE " LIMIT 1 OFFSET ABS (RANDOM() % :active)");
-    oQuery.bindValue (":active", iActiveTracks);
-    if (!oQuery.exec()) {
-        LOG_FAILED_QUERY(oQuery);
-        DEBUG_ASSERT(!"failed query");
-        return TrackId();
-    }
-    if (oQuery.next()) {
-        // Give our caller the randomly-selected track.
-        return TrackId(oQuery.value(0));
-    } else {
-        DEBUG_ASSERT(false); // We should have exit earlier
-        qDebug() << "No random track available for Auto DJ";
-        return TrackId();
-    }
+    iActiveTracks = qMin(iActiveTracks, iTotalTracks);
+
+    // Pick a random rank among the preferred active tracks and select
+    // the track of that rank, ordered like the former active-tracks
+    // view: by times played and last-played date/time, or by the
+    // last-played date/time alone if the ignore time is in use. An
+    // unset last-played date/time sorts first, like NULL did.
+    const int iRank = bounded_rand(iActiveTracks);
+    const bool bUseIgnoreTime = m_bUseIgnoreTime;
+    std::nth_element(
+            activeTracks.begin(),
+            activeTracks.begin() + iRank,
+            activeTracks.end(),
+            [bUseIgnoreTime](const ActiveTrack& lhs, const ActiveTrack& rhs) {
+                if (!bUseIgnoreTime && lhs.iTimesPlayed != rhs.iTimesPlayed) {
+                    return lhs.iTimesPlayed < rhs.iTimesPlayed;
+                }
+                return lhs.strLastPlayed < rhs.strLastPlayed;
+            });
+
+    // Give our caller the randomly-selected track.
+    return activeTracks[iRank].trackId;
 }
 
 TrackId AutoDJCratesDAO::getRandomTrackIdFromAutoDj(int percentActive) {
@@ -764,6 +820,15 @@ void AutoDJCratesDAO::slotTrackDirty(TrackId trackId) {
         LOG_FAILED_QUERY(oQuery);
         return;
     }
+
+    // Mirror the conditional update in the candidate pool.
+    if (!m_bCandidatePoolDirty) {
+        const auto it = m_candidatePool.find(trackId);
+        if (it != m_candidatePool.end() &&
+                it.value().iTimesPlayed == playCounter.getTimesPlayed() - 1) {
+            it.value().iTimesPlayed = playCounter.getTimesPlayed();
+        }
+    }
 }
 
 void AutoDJCratesDAO::slotCrateInserted(CrateId crateId) {
@@ -857,6 +922,8 @@ void AutoDJCratesDAO::updateAutoDjCrate(CrateId crateId) {
         LOG_FAILED_QUERY(oQuery);
         return;
     }
+    // The crate reference counts of multiple tracks may have changed.
+    m_bCandidatePoolDirty = true;
     if (oQuery.numRowsAffected() == 0) {
         oTransaction.commit();
         return;
@@ -917,6 +984,9 @@ void AutoDJCratesDAO::deleteAutoDjCrate(CrateId crateId) {
 
     // The transaction was successful.
     oTransaction.commit();
+
+    // The crate reference counts of multiple tracks have changed.
+    m_bCandidatePoolDirty = true;
 }
 
 void AutoDJCratesDAO::slotCrateTracksChanged(
@@ -948,6 +1018,13 @@ void AutoDJCratesDAO::slotCrateTracksChanged(
             return;
         }
         if (oQuery.numRowsAffected() == 1) {
+            // Mirror the additional crate reference in the candidate pool.
+            if (!m_bCandidatePoolDirty) {
+                const auto it = m_candidatePool.find(trackId);
+                if (it != m_candidatePool.end()) {
+                    ++it.value().iCrateRefs;
+                }
+            }
             continue;
         }
 
@@ -978,6 +1055,9 @@ void AutoDJCratesDAO::slotCrateTracksChanged(
             continue;
         }
 
+        // A new candidate row has been created from the library table.
+        m_bCandidatePoolDirty = true;
+
         // Update the number of auto-DJ-playlist references to this track.
         if (!updateAutoDjPlaylistReferencesForTrack(trackId)) {
             return; // failure
@@ -1009,6 +1089,14 @@ void AutoDJCratesDAO::slotCrateTracksChanged(
             LOG_FAILED_QUERY(oQuery);
             return;
         }
+
+        // Mirror the removed crate reference in the candidate pool.
+        if (!m_bCandidatePoolDirty) {
+            const auto it = m_candidatePool.find(trackId);
+            if (it != m_candidatePool.end() && --it.value().iCrateRefs <= 0) {
+                m_candidatePool.erase(it);
+            }
+        }
     }
     // The transaction was successful.
     oTransaction.commit();
@@ -1051,6 +1139,7 @@ void AutoDJCratesDAO::slotPlaylistTrackAdded(int playlistId, TrackId trackId,
             LOG_FAILED_QUERY(oQuery);
             return;
         }
+        adjustCandidateAutoDjRefs(trackId, 1);
     } else if (m_lstSetLogPlaylistIds.contains(playlistId)) {
         // Deal with changes to set-log playlists.
         // If this query doesn't succeed, it'll log a message.
@@ -1076,6 +1165,7 @@ void AutoDJCratesDAO::slotPlaylistTrackRemoved(int playlistId,
             LOG_FAILED_QUERY(oQuery);
             return;
         }
+        adjustCandidateAutoDjRefs(trackId, -1);
     } else if (m_lstSetLogPlaylistIds.contains(playlistId)) {
         // Deal with changes to set-log playlists.
         // If this query doesn't succeed, it'll log a message.
@@ -1118,6 +1208,7 @@ void AutoDJCratesDAO::playerInfoTrackLoaded(const QString& group,
                 LOG_FAILED_QUERY(oQuery);
                 return;
             }
+            adjustCandidateAutoDjRefs(trackId, 1);
             return;
         }
     }
@@ -1146,6 +1237,7 @@ void AutoDJCratesDAO::playerInfoTrackUnloaded(const QString& group,
                 LOG_FAILED_QUERY(oQuery);
                 return;
             }
+            adjustCandidateAutoDjRefs(trackId, -1);
             return;
         }
     }
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <QHash>
 #include <QObject>
 #include <QSqlDatabase>
+#include <QString>
 
 #include "library/trackset/crate/crateid.h"
 #include "preferences/usersettings.h"
@@ -59,6 +61,27 @@ class AutoDJCratesDAO : public QObject {
     // This is used when all active tracks are already queued up.
     TrackId getRandomTrackIdFromAutoDj(int percentActive);
 
+    // In-memory mirror of one row of the auto-DJ-crates table. The pool
+    // of all candidate rows allows getRandomTrackId() to draw random
+    // tracks without any SQL on the hot path.
+    struct CandidateTrack {
+        int iCrateRefs;
+        int iTimesPlayed;
+        int iAutoDjRefs;
+        // Last-played date/time in sqlite's format, which sorts
+        // lexicographically in chronological order. Empty if the track
+        // has never been recorded in a set-log playlist.
+        QString strLastPlayed;
+    };
+
+    // Reload the candidate pool from the auto-DJ-crates table.
+    // Returns true if successful.
+    bool loadCandidatePool();
+
+    // Apply a delta to the auto-DJ reference count of a pooled candidate,
+    // mirroring the corresponding SQL update.
+    void adjustCandidateAutoDjRefs(TrackId trackId, int iDelta);
+
   private slots:
     // Signaled by the track DAO when a track's information is updated.
     void slotTrackDirty(TrackId trackId);
@@ -119,4 +142,13 @@ class AutoDJCratesDAO : public QObject {
 
     // The ID of every set-log playlist.
     QList<int> m_lstSetLogPlaylistIds;
+
+    // The precomputed candidate pool, keyed by track ID. Kept in sync
+    // with the auto-DJ-crates table by the slots below; whenever a
+    // change cannot be mirrored trivially the pool is marked dirty and
+    // reloaded with a single flat SELECT on the next random draw.
+    QHash<TrackId, CandidateTrack> m_candidatePool;
+
+    // True if the candidate pool must be reloaded before the next draw.
+    bool m_bCandidatePoolDirty;
 };
@@ -155,26 +155,28 @@ bool CueDAO::saveCue(TrackId trackId, Cue* cue) const {
     }
 
     // Prepare query
-    QSqlQuery query(m_database);
+    // saveCue() is invoked once per cue when saving a track's cues,
+    // so both statements are prepared only once and then reused.
+    QSqlQuery& query = cue->getId().isValid()
+            // Update cue
+            ? m_preparedQueries.prepared(m_database,
+                      QStringLiteral("UPDATE " CUE_TABLE " SET "
+                                     "track_id=:track_id,"
+                                     "type=:type,"
+                                     "position=:position,"
+                                     "length=:length,"
+                                     "hotcue=:hotcue,"
+                                     "label=:label,"
+                                     "color=:color"
+                                     " WHERE id=:id"))
+            // New cue
+            : m_preparedQueries.prepared(m_database,
+                      QStringLiteral("INSERT INTO " CUE_TABLE
+                                     " (track_id, type, position, length, hotcue, "
+                                     "label, color) VALUES (:track_id, :type, "
+                                     ":position, :length, :hotcue, :label, :color)"));
     if (cue->getId().isValid()) {
-        // Update cue
-        query.prepare(QStringLiteral("UPDATE " CUE_TABLE " SET "
-                        "track_id=:track_id,"
-                        "type=:type,"
-                        "position=:position,"
-                        "length=:length,"
-                        "hotcue=:hotcue,"
-                        "label=:label,"
-                        "color=:color"
-                        " WHERE id=:id"));
         query.bindValue(":id", cue->getId().toVariant());
-    } else {
-        // New cue
-        query.prepare(
-                QStringLiteral("INSERT INTO " CUE_TABLE
-                               " (track_id, type, position, length, hotcue, "
-                               "label, color) VALUES (:track_id, :type, "
-                               ":position, :length, :hotcue, :label, :color)"));
     }
 
     // Bind values and execute query
@@ -3,6 +3,7 @@
 #include "library/dao/dao.h"
 #include "track/cue.h"
 #include "track/trackid.h"
+#include "util/db/preparedquerycache.h"
 
 #define CUE_TABLE "cues"
 
@@ -20,4 +21,8 @@ class CueDAO : public DAO {
 
   private:
     bool saveCue(TrackId trackId, Cue* pCue) const;
+
+    // mutable, because reusing prepared statements is an
+    // implementation detail of logically const queries
+    mutable mixxx::PreparedQueryCache m_preparedQueries;
 };
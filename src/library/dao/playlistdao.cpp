@@ -735,17 +735,78 @@ void PlaylistDAO::removeTrackFromPlaylist(int playlistId, int position) {
 }
 
 void PlaylistDAO::removeTracksFromPlaylist(int playlistId, const QList<int>& positions) {
-    // get positions in reversed order
-    auto sortedPositons = positions;
-    std::sort(sortedPositons.begin(), sortedPositons.end(), std::greater<int>());
-
     //qDebug() << "PlaylistDAO::removeTrackFromPlaylist"
     //         << QThread::currentThread() << m_database.connectionName();
+    if (positions.isEmpty()) {
+        return;
+    }
+
+    QStringList positionStrings;
+    positionStrings.reserve(positions.size());
+    for (const int position : positions) {
+        positionStrings << QString::number(position);
+    }
+    const QString positionList = positionStrings.join(QChar(','));
+
     ScopedTransaction transaction(m_database);
-    for (const auto position : std::as_const(sortedPositons)) {
-        removeTracksFromPlaylistInner(playlistId, position);
+
+    // Look up the removed ids up front, because the signals emitted below
+    // report the removed positions together with their track ids.
+    QSqlQuery query(m_database);
+    query.prepare(QStringLiteral(
+            "SELECT track_id, position FROM PlaylistTracks "
+            "WHERE playlist_id=:id AND position IN (%1)")
+                    .arg(positionList));
+    query.bindValue(":id", playlistId);
+    query.setForwardOnly(true);
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query);
+        return;
+    }
+    QList<QPair<TrackId, int>> removedTracks;
+    removedTracks.reserve(positions.size());
+    while (query.next()) {
+        removedTracks.append(qMakePair(
+                TrackId(query.value(0)), query.value(1).toInt()));
     }
+
+    // Delete all rows in one statement and close the resulting gaps with a
+    // single renumbering update instead of shifting the tail of the
+    // playlist once per removed row, which took quadratic time on large
+    // selections.
+    query.prepare(QStringLiteral(
+            "DELETE FROM PlaylistTracks "
+            "WHERE playlist_id=:id AND position IN (%1)")
+                    .arg(positionList));
+    query.bindValue(":id", playlistId);
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query);
+        return;
+    }
+
+    query.prepare(QStringLiteral(
+            "UPDATE PlaylistTracks SET position="
+            "(SELECT COUNT(*) FROM PlaylistTracks AS p2 "
+            "WHERE p2.playlist_id=PlaylistTracks.playlist_id "
+            "AND p2.position<=PlaylistTracks.position) "
+            "WHERE playlist_id=:id"));
+    query.bindValue(":id", playlistId);
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query);
+    }
+
     transaction.commit();
+
+    const bool isHistoryPlaylist = getHiddenType(playlistId) == PLHT_SET_LOG;
+    QSet<TrackId> removedTrackIds;
+    for (const auto& removedTrack : std::as_const(removedTracks)) {
+        m_playlistsTrackIsIn.remove(removedTrack.first, playlistId);
+        emit trackRemoved(playlistId, removedTrack.first, removedTrack.second);
+        removedTrackIds.insert(removedTrack.first);
+    }
+    if (isHistoryPlaylist) {
+        emit tracksRemovedFromPlayedHistory(removedTrackIds);
+    }
     emit playlistContentChanged(QSet<int>{playlistId});
     emit tracksRemoved(QSet<int>{playlistId});
 }
@@ -855,6 +916,19 @@ int PlaylistDAO::insertTracksIntoPlaylist(const QList<TrackId>& trackIds,
         return 0;
     }
 
+    // Skip invalid ids up front, so the gap opened by the position shift
+    // below matches the number of rows that actually get inserted.
+    QList<TrackId> validTrackIds;
+    validTrackIds.reserve(trackIds.size());
+    for (const auto& trackId : trackIds) {
+        if (trackId.isValid()) {
+            validTrackIds.append(trackId);
+        }
+    }
+    if (validTrackIds.isEmpty()) {
+        return 0;
+    }
+
     int numTracksAdded = 0;
     ScopedTransaction transaction(m_database);
 
@@ -864,32 +938,31 @@ int PlaylistDAO::insertTracksIntoPlaylist(const QList<TrackId>& trackIds,
         position = max_position;
     }
 
+    // Move all following tracks in the playlist up by the number of
+    // inserted tracks in a single set-based update. Shifting by one per
+    // inserted track took quadratic time on large selections.
+    QSqlQuery query(m_database);
+    query.prepare(QStringLiteral(
+            "UPDATE PlaylistTracks SET position=position+:count "
+            "WHERE position>=:position AND "
+            "playlist_id=:id"));
+    query.bindValue(":count", static_cast<int>(validTrackIds.size()));
+    query.bindValue(":id", playlistId);
+    query.bindValue(":position", position);
+
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query);
+        return 0;
+    }
+
     QSqlQuery insertQuery(m_database);
     insertQuery.prepare(QStringLiteral(
             "INSERT INTO PlaylistTracks (playlist_id, track_id, position)"
             "VALUES (:playlist_id, :track_id, :position)"));
-    QSqlQuery query(m_database);
+    insertQuery.bindValue(":playlist_id", playlistId);
     int insertPositon = position;
-    for (const auto& trackId : trackIds) {
-        if (!trackId.isValid()) {
-            continue;
-        }
-        // Move all tracks in playlist up by 1.
-        // TODO(XXX) We could do this in one query before the for loop.
-        query.prepare(QStringLiteral(
-                "UPDATE PlaylistTracks SET position=position+1 "
-                "WHERE position>=:position AND "
-                "playlist_id=:id"));
-        query.bindValue(":id", playlistId);
-        query.bindValue(":position", insertPositon);
-
-        if (!query.exec()) {
-            LOG_FAILED_QUERY(query);
-            continue;
-        }
-
+    for (const auto& trackId : validTrackIds) {
         // Insert the track at the given position
-        insertQuery.bindValue(":playlist_id", playlistId);
         insertQuery.bindValue(":track_id", trackId.toVariant());
         insertQuery.bindValue(":position", insertPositon);
         if (!insertQuery.exec()) {
@@ -905,7 +978,7 @@ int PlaylistDAO::insertTracksIntoPlaylist(const QList<TrackId>& trackIds,
     transaction.commit();
 
     insertPositon = position;
-    for (const auto& trackId : trackIds) {
+    for (const auto& trackId : validTrackIds) {
         m_playlistsTrackIsIn.insert(trackId, playlistId);
         // TODO(XXX) The position is wrong if any track failed to insert.
         emit trackAdded(playlistId, trackId, insertPositon++);
@@ -0,0 +1,128 @@
+#include "library/dao/searchindexdao.h"
+
+#include <QSqlQuery>
+
+#include "library/dao/trackschema.h"
+#include "library/queryutil.h"
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("SearchIndexDAO");
+
+/// FTS5 is a compile-time option of SQLite. Probe for it by creating a
+/// throwaway virtual table in the temp database instead of relying on
+/// version or compile option queries.
+bool isFts5Available(const QSqlDatabase& database) {
+    QSqlQuery query(database);
+    if (!query.exec(QStringLiteral(
+                "CREATE VIRTUAL TABLE temp.fts5_probe USING fts5(probe)"))) {
+        return false;
+    }
+    query.exec(QStringLiteral("DROP TABLE temp.fts5_probe"));
+    return true;
+}
+
+} // anonymous namespace
+
+//static
+const QString SearchIndexDAO::kTableName = QStringLiteral("track_search");
+
+//static
+const QStringList& SearchIndexDAO::indexedColumns() {
+    static const QStringList kColumns = {
+            LIBRARYTABLE_ARTIST,
+            LIBRARYTABLE_ALBUMARTIST,
+            LIBRARYTABLE_ALBUM,
+            LIBRARYTABLE_TITLE,
+            LIBRARYTABLE_GENRE,
+            LIBRARYTABLE_COMPOSER,
+            LIBRARYTABLE_GROUPING,
+            LIBRARYTABLE_COMMENT,
+    };
+    return kColumns;
+}
+
+void SearchIndexDAO::initialize(const QSqlDatabase& database) {
+    DAO::initialize(database);
+    m_enabled = isFts5Available(database) && createFtsTableAndTriggers();
+    if (m_enabled) {
+        kLogger.info() << "Using FTS5 index for library search";
+    } else {
+        kLogger.info() << "FTS5 not available,"
+                       << "falling back to LIKE-based library search";
+    }
+}
+
+bool SearchIndexDAO::createFtsTableAndTriggers() {
+    const QStringList& columns = indexedColumns();
+    const QString columnList = columns.join(QChar(','));
+    QStringList newValues;
+    QStringList updateAssignments;
+    newValues.reserve(columns.size());
+    updateAssignments.reserve(columns.size());
+    for (const QString& column : columns) {
+        newValues << QStringLiteral("new.") + column;
+        updateAssignments << QStringLiteral("%1=new.%1").arg(column);
+    }
+
+    QSqlQuery query(m_database);
+    // The unicode61 tokenizer with remove_diacritics approximates the
+    // accent and case insensitive matching of the legacy LIKE filters,
+    // which compare latin-lowered strings (see
+    // DbConnection::makeStringLatinLow).
+    if (!query.exec(QStringLiteral(
+                "CREATE VIRTUAL TABLE IF NOT EXISTS %1 USING fts5("
+                "%2,tokenize=\"unicode61 remove_diacritics 2\")")
+                            .arg(kTableName, columnList))) {
+        LOG_FAILED_QUERY(query);
+        return false;
+    }
+    // Incremental maintenance: mirror every change of the library table
+    // into the index. The triggers fire for all writers, including direct
+    // SQL updates that bypass TrackDAO.
+    if (!query.exec(QStringLiteral(
+                "CREATE TRIGGER IF NOT EXISTS %1_insert "
+                "AFTER INSERT ON library BEGIN "
+                "INSERT INTO %1(rowid,%2) VALUES (new.id,%3);"
+                "END")
+                            .arg(kTableName,
+                                    columnList,
+                                    newValues.join(QChar(','))))) {
+        LOG_FAILED_QUERY(query);
+        return false;
+    }
+    if (!query.exec(QStringLiteral(
+                "CREATE TRIGGER IF NOT EXISTS %1_delete "
+                "AFTER DELETE ON library BEGIN "
+                "DELETE FROM %1 WHERE rowid=old.id;"
+                "END")
+                            .arg(kTableName))) {
+        LOG_FAILED_QUERY(query);
+        return false;
+    }
+    if (!query.exec(QStringLiteral(
+                "CREATE TRIGGER IF NOT EXISTS %1_update "
+                "AFTER UPDATE OF %2 ON library BEGIN "
+                "UPDATE %1 SET %3 WHERE rowid=new.id;"
+                "END")
+                            .arg(kTableName,
+                                    columnList,
+                                    updateAssignments.join(QChar(','))))) {
+        LOG_FAILED_QUERY(query);
+        return false;
+    }
+    // Backfill tracks that were added before the index existed (or while
+    // running an older version of Mixxx that did not have the triggers).
+    // This scans the library table once; afterwards the triggers keep the
+    // index up to date.
+    if (!query.exec(QStringLiteral(
+                "INSERT INTO %1(rowid,%2) "
+                "SELECT id,%2 FROM library "
+                "WHERE id NOT IN (SELECT rowid FROM %1)")
+                            .arg(kTableName, columnList))) {
+        LOG_FAILED_QUERY(query);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <QString>
+#include <QStringList>
+
+#include "library/dao/dao.h"
+
+/// Maintains a persistent SQLite FTS5 full-text index over the textual
+/// metadata columns of the library table.
+///
+/// The index is kept up to date incrementally by database triggers, so every
+/// code path that modifies track metadata (TrackDAO, the scanner, analyzers)
+/// is covered without explicit bookkeeping. Untagged search terms are then
+/// answered from the index via FtsTextFilterNode instead of LIKE-scanning
+/// all text columns of the whole library table, see SearchQueryParser.
+///
+/// If the SQLite build does not provide the FTS5 module the DAO stays
+/// disabled and search transparently falls back to the legacy LIKE filters.
+class SearchIndexDAO : public DAO {
+  public:
+    ~SearchIndexDAO() override = default;
+
+    void initialize(const QSqlDatabase& database) override;
+
+    bool isEnabled() const {
+        return m_enabled;
+    }
+
+    /// Name of the FTS5 table. The rowid of each index entry is the id of
+    /// the corresponding row in the library table.
+    static const QString kTableName;
+
+    /// Library columns covered by the index. Columns that live in other
+    /// tables (e.g. the file location in track_locations) are not indexed
+    /// and keep their LIKE filter.
+    static const QStringList& indexedColumns();
+
+  private:
+    bool createFtsTableAndTriggers();
+
+    bool m_enabled = false;
+};
@@ -19,6 +19,7 @@
 #include "library/dao/trackschema.h"
 #include "library/library_prefs.h"
 #include "library/queryutil.h"
+#include "library/trackupdatejournal.h"
 #include "moc_trackdao.cpp"
 #include "sources/soundsourceproxy.h"
 #include "track/beats.h"
@@ -37,6 +38,7 @@
 #include "util/logger.h"
 #include "util/math.h"
 #include "util/qt.h"
+#include "util/stringinterner.h"
 #include "util/timer.h"
 
 namespace {
@@ -98,6 +100,7 @@ TrackDAO::TrackDAO(CueDAO& cueDao,
           m_analysisDao(analysisDao),
           m_libraryHashDao(libraryHashDao),
           m_pConfig(pConfig),
+          m_pUpdateJournal(nullptr),
           m_trackLocationIdColumn(UndefinedRecordIndex),
           m_queryLibraryIdColumn(UndefinedRecordIndex),
           m_queryLibraryMixxxDeletedColumn(UndefinedRecordIndex) {
@@ -156,11 +159,13 @@ TrackId TrackDAO::getTrackIdByLocation(const QString& location) const {
         return {};
     }
 
-    QSqlQuery query(m_database);
-    query.prepare(
-            "SELECT library.id FROM library "
-            "INNER JOIN track_locations ON library.location = track_locations.id "
-            "WHERE track_locations.location=:location");
+    // Executed once per track during a library scan, so reuse
+    // the prepared statement instead of re-preparing it.
+    QSqlQuery& query = m_preparedQueries.prepared(m_database,
+            QStringLiteral(
+                    "SELECT library.id FROM library "
+                    "INNER JOIN track_locations ON library.location = track_locations.id "
+                    "WHERE track_locations.location=:location"));
     query.bindValue(":location", location);
     if (!query.exec()) {
         LOG_FAILED_QUERY(query);
@@ -1155,7 +1160,7 @@ typedef void (*TrackPopulatorFn)(
         Track* pTrack);
 
 void setTrackArtist(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setArtist(record.value(column).toString());
+    pTrack->setArtist(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackTitle(const QSqlRecord& record, const int column, Track* pTrack) {
@@ -1163,27 +1168,28 @@ void setTrackTitle(const QSqlRecord& record, const int column, Track* pTrack) {
 }
 
 void setTrackAlbum(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setAlbum(record.value(column).toString());
+    pTrack->setAlbum(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackAlbumArtist(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setAlbumArtist(record.value(column).toString());
+    pTrack->setAlbumArtist(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackYear(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setYear(record.value(column).toString());
+    pTrack->setYear(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackGenre(const QSqlRecord& record, const int column, Track* pTrack) {
-    TrackDAO::setTrackGenreInternal(pTrack, record.value(column).toString());
+    TrackDAO::setTrackGenreInternal(pTrack,
+            mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackComposer(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setComposer(record.value(column).toString());
+    pTrack->setComposer(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackGrouping(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setGrouping(record.value(column).toString());
+    pTrack->setGrouping(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackNumber(const QSqlRecord& record, const int column, Track* pTrack) {
@@ -1191,7 +1197,7 @@ void setTrackNumber(const QSqlRecord& record, const int column, Track* pTrack) {
 }
 
 void setTrackTotal(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setTrackTotal(record.value(column).toString());
+    pTrack->setTrackTotal(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackColor(const QSqlRecord& record, const int column, Track* pTrack) {
@@ -1252,7 +1258,7 @@ void setTrackDateAdded(const QSqlRecord& record, const int column, Track* pTrack
 }
 
 void setTrackFiletype(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setType(record.value(column).toString());
+    pTrack->setType(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackHeaderParsed(const QSqlRecord& record, const int column, Track* pTrack) {
@@ -1381,6 +1387,14 @@ TrackPointer TrackDAO::getTrackById(TrackId trackId) const {
         return pTrack;
     }
 
+    if (m_pUpdateJournal) {
+        // The track is not cached and will be re-created from its
+        // database row. A journaled update of the evicted track object
+        // must be committed first, otherwise the new track object would
+        // be populated with outdated metadata.
+        m_pUpdateJournal->waitForPendingUpdate(trackId);
+    }
+
     constexpr ColumnPopulator columns[] = {
             // Location must be first and is populated manually!
             {"track_locations.location", nullptr},
@@ -1679,6 +1693,34 @@ bool TrackDAO::updateTrack(const Track& track) const {
     const TrackId trackId = track.getId();
     DEBUG_ASSERT(trackId.isValid());
 
+    if (m_pUpdateJournal) {
+        // Write-behind: Defer the transaction to the journal thread
+        // instead of blocking the calling thread until the commit has
+        // been flushed to disk. The snapshot captures the track's
+        // current state, i.e. the track object is no longer needed
+        // and might be deleted before the update is committed.
+        kLogger.debug() << "TrackDAO:"
+                        << "Journaling track update"
+                        << trackId
+                        << track.getLocation();
+        TrackUpdateJournal::Entry entry;
+        entry.trackId = trackId;
+        entry.record = track.getRecord();
+        entry.pBeats = track.getBeats();
+        entry.cuePoints = track.getCuePoints();
+        entry.pWaveform = track.getWaveform();
+        entry.pWaveformSummary = track.getWaveformSummary();
+        if (m_pUpdateJournal->enqueue(std::move(entry))) {
+            return true;
+        }
+        // The journal thread is not running, e.g. because it failed to
+        // open its database connection. Fall through to the synchronous
+        // update instead of losing the changes.
+        kLogger.warning() << "TrackDAO:"
+                          << "Track update journal is unavailable,"
+                          << "updating track synchronously";
+    }
+
     kLogger.debug() << "TrackDAO:"
                     << "Updating track in database"
                     << trackId
@@ -1688,7 +1730,37 @@ bool TrackDAO::updateTrack(const Track& track) const {
     // PerformanceTimer time;
     // time.start();
 
-    QSqlQuery query(m_database);
+    if (!updateTrackLibraryRow(
+                m_database,
+                trackId,
+                track.getRecord(),
+                track.getBeats())) {
+        return false;
+    }
+
+    // kLogger.debug() << "Update track took : " <<
+    // time.elapsed().formatMillisWithUnit() << "Now updating cues";
+    // time.start();
+    m_analysisDao.saveTrackAnalyses(
+            trackId,
+            track.getWaveform(),
+            track.getWaveformSummary());
+    m_cueDao.saveTrackCues(
+            trackId, track.getCuePoints());
+    transaction.commit();
+
+    // kLogger.debug() << "Update track in database took: " <<
+    // time.elapsed().formatMillisWithUnit(); time.start();
+    return true;
+}
+
+//static
+bool TrackDAO::updateTrackLibraryRow(
+        const QSqlDatabase& database,
+        TrackId trackId,
+        const mixxx::TrackRecord& trackRecord,
+        const mixxx::BeatsPointer& pBeats) {
+    QSqlQuery query(database);
 
     // Update everything but "location", since that's what we identify the track by.
     query.prepare(
@@ -1741,11 +1813,10 @@ bool TrackDAO::updateTrack(const Track& track) const {
 
     query.bindValue(":track_id", trackId.toVariant());
 
-    const auto trackRecord = track.getRecord();
     bindTrackLibraryValues(
             &query,
             trackRecord,
-            track.getBeats());
+            pBeats);
 
     if (!query.exec()) {
         LOG_FAILED_QUERY(query);
@@ -1758,22 +1829,41 @@ bool TrackDAO::updateTrack(const Track& track) const {
         return false;
     }
 
-    // kLogger.debug() << "Update track took : " <<
-    // time.elapsed().formatMillisWithUnit() << "Now updating cues";
-    // time.start();
-    m_analysisDao.saveTrackAnalyses(
-            trackId,
-            track.getWaveform(),
-            track.getWaveformSummary());
-    m_cueDao.saveTrackCues(
-            trackId, track.getCuePoints());
-    transaction.commit();
-
-    // kLogger.debug() << "Update track in database took: " <<
-    // time.elapsed().formatMillisWithUnit(); time.start();
     return true;
 }
 
+bool TrackDAO::updateSourceSynchronizedAt(
+        TrackId trackId,
+        const QDateTime& sourceSynchronizedAt) const {
+    VERIFY_OR_DEBUG_ASSERT(sourceSynchronizedAt.isValid()) {
+        return false;
+    }
+    DEBUG_ASSERT(sourceSynchronizedAt.timeSpec() == Qt::UTC);
+    if (!trackId.isValid()) {
+        // The track might have been purged from the library while
+        // the metadata export was still pending. Nothing to do.
+        return false;
+    }
+    QSqlQuery query(m_database);
+    // Guard against overwriting a more recent time stamp in case the
+    // track has been synchronized again in the meantime.
+    query.prepare(QStringLiteral(
+            "UPDATE library "
+            "SET source_synchronized_ms=:source_synchronized_ms "
+            "WHERE id=:id "
+            "AND (source_synchronized_ms IS NULL "
+            "OR source_synchronized_ms<:source_synchronized_ms)"));
+    query.bindValue(":id", trackId.toVariant());
+    query.bindValue(":source_synchronized_ms",
+            sourceSynchronizedAt.toMSecsSinceEpoch());
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query);
+        DEBUG_ASSERT(!"Failed query");
+        return false;
+    }
+    return query.numRowsAffected() > 0;
+}
+
 // Make sure that `directory` in in track_locations table is indeed a
 // directory path. This works around / removes residues of a bug where tracks
 // are falsely marked missing because `directory` == `location`.
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QDateTime>
 #include <QList>
 #include <QObject>
 #include <QSet>
@@ -9,14 +10,17 @@
 #include "library/dao/dao.h"
 #include "library/relocatedtrack.h"
 #include "preferences/usersettings.h"
+#include "track/beats.h"
 #include "track/globaltrackcache.h"
 #include "util/class.h"
+#include "util/db/preparedquerycache.h"
 
 class SqlTransaction;
 class PlaylistDAO;
 class AnalysisDao;
 class CueDAO;
 class LibraryHashDAO;
+class TrackUpdateJournal;
 
 namespace mixxx {
 class FileInfo;
@@ -83,6 +87,33 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
     bool updatePlayCounterFromPlayedHistory(
             const QSet<TrackId>& trackIds) const;
 
+    /// Record that the file tags of a track have been synchronized
+    /// after an asynchronous metadata export has finished. A more
+    /// recent time stamp in the database is never overwritten.
+    bool updateSourceSynchronizedAt(
+            TrackId trackId,
+            const QDateTime& sourceSynchronizedAt) const;
+
+    /// Attach or detach (pJournal = nullptr) the write-behind journal.
+    /// While attached updateTrack() only journals a snapshot of the
+    /// track's database state instead of committing a transaction on
+    /// the calling thread.
+    void setUpdateJournal(TrackUpdateJournal* pJournal) {
+        m_pUpdateJournal = pJournal;
+    }
+
+    /// Update the library row of an existing track from a metadata
+    /// snapshot. Shared between the synchronous updateTrack() path and
+    /// the write-behind journal, which replays snapshots on its own
+    /// database connection. The caller is responsible for wrapping the
+    /// update into a transaction together with the track's cues and
+    /// analyses.
+    static bool updateTrackLibraryRow(
+            const QSqlDatabase& database,
+            TrackId trackId,
+            const mixxx::TrackRecord& trackRecord,
+            const mixxx::BeatsPointer& pBeats);
+
     /// Don't use even if public!!! Ugly workaround for C++ visibility restrictions.
     /// This method is invoked by a free function that needs to access
     /// a private Track member that only TrackDAO is allowed to access
@@ -206,6 +237,9 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
 
     const UserSettingsPointer m_pConfig;
 
+    // Write-behind journal for updateTrack(), not owned (may be nullptr)
+    TrackUpdateJournal* m_pUpdateJournal;
+
     std::unique_ptr<QSqlQuery> m_pQueryTrackLocationInsert;
     std::unique_ptr<QSqlQuery> m_pQueryTrackLocationSelect;
     std::unique_ptr<QSqlQuery> m_pQueryLibraryInsert;
@@ -218,6 +252,10 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
 
     QSet<TrackId> m_tracksAddedSet;
 
+    // mutable, because reusing prepared statements is an
+    // implementation detail of logically const queries
+    mutable mixxx::PreparedQueryCache m_preparedQueries;
+
     DISALLOW_COPY_AND_ASSIGN(TrackDAO);
 };
 
@@ -0,0 +1,142 @@
+#include "library/export/librarysnapshotworker.h"
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QSqlQuery>
+
+#include "library/queryutil.h"
+#include "moc_librarysnapshotworker.cpp"
+#include "util/db/dbconnectionpooled.h"
+#include "util/db/dbconnectionpooler.h"
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("LibrarySnapshotWorker");
+
+const QString kDatabaseFileName = QStringLiteral("mixxxdb.sqlite");
+const QString kAnalysisDirName = QStringLiteral("analysis");
+
+} // anonymous namespace
+
+LibrarySnapshotWorker::LibrarySnapshotWorker(
+        mixxx::DbConnectionPoolPtr pDbConnectionPool,
+        const QString& settingsPath,
+        const QString& destDir)
+        : m_pDbConnectionPool(std::move(pDbConnectionPool)),
+          m_settingsPath(settingsPath),
+          m_destDir(destDir) {
+}
+
+void LibrarySnapshotWorker::run() {
+    // Snapshotting competes with the running session for I/O only, not
+    // for the database lock (VACUUM INTO is a reader), so run below the
+    // engine and the GUI.
+    QThread::currentThread()->setPriority(QThread::LowPriority);
+    if (!QDir(m_destDir).mkpath(".")) {
+        m_errorMessage = tr("Could not create export directory %1").arg(m_destDir);
+        return;
+    }
+    if (!snapshotDatabase()) {
+        return;
+    }
+    mirrorAnalysisDir();
+}
+
+void LibrarySnapshotWorker::stop() {
+    m_bStop = true;
+}
+
+bool LibrarySnapshotWorker::snapshotDatabase() {
+    // The pooler limits the lifetime of the thread-local connection,
+    // which is closed again when this function returns.
+    const mixxx::DbConnectionPooler dbConnectionPooler(m_pDbConnectionPool);
+    QSqlDatabase database = mixxx::DbConnectionPooled(m_pDbConnectionPool);
+    VERIFY_OR_DEBUG_ASSERT(database.isOpen()) {
+        m_errorMessage = tr("Could not open the library database");
+        return false;
+    }
+
+    // VACUUM INTO writes a compacted, transactionally consistent copy of
+    // the live database into a new file without blocking the session.
+    // It refuses to overwrite, so write to a temporary name first and
+    // rename over any previous snapshot afterwards.
+    const QDir destDir(m_destDir);
+    const QString dbFilePath = destDir.absoluteFilePath(kDatabaseFileName);
+    const QString tmpFilePath = dbFilePath + QStringLiteral(".tmp");
+    QFile::remove(tmpFilePath);
+
+    emit progress(kDatabaseFileName, 0, 0);
+    QSqlQuery query(database);
+    query.prepare(QStringLiteral("VACUUM INTO :file"));
+    query.bindValue(QStringLiteral(":file"), tmpFilePath);
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query);
+        QFile::remove(tmpFilePath);
+        m_errorMessage = tr("Could not copy the library database to %1").arg(dbFilePath);
+        return false;
+    }
+
+    QFile::remove(dbFilePath);
+    if (!QFile::rename(tmpFilePath, dbFilePath)) {
+        QFile::remove(tmpFilePath);
+        m_errorMessage = tr("Could not copy the library database to %1").arg(dbFilePath);
+        return false;
+    }
+    m_copiedFileCount++;
+    return true;
+}
+
+bool LibrarySnapshotWorker::mirrorAnalysisDir() {
+    const QDir srcDir(QDir(m_settingsPath).absoluteFilePath(kAnalysisDirName));
+    QDir destDir(QDir(m_destDir).absoluteFilePath(kAnalysisDirName));
+    if (!destDir.mkpath(".")) {
+        m_errorMessage = tr("Could not create export directory %1")
+                                 .arg(destDir.absolutePath());
+        return false;
+    }
+
+    // Drop files that no longer exist in the library so that the
+    // destination is an exact mirror. The database snapshot taken above
+    // does not reference them anymore.
+    const QFileInfoList destFiles =
+            destDir.entryInfoList(QDir::Files, QDir::Name);
+    for (const QFileInfo& destFile : destFiles) {
+        if (!srcDir.exists(destFile.fileName())) {
+            QFile::remove(destFile.absoluteFilePath());
+        }
+    }
+
+    const QFileInfoList srcFiles =
+            srcDir.entryInfoList(QDir::Files, QDir::Name);
+    int index = 0;
+    for (const QFileInfo& srcFile : srcFiles) {
+        if (m_bStop.loadAcquire()) {
+            m_errorMessage = tr("Export canceled");
+            return false;
+        }
+        ++index;
+        emit progress(srcFile.fileName(), index, srcFiles.size());
+        const QFileInfo destFile(destDir.absoluteFilePath(srcFile.fileName()));
+        if (destFile.exists() &&
+                destFile.size() == srcFile.size() &&
+                destFile.lastModified() >= srcFile.lastModified()) {
+            // Unchanged since the last export
+            m_skippedFileCount++;
+            continue;
+        }
+        QFile::remove(destFile.absoluteFilePath());
+        if (!QFile::copy(srcFile.absoluteFilePath(),
+                    destFile.absoluteFilePath())) {
+            kLogger.warning()
+                    << "Failed to copy analysis file"
+                    << srcFile.absoluteFilePath();
+            m_errorMessage = tr("Could not copy %1").arg(srcFile.fileName());
+            return false;
+        }
+        m_copiedFileCount++;
+    }
+    return true;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <QString>
+#include <QThread>
+
+#include "util/db/dbconnectionpool.h"
+
+// A QThread that writes a self-contained snapshot of the library into a
+// destination directory: a consistent copy of mixxxdb.sqlite taken with
+// SQLite's VACUUM INTO while Mixxx keeps running, plus a mirror of the
+// analysis blob directory (waveform summaries etc.). Analysis files that
+// are already present at the destination with unchanged size and
+// modification time are skipped, so repeated exports to the same
+// destination only transfer new data.
+//
+// Restoring a snapshot on another machine is a plain file copy into the
+// settings directory while Mixxx is not running. Mixxx neither rescans
+// nor re-analyzes on first start with a copied database; cover art and
+// waveform caches are populated lazily from the copied data.
+class LibrarySnapshotWorker : public QThread {
+    Q_OBJECT
+  public:
+    LibrarySnapshotWorker(
+            mixxx::DbConnectionPoolPtr pDbConnectionPool,
+            const QString& settingsPath,
+            const QString& destDir);
+    ~LibrarySnapshotWorker() override = default;
+
+    void run() override;
+
+    // Requests cancellation after the file that is currently being
+    // copied. May be called from another thread.
+    void stop();
+
+    // Only valid after the thread has finished.
+    QString errorMessage() const {
+        return m_errorMessage;
+    }
+    int copiedFileCount() const {
+        return m_copiedFileCount;
+    }
+    int skippedFileCount() const {
+        return m_skippedFileCount;
+    }
+
+  signals:
+    void progress(const QString& fileName, int index, int count);
+
+  private:
+    bool snapshotDatabase();
+    bool mirrorAnalysisDir();
+
+    QAtomicInt m_bStop = false;
+    QString m_errorMessage;
+    int m_copiedFileCount = 0;
+    int m_skippedFileCount = 0;
+
+    const mixxx::DbConnectionPoolPtr m_pDbConnectionPool;
+    const QString m_settingsPath;
+    const QString m_destDir;
+};
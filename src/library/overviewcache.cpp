@@ -26,6 +26,15 @@ QString pixmapCacheKey(TrackId trackId, QSize size, mixxx::OverviewType type) {
                     QString::number(size.height()));
 }
 
+QString sourceImageCacheKey(TrackId trackId, mixxx::OverviewType type) {
+    return QString("OverviewSource_%1_%2")
+            .arg(QString::number(static_cast<int>(type)),
+                    trackId.toString());
+}
+
+// Budget for the full-resolution source images, in KiB
+constexpr int kSourceImageCacheCostKb = 32 * 1024; // 32 MiB
+
 // The transformation mode when scaling images
 const Qt::TransformationMode kTransformationMode = Qt::SmoothTransformation;
 
@@ -37,7 +46,8 @@ inline QImage resizeImageSize(const QImage& image, QSize size) {
 OverviewCache::OverviewCache(UserSettingsPointer pConfig,
         mixxx::DbConnectionPoolPtr pDbConnectionPool)
         : m_pConfig(pConfig),
-          m_pDbConnectionPool(std::move(pDbConnectionPool)) {
+          m_pDbConnectionPool(std::move(pDbConnectionPool)),
+          m_sourceImages(kSourceImageCacheCostKb) {
 }
 
 void OverviewCache::onTrackAnalysisProgress(TrackId trackId, AnalyzerProgress analyzerProgress) {
@@ -58,6 +68,11 @@ void OverviewCache::onTrackSummaryChanged(TrackId trackId) {
         DEBUG_ASSERT(!cacheKey.isEmpty());
         QPixmapCache::remove(cacheKey);
     }
+    for (const auto type : {mixxx::OverviewType::Filtered,
+                 mixxx::OverviewType::HSV,
+                 mixxx::OverviewType::RGB}) {
+        m_sourceImages.remove(sourceImageCacheKey(trackId, type));
+    }
     // try remove the id from the ignore list
     m_tracksWithoutOverview.remove(trackId);
     // then let users request an update independent from paint events
@@ -117,6 +132,21 @@ QPixmap OverviewCache::requestUncachedOverview(
         return pixmap;
     }
 
+    // If the full-resolution source image is still cached, e.g. when
+    // only the width of the overview column has changed, the strip can
+    // be rescaled right away without reloading the analysis data and
+    // re-rendering on a worker thread.
+    const QImage* pSourceImage =
+            m_sourceImages.object(sourceImageCacheKey(trackId, type));
+    if (pSourceImage && !desiredSize.isEmpty()) {
+        pixmap = QPixmap::fromImage(resizeImageSize(*pSourceImage, desiredSize));
+        if (!pixmap.isNull()) {
+            QPixmapCache::insert(cacheKey, pixmap);
+            m_cacheKeysByTrackId.insert(trackId, cacheKey);
+            return pixmap;
+        }
+    }
+
     // no cached overview, request preparation
     m_currentlyLoading.insert(trackId);
 
@@ -180,6 +210,7 @@ OverviewCache::FutureResult OverviewCache::prepareOverview(
                     signalColors,
                     true /* mono, bottom-aligned */);
 
+            result.sourceImage = image;
             if (!image.isNull()) {
                 image = resizeImageSize(image, desiredSize);
             }
@@ -197,6 +228,15 @@ void OverviewCache::overviewPrepared() {
     watcher->deleteLater();
     // kLogger.warning() << "overviewPrepared" << res.trackId;
 
+    // Keep the unscaled source image around for follow-up requests
+    // with other sizes. QCache takes ownership.
+    if (!res.sourceImage.isNull()) {
+        m_sourceImages.insert(
+                sourceImageCacheKey(res.trackId, res.type),
+                new QImage(res.sourceImage),
+                static_cast<int>(res.sourceImage.sizeInBytes() / 1024) + 1);
+    }
+
     // Create pixmap, GUI thread only
     QPixmap pixmap = QPixmap::fromImage(res.image);
     if (!pixmap.isNull() && !res.resizedToSize.isEmpty()) {
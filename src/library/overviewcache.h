@@ -1,5 +1,7 @@
 #pragma once
 
+#include <QCache>
+#include <QImage>
 #include <QSqlDatabase>
 
 #include "analyzer/analyzerprogress.h"
@@ -36,6 +38,11 @@ class OverviewCache : public QObject, public Singleton<OverviewCache> {
         TrackId trackId;
         mixxx::OverviewType type;
         QImage image;
+        // The rendered overview at full waveform summary resolution,
+        // before scaling to the requested size. Kept in a memory cache
+        // so that later size requests for the same track (e.g. when the
+        // overview column is resized) only need to rescale.
+        QImage sourceImage;
         QSize resizedToSize;
         const QObject* requester;
     };
@@ -74,4 +81,8 @@ class OverviewCache : public QObject, public Singleton<OverviewCache> {
     QSet<TrackId> m_currentlyLoading;
     QSet<TrackId> m_tracksWithoutOverview;
     QMultiHash<TrackId, QString> m_cacheKeysByTrackId;
+    // Full-resolution source images by track and type, cost in KiB.
+    // Scaling one of these is much cheaper than reloading the analysis
+    // data from the database and re-rendering it.
+    QCache<QString, QImage> m_sourceImages;
 };
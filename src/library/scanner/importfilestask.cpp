@@ -1,6 +1,10 @@
 #include "library/scanner/importfilestask.h"
 
 #include "moc_importfilestask.cpp"
+#include "sources/soundsourceproxy.h"
+#include "track/globaltrackcache.h"
+#include "track/track.h"
+#include "util/ioprio.h"
 #include "util/timer.h"
 
 ImportFilesTask::ImportFilesTask(LibraryScanner* pScanner,
@@ -22,6 +26,10 @@ ImportFilesTask::ImportFilesTask(LibraryScanner* pScanner,
 
 void ImportFilesTask::run() {
     ScopedTimer timer(QStringLiteral("ImportFilesTask::run"));
+    // Scanning is batch work that must not delay the chunk reads of
+    // the audible decks at the OS level. Applied per task because the
+    // pool threads are recycled.
+    mixxx::setCurrentThreadIoPriority(mixxx::IoPriorityClass::Idle);
     for (const QFileInfo& fileInfo: m_filesToImport) {
         // If a flag was raised telling us to cancel the library scan then stop.
         if (m_scannerGlobal->shouldCancel()) {
@@ -49,10 +57,51 @@ void ImportFilesTask::run() {
             }
             qDebug() << "Importing track" << trackLocation;
 
-            emit addNewTrack(trackLocation);
+            TrackPointer pTrack = importTrack(fileInfo);
+            if (pTrack) {
+                emit addNewTrack(pTrack);
+            }
         }
     }
     // Insert or update the hash in the database.
     emit directoryHashedAndScanned(m_dirPath, !m_prevHashExists, m_newHash);
     setSuccess(true);
 }
+
+TrackPointer ImportFilesTask::importTrack(const QFileInfo& fileInfo) {
+    const auto fileAccess = mixxx::FileAccess(mixxx::FileInfo(fileInfo), m_pToken);
+    if (!SoundSourceProxy::isFileSupported(fileAccess.info())) {
+        qWarning() << "ImportFilesTask: Unsupported file type"
+                   << fileAccess.info().location();
+        return nullptr;
+    }
+    auto cacheResolver = GlobalTrackCacheResolver(fileAccess);
+    TrackPointer pTrack = cacheResolver.getTrack();
+    if (!pTrack) {
+        // Conflict with another track object referencing the same physical
+        // file. The conflict has already been logged by the cache.
+        return nullptr;
+    }
+    // Unlock the cache before the expensive metadata import. The track id
+    // is only assigned later when the scanner thread inserts the track
+    // into the database (see TrackDAO::addTracksAddFile).
+    cacheResolver.unlockCache();
+    if (pTrack->getId().isValid()) {
+        // The track has already been added to the database.
+        return pTrack;
+    }
+    // Parse the metadata with taglib here on the worker thread. Multiple
+    // directories are imported concurrently and the scanner thread only
+    // has to do the database inserts, which keeps a single slow thread
+    // from serializing the whole scan.
+    SoundSourceProxy(pTrack).updateTrackFromSource(
+            SoundSourceProxy::UpdateTrackFromSourceMode::Once,
+            m_scannerGlobal->syncTrackMetadataParams());
+    if (!pTrack->checkSourceSynchronized()) {
+        qWarning() << "ImportFilesTask: Failed to parse track metadata from file"
+                   << pTrack->getLocation();
+        // Continue with adding the track to the library, no matter
+        // if parsing the metadata from file succeeded or failed.
+    }
+    return pTrack;
+}
@@ -23,6 +23,11 @@ class ImportFilesTask : public ScannerTask {
     virtual void run();
 
   private:
+    // Creates the track object and imports its metadata from the file on
+    // the calling (worker) thread. Returns nullptr if the file cannot be
+    // imported.
+    TrackPointer importTrack(const QFileInfo& fileInfo);
+
     const QString m_dirPath;
     const bool m_prevHashExists;
     const mixxx::cache_key_t m_newHash;
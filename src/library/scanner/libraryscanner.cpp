@@ -20,8 +20,26 @@
 
 namespace {
 
-// TODO(rryan) make configurable
-constexpr int kScannerThreadPoolSize = 1;
+// Upper limit for the automatic thread count. Beyond this the scan is
+// typically bound by the storage or the database inserts on the scanner
+// thread rather than by metadata parsing.
+constexpr int kMaxScannerThreadPoolSize = 8;
+
+// Number of worker threads for directory traversal, hashing and metadata
+// import. All database writes stay serialized on the scanner thread.
+int scannerThreadPoolSize(const UserSettingsPointer& pConfig) {
+    // 0 (the default) picks one thread per core, capped.
+    int numThreads = pConfig
+            ? pConfig->getValue(
+                      ConfigKey(QStringLiteral("[Library]"),
+                              QStringLiteral("ScannerThreadPoolSize")),
+                      0)
+            : 0;
+    if (numThreads <= 0) {
+        numThreads = qMin(QThread::idealThreadCount(), kMaxScannerThreadPoolSize);
+    }
+    return qMax(numThreads, 1);
+}
 
 mixxx::Logger kLogger("LibraryScanner");
 
@@ -99,6 +117,7 @@ LibraryScanner::LibraryScanner(
         mixxx::DbConnectionPoolPtr pDbConnectionPool,
         const UserSettingsPointer& pConfig)
         : m_pDbConnectionPool(std::move(pDbConnectionPool)),
+          m_pConfig(pConfig),
           m_analysisDao(pConfig),
           m_trackDao(m_cueDao, m_playlistDao, m_analysisDao, m_libraryHashDao, pConfig),
           m_stateSema(1), // only one transaction is possible at a time
@@ -112,7 +131,8 @@ LibraryScanner::LibraryScanner(
     const int instanceId = s_instanceCounter.fetchAndAddAcquire(1) + 1;
     setObjectName(QString("LibraryScanner %1").arg(instanceId));
 
-    m_pool.setMaxThreadCount(kScannerThreadPoolSize);
+    m_pool.setMaxThreadCount(scannerThreadPoolSize(pConfig));
+    kLogger.debug() << "Using" << m_pool.maxThreadCount() << "scanner worker thread(s)";
 
     // Listen to signals from our public methods (invoked by other threads) and
     // connect them to our slots to run the command on the scanner thread.
@@ -213,8 +233,12 @@ void LibraryScanner::slotStartScan() {
     m_numRelocatedTracks = 0;
 
     m_scannerGlobal = ScannerGlobalPointer(
-            new ScannerGlobal(trackLocations, directoryHashes, extensionFilter,
-                              coverExtensionFilter, directoryBlacklist));
+            new ScannerGlobal(trackLocations,
+                    directoryHashes,
+                    extensionFilter,
+                    coverExtensionFilter,
+                    directoryBlacklist,
+                    SyncTrackMetadataParams::readFromUserSettings(*m_pConfig)));
 
     m_scannerGlobal->startTimer();
 
@@ -627,8 +651,8 @@ void LibraryScanner::slotTrackExists(const QString& trackPath) {
 }
 
 // triggered by ScannerTask::addNewTrack / in ImportFilesTask::run()
-void LibraryScanner::slotAddNewTrack(const QString& trackPath) {
-    // kLogger.debug() << "slotAddNewTrack" << trackPath;
+void LibraryScanner::slotAddNewTrack(TrackPointer pImportedTrack) {
+    // kLogger.debug() << "slotAddNewTrack" << pImportedTrack;
     if (!m_scannerGlobal || m_scannerGlobal->shouldCancel()) {
         // Fix/workaround for Cancel not cancelling the entire scan process
         // https://github.com/mixxxdj/mixxx/issues/14940
@@ -641,9 +665,16 @@ void LibraryScanner::slotAddNewTrack(const QString& trackPath) {
         return;
     }
     ScopedTimer timer(QStringLiteral("LibraryScanner::addNewTrack"));
-    // For statistics tracking and to detect moved tracks
+    VERIFY_OR_DEBUG_ASSERT(pImportedTrack) {
+        return;
+    }
+    // For statistics tracking and to detect moved tracks.
+    // The metadata of the track has already been imported by the worker
+    // thread (see ImportFilesTask::importTrack) and the track object is
+    // kept alive by pImportedTrack, so the cache lookup hits and only the
+    // database insert remains to be done here.
     TrackPointer pTrack = m_trackDao.addTracksAddFile(
-            trackPath,
+            pImportedTrack->getLocation(),
             false);
     if (!pTrack) {
         // This happens only when there is an issue with the database which
@@ -74,7 +74,7 @@ class LibraryScanner : public QThread {
                                    bool newDirectory, mixxx::cache_key_t hash);
     void slotDirectoryUnchanged(const QString& directoryPath);
     void slotTrackExists(const QString& trackPath);
-    void slotAddNewTrack(const QString& trackPath);
+    void slotAddNewTrack(TrackPointer pImportedTrack);
 
   private:
     enum ScannerState {
@@ -102,6 +102,8 @@ class LibraryScanner : public QThread {
 
     mixxx::DbConnectionPoolPtr m_pDbConnectionPool;
 
+    const UserSettingsPointer m_pConfig;
+
     // The pool of threads used for worker tasks.
     QThreadPool m_pool;
 
@@ -7,6 +7,7 @@
 #include "library/scanner/importfilestask.h"
 #include "library/scanner/libraryscanner.h"
 #include "moc_recursivescandirectorytask.cpp"
+#include "util/ioprio.h"
 #include "util/timer.h"
 
 RecursiveScanDirectoryTask::RecursiveScanDirectoryTask(
@@ -21,6 +22,10 @@ RecursiveScanDirectoryTask::RecursiveScanDirectoryTask(
 
 void RecursiveScanDirectoryTask::run() {
     ScopedTimer timer(QStringLiteral("RecursiveScanDirectoryTask::run"));
+    // Scanning is batch work that must not delay the chunk reads of
+    // the audible decks at the OS level. Applied per task because the
+    // pool threads are recycled.
+    mixxx::setCurrentThreadIoPriority(mixxx::IoPriorityClass::Idle);
     if (m_scannerGlobal->shouldCancel()) {
         setSuccess(false);
         return;
@@ -8,6 +8,7 @@
 #include <QSharedPointer>
 #include <QStringList>
 
+#include "track/track_decl.h"
 #include "util/cache.h"
 #include "util/compatibility/qmutex.h"
 #include "util/fileaccess.h"
@@ -20,12 +21,14 @@ class ScannerGlobal {
             const QHash<QString, mixxx::cache_key_t>& directoryHashes,
             const QRegularExpression& supportedExtensionsMatcher,
             const QRegularExpression& supportedCoverExtensionsMatcher,
-            const QStringList& directoriesBlacklist)
+            const QStringList& directoriesBlacklist,
+            const SyncTrackMetadataParams& syncTrackMetadataParams)
             : m_trackLocations(trackLocations),
               m_directoryHashes(directoryHashes),
               m_supportedExtensionsMatcher(supportedExtensionsMatcher),
               m_supportedCoverExtensionsMatcher(supportedCoverExtensionsMatcher),
               m_directoriesBlacklist(directoriesBlacklist),
+              m_syncTrackMetadataParams(syncTrackMetadataParams),
               // Unless marked un-clean, we assume it will finish cleanly.
               m_scanFinishedCleanly(true),
               m_shouldCancel(false),
@@ -88,6 +91,12 @@ class ScannerGlobal {
         return m_supportedCoverExtensionsMatcher;
     }
 
+    // Used by ImportFilesTask to import track metadata on the worker
+    // threads instead of the scanner thread.
+    const SyncTrackMetadataParams& syncTrackMetadataParams() const {
+        return m_syncTrackMetadataParams;
+    }
+
     // TODO(rryan) test whether tasks should create their own QRegularExpression.
     bool isCoverFileSupported(const QString& fileName) const {
         const auto locker = lockMutex(&m_supportedCoverExtensionsMatcherMutex);
@@ -190,6 +199,8 @@ class ScannerGlobal {
     // this has never been investigated.
     QStringList m_directoriesBlacklist;
 
+    const SyncTrackMetadataParams m_syncTrackMetadataParams;
+
     // The list of directories verified by the scan.
     QStringList m_verifiedDirectories;
 
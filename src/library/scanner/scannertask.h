@@ -4,6 +4,7 @@
 #include <QRunnable>
 
 #include "library/scanner/scannerglobal.h"
+#include "track/track_decl.h"
 
 class LibraryScanner;
 
@@ -23,7 +24,10 @@ class ScannerTask : public QObject, public QRunnable {
                                    bool newDirectory, mixxx::cache_key_t hash);
     void directoryUnchanged(const QString& directoryPath);
     void trackExists(const QString& filePath);
-    void addNewTrack(const QString& filePath);
+    // The track object has been created and its metadata has already been
+    // imported on the worker thread. The receiver only has to insert it
+    // into the database.
+    void addNewTrack(TrackPointer pTrack);
 
     // Feedback to GUI
     void progressLoading(const QString& fileName);
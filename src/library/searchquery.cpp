@@ -3,6 +3,7 @@
 #include <QLocale>
 #include <QRegularExpression>
 
+#include "library/dao/searchindexdao.h"
 #include "library/dao/trackschema.h"
 #include "library/queryutil.h"
 #include "library/trackset/crate/crateschema.h"
@@ -229,6 +230,42 @@ QString TextFilterNode::toSql() const {
     return concatSqlClauses(searchClauses, "OR");
 }
 
+QString FtsTextFilterNode::toSql() const {
+    FieldEscaper escaper(m_database);
+    QStringList indexedQueryColumns;
+    QStringList searchClauses;
+    for (const auto& sqlColumn : m_sqlColumns) {
+        if (SearchIndexDAO::indexedColumns().contains(sqlColumn)) {
+            indexedQueryColumns << sqlColumn;
+        } else {
+            // Not covered by the index, e.g. the file location which lives
+            // in track_locations. Fall back to the LIKE filter for this
+            // column only.
+            searchClauses << QString("%1 LIKE %2")
+                                     .arg(sqlColumn,
+                                             escaper.escapeString(kSqlLikeMatchAll +
+                                                     m_argument + kSqlLikeMatchAll));
+        }
+    }
+    if (!indexedQueryColumns.isEmpty()) {
+        // Restrict the match to the configured search columns and match the
+        // term as a token prefix. Double quotes turn the term into an FTS5
+        // string literal, so user input cannot inject query syntax; embedded
+        // double quotes are escaped by doubling them.
+        QString matchTerm = m_argument;
+        matchTerm.replace(QChar('"'), QStringLiteral("\"\""));
+        const QString matchExpression = QStringLiteral("{%1}: \"%2\"*")
+                                                .arg(indexedQueryColumns.join(
+                                                             QChar(' ')),
+                                                        matchTerm);
+        searchClauses.prepend(
+                QStringLiteral("id IN (SELECT rowid FROM %1 WHERE %1 MATCH %2)")
+                        .arg(SearchIndexDAO::kTableName,
+                                escaper.escapeString(matchExpression)));
+    }
+    return concatSqlClauses(searchClauses, "OR");
+}
+
 bool NullOrEmptyTextFilterNode::match(const TrackPointer& pTrack) const {
     if (!m_sqlColumns.isEmpty()) {
         // only use the major column
@@ -252,23 +289,17 @@ QString NullOrEmptyTextFilterNode::toSql() const {
 CrateFilterNode::CrateFilterNode(const CrateStorage* pCrateStorage,
         const QString& crateNameLike)
         : m_pCrateStorage(pCrateStorage),
-          m_crateNameLike(crateNameLike),
-          m_matchInitialized(false) {
+          m_crateNameLike(crateNameLike) {
 }
 
 bool CrateFilterNode::match(const TrackPointer& pTrack) const {
-    if (!m_matchInitialized) {
-        CrateTrackSelectResult crateTracks(
-                m_pCrateStorage->selectTracksSortedByCrateNameLike(m_crateNameLike));
-
-        while (crateTracks.next()) {
-            m_matchingTrackIds.push_back(crateTracks.trackId());
-        }
-
-        m_matchInitialized = true;
-    }
-
-    return std::binary_search(m_matchingTrackIds.begin(), m_matchingTrackIds.end(), pTrack->getId());
+    // The sorted track ids are cached by the storage and shared between
+    // all filter nodes for the same pattern, so repeated searches don't
+    // join through the crate_tracks table again.
+    const std::vector<TrackId>& matchingTrackIds =
+            m_pCrateStorage->sortedTrackIdsByCrateNameLike(m_crateNameLike);
+    return std::binary_search(
+            matchingTrackIds.begin(), matchingTrackIds.end(), pTrack->getId());
 }
 
 QString CrateFilterNode::toSql() const {
@@ -278,23 +309,14 @@ QString CrateFilterNode::toSql() const {
 }
 
 NoCrateFilterNode::NoCrateFilterNode(const CrateStorage* pCrateStorage)
-        : m_pCrateStorage(pCrateStorage),
-          m_matchInitialized(false) {
+        : m_pCrateStorage(pCrateStorage) {
 }
 
 bool NoCrateFilterNode::match(const TrackPointer& pTrack) const {
-    if (!m_matchInitialized) {
-        TrackSelectResult tracks(
-                m_pCrateStorage->selectAllTracksSorted());
-
-        while (tracks.next()) {
-            m_matchingTrackIds.push_back(tracks.trackId());
-        }
-
-        m_matchInitialized = true;
-    }
-
-    return !std::binary_search(m_matchingTrackIds.begin(), m_matchingTrackIds.end(), pTrack->getId());
+    const std::vector<TrackId>& trackIdsWithCrate =
+            m_pCrateStorage->sortedTrackIdsWithCrate();
+    return !std::binary_search(
+            trackIdsWithCrate.begin(), trackIdsWithCrate.end(), pTrack->getId());
 }
 
 QString NoCrateFilterNode::toSql() const {
@@ -86,13 +86,30 @@ class TextFilterNode : public QueryNode {
     bool match(const TrackPointer& pTrack) const override;
     QString toSql() const override;
 
-  private:
+  protected:
     QSqlDatabase m_database;
     QStringList m_sqlColumns;
     QString m_argument;
     StringMatch m_matchMode;
 };
 
+/// Matches a single untagged search term against the persistent FTS5 track
+/// search index (see SearchIndexDAO) instead of LIKE-scanning every text
+/// column of the library table. The term is matched as a token prefix,
+/// which the index answers without a table scan. Columns that are not
+/// covered by the index (currently only the file location) keep the legacy
+/// LIKE filter and are OR-ed into the result.
+class FtsTextFilterNode : public TextFilterNode {
+  public:
+    FtsTextFilterNode(const QSqlDatabase& database,
+            const QStringList& sqlColumns,
+            const QString& argument)
+            : TextFilterNode(database, sqlColumns, argument) {
+    }
+
+    QString toSql() const override;
+};
+
 class NullOrEmptyTextFilterNode : public QueryNode {
   public:
     NullOrEmptyTextFilterNode(const QSqlDatabase& database,
@@ -120,8 +137,6 @@ class CrateFilterNode : public QueryNode {
   private:
     const CrateStorage* m_pCrateStorage;
     QString m_crateNameLike;
-    mutable bool m_matchInitialized;
-    mutable std::vector<TrackId> m_matchingTrackIds;
 };
 
 class NoCrateFilterNode : public QueryNode {
@@ -133,9 +148,6 @@ class NoCrateFilterNode : public QueryNode {
 
   private:
     const CrateStorage* m_pCrateStorage;
-    QString m_crateNameLike;
-    mutable bool m_matchInitialized;
-    mutable std::vector<TrackId> m_matchingTrackIds;
 };
 
 class NumericFilterNode : public QueryNode {
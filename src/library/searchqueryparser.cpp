@@ -302,12 +302,10 @@ void SearchQueryParser::parseTokens(QStringList tokens,
                     auto gNode = std::make_unique<OrNode>();
                     gNode->addNode(std::make_unique<CrateFilterNode>(
                                     &m_pTrackCollection->crates(), argument));
-                    gNode->addNode(std::make_unique<TextFilterNode>(
-                            m_pTrackCollection->database(), m_queryColumns, argument));
+                    gNode->addNode(makeTextFilterNode(argument));
                     pNode = std::move(gNode);
                 } else {
-                    pNode = std::make_unique<TextFilterNode>(
-                            m_pTrackCollection->database(), m_queryColumns, argument);
+                    pNode = makeTextFilterNode(argument);
                 }
             }
         }
@@ -320,6 +318,16 @@ void SearchQueryParser::parseTokens(QStringList tokens,
     }
 }
 
+std::unique_ptr<QueryNode> SearchQueryParser::makeTextFilterNode(
+        const QString& argument) const {
+    if (m_pTrackCollection->getSearchIndexDAO().isEnabled()) {
+        return std::make_unique<FtsTextFilterNode>(
+                m_pTrackCollection->database(), m_queryColumns, argument);
+    }
+    return std::make_unique<TextFilterNode>(
+            m_pTrackCollection->database(), m_queryColumns, argument);
+}
+
 std::unique_ptr<AndNode> SearchQueryParser::parseAndNode(const QString& query) const {
     auto pQuery = std::make_unique<AndNode>();
 
@@ -373,6 +381,36 @@ QStringList SearchQueryParser::splitQueryIntoWords(const QString& query) {
     return queryWordList;
 }
 
+// static
+bool SearchQueryParser::queryStrictlyNarrows(
+        const QString& previous, const QString& next) {
+    if (previous.trimmed().isEmpty() || !next.startsWith(previous)) {
+        return false;
+    }
+    const QStringList newWordList = splitQueryIntoWords(next);
+    for (const QString& word : newWordList) {
+        // Only plain positive text terms provably narrow when extended
+        // or appended: both the LIKE and the FTS path match them as
+        // "contains"/"token prefix", so a longer term or an additional
+        // term can only shrink the result set. Everything else may
+        // widen or change it: extending a negated term excludes fewer
+        // tracks, numeric field filters match exactly (bpm:12 vs.
+        // bpm:124), and quotes and OR operators change term boundaries.
+        if (word.startsWith(QChar('-')) ||
+                word.contains(QChar(':')) ||
+                word.contains(QChar('"')) ||
+                word.contains(QChar('~')) ||
+                word.contains(QChar('|')) ||
+                word.contains(QChar('<')) ||
+                word.contains(QChar('>')) ||
+                word.contains(QChar('=')) ||
+                word == QStringLiteral("OR")) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool SearchQueryParser::queryIsLessSpecific(const QString& original, const QString& changed) {
     // separate search query into tokens
     QStringList oldWordList = SearchQueryParser::splitQueryIntoWords(original);
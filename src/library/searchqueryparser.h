@@ -25,6 +25,15 @@ class SearchQueryParser {
     static QStringList splitQueryIntoWords(const QString& query);
     /// checks if the changed search query is less specific then the original term
     static bool queryIsLessSpecific(const QString& original, const QString& changed);
+    /// Conservatively checks whether every track matched by the next
+    /// query is also matched by the previous one, i.e. whether the next
+    /// query only narrows the previous result set. This is the common
+    /// search-as-you-type case and allows re-filtering the previous
+    /// results instead of the whole library. Returns false whenever
+    /// narrowing cannot be proven, e.g. for negated terms (extending
+    /// those widens the result set), field filters with exact matching,
+    /// quoted phrases or OR operators.
+    static bool queryStrictlyNarrows(const QString& previous, const QString& next);
 
   private:
     void parseTokens(QStringList tokens,
@@ -42,6 +51,11 @@ class SearchQueryParser {
             QStringList* tokens,
             bool removeLeadingEqualsSign = true) const;
 
+    /// Creates the filter node for an untagged search term. Uses the FTS5
+    /// search index when available, otherwise falls back to LIKE filters
+    /// over all search columns.
+    std::unique_ptr<QueryNode> makeTextFilterNode(const QString& argument) const;
+
     TrackCollection* m_pTrackCollection;
     QStringList m_queryColumns;
     bool m_searchCrates;
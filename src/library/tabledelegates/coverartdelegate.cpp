@@ -16,6 +16,11 @@ namespace {
 
 const mixxx::Logger kLogger("CoverArtDelegate");
 
+// Number of off-screen rows above and below the visible range whose covers
+// are prefetched once scrolling pauses. While the user scrolls in one
+// direction most of the budget is shifted towards that direction.
+constexpr int kPrefetchRowMargin = 32;
+
 inline TrackModel* asTrackModel(
         QTableView* pTableView) {
     auto* pTrackModel =
@@ -31,7 +36,8 @@ CoverArtDelegate::CoverArtDelegate(QTableView* parent)
           m_pTrackModel(asTrackModel(parent)),
           m_pCache(CoverArtCache::instance()),
           m_inhibitLazyLoading(false),
-          m_column(m_pTrackModel->fieldIndex(LIBRARYTABLE_COVERART)) {
+          m_column(m_pTrackModel->fieldIndex(LIBRARYTABLE_COVERART)),
+          m_lastPrefetchFirstRow(-1) {
     if (m_pCache) {
         connect(m_pCache,
                 &CoverArtCache::coverFound,
@@ -43,6 +49,14 @@ CoverArtDelegate::CoverArtDelegate(QTableView* parent)
     }
 }
 
+CoverArtDelegate::~CoverArtDelegate() {
+    if (m_pCache) {
+        // Results for requests that are still in flight, e.g. after
+        // switching to another library view, are of no use anymore.
+        CoverArtCache::cancelRequests(this);
+    }
+}
+
 void CoverArtDelegate::emitRowsChanged(
         QList<int>&& rows) {
     if (rows.isEmpty()) {
@@ -81,7 +95,16 @@ void CoverArtDelegate::requestUncachedCover(
 void CoverArtDelegate::slotInhibitLazyLoading(
         bool inhibitLazyLoading) {
     m_inhibitLazyLoading = inhibitLazyLoading;
-    if (m_inhibitLazyLoading || m_cacheMissRows.isEmpty()) {
+    if (m_inhibitLazyLoading) {
+        // The user started scrolling fast. Results for covers requested
+        // so far would mostly arrive for rows that have been scrolled
+        // past, so cancel them immediately. Rows that are still visible
+        // when scrolling pauses are re-requested via m_cacheMissRows
+        // below.
+        if (m_pCache && !m_pendingCacheRows.isEmpty()) {
+            CoverArtCache::cancelRequests(this);
+            m_pendingCacheRows.clear();
+        }
         return;
     }
     VERIFY_OR_DEBUG_ASSERT(m_pTrackModel) {
@@ -99,6 +122,57 @@ void CoverArtDelegate::slotInhibitLazyLoading(
         }
     }
     m_cacheMissRows.clear();
+
+    // Warm the caches for the rows just outside the visible range, so
+    // that covers are already decoded when the user continues scrolling.
+    prefetchAroundVisibleRange(width);
+}
+
+void CoverArtDelegate::prefetchAroundVisibleRange(int width) const {
+    const QAbstractItemModel* pModel = m_pTableView->model();
+    VERIFY_OR_DEBUG_ASSERT(pModel) {
+        return;
+    }
+    const int rowCount = pModel->rowCount();
+    if (rowCount <= 0) {
+        return;
+    }
+    const int firstVisibleRow = qMax(0, m_pTableView->rowAt(0));
+    int lastVisibleRow = m_pTableView->rowAt(
+            m_pTableView->viewport()->height() - 1);
+    if (lastVisibleRow < 0) {
+        // The table does not fill the viewport.
+        lastVisibleRow = rowCount - 1;
+    }
+    // Bias the prefetch window towards the scroll direction, i.e. spend
+    // most of the budget on the rows the user is about to reveal.
+    int marginAbove = kPrefetchRowMargin;
+    int marginBelow = kPrefetchRowMargin;
+    if (m_lastPrefetchFirstRow >= 0) {
+        if (firstVisibleRow > m_lastPrefetchFirstRow) {
+            // Scrolling down
+            marginAbove = kPrefetchRowMargin / 4;
+            marginBelow = 2 * kPrefetchRowMargin - marginAbove;
+        } else if (firstVisibleRow < m_lastPrefetchFirstRow) {
+            // Scrolling up
+            marginBelow = kPrefetchRowMargin / 4;
+            marginAbove = 2 * kPrefetchRowMargin - marginBelow;
+        }
+    }
+    m_lastPrefetchFirstRow = firstVisibleRow;
+    const int firstRow = qMax(0, firstVisibleRow - marginAbove);
+    const int lastRow = qMin(rowCount - 1, lastVisibleRow + marginBelow);
+    QList<CoverInfo> coverInfos;
+    coverInfos.reserve(lastRow - firstRow + 1);
+    for (int row = firstRow; row <= lastRow; ++row) {
+        if (row >= firstVisibleRow && row <= lastVisibleRow) {
+            // Visible rows are requested by paintItem() as needed.
+            continue;
+        }
+        coverInfos.append(m_pTrackModel->getCoverInfo(
+                pModel->index(row, m_column)));
+    }
+    CoverArtCache::prefetchCovers(this, coverInfos, width);
 }
 
 void CoverArtDelegate::slotCoverFound(
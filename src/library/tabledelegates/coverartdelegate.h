@@ -17,7 +17,7 @@ class CoverArtDelegate : public TableItemDelegate {
   public:
     explicit CoverArtDelegate(
             QTableView* parent);
-    ~CoverArtDelegate() override = default;
+    ~CoverArtDelegate() override;
 
     void paintItem(
             QPainter* painter,
@@ -56,6 +56,9 @@ class CoverArtDelegate : public TableItemDelegate {
     void emitRowsChanged(
             QList<int>&& rows);
     void cleanCacheMissRows() const;
+    // Batch-prefetch covers for the rows just above and below the
+    // currently visible range into the caches.
+    void prefetchAroundVisibleRange(int width) const;
     void requestUncachedCover(
             const CoverInfo& coverInfo,
             int width,
@@ -69,4 +72,8 @@ class CoverArtDelegate : public TableItemDelegate {
     // these are marked mutable.
     mutable QSet<int> m_cacheMissRows;
     mutable QMultiHash<mixxx::cache_key_t, int> m_pendingCacheRows;
+
+    // First visible row of the previous prefetch, used to detect the
+    // scroll direction. -1 until the first prefetch happened.
+    mutable int m_lastPrefetchFirstRow;
 };
@@ -77,6 +77,7 @@ void TrackCollection::connectDatabase(const QSqlDatabase& database) {
     m_directoryDao.initialize(database);
     m_analysisDao.initialize(database);
     m_libraryHashDao.initialize(database);
+    m_searchIndexDao.initialize(database);
     m_crates.connectDatabase(database);
 }
 
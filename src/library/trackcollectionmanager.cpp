@@ -1,5 +1,7 @@
 #include "library/trackcollectionmanager.h"
 
+#include <QCoreApplication>
+
 #include <utility>
 
 #include "library/externaltrackcollection.h"
@@ -7,6 +9,8 @@
 #include "library/library_prefs.h"
 #include "library/scanner/libraryscanner.h"
 #include "library/trackcollection.h"
+#include "library/trackmetadataexporter.h"
+#include "library/trackupdatejournal.h"
 #include "moc_trackcollectionmanager.cpp"
 #include "sources/soundsourceproxy.h"
 #include "track/track.h"
@@ -67,6 +71,58 @@ TrackCollectionManager::TrackCollectionManager(
         externalCollection->establishConnection();
     }
 
+    if (deleteTrackForTestingFn) {
+        // Keep saving of evicted tracks synchronous in tests
+        kLogger.info() << "Track update journal is disabled in test mode";
+    } else {
+        m_pUpdateJournal = std::make_unique<TrackUpdateJournal>(pDbConnectionPool, pConfig);
+
+        // Refresh the track table models after journaled updates have
+        // been committed to the database on the journal thread.
+        connect(m_pUpdateJournal.get(),
+                &TrackUpdateJournal::tracksUpdated,
+                &(m_pInternalCollection->getTrackDAO()),
+                &TrackDAO::slotDatabaseTracksChanged);
+
+        kLogger.info() << "Starting track update journal thread";
+        m_pUpdateJournal->start();
+        m_pInternalCollection->getTrackDAO().setUpdateJournal(m_pUpdateJournal.get());
+    }
+
+    if (deleteTrackForTestingFn) {
+        // Keep the metadata export of evicted tracks synchronous in tests
+        kLogger.info() << "Parallel track metadata export is disabled in test mode";
+    } else {
+        m_pMetadataExporter = std::make_unique<TrackMetadataExporter>();
+
+        // NOTE: The receiver's thread context `this` is required to ensure
+        // that the results emitted from the worker threads are handled
+        // within the receiver's event loop thread!
+        connect(m_pMetadataExporter.get(),
+                &TrackMetadataExporter::exportSucceeded,
+                /*receiver thread context*/ this,
+                [this](TrackId trackId, const QDateTime& sourceSynchronizedAt) {
+                    // Record that the file tags and the track's metadata
+                    // are in sync now. The track object that triggered the
+                    // export has already been destroyed, so the time stamp
+                    // is written directly into the database.
+                    m_pInternalCollection->getTrackDAO().updateSourceSynchronizedAt(
+                            trackId, sourceSynchronizedAt);
+                });
+        connect(m_pMetadataExporter.get(),
+                &TrackMetadataExporter::exportFailed,
+                /*receiver thread context*/ this,
+                [](TrackId trackId) {
+                    // The file has been left unmodified, so the existing
+                    // synchronization time stamp in the database remains
+                    // valid.
+                    kLogger.warning()
+                            << "Failed to export track metadata of track"
+                            << trackId
+                            << "into file tags";
+                });
+    }
+
     // TODO: Extract and decouple LibraryScanner from TrackCollectionManager
     if (deleteTrackForTestingFn) {
         // Exclude the library scanner from tests
@@ -157,6 +213,27 @@ TrackCollectionManager::~TrackCollectionManager() {
     // components are accessing those files at this point.
     GlobalTrackCacheLocker().deactivateCache();
 
+    if (m_pMetadataExporter) {
+        // Wait until all pending file writes have finished, including
+        // those scheduled while evicting the cached tracks above.
+        kLogger.info() << "Finishing pending track metadata exports";
+        m_pMetadataExporter.reset();
+        // Deliver the queued results of the finished exports to update
+        // the synchronization time stamps in the database before the
+        // connection is closed.
+        QCoreApplication::sendPostedEvents(this);
+    }
+
+    if (m_pUpdateJournal) {
+        // Flush barrier: All updates journaled while evicting the
+        // cached tracks must be committed before the database
+        // connection is closed.
+        kLogger.info() << "Flushing track update journal";
+        m_pInternalCollection->getTrackDAO().setUpdateJournal(nullptr);
+        m_pUpdateJournal->stop();
+        m_pUpdateJournal.reset();
+    }
+
     for (const auto& externalCollection : std::as_const(m_externalCollections)) {
         kLogger.info()
                 << "Disconnecting from"
@@ -317,10 +394,38 @@ ExportTrackMetadataResult TrackCollectionManager::exportTrackMetadataBeforeSavin
                                     .toInt() == 1)) {
         switch (mode) {
         case TrackMetadataExportMode::Immediate: {
-            // Export track metadata now by saving as file tags.
-            const auto result = SoundSourceProxy::exportTrackMetadataBeforeSaving(
-                    pTrack,
-                    SyncTrackMetadataParams::readFromUserSettings(*m_pConfig));
+            const auto syncParams =
+                    SyncTrackMetadataParams::readFromUserSettings(*m_pConfig);
+            ExportTrackMetadataResult result;
+            if (m_pMetadataExporter) {
+                // Only decide which tags need to be written here and hand
+                // the actual file write over to the bounded worker pool.
+                // The track object is about to be destroyed, so no other
+                // component is accessing the file. The synchronization
+                // time stamp in the database is updated after the write
+                // has finished.
+                mixxx::SoundSourcePointer pExportSource;
+                mixxx::TrackMetadata exportMetadata;
+                result = SoundSourceProxy::prepareTrackMetadataExport(
+                        pTrack,
+                        syncParams,
+                        &pExportSource,
+                        &exportMetadata);
+                if (result == ExportTrackMetadataResult::Succeeded) {
+                    m_pMetadataExporter->exportMetadataAsync(
+                            pTrack->getId(),
+                            std::move(pExportSource),
+                            std::move(exportMetadata));
+                    // The new synchronization time stamp is unknown until
+                    // the pending write has finished
+                    return ExportTrackMetadataResult::Skipped;
+                }
+            } else {
+                // Export track metadata now by saving as file tags.
+                result = SoundSourceProxy::exportTrackMetadataBeforeSaving(
+                        pTrack,
+                        syncParams);
+            }
             if (result == ExportTrackMetadataResult::Failed) {
                 const auto fileInfo = pTrack->getFileInfo();
                 if (fileInfo.checkFileExists()) {
@@ -14,6 +14,8 @@
 
 class LibraryScanner;
 class TrackCollection;
+class TrackMetadataExporter;
+class TrackUpdateJournal;
 class ExternalTrackCollection;
 class RelocatedTrack;
 struct LibraryScanResultSummary;
@@ -133,6 +135,15 @@ class TrackCollectionManager: public QObject,
 
     QList<ExternalTrackCollection*> m_externalCollections;
 
+    // Write-behind journal for track metadata updates of the
+    // internal collection
+    std::unique_ptr<TrackUpdateJournal> m_pUpdateJournal;
+
+    // Writes the file tags of evicted tracks on a bounded pool of
+    // worker threads. If absent (in test mode) evicted tracks are
+    // exported synchronously.
+    std::unique_ptr<TrackMetadataExporter> m_pMetadataExporter;
+
     // TODO: Extract and decouple LibraryScanner from TrackCollectionManager
     std::unique_ptr<LibraryScanner> m_pScanner;
 };
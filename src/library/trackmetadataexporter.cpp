@@ -0,0 +1,61 @@
+#include "library/trackmetadataexporter.h"
+
+#include "moc_trackmetadataexporter.cpp"
+#include "util/assert.h"
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("TrackMetadataExporter");
+
+// Bounded to keep bulk exports from saturating the storage device
+// and starving concurrent file access, e.g. streaming of the audio
+// files that are loaded into decks. Spinning disks and network
+// shares already profit from a few requests in flight while fast
+// SSDs could sustain many more, but writing tags is not worth the
+// additional I/O pressure.
+constexpr int kMaxConcurrentExports = 4;
+
+} // anonymous namespace
+
+TrackMetadataExporter::TrackMetadataExporter(QObject* parent)
+        : QObject(parent) {
+    m_workerPool.setMaxThreadCount(kMaxConcurrentExports);
+}
+
+TrackMetadataExporter::~TrackMetadataExporter() {
+    // Finish all pending file writes before shutting down. Results
+    // that arrive after the event loop has stopped are lost, i.e.
+    // the affected tracks remain marked as unsynchronized in the
+    // database and their metadata will be synchronized again when
+    // they are loaded the next time.
+    m_workerPool.waitForDone();
+}
+
+void TrackMetadataExporter::exportMetadataAsync(
+        TrackId trackId,
+        mixxx::SoundSourcePointer pMetadataSource,
+        mixxx::TrackMetadata trackMetadata) {
+    DEBUG_ASSERT(pMetadataSource);
+    if (kLogger.debugEnabled()) {
+        kLogger.debug()
+                << "Scheduling export of track metadata into file"
+                << pMetadataSource->getUrl();
+    }
+    m_workerPool.start([this, trackId, pMetadataSource, trackMetadata] {
+        const auto exported =
+                pMetadataSource->exportTrackMetadata(trackMetadata);
+        switch (exported.first) {
+        case mixxx::MetadataSource::ExportResult::Succeeded:
+            emit exportSucceeded(trackId, exported.second);
+            break;
+        case mixxx::MetadataSource::ExportResult::Failed:
+            emit exportFailed(trackId);
+            break;
+        case mixxx::MetadataSource::ExportResult::Unsupported:
+            // Unsupported file types don't affect the synchronization
+            // time stamp in the database
+            break;
+        }
+    });
+}
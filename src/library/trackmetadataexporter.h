@@ -0,0 +1,51 @@
+#pragma once
+
+#include <QDateTime>
+#include <QObject>
+#include <QThreadPool>
+
+#include "sources/soundsource.h"
+#include "track/trackid.h"
+#include "track/trackmetadata.h"
+
+/// Writes prepared track metadata into file tags on a bounded pool
+/// of worker threads.
+///
+/// Exporting file tags after a bulk re-tag session previously blocked
+/// the thread of the TrackCollectionManager with one file write per
+/// evicted track. The writes for distinct files are independent of
+/// each other, so they can safely be performed concurrently as long
+/// as the corresponding track objects have already been destroyed.
+///
+/// Each write is still performed crash-safely by cloning the original
+/// file and replacing it atomically after the tags have been saved
+/// (see SafelyWritableFile).
+class TrackMetadataExporter : public QObject {
+    Q_OBJECT
+
+  public:
+    explicit TrackMetadataExporter(QObject* parent = nullptr);
+    ~TrackMetadataExporter() override;
+
+    /// Schedules writing of the prepared and normalized metadata into
+    /// the file tags of the corresponding sound source.
+    ///
+    /// Must only be invoked after all other references to the track
+    /// object have been dropped, i.e. from the eviction callback of
+    /// the GlobalTrackCache. The track id may be invalid if the track
+    /// has already been purged from the library.
+    void exportMetadataAsync(
+            TrackId trackId,
+            mixxx::SoundSourcePointer pMetadataSource,
+            mixxx::TrackMetadata trackMetadata);
+
+  signals:
+    /// Emitted from a worker thread after the file tags have been
+    /// written successfully. Receivers on other threads are invoked
+    /// through a queued connection.
+    void exportSucceeded(TrackId trackId, const QDateTime& sourceSynchronizedAt);
+    void exportFailed(TrackId trackId);
+
+  private:
+    QThreadPool m_workerPool;
+};
@@ -0,0 +1,90 @@
+#include "library/trackprefetcher.h"
+
+#include <QRunnable>
+#include <QThreadPool>
+
+#include <mutex>
+
+#include "sources/soundsourceproxy.h"
+#include "track/track.h"
+#include "util/logger.h"
+#include "util/math.h"
+#include "util/samplebuffer.h"
+
+namespace mixxx {
+
+namespace {
+
+const Logger kLogger("TrackPrefetcher");
+
+// Decoding the first seconds of the track warms both the page cache and
+// any per-file caches of the decoder. A deck load only needs the first
+// chunks to start playing, everything beyond that is read while the
+// track is already audible.
+constexpr SINT kPrefetchSeconds = 2;
+
+std::mutex s_lastRequestedMutex;
+TrackId s_lastRequestedTrackId;
+
+class PrefetchTask : public QRunnable {
+  public:
+    explicit PrefetchTask(TrackPointer pTrack)
+            : m_pTrack(std::move(pTrack)) {
+    }
+
+    void run() override {
+        const AudioSource::OpenParams openParams;
+        const AudioSourcePointer pAudioSource =
+                SoundSourceProxy(m_pTrack).openAudioSource(openParams);
+        if (!pAudioSource) {
+            // Not an error, the actual deck load will report it
+            kLogger.debug()
+                    << "Failed to open file for prefetching:"
+                    << m_pTrack->getLocation();
+            return;
+        }
+        const SINT prefetchFrames = math_min(
+                static_cast<SINT>(
+                        pAudioSource->getSignalInfo().getSampleRate() *
+                        kPrefetchSeconds),
+                pAudioSource->frameLength());
+        if (prefetchFrames <= 0) {
+            return;
+        }
+        SampleBuffer buffer(
+                pAudioSource->getSignalInfo().frames2samples(prefetchFrames));
+        pAudioSource->readSampleFrames(
+                WritableSampleFrames(
+                        IndexRange::forward(
+                                pAudioSource->frameIndexMin(),
+                                prefetchFrames),
+                        SampleBuffer::WritableSlice(buffer)));
+        // The decoded samples are discarded, only the side effects on
+        // the caches matter.
+    }
+
+  private:
+    const TrackPointer m_pTrack;
+};
+
+} // anonymous namespace
+
+//static
+void TrackPrefetcher::prefetch(TrackPointer pTrack) {
+    if (!pTrack) {
+        return;
+    }
+    {
+        const std::lock_guard lock(s_lastRequestedMutex);
+        if (pTrack->getId() == s_lastRequestedTrackId) {
+            return;
+        }
+        s_lastRequestedTrackId = pTrack->getId();
+    }
+    auto* pTask = new PrefetchTask(std::move(pTrack));
+    // Low queue priority, deck loads and analysis must not be delayed
+    // by speculative work.
+    QThreadPool::globalInstance()->start(pTask, -1);
+}
+
+} // namespace mixxx
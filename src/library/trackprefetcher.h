@@ -0,0 +1,22 @@
+#pragma once
+
+#include "track/track_decl.h"
+
+namespace mixxx {
+
+// Speculatively warms up a track for an upcoming deck load. Opening the
+// sound source builds (or restores) the seek index of the file and
+// decoding the first seconds pulls its data into the page cache, so the
+// actual load requested later completes almost immediately instead of
+// spending seconds in the decoder. The work runs at low priority on the
+// global thread pool and must never block the caller.
+class TrackPrefetcher {
+  public:
+    TrackPrefetcher() = delete;
+
+    // Thread-safe, non-blocking. Requests to prefetch the same track
+    // twice in a row are ignored.
+    static void prefetch(TrackPointer pTrack);
+};
+
+} // namespace mixxx
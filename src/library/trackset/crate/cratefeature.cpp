@@ -165,15 +165,15 @@ void CrateFeature::connectTrackCollection() {
     connect(m_pTrackCollection, // created new, duplicated or imported playlist to new crate
             &TrackCollection::crateInserted,
             this,
-            &CrateFeature::slotCrateTableChanged);
+            &CrateFeature::slotCrateInserted);
     connect(m_pTrackCollection, // renamed, un/locked, toggled AutoDJ source
             &TrackCollection::crateUpdated,
             this,
-            &CrateFeature::slotCrateTableChanged);
+            &CrateFeature::slotCrateUpdated);
     connect(m_pTrackCollection,
             &TrackCollection::crateDeleted,
             this,
-            &CrateFeature::slotCrateTableChanged);
+            &CrateFeature::slotCrateDeleted);
     connect(m_pTrackCollection, // crate tracks hidden, unhidden or purged
             &TrackCollection::crateTracksChanged,
             this,
@@ -557,6 +557,8 @@ QModelIndex CrateFeature::rebuildChildModel(CrateId selectedCrateId) {
         return QModelIndex();
     }
     m_pSidebarModel->removeRows(0, pRootItem->childRows());
+    m_crateRowById.clear();
+    m_crateNames.clear();
 
     std::vector<std::unique_ptr<TreeItem>> modelRows;
     modelRows.reserve(m_pTrackCollection->crates().countCrates());
@@ -567,6 +569,9 @@ QModelIndex CrateFeature::rebuildChildModel(CrateId selectedCrateId) {
     CrateSummary crateSummary;
     while (crateSummaries.populateNext(&crateSummary)) {
         modelRows.push_back(newTreeItemForCrateSummary(crateSummary));
+        m_crateRowById.insert(crateSummary.getId(),
+                static_cast<int>(modelRows.size()) - 1);
+        m_crateNames.append(crateSummary.getName());
         if (selectedCrateId == crateSummary.getId()) {
             // save index for selection
             selectedRow = static_cast<int>(modelRows.size()) - 1;
@@ -625,17 +630,25 @@ QModelIndex CrateFeature::indexFromCrateId(CrateId crateId) const {
     VERIFY_OR_DEBUG_ASSERT(crateId.isValid()) {
         return QModelIndex();
     }
-    for (int row = 0; row < m_pSidebarModel->rowCount(); ++row) {
-        QModelIndex index = m_pSidebarModel->index(row, 0);
-        TreeItem* pTreeItem = m_pSidebarModel->getItem(index);
-        DEBUG_ASSERT(pTreeItem != nullptr);
-        if (!pTreeItem->hasChildren() && // leaf node
-                (CrateId(pTreeItem->getData()) == crateId)) {
-            return index;
-        }
+    const auto it = m_crateRowById.constFind(crateId);
+    if (it == m_crateRowById.constEnd()) {
+        qDebug() << "Tree item for crate not found:" << crateId;
+        return QModelIndex();
     }
-    qDebug() << "Tree item for crate not found:" << crateId;
-    return QModelIndex();
+    const QModelIndex index = m_pSidebarModel->index(*it, 0);
+    DEBUG_ASSERT(CrateId(m_pSidebarModel->getItem(index)->getData()) == crateId);
+    return index;
+}
+
+int CrateFeature::insertRowForCrateName(const QString& name) const {
+    const auto it = std::lower_bound(
+            m_crateNames.constBegin(),
+            m_crateNames.constEnd(),
+            name,
+            [this](const QString& lhs, const QString& rhs) {
+                return m_crateNameCollator.compare(lhs, rhs) < 0;
+            });
+    return static_cast<int>(std::distance(m_crateNames.constBegin(), it));
 }
 
 void CrateFeature::slotImportPlaylist() {
@@ -884,6 +897,9 @@ void CrateFeature::storePrevSiblingCrateId(CrateId crateId) {
 }
 
 void CrateFeature::slotCrateTableChanged(CrateId crateId) {
+    // Full rebuild of the child model. Only invoked as a fallback by the
+    // differential slots below when their cached state does not match
+    // the database.
     Q_UNUSED(crateId);
     if (isChildIndexSelectedInSidebar(m_lastClickedIndex)) {
         // If the previously selected crate was loaded to the tracks table and
@@ -902,6 +918,100 @@ void CrateFeature::slotCrateTableChanged(CrateId crateId) {
     }
 }
 
+void CrateFeature::slotCrateInserted(CrateId crateId) {
+    CrateSummary crateSummary;
+    VERIFY_OR_DEBUG_ASSERT(
+            m_pTrackCollection->crates().readCrateSummaryById(
+                    crateId, &crateSummary) &&
+            !m_crateRowById.contains(crateId)) {
+        slotCrateTableChanged(crateId);
+        return;
+    }
+    const int row = insertRowForCrateName(crateSummary.getName());
+    std::vector<std::unique_ptr<TreeItem>> modelRows;
+    modelRows.push_back(newTreeItemForCrateSummary(crateSummary));
+    m_pSidebarModel->insertTreeItemRows(std::move(modelRows), row);
+    for (int& crateRow : m_crateRowById) {
+        if (crateRow >= row) {
+            ++crateRow;
+        }
+    }
+    m_crateRowById.insert(crateId, row);
+    m_crateNames.insert(row, crateSummary.getName());
+    if (m_selectedTrackId.isValid()) {
+        // A duplicated or imported crate may already contain the
+        // selected track.
+        slotTrackSelected(m_selectedTrackId);
+    }
+}
+
+void CrateFeature::slotCrateUpdated(CrateId crateId) {
+    CrateSummary crateSummary;
+    VERIFY_OR_DEBUG_ASSERT(
+            m_pTrackCollection->crates().readCrateSummaryById(
+                    crateId, &crateSummary)) {
+        slotCrateTableChanged(crateId);
+        return;
+    }
+    const auto it = m_crateRowById.constFind(crateId);
+    VERIFY_OR_DEBUG_ASSERT(it != m_crateRowById.constEnd()) {
+        slotCrateTableChanged(crateId);
+        return;
+    }
+    const int row = *it;
+    const QString newName = crateSummary.getName();
+    if (newName != m_crateNames.at(row)) {
+        // The crate has been renamed which may change its sorted
+        // position. Only rebuild the model when the order is actually
+        // violated, i.e. usually never for un/lock and AutoDJ source
+        // toggles and rarely for renames.
+        const bool stillSorted =
+                (row == 0 ||
+                        m_crateNameCollator.compare(
+                                m_crateNames.at(row - 1), newName) <= 0) &&
+                (row + 1 >= m_crateNames.size() ||
+                        m_crateNameCollator.compare(
+                                newName, m_crateNames.at(row + 1)) <= 0);
+        if (!stillSorted) {
+            slotCrateTableChanged(crateId);
+            return;
+        }
+        m_crateNames[row] = newName;
+    }
+    const QModelIndex index = m_pSidebarModel->index(row, 0);
+    updateTreeItemForCrateSummary(
+            m_pSidebarModel->getItem(index), crateSummary);
+    m_pSidebarModel->triggerRepaint(index);
+}
+
+void CrateFeature::slotCrateDeleted(CrateId crateId) {
+    const auto it = m_crateRowById.constFind(crateId);
+    VERIFY_OR_DEBUG_ASSERT(it != m_crateRowById.constEnd()) {
+        slotCrateTableChanged(crateId);
+        return;
+    }
+    const int row = *it;
+    // Check before removing the row while the stored index is still valid.
+    const bool restoreSelection =
+            isChildIndexSelectedInSidebar(m_lastClickedIndex);
+    m_pSidebarModel->removeRows(row, 1);
+    m_crateRowById.erase(it);
+    for (int& crateRow : m_crateRowById) {
+        if (crateRow > row) {
+            --crateRow;
+        }
+    }
+    m_crateNames.removeAt(row);
+    if (restoreSelection &&
+            !activateCrate(m_crateTableModel.selectedCrate())) {
+        // The deleted crate was loaded to the tracks table and selected
+        // in the sidebar, try to select the stored sibling
+        if (m_prevSiblingCrate.isValid()) {
+            activateCrate(m_prevSiblingCrate);
+        }
+    }
+}
+
 void CrateFeature::slotCrateContentChanged(CrateId crateId) {
     QSet<CrateId> updatedCrateIds;
     updatedCrateIds.insert(crateId);
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <QHash>
 #include <QList>
 #include <QModelIndex>
 #include <QPointer>
+#include <QStringList>
 #include <QUrl>
 #include <QVariant>
 
@@ -12,6 +14,7 @@
 #include "preferences/usersettings.h"
 #include "track/trackid.h"
 #include "util/parented_ptr.h"
+#include "util/string.h"
 
 // forward declaration(s)
 class Library;
@@ -70,6 +73,13 @@ class CrateFeature : public BaseTrackSetFeature {
     void slotExportTrackFiles();
     void slotAnalyzeCrate();
     void slotCrateTableChanged(CrateId crateId);
+    // Differential updates of the child model for single crate
+    // insertions, updates and deletions. Fall back to
+    // slotCrateTableChanged() if the cached model state is
+    // inconsistent with the database.
+    void slotCrateInserted(CrateId crateId);
+    void slotCrateUpdated(CrateId crateId);
+    void slotCrateDeleted(CrateId crateId);
     void slotCrateContentChanged(CrateId crateId);
     void htmlLinkClicked(const QUrl& link);
     void slotTrackSelected(TrackId trackId);
@@ -94,6 +104,7 @@ class CrateFeature : public BaseTrackSetFeature {
 
     CrateId crateIdFromIndex(const QModelIndex& index) const;
     QModelIndex indexFromCrateId(CrateId crateId) const;
+    int insertRowForCrateName(const QString& name) const;
 
     bool isChildIndexSelectedInSidebar(const QModelIndex& index);
     bool readLastRightClickedCrate(Crate* pCrate) const;
@@ -111,8 +122,20 @@ class CrateFeature : public BaseTrackSetFeature {
     // Can be used to restore a similar selection after the sidebar model was rebuilt.
     CrateId m_prevSiblingCrate;
 
-    QModelIndex m_lastClickedIndex;
-    QModelIndex m_lastRightClickedIndex;
+    // Sidebar row of each crate for O(1) lookups and the crate names in
+    // sidebar order for locating the sorted position of inserted and
+    // renamed crates without re-querying the database. Kept in sync with
+    // the child model by rebuildChildModel() and the differential
+    // slotCrate*() updates.
+    QHash<CrateId, int> m_crateRowById;
+    QStringList m_crateNames;
+    // Matches the collation of CrateStorage::selectCrateSummaries().
+    mixxx::StringCollator m_crateNameCollator;
+
+    // Persistent so that the differential child model updates above
+    // do not invalidate the stored positions.
+    QPersistentModelIndex m_lastClickedIndex;
+    QPersistentModelIndex m_lastRightClickedIndex;
     TrackId m_selectedTrackId;
 
     parented_ptr<QAction> m_pCreateCrateAction;
@@ -223,12 +223,14 @@ void CrateStorage::repairDatabase(const QSqlDatabase& database) {
 void CrateStorage::connectDatabase(const QSqlDatabase& database) {
     m_database = database;
     createViews();
+    invalidateTrackIdCaches();
 }
 
 void CrateStorage::disconnectDatabase() {
     // Ensure that we don't use the current database connection
     // any longer.
     m_database = QSqlDatabase();
+    invalidateTrackIdCaches();
 }
 
 void CrateStorage::createViews() {
@@ -542,6 +544,39 @@ TrackSelectResult CrateStorage::selectAllTracksSorted() const {
     }
 }
 
+const std::vector<TrackId>& CrateStorage::sortedTrackIdsByCrateNameLike(
+        const QString& crateNameLike) const {
+    auto it = m_sortedTrackIdsByCrateNameLikeCache.find(crateNameLike);
+    if (it == m_sortedTrackIdsByCrateNameLikeCache.end()) {
+        std::vector<TrackId> sortedTrackIds;
+        CrateTrackSelectResult crateTracks(
+                selectTracksSortedByCrateNameLike(crateNameLike));
+        while (crateTracks.next()) {
+            sortedTrackIds.push_back(crateTracks.trackId());
+        }
+        it = m_sortedTrackIdsByCrateNameLikeCache.insert(
+                crateNameLike, std::move(sortedTrackIds));
+    }
+    return it.value();
+}
+
+const std::vector<TrackId>& CrateStorage::sortedTrackIdsWithCrate() const {
+    if (!m_sortedTrackIdsWithCrateCache) {
+        std::vector<TrackId> sortedTrackIds;
+        TrackSelectResult tracks(selectAllTracksSorted());
+        while (tracks.next()) {
+            sortedTrackIds.push_back(tracks.trackId());
+        }
+        m_sortedTrackIdsWithCrateCache = std::move(sortedTrackIds);
+    }
+    return *m_sortedTrackIdsWithCrateCache;
+}
+
+void CrateStorage::invalidateTrackIdCaches() {
+    m_sortedTrackIdsByCrateNameLikeCache.clear();
+    m_sortedTrackIdsWithCrateCache.reset();
+}
+
 QSet<CrateId> CrateStorage::collectCrateIdsOfTracks(const QList<TrackId>& trackIds) const {
     // NOTE(uklotzde): One query per track id. This could be optimized
     // by querying for chunks of track ids and collecting the results.
@@ -601,6 +636,8 @@ bool CrateStorage::onInsertingCrate(
 
 bool CrateStorage::onUpdatingCrate(
         const Crate& crate) {
+    // Renaming a crate changes which name patterns it matches
+    invalidateTrackIdCaches();
     VERIFY_OR_DEBUG_ASSERT(crate.getId().isValid()) {
         kLogger.warning()
                 << "Cannot update crate without a valid id";
@@ -643,6 +680,7 @@ bool CrateStorage::onUpdatingCrate(
 
 bool CrateStorage::onDeletingCrate(
         CrateId crateId) {
+    invalidateTrackIdCaches();
     VERIFY_OR_DEBUG_ASSERT(crateId.isValid()) {
         kLogger.warning()
                 << "Cannot delete crate without a valid id";
@@ -695,6 +733,7 @@ bool CrateStorage::onDeletingCrate(
 bool CrateStorage::onAddingCrateTracks(
         CrateId crateId,
         const QList<TrackId>& trackIds) {
+    invalidateTrackIdCaches();
     FwdSqlQuery query(m_database,
             QStringLiteral(
                     "INSERT OR IGNORE INTO %1 (%2, %3) "
@@ -729,6 +768,7 @@ bool CrateStorage::onAddingCrateTracks(
 bool CrateStorage::onRemovingCrateTracks(
         CrateId crateId,
         const QList<TrackId>& trackIds) {
+    invalidateTrackIdCaches();
     // NOTE(uklotzde): We remove tracks in a loop
     // analogously to adding tracks (see above).
     FwdSqlQuery query(m_database,
@@ -764,6 +804,7 @@ bool CrateStorage::onRemovingCrateTracks(
 
 bool CrateStorage::onPurgingTracks(
         const QList<TrackId>& trackIds) {
+    invalidateTrackIdCaches();
     // NOTE(uklotzde): Remove tracks from crates one-by-one.
     // This might be optimized by deleting multiple track ids
     // at once in chunks with a maximum size.
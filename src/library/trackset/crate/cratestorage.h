@@ -1,7 +1,10 @@
 #pragma once
 
+#include <QHash>
 #include <QList>
 #include <QSet>
+#include <optional>
+#include <vector>
 
 #include "library/trackset/crate/crateid.h"
 #include "track/trackid.h"
@@ -318,6 +321,17 @@ class CrateStorage : public virtual /*implements*/ SqlStorage {
             const QString& crateNameLike) const;
     TrackSelectResult selectAllTracksSorted() const;
 
+    // Cached variants of the preceding two select operations for repeated
+    // membership checks, e.g. while evaluating search queries. The sorted
+    // track ids are loaded once and then kept in memory until the next
+    // crate or crate track write operation invalidates the cache, so
+    // subsequent checks are binary searches instead of joining through
+    // the crate_tracks table again. The returned reference is only
+    // guaranteed to remain valid until the next write operation!
+    const std::vector<TrackId>& sortedTrackIdsByCrateNameLike(
+            const QString& crateNameLike) const;
+    const std::vector<TrackId>& sortedTrackIdsWithCrate() const;
+
     // Returns the set of crate ids for crates that contain any of the
     // provided track ids.
     QSet<CrateId> collectCrateIdsOfTracks(
@@ -340,5 +354,16 @@ class CrateStorage : public virtual /*implements*/ SqlStorage {
   private:
     void createViews();
 
+    // Discards all cached membership indexes. Invoked by all write
+    // operations that might affect crate memberships, even if the
+    // enclosing transaction is rolled back afterwards. Dropping the
+    // caches is always safe, they are refilled lazily on the next read.
+    void invalidateTrackIdCaches();
+
     QSqlDatabase m_database;
+
+    // Lazily filled membership indexes, mutable because they are
+    // populated on demand from const read operations.
+    mutable QHash<QString, std::vector<TrackId>> m_sortedTrackIdsByCrateNameLikeCache;
+    mutable std::optional<std::vector<TrackId>> m_sortedTrackIdsWithCrateCache;
 };
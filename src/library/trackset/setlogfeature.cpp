@@ -2,7 +2,6 @@
 
 #include <QDateTime>
 #include <QMenu>
-#include <QSqlTableModel>
 
 #include "library/library.h"
 #include "library/library_prefs.h"
@@ -21,6 +20,20 @@
 
 namespace {
 constexpr int kNumToplevelHistoryEntries = 5;
+constexpr int kInvalidYear = -1;
+
+// Label of a YEAR node, showing the number of sessions it contains
+QString createYearNodeLabel(int year, int sessionCount) {
+    return QStringLiteral("%1 (%2)")
+            .arg(QString::number(year), QString::number(sessionCount));
+}
+
+// Extracts the year from a YEAR node label created by createYearNodeLabel()
+int yearFromNodeLabel(const QString& label) {
+    bool ok = false;
+    const int year = label.section(QChar(' '), 0, 0).toInt(&ok);
+    return ok ? year : kInvalidYear;
+}
 } // namespace
 
 using namespace mixxx::library::prefs;
@@ -261,83 +274,91 @@ QModelIndex SetlogFeature::constructChildModel(int selectedId) {
         LOG_FAILED_QUERY(query);
     }
 
-    // Setup the sidebar playlist model
-    QSqlTableModel playlistTableModel(this, database);
-    playlistTableModel.setTable(m_countsDurationTableName);
-    playlistTableModel.setSort(playlistTableModel.fieldIndex("id"), Qt::DescendingOrder);
-    playlistTableModel.select();
-    while (playlistTableModel.canFetchMore()) {
-        playlistTableModel.fetchMore();
-    }
-    QSqlRecord record = playlistTableModel.record();
-    int nameColumn = record.indexOf("name");
-    int idColumn = record.indexOf("id");
-    int createdColumn = record.indexOf("date_created");
-    int countColumn = record.indexOf("count");
-    int durationColumn = record.indexOf("durationSeconds");
+    // Scan only the Playlists table to learn which sessions exist and which
+    // year they were created in. The track counts and durations are
+    // aggregated by the view above, which joins PlaylistTracks and library,
+    // so they are fetched only for the sessions that are actually
+    // materialized: the recent top-level entries and the year of the
+    // selected playlist. All other years become collapsed YEAR nodes whose
+    // children are built on demand in onLazyChildExpandation(), which keeps
+    // the construction cost flat regardless of the accumulated history.
+    QSqlQuery sessionQuery(database);
+    sessionQuery.prepare(QStringLiteral(
+            "SELECT id, date_created FROM Playlists "
+            "WHERE hidden = :hidden ORDER BY id DESC"));
+    sessionQuery.bindValue(":hidden", PlaylistDAO::PLHT_SET_LOG);
+    sessionQuery.setForwardOnly(true);
+    if (!sessionQuery.exec()) {
+        LOG_FAILED_QUERY(sessionQuery);
+    }
+
+    QList<int> recentIds;
+    // years with their sessions, in descending order of creation
+    QList<int> groupedYears;
+    QHash<int, QList<int>> idsByYear;
+    int row = 0;
+    while (sessionQuery.next()) {
+        int id = sessionQuery.value(0).toInt();
+        // Show only [kNumToplevelHistoryEntries] recent playlists at the top level
+        // before grouping them by year.
+        if (row < kNumToplevelHistoryEntries) {
+            recentIds.append(id);
+        } else {
+            int yearCreated = sessionQuery.value(1).toDateTime().date().year();
+            auto i = idsByYear.find(yearCreated);
+            if (i == idsByYear.end()) {
+                groupedYears.append(yearCreated);
+                i = idsByYear.insert(yearCreated, QList<int>());
+            }
+            i->append(id);
+        }
+        ++row;
+    }
+
+    // Materialize the year of the selected playlist right away, so restoring
+    // the sidebar selection keeps working when the selection is in a past year.
+    int selectedYear = kInvalidYear;
+    QList<int> materializedIds = recentIds;
+    for (const int year : std::as_const(groupedYears)) {
+        if (idsByYear.value(year).contains(selectedId)) {
+            selectedYear = year;
+            materializedIds.append(idsByYear.value(year));
+            break;
+        }
+    }
+    const QHash<int, QString> labels = fetchSessionLabels(materializedIds);
 
     // Nice to have: restore previous expanded/collapsed state of YEAR items
     clearChildModel();
-    QMap<int, TreeItem*> groups;
     std::vector<std::unique_ptr<TreeItem>> itemList;
-    // Generous estimate (number of years the db is used ;))
-    itemList.reserve(kNumToplevelHistoryEntries + 15);
-
-    for (int row = 0; row < playlistTableModel.rowCount(); ++row) {
-        int id =
-                playlistTableModel
-                        .data(playlistTableModel.index(row, idColumn))
-                        .toInt();
-        QString name =
-                playlistTableModel
-                        .data(playlistTableModel.index(row, nameColumn))
-                        .toString();
-        QDateTime dateCreated =
-                playlistTableModel
-                        .data(playlistTableModel.index(row, createdColumn))
-                        .toDateTime();
-        int count = playlistTableModel
-                            .data(playlistTableModel.index(row, countColumn))
-                            .toInt();
-        int duration =
-                playlistTableModel
-                        .data(playlistTableModel.index(row, durationColumn))
-                        .toInt();
-        QString label = createPlaylistLabel(name, count, duration);
-
-        // Create the TreeItem whose parent is the invisible root item.
-        // Show only [kNumToplevelHistoryEntries] recent playlists at the top level
-        // before grouping them by year.
-        if (row >= kNumToplevelHistoryEntries) {
-            // group by year
-            int yearCreated = dateCreated.date().year();
-
-            auto i = groups.find(yearCreated);
-            TreeItem* pGroupItem;
-            if (i != groups.end() && i.key() == yearCreated) {
-                // get YEAR item the playlist will sorted into
-                pGroupItem = i.value();
-            } else {
-                // create YEAR item the playlist will sorted into
-                // store id of empty placeholder playlist
-                auto pNewGroupItem = std::make_unique<TreeItem>(
-                        QString::number(yearCreated), m_yearNodeId);
-                pGroupItem = pNewGroupItem.get();
-                groups.insert(yearCreated, pGroupItem);
-                itemList.push_back(std::move(pNewGroupItem));
+    itemList.reserve(recentIds.size() + groupedYears.size());
+
+    // Create the TreeItems whose parent is the invisible root item.
+    for (const int id : std::as_const(recentIds)) {
+        // add most recent top-level playlist
+        auto pItem = std::make_unique<TreeItem>(labels.value(id), id);
+        pItem->setBold(m_playlistIdsOfSelectedTrack.contains(id));
+        decorateChild(pItem.get(), id);
+
+        itemList.push_back(std::move(pItem));
+    }
+
+    for (const int year : std::as_const(groupedYears)) {
+        const QList<int> yearIds = idsByYear.value(year);
+        // create YEAR item the playlists are sorted into
+        // store id of empty placeholder playlist
+        auto pGroupItem = std::make_unique<TreeItem>(
+                createYearNodeLabel(year, yearIds.size()), m_yearNodeId);
+        if (year == selectedYear) {
+            for (const int id : yearIds) {
+                TreeItem* pItem = pGroupItem->appendChild(labels.value(id), id);
+                pItem->setBold(m_playlistIdsOfSelectedTrack.contains(id));
+                decorateChild(pItem, id);
             }
-
-            TreeItem* pItem = pGroupItem->appendChild(label, id);
-            pItem->setBold(m_playlistIdsOfSelectedTrack.contains(id));
-            decorateChild(pItem, id);
         } else {
-            // add most recent top-level playlist
-            auto pItem = std::make_unique<TreeItem>(label, id);
-            pItem->setBold(m_playlistIdsOfSelectedTrack.contains(id));
-            decorateChild(pItem.get(), id);
-
-            itemList.push_back(std::move(pItem));
+            pGroupItem->setHasLazyChildren(true);
         }
+        itemList.push_back(std::move(pGroupItem));
     }
 
     // Append all the newly created TreeItems in a dynamic way to the childmodel
@@ -346,6 +367,96 @@ QModelIndex SetlogFeature::constructChildModel(int selectedId) {
     return indexFromPlaylistId(selectedId);
 }
 
+/// Invoked by double click and the expand icon of YEAR nodes whose children
+/// have not been materialized yet
+void SetlogFeature::onLazyChildExpandation(const QModelIndex& index) {
+    // Make a copy of the index, see BrowseFeature::onLazyChildExpandation()
+    QPersistentModelIndex idx(index);
+    if (!idx.isValid()) {
+        return;
+    }
+    TreeItem* pGroupItem = static_cast<TreeItem*>(idx.internalPointer());
+    if (!pGroupItem || !pGroupItem->hasLazyChildren()) {
+        return;
+    }
+    const int year = yearFromNodeLabel(pGroupItem->getLabel());
+    VERIFY_OR_DEBUG_ASSERT(year != kInvalidYear) {
+        return;
+    }
+
+    QSqlDatabase database =
+            m_pLibrary->trackCollectionManager()->internalCollection()->database();
+    QSqlQuery sessionQuery(database);
+    sessionQuery.prepare(QStringLiteral(
+            "SELECT id, date_created FROM Playlists "
+            "WHERE hidden = :hidden ORDER BY id DESC"));
+    sessionQuery.bindValue(":hidden", PlaylistDAO::PLHT_SET_LOG);
+    sessionQuery.setForwardOnly(true);
+    if (!sessionQuery.exec()) {
+        LOG_FAILED_QUERY(sessionQuery);
+        return;
+    }
+    QList<int> yearIds;
+    int row = 0;
+    while (sessionQuery.next()) {
+        // Skip the recent playlists shown at the top level, like in
+        // constructChildModel()
+        if (row++ < kNumToplevelHistoryEntries) {
+            continue;
+        }
+        if (sessionQuery.value(1).toDateTime().date().year() == year) {
+            yearIds.append(sessionQuery.value(0).toInt());
+        }
+    }
+
+    const QHash<int, QString> labels = fetchSessionLabels(yearIds);
+    std::vector<std::unique_ptr<TreeItem>> itemList;
+    itemList.reserve(yearIds.size());
+    for (const int id : std::as_const(yearIds)) {
+        auto pItem = std::make_unique<TreeItem>(labels.value(id), id);
+        pItem->setBold(m_playlistIdsOfSelectedTrack.contains(id));
+        decorateChild(pItem.get(), id);
+        itemList.push_back(std::move(pItem));
+    }
+    pGroupItem->setHasLazyChildren(false);
+    if (!itemList.empty()) {
+        m_pSidebarModel->insertTreeItemRows(std::move(itemList), 0, idx);
+    }
+}
+
+/// Fetches the formatted name/count/duration labels for the given session
+/// playlists from the counts/duration view in a single query
+QHash<int, QString> SetlogFeature::fetchSessionLabels(const QList<int>& playlistIds) {
+    QHash<int, QString> labels;
+    if (playlistIds.isEmpty()) {
+        return labels;
+    }
+    QStringList idStrings;
+    idStrings.reserve(playlistIds.size());
+    for (const int id : playlistIds) {
+        idStrings << QString::number(id);
+    }
+    QSqlDatabase database =
+            m_pLibrary->trackCollectionManager()->internalCollection()->database();
+    QSqlQuery query(database);
+    query.prepare(QStringLiteral(
+            "SELECT id, name, count, durationSeconds FROM %1 "
+            "WHERE id IN (%2)")
+                    .arg(m_countsDurationTableName, idStrings.join(QChar(','))));
+    query.setForwardOnly(true);
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query);
+        return labels;
+    }
+    while (query.next()) {
+        labels.insert(query.value(0).toInt(),
+                createPlaylistLabel(query.value(1).toString(),
+                        query.value(2).toInt(),
+                        query.value(3).toInt()));
+    }
+    return labels;
+}
+
 void SetlogFeature::decorateChild(TreeItem* item, int playlistId) {
     if (playlistId == m_currentPlaylistId) {
         item->setIcon(QIcon(":/images/library/ic_library_history_current.svg"));
@@ -513,6 +624,8 @@ void SetlogFeature::lockOrUnlockAllChildPlaylists(bool lock) {
     if (!item) {
         return;
     }
+    // The children of a collapsed YEAR node may not have been built yet
+    onLazyChildExpandation(m_lastRightClickedIndex);
     const QList<TreeItem*> yearChildren = item->children();
     if (yearChildren.isEmpty()) {
         return;
@@ -537,11 +650,13 @@ void SetlogFeature::slotDeleteAllUnlockedChildPlaylists() {
     if (!item) {
         return;
     }
+    // The children of a collapsed YEAR node may not have been built yet
+    onLazyChildExpandation(m_lastRightClickedIndex);
     const QList<TreeItem*> yearChildren = item->children();
     if (yearChildren.isEmpty()) {
         return;
     }
-    QString year = m_lastRightClickedIndex.data().toString();
+    QString year = QString::number(yearFromNodeLabel(item->getLabel()));
 
     QMessageBox::StandardButton btn = QMessageBox::question(nullptr,
             tr("Confirm Deletion"),
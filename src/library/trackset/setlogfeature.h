@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QHash>
 #include <QPointer>
 
 #include "library/trackset/baseplaylistfeature.h"
@@ -33,6 +34,7 @@ class SetlogFeature : public BasePlaylistFeature {
     void slotGetNewPlaylist();
     void activate() override;
     void activateChild(const QModelIndex& index) override;
+    void onLazyChildExpandation(const QModelIndex& index) override;
 
   protected:
     QModelIndex constructChildModel(int selectedId);
@@ -46,6 +48,7 @@ class SetlogFeature : public BasePlaylistFeature {
     void slotDeleteAllUnlockedChildPlaylists();
 
   private:
+    QHash<int, QString> fetchSessionLabels(const QList<int>& playlistIds);
     void deleteAllUnlockedPlaylistsWithFewerTracks();
     void lockOrUnlockAllChildPlaylists(bool lock);
     QString getRootViewHtml() const override;
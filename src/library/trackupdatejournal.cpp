@@ -0,0 +1,192 @@
+#include "library/trackupdatejournal.h"
+
+#include <QSqlDatabase>
+
+#include "library/dao/analysisdao.h"
+#include "library/dao/cuedao.h"
+#include "library/dao/trackdao.h"
+#include "moc_trackupdatejournal.cpp"
+#include "util/db/dbconnectionpooled.h"
+#include "util/db/dbconnectionpooler.h"
+#include "util/db/sqltransaction.h"
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("TrackUpdateJournal");
+
+// A batch is committed after this many coalesced updates...
+constexpr int kMaxBatchSize = 64;
+
+// ...or after this many milliseconds, whichever comes first. The window
+// bounds both the latency of pending writes and the worst-case stall of
+// the flush barrier in waitForPendingUpdate().
+constexpr unsigned long kCoalesceWindowMillis = 500;
+
+} // anonymous namespace
+
+TrackUpdateJournal::TrackUpdateJournal(
+        mixxx::DbConnectionPoolPtr pDbConnectionPool,
+        UserSettingsPointer pConfig)
+        : m_pDbConnectionPool(std::move(pDbConnectionPool)),
+          m_pConfig(std::move(pConfig)),
+          m_stopRequested(false),
+          m_threadExited(false) {
+    setObjectName(QStringLiteral("TrackUpdateJournal"));
+}
+
+TrackUpdateJournal::~TrackUpdateJournal() {
+    VERIFY_OR_DEBUG_ASSERT(!isRunning()) {
+        stop();
+    }
+}
+
+bool TrackUpdateJournal::enqueue(Entry entry) {
+    DEBUG_ASSERT(entry.trackId.isValid());
+    const QMutexLocker locked(&m_mutex);
+    if (m_threadExited) {
+        // The journal thread exited without replaying this entry, e.g.
+        // because it failed to open its database connection. The caller
+        // must persist the update synchronously instead.
+        return false;
+    }
+    VERIFY_OR_DEBUG_ASSERT(!m_stopRequested) {
+        // The journal must be detached from the TrackDAO before
+        // stopping it. Reject the entry so the caller writes it
+        // synchronously instead of losing the update.
+        kLogger.warning()
+                << "Rejecting update for track"
+                << entry.trackId
+                << "journaled after stop";
+        return false;
+    }
+    const auto it = m_pendingIndex.constFind(entry.trackId);
+    if (it != m_pendingIndex.constEnd()) {
+        // Coalesce with the still pending update, which will be
+        // picked up by the next batch.
+        m_pendingEntries[it.value()] = std::move(entry);
+        return true;
+    }
+    m_pendingIndex.insert(entry.trackId, m_pendingEntries.size());
+    m_pendingEntries.append(std::move(entry));
+    m_entryAdded.wakeAll();
+    return true;
+}
+
+void TrackUpdateJournal::waitForPendingUpdate(TrackId trackId) {
+    const QMutexLocker locked(&m_mutex);
+    while (!m_threadExited &&
+            (m_pendingIndex.contains(trackId) ||
+                    m_committingTrackIds.contains(trackId))) {
+        // Cut the coalescing window short to commit the pending
+        // batch as soon as possible.
+        m_entryAdded.wakeAll();
+        m_batchCommitted.wait(&m_mutex);
+    }
+}
+
+void TrackUpdateJournal::stop() {
+    {
+        const QMutexLocker locked(&m_mutex);
+        m_stopRequested = true;
+        m_entryAdded.wakeAll();
+    }
+    wait();
+}
+
+void TrackUpdateJournal::run() {
+    kLogger.debug() << "Entering thread";
+    {
+        const mixxx::DbConnectionPooler dbConnectionPooler(m_pDbConnectionPool);
+        QSqlDatabase dbConnection = mixxx::DbConnectionPooled(m_pDbConnectionPool);
+        if (!dbConnection.isOpen()) {
+            kLogger.warning()
+                    << "Failed to open database connection for track update journal";
+            const QMutexLocker locked(&m_mutex);
+            m_threadExited = true;
+            if (!m_pendingEntries.isEmpty()) {
+                // Entries journaled between start() and this point cannot
+                // be replayed without a connection.
+                kLogger.warning()
+                        << "Discarding"
+                        << m_pendingEntries.size()
+                        << "pending track update(s)";
+                m_pendingEntries.clear();
+                m_pendingIndex.clear();
+            }
+            // Unblock waitForPendingUpdate(), there is nothing left
+            // to wait for.
+            m_batchCommitted.wakeAll();
+            kLogger.debug() << "Exiting thread";
+            return;
+        }
+
+        AnalysisDao analysisDao(m_pConfig);
+        analysisDao.initialize(dbConnection);
+        CueDAO cueDao;
+        cueDao.initialize(dbConnection);
+
+        QMutexLocker locked(&m_mutex);
+        for (;;) {
+            while (m_pendingEntries.isEmpty() && !m_stopRequested) {
+                m_entryAdded.wait(&m_mutex);
+            }
+            if (m_pendingEntries.isEmpty()) {
+                DEBUG_ASSERT(m_stopRequested);
+                break;
+            }
+            if (!m_stopRequested && m_pendingEntries.size() < kMaxBatchSize) {
+                // Coalescing window: collect subsequent updates into
+                // the same transaction.
+                m_entryAdded.wait(&m_mutex, kCoalesceWindowMillis);
+            }
+            const QList<Entry> batch = std::move(m_pendingEntries);
+            m_pendingEntries = QList<Entry>();
+            m_pendingIndex.clear();
+            for (const auto& entry : batch) {
+                m_committingTrackIds.insert(entry.trackId);
+            }
+            locked.unlock();
+
+            QSet<TrackId> committedTrackIds;
+            {
+                SqlTransaction transaction(dbConnection);
+                for (const auto& entry : batch) {
+                    if (!TrackDAO::updateTrackLibraryRow(
+                                dbConnection,
+                                entry.trackId,
+                                entry.record,
+                                entry.pBeats)) {
+                        kLogger.warning()
+                                << "Failed to replay journaled update for track"
+                                << entry.trackId;
+                        continue;
+                    }
+                    analysisDao.saveTrackAnalyses(
+                            entry.trackId,
+                            entry.pWaveform,
+                            entry.pWaveformSummary);
+                    cueDao.saveTrackCues(
+                            entry.trackId, entry.cuePoints);
+                    committedTrackIds.insert(entry.trackId);
+                }
+                transaction.commit();
+            }
+            if (kLogger.debugEnabled()) {
+                kLogger.debug()
+                        << "Committed batch of"
+                        << committedTrackIds.size()
+                        << "track update(s)";
+            }
+            if (!committedTrackIds.isEmpty()) {
+                emit tracksUpdated(committedTrackIds);
+            }
+
+            locked.relock();
+            m_committingTrackIds.clear();
+            m_batchCommitted.wakeAll();
+        }
+        m_threadExited = true;
+    }
+    kLogger.debug() << "Exiting thread";
+}
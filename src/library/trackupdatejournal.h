@@ -0,0 +1,92 @@
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QSet>
+#include <QThread>
+#include <QWaitCondition>
+
+#include "preferences/usersettings.h"
+#include "track/beats.h"
+#include "track/cue.h"
+#include "track/trackid.h"
+#include "track/trackrecord.h"
+#include "util/db/dbconnectionpool.h"
+#include "waveform/waveform.h"
+
+/// Write-behind journal for track metadata updates.
+///
+/// TrackDAO::updateTrack() commits a synchronous SQLite transaction on the
+/// calling thread. When a modified track is evicted from the GlobalTrackCache,
+/// e.g. after ejecting it from a deck, this transaction stalls the main
+/// thread until the commit has been flushed to disk. Instead of writing
+/// immediately the TrackDAO appends a snapshot of the track's database state
+/// to this journal, which replays the snapshots on its own thread and
+/// database connection, coalescing multiple updates into a single
+/// transaction.
+///
+/// Ordering with the GlobalTrackCache is preserved by waitForPendingUpdate():
+/// before a track object is re-created from its database row all journaled
+/// updates for that track must have been committed. stop() provides the
+/// flush barrier on shutdown.
+class TrackUpdateJournal : public QThread {
+    Q_OBJECT
+  public:
+    TrackUpdateJournal(
+            mixxx::DbConnectionPoolPtr pDbConnectionPool,
+            UserSettingsPointer pConfig);
+    ~TrackUpdateJournal() override;
+
+    /// Snapshot of everything that TrackDAO::updateTrack() persists.
+    struct Entry {
+        TrackId trackId;
+        mixxx::TrackRecord record;
+        mixxx::BeatsPointer pBeats;
+        QList<CuePointer> cuePoints;
+        ConstWaveformPointer pWaveform;
+        ConstWaveformPointer pWaveformSummary;
+    };
+
+    /// Append a snapshot to the journal. A still pending entry for the
+    /// same track is replaced, i.e. updates are coalesced per track.
+    /// Returns false if the journal thread is not running, e.g. because
+    /// it failed to open its database connection. In that case the entry
+    /// is rejected and the caller must persist the update synchronously.
+    bool enqueue(Entry entry);
+
+    /// Block until a pending update for the given track (if any) has
+    /// been committed to the database. Returns immediately if the
+    /// journal thread has exited.
+    void waitForPendingUpdate(TrackId trackId);
+
+    /// Flush all remaining entries and join the thread.
+    void stop();
+
+  signals:
+    /// Emitted from the journal thread after a batch has been committed.
+    void tracksUpdated(const QSet<TrackId>& trackIds);
+
+  protected:
+    void run() override;
+
+  private:
+    const mixxx::DbConnectionPoolPtr m_pDbConnectionPool;
+    const UserSettingsPointer m_pConfig;
+
+    // All following members are guarded by m_mutex.
+    QMutex m_mutex;
+    QWaitCondition m_entryAdded;
+    QWaitCondition m_batchCommitted;
+    QList<Entry> m_pendingEntries;
+    // Positions of pending entries by track id for coalescing
+    QHash<TrackId, int> m_pendingIndex;
+    // Track ids of the batch that is currently being committed
+    QSet<TrackId> m_committingTrackIds;
+    bool m_stopRequested;
+    // Set when run() exits, either regularly on stop() or early when no
+    // database connection could be opened. Makes enqueue() reject new
+    // entries and waitForPendingUpdate() return instead of blocking on
+    // a journal that will never commit them.
+    bool m_threadExited;
+};
@@ -518,23 +518,8 @@ void TraktorFeature::parsePlaylistEntries(
         return;
     }
 
-    // Get playlist id
-    QSqlQuery id_query(m_database);
-    id_query.prepare("select id from traktor_playlists where name=:path");
-    id_query.bindValue(":path", playlist_path);
-
-    if (!id_query.exec()) {
-        LOG_FAILED_QUERY(id_query) << "Could not get inserted playlist id for Traktor playlist::"
-                                   << playlist_path;
-        return;
-    }
-
-    //playlist_id = id_query.lastInsertId().toInt();
-    int playlist_id = kInvalidPlaylistId;
-    const int idColumn = id_query.record().indexOf("id");
-    while (id_query.next()) {
-        playlist_id = id_query.value(idColumn).toInt();
-    }
+    // Get playlist id from the insert instead of querying it back by name
+    int playlist_id = pQueryInsertIntoPlaylist->lastInsertId().toInt();
 
     int playlist_position = 1;
     while (!xml.atEnd() && !m_cancelImport) {
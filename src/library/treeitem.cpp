@@ -35,7 +35,8 @@ TreeItem::TreeItem(
       m_pParent(nullptr),
       m_label(std::move(label)),
       m_data(std::move(data)),
-      m_bold(false) {
+      m_bold(false),
+      m_lazyChildren(false) {
 }
 
 TreeItem::~TreeItem() {
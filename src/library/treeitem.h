@@ -76,6 +76,15 @@ class TreeItem final {
     bool hasChildren() const {
         return !m_children.empty();
     }
+    bool hasLazyChildren() const {
+        return m_lazyChildren;
+    }
+    // Mark this item as the parent of children that are created on demand
+    // by LibraryFeature::onLazyChildExpandation(). TreeItemModel reports
+    // such items as expandable although their children are not built yet.
+    void setHasLazyChildren(bool lazyChildren) {
+        m_lazyChildren = lazyChildren;
+    }
     int childRows() const {
         return m_children.size();
     }
@@ -147,4 +156,5 @@ class TreeItem final {
     QVariant m_data;
     QIcon m_icon;
     bool m_bold;
+    bool m_lazyChildren;
 };
@@ -199,6 +199,14 @@ bool TreeItemModel::removeRows(int position, int rows, const QModelIndex &parent
     return true;
 }
 
+bool TreeItemModel::hasChildren(const QModelIndex &parent) const {
+    TreeItem* pItem = getItem(parent);
+    if (pItem != nullptr && pItem->hasLazyChildren()) {
+        return true;
+    }
+    return QAbstractItemModel::hasChildren(parent);
+}
+
 TreeItem* TreeItemModel::getItem(const QModelIndex &index) const {
     if (index.isValid()) {
         TreeItem* pItem = static_cast<TreeItem*>(index.internalPointer());
@@ -27,6 +27,10 @@ class TreeItemModel : public QAbstractItemModel {
                          int a_iRole = Qt::EditRole) override;
     int rowCount(const QModelIndex &parent = QModelIndex()) const override;
     int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    // Reports items with lazily created children as expandable before their
+    // children have been built, so that expanding them can invoke
+    // LibraryFeature::onLazyChildExpandation().
+    bool hasChildren(const QModelIndex &parent = QModelIndex()) const override;
 
     void insertTreeItemRows(
             std::vector<std::unique_ptr<TreeItem>>&&,
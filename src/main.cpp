@@ -1,4 +1,5 @@
 #include <QApplication>
+#include <QDialog>
 #include <QDir>
 #include <QPixmapCache>
 #include <QString>
@@ -13,6 +14,7 @@
 #include <stdexcept>
 
 #include "config.h"
+#include "control/controlobject.h"
 #include "controllers/controllermanager.h"
 #include "coreservices.h"
 #include "errordialoghandler.h"
@@ -28,6 +30,7 @@
 #if defined(__WINDOWS__)
 #include "nativeeventhandlerwin.h"
 #endif
+#include "soundio/soundmanager.h"
 #include "sources/soundsourceproxy.h"
 #include "util/cmdlineargs.h"
 #include "util/console.h"
@@ -56,9 +59,50 @@ const QString kNotifyMaxDbgTimeKey = QStringLiteral("notify_max_dbg_time");
 // An indicator that the QPixmapCache was too small.
 constexpr int kPixmapCacheLimitAt100PercentZoom = 32 * 1024; // 32 MByte
 
+// Runs the engine, library, Auto DJ, effects, Live Broadcasting and
+// controller subsystems without instantiating MixxxMainWindow or loading a
+// skin. Intended for unattended setups (e.g. an Auto DJ broadcast box) that
+// are operated via hardware controllers.
+int runMixxxHeadless(MixxxApplication* pApp, const CmdlineArgs& args) {
+    auto pCoreServices = std::make_shared<mixxx::CoreServices>(args, pApp);
+    pCoreServices->initialize(pApp);
+
+    SoundDeviceStatus result = pCoreServices->getSoundManager()->setupDevices();
+    if (result != SoundDeviceStatus::Ok) {
+        qCritical() << "Error setting up sound devices:" << static_cast<int>(result);
+        return kFatalErrorOnStartupExitCode;
+    }
+
+    // DlgPreferences has some initialization logic that must be executed even
+    // though the dialog is never shown, at least for the effects system. The
+    // QML application relies on the same behavior.
+    std::shared_ptr<QDialog> pDlgPreferences = pCoreServices->makeDlgPreferences();
+    pDlgPreferences->setAttribute(Qt::WA_QuitOnClose, false);
+
+    pCoreServices->getControllerManager()->setUpDevices();
+
+    if (args.getStartAutoDJ()) {
+        qDebug() << "Enabling Auto DJ from the command line";
+        ControlObject::set(ConfigKey("[AutoDJ]", "enabled"), 1.0);
+    }
+
+    // If startup produced a fatal error, then don't even start the
+    // Qt event loop.
+    if (ErrorDialogHandler::instance()->checkError()) {
+        return kFatalErrorOnStartupExitCode;
+    }
+
+    qDebug() << "Running Mixxx headless";
+    return pApp->exec();
+}
+
 int runMixxx(MixxxApplication* pApp, const CmdlineArgs& args) {
     CmdlineArgs::Instance().parseForUserFeedback();
 
+    if (args.isHeadless()) {
+        return runMixxxHeadless(pApp, args);
+    }
+
     int exitCode;
 #ifdef MIXXX_USE_QML
     if (args.isQml()) {
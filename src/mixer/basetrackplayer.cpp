@@ -19,6 +19,7 @@
 #include "util/sandbox.h"
 #include "vinylcontrol/defs_vinylcontrol.h"
 #include "waveform/renderers/waveformwidgetrenderer.h"
+#include "waveform/waveformmemorymanager.h"
 
 namespace {
 
@@ -535,6 +536,10 @@ void BaseTrackPlayerImpl::connectLoadedTrack() {
             &Track::replayGainAdjusted,
             this,
             &BaseTrackPlayerImpl::slotAdjustReplayGain);
+    connect(m_pLoadedTrack.get(),
+            &Track::loudnessCurveUpdated,
+            this,
+            &BaseTrackPlayerImpl::slotSetLoudnessCurve);
 
     connect(m_pLoadedTrack.get(),
             &Track::colorUpdated,
@@ -650,6 +655,14 @@ void BaseTrackPlayerImpl::slotTrackLoaded(TrackPointer pNewTrack,
         slotSetTrackColor(std::nullopt);
         m_pLoopInPoint->set(kNoTrigger);
         m_pLoopOutPoint->set(kNoTrigger);
+        m_pChannel->setLoudnessCurve(nullptr);
+        if (PlayerManager::isSamplerGroup(getGroup()) ||
+                PlayerManager::isPreviewDeckGroup(getGroup())) {
+            auto* pWaveformMemoryManager = WaveformMemoryManager::instance();
+            if (pWaveformMemoryManager) {
+                pWaveformMemoryManager->releaseGroup(getGroup());
+            }
+        }
         m_pLoadedTrack.reset();
         emit playerEmpty();
         emit trackRatingChanged(0);
@@ -667,6 +680,7 @@ void BaseTrackPlayerImpl::slotTrackLoaded(TrackPointer pNewTrack,
         m_pFileBPM->set(m_pLoadedTrack->getBpm());
         m_pKey->set(m_pLoadedTrack->getKey());
         slotSetTrackColor(m_pLoadedTrack->getColor());
+        m_pChannel->setLoudnessCurve(m_pLoadedTrack->getLoudnessCurve());
 
         if(m_pConfig->getValue(
                 ConfigKey("[Mixer Profile]", "EqAutoReset"), false)) {
@@ -743,6 +757,17 @@ void BaseTrackPlayerImpl::slotTrackLoaded(TrackPointer pNewTrack,
         }
 #endif
 
+        // Samplers and preview decks only render the overview, so their
+        // tracks' detailed waveforms are candidates for eviction once the
+        // combined size exceeds the budget.
+        if (PlayerManager::isSamplerGroup(getGroup()) ||
+                PlayerManager::isPreviewDeckGroup(getGroup())) {
+            auto* pWaveformMemoryManager = WaveformMemoryManager::instance();
+            if (pWaveformMemoryManager) {
+                pWaveformMemoryManager->submitTrack(getGroup(), m_pLoadedTrack);
+            }
+        }
+
         emit newTrackLoaded(m_pLoadedTrack);
         emit trackRatingChanged(m_pLoadedTrack->getRating());
     } else {
@@ -889,6 +914,13 @@ void BaseTrackPlayerImpl::slotSetReplayGain(mixxx::ReplayGain replayGain) {
     }
 }
 
+void BaseTrackPlayerImpl::slotSetLoudnessCurve() {
+    TrackPointer pTrack = m_pLoadedTrack;
+    if (pTrack) {
+        m_pChannel->setLoudnessCurve(pTrack->getLoudnessCurve());
+    }
+}
+
 void BaseTrackPlayerImpl::slotAdjustReplayGain(
         mixxx::ReplayGain replayGain, const QString& requestingPlayerGroup) {
     const double factor = m_pReplayGain->get() / replayGain.getRatio();
@@ -151,6 +151,9 @@ class BaseTrackPlayerImpl : public BaseTrackPlayer {
     void slotShiftCuesMillis(double milliseconds);
     void slotShiftCuesMillisButton(double value, double milliseconds);
     void slotUpdateReplayGainFromPregain(double pressed);
+    /// Pushes the loudness curve of the loaded track to the pregain stage,
+    /// both on track load and when the analyzer finishes.
+    void slotSetLoudnessCurve();
 
   private:
     void setReplayGain(double value);
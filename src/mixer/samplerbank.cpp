@@ -2,7 +2,9 @@
 
 #include <QFileDialog>
 #include <QMessageBox>
+#include <QSet>
 #include <QStandardPaths>
+#include <QThreadPool>
 
 #include "control/controlpushbutton.h"
 #include "mixer/playermanager.h"
@@ -20,6 +22,10 @@ const ConfigKey kConfigkeyLastImportExportDirectory(
 // lupdate finds the single string here.
 const char kSamplerFileType[] = QT_TRANSLATE_NOOP("SamplerBank", "Mixxx Sampler Banks (*.xml)");
 
+// Reading the head of a sample file covers the part that the metadata
+// import and the first decoded chunks touch.
+constexpr qint64 kWarmupReadBytes = 256 * 1024;
+
 } // anonymous namespace
 
 SamplerBank::SamplerBank(UserSettingsPointer pConfig,
@@ -195,8 +201,14 @@ bool SamplerBank::loadSamplerBankFromPath(const QString& samplerBankPath) {
         return false;
     }
 
-    QDomNode n = root.firstChild();
+    struct SamplerEntry {
+        QString group;
+        QString location;
+        int samplerNum;
+    };
+    QList<SamplerEntry> entries;
 
+    QDomNode n = root.firstChild();
     while (!n.isNull()) {
         QDomElement e = n.toElement();
 
@@ -207,20 +219,7 @@ bool SamplerBank::loadSamplerBankFromPath(const QString& samplerBankPath) {
                 int samplerNum;
 
                 if (!group.isEmpty() && m_pPlayerManager->isSamplerGroup(group, &samplerNum)) {
-                    if (m_pPlayerManager->numSamplers() < (unsigned)samplerNum) {
-                        m_pCONumSamplers->set(samplerNum);
-                    }
-
-                    if (location.isEmpty()) {
-                        m_pPlayerManager->slotLoadTrackToPlayer(
-                                TrackPointer(), group,
-#ifdef __STEM__
-                                mixxx::StemChannelSelection(),
-#endif
-                                false);
-                    } else {
-                        m_pPlayerManager->slotLoadLocationToPlayer(location, group, false);
-                    }
+                    entries.append(SamplerEntry{group, location, samplerNum});
                 }
             }
         }
@@ -228,5 +227,46 @@ bool SamplerBank::loadSamplerBankFromPath(const QString& samplerBankPath) {
     }
 
     file.close();
+
+    // Pull the file heads of all referenced samples into the page cache
+    // in parallel before the loads below. Resolving a track that is not
+    // in the library yet imports its metadata synchronously on this
+    // (GUI) thread, and with a cold cache those serial reads dominate
+    // the bank switch time. Duplicate pad assignments are read once.
+    QSet<QString> uniqueLocations;
+    for (const auto& entry : std::as_const(entries)) {
+        if (!entry.location.isEmpty()) {
+            uniqueLocations.insert(entry.location);
+        }
+    }
+    for (const QString& location : std::as_const(uniqueLocations)) {
+        QThreadPool::globalInstance()->start(
+                [location] {
+                    QFile sampleFile(location);
+                    if (sampleFile.open(QIODevice::ReadOnly)) {
+                        sampleFile.read(kWarmupReadBytes);
+                    }
+                },
+                /*priority*/ -1);
+    }
+
+    for (const auto& entry : std::as_const(entries)) {
+        if (m_pPlayerManager->numSamplers() < (unsigned)entry.samplerNum) {
+            m_pCONumSamplers->set(entry.samplerNum);
+        }
+
+        if (entry.location.isEmpty()) {
+            m_pPlayerManager->slotLoadTrackToPlayer(
+                    TrackPointer(), entry.group,
+#ifdef __STEM__
+                    mixxx::StemChannelSelection(),
+#endif
+                    false);
+        } else {
+            m_pPlayerManager->slotLoadLocationToPlayer(
+                    entry.location, entry.group, false);
+        }
+    }
+
     return true;
 }
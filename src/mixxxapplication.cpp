@@ -1,5 +1,6 @@
 #include "mixxxapplication.h"
 
+#include <QThread>
 #include <QThreadPool>
 #include <QTouchEvent>
 #include <QtDebug>
@@ -18,8 +19,10 @@
 #include "util/cache.h"
 #include "util/cmdlineargs.h"
 #include "util/color/rgbcolor.h"
+#include "util/event.h"
 #include "util/fileinfo.h"
 #include "util/math.h"
+#include "util/timer.h"
 
 // When linking Qt statically, the Q_IMPORT_PLUGIN is needed for each linked plugin.
 // https://doc.qt.io/qt-5/plugins-howto.html#details-of-linking-static-plugins
@@ -91,6 +94,15 @@ class QMouseEventEditable : public QMouseEvent {
 // reasonable threshold.
 constexpr int kDefaultEventNotifyExecTimeWarningThreshold = 10;
 
+// Queued cross-thread signal deliveries (QEvent::MetaCall) on the main
+// thread are counted in fixed windows. Draining a burst of deliveries
+// delays all pending timers (GuiTick, the VSync thread's queued swap
+// callbacks) until the event queue is empty again, so exceeding the
+// threshold within one window is logged together with the most frequent
+// receiver to make the offending signal source attributable.
+constexpr int kMetaCallBurstWindowMillis = 100;
+constexpr int kMetaCallBurstThreshold = 500;
+
 } // anonymous namespace
 
 MixxxApplication::MixxxApplication(int& argc, char** argv)
@@ -221,6 +233,31 @@ bool MixxxApplication::notify(QObject* pTarget, QEvent* pEvent) {
         return ret;
     }
 
+    if (m_isDeveloper && pEvent->type() == QEvent::Paint && pTarget->isWidgetType()) {
+        // Aggregate paint durations per widget instance so expensive skin
+        // elements can be spotted in the Developer Tools stats view. The tag
+        // combines the widget class with the objectName assigned by the skin
+        // system, e.g. "paint/WPushButton#play_indicator". Stat::track() is a
+        // no-op unless the StatsManager has been started.
+        QString tag = QStringLiteral("paint/") +
+                QLatin1String(pTarget->metaObject()->className());
+        const QString objectName = pTarget->objectName();
+        if (!objectName.isEmpty()) {
+            tag += QLatin1Char('#') + objectName;
+        }
+        Stat::track(tag,
+                Stat::DURATION_NANOSEC,
+                Stat::experimentFlags(kDefaultComputeFlags),
+                static_cast<double>(time.elapsed().toIntegerNanos()));
+    }
+
+    if (m_isDeveloper && pEvent->type() == QEvent::MetaCall &&
+            QThread::currentThread() == thread()) {
+        // Unlike DeferredDelete events the receiver of a queued signal
+        // delivery is still alive here, so pTarget is safe to inspect.
+        trackQueuedSignalDelivery(pTarget, time.elapsed());
+    }
+
     if (m_isDeveloper &&
             time.elapsed() > m_eventNotifyExecTimeWarningThreshold) {
         QDebug debug = qDebug();
@@ -244,6 +281,58 @@ bool MixxxApplication::notify(QObject* pTarget, QEvent* pEvent) {
     return ret;
 }
 
+void MixxxApplication::trackQueuedSignalDelivery(QObject* pTarget, mixxx::Duration elapsed) {
+    // Aggregate count and duration per receiver instance, tagged like the
+    // paint instrumentation above, e.g. "metacall/WOverview#overview".
+    QString receiverTag = QLatin1String(pTarget->metaObject()->className());
+    const QString objectName = pTarget->objectName();
+    if (!objectName.isEmpty()) {
+        receiverTag += QLatin1Char('#') + objectName;
+    }
+    Stat::track(QStringLiteral("metacall/") + receiverTag,
+            Stat::DURATION_NANOSEC,
+            Stat::experimentFlags(kDefaultComputeFlags),
+            static_cast<double>(elapsed.toIntegerNanos()));
+
+    if (m_metaCallWindowCount > 0 &&
+            m_metaCallWindowTimer.elapsed() >=
+                    mixxx::Duration::fromMillis(kMetaCallBurstWindowMillis)) {
+        // The current window has expired without reaching the threshold.
+        m_metaCallWindowCount = 0;
+        m_metaCallWindowReceivers.clear();
+    }
+    if (m_metaCallWindowCount == 0) {
+        m_metaCallWindowTimer.start();
+    }
+    m_metaCallWindowCount++;
+    m_metaCallWindowReceivers[receiverTag]++;
+    if (m_metaCallWindowCount == kMetaCallBurstThreshold) {
+        // Log only once when crossing the threshold, even if the burst
+        // continues within this window.
+        QString topReceiver;
+        int topCount = 0;
+        for (auto it = m_metaCallWindowReceivers.constBegin();
+                it != m_metaCallWindowReceivers.constEnd();
+                ++it) {
+            if (it.value() > topCount) {
+                topCount = it.value();
+                topReceiver = it.key();
+            }
+        }
+        qWarning() << "Queued signal burst:"
+                   << m_metaCallWindowCount
+                   << "cross-thread deliveries on the main thread within"
+                   << kMetaCallBurstWindowMillis
+                   << "ms, most frequent receiver:"
+                   << topReceiver
+                   << "with"
+                   << topCount
+                   << "deliveries";
+        static const QString kBurstTag = QStringLiteral("metacall/burst");
+        Event::event(kBurstTag);
+    }
+}
+
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
 bool MixxxApplication::touchIsRightButton() {
     if (!m_pTouchShift) {
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <QApplication>
+#include <QHash>
 
 #include "util/duration.h"
+#include "util/performancetimer.h"
 
 class ControlProxy;
 
@@ -19,9 +21,17 @@ class MixxxApplication : public QApplication {
   private:
     bool touchIsRightButton();
     void registerMetaTypes();
+    void trackQueuedSignalDelivery(QObject* pTarget, mixxx::Duration elapsed);
 
     int m_rightPressedButtons;
     ControlProxy* m_pTouchShift;
     bool m_isDeveloper;
     mixxx::Duration m_eventNotifyExecTimeWarningThreshold;
+
+    // Burst detection for queued cross-thread signal deliveries on the
+    // main thread. Only touched in developer mode and only from the main
+    // thread, see trackQueuedSignalDelivery().
+    PerformanceTimer m_metaCallWindowTimer;
+    int m_metaCallWindowCount{0};
+    QHash<QString, int> m_metaCallWindowReceivers;
 };
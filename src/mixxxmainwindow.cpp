@@ -4,6 +4,7 @@
 #include <QCloseEvent>
 #include <QDebug>
 #include <QFileDialog>
+#include <QMessageBox>
 #include <QOpenGLContext>
 #include <QUrl>
 
@@ -39,6 +40,7 @@
 #ifdef __ENGINEPRIME__
 #include "library/export/libraryexporter.h"
 #endif
+#include "library/export/librarysnapshotworker.h"
 #include "library/library_prefs.h"
 #include "library/trackcollectionmanager.h"
 #include "mixer/playerinfo.h"
@@ -51,6 +53,7 @@
 #include "track/track.h"
 #include "util/debug.h"
 #include "util/desktophelper.h"
+#include "util/event.h"
 #include "util/sandbox.h"
 #include "util/scopedoverridecursor.h"
 #include "util/timer.h"
@@ -108,6 +111,7 @@ MixxxMainWindow::MixxxMainWindow(std::shared_ptr<mixxx::CoreServices> pCoreServi
           m_inRebootMixxxView(false),
           m_pDeveloperToolsDlg(nullptr),
           m_pPrefDlg(nullptr),
+          m_pLibrarySnapshotWorker(nullptr),
           m_toolTipsCfg(mixxx::preferences::Tooltips::On) {
     DEBUG_ASSERT(pCoreServices);
     // These depend on the settings
@@ -358,7 +362,10 @@ void MixxxMainWindow::initialize() {
     bool retryClicked;
     do {
         retryClicked = false;
+        const QString eventTag = QStringLiteral("SoundManager::setupDevices");
+        Event::start(eventTag);
         SoundDeviceStatus result = m_pCoreServices->getSoundManager()->setupDevices();
+        Event::end(eventTag);
         if (result == SoundDeviceStatus::ErrorDeviceCount ||
                 result == SoundDeviceStatus::ErrorExcessiveOutputChannel) {
             if (soundDeviceBusyDlg(&retryClicked) != QDialog::Accepted) {
@@ -459,6 +466,11 @@ MixxxMainWindow::~MixxxMainWindow() {
     Timer t("~MixxxMainWindow");
     t.start();
 
+    if (m_pLibrarySnapshotWorker) {
+        m_pLibrarySnapshotWorker->stop();
+        m_pLibrarySnapshotWorker->wait();
+    }
+
     // Save the current window state (position, maximized, etc)
     // Note(ronso0): Unfortunately saveGeometry() also stores the fullscreen state.
     // On next start restoreGeometry would enable fullscreen mode even though that
@@ -991,6 +1003,11 @@ void MixxxMainWindow::connectMenuBar() {
                 m_pCoreServices->getLibrary().get(),
                 &Library::showAutoDJ,
                 Qt::UniqueConnection);
+        connect(m_pMenuBar,
+                &WMainMenuBar::exportLibrarySnapshot,
+                this,
+                &MixxxMainWindow::slotExportLibrarySnapshot,
+                Qt::UniqueConnection);
     }
 
 #ifdef __ENGINEPRIME__
@@ -1100,6 +1117,62 @@ void MixxxMainWindow::slotDeveloperToolsClosed() {
     m_pDeveloperToolsDlg = nullptr;
 }
 
+void MixxxMainWindow::slotExportLibrarySnapshot() {
+    if (m_pLibrarySnapshotWorker) {
+        QMessageBox::information(this,
+                tr("Export Library Snapshot"),
+                tr("A library snapshot export is already in progress."));
+        return;
+    }
+    const auto pLibrary = m_pCoreServices->getLibrary();
+    VERIFY_OR_DEBUG_ASSERT(pLibrary) {
+        return;
+    }
+    const UserSettingsPointer pConfig = m_pCoreServices->getSettings();
+    const ConfigKey lastDirKey(
+            "[Library]", "LastLibrarySnapshotDirectory");
+    const QString destDir = QFileDialog::getExistingDirectory(this,
+            tr("Export Library Snapshot"),
+            pConfig->getValue(lastDirKey, QDir::homePath()));
+    if (destDir.isEmpty()) {
+        return;
+    }
+    pConfig->setValue(lastDirKey, destDir);
+
+    m_pLibrarySnapshotWorker = new LibrarySnapshotWorker(
+            pLibrary->dbConnectionPool(),
+            pConfig->getSettingsPath(),
+            destDir);
+    connect(m_pLibrarySnapshotWorker,
+            &LibrarySnapshotWorker::finished,
+            this,
+            [this, destDir] {
+                LibrarySnapshotWorker* pWorker = m_pLibrarySnapshotWorker;
+                m_pLibrarySnapshotWorker = nullptr;
+                const QString errorMessage = pWorker->errorMessage();
+                if (errorMessage.isEmpty()) {
+                    QMessageBox::information(this,
+                            tr("Export Library Snapshot"),
+                            tr("Library snapshot exported to %1 "
+                               "(%2 files copied, %3 unchanged).\n\n"
+                               "To restore it, copy the exported files into "
+                               "the settings directory of the other machine "
+                               "while Mixxx is not running.")
+                                    .arg(destDir,
+                                            QString::number(
+                                                    pWorker->copiedFileCount()),
+                                            QString::number(
+                                                    pWorker->skippedFileCount())));
+                } else {
+                    QMessageBox::warning(this,
+                            tr("Export Library Snapshot"),
+                            errorMessage);
+                }
+                pWorker->deleteLater();
+            });
+    m_pLibrarySnapshotWorker->start();
+}
+
 void MixxxMainWindow::slotViewFullScreen(bool toggle) {
     if (isFullScreen() == toggle) {
         return;
@@ -1324,10 +1397,18 @@ void MixxxMainWindow::rebootMixxxView() {
     // supports since the controls from the previous skin will be left over.
     m_pMenuBar->onNewSkinAboutToLoad();
 
+    QWidget* pOldCentralWidget = nullptr;
     if (m_pCentralWidget) {
         m_pCentralWidget->hide();
         WaveformWidgetFactory::instance()->destroyWidgets();
-        delete m_pCentralWidget;
+        // Tearing down the old widget tree takes about as long as building
+        // the new skin, so defer it: detach the old central widget now and
+        // delete it only after the new skin has been set up and shown. This
+        // roughly halves the time the window appears frozen. The old
+        // widgets are hidden and receive no events in the meantime; their
+        // control bindings are released when the deferred deletion runs.
+        pOldCentralWidget = takeCentralWidget();
+        DEBUG_ASSERT(pOldCentralWidget == m_pCentralWidget);
         m_pCentralWidget = nullptr;
     }
 
@@ -1346,6 +1427,9 @@ void MixxxMainWindow::rebootMixxxView() {
         QMessageBox::critical(this,
                               tr("Error in skin file"),
                               tr("The selected skin cannot be loaded."));
+        if (pOldCentralWidget) {
+            pOldCentralWidget->deleteLater();
+        }
         m_inRebootMixxxView = false;
         // m_pWidgetParent is NULL, we can't continue.
         return;
@@ -1375,15 +1459,22 @@ void MixxxMainWindow::rebootMixxxView() {
         setGeometry(initGeometry);
     }
 
+    if (pOldCentralWidget) {
+        pOldCentralWidget->deleteLater();
+    }
+
     m_inRebootMixxxView = false;
     qDebug() << "rebootMixxxView DONE";
 }
 
 bool MixxxMainWindow::loadConfiguredSkin() {
+    const QString eventTag = QStringLiteral("MixxxMainWindow::loadConfiguredSkin");
+    Event::start(eventTag);
     // TODO: use std::shared_ptr throughout skin widgets instead of these hacky get() calls
     m_pCentralWidget = m_pSkinLoader->loadConfiguredSkin(this,
             &m_skinCreatedControls,
             m_pCoreServices.get());
+    Event::end(eventTag);
     if (centralWidget() == m_pLaunchImage) {
         initializationProgressUpdate(100, "");
     }
@@ -15,6 +15,7 @@ class DlgPreferences;
 class DlgKeywheel;
 class GuiTick;
 class LaunchImage;
+class LibrarySnapshotWorker;
 class VisualsManager;
 class WMainMenuBar;
 struct LibraryScanResultSummary;
@@ -73,6 +74,8 @@ class MixxxMainWindow : public QMainWindow {
     /// open the developer tools dialog.
     void slotDeveloperTools(bool enable);
     void slotDeveloperToolsClosed();
+    /// export a snapshot of the library database and analysis data
+    void slotExportLibrarySnapshot();
 
     void slotUpdateWindowTitle(TrackPointer pTrack);
 
@@ -157,6 +160,9 @@ class MixxxMainWindow : public QMainWindow {
     std::unique_ptr<mixxx::LibraryExporter> m_pLibraryExporter;
 #endif
 
+    // Created on demand, destroyed when the export has finished
+    LibrarySnapshotWorker* m_pLibrarySnapshotWorker;
+
     mixxx::preferences::Tooltips m_toolTipsCfg;
 
     mixxx::preferences::ScreenSaver m_inhibitScreensaver;
@@ -31,35 +31,23 @@ namespace
 // --kain88 July 2012
     constexpr SINT kFingerprintDuration = 120; // in seconds
 
+// Feed the fingerprinter in chunks of this many frames (about 1.5 s of
+// stereo audio at 44.1 kHz). This bounds the buffer sizes and interleaves
+// decoding with the fingerprint analysis instead of decoding the whole
+// duration up front before the first chromaprint_feed().
+constexpr SINT kFingerprintChunkFrames = 65536;
+
 QString calcFingerprint(
         mixxx::AudioSourceStereoProxy& audioSourceProxy,
         mixxx::IndexRange fingerprintRange) {
-    PerformanceTimer timerReadingFile;
-    timerReadingFile.start();
-
-    mixxx::SampleBuffer sampleBuffer(math_max(
-            fingerprintRange.length(),
-            audioSourceProxy.getSignalInfo().frames2samples(fingerprintRange.length())));
-    const auto readableSampleFrames =
-            audioSourceProxy.readSampleFrames(
-                    mixxx::WritableSampleFrames(
-                            fingerprintRange,
-                            mixxx::SampleBuffer::WritableSlice(sampleBuffer)));
-    if (fingerprintRange != readableSampleFrames.frameIndexRange()) {
-        qWarning() << "Failed to read sample data for fingerprint";
-        return QString();
-    }
+    PerformanceTimer timerFingerprinting;
+    timerFingerprinting.start();
 
-    std::vector<SAMPLE> fingerprintSamples(
-            audioSourceProxy.getSignalInfo().frames2samples(
-                    readableSampleFrames.frameLength()));
-    // Convert floating-point to integer
-    SampleUtil::convertFloat32ToS16(
-            &fingerprintSamples[0],
-            sampleBuffer.data(),
-            static_cast<SINT>(fingerprintSamples.size()));
-
-    qDebug() << "reading file took" << timerReadingFile.elapsed().debugMillisWithUnit();
+    const SINT chunkFrames = math_min(
+            kFingerprintChunkFrames, fingerprintRange.length());
+    mixxx::SampleBuffer sampleBuffer(
+            audioSourceProxy.getSignalInfo().frames2samples(chunkFrames));
+    std::vector<SAMPLE> fingerprintSamples(sampleBuffer.size());
 
     ChromaprintContext* ctx = chromaprint_new(CHROMAPRINT_ALGORITHM_DEFAULT);
     chromaprint_start(
@@ -67,12 +55,39 @@ QString calcFingerprint(
             audioSourceProxy.getSignalInfo().getSampleRate(),
             audioSourceProxy.getSignalInfo().getChannelCount());
 
-    PerformanceTimer timerGeneratingFingerprint;
-    timerGeneratingFingerprint.start();
-    const int success = chromaprint_feed(
-            ctx,
-            &fingerprintSamples[0],
-            static_cast<int>(fingerprintSamples.size()));
+    int success = 1;
+    auto remainingRange = fingerprintRange;
+    while (!remainingRange.empty()) {
+        const auto chunkRange = remainingRange.splitAndShrinkFront(
+                math_min(kFingerprintChunkFrames, remainingRange.length()));
+        const auto readableSampleFrames =
+                audioSourceProxy.readSampleFrames(
+                        mixxx::WritableSampleFrames(
+                                chunkRange,
+                                mixxx::SampleBuffer::WritableSlice(sampleBuffer)));
+        if (chunkRange != readableSampleFrames.frameIndexRange()) {
+            qWarning() << "Failed to read sample data for fingerprint";
+            chromaprint_free(ctx);
+            return QString();
+        }
+
+        const SINT chunkSamples =
+                audioSourceProxy.getSignalInfo().frames2samples(
+                        readableSampleFrames.frameLength());
+        // Convert floating-point to integer
+        SampleUtil::convertFloat32ToS16(
+                fingerprintSamples.data(),
+                sampleBuffer.data(),
+                chunkSamples);
+
+        success = chromaprint_feed(
+                ctx,
+                fingerprintSamples.data(),
+                static_cast<int>(chunkSamples));
+        if (!success) {
+            break;
+        }
+    }
     chromaprint_finish(ctx);
     if (!success) {
         qWarning() << "Failed to generate fingerprint from sample data";
@@ -99,8 +114,8 @@ QString calcFingerprint(
     }
     chromaprint_free(ctx);
 
-    qDebug() << "generating fingerprint took"
-             << timerGeneratingFingerprint.elapsed().debugMillisWithUnit();
+    qDebug() << "fingerprinting took"
+             << timerFingerprinting.elapsed().debugMillisWithUnit();
 
     return fingerprint;
 }
@@ -130,7 +145,7 @@ QString ChromaPrinter::getFingerprint(TrackPointer pTrack) {
                     kFingerprintDuration * pAudioSource->getSignalInfo().getSampleRate()));
     mixxx::AudioSourceStereoProxy audioSourceProxy(
             pAudioSource,
-            fingerprintRange.length());
+            math_min(kFingerprintChunkFrames, fingerprintRange.length()));
 
     return calcFingerprint(audioSourceProxy, fingerprintRange);
 }
@@ -2,11 +2,15 @@
 
 #ifdef MIXXX_HAS_HTTP_SERVER
 
+#include <QCryptographicHash>
+#include <QDataStream>
 #include <QDateTime>
 #include <QFile>
 #include <QJsonDocument>
 #include <QJsonValue>
 #include <QMutexLocker>
+#include <QSqlError>
+#include <QSqlQuery>
 #include <QThread>
 #include <cmath>
 #ifdef Q_OS_LINUX
@@ -16,20 +20,26 @@
 #include "moc_restapigateway.cpp"
 #include "control/controlproxy.h"
 #include "library/dao/playlistdao.h"
+#include "library/dao/trackdao.h"
 #include "library/dao/trackschema.h"
 #include "library/trackcollection.h"
 #include "library/trackcollectionmanager.h"
 #include "mixer/basetrackplayer.h"
 #include "mixer/playermanager.h"
 #include "broadcast/defs_broadcast.h"
+#include "util/latencyhistogram.h"
+#include "util/threadcpumonitor.h"
 #include "util/versionstore.h"
+#include "track/cue.h"
 #include "track/track.h"
 #include "track/trackid.h"
+#include "util/color/rgbcolor.h"
 #include "util/logger.h"
 #include "util/thread_affinity.h"
 
 namespace {
 constexpr auto kApplicationJsonMimeType = "application/json";
+constexpr auto kOctetStreamMimeType = "application/octet-stream";
 }
 
 namespace mixxx::network::rest {
@@ -39,8 +49,35 @@ namespace {
 constexpr qint64 kIdempotencyCacheTtlMs = 10 * 1000;
 constexpr int kMaxIdempotencyCacheEntries = 512;
 constexpr int kMaxIdempotencyKeyLength = 128;
+constexpr int kMaxLibraryResponseCacheEntries = 64;
+// "MXLE" followed by a format version; bump the version whenever the
+// export layout changes.
+constexpr quint32 kLibraryExportMagic = 0x4D584C45;
+constexpr quint16 kLibraryExportVersion = 1;
+constexpr int kLibraryExportCompressionLevel = 9;
 const ControlFlags kStatusControlFlags = ControlFlag::AllowMissingOrInvalid |
         ControlFlag::NoAssertIfMissing | ControlFlag::NoWarnIfMissing;
+
+QString cueTypeName(mixxx::CueType type) {
+    switch (type) {
+    case mixxx::CueType::HotCue:
+        return QStringLiteral("hotcue");
+    case mixxx::CueType::MainCue:
+        return QStringLiteral("main");
+    case mixxx::CueType::Loop:
+        return QStringLiteral("loop");
+    case mixxx::CueType::Jump:
+        return QStringLiteral("jump");
+    case mixxx::CueType::Intro:
+        return QStringLiteral("intro");
+    case mixxx::CueType::Outro:
+        return QStringLiteral("outro");
+    default:
+        // Internal cue types (e.g. the audible sound range) are not
+        // part of the public payload.
+        return QString();
+    }
+}
 } // namespace
 
 RestApiGateway::RestApiGateway(
@@ -54,9 +91,82 @@ RestApiGateway::RestApiGateway(
           m_settings(settings) {
     DEBUG_ASSERT(m_playerManager);
     DEBUG_ASSERT(m_trackCollectionManager);
+    connectLibraryCacheInvalidation();
     m_uptime.start();
 }
 
+void RestApiGateway::connectLibraryCacheInvalidation() {
+    auto* const collection = m_trackCollectionManager->internalCollection();
+    if (collection == nullptr) {
+        return;
+    }
+    // Any change to playlists or to the tracks referenced by their
+    // listings drops all cached library responses. Invalidation is
+    // coarse but cheap, and during a show the library rarely changes.
+    const auto invalidate = [this]() {
+        m_libraryResponseCache.clear();
+    };
+    PlaylistDAO& playlistDao = collection->getPlaylistDAO();
+    connect(&playlistDao, &PlaylistDAO::added, this, invalidate);
+    connect(&playlistDao, &PlaylistDAO::deleted, this, invalidate);
+    connect(&playlistDao, &PlaylistDAO::renamed, this, invalidate);
+    connect(&playlistDao, &PlaylistDAO::lockChanged, this, invalidate);
+    connect(&playlistDao, &PlaylistDAO::playlistContentChanged, this, invalidate);
+    connect(&playlistDao, &PlaylistDAO::tracksAdded, this, invalidate);
+    connect(&playlistDao, &PlaylistDAO::tracksMoved, this, invalidate);
+    connect(&playlistDao, &PlaylistDAO::tracksRemoved, this, invalidate);
+    TrackDAO& trackDao = collection->getTrackDAO();
+    connect(&trackDao, &TrackDAO::tracksAdded, this, invalidate);
+    connect(&trackDao, &TrackDAO::tracksChanged, this, invalidate);
+    connect(&trackDao, &TrackDAO::tracksRemoved, this, invalidate);
+}
+
+QHttpServerResponse RestApiGateway::withLibraryResponseCache(
+        const QString& cacheKey,
+        const QString& ifNoneMatch,
+        const std::function<QHttpServerResponse()>& handler) const {
+    DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
+
+    const auto appendETag = [](QHttpServerResponse&& response, const QString& etag) {
+        QHttpHeaders headers = response.headers();
+        headers.append(QByteArrayLiteral("ETag"), etag.toLatin1());
+        response.setHeaders(headers);
+        return std::move(response);
+    };
+
+    const auto cached = m_libraryResponseCache.constFind(cacheKey);
+    if (cached != m_libraryResponseCache.constEnd()) {
+        if (!ifNoneMatch.isEmpty() && ifNoneMatch.trimmed() == cached->etag) {
+            return appendETag(
+                    QHttpServerResponse(QHttpServerResponse::StatusCode::NotModified),
+                    cached->etag);
+        }
+        return appendETag(
+                QHttpServerResponse(
+                        kApplicationJsonMimeType,
+                        cached->body,
+                        QHttpServerResponse::StatusCode::Ok),
+                cached->etag);
+    }
+
+    QHttpServerResponse response = handler();
+    if (response.statusCode() != QHttpServerResponse::StatusCode::Ok) {
+        // Only successful listings are cacheable
+        return response;
+    }
+    const QByteArray body = response.data();
+    const QString etag = QStringLiteral("\"%1\"")
+                                 .arg(QString::fromLatin1(
+                                         QCryptographicHash::hash(
+                                                 body, QCryptographicHash::Sha1)
+                                                 .toHex()));
+    if (m_libraryResponseCache.size() >= kMaxLibraryResponseCacheEntries) {
+        m_libraryResponseCache.clear();
+    }
+    m_libraryResponseCache.insert(cacheKey, LibraryCacheEntry{etag, body});
+    return appendETag(std::move(response), etag);
+}
+
 QHttpServerResponse RestApiGateway::errorResponse(
         QHttpServerResponse::StatusCode code,
         const QString& message) const {
@@ -78,6 +188,25 @@ QHttpServerResponse RestApiGateway::successResponse(
             statusCode);
 }
 
+QHttpServerResponse RestApiProvider::cpu() const {
+    QJsonObject payload;
+    if (ThreadCpuMonitor::s_bThreadCpuMonitorEnabled) {
+        payload = ThreadCpuMonitor::instance()->historyPayload();
+    }
+    return QHttpServerResponse(
+            kApplicationJsonMimeType,
+            QJsonDocument(payload).toJson(QJsonDocument::Compact),
+            QHttpServerResponse::StatusCode::Ok);
+}
+
+QHttpServerResponse RestApiProvider::latency() const {
+    return QHttpServerResponse(
+            kApplicationJsonMimeType,
+            QJsonDocument(LatencyHistogram::audioPath().toJson())
+                    .toJson(QJsonDocument::Compact),
+            QHttpServerResponse::StatusCode::Ok);
+}
+
 QHttpServerResponse RestApiGateway::health() const {
     const QJsonObject readiness = readinessPayload();
     const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
@@ -266,7 +395,17 @@ QHttpServerResponse RestApiGateway::deck(int deckNumber) const {
                 tr("Deck %1 does not exist").arg(deckNumber));
     }
 
-    return successResponse(QJsonObject{{"deck", deckSummary(deckIndex)}});
+    QJsonObject deck = deckSummary(deckIndex);
+    // The cue list can be sizable, so it is only part of the deck detail
+    // route, not of the per-poll status and stream payloads.
+    BaseTrackPlayer* const player =
+            m_playerManager->getPlayer(PlayerManager::groupForDeck(deckIndex));
+    if (player != nullptr) {
+        if (const TrackPointer track = player->getLoadedTrack()) {
+            deck.insert("cues", trackCuesPayload(track));
+        }
+    }
+    return successResponse(QJsonObject{{"deck", deck}});
 }
 
 QHttpServerResponse RestApiGateway::decks() const {
@@ -274,6 +413,17 @@ QHttpServerResponse RestApiGateway::decks() const {
     return successResponse(QJsonObject{{"decks", deckStatuses()}});
 }
 
+QJsonObject RestApiGateway::decksPayload() const {
+    DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
+    QJsonObject decks;
+    const auto totalDecks = m_playerManager->numberOfDecks();
+    for (unsigned int i = 0; i < totalDecks; ++i) {
+        decks.insert(QStringLiteral("deck_%1").arg(i + 1),
+                deckSummary(static_cast<int>(i)));
+    }
+    return decks;
+}
+
 QHttpServerResponse RestApiGateway::control(const QJsonObject& body) const {
     DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
 
@@ -635,9 +785,30 @@ QHttpServerResponse RestApiGateway::autoDj(const QJsonObject& body) const {
     return resultWithEnabled(action);
 }
 
-QHttpServerResponse RestApiGateway::playlists(const std::optional<int>& playlistId) const {
+QHttpServerResponse RestApiGateway::playlists(
+        const std::optional<int>& playlistId,
+        const std::optional<int>& limit,
+        int offset,
+        const QString& ifNoneMatch) const {
     DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
 
+    const QString cacheKey = QStringLiteral("playlists\n%1\n%2\n%3")
+                                     .arg(playlistId.has_value()
+                                                     ? QString::number(playlistId.value())
+                                                     : QString(),
+                                             limit.has_value()
+                                                     ? QString::number(limit.value())
+                                                     : QString(),
+                                             QString::number(offset));
+    return withLibraryResponseCache(cacheKey, ifNoneMatch, [&]() {
+        return playlistsUncached(playlistId, limit, offset);
+    });
+}
+
+QHttpServerResponse RestApiGateway::playlistsUncached(
+        const std::optional<int>& playlistId,
+        const std::optional<int>& limit,
+        int offset) const {
     return withPlaylistDao([&](PlaylistDAO& playlistDao) {
         if (playlistId.has_value()) {
             if (playlistId.value() < 0 || playlistDao.isHidden(playlistId.value())) {
@@ -646,10 +817,19 @@ QHttpServerResponse RestApiGateway::playlists(const std::optional<int>& playlist
                         tr("Playlist %1 does not exist").arg(playlistId.value()));
             }
 
-            QJsonArray tracks;
             const QList<TrackId> trackIds =
                     playlistDao.getTrackIdsInPlaylistOrder(playlistId.value());
-            for (const TrackId& trackId : trackIds) {
+            // Only the requested page of tracks is resolved and
+            // serialized, so both the response size and the time spent
+            // on the gateway thread stay bounded for large playlists.
+            const int totalTracks = trackIds.size();
+            const int first = qBound(0, offset, totalTracks);
+            const int count = limit.has_value()
+                    ? qMin(limit.value(), totalTracks - first)
+                    : totalTracks - first;
+            QJsonArray tracks;
+            for (int i = first; i < first + count; ++i) {
+                const TrackId& trackId = trackIds.at(i);
                 QJsonObject entry;
                 entry.insert("id", trackId.toString());
                 const TrackPointer track = m_trackCollectionManager->getTrackById(trackId);
@@ -659,10 +839,17 @@ QHttpServerResponse RestApiGateway::playlists(const std::optional<int>& playlist
                 }
                 tracks.append(entry);
             }
-            return successResponse(QJsonObject{
+            QJsonObject payload{
                     {"playlist_id", playlistId.value()},
+                    {"total_tracks", totalTracks},
+                    {"offset", first},
                     {"tracks", tracks},
-            });
+            };
+            // Cursor for the next page, absent on the last page
+            if (first + count < totalTracks) {
+                payload.insert("next_offset", first + count);
+            }
+            return successResponse(payload);
         }
 
         const auto playlists = playlistDao.getPlaylists(PlaylistDAO::PLHT_NOT_HIDDEN);
@@ -771,6 +958,9 @@ QHttpServerResponse RestApiGateway::playlistCommand(const QJsonObject& body) con
 
         if (action == QStringLiteral("set_active")) {
             m_activePlaylistId = playlistId;
+            // The playlist overview embeds the active playlist id, but
+            // changing it does not emit any DAO signal.
+            m_libraryResponseCache.clear();
             return successResponse(QJsonObject{{"active_playlist_id", m_activePlaylistId}});
         }
 
@@ -1086,6 +1276,158 @@ QJsonObject RestApiGateway::trackPayload(const TrackPointer& track) const {
     return payload;
 }
 
+QJsonArray RestApiGateway::trackCuesPayload(const TrackPointer& track) const {
+    QJsonArray cues;
+    const mixxx::audio::SampleRate sampleRate = track->getSampleRate();
+    const QList<CuePointer> cuePoints = track->getCuePoints();
+    for (const CuePointer& pCue : cuePoints) {
+        const QString typeName = cueTypeName(pCue->getType());
+        if (typeName.isEmpty()) {
+            continue;
+        }
+        QJsonObject cue;
+        cue.insert("type", typeName);
+        if (pCue->getHotCue() != Cue::kNoHotCue) {
+            // 1-based, matching the numbering shown in the UI
+            cue.insert("hotcue", pCue->getHotCue() + 1);
+        }
+        const QString label = pCue->getLabel();
+        if (!label.isEmpty()) {
+            cue.insert("label", label);
+        }
+        if (sampleRate.isValid()) {
+            const mixxx::audio::FramePos position = pCue->getPosition();
+            if (position.isValid()) {
+                cue.insert("position_seconds", position.value() / sampleRate);
+            }
+            const mixxx::audio::FramePos endPosition = pCue->getEndPosition();
+            if (endPosition.isValid()) {
+                cue.insert("end_position_seconds", endPosition.value() / sampleRate);
+            }
+        }
+        cue.insert("color", mixxx::RgbColor::toQString(pCue->getColor()));
+        cues.append(cue);
+    }
+    return cues;
+}
+
+QHttpServerResponse RestApiGateway::libraryExport(int sinceId) const {
+    DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
+
+    auto* const collection = m_trackCollectionManager->internalCollection();
+    if (collection == nullptr) {
+        return errorResponse(
+                QHttpServerResponse::StatusCode::ServiceUnavailable,
+                tr("Library is not available"));
+    }
+
+    // One forward-only scan over the library table, bypassing Track
+    // object resolution entirely. Values are serialized column by
+    // column so that runs of similar values compress well.
+    QSqlQuery query(collection->database());
+    query.setForwardOnly(true);
+    query.prepare(QStringLiteral(
+            "SELECT library.id, library.artist, library.title, "
+            "library.album, library.album_artist, library.genre, "
+            "library.year, library.tracknumber, library.filetype, "
+            "track_locations.location, library.duration, library.bitrate, "
+            "library.samplerate, library.channels, library.bpm, "
+            "library.key, library.rating, library.color, "
+            "library.datetime_added "
+            "FROM library "
+            "INNER JOIN track_locations "
+            "ON library.location = track_locations.id "
+            "WHERE library.mixxx_deleted = 0 AND library.id > :sinceId "
+            "ORDER BY library.id"));
+    query.bindValue(QStringLiteral(":sinceId"), sinceId);
+    if (!query.exec()) {
+        kLogger.warning() << "Library export query failed"
+                          << query.lastError().text();
+        return errorResponse(
+                QHttpServerResponse::StatusCode::InternalServerError,
+                tr("Failed to query the library"));
+    }
+
+    struct Column {
+        QString name;
+        quint8 type; // see kColumnType* below
+    };
+    constexpr quint8 kColumnTypeInt = 0;
+    constexpr quint8 kColumnTypeDouble = 1;
+    constexpr quint8 kColumnTypeString = 2;
+    const std::vector<Column> columns = {
+            {QStringLiteral("id"), kColumnTypeInt},
+            {QStringLiteral("artist"), kColumnTypeString},
+            {QStringLiteral("title"), kColumnTypeString},
+            {QStringLiteral("album"), kColumnTypeString},
+            {QStringLiteral("album_artist"), kColumnTypeString},
+            {QStringLiteral("genre"), kColumnTypeString},
+            {QStringLiteral("year"), kColumnTypeString},
+            {QStringLiteral("tracknumber"), kColumnTypeString},
+            {QStringLiteral("filetype"), kColumnTypeString},
+            {QStringLiteral("location"), kColumnTypeString},
+            {QStringLiteral("duration"), kColumnTypeDouble},
+            {QStringLiteral("bitrate"), kColumnTypeInt},
+            {QStringLiteral("samplerate"), kColumnTypeInt},
+            {QStringLiteral("channels"), kColumnTypeInt},
+            {QStringLiteral("bpm"), kColumnTypeDouble},
+            {QStringLiteral("key"), kColumnTypeString},
+            {QStringLiteral("rating"), kColumnTypeInt},
+            {QStringLiteral("color"), kColumnTypeInt},
+            {QStringLiteral("datetime_added"), kColumnTypeString},
+    };
+
+    std::vector<QVariantList> columnValues(columns.size());
+    qint64 lastId = sinceId;
+    while (query.next()) {
+        for (std::size_t i = 0; i < columns.size(); ++i) {
+            columnValues[i].append(query.value(static_cast<int>(i)));
+        }
+        lastId = query.value(0).toLongLong();
+    }
+    const qint64 rowCount = columnValues.empty() ? 0 : columnValues[0].size();
+
+    QByteArray raw;
+    QDataStream stream(&raw, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_15);
+    stream << kLibraryExportMagic;
+    stream << kLibraryExportVersion;
+    stream << static_cast<qint32>(columns.size());
+    stream << rowCount;
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        stream << columns[i].name;
+        stream << columns[i].type;
+        const QVariantList& values = columnValues[i];
+        for (const QVariant& value : values) {
+            switch (columns[i].type) {
+            case kColumnTypeInt:
+                stream << (value.isNull() ? qint64(-1) : value.toLongLong());
+                break;
+            case kColumnTypeDouble:
+                stream << value.toDouble();
+                break;
+            default:
+                stream << value.toString();
+                break;
+            }
+        }
+    }
+
+    QHttpServerResponse response(
+            kOctetStreamMimeType,
+            qCompress(raw, kLibraryExportCompressionLevel),
+            QHttpServerResponse::StatusCode::Ok);
+    QHttpHeaders headers = response.headers();
+    // Clients store the last seen id and pass it back as since_id to
+    // fetch only tracks added after the previous sync.
+    headers.append(QByteArrayLiteral("X-Mixxx-Last-Id"),
+            QByteArray::number(lastId));
+    headers.append(QByteArrayLiteral("X-Mixxx-Row-Count"),
+            QByteArray::number(rowCount));
+    response.setHeaders(headers);
+    return response;
+}
+
 QHttpServerResponse RestApiGateway::withPlaylistDao(
         const std::function<QHttpServerResponse(PlaylistDAO&)>& handler) const {
     auto* const collection = m_trackCollectionManager->internalCollection();
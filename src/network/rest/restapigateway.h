@@ -35,13 +35,37 @@ class RestApiProvider : public QObject {
     virtual QHttpServerResponse ready() const = 0;
     virtual QHttpServerResponse status() const = 0;
     virtual QJsonObject statusPayload() const = 0;
+    // Ring-buffered per-subsystem CPU usage history from ThreadCpuMonitor.
+    // Implemented in the base class since it has no per-gateway state.
+    virtual QHttpServerResponse cpu() const;
+    // End-to-end audio path latency histogram recorded by the sound devices
+    // (see LatencyHistogram::audioPath()). Also implemented in the base
+    // class for the same reason.
+    virtual QHttpServerResponse latency() const;
     virtual QHttpServerResponse deck(int deckNumber) const = 0;
     virtual QHttpServerResponse decks() const = 0;
+    // Deck state keyed per deck ("deck_1", "deck_2", ...) so that the
+    // SSE deck stream can delta-encode updates per deck.
+    virtual QJsonObject decksPayload() const = 0;
     virtual QHttpServerResponse control(const QJsonObject& body) const = 0;
     virtual QHttpServerResponse autoDjStatus() const = 0;
     virtual QHttpServerResponse autoDj(const QJsonObject& body) const = 0;
-    virtual QHttpServerResponse playlists(const std::optional<int>& playlistId) const = 0;
+    // Track listings of large playlists are paginated: limit caps the
+    // number of track entries per response and offset selects the page.
+    // Without a limit the full listing is returned for compatibility.
+    // Responses carry an ETag; when the client resends it via the
+    // If-None-Match request header and the listing has not changed,
+    // 304 Not Modified is returned without any database work.
+    virtual QHttpServerResponse playlists(
+            const std::optional<int>& playlistId,
+            const std::optional<int>& limit,
+            int offset,
+            const QString& ifNoneMatch = QString()) const = 0;
     virtual QHttpServerResponse playlistCommand(const QJsonObject& body) const = 0;
+    // Bulk library dump in a compact binary columnar format for backup
+    // sync clients; sinceId > 0 limits the export to tracks added after
+    // that library row id.
+    virtual QHttpServerResponse libraryExport(int sinceId) const = 0;
     virtual QHttpServerResponse withIdempotencyCache(
             const QString& token,
             const QString& idempotencyKey,
@@ -70,6 +94,7 @@ class RestApiGateway : public RestApiProvider {
     QJsonObject statusPayload() const override;
     QHttpServerResponse deck(int deckNumber) const;
     QHttpServerResponse decks() const;
+    QJsonObject decksPayload() const override;
     QHttpServerResponse control(
             const QString& group,
             const QString& key,
@@ -77,8 +102,13 @@ class RestApiGateway : public RestApiProvider {
     QHttpServerResponse control(const QJsonObject& body) const;
     QHttpServerResponse autoDjStatus() const;
     QHttpServerResponse autoDj(const QJsonObject& body) const;
-    QHttpServerResponse playlists(const std::optional<int>& playlistId) const;
+    QHttpServerResponse playlists(
+            const std::optional<int>& playlistId,
+            const std::optional<int>& limit,
+            int offset,
+            const QString& ifNoneMatch = QString()) const;
     QHttpServerResponse playlistCommand(const QJsonObject& body) const;
+    QHttpServerResponse libraryExport(int sinceId) const override;
     QHttpServerResponse withIdempotencyCache(
             const QString& token,
             const QString& idempotencyKey,
@@ -86,6 +116,11 @@ class RestApiGateway : public RestApiProvider {
             const std::function<QHttpServerResponse()>& handler) const override;
 
   private:
+    struct LibraryCacheEntry {
+        QString etag;
+        QByteArray body;
+    };
+
     struct IdempotencyEntry {
         QDateTime createdUtc;
         QHttpServerResponse::StatusCode statusCode;
@@ -103,6 +138,15 @@ class RestApiGateway : public RestApiProvider {
                     QHttpServerResponse::StatusCode::Ok) const;
     QHttpServerResponse withPlaylistDao(
             const std::function<QHttpServerResponse(PlaylistDAO&)>& handler) const;
+    QHttpServerResponse playlistsUncached(
+            const std::optional<int>& playlistId,
+            const std::optional<int>& limit,
+            int offset) const;
+    QHttpServerResponse withLibraryResponseCache(
+            const QString& cacheKey,
+            const QString& ifNoneMatch,
+            const std::function<QHttpServerResponse()>& handler) const;
+    void connectLibraryCacheInvalidation();
     QJsonArray deckStatuses() const;
     QJsonObject deckSummary(int deckIndex) const;
     QJsonObject readinessPayload() const;
@@ -113,6 +157,7 @@ class RestApiGateway : public RestApiProvider {
     QJsonObject recordingState() const;
     QJsonObject autoDjOverview() const;
     QJsonObject trackPayload(const TrackPointer& track) const;
+    QJsonArray trackCuesPayload(const TrackPointer& track) const;
     QList<TrackId> parseTrackIds(const QJsonArray& values, QStringList* errors) const;
     int ensureAutoDjPlaylistId(PlaylistDAO& playlistDao) const;
     std::optional<double> cpuUsagePercent() const;
@@ -126,6 +171,7 @@ class RestApiGateway : public RestApiProvider {
     mutable QMutex m_cpuUsageMutex;
     mutable std::optional<quint64> m_prevProcessTimeTicks;
     mutable std::optional<qint64> m_prevCpuWallTimeMs;
+    mutable QHash<QString, LibraryCacheEntry> m_libraryResponseCache;
     mutable QHash<QString, IdempotencyEntry> m_idempotencyCache;
     mutable QList<QString> m_idempotencyOrder;
     mutable QMutex m_idempotencyMutex;
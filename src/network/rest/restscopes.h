@@ -11,6 +11,7 @@ const QString kAutoDjRead = QStringLiteral("autodj:read");
 const QString kAutoDjWrite = QStringLiteral("autodj:write");
 const QString kPlaylistsRead = QStringLiteral("playlists:read");
 const QString kPlaylistsWrite = QStringLiteral("playlists:write");
+const QString kLibraryRead = QStringLiteral("library:read");
 const QString kControlWrite = QStringLiteral("control:write");
 
 inline QStringList defaultReadScopes() {
@@ -19,6 +20,7 @@ inline QStringList defaultReadScopes() {
             kDecksRead,
             kAutoDjRead,
             kPlaylistsRead,
+            kLibraryRead,
     };
 }
 
@@ -30,6 +32,7 @@ inline QStringList allScopes() {
             kAutoDjWrite,
             kPlaylistsRead,
             kPlaylistsWrite,
+            kLibraryRead,
             kControlWrite,
     };
 }
@@ -816,8 +816,14 @@ void RestServer::registerRoutes() {
                     {QStringList{scopes::kStatusRead}, QStringList{scopes::kStatusRead}}},
             {QStringLiteral("/api/v1/status"),
                     {QStringList{scopes::kStatusRead}, QStringList{scopes::kStatusRead}}},
+            {QStringLiteral("/api/v1/cpu"),
+                    {QStringList{scopes::kStatusRead}, QStringList{scopes::kStatusRead}}},
+            {QStringLiteral("/api/v1/latency"),
+                    {QStringList{scopes::kStatusRead}, QStringList{scopes::kStatusRead}}},
             {QStringLiteral("/api/v1/stream/status"),
                     {QStringList{scopes::kStatusRead}, QStringList{scopes::kStatusRead}}},
+            {QStringLiteral("/api/v1/stream/decks"),
+                    {QStringList{scopes::kDecksRead}, QStringList{scopes::kDecksRead}}},
             {QStringLiteral("/api/v1/decks"),
                     {QStringList{scopes::kDecksRead}, QStringList{scopes::kDecksRead}}},
             {QStringLiteral("/api/v1/autodj"),
@@ -826,6 +832,8 @@ void RestServer::registerRoutes() {
                     {QStringList{scopes::kControlWrite}, QStringList{scopes::kControlWrite}}},
             {QStringLiteral("/api/v1/playlists"),
                     {QStringList{scopes::kPlaylistsRead}, QStringList{scopes::kPlaylistsWrite}}},
+            {QStringLiteral("/api/v1/library/export"),
+                    {QStringList{scopes::kLibraryRead}, QStringList{scopes::kLibraryRead}}},
     };
 
     const auto toJsonArray = [](const QStringList& values) {
@@ -862,6 +870,12 @@ void RestServer::registerRoutes() {
             makeEndpoint(QStringLiteral("/api/v1/status"),
                     QStringList{QStringLiteral("GET")},
                     QStringList{scopes::kStatusRead}),
+            makeEndpoint(QStringLiteral("/api/v1/cpu"),
+                    QStringList{QStringLiteral("GET")},
+                    QStringList{scopes::kStatusRead}),
+            makeEndpoint(QStringLiteral("/api/v1/latency"),
+                    QStringList{QStringLiteral("GET")},
+                    QStringList{scopes::kStatusRead}),
             makeEndpoint(QStringLiteral("/api/v1/control"),
                     QStringList{QStringLiteral("POST")},
                     QStringList{},
@@ -874,6 +888,9 @@ void RestServer::registerRoutes() {
                     QStringList{QStringLiteral("GET"), QStringLiteral("POST")},
                     QStringList{scopes::kPlaylistsRead},
                     QStringList{scopes::kPlaylistsWrite}),
+            makeEndpoint(QStringLiteral("/api/v1/library/export"),
+                    QStringList{QStringLiteral("GET")},
+                    QStringList{scopes::kLibraryRead}),
     };
     const QJsonObject schemaPayload{
             {QStringLiteral("version"), QStringLiteral("v1")},
@@ -882,6 +899,8 @@ void RestServer::registerRoutes() {
                     QJsonObject{
                             {QStringLiteral("health"), QStringLiteral("/api/v1/health")},
                             {QStringLiteral("status"), QStringLiteral("/api/v1/status")},
+                            {QStringLiteral("cpu"), QStringLiteral("/api/v1/cpu")},
+                            {QStringLiteral("latency"), QStringLiteral("/api/v1/latency")},
                             {QStringLiteral("control"), QStringLiteral("/api/v1/control")},
                             {QStringLiteral("autodj"), QStringLiteral("/api/v1/autodj")},
                             {QStringLiteral("playlists"), QStringLiteral("/api/v1/playlists")},
@@ -1052,6 +1071,48 @@ void RestServer::registerRoutes() {
     };
     m_httpServer->route("/api/v1/status", statusRoute);
 
+    const auto cpuRoute = [this, authorizeRequest, forbiddenMessage](
+                                  const QHttpServerRequest& request) {
+        const AuthorizationResult auth = authorizeRequest(request);
+        if (!auth.authorized) {
+            if (auth.forbidden) {
+                return forbiddenResponse(request, forbiddenMessage(auth.missingScopes));
+            }
+            return unauthorizedResponse(request);
+        }
+        if (writeTokenRequiresTls(auth, request)) {
+            return tlsRequiredResponse(request);
+        }
+        if (request.method() != QHttpServerRequest::Method::Get) {
+            return methodNotAllowedResponse(request);
+        }
+        return invokeGateway(request, [this]() {
+            return m_gateway->cpu();
+        });
+    };
+    m_httpServer->route("/api/v1/cpu", cpuRoute);
+
+    const auto latencyRoute = [this, authorizeRequest, forbiddenMessage](
+                                      const QHttpServerRequest& request) {
+        const AuthorizationResult auth = authorizeRequest(request);
+        if (!auth.authorized) {
+            if (auth.forbidden) {
+                return forbiddenResponse(request, forbiddenMessage(auth.missingScopes));
+            }
+            return unauthorizedResponse(request);
+        }
+        if (writeTokenRequiresTls(auth, request)) {
+            return tlsRequiredResponse(request);
+        }
+        if (request.method() != QHttpServerRequest::Method::Get) {
+            return methodNotAllowedResponse(request);
+        }
+        return invokeGateway(request, [this]() {
+            return m_gateway->latency();
+        });
+    };
+    m_httpServer->route("/api/v1/latency", latencyRoute);
+
     const auto statusStreamRoute =
             [this, authorizeRequest, forbiddenMessage](
         const QHttpServerRequest& request,
@@ -1082,6 +1143,36 @@ void RestServer::registerRoutes() {
     };
     m_httpServer->route("/api/v1/stream/status", statusStreamRoute);
 
+    const auto deckStreamRoute =
+            [this, authorizeRequest, forbiddenMessage](
+        const QHttpServerRequest& request,
+        QHttpServerResponder& responder) {
+        if (!m_settings.streamEnabled) {
+            writeResponder(&responder, serviceUnavailableResponse(&request));
+            return;
+        }
+        const AuthorizationResult auth = authorizeRequest(request);
+        if (!auth.authorized) {
+            if (auth.forbidden) {
+                writeResponder(&responder,
+                        forbiddenResponse(request, forbiddenMessage(auth.missingScopes)));
+                return;
+            }
+            writeResponder(&responder, unauthorizedResponse(request));
+            return;
+        }
+        if (writeTokenRequiresTls(auth, request)) {
+            writeResponder(&responder, tlsRequiredResponse(request));
+            return;
+        }
+        if (request.method() != QHttpServerRequest::Method::Get) {
+            writeResponder(&responder, methodNotAllowedResponse(request));
+            return;
+        }
+        addDeckStreamClient(request, responder);
+    };
+    m_httpServer->route("/api/v1/stream/decks", deckStreamRoute);
+
     const auto decksRoute = [this, authorizeRequest, forbiddenMessage](
                                     const QHttpServerRequest& request) {
         const AuthorizationResult auth = authorizeRequest(request);
@@ -1273,8 +1364,33 @@ void RestServer::registerRoutes() {
                 }
                 playlistId = idValue;
             }
-            return invokeGateway(request, [this, playlistId]() {
-                return m_gateway->playlists(playlistId);
+            std::optional<int> limit;
+            const QString limitParam = request.query().queryItemValue("limit");
+            if (!limitParam.isEmpty()) {
+                bool ok = false;
+                const int limitValue = limitParam.toInt(&ok);
+                if (!ok || limitValue <= 0) {
+                    return badRequestResponse(request,
+                            QStringLiteral("Limit must be a positive number"));
+                }
+                limit = limitValue;
+            }
+            int offset = 0;
+            const QString offsetParam = request.query().queryItemValue("offset");
+            if (!offsetParam.isEmpty()) {
+                bool ok = false;
+                offset = offsetParam.toInt(&ok);
+                if (!ok || offset < 0) {
+                    return badRequestResponse(request,
+                            QStringLiteral("Offset must be a non-negative number"));
+                }
+            }
+            const QString ifNoneMatch = QString::fromLatin1(
+                    QByteArray(request.headers().value(
+                                       QByteArrayLiteral("If-None-Match")))
+                            .trimmed());
+            return invokeGateway(request, [this, playlistId, limit, offset, ifNoneMatch]() {
+                return m_gateway->playlists(playlistId, limit, offset, ifNoneMatch);
             });
         }
 
@@ -1321,15 +1437,64 @@ void RestServer::registerRoutes() {
                 requestId);
     };
     m_httpServer->route("/api/v1/playlists", playlistsRoute);
+
+    const auto libraryExportRoute = [this, authorizeRequest, forbiddenMessage](
+                                            const QHttpServerRequest& request) {
+        const AuthorizationResult auth = authorizeRequest(request);
+        if (!auth.authorized) {
+            if (auth.forbidden) {
+                return forbiddenResponse(request, forbiddenMessage(auth.missingScopes));
+            }
+            return unauthorizedResponse(request);
+        }
+        if (writeTokenRequiresTls(auth, request)) {
+            return tlsRequiredResponse(request);
+        }
+        if (request.method() != QHttpServerRequest::Method::Get) {
+            return methodNotAllowedResponse(request);
+        }
+        int sinceId = 0;
+        const QString sinceIdParam = request.query().queryItemValue("since_id");
+        if (!sinceIdParam.isEmpty()) {
+            bool ok = false;
+            sinceId = sinceIdParam.toInt(&ok);
+            if (!ok || sinceId < 0) {
+                return badRequestResponse(request,
+                        QStringLiteral("since_id must be a non-negative number"));
+            }
+        }
+        return invokeGateway(request, [this, sinceId]() {
+            return m_gateway->libraryExport(sinceId);
+        });
+    };
+    m_httpServer->route("/api/v1/library/export", libraryExportRoute);
 }
 
 void RestServer::addStatusStreamClient(
         const QHttpServerRequest& request,
         QHttpServerResponder& responder) {
+    addStreamClient(request, responder, &m_streamClients, fetchStatusPayload());
+}
+
+void RestServer::addDeckStreamClient(
+        const QHttpServerRequest& request,
+        QHttpServerResponder& responder) {
+    addStreamClient(request, responder, &m_deckStreamClients, fetchDecksPayload());
+}
+
+void RestServer::addStreamClient(
+        const QHttpServerRequest& request,
+        QHttpServerResponder& responder,
+        std::unordered_map<quint64, StreamClient>* pClients,
+        const QJsonObject& initialPayload) {
     DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(m_httpServer.get());
 
+    // The client limit applies to the total number of open streams
+    // across all stream endpoints.
+    const auto numStreamClients =
+            m_streamClients.size() + m_deckStreamClients.size();
     if (m_settings.streamMaxClients > 0 &&
-            static_cast<int>(m_streamClients.size()) >= m_settings.streamMaxClients) {
+            static_cast<int>(numStreamClients) >= m_settings.streamMaxClients) {
         const QString message = QStringLiteral("Too many stream clients");
         const QString requestId = requestIdFor(request);
         logRouteError(
@@ -1368,15 +1533,14 @@ void RestServer::addStatusStreamClient(
     }
 
     const quint64 clientId = ++m_streamClientCounter;
-    QJsonObject payload = fetchStatusPayload();
-    const QJsonObject delta = statusDelta(QJsonObject{}, payload);
-    StreamClient client{clientId, std::move(responder), payload};
-    auto result = m_streamClients.emplace(clientId, std::move(client));
+    const QJsonObject delta = statusDelta(QJsonObject{}, initialPayload);
+    StreamClient client{clientId, std::move(responder), initialPayload};
+    auto result = pClients->emplace(clientId, std::move(client));
     if (!result.second) {
         return;
     }
     if (!sendStatusStreamEvent(delta, &result.first->second.responder)) {
-        m_streamClients.erase(clientId);
+        pClients->erase(clientId);
     }
 
 }
@@ -1405,6 +1569,25 @@ QJsonObject RestServer::fetchStatusPayload() const {
     return payload;
 }
 
+QJsonObject RestServer::fetchDecksPayload() const {
+    if (m_gateway.isNull()) {
+        return QJsonObject{};
+    }
+    // All deck controls are read in one hop to the gateway thread per
+    // timer tick, shared by every connected deck stream client.
+    QJsonObject payload;
+    QSemaphore semaphore;
+    QMetaObject::invokeMethod(
+            m_gateway,
+            [&]() {
+                payload = m_gateway->decksPayload();
+                semaphore.release();
+            },
+            Qt::QueuedConnection);
+    semaphore.acquire();
+    return payload;
+}
+
 QJsonObject RestServer::statusDelta(
         const QJsonObject& previous,
         const QJsonObject& current) const {
@@ -1428,13 +1611,31 @@ void RestServer::pushStatusStreamUpdate() {
     if (!m_settings.streamEnabled || m_streamClients.empty()) {
         return;
     }
+    pushStreamUpdate(&m_streamClients, fetchStatusPayload());
+}
 
-    const QJsonObject payload = fetchStatusPayload();
-    for (auto it = m_streamClients.begin(); it != m_streamClients.end();) {
+void RestServer::pushDeckStreamUpdate() {
+    DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(m_httpServer.get());
+
+    if (!m_settings.streamEnabled || m_deckStreamClients.empty()) {
+        return;
+    }
+    pushStreamUpdate(&m_deckStreamClients, fetchDecksPayload());
+}
+
+void RestServer::pushStreamUpdate(
+        std::unordered_map<quint64, StreamClient>* pClients,
+        const QJsonObject& payload) {
+    for (auto it = pClients->begin(); it != pClients->end();) {
         StreamClient& client = it->second;
         const QJsonObject delta = statusDelta(client.lastPayload, payload);
+        if (delta.isEmpty()) {
+            // Nothing changed since the last event for this client.
+            ++it;
+            continue;
+        }
         if (!sendStatusStreamEvent(delta, &client.responder)) {
-            it = m_streamClients.erase(it);
+            it = pClients->erase(it);
             continue;
         }
         client.lastPayload = payload;
@@ -1585,6 +1786,18 @@ bool RestServer::startOnThread() {
             pushStatusStreamUpdate();
         });
         m_streamTimer.start();
+
+        m_deckStreamTimer.stop();
+        m_deckStreamTimer.setInterval(m_settings.streamDeckIntervalMs);
+        m_deckStreamTimer.setSingleShot(false);
+        if (m_deckStreamTimer.thread() != m_threadObject->thread()) {
+            m_deckStreamTimer.moveToThread(m_threadObject->thread());
+        }
+        QObject::disconnect(&m_deckStreamTimer, nullptr, nullptr, nullptr);
+        connect(&m_deckStreamTimer, &QTimer::timeout, m_threadObject.get(), [this]() {
+            pushDeckStreamUpdate();
+        });
+        m_deckStreamTimer.start();
     }
     return true;
 }
@@ -1592,7 +1805,9 @@ bool RestServer::startOnThread() {
 void RestServer::stopOnThread() {
     DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(m_threadObject.get());
     m_streamTimer.stop();
+    m_deckStreamTimer.stop();
     m_streamClients.clear();
+    m_deckStreamClients.clear();
     if (m_httpServer) {
         stopHttpServer(m_httpServer.get());
         m_httpServer.reset();
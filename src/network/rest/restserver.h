@@ -80,6 +80,7 @@ class RestServer : public QObject {
         QStringList corsAllowlist;
         bool streamEnabled{false};
         int streamIntervalMs{1000};
+        int streamDeckIntervalMs{50};
         int streamMaxClients{5};
 
         friend bool operator==(const Settings& lhs, const Settings& rhs) {
@@ -100,6 +101,7 @@ class RestServer : public QObject {
                     lhs.corsAllowlist == rhs.corsAllowlist &&
                     lhs.streamEnabled == rhs.streamEnabled &&
                     lhs.streamIntervalMs == rhs.streamIntervalMs &&
+                    lhs.streamDeckIntervalMs == rhs.streamDeckIntervalMs &&
                     lhs.streamMaxClients == rhs.streamMaxClients;
         }
 
@@ -174,14 +176,34 @@ class RestServer : public QObject {
             const AuthorizationResult& auth,
             const QHttpServerRequest& request) const;
     void registerRoutes();
+
+    struct StreamClient {
+        quint64 id;
+        QHttpServerResponder responder;
+        QJsonObject lastPayload;
+    };
+
+    void addStreamClient(
+            const QHttpServerRequest& request,
+            QHttpServerResponder& responder,
+            std::unordered_map<quint64, StreamClient>* pClients,
+            const QJsonObject& initialPayload);
     void addStatusStreamClient(
             const QHttpServerRequest& request,
             QHttpServerResponder& responder);
+    void addDeckStreamClient(
+            const QHttpServerRequest& request,
+            QHttpServerResponder& responder);
+    void pushStreamUpdate(
+            std::unordered_map<quint64, StreamClient>* pClients,
+            const QJsonObject& payload);
     void pushStatusStreamUpdate();
+    void pushDeckStreamUpdate();
     bool sendStatusStreamEvent(
             const QJsonObject& payload,
             QHttpServerResponder* responder) const;
     QJsonObject fetchStatusPayload() const;
+    QJsonObject fetchDecksPayload() const;
     QJsonObject statusDelta(const QJsonObject& previous, const QJsonObject& current) const;
     void logRouteError(
             const QHttpServerRequest& request,
@@ -198,12 +220,6 @@ class RestServer : public QObject {
     bool startOnThread();
     void stopOnThread();
 
-    struct StreamClient {
-        quint64 id;
-        QHttpServerResponder responder;
-        QJsonObject lastPayload;
-    };
-
     std::unique_ptr<QObject> m_threadObject;
     std::unique_ptr<QHttpServer> m_httpServer;
     std::unique_ptr<QTcpServer> m_tcpServer;
@@ -217,7 +233,9 @@ class RestServer : public QObject {
     QString m_lastError;
     quint64 m_streamClientCounter{0};
     std::unordered_map<quint64, StreamClient> m_streamClients;
+    std::unordered_map<quint64, StreamClient> m_deckStreamClients;
     QTimer m_streamTimer;
+    QTimer m_deckStreamTimer;
     mutable RateLimitedLogger m_routeErrorLogger;
     mutable RateLimitedLogger m_authFailureLogger;
 
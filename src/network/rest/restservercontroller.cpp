@@ -105,6 +105,7 @@ RestServerController::ListenerConfiguration RestServerController::loadSettings()
         }
         settings.streamEnabled = values.streamEnabled;
         settings.streamIntervalMs = values.streamIntervalMs;
+        settings.streamDeckIntervalMs = values.streamDeckIntervalMs;
         settings.streamMaxClients = values.streamMaxClients;
         return settings;
     };
@@ -14,6 +14,9 @@
 // TODO(rryan): Move to a utility file.
 namespace {
 const QString kTempFilenameExtension = QStringLiteral(".tmp");
+const QString kJournalFilenameExtension = QStringLiteral(".journal");
+const QString kJournalOpSet = QStringLiteral("set");
+const QString kJournalOpRemove = QStringLiteral("del");
 const QString kCMakeCacheFile = QStringLiteral("CMakeCache.txt");
 const QLatin1String kSourceDirLine = QLatin1String("mixxx_SOURCE_DIR:STATIC=");
 
@@ -165,7 +168,13 @@ template <class ValueType> ConfigObject<ValueType>::~ConfigObject() {
 template <class ValueType>
 void ConfigObject<ValueType>::set(const ConfigKey& k, const ValueType& v) {
     QWriteLocker lock(&m_valuesLock);
+    const auto it = m_values.constFind(k);
+    if (it != m_values.constEnd() && it.value().value == v.value) {
+        // Unchanged, don't grow the journal
+        return;
+    }
     m_values.insert(k, v);
+    writeJournal(kJournalOpSet, k, v.value);
 }
 
 template <class ValueType>
@@ -183,7 +192,11 @@ bool ConfigObject<ValueType>::exists(const ConfigKey& k) const {
 template <class ValueType>
 bool ConfigObject<ValueType>::remove(const ConfigKey& k) {
     QWriteLocker lock(&m_valuesLock);
-    return m_values.remove(k) > 0;
+    if (m_values.remove(k) > 0) {
+        writeJournal(kJournalOpRemove, k, QString());
+        return true;
+    }
+    return false;
 }
 
 template <class ValueType>
@@ -238,14 +251,109 @@ template <class ValueType> void ConfigObject<ValueType>::reopen(const QString& f
     m_filename = file;
     if (!m_filename.isEmpty()) {
         parse();
+        // Apply changes that a previous session journaled but did not
+        // get to compact into the config file anymore, e.g. after a
+        // crash. The journal is discarded by the next save(). Values
+        // loaded from the config file itself are not dirty.
+        m_dirty = replayJournal();
+    }
+    m_journalEnabled = true;
+}
+
+template <class ValueType>
+void ConfigObject<ValueType>::writeJournal(
+        const QString& op, const ConfigKey& k, const QString& value) {
+    m_dirty = true;
+    if (!m_journalEnabled || m_filename.isEmpty()) {
+        return;
     }
+    if (!m_journalFile.isOpen()) {
+        m_journalFile.setFileName(m_filename + kJournalFilenameExtension);
+        if (!m_journalFile.open(QIODevice::Append | QIODevice::Text)) {
+            qWarning() << "Could not write config journal file:"
+                       << m_journalFile.fileName();
+            return;
+        }
+    }
+    // One line per change: the operation, the bracketed group, the key
+    // and (for "set") the value. Keys cannot contain whitespace in the
+    // config file format, values can.
+    QTextStream stream(&m_journalFile);
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    stream.setCodec("UTF-8");
+#endif
+    stream << op << " " << k.group << " " << k.item;
+    if (op == kJournalOpSet) {
+        stream << " " << value;
+    }
+    stream << "\n";
+    stream.flush();
+    m_journalFile.flush();
+}
+
+template <class ValueType>
+bool ConfigObject<ValueType>::replayJournal() {
+    QFile journalFile(m_filename + kJournalFilenameExtension);
+    if (!journalFile.exists() ||
+            !journalFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return false;
+    }
+    qDebug() << "ConfigObject: Replaying config journal" << journalFile.fileName();
+    bool applied = false;
+    QTextStream text(&journalFile);
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    DEBUG_ASSERT(text.encoding() == QStringConverter::Utf8);
+#else
+    text.setCodec("UTF-8");
+#endif
+    while (!text.atEnd()) {
+        const QString line = text.readLine().trimmed();
+        // The group is bracketed and may contain whitespace, the key is
+        // the first token after it.
+        const qsizetype groupStart = line.indexOf(QChar('['));
+        const qsizetype groupEnd = line.indexOf(QChar(']'), groupStart);
+        if (groupStart < 0 || groupEnd < 0) {
+            // Incomplete line, e.g. truncated by a crash while writing
+            continue;
+        }
+        const QString op = line.left(groupStart).trimmed();
+        const QString group = line.mid(groupStart, groupEnd - groupStart + 1);
+        const QString remainder = line.mid(groupEnd + 1).trimmed();
+        QString key = remainder;
+        QString value;
+        const qsizetype keyEnd = remainder.indexOf(QChar(' '));
+        if (keyEnd >= 0) {
+            key = remainder.left(keyEnd);
+            value = remainder.mid(keyEnd + 1).trimmed();
+        }
+        if (key.isEmpty()) {
+            continue;
+        }
+        const ConfigKey k(group, key);
+        if (op == kJournalOpSet) {
+            m_values.insert(k, ValueType(value));
+            applied = true;
+        } else if (op == kJournalOpRemove) {
+            m_values.remove(k);
+            applied = true;
+        }
+    }
+    return applied;
 }
 
 /// Save the ConfigObject to disk.
 /// Returns true on success
 template<class ValueType>
 bool ConfigObject<ValueType>::save() {
-    QReadLocker lock(&m_valuesLock); // we only read the m_values here.
+    // A write lock, although m_values is only read: the journal state
+    // is mutated below and must not race with concurrent set() calls.
+    QWriteLocker lock(&m_valuesLock);
+    if (!m_dirty && QFile::exists(m_filename)) {
+        // All values already match the file on disk, e.g. when nothing
+        // was changed during the session. Skips the full rewrite on
+        // shutdown.
+        return true;
+    }
     QFile tmpFile(m_filename + kTempFilenameExtension);
     if (!QDir(QFileInfo(tmpFile).absolutePath()).exists()) {
         QDir().mkpath(QFileInfo(tmpFile).absolutePath());
@@ -310,6 +418,13 @@ bool ConfigObject<ValueType>::save() {
         return false;
     }
 
+    // All journaled changes are now compacted into the config file.
+    if (m_journalFile.isOpen()) {
+        m_journalFile.close();
+    }
+    QFile::remove(m_filename + kJournalFilenameExtension);
+    m_dirty = false;
+
     return true;
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QDomNode>
+#include <QFile>
 #include <QHash>
 #include <QKeySequence>
 #include <QMap>
@@ -62,12 +63,14 @@ inline QDebug operator<<(QDebug stream, const ConfigKey& configKey) {
     return stream;
 }
 
-// QHash hash function for ConfigKey objects.
+// QHash hash function for ConfigKey objects. Combining the group and
+// item hashes with qHashMulti() instead of XOR avoids systematic
+// collisions, e.g. keys with swapped group/item or with group == item
+// would otherwise all hash to the same value.
 inline qhash_seed_t qHash(
         const ConfigKey& key,
         qhash_seed_t seed = 0) {
-    return qHash(key.group, seed) ^
-            qHash(key.item, seed);
+    return qHashMulti(seed, key.group, key.item);
 }
 
 // The value corresponding to a key. The basic value is a string, but can be
@@ -220,6 +223,25 @@ template <class ValueType> class ConfigObject {
     // Loads and parses the configuration file. Returns false if the file could
     // not be opened; otherwise true.
     bool parse();
+
+  private:
+    // Appends a single change to the journal file next to the config
+    // file. Must be called with m_valuesLock held for writing.
+    void writeJournal(const QString& op, const ConfigKey& k, const QString& value);
+    // Applies the entries of a journal left behind by a crashed session
+    // on top of the parsed values. Returns true if any entry was applied.
+    bool replayJournal();
+
+    // Journal of changes since the last full save. Every set()/remove()
+    // appends one line and flushes, so a crash loses at most the very
+    // last change. save() rewrites the whole config file and discards
+    // the journal; replaying a stale journal after a completed save is
+    // harmless because the entries are idempotent.
+    QFile m_journalFile;
+    // Disabled while the values are populated from disk in reopen().
+    bool m_journalEnabled = false;
+    // Whether any value changed since the last successful save().
+    bool m_dirty = false;
 };
 
 // Specialization must be declared before the first use that would cause
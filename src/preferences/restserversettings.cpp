@@ -30,6 +30,7 @@ const QString kConfigMaxRequestBytes = QStringLiteral("max_request_bytes");
 const QString kConfigCorsAllowlist = QStringLiteral("cors_allowlist");
 const QString kConfigStreamEnabled = QStringLiteral("stream_enabled");
 const QString kConfigStreamIntervalMs = QStringLiteral("stream_interval_ms");
+const QString kConfigStreamDeckIntervalMs = QStringLiteral("stream_deck_interval_ms");
 const QString kConfigStreamMaxClients = QStringLiteral("stream_max_clients");
 const QString kConfigStatusRunning = QStringLiteral("status_running");
 const QString kConfigStatusTlsActive = QStringLiteral("status_tls_active");
@@ -89,6 +90,9 @@ RestServerSettings::Values applyDefaults(const RestServerSettings::Values& value
     if (sanitized.streamIntervalMs <= 0) {
         sanitized.streamIntervalMs = RestServerSettings::kDefaultStreamIntervalMs;
     }
+    if (sanitized.streamDeckIntervalMs <= 0) {
+        sanitized.streamDeckIntervalMs = RestServerSettings::kDefaultStreamDeckIntervalMs;
+    }
     if (sanitized.streamMaxClients <= 0) {
         sanitized.streamMaxClients = RestServerSettings::kDefaultStreamMaxClients;
     }
@@ -189,6 +193,9 @@ RestServerSettings::Values RestServerSettings::get() const {
     values.streamIntervalMs = m_pConfig->getValue<int>(
             ConfigKey(kConfigGroup, kConfigStreamIntervalMs),
             kDefaultStreamIntervalMs);
+    values.streamDeckIntervalMs = m_pConfig->getValue<int>(
+            ConfigKey(kConfigGroup, kConfigStreamDeckIntervalMs),
+            kDefaultStreamDeckIntervalMs);
     values.streamMaxClients = m_pConfig->getValue<int>(
             ConfigKey(kConfigGroup, kConfigStreamMaxClients),
             kDefaultStreamMaxClients);
@@ -249,6 +256,8 @@ void RestServerSettings::set(const Values& values) {
     m_pConfig->setValue(ConfigKey(kConfigGroup, kConfigStreamEnabled), sanitized.streamEnabled);
     m_pConfig->setValue(ConfigKey(kConfigGroup, kConfigStreamIntervalMs),
             sanitized.streamIntervalMs);
+    m_pConfig->setValue(ConfigKey(kConfigGroup, kConfigStreamDeckIntervalMs),
+            sanitized.streamDeckIntervalMs);
     m_pConfig->setValue(ConfigKey(kConfigGroup, kConfigStreamMaxClients),
             sanitized.streamMaxClients);
 }
@@ -271,6 +280,7 @@ RestServerSettings::Values RestServerSettings::defaults() const {
     values.corsAllowlist = QString::fromLatin1(kDefaultCorsAllowlist);
     values.streamEnabled = false;
     values.streamIntervalMs = kDefaultStreamIntervalMs;
+    values.streamDeckIntervalMs = kDefaultStreamDeckIntervalMs;
     values.streamMaxClients = kDefaultStreamMaxClients;
     return values;
 }
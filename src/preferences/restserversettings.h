@@ -45,6 +45,7 @@ class RestServerSettings {
         QString corsAllowlist;
         bool streamEnabled{false};
         int streamIntervalMs{0};
+        int streamDeckIntervalMs{0};
         int streamMaxClients{0};
     };
 
@@ -63,6 +64,7 @@ class RestServerSettings {
     static constexpr int kDefaultHttpsPort = 8990;
     static constexpr int kDefaultMaxRequestBytes = 64 * 1024;
     static constexpr int kDefaultStreamIntervalMs = 1000;
+    static constexpr int kDefaultStreamDeckIntervalMs = 50;
     static constexpr int kDefaultStreamMaxClients = 5;
     static constexpr const char* kDefaultCorsAllowlist = "*";
 
@@ -46,7 +46,11 @@ QmlLibraryTrackListModel::QmlLibraryTrackListModel(
         QAbstractItemModel* pModel,
         QObject* pParent)
         : QIdentityProxyModel(pParent),
-          m_columns() {
+          m_columns(),
+          m_pTrackModel(nullptr),
+          m_pTrackTableModel(nullptr),
+          m_colorColumn(-1),
+          m_locationColumn(-1) {
     m_columns.reserve(librarySource.size());
     for (const auto* pColumn : std::as_const(librarySource)) {
         m_columns.emplace_back(make_parented<QmlLibraryTrackListColumn>(this,
@@ -64,6 +68,29 @@ QmlLibraryTrackListModel::QmlLibraryTrackListModel(
     }
     pTrackModel->select();
     setSourceModel(pModel);
+
+    // Resolve the downcasts and the source column of every QML column up
+    // front; data() must not repeat this work for every visible cell.
+    m_pTrackModel = pTrackModel;
+    m_pTrackTableModel = qobject_cast<BaseTrackTableModel*>(pModel);
+    m_sourceColumns.reserve(m_columns.size());
+    for (const auto& pColumn : m_columns) {
+        if (pColumn->columnIdx() < 0) {
+            m_sourceColumns.push_back(-1);
+        } else {
+            m_sourceColumns.push_back(m_pTrackTableModel != nullptr
+                            ? m_pTrackTableModel->fieldIndex(
+                                      static_cast<ColumnCache::Column>(
+                                              pColumn->columnIdx()))
+                            : pColumn->columnIdx());
+        }
+    }
+    if (m_pTrackTableModel != nullptr) {
+        m_colorColumn = m_pTrackTableModel->fieldIndex(
+                ColumnCache::COLUMN_LIBRARYTABLE_COLOR);
+        m_locationColumn = m_pTrackTableModel->fieldIndex(
+                ColumnCache::COLUMN_TRACKLOCATIONSTABLE_LOCATION);
+    }
 }
 
 QVariant QmlLibraryTrackListModel::data(const QModelIndex& proxyIndex, int role) const {
@@ -79,40 +106,35 @@ QVariant QmlLibraryTrackListModel::data(const QModelIndex& proxyIndex, int role)
         return {};
     }
 
-    auto* const pTrackTableModel = qobject_cast<BaseTrackTableModel*>(sourceModel());
-    auto* const pTrackModel = dynamic_cast<TrackModel*>(sourceModel());
-
     const auto& pColumn = m_columns[columnIdx];
 
     switch (role) {
     case Track: {
-        if (pTrackModel == nullptr) {
+        if (m_pTrackModel == nullptr) {
             return {};
         }
-        auto pTrack = make_qml_owned<QmlTrackProxy>(pTrackModel->getTrack(
+        auto pTrack = make_qml_owned<QmlTrackProxy>(m_pTrackModel->getTrack(
                 QIdentityProxyModel::mapToSource(proxyIndex)));
         return QVariant::fromValue(pTrack.get());
     }
     case Qt::DecorationRole: {
-        if (pTrackTableModel == nullptr) {
+        if (m_pTrackTableModel == nullptr) {
             return {};
         };
         return colorFromRgbCode(QIdentityProxyModel::data(
-                proxyIndex.siblingAtColumn(pTrackTableModel->fieldIndex(
-                        ColumnCache::COLUMN_LIBRARYTABLE_COLOR)),
+                proxyIndex.siblingAtColumn(m_colorColumn),
                 Qt::DisplayRole)
                         .toDouble());
     }
     case CoverArt: {
         QString location;
-        if (pTrackTableModel != nullptr) {
+        if (m_pTrackTableModel != nullptr) {
             location = QIdentityProxyModel::data(
-                    proxyIndex.siblingAtColumn(pTrackTableModel->fieldIndex(
-                            ColumnCache::COLUMN_TRACKLOCATIONSTABLE_LOCATION)),
+                    proxyIndex.siblingAtColumn(m_locationColumn),
                     Qt::DisplayRole)
                                .toString();
-        } else if (pTrackModel != nullptr) {
-            auto pTrack = pTrackModel->getTrack(
+        } else if (m_pTrackModel != nullptr) {
+            auto pTrack = m_pTrackModel->getTrack(
                     QIdentityProxyModel::mapToSource(proxyIndex));
             location = pTrack->getCoverInfo().coverLocation;
         }
@@ -123,25 +145,24 @@ QVariant QmlLibraryTrackListModel::data(const QModelIndex& proxyIndex, int role)
         return AsyncImageProvider::trackLocationToCoverArtUrl(location);
     }
     case FileURL: {
-        if (pTrackModel == nullptr) {
+        if (m_pTrackModel == nullptr) {
             return {};
         }
-        return pTrackModel->getTrackUrl(QIdentityProxyModel::mapToSource(proxyIndex));
+        return m_pTrackModel->getTrackUrl(QIdentityProxyModel::mapToSource(proxyIndex));
     }
     case Delegate:
         return QVariant::fromValue(pColumn->delegate());
         break;
     }
-    if (pColumn->columnIdx() < 0) {
+    const int sourceColumn = columnIdx < static_cast<int>(m_sourceColumns.size())
+            ? m_sourceColumns[columnIdx]
+            : pColumn->columnIdx();
+    if (sourceColumn < 0) {
         // Use proxyIndex.column()
         return QIdentityProxyModel::data(proxyIndex, role);
     }
     return QIdentityProxyModel::data(
-            proxyIndex.siblingAtColumn(pTrackTableModel != nullptr
-                            ? pTrackTableModel->fieldIndex(
-                                      static_cast<ColumnCache::Column>(
-                                              pColumn->columnIdx()))
-                            : pColumn->columnIdx()),
+            proxyIndex.siblingAtColumn(sourceColumn),
             role);
 }
 
@@ -167,30 +188,24 @@ QHash<int, QByteArray> QmlLibraryTrackListModel::roleNames() const {
 }
 
 QUrl QmlLibraryTrackListModel::getUrl(int row) const {
-    auto* const pTrackModel = dynamic_cast<TrackModel*>(sourceModel());
-
-    if (pTrackModel == nullptr) {
+    if (m_pTrackModel == nullptr) {
         // TODO search for column with role
         return {};
     }
-    return pTrackModel->getTrackUrl(sourceModel()->index(row, 0));
+    return m_pTrackModel->getTrackUrl(sourceModel()->index(row, 0));
 }
 
 QmlTrackProxy* QmlLibraryTrackListModel::getTrack(int row) const {
-    auto* const pTrackModel = dynamic_cast<TrackModel*>(sourceModel());
-
-    if (pTrackModel == nullptr) {
+    if (m_pTrackModel == nullptr) {
         // TODO search for column with role
         return {};
     }
-    return make_qml_owned<QmlTrackProxy>(pTrackModel->getTrack(sourceModel()->index(row, 0)));
+    return make_qml_owned<QmlTrackProxy>(m_pTrackModel->getTrack(sourceModel()->index(row, 0)));
 }
 
 TrackModel::Capabilities QmlLibraryTrackListModel::getCapabilities() const {
-    auto* const pTrackModel = dynamic_cast<TrackModel*>(sourceModel());
-
-    if (pTrackModel != nullptr) {
-        return pTrackModel->getCapabilities();
+    if (m_pTrackModel != nullptr) {
+        return m_pTrackModel->getCapabilities();
     }
     return TrackModel::Capability::None;
 }
@@ -201,20 +216,16 @@ void QmlLibraryTrackListModel::sort(int column, Qt::SortOrder order) {
     VERIFY_OR_DEBUG_ASSERT(column >= 0 || column < m_columns.size()) {
         return;
     }
-    const auto& pColumn = m_columns[column];
     emit layoutAboutToBeChanged(QList<QPersistentModelIndex>(),
             QAbstractItemModel::VerticalSortHint);
-    if (pColumn->columnIdx() < 0) {
+    const int sourceColumn = column < static_cast<int>(m_sourceColumns.size())
+            ? m_sourceColumns[column]
+            : m_columns[column]->columnIdx();
+    if (sourceColumn < 0) {
         // Use proxyIndex.column()
         return sourceModel()->sort(column, order);
     }
-    auto* const pTrackTableModel = qobject_cast<BaseTrackTableModel*>(sourceModel());
-    sourceModel()->sort(pTrackTableModel != nullptr
-                    ? pTrackTableModel->fieldIndex(
-                              static_cast<ColumnCache::Column>(
-                                      pColumn->columnIdx()))
-                    : pColumn->columnIdx(),
-            order);
+    sourceModel()->sort(sourceColumn, order);
     emit layoutChanged(QList<QPersistentModelIndex>(), QAbstractItemModel::VerticalSortHint);
 }
 
@@ -6,6 +6,8 @@
 #include "qml/qmllibrarytracklistcolumn.h"
 #include "qml/qmltrackproxy.h"
 
+class BaseTrackTableModel;
+
 namespace mixxx {
 namespace qml {
 
@@ -79,6 +81,19 @@ class QmlLibraryTrackListModel : public QIdentityProxyModel {
   private:
     std::vector<parented_ptr<QmlLibraryTrackListColumn>> m_columns;
 
+    // Downcasts of sourceModel(), resolved once in the constructor. data()
+    // is called for every role of every visible cell while scrolling, so
+    // the per-call dynamic_cast/qobject_cast are too expensive there.
+    TrackModel* m_pTrackModel;
+    BaseTrackTableModel* m_pTrackTableModel;
+    // Source column of each QML column (fieldIndex() already applied), -1
+    // if the proxy column index is used as-is.
+    std::vector<int> m_sourceColumns;
+    // Source columns of the color and location fields used by the
+    // Decoration and CoverArt roles.
+    int m_colorColumn;
+    int m_locationColumn;
+
     static void parent_qlist_append(
             QQmlListProperty<QmlLibraryTrackListColumn>* p,
             QmlLibraryTrackListColumn* v) {
@@ -15,6 +15,11 @@
 #define RECORD_READY 1.0
 #define RECORD_ON 2.0
 #define RECORD_SPLIT_CONTINUE 3.0
+// Announces an upcoming RECORD_SPLIT_CONTINUE shortly before the split
+// threshold is reached so EngineRecord can open the next file and
+// initialize its encoder in advance. Recording continues into the
+// current file until the actual split.
+#define RECORD_SPLIT_PREPARE 4.0
 
 //File options for preferences Splitting
 #define SPLIT_650MB "650 MB (CD)"
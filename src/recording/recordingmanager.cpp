@@ -16,6 +16,17 @@
 
 #define MIN_DISK_FREE 1024 * 1024 * 1024ll // one gibibyte
 
+namespace {
+
+// Announce an upcoming split this far ahead of the actual threshold so
+// EngineRecord can open the next file and initialize its encoder while
+// recording still runs into the current file. The margins are generous;
+// preparing too early only means the next file sits idle a bit longer.
+constexpr quint64 kSplitPrepareMarginBytes = 8 * 1024 * 1024;
+constexpr unsigned int kSplitPrepareMarginSeconds = 10;
+
+} // anonymous namespace
+
 RecordingManager::RecordingManager(UserSettingsPointer pConfig, EngineMixer* pEngine)
         : m_pConfig(pConfig),
           m_recordingDir(""),
@@ -23,6 +34,7 @@ RecordingManager::RecordingManager(UserSettingsPointer pConfig, EngineMixer* pEn
           m_recordingFile(""),
           m_recordingLocation(""),
           m_bRecording(false),
+          m_bSplitPrepared(false),
           m_iNumberOfBytesRecorded(0),
           m_iNumberOfBytesRecordedSplit(0),
           m_split_size(0),
@@ -121,6 +133,7 @@ void RecordingManager::startRecording() {
     }
 
     m_iNumberSplits = 1;
+    m_bSplitPrepared = false;
     // Append file extension.
     QString date_time_str = formatDateTimeForFilename(QDateTime::currentDateTime());
     m_recordingFile = QString("%1.%2")
@@ -144,13 +157,14 @@ void RecordingManager::splitContinueRecording()
 
     m_iNumberOfBytesRecordedSplit = 0;
     m_secondsRecordedSplit=0;
+    m_bSplitPrepared = false;
 
     QString encodingType = m_pConfig->getValueString(ConfigKey(RECORDING_PREF_KEY, "Encoding"));
     QString fileExtension = EncoderFactory::getFactory()
                                     .getFormatFor(encodingType)
                                     .fileExtension;
 
-    QString new_base_filename = m_recording_base_file + QStringLiteral("part") + QString::number(m_iNumberSplits);
+    QString new_base_filename = splitBaseFilename(m_iNumberSplits);
     m_recordingLocation = new_base_filename + QChar('.') + fileExtension;
 
     m_pConfig->set(ConfigKey(RECORDING_PREF_KEY, "Path"), m_recordingLocation);
@@ -160,6 +174,32 @@ void RecordingManager::splitContinueRecording()
     m_pCoRecStatus->set(RECORD_SPLIT_CONTINUE);
 }
 
+void RecordingManager::splitPrepareRecording()
+{
+    m_bSplitPrepared = true;
+
+    QString encodingType = m_pConfig->getValueString(ConfigKey(RECORDING_PREF_KEY, "Encoding"));
+    QString fileExtension = EncoderFactory::getFactory()
+                                    .getFormatFor(encodingType)
+                                    .fileExtension;
+
+    // Publish the name of the upcoming split, but do not touch
+    // m_recordingLocation/m_recordingFile yet; the GUI keeps showing the
+    // file we are still recording into. splitContinueRecording() computes
+    // the same name again when the split actually happens.
+    QString new_base_filename = splitBaseFilename(m_iNumberSplits + 1);
+    m_pConfig->set(ConfigKey(RECORDING_PREF_KEY, "Path"),
+            ConfigValue(new_base_filename + QChar('.') + fileExtension));
+    m_pConfig->set(ConfigKey(RECORDING_PREF_KEY, "CuePath"),
+            ConfigValue(new_base_filename + QStringLiteral(".cue")));
+
+    m_pCoRecStatus->set(RECORD_SPLIT_PREPARE);
+}
+
+QString RecordingManager::splitBaseFilename(int splitNumber) const {
+    return m_recording_base_file + QStringLiteral("part") + QString::number(splitNumber);
+}
+
 void RecordingManager::stopRecording() {
     qDebug() << "Recording stopped";
     m_pCoRecStatus->set(RECORD_OFF);
@@ -202,6 +242,9 @@ void RecordingManager::slotDurationRecorded(quint64 duration) {
             qDebug() << "Splitting after " << duration << " seconds";
             // This will reuse the previous filename but append a suffix.
             splitContinueRecording();
+        } else if (!m_bSplitPrepared && m_split_time < INT_MAX &&
+                duration + kSplitPrepareMarginSeconds >= m_split_time) {
+            splitPrepareRecording();
         }
         emit durationRecorded(getRecordedDurationStr(m_secondsRecorded+m_secondsRecordedSplit));
     }
@@ -227,6 +270,9 @@ void RecordingManager::slotBytesRecorded(int bytes) {
         qDebug() << "Splitting after " << m_iNumberOfBytesRecorded << " bytes written";
         // This will reuse the previous filename but append a suffix.
         splitContinueRecording();
+    } else if (!m_bSplitPrepared &&
+            m_iNumberOfBytesRecordedSplit + kSplitPrepareMarginBytes >= m_split_size) {
+        splitPrepareRecording();
     }
     emit bytesRecorded(m_iNumberOfBytesRecorded);
 
@@ -57,6 +57,13 @@ class RecordingManager : public QObject {
     // to split the file. The nth filename will follow the date/time
     // name of the first split but with a suffix.
     void splitContinueRecording();
+    // Called shortly before the split threshold is reached. Publishes the
+    // filename of the upcoming split and asks EngineRecord to open it and
+    // initialize its encoder in advance, so the split itself only has to
+    // swap files instead of doing encoder setup on the recording thread.
+    void splitPrepareRecording();
+    // Base filename (without extension) of the given split number.
+    QString splitBaseFilename(int splitNumber) const;
     void warnFreespace();
     std::unique_ptr<ControlObject> m_pCoRecStatus;
     std::unique_ptr<ControlPushButton> m_pToggleRecording;
@@ -75,6 +82,9 @@ class RecordingManager : public QObject {
     QString m_recordingLocation;
 
     bool m_bRecording;
+    // Whether the upcoming split has already been announced via
+    // RECORD_SPLIT_PREPARE. Reset when the split actually happens.
+    bool m_bSplitPrepared;
     bool m_dfSilence;
     qint64 m_dfCounter;
 
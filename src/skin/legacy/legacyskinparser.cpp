@@ -1,5 +1,6 @@
 #include "skin/legacy/legacyskinparser.h"
 
+#include <QDateTime>
 #include <QDir>
 #include <QGridLayout>
 #include <QLabel>
@@ -102,6 +103,68 @@ QSet<QString> LegacySkinParser::s_sharedGroupStrings;
 
 static bool sDebug = false;
 
+/// Parsed skin and template documents shared across LegacySkinParser
+/// instances. The DOM is never mutated after parsing, so re-parsing the same
+/// XML files on every skin or color scheme change is pure overhead. Entries
+/// are validated against the file modification time and size, so edits made
+/// while Mixxx is running (e.g. during skin development) are still picked up
+/// on the next skin reload.
+struct CachedDomDocument {
+    QDateTime lastModified;
+    qint64 fileSize;
+    QDomElement documentElement;
+};
+
+static QHash<QString, CachedDomDocument> s_domDocumentCache;
+
+// Parse the XML document at absolutePath and return its document element,
+// reusing the result of a previous parse if the file is unchanged.
+static QDomElement parseDomDocument(const QString& absolutePath) {
+    QFileInfo fileInfo(absolutePath);
+
+    auto it = s_domDocumentCache.constFind(absolutePath);
+    if (it != s_domDocumentCache.constEnd() &&
+            it->lastModified == fileInfo.lastModified() &&
+            it->fileSize == fileInfo.size()) {
+        return it->documentElement;
+    }
+
+    QFile file(absolutePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "LegacySkinParser::parseDomDocument - can't open file:" << absolutePath;
+        return QDomElement();
+    }
+
+    QDomDocument document;
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 5, 0)
+    const auto parseResult = document.setContent(&file);
+    if (!parseResult) {
+        qWarning() << "LegacySkinParser::parseDomDocument - setContent failed see"
+                   << absolutePath << "line:" << parseResult.errorLine
+                   << "column:" << parseResult.errorColumn;
+        qWarning() << "LegacySkinParser::parseDomDocument - message:"
+                   << parseResult.errorMessage;
+#else
+    QString errorMessage;
+    int errorLine;
+    int errorColumn;
+
+    if (!document.setContent(&file, &errorMessage, &errorLine, &errorColumn)) {
+        qWarning() << "LegacySkinParser::parseDomDocument - setContent failed see"
+                   << absolutePath << "line:" << errorLine << "column:" << errorColumn;
+        qWarning() << "LegacySkinParser::parseDomDocument - message:" << errorMessage;
+#endif
+        return QDomElement();
+    }
+
+    s_domDocumentCache.insert(absolutePath,
+            CachedDomDocument{fileInfo.lastModified(),
+                    fileInfo.size(),
+                    document.documentElement()});
+    return document.documentElement();
+}
+
 ControlObject* LegacySkinParser::controlFromConfigKey(
         const ConfigKey& key, bool bPersist, bool* pCreated) {
     if (!key.isValid()) {
@@ -225,38 +288,10 @@ QDomElement LegacySkinParser::openSkin(const QString& skinPath) {
         return QDomElement();
     }
 
-    QString skinXmlPath = skinDir.filePath("skin.xml");
-    QFile skinXmlFile(skinXmlPath);
-
-    if (!skinXmlFile.open(QIODevice::ReadOnly)) {
-        qDebug() << "LegacySkinParser::openSkin - can't open file:" << skinXmlPath
-                 << "in directory:" << skinDir.path();
-        return QDomElement();
-    }
-
-    QDomDocument skin("skin");
-
-#if QT_VERSION >= QT_VERSION_CHECK(6, 5, 0)
-    const auto parseResult = skin.setContent(&skinXmlFile);
-    if (!parseResult) {
-        qDebug() << "LegacySkinParser::openSkin - setContent failed see"
-                 << "line:" << parseResult.errorLine << "column:" << parseResult.errorColumn;
-        qDebug() << "LegacySkinParser::openSkin - message:" << parseResult.errorMessage;
-#else
-    QString errorMessage;
-    int errorLine;
-    int errorColumn;
-
-    if (!skin.setContent(&skinXmlFile,&errorMessage,&errorLine,&errorColumn)) {
-        qDebug() << "LegacySkinParser::openSkin - setContent failed see"
-                 << "line:" << errorLine << "column:" << errorColumn;
-        qDebug() << "LegacySkinParser::openSkin - message:" << errorMessage;
-#endif
-        return QDomElement();
-    }
-
-    skinXmlFile.close();
-    return skin.documentElement();
+    // The launch image, the color scheme list and the actual skin parse all
+    // open skin.xml, so the shared document cache saves repeated XML parses
+    // within a single startup in addition to warm skin switches.
+    return parseDomDocument(skinDir.filePath("skin.xml"));
 }
 
 // static
@@ -286,6 +321,11 @@ void LegacySkinParser::clearSharedGroupStrings() {
     s_sharedGroupStrings.clear();
 }
 
+// static
+void LegacySkinParser::clearDomCache() {
+    s_domDocumentCache.clear();
+}
+
 SkinManifest LegacySkinParser::getSkinManifest(const QDomElement& skinDocument) {
     QDomNode manifest_node = skinDocument.namedItem("manifest");
     SkinManifest manifest;
@@ -1844,44 +1884,22 @@ QDomElement LegacySkinParser::loadTemplate(const QString& path) {
 
     QString absolutePath = templateFileInfo.absoluteFilePath();
 
+    // The per-instance cache avoids re-checking the file stamp for every
+    // template instantiation during a single parse and preserves the
+    // behavior that setSkinTemplatePath() is only called once per template.
     auto it = m_templateCache.constFind(absolutePath);
     if (it != m_templateCache.constEnd()) {
         return it.value();
     }
 
-    QFile templateFile(absolutePath);
-
-    if (!templateFile.open(QIODevice::ReadOnly)) {
-        qWarning() << "Could not open template file:" << absolutePath;
-        return QDomElement();
-    }
-
-    QDomDocument tmpl("template");
-
-#if QT_VERSION >= QT_VERSION_CHECK(6, 5, 0)
-    const auto parseResult = tmpl.setContent(&templateFile);
-    if (!parseResult) {
-        qWarning() << "LegacySkinParser::loadTemplate - setContent failed see"
-                   << absolutePath << "line:" << parseResult.errorLine
-                   << "column:" << parseResult.errorColumn;
-        qWarning() << "LegacySkinParser::loadTemplate - message:" << parseResult.errorMessage;
-#else
-    QString errorMessage;
-    int errorLine;
-    int errorColumn;
-
-    if (!tmpl.setContent(&templateFile, &errorMessage,
-                         &errorLine, &errorColumn)) {
-        qWarning() << "LegacySkinParser::loadTemplate - setContent failed see"
-                   << absolutePath << "line:" << errorLine << "column:" << errorColumn;
-        qWarning() << "LegacySkinParser::loadTemplate - message:" << errorMessage;
-#endif
+    QDomElement templateElement = parseDomDocument(absolutePath);
+    if (templateElement.isNull()) {
         return QDomElement();
     }
 
-    m_templateCache[absolutePath] = tmpl.documentElement();
+    m_templateCache[absolutePath] = templateElement;
     m_pContext->setSkinTemplatePath(templateFileInfo.absoluteDir().absolutePath());
-    return tmpl.documentElement();
+    return templateElement;
 }
 
 QList<QWidget*> LegacySkinParser::parseTemplate(const QDomElement& node) {
@@ -52,6 +52,10 @@ class LegacySkinParser : public QObject, public SkinParser {
     // Parse a skin manifest from the provided skin document root.
     static mixxx::skin::SkinManifest getSkinManifest(const QDomElement& skinDocument);
     static void clearSharedGroupStrings();
+    // Drop all skin and template documents cached by openSkin() and
+    // loadTemplate(). The cache is keyed by file path and validated against
+    // the file stamp, so this is only needed to release the memory.
+    static void clearDomCache();
 
     static Qt::MouseButton parseButtonState(const QDomNode& node,
                                             const SkinContext& context);
@@ -3,13 +3,15 @@
 #include "moc_tooltips.cpp"
 
 Tooltips::Tooltips() {
-    addStandardTooltips();
 }
 
 Tooltips::~Tooltips() {
 }
 
 QString Tooltips::tooltipForId(const QString& id) const {
+    if (m_tooltips.isEmpty()) {
+        addStandardTooltips();
+    }
     // We always add a separator at the end.
     QString joined = m_tooltips.value(id, QStringList()).join(tooltipSeparator());
     if (joined.length() > 0) {
@@ -22,11 +24,11 @@ QString Tooltips::tooltipSeparator() const {
     return "\n";
 }
 
-QList<QString>& Tooltips::add(const QString& id) {
+QList<QString>& Tooltips::add(const QString& id) const {
     return m_tooltips[id];
 }
 
-void Tooltips::addStandardTooltips() {
+void Tooltips::addStandardTooltips() const {
     QString dropTracksHere = tr("Drop tracks from library, external file manager, or other decks/samplers here.");
     QString dragItem = tr("Drag this item to other decks/samplers, to crates and playlist or to external file manager.");
     QString trackProperties = tr("Opens the track properties editor");
@@ -12,9 +12,13 @@ class Tooltips : public QObject {
     QString tooltipForId(const QString& id) const;
 
   private:
-    void addStandardTooltips();
+    void addStandardTooltips() const;
     QString tooltipSeparator() const;
-    QList<QString>& add(const QString& id);
+    QList<QString>& add(const QString& id) const;
 
-    QHash<QString, QStringList> m_tooltips;
+    // Populated lazily on the first tooltipForId() call, because building
+    // all standard tooltips allocates over a thousand translated strings
+    // and some LegacySkinParser instances (e.g. for the launch image) never
+    // look up a tooltip at all.
+    mutable QHash<QString, QStringList> m_tooltips;
 };
@@ -30,6 +30,7 @@ SkinLoader::SkinLoader(UserSettingsPointer pConfig)
 
 SkinLoader::~SkinLoader() {
     LegacySkinParser::clearSharedGroupStrings();
+    LegacySkinParser::clearDomCache();
 }
 
 QList<SkinPointer> SkinLoader::getUserSkins() const {
@@ -1,5 +1,7 @@
 #include "soundio/sounddevice.h"
 
+#include <QVarLengthArray>
+
 #include "soundio/soundmanagerconfig.h"
 #include "soundio/soundmanagerutil.h"
 #include "soundmanagerconfig.h"
@@ -7,6 +9,15 @@
 #include "util/defs.h"
 #include "util/sample.h"
 
+namespace {
+
+// Preallocation for the per-callback source/destination arrays passed to the
+// single-pass SampleUtil (de)interleaving kernels, sized for the stereo pairs
+// of a 16 channel interface.
+constexpr int kComposePreallocatedSources = 8;
+
+} // namespace
+
 SoundDevice::SoundDevice(UserSettingsPointer config, SoundManager* sm)
         : m_pConfig(config),
           m_pSoundManager(sm),
@@ -80,6 +91,24 @@ bool SoundDevice::operator==(const SoundDevice &other) const {
     return m_deviceId == other.getDeviceId();
 }
 
+bool SoundDevice::allOutputsStereo() const {
+    for (const AudioOutputBuffer& out : std::as_const(m_audioOutputs)) {
+        if (out.getChannelGroup().getChannelCount() != 2) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SoundDevice::allInputsStereo() const {
+    for (const AudioInputBuffer& in : std::as_const(m_audioInputs)) {
+        if (in.getChannelGroup().getChannelCount() != 2) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void SoundDevice::composeOutputBuffer(CSAMPLE* outputBuffer,
                                       const SINT framesToCompose,
                                       const SINT framesReadOffset,
@@ -100,6 +129,24 @@ void SoundDevice::composeOutputBuffer(CSAMPLE* outputBuffer,
         pAudioOutputBuffer = &pAudioOutputBuffer[framesReadOffset*2];
         SampleUtil::copyClampBuffer(outputBuffer, pAudioOutputBuffer,
                framesToCompose * 2);
+    } else if (allOutputsStereo()) {
+        // All sources are stereo pairs (the normal case, all AudioOutputs
+        // are stereo as of Mixxx 1.12.0). Compose the interleaved device
+        // frames in a single pass over the output buffer instead of
+        // clearing it and then scattering each source in its own pass.
+        QVarLengthArray<const CSAMPLE*, kComposePreallocatedSources> srcs;
+        QVarLengthArray<int, kComposePreallocatedSources> channelBases;
+        for (const AudioOutputBuffer& out : std::as_const(m_audioOutputs)) {
+            // advanced to offset; the source buffer is always stereo
+            srcs.append(&out.getBuffer()[framesReadOffset * 2]);
+            channelBases.append(out.getChannelGroup().getChannelBase());
+        }
+        SampleUtil::interleaveClampStereoBuffers(outputBuffer,
+                srcs.constData(),
+                channelBases.constData(),
+                static_cast<int>(srcs.size()),
+                iFrameSize,
+                framesToCompose);
     } else {
         // Reset sample for each open channel
         SampleUtil::clear(outputBuffer, framesToCompose * iFrameSize);
@@ -181,6 +228,23 @@ void SoundDevice::composeInputBuffer(const CSAMPLE* inputBuffer,
         CSAMPLE* pInputBuffer = in.getBuffer(); // Always Stereo
         pInputBuffer = &pInputBuffer[framesWriteOffset * 2];
         SampleUtil::copy(pInputBuffer, inputBuffer, framesToPush * 2);
+    } else if (allInputsStereo()) {
+        // All inputs grab stereo pairs (the normal case). Deinterleave the
+        // device frames into the input buffers in a single pass over the
+        // interleaved buffer instead of one pass per input.
+        QVarLengthArray<CSAMPLE*, kComposePreallocatedSources> dests;
+        QVarLengthArray<int, kComposePreallocatedSources> channelBases;
+        for (const AudioInputBuffer& in : std::as_const(m_audioInputs)) {
+            // advanced to offset; the destination buffer is always stereo
+            dests.append(&in.getBuffer()[framesWriteOffset * 2]);
+            channelBases.append(in.getChannelGroup().getChannelBase());
+        }
+        SampleUtil::deinterleaveStereoBuffers(dests.constData(),
+                channelBases.constData(),
+                static_cast<int>(dests.size()),
+                inputBuffer,
+                iFrameSize,
+                framesToPush);
     } else {
         // Non Stereo input (iFrameSize != 2)
         // Do crazy deinterleaving of the audio into the correct m_inputBuffers.
@@ -68,6 +68,14 @@ class SoundDevice {
     void clearInputBuffer(const SINT framesToPush,
                           const SINT framesWriteOffset);
 
+    // Returns true if every registered output grabs a stereo channel pair.
+    // This has been the normal case for all AudioOutputs since Mixxx 1.12.0;
+    // only a mono device channel assignment makes it false.
+    bool allOutputsStereo() const;
+
+    // Returns true if every registered input grabs a stereo channel pair.
+    bool allInputsStereo() const;
+
     SoundDeviceId m_deviceId;
     UserSettingsPointer m_pConfig;
     // Pointer to the SoundManager object which we'll request audio from.
@@ -71,8 +71,12 @@ SoundDeviceStatus SoundDeviceNetwork::open(bool isClkRefDevice, int syncBuffers)
     // clock reference device callback
     // This is what should work best.
     if (m_numOutputChannels) {
-        m_outputFifo = std::make_unique<FIFO<CSAMPLE>>(
-                m_numOutputChannels * framesPerBuffer * 2);
+        mixxx::SampleBuffer(static_cast<SINT>(
+                m_numOutputChannels * framesPerBuffer))
+                .swap(m_outputBuffer);
+        mixxx::SampleBuffer(static_cast<SINT>(
+                m_numOutputChannels * (framesPerBuffer + 1)))
+                .swap(m_driftCompBuffer);
     }
     if (m_numInputChannels) {
         m_inputFifo = std::make_unique<FIFO<CSAMPLE>>(
@@ -108,7 +112,7 @@ SoundDeviceStatus SoundDeviceNetwork::open(bool isClkRefDevice, int syncBuffers)
 }
 
 bool SoundDeviceNetwork::isOpen() const {
-    return (m_inputFifo != nullptr || m_outputFifo != nullptr);
+    return (m_inputFifo != nullptr || m_outputBuffer.size() > 0);
 }
 
 SoundDeviceStatus SoundDeviceNetwork::close() {
@@ -120,7 +124,8 @@ SoundDeviceStatus SoundDeviceNetwork::close() {
         m_pThread.reset();
     }
 
-    m_outputFifo.reset();
+    mixxx::SampleBuffer().swap(m_outputBuffer);
+    mixxx::SampleBuffer().swap(m_driftCompBuffer);
     m_inputFifo.reset();
 
     return SoundDeviceStatus::Ok;
@@ -229,50 +234,16 @@ void SoundDeviceNetwork::readProcess(SINT framesPerBuffer) {
 }
 
 void SoundDeviceNetwork::writeProcess(SINT framesPerBuffer) {
-    if (!m_outputFifo || !m_pNetworkStream || !m_numOutputChannels) {
+    if (m_outputBuffer.size() <= 0 || !m_pNetworkStream || !m_numOutputChannels) {
         return;
     }
     DEBUG_ASSERT(m_configFramesPerBuffer >= framesPerBuffer);
 
-    int outChunkSize = framesPerBuffer * m_numOutputChannels;
-    int writeAvailable = m_outputFifo->writeAvailable();
-    int writeCount = outChunkSize;
-    if (outChunkSize > writeAvailable) {
-        writeCount = writeAvailable;
-        m_pSoundManager->underflowHappened(23);
-        //qDebug() << "writeProcess():" << (float) writeAvailable / outChunkSize << "Overflow";
-    }
-    //qDebug() << "writeProcess():" << (float) writeAvailable / outChunkSize;
-    if (writeCount > 0) {
-        CSAMPLE* dataPtr1;
-        ring_buffer_size_t size1;
-        CSAMPLE* dataPtr2;
-        ring_buffer_size_t size2;
-        // We use size1 and size2, so we can ignore the return value
-        (void)m_outputFifo->aquireWriteRegions(writeCount, &dataPtr1,
-                &size1, &dataPtr2, &size2);
-        // Fetch fresh samples and write to the the output buffer
-        composeOutputBuffer(dataPtr1, size1 / m_numOutputChannels, 0, m_numOutputChannels);
-        if (size2 > 0) {
-            composeOutputBuffer(dataPtr2,
-                    size2 / m_numOutputChannels,
-                    size1 / m_numOutputChannels,
-                    m_numOutputChannels);
-        }
-        m_outputFifo->releaseWriteRegions(writeCount);
-    }
-
-    int readAvailable = m_outputFifo->readAvailable();
-
-    CSAMPLE* dataPtr1;
-    ring_buffer_size_t size1;
-    CSAMPLE* dataPtr2;
-    ring_buffer_size_t size2;
-    // Try to read as most frames as possible.
-    // NetworkStreamWorker::processWrite takes care of
-    // keeping every output worker in sync
-    m_outputFifo->aquireReadRegions(readAvailable,
-            &dataPtr1, &size1, &dataPtr2, &size2);
+    // Compose the engine output once into the shared chunk buffer. All
+    // output workers below read from this single buffer by pointer, so
+    // the only copy left on the send path is the one into each worker's
+    // own FIFO, which decouples the worker thread from this callback.
+    composeOutputBuffer(m_outputBuffer.data(), framesPerBuffer, 0, m_numOutputChannels);
 
     const QVector<NetworkOutputStreamWorkerPtr> workers =
             m_pNetworkStream->outputWorkers();
@@ -281,19 +252,13 @@ void SoundDeviceNetwork::writeProcess(SINT framesPerBuffer) {
             continue;
         }
 
-        workerWriteProcess(pWorker,
-                outChunkSize, readAvailable,
-                dataPtr1, size1,
-                dataPtr2, size2);
+        workerWriteProcess(pWorker, framesPerBuffer);
     }
-
-    m_outputFifo->releaseReadRegions(readAvailable);
 }
 
 void SoundDeviceNetwork::workerWriteProcess(NetworkOutputStreamWorkerPtr pWorker,
-        int outChunkSize, int readAvailable,
-        CSAMPLE* dataPtr1, ring_buffer_size_t size1,
-        CSAMPLE* dataPtr2, ring_buffer_size_t size2) {
+        SINT framesPerBuffer) {
+    int outChunkSize = framesPerBuffer * m_numOutputChannels;
     int writeExpectedFrames = static_cast<int>(
             pWorker->getStreamTimeFrames() - pWorker->framesWritten());
 
@@ -303,66 +268,68 @@ void SoundDeviceNetwork::workerWriteProcess(NetworkOutputStreamWorkerPtr pWorker
         // Overflow
         // kLogger.debug() << "workerWriteProcess: buffer full"
         //                 << "outChunkSize" << outChunkSize
-        //                 << "readAvailable" << readAvailable
         //                 << "writeExpected" << writeExpected
         //                 << "streamTime" << pWorker->getStreamTimeFrames();
         // catch up by skipping chunk
         m_pSoundManager->underflowHappened(25);
+        return;
     }
-    int copyCount = qMin(readAvailable, writeExpected);
 
-    if (copyCount > 0) {
-        if (writeExpected - copyCount > outChunkSize) {
-            // Underflow
-            // kLogger.debug() << "workerWriteProcess: buffer empty."
-            //                 << "Catch up with silence:" << writeExpected - copyCount
-            //                 << "streamTime" << pWorker->getStreamTimeFrames();;
-            // catch up by filling buffer until we are synced
-            workerWriteSilence(pWorker, (writeExpected - copyCount) / m_numOutputChannels);
-            m_pSoundManager->underflowHappened(24);
-        } else if (writeExpected - copyCount > outChunkSize / 2) {
-            // try to keep PAs buffer filled up to 0.5 chunks
-            if (pWorker->outputDrift()) {
-                // duplicate one frame
-                // kLogger.debug() << "workerWriteProcess() duplicate one frame"
-                //                 << (float)writeExpected / outChunkSize
-                //                 << (float)readAvailable / outChunkSize;
-                workerWrite(pWorker, dataPtr1, 1);
-            } else {
-                pWorker->setOutputDrift(true);
-            }
-        } else if (writeExpected < outChunkSize / 2) {
-            // We will overshoot by more than a half of the new frames
-            if (pWorker->outputDrift()) {
-                // kLogger.debug() << "workerWriteProcess() "
-                //                    "skip one frame"
-                //                 << (float)writeAvailable / outChunkSize
-                //                 << (float)readAvailable / outChunkSize;
-                if (size1 >= m_numOutputChannels) {
-                    dataPtr1 += m_numOutputChannels;
-                    size1 -= m_numOutputChannels;
-                }
-            } else {
-                pWorker->setOutputDrift(true);
-            }
+    int copyCount = qMin(outChunkSize, writeExpected);
+    if (writeExpected - copyCount > outChunkSize) {
+        // Underflow
+        // kLogger.debug() << "workerWriteProcess: buffer empty."
+        //                 << "Catch up with silence:" << writeExpected - copyCount
+        //                 << "streamTime" << pWorker->getStreamTimeFrames();;
+        // catch up by filling buffer until we are synced
+        workerWriteSilence(pWorker, (writeExpected - copyCount) / m_numOutputChannels);
+        pWorker->incUnderflowCount();
+        m_pSoundManager->underflowHappened(24);
+        workerWrite(pWorker, m_outputBuffer.data(), framesPerBuffer);
+    } else if (writeExpected - copyCount > outChunkSize / 2) {
+        // try to keep the workers buffer filled up to 0.5 chunks
+        if (pWorker->outputDrift()) {
+            // The worker consumes slightly faster than we produce.
+            // Stretch this chunk by one frame instead of doubling a
+            // frame, which would click.
+            SampleUtil::linearResampleBuffer(m_driftCompBuffer.data(),
+                    m_outputBuffer.data(),
+                    framesPerBuffer + 1,
+                    framesPerBuffer,
+                    m_numOutputChannels);
+            workerWrite(pWorker, m_driftCompBuffer.data(), framesPerBuffer + 1);
         } else {
-            pWorker->setOutputDrift(false);
+            pWorker->setOutputDrift(true);
+            workerWrite(pWorker, m_outputBuffer.data(), framesPerBuffer);
         }
-
-        workerWrite(pWorker, dataPtr1, size1 / m_numOutputChannels);
-        if (size2 > 0) {
-            workerWrite(pWorker, dataPtr2, size2 / m_numOutputChannels);
+    } else if (writeExpected < outChunkSize / 2) {
+        // We will overshoot by more than a half of the new frames
+        if (pWorker->outputDrift()) {
+            // Compress this chunk by one frame instead of skipping a
+            // frame, which would click.
+            SampleUtil::linearResampleBuffer(m_driftCompBuffer.data(),
+                    m_outputBuffer.data(),
+                    framesPerBuffer - 1,
+                    framesPerBuffer,
+                    m_numOutputChannels);
+            workerWrite(pWorker, m_driftCompBuffer.data(), framesPerBuffer - 1);
+        } else {
+            pWorker->setOutputDrift(true);
+            workerWrite(pWorker, m_outputBuffer.data(), framesPerBuffer);
         }
+    } else {
+        pWorker->setOutputDrift(false);
+        workerWrite(pWorker, m_outputBuffer.data(), framesPerBuffer);
+    }
 
-        QSharedPointer<FIFO<CSAMPLE>> pFifo = pWorker->getOutputFifo();
-        if (pFifo) {
-            // interval = copyCount
-            // Check for desired kNetworkLatencyFrames + 1/2 interval to
-            // avoid big jitter due to interferences with sync code
-            if (pFifo->readAvailable() + copyCount / 2 >=
-                    (m_numOutputChannels * kNetworkLatencyFrames)) {
-                pWorker->outputAvailable();
-            }
+    QSharedPointer<FIFO<CSAMPLE>> pFifo = pWorker->getOutputFifo();
+    if (pFifo) {
+        // interval = outChunkSize
+        // Check for desired kNetworkLatencyFrames + 1/2 interval to
+        // avoid big jitter due to interferences with sync code
+        if (pFifo->readAvailable() + outChunkSize / 2 >=
+                (m_numOutputChannels * kNetworkLatencyFrames)) {
+            pWorker->outputAvailable();
         }
     }
 }
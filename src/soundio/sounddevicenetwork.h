@@ -15,6 +15,7 @@
 #include "soundio/sounddevice.h"
 #include "util/fifo.h"
 #include "util/performancetimer.h"
+#include "util/samplebuffer.h"
 
 #define CPU_USAGE_UPDATE_RATE 30 // in 1/s, fits to display frame rate
 #define CPU_OVERLOAD_DURATION 500 // in ms
@@ -48,15 +49,22 @@ class SoundDeviceNetwork : public SoundDevice {
     void updateAudioLatencyUsage(SINT framesPerBuffer);
 
     void workerWriteProcess(NetworkOutputStreamWorkerPtr pWorker,
-            int outChunkSize, int readAvailable,
-            CSAMPLE* dataPtr1, ring_buffer_size_t size1,
-            CSAMPLE* dataPtr2, ring_buffer_size_t size2);
+            SINT framesPerBuffer);
     void workerWrite(NetworkOutputStreamWorkerPtr pWorker,
             const CSAMPLE* buffer, int frames);
     void workerWriteSilence(NetworkOutputStreamWorkerPtr pWorker, int frames);
 
     QSharedPointer<EngineNetworkStream> m_pNetworkStream;
-    std::unique_ptr<FIFO<CSAMPLE>> m_outputFifo;
+    // One composed chunk of engine output. All output workers read from
+    // this single buffer by pointer, so the only copy left on the send
+    // path is the one into each worker's own FIFO. It replaces a staging
+    // FIFO that was written and fully drained within the same
+    // writeProcess() pass.
+    mixxx::SampleBuffer m_outputBuffer;
+    // Scratch buffer holding one chunk plus one frame. The per-worker
+    // drift correction stretches chunks by +-1 frame through it instead
+    // of dropping or doubling a frame, which would click.
+    mixxx::SampleBuffer m_driftCompBuffer;
     std::unique_ptr<FIFO<CSAMPLE>> m_inputFifo;
     bool m_inputDrift;
 
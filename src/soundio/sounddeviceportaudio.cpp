@@ -15,6 +15,7 @@
 #include "util/defs.h"
 #include "util/denormalsarezero.h"
 #include "util/fifo.h"
+#include "util/latencyhistogram.h"
 #include "util/math.h"
 #include "util/sample.h"
 #include "util/timer.h"
@@ -47,6 +48,24 @@ constexpr int kCpuUsageUpdateRate = 30; // in 1/s, fits to display frame rate
 // callbacks can be always wrong due to a setup/open jitter
 constexpr int m_invalidTimeInfoWarningCount = 3;
 
+// Record the end-to-end audio interface latency of a full duplex callback
+// from the ADC/DAC timestamps PortAudio provides. This measures the real
+// input-to-output latency of everything that passes through Mixxx in this
+// callback (vinyl control, engine, effects). Only relaxed atomic increments,
+// so safe in the callback; skipped when the host API reports no usable
+// timestamps.
+void recordAudioPathLatency(const CSAMPLE* in,
+        const CSAMPLE* out,
+        const PaStreamCallbackTimeInfo* timeInfo) {
+    if (in && out && timeInfo &&
+            timeInfo->inputBufferAdcTime > 0 &&
+            timeInfo->outputBufferDacTime > timeInfo->inputBufferAdcTime) {
+        LatencyHistogram::audioPath().record(
+                (timeInfo->outputBufferDacTime - timeInfo->inputBufferAdcTime) *
+                1000.0);
+    }
+}
+
 int paV19Callback(const void *inputBuffer, void *outputBuffer,
                   unsigned long framesPerBuffer,
                   const PaStreamCallbackTimeInfo *timeInfo,
@@ -298,6 +317,13 @@ SoundDeviceStatus SoundDevicePortAudio::open(bool isClkRefDevice, int syncBuffer
         }
     } else if (m_syncBuffers == 2) { // "Default (long delay)"
         pCallback = paV19CallbackDrift;
+        // One chunk plus one frame for stretching chunks during drift
+        // correction.
+        const int maxChannelCount = qMax(
+                m_outputParams.channelCount, m_inputParams.channelCount);
+        mixxx::SampleBuffer(static_cast<SINT>(
+                                    (framesPerBuffer + 1) * maxChannelCount))
+                .swap(m_driftCompBuffer);
         // to avoid overflows when one callback overtakes the other or
         // when there is a clock drift compared to the clock reference device
         // we need an additional artificial delay
@@ -518,6 +544,7 @@ SoundDeviceStatus SoundDevicePortAudio::close() {
 
     m_outputFifo.reset();
     m_inputFifo.reset();
+    mixxx::SampleBuffer().swap(m_driftCompBuffer);
     m_bSetThreadPriority = false;
 
     return SoundDeviceStatus::Ok;
@@ -772,7 +799,7 @@ int SoundDevicePortAudio::callbackProcessDrift(
         const SINT framesPerBuffer, CSAMPLE *out, const CSAMPLE *in,
         const PaStreamCallbackTimeInfo *timeInfo,
         PaStreamCallbackFlags statusFlags) {
-    Q_UNUSED(timeInfo);
+    recordAudioPathLatency(in, out, timeInfo);
     Trace trace("SoundDevicePortAudio::callbackProcessDrift %1",
             m_deviceId.debugName());
 
@@ -809,17 +836,22 @@ int SoundDevicePortAudio::callbackProcessDrift(
         int readAvailable = m_inputFifo->readAvailable();
         int writeAvailable = m_inputFifo->writeAvailable();
         if (readAvailable < inChunkSize * kDriftReserve) {
-            // risk of an underflow, duplicate one frame
-            m_inputFifo->write(in, inChunkSize);
+            // risk of an underflow, insert one frame
             if (m_inputDrift) {
                 // Do not compensate the first delay, because it is likely a jitter
                 // corrected in the next cycle
-                // Duplicate one frame
-                m_inputFifo->write(
-                        &in[inChunkSize - m_inputParams.channelCount],
+                // Stretch the chunk by one frame instead of duplicating the
+                // last frame outright, so the insertion does not click
+                SampleUtil::linearResampleBuffer(m_driftCompBuffer.data(),
+                        in,
+                        framesPerBuffer + 1,
+                        framesPerBuffer,
                         m_inputParams.channelCount);
+                m_inputFifo->write(m_driftCompBuffer.data(),
+                        inChunkSize + m_inputParams.channelCount);
                 //qDebug() << "callbackProcessDrift write:" << (float)readAvailable / inChunkSize << "Skip";
             } else {
+                m_inputFifo->write(in, inChunkSize);
                 m_inputDrift = true;
                 //qDebug() << "callbackProcessDrift write:" << (float)readAvailable / inChunkSize << "Jitter Skip";
             }
@@ -829,9 +861,17 @@ int SoundDevicePortAudio::callbackProcessDrift(
             m_inputDrift = false;
             //qDebug() << "callbackProcess write:" << (float) readAvailable / inChunkSize << "Normal";
         } else if (writeAvailable >= inChunkSize) {
-            // Risk of overflow, skip one frame
+            // Risk of overflow, drop one frame
             if (m_inputDrift) {
-                m_inputFifo->write(in, inChunkSize - m_inputParams.channelCount);
+                // Compress the chunk by one frame instead of cutting off the
+                // last frame outright, so the removal does not click
+                SampleUtil::linearResampleBuffer(m_driftCompBuffer.data(),
+                        in,
+                        framesPerBuffer - 1,
+                        framesPerBuffer,
+                        m_inputParams.channelCount);
+                m_inputFifo->write(m_driftCompBuffer.data(),
+                        inChunkSize - m_inputParams.channelCount);
                 //qDebug() << "callbackProcessDrift write:" << (float)readAvailable / inChunkSize << "Skip";
             } else {
                 m_inputFifo->write(in, inChunkSize);
@@ -855,12 +895,20 @@ int SoundDevicePortAudio::callbackProcessDrift(
         int readAvailable = m_outputFifo->readAvailable();
 
         if (readAvailable > outChunkSize * (kDriftReserve + 1)) {
-            m_outputFifo->read(out, outChunkSize);
             if (m_outputDrift) {
-                // Risk of overflow, skip one frame
-                m_outputFifo->releaseReadRegions(m_outputParams.channelCount);
+                // Risk of overflow, consume one extra frame and compress the
+                // chunk by it instead of skipping it outright, so the
+                // removal does not click
+                m_outputFifo->read(m_driftCompBuffer.data(),
+                        outChunkSize + m_outputParams.channelCount);
+                SampleUtil::linearResampleBuffer(out,
+                        m_driftCompBuffer.data(),
+                        framesPerBuffer,
+                        framesPerBuffer + 1,
+                        m_outputParams.channelCount);
                 //qDebug() << "callbackProcessDrift read:" << (float)readAvailable / outChunkSize << "Skip";
             } else {
+                m_outputFifo->read(out, outChunkSize);
                 m_outputDrift = true;
                 //qDebug() << "callbackProcessDrift read:" << (float)readAvailable / outChunkSize << "Jitter Skip";
             }
@@ -870,12 +918,15 @@ int SoundDevicePortAudio::callbackProcessDrift(
             //qDebug() << "callbackProcessDrift read:" << (float)readAvailable / outChunkSize << "Normal";
         } else if (readAvailable >= outChunkSize) {
             if (m_outputDrift) {
-                // Risk of underflow, duplicate one frame
-                m_outputFifo->read(out,
+                // Risk of underflow, consume one frame less and stretch the
+                // chunk by it instead of duplicating the last frame
+                // outright, so the insertion does not click
+                m_outputFifo->read(m_driftCompBuffer.data(),
                         outChunkSize - m_outputParams.channelCount);
-                SampleUtil::copy(
-                        &out[outChunkSize - m_outputParams.channelCount],
-                        &out[outChunkSize - (2 * m_outputParams.channelCount)],
+                SampleUtil::linearResampleBuffer(out,
+                        m_driftCompBuffer.data(),
+                        framesPerBuffer,
+                        framesPerBuffer - 1,
                         m_outputParams.channelCount);
                 //qDebug() << "callbackProcessDrift read:" << (float)readAvailable / outChunkSize << "Save";
             } else {
@@ -905,7 +956,7 @@ int SoundDevicePortAudio::callbackProcess(const SINT framesPerBuffer,
         CSAMPLE *out, const CSAMPLE *in,
         const PaStreamCallbackTimeInfo *timeInfo,
         PaStreamCallbackFlags statusFlags) {
-    Q_UNUSED(timeInfo);
+    recordAudioPathLatency(in, out, timeInfo);
     Trace trace("SoundDevicePortAudio::callbackProcess %1", m_deviceId.debugName());
 
     if (statusFlags & (paOutputUnderflow | paInputOverflow)) {
@@ -960,6 +1011,8 @@ int SoundDevicePortAudio::callbackProcessClkRef(
     // This must be the very first call, else timeInfo becomes invalid
     updateCallbackEntryToDacTime(framesPerBuffer, timeInfo);
 
+    recordAudioPathLatency(in, out, timeInfo);
+
     Trace trace("SoundDevicePortAudio::callbackProcessClkRef %1",
             m_deviceId.debugName());
 
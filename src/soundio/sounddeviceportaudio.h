@@ -12,6 +12,7 @@
 #include "util/duration.h"
 #include "util/fifo.h"
 #include "util/performancetimer.h"
+#include "util/samplebuffer.h"
 
 class SoundManager;
 
@@ -76,6 +77,11 @@ class SoundDevicePortAudio : public SoundDevice {
     PaStreamParameters m_inputParams;
     std::unique_ptr<FIFO<CSAMPLE>> m_outputFifo;
     std::unique_ptr<FIFO<CSAMPLE>> m_inputFifo;
+    // Scratch buffer holding one chunk plus one frame. The drift correction
+    // in callbackProcessDrift() stretches chunks by +-1 frame through it
+    // instead of dropping or doubling a frame, which would click. Only
+    // accessed from the device callback.
+    mixxx::SampleBuffer m_driftCompBuffer;
     bool m_outputDrift;
     bool m_inputDrift;
 
@@ -19,6 +19,9 @@
 #include "util/cmdlineargs.h"
 #include "util/compatibility/qatomic.h"
 #include "util/defs.h"
+#include "util/latencyhistogram.h"
+#include "util/stat.h"
+#include "util/statsmanager.h"
 #include "util/sample.h"
 #include "util/versionstore.h"
 #include "vinylcontrol/defs_vinylcontrol.h"
@@ -72,6 +75,20 @@ SoundManager::SoundManager(UserSettingsPointer pConfig,
     m_pControlObjectVinylControlGainCO = new ControlObject(
             ConfigKey(VINYL_PREF_KEY, "gain"));
 
+    m_pAudioPathLatencyAvg = new ControlObject(
+            ConfigKey(kAppGroup, QStringLiteral("audio_path_latency_avg_ms")));
+    m_pAudioPathLatencyMax = new ControlObject(
+            ConfigKey(kAppGroup, QStringLiteral("audio_path_latency_max_ms")));
+    // Touch the histogram once here so its one-time initialization happens
+    // before the audio callback records into it.
+    LatencyHistogram::audioPath();
+    m_latencyReportTimer.setInterval(1000);
+    connect(&m_latencyReportTimer,
+            &QTimer::timeout,
+            this,
+            &SoundManager::publishAudioPathLatency);
+    m_latencyReportTimer.start();
+
     //Hack because PortAudio samplerate enumeration is slow as hell on Linux (ALSA dmix sucks, so we can't blame PortAudio)
     m_samplerates.push_back(mixxx::audio::SampleRate(44100));
     m_samplerates.push_back(mixxx::audio::SampleRate(48000));
@@ -106,6 +123,26 @@ SoundManager::~SoundManager() {
 
     delete m_pControlObjectSoundStatusCO;
     delete m_pControlObjectVinylControlGainCO;
+    delete m_pAudioPathLatencyAvg;
+    delete m_pAudioPathLatencyMax;
+}
+
+void SoundManager::publishAudioPathLatency() {
+    const LatencyHistogram& histogram = LatencyHistogram::audioPath();
+    if (histogram.count() == 0) {
+        return;
+    }
+    m_pAudioPathLatencyAvg->set(histogram.averageMillis());
+    m_pAudioPathLatencyMax->set(histogram.maxMillis());
+    if (StatsManager::s_bStatsManagerEnabled) {
+        // Shows up in the developer tools stats view.
+        static const QString statTag =
+                QStringLiteral("SoundManager audio path latency, average ms");
+        Stat::track(statTag,
+                Stat::UNSPECIFIED,
+                Stat::COUNT | Stat::AVERAGE | Stat::MIN | Stat::MAX,
+                histogram.averageMillis());
+    }
 }
 
 QList<SoundDevicePointer> SoundManager::getDeviceList(
@@ -711,9 +748,21 @@ void SoundManager::closeActiveConfig(bool async) {
 
 SoundDeviceStatus SoundManager::setConfig(const SoundManagerConfig& config) {
     SoundDeviceStatus status = SoundDeviceStatus::Ok;
+    const SoundManagerConfig oldConfig = m_config;
     m_config = config;
     checkConfig();
 
+    if (m_config.hasSameDeviceConfiguration(oldConfig) &&
+            m_pControlObjectSoundStatusCO->get() == SOUNDMANAGER_CONNECTED) {
+        // Nothing that affects how the devices are opened or routed has
+        // changed and the devices are running. Keep them running instead of
+        // silencing the output with a full teardown and reopen cycle.
+        qDebug() << "SoundManager::setConfig() device configuration unchanged,"
+                 << "keeping devices open";
+        m_config.writeToDisk();
+        return status;
+    }
+
     closeActiveConfig();
 
     status = setupDevices();
@@ -5,6 +5,7 @@
 #include <QObject>
 #include <QSharedPointer>
 #include <QString>
+#include <QTimer>
 
 #include "audio/types.h"
 #include "control/pollingcontrolproxy.h"
@@ -137,6 +138,13 @@ class SoundManager : public QObject {
     void closeDevices(bool sleepAfterClosing, bool async = false);
 
     void setJACKName() const;
+
+    // Publishes the audio path latency histogram summary (see
+    // LatencyHistogram::audioPath()) as ControlObjects and, in developer
+    // mode, as a stat for the developer tools window. Runs on the main
+    // thread off a timer, so the real-time side only ever increments the
+    // histogram counters.
+    void publishAudioPathLatency();
     bool jackApiUsed() const {
         return m_config.getAPI() == MIXXX_PORTAUDIO_JACK_STRING;
     }
@@ -155,6 +163,9 @@ class SoundManager : public QObject {
     QMultiHash<AudioInput, AudioDestination*> m_registeredDestinations;
     ControlObject* m_pControlObjectSoundStatusCO;
     ControlObject* m_pControlObjectVinylControlGainCO;
+    ControlObject* m_pAudioPathLatencyAvg;
+    ControlObject* m_pAudioPathLatencyMax;
+    QTimer m_latencyReportTimer;
 
     QSharedPointer<EngineNetworkStream> m_pNetworkStream;
 
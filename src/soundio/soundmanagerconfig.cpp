@@ -34,6 +34,34 @@ const QString xmlElementOutput = "output";
 const QString xmlElementInput = "input";
 
 const QRegularExpression kLegacyFormatRegex("((\\d*), )(.*) \\((plug)?(hw:(\\d)+(,(\\d)+))?\\)");
+
+// AudioPath::operator==() deliberately ignores the channel group, so plain
+// QMultiHash equality would consider two configs equal that only move a path
+// to different channels on the same device. Compare the channel assignment
+// explicitly on top of the path identity.
+template<typename T>
+bool hasSamePathsAndChannels(
+        const QMultiHash<SoundDeviceId, T>& paths,
+        const QMultiHash<SoundDeviceId, T>& otherPaths) {
+    if (paths.size() != otherPaths.size()) {
+        return false;
+    }
+    for (auto it = paths.constBegin(); it != paths.constEnd(); ++it) {
+        bool found = false;
+        const QList<T> candidates = otherPaths.values(it.key());
+        for (const T& candidate : candidates) {
+            if (candidate == it.value() &&
+                    candidate.getChannelGroup() == it.value().getChannelGroup()) {
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            return false;
+        }
+    }
+    return true;
+}
 } // namespace
 
 SoundManagerConfig::SoundManagerConfig(SoundManager* pSoundManager)
@@ -447,6 +475,18 @@ QMultiHash<SoundDeviceId, AudioInput> SoundManagerConfig::getInputs() const {
     return m_inputs;
 }
 
+bool SoundManagerConfig::hasSameDeviceConfiguration(
+        const SoundManagerConfig& other) const {
+    return m_api == other.m_api &&
+            m_sampleRate == other.m_sampleRate &&
+            m_deckCount == other.m_deckCount &&
+            m_audioBufferSizeIndex == other.m_audioBufferSizeIndex &&
+            m_syncBuffers == other.m_syncBuffers &&
+            m_forceNetworkClock == other.m_forceNetworkClock &&
+            hasSamePathsAndChannels(m_outputs, other.m_outputs) &&
+            hasSamePathsAndChannels(m_inputs, other.m_inputs);
+}
+
 void SoundManagerConfig::clearOutputs() {
     m_outputs.clear();
 }
@@ -90,6 +90,10 @@ class SoundManagerConfig {
     void addInput(const SoundDeviceId& device, const AudioInput& in);
     QMultiHash<SoundDeviceId, AudioOutput> getOutputs() const;
     QMultiHash<SoundDeviceId, AudioInput> getInputs() const;
+    /// Compares every setting that affects how the sound devices are opened
+    /// and routed (API, sample rate, buffer sizes, clock source and the
+    /// input/output paths). The config file location is not compared.
+    bool hasSameDeviceConfiguration(const SoundManagerConfig& other) const;
     void clearOutputs();
     void clearInputs();
     bool hasMicInputs();
@@ -173,9 +173,8 @@ bool ReadAheadFrameBuffer::fillBuffer(
     DEBUG_ASSERT(writableSamples.length() == copySampleCount);
     SampleUtil::copy(
             writableSamples.data(),
-            inputBuffer.readableData(),
+            pInputSamples,
             copySampleCount);
-    pInputSamples += copySampleCount;
     return true;
 }
 
@@ -53,6 +53,12 @@ constexpr int64_t kavStreamDecoderFrameDelayAAC = 2112;
 
 constexpr SINT kMaxSamplesPerMP3Frame = 1152;
 
+// Minimum distance in frames between adjacent entries of the packet
+// seek table. Limits the memory footprint of the table to a few
+// thousand entries even for very long streams while still placing
+// seeks within ~1.4 sec @ 48 kHz of the requested position.
+constexpr SINT kMinSeekTableFrameDistance = 65536;
+
 const Logger kLogger("SoundSourceFFmpeg");
 
 int64_t getStreamStartTime(const AVStream& avStream) {
@@ -914,6 +920,8 @@ void SoundSourceFFmpeg::close() {
     m_pavCodecContext.close();
     m_pavInputFormatContext.close();
     m_pavStream = nullptr;
+    // The recorded timestamps are only valid for the closed stream
+    m_packetSeekTable.clear();
 }
 
 namespace {
@@ -997,8 +1005,27 @@ bool SoundSourceFFmpeg::adjustCurrentPosition(SINT startIndex) {
     avcodec_flush_buffers(m_pavCodecContext);
 
     // Seek to new position
-    const int64_t seekTimestamp =
+    int64_t seekTimestamp =
             convertFrameIndexToStreamTime(*m_pavStream, seekIndex);
+    // Prefer the recorded timestamp of a packet that has already been
+    // read at or shortly before the seek position. Demuxers without a
+    // complete index (e.g. MP3 files lacking a Xing/VBRI header)
+    // position timestamp seeks by interpolating the bitrate, which may
+    // land far before or even after the requested position. Seeking to
+    // the exact timestamp of a known packet avoids both the inaccuracy
+    // and the redundant decoding of the interjacent packets.
+    if (!m_packetSeekTable.empty()) {
+        const auto nextIt = m_packetSeekTable.upper_bound(seekIndex);
+        if (nextIt != m_packetSeekTable.begin()) {
+            const auto& entry = *std::prev(nextIt);
+            // Only use entries in the vicinity of the seek position.
+            // An entry far before the seek position could otherwise
+            // cause more decoding than the demuxer's own estimate.
+            if (entry.first + 2 * kMinSeekTableFrameDistance > seekIndex) {
+                seekTimestamp = entry.second;
+            }
+        }
+    }
     int av_seek_frame_result = av_seek_frame(
             m_pavInputFormatContext,
             m_pavStream->index,
@@ -1019,6 +1046,24 @@ bool SoundSourceFFmpeg::adjustCurrentPosition(SINT startIndex) {
     return true;
 }
 
+void SoundSourceFFmpeg::recordPacketSeekTableEntry(
+        SINT packetFrameIndex,
+        int64_t packetPts) {
+    DEBUG_ASSERT(packetPts != AV_NOPTS_VALUE);
+    // Keep the table sparse by only recording packets that are
+    // sufficiently far away from their neighboring entries
+    const auto nextIt = m_packetSeekTable.upper_bound(packetFrameIndex);
+    if (nextIt != m_packetSeekTable.begin() &&
+            std::prev(nextIt)->first + kMinSeekTableFrameDistance > packetFrameIndex) {
+        return;
+    }
+    if (nextIt != m_packetSeekTable.end() &&
+            packetFrameIndex + kMinSeekTableFrameDistance > nextIt->first) {
+        return;
+    }
+    m_packetSeekTable.insert(nextIt, std::make_pair(packetFrameIndex, packetPts));
+}
+
 bool SoundSourceFFmpeg::consumeNextAVPacket(
         AVPacket** ppavNextPacket) {
     DEBUG_ASSERT(m_pavPacket);
@@ -1035,6 +1080,12 @@ bool SoundSourceFFmpeg::consumeNextAVPacket(
             m_frameBuffer.invalidate();
             return false;
         }
+        if (m_pavPacket->data &&
+                m_pavPacket->pts != AV_NOPTS_VALUE) {
+            // Remember the exact stream position of this packet for
+            // accurately positioning subsequent seeks
+            recordPacketSeekTableEntry(packetFrameIndex, m_pavPacket->pts);
+        }
         *ppavNextPacket = m_pavPacket;
     }
     auto* pavNextPacket = *ppavNextPacket;
@@ -8,6 +8,8 @@ extern "C" {
 
 } // extern "C"
 
+#include <map>
+
 #include "sources/readaheadframebuffer.h"
 #include "sources/soundsourceprovider.h"
 
@@ -41,6 +43,12 @@ class SoundSourceFFmpeg : public SoundSource {
     bool consumeNextAVPacket(
             AVPacket** ppavNextPacket);
 
+    // Record the exact stream position of a packet that has been
+    // read from the stream in m_packetSeekTable.
+    void recordPacketSeekTableEntry(
+            SINT packetFrameIndex,
+            int64_t packetPts);
+
     // Takes ownership of an input format context and ensures that
     // the corresponding AVFormatContext is closed, either explicitly
     // or implicitly by the destructor. The wrapper can only be
@@ -155,6 +163,12 @@ class SoundSourceFFmpeg : public SoundSource {
     AVCodecContextPtr m_pavCodecContext;
     AVFrame* m_pavDecodedFrame;
     FrameCount m_seekPrerollFrameCount;
+    // Sparsely sampled mapping from frame indexes to the exact
+    // presentation timestamps of packets that have already been
+    // read from the stream. Populated on the fly while decoding
+    // and consulted for positioning subsequent seeks, see
+    // adjustCurrentPosition().
+    std::map<SINT, int64_t> m_packetSeekTable;
     ReadAheadFrameBuffer m_frameBuffer;
 
     // FFmpeg static constants
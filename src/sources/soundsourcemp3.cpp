@@ -6,6 +6,14 @@
 
 #include <id3tag.h>
 
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+
 namespace mixxx {
 
 namespace {
@@ -90,6 +98,24 @@ constexpr SINT kMaxMp3FramesPerSecond = 39; // fixed: 1 MP3 frame = 26 ms -> ~ 1
 constexpr SINT kSeekFrameListCapacity =
         kMinutesPerFile * kSecondsPerMinute * kMaxMp3FramesPerSecond;
 
+// Persistent seek index cache, see loadSeekIndexCache()/storeSeekIndexCache()
+constexpr quint32 kSeekIndexCacheMagic = 0x4D503353; // "MP3S"
+constexpr quint32 kSeekIndexCacheVersion = 1;
+// Scanning short files is fast enough that caching their index is not
+// worth the disk footprint.
+constexpr qint64 kSeekIndexCacheMinSeekFrames = 1000; // ~26 s of audio
+
+QString seekIndexCacheFilePath(const QFileInfo& fileInfo) {
+    // The cache file is keyed by the absolute file path; size and
+    // modification time are verified against the stored values on load.
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(fileInfo.absoluteFilePath().toUtf8());
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) +
+            QStringLiteral("/mp3seekindex/") +
+            QString::fromLatin1(hash.result().toHex()) +
+            QStringLiteral(".dat");
+}
+
 inline QString formatHeaderFlags(int headerFlags) {
     return QString("0x%1").arg(headerFlags, 4, 16, QLatin1Char('0'));
 }
@@ -247,6 +273,20 @@ SoundSource::OpenResult SoundSourceMp3::tryOpen(
     DEBUG_ASSERT(m_seekFrameList.empty());
     m_avgSeekFrameCount = 0;
     m_curFrameIndex = 0;
+
+    if (loadSeekIndexCache()) {
+        // The seek index and the stream properties derived from it have
+        // been restored from a previous open, skip decoding all frame
+        // headers of the file.
+        restartDecoding(m_seekFrameList.front());
+        if (m_curFrameIndex != frameIndexMin()) {
+            kLogger.warning() << "Failed to start decoding:" << m_file.fileName();
+            // Abort
+            return OpenResult::Failed;
+        }
+        return OpenResult::Succeeded;
+    }
+
     int headerPerSampleRate[kSampleRateCount];
     for (int i = 0; i < kSampleRateCount; ++i) {
         headerPerSampleRate[i] = 0;
@@ -484,9 +524,138 @@ SoundSource::OpenResult SoundSourceMp3::tryOpen(
         return OpenResult::Failed;
     }
 
+    storeSeekIndexCache();
+
     return OpenResult::Succeeded;
 }
 
+bool SoundSourceMp3::loadSeekIndexCache() {
+    const QFileInfo fileInfo(m_file.fileName());
+    QFile cacheFile(seekIndexCacheFilePath(fileInfo));
+    if (!cacheFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QDataStream stream(&cacheFile);
+    quint32 magic = 0;
+    quint32 version = 0;
+    stream >> magic >> version;
+    if (magic != kSeekIndexCacheMagic ||
+            version != kSeekIndexCacheVersion) {
+        return false;
+    }
+    qint64 fileSize = 0;
+    qint64 fileMTime = 0;
+    stream >> fileSize >> fileMTime;
+    if (fileSize != static_cast<qint64>(m_fileSize) ||
+            fileMTime != fileInfo.lastModified().toMSecsSinceEpoch()) {
+        // The file has been modified since the index was stored
+        return false;
+    }
+    qint32 channelCount = 0;
+    qint32 sampleRate = 0;
+    qint32 bitrate = 0;
+    qint64 numFrames = 0;
+    qint64 numSeekFrames = 0;
+    stream >> channelCount >> sampleRate >> bitrate >> numFrames >> numSeekFrames;
+    if (stream.status() != QDataStream::Ok ||
+            channelCount <= 0 ||
+            channelCount > kChannelCountMax ||
+            getIndexBySampleRate(audio::SampleRate(sampleRate)) >= kSampleRateCount ||
+            numFrames <= 0 ||
+            numSeekFrames <= 0) {
+        return false;
+    }
+
+    // Restore the seek frame list, validating that indices and file
+    // offsets are strictly increasing and within the mapped file.
+    m_seekFrameList.reserve(static_cast<size_t>(numSeekFrames) + 1);
+    SINT lastFrameIndex = -1;
+    quint64 lastOffset = 0;
+    for (qint64 i = 0; i < numSeekFrames; ++i) {
+        qint64 frameIndex = 0;
+        quint64 offset = 0;
+        stream >> frameIndex >> offset;
+        if (stream.status() != QDataStream::Ok ||
+                frameIndex <= lastFrameIndex ||
+                (i == 0 && frameIndex != 0) ||
+                offset >= m_fileSize ||
+                (i > 0 && offset <= lastOffset)) {
+            m_seekFrameList.clear();
+            return false;
+        }
+        addSeekFrame(frameIndex, m_pFileData + offset);
+        lastFrameIndex = frameIndex;
+        lastOffset = offset;
+    }
+    if (!stream.atEnd() || numFrames <= lastFrameIndex) {
+        m_seekFrameList.clear();
+        return false;
+    }
+
+    initChannelCountOnce(static_cast<SINT>(channelCount));
+    initSampleRateOnce(static_cast<SINT>(sampleRate));
+    if (bitrate > 0) {
+        initBitrateOnce(static_cast<SINT>(bitrate));
+    }
+    initFrameIndexRangeOnce(IndexRange::forward(0, numFrames));
+
+    m_avgSeekFrameCount = frameLength() / static_cast<SINT>(m_seekFrameList.size());
+
+    // Terminate m_seekFrameList
+    addSeekFrame(numFrames, nullptr);
+    DEBUG_ASSERT(m_seekFrameList.back().frameIndex == frameIndexMax());
+
+    return true;
+}
+
+void SoundSourceMp3::storeSeekIndexCache() const {
+    // The terminating seek frame (null input data) is not stored
+    DEBUG_ASSERT(!m_seekFrameList.empty());
+    const auto numSeekFrames = static_cast<qint64>(m_seekFrameList.size()) - 1;
+    if (numSeekFrames < kSeekIndexCacheMinSeekFrames) {
+        return;
+    }
+    const QFileInfo fileInfo(m_file.fileName());
+    const QString cacheFilePath = seekIndexCacheFilePath(fileInfo);
+    if (!QDir().mkpath(QFileInfo(cacheFilePath).absolutePath())) {
+        return;
+    }
+    QSaveFile cacheFile(cacheFilePath);
+    if (!cacheFile.open(QIODevice::WriteOnly)) {
+        kLogger.debug() << "Failed to store seek index cache:"
+                        << cacheFilePath
+                        << cacheFile.errorString();
+        return;
+    }
+    QDataStream stream(&cacheFile);
+    stream << kSeekIndexCacheMagic
+           << kSeekIndexCacheVersion;
+    stream << static_cast<qint64>(m_fileSize)
+           << fileInfo.lastModified().toMSecsSinceEpoch();
+    stream << static_cast<qint32>(getSignalInfo().getChannelCount())
+           << static_cast<qint32>(getSignalInfo().getSampleRate())
+           << static_cast<qint32>(getBitrate())
+           << static_cast<qint64>(frameLength())
+           << numSeekFrames;
+    for (qint64 i = 0; i < numSeekFrames; ++i) {
+        const SeekFrameType& seekFrame = m_seekFrameList[i];
+        const auto offset = static_cast<quint64>(
+                seekFrame.pInputData - m_pFileData);
+        if (offset >= m_fileSize) {
+            // The frame has been decoded from the leftover buffer at the
+            // end of the file and its position cannot be expressed as a
+            // file offset.
+            cacheFile.cancelWriting();
+            return;
+        }
+        stream << static_cast<qint64>(seekFrame.frameIndex)
+               << offset;
+    }
+    // Commits atomically via rename and discards the
+    // file if a write error occurred
+    cacheFile.commit();
+}
+
 void SoundSourceMp3::close() {
     finishDecoding();
 
@@ -53,6 +53,14 @@ class SoundSourceMp3 final : public SoundSource {
 
     void addSeekFrame(SINT frameIndex, const unsigned char* pInputData);
 
+    // Persistent cache for the seek index. Building the index requires
+    // decoding every frame header of the file, which takes seconds for a
+    // long VBR file. After a successful scan the index and the stream
+    // properties derived from it are stored in the application cache
+    // directory and restored on subsequent opens of the unchanged file.
+    bool loadSeekIndexCache();
+    void storeSeekIndexCache() const;
+
     /** Returns the position in m_seekFrameList of the requested frame index. */
     SINT findSeekFrameIndex(SINT frameIndex) const;
 
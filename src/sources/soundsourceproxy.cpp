@@ -385,10 +385,9 @@ SoundSourceProxy::allProviderRegistrationsForUrl(
 }
 
 //static
-ExportTrackMetadataResult
-SoundSourceProxy::exportTrackMetadataBeforeSaving(
-        Track* pTrack,
-        const SyncTrackMetadataParams& syncParams) {
+mixxx::SoundSourcePointer
+SoundSourceProxy::openSoundSourceForMetadataExport(
+        Track* pTrack) {
     DEBUG_ASSERT(pTrack);
     const auto fileInfo = pTrack->getFileInfo();
     mixxx::SoundSourcePointer pSoundSource;
@@ -412,7 +411,7 @@ SoundSourceProxy::exportTrackMetadataBeforeSaving(
                 kLogger.warning()
                         << "Failed to update stream info from audio "
                            "source before exporting metadata";
-                return ExportTrackMetadataResult::Failed;
+                return nullptr;
             }
         }
         pSoundSource = proxy.m_pSoundSource;
@@ -421,11 +420,43 @@ SoundSourceProxy::exportTrackMetadataBeforeSaving(
         kLogger.warning()
                 << "Unable to export track metadata into file"
                 << fileInfo;
+    }
+    return pSoundSource;
+}
+
+//static
+ExportTrackMetadataResult
+SoundSourceProxy::exportTrackMetadataBeforeSaving(
+        Track* pTrack,
+        const SyncTrackMetadataParams& syncParams) {
+    const auto pSoundSource = openSoundSourceForMetadataExport(pTrack);
+    if (!pSoundSource) {
         return ExportTrackMetadataResult::Failed;
     }
     return pTrack->exportMetadata(*pSoundSource, syncParams);
 }
 
+//static
+ExportTrackMetadataResult
+SoundSourceProxy::prepareTrackMetadataExport(
+        Track* pTrack,
+        const SyncTrackMetadataParams& syncParams,
+        mixxx::SoundSourcePointer* pExportSource,
+        mixxx::TrackMetadata* pExportMetadata) {
+    DEBUG_ASSERT(pExportSource);
+    DEBUG_ASSERT(pExportMetadata);
+    auto pSoundSource = openSoundSourceForMetadataExport(pTrack);
+    if (!pSoundSource) {
+        return ExportTrackMetadataResult::Failed;
+    }
+    const auto result = pTrack->prepareMetadataExport(
+            *pSoundSource, syncParams, pExportMetadata);
+    if (result == ExportTrackMetadataResult::Succeeded) {
+        *pExportSource = std::move(pSoundSource);
+    }
+    return result;
+}
+
 // Used during tests only
 SoundSourceProxy::SoundSourceProxy(
         TrackPointer pTrack,
@@ -11,6 +11,7 @@ namespace mixxx {
 
 class FileAccess;
 class FileInfo;
+class TrackMetadata;
 
 } // namespace mixxx
 
@@ -208,6 +209,21 @@ class SoundSourceProxy {
             Track* pTrack,
             const SyncTrackMetadataParams& syncParams);
 
+    /// Variant of exportTrackMetadataBeforeSaving() that only decides
+    /// whether the file tags need to be rewritten without touching the
+    /// file. On Succeeded the sound source and the normalized metadata
+    /// of the pending export are returned through the out parameters
+    /// and the actual file write may be performed independently of the
+    /// track object, e.g. on a worker thread.
+    static ExportTrackMetadataResult prepareTrackMetadataExport(
+            Track* pTrack,
+            const SyncTrackMetadataParams& syncParams,
+            mixxx::SoundSourcePointer* pExportSource,
+            mixxx::TrackMetadata* pExportMetadata);
+
+    static mixxx::SoundSourcePointer openSoundSourceForMetadataExport(
+            Track* pTrack);
+
     // Special case: Construction from a url is needed
     // for writing metadata immediately before the TIO is destroyed.
     explicit SoundSourceProxy(const QUrl& url);
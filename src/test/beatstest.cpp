@@ -538,6 +538,88 @@ TEST(BeatsTest, ConstTempoFindPrevNextBeatWhenNotOnBeat) {
     EXPECT_NEAR(nextBeat.value(), foundNextBeat.value(), kMaxBeatError);
 }
 
+TEST(BeatsTest, CursorFindPrevNextBeatsMatchesBeats) {
+    const auto pBeats = Beats::fromBeatMarkers(
+            kSampleRate,
+            kNonConstTempoBeats.getMarkers(),
+            kNonConstTempoBeats.getLastMarkerPosition(),
+            kNonConstTempoBeats.getLastMarkerBpm());
+    auto cursor = pBeats->createCursor();
+
+    // Sweep sequentially through the track in sub-beat steps, so the cursor
+    // answers most queries from its cached iterator, and verify that the
+    // batched result always matches the uncached lookup.
+    const audio::FrameDiff_t step = kSampleRate.value() / 8.0;
+    for (audio::FramePos position = kStartPosition - 4 * kSampleRate.value();
+            position < kEndPosition;
+            position += step) {
+        audio::FramePos prevBeatPosition, nextBeatPosition;
+        pBeats->findPrevNextBeats(position, &prevBeatPosition, &nextBeatPosition, false);
+
+        const auto result = cursor.findPrevNextBeats(position, false);
+        EXPECT_NEAR(prevBeatPosition.value(), result.prevPosition.value(), kMaxBeatError);
+        EXPECT_NEAR(nextBeatPosition.value(), result.nextPosition.value(), kMaxBeatError);
+        EXPECT_GE(result.fractionOfBeat, 0.0);
+        EXPECT_LT(result.fractionOfBeat, 1.0);
+    }
+}
+
+TEST(BeatsTest, CursorFindPrevNextBeatsAfterJump) {
+    const auto pBeats = Beats::fromConstTempo(kSampleRate, kStartPosition, kBpm);
+    auto cursor = pBeats->createCursor();
+    const audio::FrameDiff_t beatLengthFrames = 60.0 * kSampleRate.value() / kBpm.value();
+
+    // Jumps larger than the incremental seek range force a full lookup and
+    // must yield the same results as sequential queries.
+    const audio::FramePos positions[] = {
+            kStartPosition + 10.5 * beatLengthFrames,
+            kStartPosition + 1000.25 * beatLengthFrames,
+            kStartPosition + 2.75 * beatLengthFrames,
+            kStartPosition - 500.5 * beatLengthFrames,
+    };
+    for (const audio::FramePos position : positions) {
+        audio::FramePos prevBeatPosition, nextBeatPosition;
+        pBeats->findPrevNextBeats(position, &prevBeatPosition, &nextBeatPosition, false);
+
+        const auto result = cursor.findPrevNextBeats(position, false);
+        EXPECT_NEAR(prevBeatPosition.value(), result.prevPosition.value(), kMaxBeatError);
+        EXPECT_NEAR(nextBeatPosition.value(), result.nextPosition.value(), kMaxBeatError);
+    }
+}
+
+TEST(BeatsTest, CursorFindPrevNextBeatsWhenOnBeat) {
+    const auto pBeats = Beats::fromConstTempo(kSampleRate, kStartPosition, kBpm);
+    auto cursor = pBeats->createCursor();
+    const audio::FrameDiff_t beatLengthFrames = 60.0 * kSampleRate.value() / kBpm.value();
+    const audio::FramePos position = *(pBeats->cfirstmarker() + 10);
+
+    const auto result = cursor.findPrevNextBeats(position, true);
+    EXPECT_NEAR(position.value(), result.prevPosition.value(), kMaxBeatError);
+    EXPECT_NEAR((position + beatLengthFrames).value(),
+            result.nextPosition.value(),
+            kMaxBeatError);
+    EXPECT_DOUBLE_EQ(0.0, result.fractionOfBeat);
+}
+
+TEST(BeatsTest, CursorFindNthBeatMatchesBeats) {
+    const auto pBeats = Beats::fromBeatMarkers(
+            kSampleRate,
+            kNonConstTempoBeats.getMarkers(),
+            kNonConstTempoBeats.getLastMarkerPosition(),
+            kNonConstTempoBeats.getLastMarkerBpm());
+    auto cursor = pBeats->createCursor();
+
+    const audio::FrameDiff_t step = kSampleRate.value() / 4.0;
+    for (audio::FramePos position = kStartPosition; position < kEndPosition;
+            position += step) {
+        for (int n : {-2, -1, 1, 2}) {
+            EXPECT_NEAR(pBeats->findNthBeat(position, n).value(),
+                    cursor.findNthBeat(position, n).value(),
+                    kMaxBeatError);
+        }
+    }
+}
+
 TEST(BeatsTest, roundBpm) {
     // Integer Bpm
     mixxx::Bpm roundBpm = BeatUtils::roundBpmWithinRange(
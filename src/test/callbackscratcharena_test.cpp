@@ -0,0 +1,57 @@
+#include "engine/callbackscratcharena.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+class CallbackScratchArenaTest : public testing::Test {
+};
+
+TEST_F(CallbackScratchArenaTest, AllocateAndReset) {
+    CallbackScratchArena arena(64);
+
+    const auto chunk1 = arena.allocate(10);
+    EXPECT_EQ(10u, chunk1.size());
+    const auto chunk2 = arena.allocate(10);
+    EXPECT_EQ(10u, chunk2.size());
+    // Chunks must not overlap.
+    EXPECT_GE(chunk2.data(), chunk1.data() + chunk1.size());
+    EXPECT_GT(arena.used(), 0);
+
+    arena.reset();
+    EXPECT_EQ(0, arena.used());
+    // After a reset the same memory is handed out again.
+    const auto chunk3 = arena.allocate(10);
+    EXPECT_EQ(chunk1.data(), chunk3.data());
+}
+
+TEST_F(CallbackScratchArenaTest, ChunksStayAligned) {
+    CallbackScratchArena arena(64);
+
+    // An odd-sized allocation must not break the alignment of the next one.
+    arena.allocate(3);
+    const auto chunk = arena.allocate(8);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(chunk.data()) % 16);
+}
+
+TEST_F(CallbackScratchArenaTest, HighWaterMark) {
+    CallbackScratchArena arena(64);
+
+    arena.allocate(16);
+    arena.allocate(16);
+    arena.reset();
+    arena.allocate(8);
+    EXPECT_EQ(32, arena.highWaterMark());
+}
+
+TEST_F(CallbackScratchArenaTest, CurrentArenaScope) {
+    EXPECT_EQ(nullptr, CallbackScratchArena::current());
+    CallbackScratchArena arena(64);
+    {
+        const CallbackScratchArena::Scope scope(&arena);
+        EXPECT_EQ(&arena, CallbackScratchArena::current());
+    }
+    EXPECT_EQ(nullptr, CallbackScratchArena::current());
+}
+
+} // namespace
@@ -0,0 +1,63 @@
+#include "util/coalescingtimer.h"
+
+#include <gtest/gtest.h>
+
+#include <QTest>
+
+#include "test/mixxxtest.h"
+
+namespace {
+
+class CoalescingTimerTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        m_pService = mixxx::CoalescingTimerService::createInstance();
+        ASSERT_NE(nullptr, m_pService);
+    }
+
+    void TearDown() override {
+        mixxx::CoalescingTimerService::destroyInstance();
+    }
+
+    mixxx::CoalescingTimerService* m_pService;
+};
+
+TEST_F(CoalescingTimerTest, ClientsFirePeriodically) {
+    int fastTicks = 0;
+    int slowTicks = 0;
+    const auto fastId = m_pService->registerClient(nullptr, 10, 2, [&]() {
+        ++fastTicks;
+    });
+    const auto slowId = m_pService->registerClient(nullptr, 50, 10, [&]() {
+        ++slowTicks;
+    });
+    ASSERT_NE(fastId, mixxx::CoalescingTimerService::kInvalidClientId);
+    ASSERT_NE(slowId, mixxx::CoalescingTimerService::kInvalidClientId);
+
+    QTest::qWait(300);
+    EXPECT_GT(fastTicks, 5);
+    EXPECT_GT(slowTicks, 1);
+    // The faster client must have fired more often than the slower one
+    EXPECT_GT(fastTicks, slowTicks);
+
+    m_pService->unregisterClient(fastId);
+    const int fastTicksAfterUnregister = fastTicks;
+    QTest::qWait(100);
+    EXPECT_EQ(fastTicks, fastTicksAfterUnregister);
+}
+
+TEST_F(CoalescingTimerTest, DestroyedContextUnregistersClient) {
+    int ticks = 0;
+    auto pContext = std::make_unique<QObject>();
+    const auto clientId = m_pService->registerClient(pContext.get(), 10, 2, [&]() {
+        ++ticks;
+    });
+    ASSERT_NE(clientId, mixxx::CoalescingTimerService::kInvalidClientId);
+
+    pContext.reset();
+    const int ticksAfterDestroy = ticks;
+    QTest::qWait(100);
+    EXPECT_EQ(ticks, ticksAfterDestroy);
+}
+
+} // namespace
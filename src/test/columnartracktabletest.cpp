@@ -0,0 +1,82 @@
+#include "library/columnartracktable.h"
+
+#include <gtest/gtest.h>
+
+#include <QDateTime>
+
+namespace {
+
+TrackId trackId(int id) {
+    return TrackId(QVariant(id));
+}
+
+class ColumnarTrackTableTest : public testing::Test {
+};
+
+TEST_F(ColumnarTrackTableTest, StoreAndRetrieveTypedValues) {
+    ColumnarTrackTable table(3);
+
+    const int row = table.beginRow(trackId(1));
+    table.setValue(row, 0, QStringLiteral("Artist"));
+    table.setValue(row, 1, 128.5);
+    table.setValue(row, 2, QDateTime::fromSecsSinceEpoch(1234567890));
+
+    EXPECT_TRUE(table.contains(trackId(1)));
+    EXPECT_EQ(QStringLiteral("Artist"), table.value(trackId(1), 0).toString());
+    EXPECT_DOUBLE_EQ(128.5, table.value(trackId(1), 1).toDouble());
+    EXPECT_EQ(QDateTime::fromSecsSinceEpoch(1234567890),
+            table.value(trackId(1), 2).toDateTime());
+
+    // Unknown tracks and out-of-range columns yield invalid values.
+    EXPECT_FALSE(table.value(trackId(2), 0).isValid());
+    EXPECT_FALSE(table.value(trackId(1), 3).isValid());
+}
+
+TEST_F(ColumnarTrackTableTest, NullValues) {
+    ColumnarTrackTable table(1);
+
+    const int row1 = table.beginRow(trackId(1));
+    table.setValue(row1, 0, QStringLiteral("Value"));
+    // Rows without an explicit value are null.
+    table.beginRow(trackId(2));
+
+    EXPECT_TRUE(table.value(trackId(1), 0).isValid());
+    EXPECT_FALSE(table.value(trackId(2), 0).isValid());
+
+    // Overwriting a value with null resets the cell.
+    table.setValue(table.beginRow(trackId(1)), 0, QVariant());
+    EXPECT_FALSE(table.value(trackId(1), 0).isValid());
+}
+
+TEST_F(ColumnarTrackTableTest, RemoveRowKeepsOtherRowsIntact) {
+    ColumnarTrackTable table(1);
+
+    for (int id = 1; id <= 3; ++id) {
+        table.setValue(table.beginRow(trackId(id)),
+                0,
+                QStringLiteral("Track %1").arg(id));
+    }
+    EXPECT_EQ(3, table.rowCount());
+
+    // Removing the first row moves the last row into the gap.
+    table.removeRow(trackId(1));
+
+    EXPECT_EQ(2, table.rowCount());
+    EXPECT_FALSE(table.contains(trackId(1)));
+    EXPECT_EQ(QStringLiteral("Track 2"), table.value(trackId(2), 0).toString());
+    EXPECT_EQ(QStringLiteral("Track 3"), table.value(trackId(3), 0).toString());
+}
+
+TEST_F(ColumnarTrackTableTest, ColumnPromotedOnTypeMismatch) {
+    ColumnarTrackTable table(1);
+
+    table.setValue(table.beginRow(trackId(1)), 0, 42);
+    // Storing a string in a numeric column promotes it to the QVariant
+    // fallback without losing the existing values.
+    table.setValue(table.beginRow(trackId(2)), 0, QStringLiteral("NaN"));
+
+    EXPECT_DOUBLE_EQ(42.0, table.value(trackId(1), 0).toDouble());
+    EXPECT_EQ(QStringLiteral("NaN"), table.value(trackId(2), 0).toString());
+}
+
+} // anonymous namespace
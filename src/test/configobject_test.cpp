@@ -122,6 +122,28 @@ TEST_F(ConfigObjectTest, GetValueString) {
     EXPECT_QSTRING_EQ("6", config()->getValue(ck2, "6"));
 }
 
+TEST_F(ConfigObjectTest, JournalReplayAfterCrash) {
+    // Persist a baseline, changes after this point only exist in the journal.
+    config()->setValue(ConfigKey("[Test]", "persisted"), QString("1"));
+    saveAndReloadConfig();
+
+    config()->setValue(ConfigKey("[Test]", "added"), QString("some value"));
+    config()->setValue(ConfigKey("[Test]", "persisted"), QString("2"));
+    config()->remove(ConfigKey("[Test]", "removed_again"));
+    config()->setValue(ConfigKey("[Test]", "removed_again"), QString("3"));
+    config()->remove(ConfigKey("[Test]", "removed_again"));
+
+    // Reload without saving, as if the previous session had crashed. The
+    // changes must be restored from the journal in order.
+    m_pConfig = UserSettingsPointer(
+            new UserSettings(getTestDataDir().filePath("test.cfg")));
+    EXPECT_QSTRING_EQ("some value",
+            config()->getValue<QString>(ConfigKey("[Test]", "added")));
+    EXPECT_QSTRING_EQ("2",
+            config()->getValue<QString>(ConfigKey("[Test]", "persisted")));
+    EXPECT_FALSE(config()->exists(ConfigKey("[Test]", "removed_again")));
+}
+
 TEST_F(ConfigObjectTest, Save) {
     for (int i = 0; i < 10; ++i) {
         config()->setValue(ConfigKey(QString("[Test%1]").arg(i),
@@ -16,7 +16,7 @@ using ::testing::StrictMock;
 namespace {
 
 const RuntimeLoggingCategory k_logger(QString("test").toLocal8Bit());
-constexpr int kMaxNumOfRecursions = 128;
+constexpr int kManyEvents = 384;
 
 class MockControlObjectScript : public ControlObjectScript {
   public:
@@ -102,7 +102,7 @@ class ControlObjectScriptTest : public MixxxTest {
     ScriptConnection conn1, conn2, conn3, conn4;
 };
 
-TEST_F(ControlObjectScriptTest, CompressingProxyCompareCount1) {
+TEST_F(ControlObjectScriptTest, CoalescedCompareCount1) {
     // Check that slotValueChanged callback is never called for conn2
     EXPECT_CALL(*coScript2, slotValueChanged(_, _))
             .Times(0);
@@ -114,7 +114,7 @@ TEST_F(ControlObjectScriptTest, CompressingProxyCompareCount1) {
     processEvents();
 }
 
-TEST_F(ControlObjectScriptTest, CompressingProxyCompareValue1) {
+TEST_F(ControlObjectScriptTest, CoalescedCompareValue1) {
     EXPECT_CALL(*coScript1, slotValueChanged(2.0, _))
             .Times(1)
             .WillOnce(Return());
@@ -123,7 +123,7 @@ TEST_F(ControlObjectScriptTest, CompressingProxyCompareValue1) {
     processEvents();
 }
 
-TEST_F(ControlObjectScriptTest, CompressingProxyCompareCount2) {
+TEST_F(ControlObjectScriptTest, CoalescedCompareCount2) {
     // Check that slotValueChanged callback is never called for conn2
     EXPECT_CALL(*coScript2, slotValueChanged(_, _))
             .Times(0);
@@ -136,7 +136,7 @@ TEST_F(ControlObjectScriptTest, CompressingProxyCompareCount2) {
     processEvents();
 }
 
-TEST_F(ControlObjectScriptTest, CompressingProxyCompareValue2) {
+TEST_F(ControlObjectScriptTest, CoalescedCompareValue2) {
     // Check that slotValueChanged callback is called with the last set value
     EXPECT_CALL(*coScript1, slotValueChanged(6.0, _))
             .Times(1)
@@ -150,7 +150,7 @@ TEST_F(ControlObjectScriptTest, QueuedCompareCount2) {
     // Check that slotValueChanged callback is never called for conn4
     EXPECT_CALL(*coScript2, slotValueChanged(_, _))
             .Times(0);
-    // Check that slotValueChanged callback for conn1 is called only twice (independent of the value), because proxy is disabled
+    // Check that slotValueChanged callback for conn1 is called only twice (independent of the value), because coalescing is disabled
     EXPECT_CALL(*coScript4, slotValueChanged(_, _))
             .Times(2)
             .WillOnce(Return());
@@ -160,7 +160,7 @@ TEST_F(ControlObjectScriptTest, QueuedCompareCount2) {
 }
 
 TEST_F(ControlObjectScriptTest, QueuedCompareValue2) {
-    // Check that slotValueChanged callback is called for each value, because proxy is disabled
+    // Check that slotValueChanged callback is called for each value, because coalescing is disabled
     EXPECT_CALL(*coScript4, slotValueChanged(55.0, _))
             .Times(1)
             .WillOnce(Return());
@@ -171,7 +171,7 @@ TEST_F(ControlObjectScriptTest, QueuedCompareValue2) {
     co4->set(56.0);
     processEvents();
 }
-TEST_F(ControlObjectScriptTest, CompressingProxyCompareCountMulti) {
+TEST_F(ControlObjectScriptTest, CoalescedCompareCountMulti) {
     // Check that slotValueChanged callback for conn1 and conn2 is called only once (independent of the value)
     EXPECT_CALL(*coScript1, slotValueChanged(_, _)).Times(1).WillOnce(Return());
     // Check that slotValueChanged callback for conn1 and conn2 is called only once (independent of the value)
@@ -183,7 +183,7 @@ TEST_F(ControlObjectScriptTest, CompressingProxyCompareCountMulti) {
     processEvents();
 }
 
-TEST_F(ControlObjectScriptTest, CompressingProxyCompareValueMulti) {
+TEST_F(ControlObjectScriptTest, CoalescedCompareValueMulti) {
     // Check that slotValueChanged callback is called with the last set value
     EXPECT_CALL(*coScript1, slotValueChanged(22.0, _))
             .Times(1)
@@ -198,7 +198,7 @@ TEST_F(ControlObjectScriptTest, CompressingProxyCompareValueMulti) {
     processEvents();
 }
 
-TEST_F(ControlObjectScriptTest, CompressingProxyMultiConnection) {
+TEST_F(ControlObjectScriptTest, CoalescedMultiConnection) {
     // Check that slotValueChanged callback is called 1 time if multiple
     // connections exist for the same slot
     EXPECT_CALL(*coScript1, slotValueChanged(32.0, _))
@@ -254,17 +254,17 @@ TEST_F(ControlObjectScriptTest, QueuedFallbackMultiConnection) {
     conn3.skipSuperseded = true;
 }
 
-TEST_F(ControlObjectScriptTest, CompressingProxyManyEvents) {
-    // Check maximum number of recursions
-    EXPECT_CALL(*coScript1, slotValueChanged(kMaxNumOfRecursions, _))
+TEST_F(ControlObjectScriptTest, CoalescedManyEvents) {
+    // No matter how many changes pile up before the controller thread gets
+    // to run, only the latest value is delivered, exactly once.
+    EXPECT_CALL(*coScript1, slotValueChanged(kManyEvents, _))
             .Times(1)
             .WillOnce(Return());
     EXPECT_CALL(*coScript2, slotValueChanged(42.0, _))
             .Times(1)
             .WillOnce(Return());
 
-    // Add more 3x more events than the recursion limit of the compressing proxy
-    for (int i = 1; i <= kMaxNumOfRecursions * 3; i++) {
+    for (int i = 1; i <= kManyEvents; i++) {
         co1->set(i);
     }
 
@@ -272,13 +272,12 @@ TEST_F(ControlObjectScriptTest, CompressingProxyManyEvents) {
     co2->set(41);
     co2->set(42);
 
-    // Event queue should be cleared
     processEvents();
     EXPECT_CALL(*coScript1, slotValueChanged(_, _))
             .Times(0);
     processEvents();
 
-    // Verify that compressing proxy works again after clearing event queue
+    // Verify that coalescing works again after the burst was delivered
     EXPECT_CALL(*coScript1, slotValueChanged(2, _))
             .Times(1)
             .WillOnce(Return());
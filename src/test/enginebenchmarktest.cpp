@@ -0,0 +1,245 @@
+#include <benchmark/benchmark.h>
+
+#include <QFile>
+#include <QString>
+#include <QTemporaryDir>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "control/control.h"
+#include "control/controlindicatortimer.h"
+#include "control/controlobject.h"
+#include "effects/effectsmanager.h"
+#include "engine/bufferscalers/enginebufferscalelinear.h"
+#include "engine/cachingreader/cachingreaderchunk.h"
+#include "engine/channels/enginechannel.h"
+#include "engine/engine.h"
+#include "engine/enginemixer.h"
+#include "engine/readaheadmanager.h"
+#include "preferences/usersettings.h"
+#include "util/sample.h"
+#include "util/samplebuffer.h"
+
+// Microbenchmarks for the engine callback hot path, run via the
+// `mixxx-benchmark` target (`mixxx-test --benchmark`). These complement the
+// SampleUtil kernel benchmarks in sampleutiltest.cpp with the higher-level
+// stages of the callback: the full EngineMixer::process() pass, the
+// CachingReader chunk copy path and the linear buffer scaler, at realistic
+// callback sizes (64/256/2048 frames) and sample rates (44.1/96 kHz).
+
+namespace {
+
+// Callback sizes in frames, crossed with common sample rates.
+void engineCallbackArgs(benchmark::internal::Benchmark* b) {
+    for (int frames : {64, 256, 2048}) {
+        for (int sampleRate : {44100, 96000}) {
+            b->Args({frames, sampleRate});
+        }
+    }
+}
+
+class BenchmarkEngineMixer : public EngineMixer {
+  public:
+    BenchmarkEngineMixer(UserSettingsPointer pConfig,
+            EffectsManager* pEffectsManager,
+            ChannelHandleFactoryPointer pChannelHandleFactory)
+            : EngineMixer(pConfig,
+                      QStringLiteral("[Master]"),
+                      pEffectsManager,
+                      pChannelHandleFactory,
+                      /*bEnableSidechain*/ false) {
+        m_pMainEnabled->forceSet(1);
+    }
+};
+
+// A channel that is always active on the main mix and leaves its (pre-filled)
+// buffer untouched, so the benchmark measures the mixer itself rather than
+// deck processing.
+class BenchmarkChannel : public EngineChannel {
+  public:
+    BenchmarkChannel(const QString& group, EngineMixer* pEngineMixer)
+            : EngineChannel(pEngineMixer->registerChannelGroup(group),
+                      EngineChannel::CENTER,
+                      nullptr,
+                      /*isTalkoverChannel*/ false,
+                      /*isPrimaryDeck*/ true) {
+    }
+
+    ActiveState updateActiveState() override {
+        return ActiveState::Active;
+    }
+    bool isActive() override {
+        return true;
+    }
+    bool isMainMixEnabled() const override {
+        return true;
+    }
+    bool isPflEnabled() const override {
+        return false;
+    }
+    void process(CSAMPLE* pInOut, const std::size_t bufferSize) override {
+        Q_UNUSED(pInOut);
+        Q_UNUSED(bufferSize);
+    }
+    void collectFeatures(GroupFeatureState* pGroupFeatures) const override {
+        Q_UNUSED(pGroupFeatures);
+    }
+    void postProcess(const std::size_t bufferSize) override {
+        Q_UNUSED(bufferSize);
+    }
+};
+
+// Minimal replica of the BaseSignalPathTest scaffolding. Benchmarks are free
+// functions that may run several times in one process, so the harness has to
+// clean up all control objects on teardown like MixxxTest does.
+class EngineMixerHarness {
+  public:
+    explicit EngineMixerHarness(int numChannels) {
+        const QString configFile =
+                m_tempDir.filePath(QStringLiteral("benchmark.cfg"));
+        {
+            // The config file has to exist before UserSettings opens it.
+            QFile file(configFile);
+            file.open(QIODevice::ReadWrite);
+        }
+        m_pConfig = UserSettingsPointer(new UserSettings(configFile));
+        ControlDoublePrivate::setUserConfig(m_pConfig);
+        m_pControlIndicatorTimer = std::make_unique<mixxx::ControlIndicatorTimer>();
+        m_pChannelHandleFactory = std::make_shared<ChannelHandleFactory>();
+        m_pNumDecks = std::make_unique<ControlObject>(ConfigKey(
+                QStringLiteral("[App]"), QStringLiteral("num_decks")));
+        m_pEffectsManager = std::make_unique<EffectsManager>(
+                m_pConfig, m_pChannelHandleFactory);
+        m_pEngineMixer = std::make_unique<BenchmarkEngineMixer>(
+                m_pConfig, m_pEffectsManager.get(), m_pChannelHandleFactory);
+        for (int i = 1; i <= numChannels; ++i) {
+            const QString group = QStringLiteral("[BenchmarkChannel%1]").arg(i);
+            m_pEngineMixer->addChannel(std::make_unique<BenchmarkChannel>(
+                    group, m_pEngineMixer.get()));
+            // Pretend that the channel processed the buffer by filling it
+            // with values.
+            auto buffer = m_pEngineMixer->getChannelBuffer(group);
+            SampleUtil::fill(const_cast<CSAMPLE*>(buffer.data()),
+                    0.1f * i,
+                    static_cast<SINT>(buffer.size()));
+        }
+    }
+
+    ~EngineMixerHarness() {
+        // Deletes all EngineChannels added to it.
+        m_pEngineMixer.reset();
+        m_pEffectsManager.reset();
+        m_pNumDecks.reset();
+        m_pControlIndicatorTimer.reset();
+        // Drop all leaked control objects so the next benchmark run can
+        // recreate the engine from scratch.
+        const auto controls = ControlDoublePrivate::takeAllInstances();
+        for (auto pControl : controls) {
+            pControl->deleteCreatorCO();
+        }
+    }
+
+    EngineMixer* engineMixer() const {
+        return m_pEngineMixer.get();
+    }
+
+  private:
+    QTemporaryDir m_tempDir;
+    UserSettingsPointer m_pConfig;
+    std::unique_ptr<mixxx::ControlIndicatorTimer> m_pControlIndicatorTimer;
+    ChannelHandleFactoryPointer m_pChannelHandleFactory;
+    std::unique_ptr<ControlObject> m_pNumDecks;
+    std::unique_ptr<EffectsManager> m_pEffectsManager;
+    std::unique_ptr<BenchmarkEngineMixer> m_pEngineMixer;
+};
+
+static void BM_EngineMixerProcess(benchmark::State& state) {
+    const int numChannels = static_cast<int>(state.range(1));
+    EngineMixerHarness harness(numChannels);
+    const std::size_t bufferSize =
+            static_cast<std::size_t>(state.range(0)) * mixxx::kEngineChannelOutputCount;
+    for (auto _ : state) {
+        harness.engineMixer()->process(bufferSize);
+    }
+}
+// Callback size in frames x number of active channels.
+BENCHMARK(BM_EngineMixerProcess)
+        ->Args({64, 4})
+        ->Args({256, 4})
+        ->Args({2048, 4})
+        ->Args({256, 16});
+
+// Serves zero samples immediately, so the benchmark measures the scaler
+// instead of the reader.
+class SilenceReadAheadManager : public ReadAheadManager {
+  public:
+    SilenceReadAheadManager()
+            : ReadAheadManager() {
+    }
+
+    SINT getNextSamples(double dRate,
+            CSAMPLE* pBuffer,
+            SINT requestedSamples,
+            mixxx::audio::ChannelCount channelCount) override {
+        Q_UNUSED(dRate);
+        Q_UNUSED(channelCount);
+        SampleUtil::clear(pBuffer, requestedSamples);
+        return requestedSamples;
+    }
+};
+
+static void BM_EngineBufferScaleLinear(benchmark::State& state) {
+    const SINT frames = static_cast<SINT>(state.range(0));
+    const auto sampleRate =
+            mixxx::audio::SampleRate(static_cast<SINT>(state.range(1)));
+    SilenceReadAheadManager readAheadManager;
+    EngineBufferScaleLinear scaler(&readAheadManager);
+    scaler.setSignal(sampleRate, mixxx::audio::ChannelCount::stereo());
+    // An off-unity rate so the scaler actually interpolates. Set twice to
+    // prevent rate LERP'ing, like SetRateNoLerp() in
+    // enginebufferscalelineartest.cpp.
+    for (int i = 0; i < 2; ++i) {
+        double tempoRatio = 1.2;
+        double pitchRatio = 1.2;
+        scaler.setScaleParameters(1.0, &tempoRatio, &pitchRatio);
+    }
+    mixxx::SampleBuffer output(
+            frames * mixxx::audio::ChannelCount::stereo());
+    for (auto _ : state) {
+        scaler.scaleBuffer(output.data(), output.size());
+    }
+}
+BENCHMARK(BM_EngineBufferScaleLinear)->Apply(engineCallbackArgs);
+
+static void BM_CachingReaderChunkReadBuffered(benchmark::State& state) {
+    const SINT frames = static_cast<SINT>(state.range(0));
+    const auto channelCount = mixxx::audio::ChannelCount::stereo();
+    const SINT chunkSamples =
+            CachingReaderChunk::frames2samples(CachingReaderChunk::kFrames, channelCount);
+    mixxx::SampleBuffer chunkBuffer(chunkSamples);
+    CachingReaderChunkForOwner chunk(
+            mixxx::SampleBuffer::WritableSlice(chunkBuffer));
+    chunk.init(0);
+    const std::vector<CSAMPLE> samples(chunkSamples, 0.5f);
+    chunk.restoreBufferedSampleFrames(
+            mixxx::IndexRange::forward(0, CachingReaderChunk::kFrames),
+            std::span<const CSAMPLE>(samples.data(), samples.size()));
+    mixxx::SampleBuffer output(
+            CachingReaderChunk::frames2samples(frames, channelCount));
+    SINT startFrame = 0;
+    for (auto _ : state) {
+        chunk.readBufferedSampleFrames(output.data(),
+                channelCount,
+                mixxx::IndexRange::forward(startFrame, frames));
+        // Walk through the chunk like a playing deck instead of hitting the
+        // same cache lines on every iteration.
+        startFrame += frames;
+        if (startFrame + frames > CachingReaderChunk::kFrames) {
+            startFrame = 0;
+        }
+    }
+}
+BENCHMARK(BM_CachingReaderChunkReadBuffered)->Arg(64)->Arg(256)->Arg(2048);
+
+} // namespace
@@ -39,6 +39,60 @@ TEST_F(EngineFilterBiquadTest, analysisPkBq) {
     free(filt);
 }
 
+TEST_F(EngineFilterBiquadTest, stereoChannelSeparation) {
+    // The stereo pair is processed with interleaved per-channel state, so a
+    // silent channel must stay exactly silent regardless of the other one.
+    constexpr std::size_t kBufferSize = 128;
+    EngineFilterBiquad1Low filter(mixxx::audio::SampleRate(44100), 1000, 0.707, false);
+
+    CSAMPLE input[kBufferSize];
+    CSAMPLE output[kBufferSize];
+    for (std::size_t i = 0; i < kBufferSize; i += 2) {
+        input[i] = static_cast<CSAMPLE>(i % 17) / 17.0f - 0.5f;
+        input[i + 1] = 0.0f;
+    }
+    // First buffer runs the start ramp, the second the steady-state loop.
+    filter.process(input, output, kBufferSize);
+    filter.process(input, output, kBufferSize);
+
+    bool leftNonZero = false;
+    for (std::size_t i = 0; i < kBufferSize; i += 2) {
+        leftNonZero |= (output[i] != 0.0f);
+        EXPECT_EQ(0.0f, output[i + 1]);
+    }
+    EXPECT_TRUE(leftNonZero);
+}
+
+TEST_F(EngineFilterBiquadTest, stereoStateCarriedAcrossBuffers) {
+    // Processing one buffer in two halves must produce exactly the same
+    // samples as processing it at once, i.e. the filter state written back
+    // at the end of a buffer seamlessly continues the next one.
+    constexpr std::size_t kBufferSize = 128;
+    EngineFilterBiquad1Low wholeFilter(mixxx::audio::SampleRate(44100), 1000, 0.707, false);
+    EngineFilterBiquad1Low halfFilter(mixxx::audio::SampleRate(44100), 1000, 0.707, false);
+
+    CSAMPLE input[kBufferSize];
+    for (std::size_t i = 0; i < kBufferSize; ++i) {
+        input[i] = static_cast<CSAMPLE>((i * 31) % 23) / 23.0f - 0.5f;
+    }
+    CSAMPLE warmup[kBufferSize];
+    // Get both instances past the start ramp with identical state.
+    wholeFilter.process(input, warmup, kBufferSize);
+    halfFilter.process(input, warmup, kBufferSize);
+
+    CSAMPLE wholeOutput[kBufferSize];
+    CSAMPLE halfOutput[kBufferSize];
+    wholeFilter.process(input, wholeOutput, kBufferSize);
+    halfFilter.process(input, halfOutput, kBufferSize / 2);
+    halfFilter.process(input + kBufferSize / 2,
+            halfOutput + kBufferSize / 2,
+            kBufferSize / 2);
+
+    for (std::size_t i = 0; i < kBufferSize; ++i) {
+        EXPECT_EQ(wholeOutput[i], halfOutput[i]) << "at index " << i;
+    }
+}
+
 TEST_F(EngineFilterBiquadTest, analysisLpBe4) {
     char* pDesc = nullptr;
     FidFilter* filt = fid_design("LpBe4", 44100, 600, 0, 0, &pDesc);
@@ -0,0 +1,199 @@
+#include <QByteArrayView>
+#include <QCryptographicHash>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QList>
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include "engine/engine.h"
+#include "engine/enginetimingrecorder.h"
+#include "test/signalpathtest.h"
+#include "util/performancetimer.h"
+
+// Deterministic offline render harness for the engine graph. Each test renders
+// a scripted session from a JSON scenario file in src/test/render-scenarios/
+// through the full signal path as fast as possible (no sound device, no
+// real-time pacing) and reports per-stage engine timing plus a SHA-256 hash of
+// the rendered main output. The hash doubles as a bit-exactness gate for
+// scaler, mixer and effects changes: scenarios that carry an
+// "expected_sha256" field fail when the rendered audio changes. The hash is
+// only stable for a given build configuration (SampleUtil picks SIMD kernels
+// at build time), so expected hashes should be pinned per CI configuration
+// rather than shared across platforms. The timing report feeds CI performance
+// gates; run only these tests via the `mixxx-render` target
+// (`mixxx-test --gtest_filter=EngineRenderTest.*`).
+//
+// Scenario format: {"name": ..., "buffers": N, "actions": [...]} where each
+// action fires before the buffer given by its "buffer" index and is one of
+//   {"buffer": B, "load": {"deck": D, "file": "relative/to/src/test"}}
+//   {"buffer": B, "set": {"group": G, "key": K, "value": V}}
+//   {"buffer": B, "ramp": {"group": G, "key": K,
+//                          "from": V0, "to": V1, "buffers": N}}
+// "set" covers play, seeks (playposition), sync enables and any effect
+// parameter; "ramp" interpolates a control linearly over N buffers for
+// crossfader and parameter sweeps. Track loads briefly spin the engine to
+// let the CachingReader deliver samples, so scripting them while another
+// deck is audible would make the rendered output timing-dependent; load
+// tracks while all decks are stopped to keep the hash reproducible.
+
+namespace {
+
+// A linear control sweep in progress, scheduled by a "ramp" action.
+struct ControlRamp {
+    ConfigKey key;
+    double from;
+    double to;
+    int startBuffer;
+    int endBuffer;
+};
+
+} // anonymous namespace
+
+class EngineRenderTest : public BaseSignalPathTest {
+  protected:
+    Deck* deckByNumber(int deckNumber) {
+        switch (deckNumber) {
+        case 1:
+            return m_pMixerDeck1;
+        case 2:
+            return m_pMixerDeck2;
+        case 3:
+            return m_pMixerDeck3;
+        default:
+            return nullptr;
+        }
+    }
+
+    void applyAction(const QJsonObject& action,
+            int bufferIndex,
+            QList<ControlRamp>* pActiveRamps) {
+        if (action.contains(QStringLiteral("load"))) {
+            const QJsonObject load = action.value(QStringLiteral("load")).toObject();
+            Deck* pDeck = deckByNumber(load.value(QStringLiteral("deck")).toInt());
+            ASSERT_NE(nullptr, pDeck) << "load action addresses an unknown deck";
+            const QString fileName = load.value(QStringLiteral("file")).toString();
+            loadTrack(pDeck, Track::newTemporary(getTestDir().filePath(fileName)));
+        } else if (action.contains(QStringLiteral("set"))) {
+            const QJsonObject set = action.value(QStringLiteral("set")).toObject();
+            ControlObject::set(
+                    ConfigKey(set.value(QStringLiteral("group")).toString(),
+                            set.value(QStringLiteral("key")).toString()),
+                    set.value(QStringLiteral("value")).toDouble());
+        } else if (action.contains(QStringLiteral("ramp"))) {
+            const QJsonObject ramp = action.value(QStringLiteral("ramp")).toObject();
+            pActiveRamps->append(ControlRamp{
+                    ConfigKey(ramp.value(QStringLiteral("group")).toString(),
+                            ramp.value(QStringLiteral("key")).toString()),
+                    ramp.value(QStringLiteral("from")).toDouble(),
+                    ramp.value(QStringLiteral("to")).toDouble(),
+                    bufferIndex,
+                    bufferIndex + ramp.value(QStringLiteral("buffers")).toInt()});
+        } else {
+            ADD_FAILURE() << "scenario action with neither load, set nor ramp";
+        }
+    }
+
+    void runScenarioFile(const QString& fileName) {
+        QFile file(getTestDir().filePath(
+                QStringLiteral("render-scenarios/") + fileName));
+        ASSERT_TRUE(file.open(QFile::ReadOnly | QFile::Text))
+                << "cannot open scenario " << fileName.toStdString();
+        QJsonParseError parseError;
+        const QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+        ASSERT_EQ(QJsonParseError::NoError, parseError.error)
+                << parseError.errorString().toStdString();
+        runScenario(doc.object());
+    }
+
+    void runScenario(const QJsonObject& scenario) {
+        const QString name = scenario.value(QStringLiteral("name")).toString();
+        const int numBuffers = scenario.value(QStringLiteral("buffers")).toInt();
+        ASSERT_GT(numBuffers, 0) << "scenario without a positive buffer count";
+        const QJsonArray actions = scenario.value(QStringLiteral("actions")).toArray();
+
+        QList<ControlRamp> activeRamps;
+        QCryptographicHash mainOutputHash(QCryptographicHash::Sha256);
+        std::array<std::int64_t, EngineTimingRecorder::kNumStages> stageTotalNanos = {};
+        std::int64_t renderNanos = 0;
+
+        for (int bufferIndex = 0; bufferIndex < numBuffers; ++bufferIndex) {
+            for (const auto& actionValue : actions) {
+                const QJsonObject action = actionValue.toObject();
+                if (action.value(QStringLiteral("buffer")).toInt() == bufferIndex) {
+                    applyAction(action, bufferIndex, &activeRamps);
+                }
+            }
+            for (int i = 0; i < activeRamps.size();) {
+                const ControlRamp& ramp = activeRamps.at(i);
+                const double progress = static_cast<double>(bufferIndex - ramp.startBuffer) /
+                        (ramp.endBuffer - ramp.startBuffer);
+                if (progress >= 1.0) {
+                    ControlObject::set(ramp.key, ramp.to);
+                    activeRamps.removeAt(i);
+                } else {
+                    ControlObject::set(ramp.key,
+                            ramp.from + progress * (ramp.to - ramp.from));
+                    ++i;
+                }
+            }
+
+            PerformanceTimer bufferTimer;
+            bufferTimer.start();
+            m_pEngineMixer->process(kProcessBufferSize);
+            renderNanos += bufferTimer.elapsed().toIntegerNanos();
+
+            const auto stageNanos = m_pEngineMixer->timingRecorder().lastStageNanos();
+            for (int stage = 0; stage < EngineTimingRecorder::kNumStages; ++stage) {
+                stageTotalNanos[stage] += stageNanos[stage];
+            }
+
+            const std::span<const CSAMPLE> mainBuffer = m_pEngineMixer->getMainBuffer();
+            mainOutputHash.addData(QByteArrayView(
+                    reinterpret_cast<const char*>(mainBuffer.data()),
+                    static_cast<qsizetype>(mainBuffer.size() * sizeof(CSAMPLE))));
+        }
+
+        const double sampleRate =
+                ControlObject::get(ConfigKey(m_sMainGroup, QStringLiteral("samplerate")));
+        const double renderedSeconds = numBuffers *
+                (kProcessBufferSize / mixxx::kEngineChannelOutputCount) / sampleRate;
+        const double renderSeconds = renderNanos / 1e9;
+        qInfo("EngineRenderTest: scenario %s rendered %.2fs of audio in %.3fs "
+              "(%.1fx realtime)",
+                qUtf8Printable(name),
+                renderedSeconds,
+                renderSeconds,
+                renderedSeconds / renderSeconds);
+        for (int stage = 0; stage < EngineTimingRecorder::kNumStages; ++stage) {
+            qInfo("EngineRenderTest:   stage %-11s %8lld us",
+                    EngineTimingRecorder::stageName(
+                            static_cast<EngineTimingRecorder::Stage>(stage)),
+                    static_cast<long long>(stageTotalNanos[stage] / 1000));
+        }
+
+        const QString actualHash = QString::fromLatin1(mainOutputHash.result().toHex());
+        const QString expectedHash =
+                scenario.value(QStringLiteral("expected_sha256")).toString();
+        if (expectedHash.isEmpty()) {
+            // No pinned hash (e.g. a freshly written scenario or a CI
+            // configuration that has not pinned one yet): report the actual
+            // hash so it can be added to the scenario file.
+            qInfo("EngineRenderTest: scenario %s main output sha256 %s "
+                  "(no expected_sha256 pinned)",
+                    qUtf8Printable(name),
+                    qUtf8Printable(actualHash));
+        } else {
+            EXPECT_EQ(expectedHash, actualHash)
+                    << "rendered main output of scenario " << name.toStdString()
+                    << " is no longer bit-exact";
+        }
+    }
+};
+
+TEST_F(EngineRenderTest, TwoDeckCrossfade) {
+    runScenarioFile(QStringLiteral("two-deck-crossfade.json"));
+}
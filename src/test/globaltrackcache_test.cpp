@@ -133,6 +133,9 @@ TEST_F(GlobalTrackCacheTest, resolveByFileInfo) {
     EXPECT_EQ(0, trackWeak.use_count());
     EXPECT_EQ(TrackPointer(), TrackPointer(trackWeak.lock()));
 
+    // Eviction is deferred until the queued events have been processed
+    QCoreApplication::processEvents();
+
     {
         GlobalTrackCacheLocker cacheLocker;
         trackById = cacheLocker.lookupTrackById(trackId);
@@ -233,5 +236,8 @@ TEST_F(GlobalTrackCacheTest, evictWhileMoving) {
 
     track1.reset();
 
+    // Eviction is deferred until the queued events have been processed
+    QCoreApplication::processEvents();
+
     EXPECT_TRUE(GlobalTrackCacheLocker().isEmpty());
 }
@@ -307,3 +307,40 @@ TEST_F(KeyUtilsTest, GetCompatibleKeys) {
                     mixxx::track::io::key::A_MINOR,
                     mixxx::track::io::key::G_MINOR));
 }
+
+TEST_F(KeyUtilsTest, KeyToOpenKeyNumber) {
+    // The table-driven lookup must reproduce the circle-of-fifths numbering,
+    // with relative major/minor pairs sharing a number.
+    EXPECT_EQ(1, KeyUtils::keyToOpenKeyNumber(mixxx::track::io::key::C_MAJOR));
+    EXPECT_EQ(1, KeyUtils::keyToOpenKeyNumber(mixxx::track::io::key::A_MINOR));
+    EXPECT_EQ(7, KeyUtils::keyToOpenKeyNumber(mixxx::track::io::key::F_SHARP_MAJOR));
+    EXPECT_EQ(7, KeyUtils::keyToOpenKeyNumber(mixxx::track::io::key::E_FLAT_MINOR));
+    EXPECT_EQ(12, KeyUtils::keyToOpenKeyNumber(mixxx::track::io::key::F_MAJOR));
+    EXPECT_EQ(12, KeyUtils::keyToOpenKeyNumber(mixxx::track::io::key::D_MINOR));
+    EXPECT_EQ(0, KeyUtils::keyToOpenKeyNumber(mixxx::track::io::key::INVALID));
+
+    // Round trip through openKeyNumberToKey for every key.
+    for (int keyValue = mixxx::track::io::key::C_MAJOR;
+            keyValue <= mixxx::track::io::key::B_MINOR;
+            ++keyValue) {
+        const auto key = static_cast<mixxx::track::io::key::ChromaticKey>(keyValue);
+        const int openKeyNumber = KeyUtils::keyToOpenKeyNumber(key);
+        EXPECT_EQ(key,
+                KeyUtils::openKeyNumberToKey(openKeyNumber, KeyUtils::keyIsMajor(key)));
+    }
+}
+
+TEST_F(KeyUtilsTest, SemitoneChangeToPowerOf2) {
+    // Integer semitone changes hit table entries exactly.
+    EXPECT_DOUBLE_EQ(1.0, KeyUtils::semitoneChangeToPowerOf2(0.0));
+    EXPECT_DOUBLE_EQ(2.0, KeyUtils::semitoneChangeToPowerOf2(12.0));
+    EXPECT_DOUBLE_EQ(0.5, KeyUtils::semitoneChangeToPowerOf2(-12.0));
+
+    // Fractional changes are interpolated to well below a cent of error,
+    // including out-of-table-range values served by the pow() fallback.
+    for (double semitones = -30.0; semitones <= 30.0; semitones += 0.0137) {
+        EXPECT_NEAR(pow(2.0, semitones / 12.0),
+                KeyUtils::semitoneChangeToPowerOf2(semitones),
+                pow(2.0, semitones / 12.0) * 1e-6);
+    }
+}
@@ -0,0 +1,57 @@
+#include "skin/legacy/legacyskinparser.h"
+
+#include <QDomElement>
+#include <QFile>
+#include <QTemporaryDir>
+
+#include "test/mixxxtest.h"
+
+class LegacySkinParserTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        ASSERT_TRUE(m_skinDir.isValid());
+        LegacySkinParser::clearDomCache();
+    }
+
+    void TearDown() override {
+        LegacySkinParser::clearDomCache();
+    }
+
+    void writeSkinXml(const QString& content) {
+        QFile skinXmlFile(m_skinDir.filePath("skin.xml"));
+        ASSERT_TRUE(skinXmlFile.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        skinXmlFile.write(content.toUtf8());
+    }
+
+    QTemporaryDir m_skinDir;
+};
+
+TEST_F(LegacySkinParserTest, OpenSkinParsesDocument) {
+    writeSkinXml(QStringLiteral("<skin><WidgetGroup/></skin>"));
+
+    const QDomElement skinElement = LegacySkinParser::openSkin(m_skinDir.path());
+    ASSERT_FALSE(skinElement.isNull());
+    EXPECT_QSTRING_EQ("skin", skinElement.nodeName());
+    EXPECT_FALSE(skinElement.firstChildElement("WidgetGroup").isNull());
+}
+
+TEST_F(LegacySkinParserTest, OpenSkinReparsesWhenFileChanges) {
+    writeSkinXml(QStringLiteral("<skin><WidgetGroup/></skin>"));
+    ASSERT_FALSE(LegacySkinParser::openSkin(m_skinDir.path()).isNull());
+
+    // Rewriting the file invalidates the cached document. The new content
+    // has a different size, so the change is detected even if the modification
+    // time stamp has not advanced yet.
+    writeSkinXml(QStringLiteral("<skin><SingletonDefinition/></skin>"));
+
+    const QDomElement skinElement = LegacySkinParser::openSkin(m_skinDir.path());
+    ASSERT_FALSE(skinElement.isNull());
+    EXPECT_TRUE(skinElement.firstChildElement("WidgetGroup").isNull());
+    EXPECT_FALSE(skinElement.firstChildElement("SingletonDefinition").isNull());
+}
+
+TEST_F(LegacySkinParserTest, OpenSkinFailsForMissingSkinXml) {
+    QTemporaryDir emptyDir;
+    ASSERT_TRUE(emptyDir.isValid());
+    EXPECT_TRUE(LegacySkinParser::openSkin(emptyDir.path()).isNull());
+}
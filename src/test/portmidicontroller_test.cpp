@@ -9,6 +9,7 @@
 
 using ::testing::_;
 using ::testing::DoAll;
+using ::testing::Invoke;
 using ::testing::NotNull;
 using ::testing::Return;
 using ::testing::Sequence;
@@ -32,6 +33,8 @@ class MockPortMidiController : public PortMidiController {
         PortMidiController::sendShortMsg(status, byte1, byte2);
     }
 
+    using PortMidiController::enqueueShortMsg;
+
     void sendSysexMsg(const QList<int>& data, unsigned int length) {
         PortMidiController::sendSysexMsg(data, length);
     }
@@ -58,6 +61,7 @@ class MockPortMidiDevice : public PortMidiDevice {
     MOCK_METHOD0(poll, PmError());
     MOCK_METHOD2(read, int(PmEvent*, int32_t));
     MOCK_METHOD1(writeShort, PmError(int32_t));
+    MOCK_METHOD2(write, PmError(PmEvent*, int32_t));
     MOCK_METHOD1(writeSysEx, PmError(unsigned char*));
 };
 
@@ -179,6 +183,34 @@ TEST_F(PortMidiControllerTest, WriteShort) {
     m_pController->sendShortMsg(0x80, 0x3C, 0x40);
 };
 
+TEST_F(PortMidiControllerTest, EnqueueShortMsg_CoalescedAndBatched) {
+    EXPECT_CALL(*m_mockOutput, isOpen())
+            .WillRepeatedly(Return(true));
+
+    // Three messages queued within one event loop round trip address two
+    // distinct (status, control) pairs: the first note-on value is superseded
+    // before the flush, so a single batch of two events is written with only
+    // the latest value per pair.
+    PmEvent writtenEvents[2];
+    EXPECT_CALL(*m_mockOutput, write(NotNull(), 2))
+            .WillOnce(DoAll(Invoke([&writtenEvents](PmEvent* events, int32_t length) {
+                for (int32_t i = 0; i < length; ++i) {
+                    writtenEvents[i] = events[i];
+                }
+            }),
+                    Return(pmNoError)));
+
+    m_pController->enqueueShortMsg(0x90, 0x3C, 0x20);
+    m_pController->enqueueShortMsg(0xB0, 0x01, 0x10);
+    m_pController->enqueueShortMsg(0x90, 0x3C, 0x40);
+
+    // The flush is queued on the event loop behind the enqueuing events.
+    application()->processEvents();
+
+    EXPECT_EQ(0x403C90, writtenEvents[0].message);
+    EXPECT_EQ(0x1001B0, writtenEvents[1].message);
+};
+
 TEST_F(PortMidiControllerTest, WriteSysex) {
     QList<int> sysex;
     sysex.append(0xF0);
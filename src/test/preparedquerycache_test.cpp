@@ -0,0 +1,42 @@
+#include "util/db/preparedquerycache.h"
+
+#include <gtest/gtest.h>
+
+#include "test/mixxxdbtest.h"
+
+class PreparedQueryCacheTest : public MixxxDbTest {};
+
+TEST_F(PreparedQueryCacheTest, ReusesPreparedStatement) {
+    mixxx::PreparedQueryCache cache;
+    const QString statement = QStringLiteral("SELECT :value");
+
+    QSqlQuery& query1 = cache.prepared(dbConnection(), statement);
+    query1.bindValue(":value", 1);
+    ASSERT_TRUE(query1.exec());
+    ASSERT_TRUE(query1.next());
+    EXPECT_EQ(1, query1.value(0).toInt());
+
+    // The second lookup must return the very same query object,
+    // reset and ready for binding new values.
+    QSqlQuery& query2 = cache.prepared(dbConnection(), statement);
+    EXPECT_EQ(&query1, &query2);
+    query2.bindValue(":value", 2);
+    ASSERT_TRUE(query2.exec());
+    ASSERT_TRUE(query2.next());
+    EXPECT_EQ(2, query2.value(0).toInt());
+}
+
+TEST_F(PreparedQueryCacheTest, DistinctStatementsGetDistinctQueries) {
+    mixxx::PreparedQueryCache cache;
+
+    QSqlQuery& query1 = cache.prepared(dbConnection(), QStringLiteral("SELECT 1"));
+    QSqlQuery& query2 = cache.prepared(dbConnection(), QStringLiteral("SELECT 2"));
+    EXPECT_NE(&query1, &query2);
+
+    ASSERT_TRUE(query1.exec());
+    ASSERT_TRUE(query1.next());
+    EXPECT_EQ(1, query1.value(0).toInt());
+    ASSERT_TRUE(query2.exec());
+    ASSERT_TRUE(query2.next());
+    EXPECT_EQ(2, query2.value(0).toInt());
+}
@@ -169,6 +169,122 @@ TEST_F(RestApiGatewayTest, AutoDjMoveRejectsOutOfRangePosition) {
             ::testing::HasSubstr("out of range"));
 }
 
+TEST_F(RestApiGatewayTest, PlaylistTracksArePaginated) {
+    auto* const collection = m_pTrackCollectionManager->internalCollection();
+    ASSERT_NE(nullptr, collection);
+    PlaylistDAO& playlistDao = collection->getPlaylistDAO();
+    const int playlistId = playlistDao.createPlaylist(QStringLiteral("Test"));
+    ASSERT_GT(playlistId, 0);
+
+    const TrackId trackId = addTrackToCollection(kTrackLocationTest1);
+    ASSERT_TRUE(trackId.isValid());
+    playlistDao.appendTracksToPlaylist(
+            QList<TrackId>{trackId, trackId, trackId}, playlistId);
+
+    // First page
+    const QHttpServerResponse firstPage = m_pGateway->playlists(playlistId, 2, 0);
+    EXPECT_EQ(firstPage.statusCode(), QHttpServerResponse::StatusCode::Ok);
+    const QJsonObject firstPayload = QJsonDocument::fromJson(firstPage.data()).object();
+    EXPECT_EQ(firstPayload.value("total_tracks").toInt(), 3);
+    EXPECT_EQ(firstPayload.value("offset").toInt(), 0);
+    EXPECT_EQ(firstPayload.value("tracks").toArray().size(), 2);
+    EXPECT_EQ(firstPayload.value("next_offset").toInt(), 2);
+
+    // Last page has no next_offset cursor
+    const QHttpServerResponse lastPage = m_pGateway->playlists(playlistId, 2, 2);
+    EXPECT_EQ(lastPage.statusCode(), QHttpServerResponse::StatusCode::Ok);
+    const QJsonObject lastPayload = QJsonDocument::fromJson(lastPage.data()).object();
+    EXPECT_EQ(lastPayload.value("offset").toInt(), 2);
+    EXPECT_EQ(lastPayload.value("tracks").toArray().size(), 1);
+    EXPECT_FALSE(lastPayload.contains("next_offset"));
+
+    // Without a limit the full listing is returned
+    const QHttpServerResponse fullListing =
+            m_pGateway->playlists(playlistId, std::nullopt, 0);
+    EXPECT_EQ(fullListing.statusCode(), QHttpServerResponse::StatusCode::Ok);
+    const QJsonObject fullPayload = QJsonDocument::fromJson(fullListing.data()).object();
+    EXPECT_EQ(fullPayload.value("tracks").toArray().size(), 3);
+    EXPECT_FALSE(fullPayload.contains("next_offset"));
+}
+
+TEST_F(RestApiGatewayTest, PlaylistResponsesAreCachedWithETag) {
+    auto* const collection = m_pTrackCollectionManager->internalCollection();
+    ASSERT_NE(nullptr, collection);
+    PlaylistDAO& playlistDao = collection->getPlaylistDAO();
+    const int playlistId = playlistDao.createPlaylist(QStringLiteral("Test"));
+    ASSERT_GT(playlistId, 0);
+
+    const TrackId trackId = addTrackToCollection(kTrackLocationTest1);
+    ASSERT_TRUE(trackId.isValid());
+    playlistDao.appendTracksToPlaylist(QList<TrackId>{trackId}, playlistId);
+
+    const QHttpServerResponse first = m_pGateway->playlists(playlistId, std::nullopt, 0);
+    ASSERT_EQ(first.statusCode(), QHttpServerResponse::StatusCode::Ok);
+    const QString etag = QString::fromLatin1(
+            QByteArray(first.headers().value(QByteArrayLiteral("ETag"))));
+    ASSERT_FALSE(etag.isEmpty());
+
+    // Unchanged listing with a matching ETag returns 304 without a body
+    const QHttpServerResponse notModified =
+            m_pGateway->playlists(playlistId, std::nullopt, 0, etag);
+    EXPECT_EQ(notModified.statusCode(), QHttpServerResponse::StatusCode::NotModified);
+
+    // Changing the playlist invalidates the cache: the stale ETag no
+    // longer matches and a full response with a new ETag is returned
+    playlistDao.appendTracksToPlaylist(QList<TrackId>{trackId}, playlistId);
+    const QHttpServerResponse changed =
+            m_pGateway->playlists(playlistId, std::nullopt, 0, etag);
+    EXPECT_EQ(changed.statusCode(), QHttpServerResponse::StatusCode::Ok);
+    const QString newETag = QString::fromLatin1(
+            QByteArray(changed.headers().value(QByteArrayLiteral("ETag"))));
+    EXPECT_FALSE(newETag.isEmpty());
+    EXPECT_NE(newETag, etag);
+    const QJsonObject payload = QJsonDocument::fromJson(changed.data()).object();
+    EXPECT_EQ(payload.value("total_tracks").toInt(), 2);
+}
+
+TEST_F(RestApiGatewayTest, LibraryExportIsColumnarAndIncremental) {
+    const TrackId trackId = addTrackToCollection(kTrackLocationTest1);
+    ASSERT_TRUE(trackId.isValid());
+
+    const QHttpServerResponse full = m_pGateway->libraryExport(0);
+    ASSERT_EQ(full.statusCode(), QHttpServerResponse::StatusCode::Ok);
+    const qint64 lastId = QByteArray(full.headers().value(
+                                             QByteArrayLiteral("X-Mixxx-Last-Id")))
+                                  .toLongLong();
+    EXPECT_GT(lastId, 0);
+
+    const QByteArray raw = qUncompress(full.data());
+    ASSERT_FALSE(raw.isEmpty());
+    QDataStream stream(raw);
+    stream.setVersion(QDataStream::Qt_5_15);
+    quint32 magic = 0;
+    quint16 version = 0;
+    qint32 columnCount = 0;
+    qint64 rowCount = 0;
+    stream >> magic >> version >> columnCount >> rowCount;
+    EXPECT_EQ(magic, 0x4D584C45u); // "MXLE"
+    EXPECT_EQ(version, 1);
+    EXPECT_GT(columnCount, 0);
+    EXPECT_EQ(rowCount, 1);
+    // The id column comes first; its single value is the exported track
+    QString columnName;
+    quint8 columnType = 0;
+    qint64 idValue = 0;
+    stream >> columnName >> columnType >> idValue;
+    EXPECT_EQ(columnName, QStringLiteral("id"));
+    EXPECT_EQ(idValue, lastId);
+
+    // Nothing was added after lastId, so the incremental export is empty
+    const QHttpServerResponse incremental = m_pGateway->libraryExport(
+            static_cast<int>(lastId));
+    ASSERT_EQ(incremental.statusCode(), QHttpServerResponse::StatusCode::Ok);
+    EXPECT_EQ(QByteArray(incremental.headers().value(
+                                 QByteArrayLiteral("X-Mixxx-Row-Count")))
+                      .toLongLong(),
+            0);
+}
+
 TEST_F(RestApiGatewayTest, StatusCpuUsageIsRoundedIntegerString) {
     QJsonObject payload = m_pGateway->statusPayload();
     QJsonValue cpuUsage = payload.value("system").toObject().value("cpu_usage_percent");
@@ -72,6 +72,10 @@ class StubRestApiGateway : public RestApiProvider {
         return jsonResponse("decks");
     }
 
+    QJsonObject decksPayload() const override {
+        return QJsonObject{{"deck_1", QJsonObject{{"playing", false}}}};
+    }
+
     QHttpServerResponse control(const QJsonObject&) const override {
         return jsonResponseWithCounter("control");
     }
@@ -84,7 +88,10 @@ class StubRestApiGateway : public RestApiProvider {
         return jsonResponseWithCounter("autodj");
     }
 
-    QHttpServerResponse playlists(const std::optional<int>&) const override {
+    QHttpServerResponse playlists(const std::optional<int>&,
+            const std::optional<int>&,
+            int,
+            const QString&) const override {
         return jsonResponse("playlists");
     }
 
@@ -92,6 +99,10 @@ class StubRestApiGateway : public RestApiProvider {
         return jsonResponseWithCounter("playlistcommand");
     }
 
+    QHttpServerResponse libraryExport(int /*sinceId*/) const override {
+        return jsonResponse("libraryexport");
+    }
+
     QHttpServerResponse withIdempotencyCache(
             const QString& token,
             const QString& idempotencyKey,
@@ -331,6 +342,8 @@ TEST(RestServerRoutesTest, VersionedPathsServeRequests) {
     expectOk("/schema", "GET");
     expectOk("/api/v1/ready", "GET");
     expectOk("/api/v1/status", "GET");
+    expectOk("/api/v1/cpu", "GET");
+    expectOk("/api/v1/latency", "GET");
     expectOk("/api/v1/decks", "GET");
     expectOk("/api/v1/decks/1", "GET");
     expectOk("/api/v1/autodj", "GET");
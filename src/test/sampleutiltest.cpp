@@ -176,6 +176,37 @@ TEST_F(SampleUtilTest, add3WithGain) {
     }
 }
 
+TEST_F(SampleUtilTest, addBuffers) {
+    for (int i = 0; i < buffers.size(); ++i) {
+        CSAMPLE* buffer = buffers[i];
+        int size = sizes[i];
+        QList<CSAMPLE*> sourceBuffers;
+        // Cover the batched four-source passes as well as all remainder
+        // lengths (0-3 sources).
+        for (int numSources = 0; numSources <= 7; ++numSources) {
+            while (sourceBuffers.size() < numSources) {
+                CSAMPLE* sourceBuffer = SampleUtil::alloc(size);
+                FillBuffer(sourceBuffer,
+                        static_cast<CSAMPLE>(sourceBuffers.size() + 1),
+                        size);
+                sourceBuffers.append(sourceBuffer);
+            }
+            ClearBuffer(buffer, size);
+            SampleUtil::addBuffers(buffer,
+                    sourceBuffers.constData(),
+                    numSources,
+                    size);
+            // Sum of 1 + 2 + ... + numSources
+            AssertWholeBufferEquals(buffer,
+                    static_cast<CSAMPLE>(numSources * (numSources + 1) / 2),
+                    size);
+        }
+        for (CSAMPLE* sourceBuffer : std::as_const(sourceBuffers)) {
+            SampleUtil::free(sourceBuffer);
+        }
+    }
+}
+
 TEST_F(SampleUtilTest, copyWithGain) {
     for (int i = 0; i < buffers.size(); ++i) {
         CSAMPLE* buffer = buffers[i];
@@ -350,6 +381,110 @@ TEST_F(SampleUtilTest, deinterleaveBuffer) {
     }
 }
 
+TEST_F(SampleUtilTest, interleaveClampStereoBuffers) {
+    constexpr SINT numFrames = 64;
+    constexpr int frameSize = 6;
+    CSAMPLE* src1 = SampleUtil::alloc(numFrames * 2);
+    CSAMPLE* src2 = SampleUtil::alloc(numFrames * 2);
+    CSAMPLE* dest = SampleUtil::alloc(numFrames * frameSize);
+    FillBuffer(dest, 0.5f, numFrames * frameSize);
+    for (SINT j = 0; j < numFrames; j++) {
+        src1[j * 2] = 0.1f;
+        src1[j * 2 + 1] = -0.2f;
+        // Out of range samples must be clamped into [-1.0, 1.0].
+        src2[j * 2] = 2.0f;
+        src2[j * 2 + 1] = -3.0f;
+    }
+
+    const CSAMPLE* srcs[] = {src1, src2};
+    const int channelBases[] = {0, 4};
+    SampleUtil::interleaveClampStereoBuffers(
+            dest, srcs, channelBases, 2, frameSize, numFrames);
+
+    for (SINT j = 0; j < numFrames; j++) {
+        EXPECT_FLOAT_EQ(dest[j * frameSize], 0.1f);
+        EXPECT_FLOAT_EQ(dest[j * frameSize + 1], -0.2f);
+        // The channels not covered by any source must be cleared.
+        EXPECT_FLOAT_EQ(dest[j * frameSize + 2], 0.0f);
+        EXPECT_FLOAT_EQ(dest[j * frameSize + 3], 0.0f);
+        EXPECT_FLOAT_EQ(dest[j * frameSize + 4], 1.0f);
+        EXPECT_FLOAT_EQ(dest[j * frameSize + 5], -1.0f);
+    }
+
+    SampleUtil::free(src1);
+    SampleUtil::free(src2);
+    SampleUtil::free(dest);
+}
+
+TEST_F(SampleUtilTest, deinterleaveStereoBuffers) {
+    constexpr SINT numFrames = 64;
+    constexpr int frameSize = 6;
+    CSAMPLE* dest1 = SampleUtil::alloc(numFrames * 2);
+    CSAMPLE* dest2 = SampleUtil::alloc(numFrames * 2);
+    CSAMPLE* src = SampleUtil::alloc(numFrames * frameSize);
+    FillBuffer(dest1, 0.5f, numFrames * 2);
+    FillBuffer(dest2, 0.5f, numFrames * 2);
+    for (SINT j = 0; j < numFrames * frameSize; j++) {
+        src[j] = j;
+    }
+
+    CSAMPLE* dests[] = {dest1, dest2};
+    const int channelBases[] = {2, 4};
+    SampleUtil::deinterleaveStereoBuffers(
+            dests, channelBases, 2, src, frameSize, numFrames);
+
+    for (SINT j = 0; j < numFrames; j++) {
+        EXPECT_FLOAT_EQ(dest1[j * 2], j * frameSize + 2);
+        EXPECT_FLOAT_EQ(dest1[j * 2 + 1], j * frameSize + 3);
+        EXPECT_FLOAT_EQ(dest2[j * 2], j * frameSize + 4);
+        EXPECT_FLOAT_EQ(dest2[j * 2 + 1], j * frameSize + 5);
+    }
+
+    SampleUtil::free(dest1);
+    SampleUtil::free(dest2);
+    SampleUtil::free(src);
+}
+
+TEST_F(SampleUtilTest, linearResampleBuffer) {
+    constexpr SINT numSrcFrames = 65;
+    constexpr SINT numDestFrames = 64;
+    CSAMPLE* src = SampleUtil::alloc(numSrcFrames * 2);
+    CSAMPLE* dest = SampleUtil::alloc(numSrcFrames * 2);
+    // A linear ramp is reproduced exactly by linear interpolation.
+    for (SINT j = 0; j < numSrcFrames; j++) {
+        src[j * 2] = j;
+        src[j * 2 + 1] = -j;
+    }
+
+    // Compress by one frame.
+    SampleUtil::linearResampleBuffer(dest, src, numDestFrames, numSrcFrames, 2);
+    double step = static_cast<double>(numSrcFrames - 1) / (numDestFrames - 1);
+    for (SINT i = 0; i < numDestFrames; i++) {
+        EXPECT_NEAR(dest[i * 2], i * step, 1e-3);
+        EXPECT_NEAR(dest[i * 2 + 1], -i * step, 1e-3);
+    }
+    // The chunk boundaries must map exactly so that consecutive chunks
+    // stay continuous.
+    EXPECT_FLOAT_EQ(dest[0], 0.0f);
+    EXPECT_FLOAT_EQ(dest[(numDestFrames - 1) * 2], numSrcFrames - 1);
+
+    // Stretch by one frame.
+    SampleUtil::linearResampleBuffer(src, dest, numSrcFrames, numDestFrames, 2);
+    EXPECT_FLOAT_EQ(src[0], 0.0f);
+    EXPECT_FLOAT_EQ(src[(numSrcFrames - 1) * 2], numSrcFrames - 1);
+    EXPECT_FLOAT_EQ(src[(numSrcFrames - 1) * 2 + 1],
+            -static_cast<CSAMPLE>(numSrcFrames - 1));
+
+    // Same length degenerates to a plain copy.
+    SampleUtil::linearResampleBuffer(dest, src, numSrcFrames, numSrcFrames, 2);
+    for (SINT j = 0; j < numSrcFrames * 2; j++) {
+        EXPECT_FLOAT_EQ(dest[j], src[j]);
+    }
+
+    SampleUtil::free(src);
+    SampleUtil::free(dest);
+}
+
 TEST_F(SampleUtilTest, reverse) {
     if (buffers.size() > 0 && sizes[0] > 10) {
         CSAMPLE* buffer = buffers[1];
@@ -35,6 +35,26 @@ class SearchQueryParserTest : public LibraryTest {
         return pTrack ? pTrack->getId() : TrackId();
     }
 
+    // The expected SQL for an untagged search term. With the FTS5 search
+    // index available untagged terms query the index (see SearchIndexDAO),
+    // otherwise they fall back to LIKE filters over all search columns.
+    QString untaggedTermSql(const QStringList& columns, const QString& term) const {
+        if (internalCollection()->getSearchIndexDAO().isEnabled()) {
+            return QString(
+                    "id IN (SELECT rowid FROM track_search "
+                    "WHERE track_search MATCH '{%1}: \"%2\"*')")
+                    .arg(columns.join(' '), term);
+        }
+        QStringList clauses;
+        for (const QString& column : columns) {
+            clauses << QString("%1 LIKE '%%2%'").arg(column, term);
+        }
+        if (clauses.size() == 1) {
+            return clauses.first();
+        }
+        return "(" + clauses.join(") OR (") + ")";
+    }
+
     SearchQueryParser m_parser;
 
     // The expected query to be returned by CrateFilterNode
@@ -67,7 +87,7 @@ TEST_F(SearchQueryParserTest, OneTermOneColumn) {
     EXPECT_TRUE(pQuery->match(pTrack));
 
     EXPECT_STREQ(
-        qPrintable(QString("artist LIKE '%asdf%'")),
+        qPrintable(untaggedTermSql({"artist"}, "asdf")),
         qPrintable(pQuery->toSql()));
 }
 
@@ -83,7 +103,7 @@ TEST_F(SearchQueryParserTest, OneTermMultipleColumns) {
     EXPECT_TRUE(pQuery->match(pTrack));
 
     EXPECT_STREQ(
-        qPrintable(QString("(artist LIKE '%asdf%') OR (album LIKE '%asdf%')")),
+        qPrintable(untaggedTermSql({"artist", "album"}, "asdf")),
         qPrintable(pQuery->toSql()));
 }
 
@@ -99,7 +119,8 @@ TEST_F(SearchQueryParserTest, OneTermMultipleColumnsNegation) {
     EXPECT_FALSE(pQuery->match(pTrack));
 
     EXPECT_STREQ(
-        qPrintable(QString("NOT ((artist LIKE '%asdf%') OR (album LIKE '%asdf%'))")),
+        qPrintable(QString("NOT (%1)").arg(
+                untaggedTermSql({"artist", "album"}, "asdf"))),
         qPrintable(pQuery->toSql()));
 }
 
@@ -115,7 +136,9 @@ TEST_F(SearchQueryParserTest, MultipleTermsOneColumn) {
     EXPECT_TRUE(pQuery->match(pTrack));
 
     EXPECT_STREQ(
-        qPrintable(QString("(artist LIKE '%asdf%') AND (artist LIKE '%zxcv%')")),
+        qPrintable(QString("(%1) AND (%2)").arg(
+                untaggedTermSql({"artist"}, "asdf"),
+                untaggedTermSql({"artist"}, "zxcv"))),
         qPrintable(pQuery->toSql()));
 }
 
@@ -135,9 +158,9 @@ TEST_F(SearchQueryParserTest, MultipleTermsMultipleColumns) {
     EXPECT_TRUE(pQuery->match(pTrack));
 
     EXPECT_STREQ(
-        qPrintable(QString(
-            "((artist LIKE '%asdf%') OR (album LIKE '%asdf%')) "
-            "AND ((artist LIKE '%zxcv%') OR (album LIKE '%zxcv%'))")),
+        qPrintable(QString("(%1) AND (%2)").arg(
+                untaggedTermSql({"artist", "album"}, "asdf"),
+                untaggedTermSql({"artist", "album"}, "zxcv"))),
         qPrintable(pQuery->toSql()));
 }
 
@@ -158,9 +181,9 @@ TEST_F(SearchQueryParserTest, MultipleTermsMultipleColumnsNegation) {
     EXPECT_FALSE(pQuery->match(pTrack));
 
     EXPECT_STREQ(
-        qPrintable(QString(
-            "((artist LIKE '%asdf%') OR (album LIKE '%asdf%')) "
-            "AND (NOT ((artist LIKE '%zxcv%') OR (album LIKE '%zxcv%')))")),
+        qPrintable(QString("(%1) AND (NOT (%2))").arg(
+                untaggedTermSql({"artist", "album"}, "asdf"),
+                untaggedTermSql({"artist", "album"}, "zxcv"))),
         qPrintable(pQuery->toSql()));
 }
 
@@ -630,8 +653,10 @@ TEST_F(SearchQueryParserTest, MultipleFilters) {
     EXPECT_STREQ(qPrintable(QString("(bpm BETWEEN 127.12 AND 129) AND "
                                     "((artist LIKE '%com truise%') OR "
                                     "(album_artist LIKE '%com truise%')) AND "
-                                    "((artist LIKE '%colorvision%') OR (title "
-                                    "LIKE '%colorvision%'))")),
+                                    "(%1)")
+                                    .arg(untaggedTermSql(
+                                            {"artist", "title"},
+                                            "colorvision"))),
             qPrintable(pQuery->toSql()));
 }
 
@@ -647,7 +672,8 @@ TEST_F(SearchQueryParserTest, ExtraFilterAppended) {
     EXPECT_TRUE(pQuery->match(pTrack));
 
     EXPECT_STREQ(
-        qPrintable(QString("(1 > 2) AND (artist LIKE '%asdf%')")),
+        qPrintable(QString("(1 > 2) AND (%1)").arg(
+                untaggedTermSql({"artist"}, "asdf"))),
         qPrintable(pQuery->toSql()));
 }
 
@@ -1188,6 +1214,55 @@ TEST_F(SearchQueryParserTest, QueryIsLessSpecific) {
             QStringLiteral("crate:\"a b c\"")));
 }
 
+TEST_F(SearchQueryParserTest, QueryStrictlyNarrows) {
+    // Extending the last term narrows
+    EXPECT_TRUE(SearchQueryParser::queryStrictlyNarrows(
+            QStringLiteral("deep hou"),
+            QStringLiteral("deep house")));
+
+    // Appending a new term narrows
+    EXPECT_TRUE(SearchQueryParser::queryStrictlyNarrows(
+            QStringLiteral("deep house"),
+            QStringLiteral("deep house 124")));
+
+    // Unchanged query counts as narrowing (same result set)
+    EXPECT_TRUE(SearchQueryParser::queryStrictlyNarrows(
+            QStringLiteral("deep"),
+            QStringLiteral("deep")));
+
+    // Deleting characters widens
+    EXPECT_FALSE(SearchQueryParser::queryStrictlyNarrows(
+            QStringLiteral("deep house"),
+            QStringLiteral("deep hou")));
+
+    // Everything narrows the empty query, but there is no previous
+    // result set to refine
+    EXPECT_FALSE(SearchQueryParser::queryStrictlyNarrows(
+            QLatin1String(""),
+            QStringLiteral("deep")));
+
+    // Extending a negated term widens
+    EXPECT_FALSE(SearchQueryParser::queryStrictlyNarrows(
+            QStringLiteral("deep -h"),
+            QStringLiteral("deep -ho")));
+
+    // Numeric field filters match exactly, bpm:124 is not a subset of bpm:12
+    EXPECT_FALSE(SearchQueryParser::queryStrictlyNarrows(
+            QStringLiteral("bpm:12"),
+            QStringLiteral("bpm:124")));
+
+    // Quotes and OR operators change term boundaries
+    EXPECT_FALSE(SearchQueryParser::queryStrictlyNarrows(
+            QStringLiteral("\"deep"),
+            QStringLiteral("\"deep house\"")));
+    EXPECT_FALSE(SearchQueryParser::queryStrictlyNarrows(
+            QStringLiteral("deep"),
+            QStringLiteral("deep | house")));
+    EXPECT_FALSE(SearchQueryParser::queryStrictlyNarrows(
+            QStringLiteral("deep"),
+            QStringLiteral("deep OR house")));
+}
+
 TEST_F(SearchQueryParserTest, EmptyOrOperator) {
     auto pQuery = m_parser.parseQuery("|", QString());
 
@@ -53,6 +53,20 @@ TEST_F(SoftTakeoverTest, DoesntIgnoreSameValue) {
     EXPECT_FALSE(st_control.ignore(&co, co.getParameterForValue(0.6)));
 }
 
+TEST_F(SoftTakeoverTest, EnableAndIgnoreSingleLookup) {
+    // Range -1.0 to 1.0
+    ControlPotmeter co(ConfigKey("[Channel1]", "test_pot"), -1.0, 1.0);
+
+    co.set(0.6);
+    SoftTakeoverCtrl st_control;
+    // The first call enables soft-takeover and ignores the first value,
+    // just like enable() followed by ignore().
+    EXPECT_TRUE(st_control.enableAndIgnore(
+            gsl::make_not_null(&co), co.getParameterForValue(0.6)));
+    EXPECT_FALSE(st_control.enableAndIgnore(
+            gsl::make_not_null(&co), co.getParameterForValue(0.6)));
+}
+
 // These are corner cases that allow for quickly flicking/whipping controls
 //  from a standstill when the previous knob value matches the current CO value
 TEST_F(SoftTakeoverTest, SuperFastPrevEqCurrent) {
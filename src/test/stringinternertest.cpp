@@ -0,0 +1,49 @@
+#include "util/stringinterner.h"
+
+#include <gtest/gtest.h>
+
+namespace mixxx {
+
+namespace {
+
+// Build strings dynamically to prevent the compiler from sharing
+// the backing data of identical literals.
+QString dynamicString(const QString& prefix, int suffix) {
+    return prefix + QString::number(suffix);
+}
+
+} // anonymous namespace
+
+TEST(StringInternerTest, InternedCopiesShareCharacterData) {
+    const QString first = dynamicString(QStringLiteral("Artist "), 42);
+    const QString second = dynamicString(QStringLiteral("Artist "), 42);
+    ASSERT_EQ(first, second);
+    ASSERT_NE(static_cast<const void*>(first.constData()),
+            static_cast<const void*>(second.constData()));
+
+    const QString firstInterned = StringInterner::intern(first);
+    const QString secondInterned = StringInterner::intern(second);
+    EXPECT_EQ(first, firstInterned);
+    EXPECT_EQ(second, secondInterned);
+    // Both interned copies share the data of the single pooled instance
+    EXPECT_EQ(static_cast<const void*>(firstInterned.constData()),
+            static_cast<const void*>(secondInterned.constData()));
+}
+
+TEST(StringInternerTest, EmptyStringsBypassThePool) {
+    const int countBefore = StringInterner::count();
+    EXPECT_TRUE(StringInterner::intern(QString()).isNull());
+    EXPECT_TRUE(StringInterner::intern(QStringLiteral("")).isEmpty());
+    EXPECT_EQ(countBefore, StringInterner::count());
+}
+
+TEST(StringInternerTest, DistinctValuesArePooledOnce) {
+    const int countBefore = StringInterner::count();
+    const QString value = dynamicString(QStringLiteral("Genre "), 4711);
+    StringInterner::intern(value);
+    EXPECT_EQ(countBefore + 1, StringInterner::count());
+    StringInterner::intern(value);
+    EXPECT_EQ(countBefore + 1, StringInterner::count());
+}
+
+} // namespace mixxx
@@ -149,6 +149,8 @@ class SyncTrackMetadataTest : public LibraryTest {
         EXPECT_TRUE(trackId.isValid());
         EXPECT_TRUE(pTrack->isDirty());
         pTrack.reset();
+        // Eviction is deferred until the queued events have been processed
+        QCoreApplication::processEvents();
         EXPECT_EQ(nullptr, GlobalTrackCacheLocker().lookupTrackById(trackId));
     }
 
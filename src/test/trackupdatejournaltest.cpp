@@ -0,0 +1,98 @@
+#include "library/trackupdatejournal.h"
+
+#include <gtest/gtest.h>
+
+#include <QSqlQuery>
+
+#include "test/librarytest.h"
+#include "track/track.h"
+
+namespace {
+
+TrackUpdateJournal::Entry newEntry(const Track& track) {
+    TrackUpdateJournal::Entry entry;
+    entry.trackId = track.getId();
+    entry.record = track.getRecord();
+    entry.pBeats = track.getBeats();
+    entry.cuePoints = track.getCuePoints();
+    entry.pWaveform = track.getWaveform();
+    entry.pWaveformSummary = track.getWaveformSummary();
+    return entry;
+}
+
+} // anonymous namespace
+
+class TrackUpdateJournalTest : public LibraryTest {
+  protected:
+    TrackPointer addTestTrack() {
+        const mixxx::FileInfo fileInfo(
+                QDir(QDir::tempPath()), QStringLiteral("journaled.mp3"));
+        TrackPointer pTrack = Track::newTemporary(mixxx::FileAccess(fileInfo));
+        pTrack->setTitle(QStringLiteral("Original"));
+        const TrackId trackId = internalCollection()->addTrack(pTrack, false);
+        EXPECT_TRUE(trackId.isValid());
+        return pTrack;
+    }
+
+    QString readTitleFromLibrary(TrackId trackId) {
+        QSqlQuery query(dbConnection());
+        query.prepare(QStringLiteral("SELECT title FROM library WHERE id=:id"));
+        query.bindValue(QStringLiteral(":id"), trackId.toVariant());
+        EXPECT_TRUE(query.exec());
+        EXPECT_TRUE(query.next());
+        return query.value(0).toString();
+    }
+};
+
+TEST_F(TrackUpdateJournalTest, replaysJournaledUpdate) {
+    const TrackPointer pTrack = addTestTrack();
+
+    TrackUpdateJournal journal(dbConnectionPooler(), config());
+    journal.start();
+
+    pTrack->setTitle(QStringLiteral("Journaled"));
+    EXPECT_TRUE(journal.enqueue(newEntry(*pTrack)));
+    // The flush barrier must not return before the update has been
+    // committed on the journal thread.
+    journal.waitForPendingUpdate(pTrack->getId());
+    EXPECT_EQ(QStringLiteral("Journaled"), readTitleFromLibrary(pTrack->getId()));
+
+    journal.stop();
+}
+
+TEST_F(TrackUpdateJournalTest, coalescesPendingUpdatesPerTrack) {
+    const TrackPointer pTrack = addTestTrack();
+
+    TrackUpdateJournal journal(dbConnectionPooler(), config());
+    journal.start();
+
+    // Both updates fall into the same coalescing window; only the
+    // last snapshot of the track must be committed.
+    pTrack->setTitle(QStringLiteral("Intermediate"));
+    EXPECT_TRUE(journal.enqueue(newEntry(*pTrack)));
+    pTrack->setTitle(QStringLiteral("Final"));
+    EXPECT_TRUE(journal.enqueue(newEntry(*pTrack)));
+    journal.waitForPendingUpdate(pTrack->getId());
+    EXPECT_EQ(QStringLiteral("Final"), readTitleFromLibrary(pTrack->getId()));
+
+    journal.stop();
+}
+
+TEST_F(TrackUpdateJournalTest, stopFlushesPendingUpdates) {
+    const TrackPointer pTrack = addTestTrack();
+
+    TrackUpdateJournal journal(dbConnectionPooler(), config());
+    journal.start();
+
+    pTrack->setTitle(QStringLiteral("Flushed"));
+    EXPECT_TRUE(journal.enqueue(newEntry(*pTrack)));
+    // stop() must replay all remaining entries before joining the
+    // thread, even without an intervening flush barrier.
+    journal.stop();
+    EXPECT_EQ(QStringLiteral("Flushed"), readTitleFromLibrary(pTrack->getId()));
+
+    // After the thread has exited the flush barrier must return
+    // immediately instead of blocking on a journal that will never
+    // commit again.
+    journal.waitForPendingUpdate(pTrack->getId());
+}
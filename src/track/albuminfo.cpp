@@ -1,8 +1,15 @@
 #include "track/albuminfo.h"
 
+#include "util/stringinterner.h"
+
 
 namespace mixxx {
 
+void AlbumInfo::internStrings() {
+    m_artist = StringInterner::intern(m_artist);
+    m_title = StringInterner::intern(m_title);
+}
+
 bool operator==(const AlbumInfo& lhs, const AlbumInfo& rhs) {
     return (lhs.getArtist() == rhs.getArtist()) &&
 #if defined(__EXTRA_METADATA__)
@@ -40,6 +40,10 @@ class AlbumInfo final {
         refReplayGain().normalizeBeforeExport();
 #endif // __EXTRA_METADATA__
     }
+
+    // Deduplicates the album artist and title through the shared
+    // StringInterner pool, see TrackInfo::internStrings().
+    void internStrings();
 };
 
 bool operator==(const AlbumInfo& lhs, const AlbumInfo& rhs);
@@ -21,6 +21,12 @@ struct BeatGridV1Data {
 
 constexpr double kEpsilon = 0.01;
 
+// Maximum number of beats a BeatCursor moves its cached iterator
+// incrementally before falling back to a full lookup via
+// Beats::iteratorFrom(). Sequential engine callbacks advance by far less
+// than this, while seeks and loop jumps quickly exceed it.
+constexpr int kMaxIncrementalCursorSteps = 8;
+
 } // namespace
 
 namespace mixxx {
@@ -472,6 +478,102 @@ Beats::ConstIterator Beats::iteratorFrom(audio::FramePos position) const {
     return it;
 }
 
+BeatCursor Beats::createCursor() const {
+    return BeatCursor(clonePointer());
+}
+
+Beats::ConstIterator BeatCursor::seekIterator(audio::FramePos position) {
+    if (m_it) {
+        auto it = *m_it;
+        int remainingSteps = kMaxIncrementalCursorSteps;
+        if (*it < position) {
+            // Move forward until the iterator points to the first beat at
+            // or after the position again. Incrementing stops at cend()
+            // because its position exceeds any valid query position.
+            while (*it < position && remainingSteps-- > 0) {
+                it++;
+            }
+        } else {
+            // Move backward while the preceding beat is still at or after
+            // the position.
+            while (it != m_pBeats->cbegin() && *std::prev(it) >= position &&
+                    remainingSteps-- > 0) {
+                it--;
+            }
+        }
+        if (*it >= position &&
+                (it == m_pBeats->cbegin() || *std::prev(it) < position)) {
+            m_it = it;
+            return it;
+        }
+        // The position jumped too far since the last query,
+        // fall through to a full lookup.
+    }
+    const auto it = m_pBeats->iteratorFrom(position);
+    m_it = it;
+    return it;
+}
+
+BeatCursor::PrevNextBeats BeatCursor::findPrevNextBeats(
+        audio::FramePos position, bool snapToNearBeats) {
+    PrevNextBeats result{audio::kInvalidFramePos, audio::kInvalidFramePos, 0.0};
+    auto it = seekIterator(position);
+    if (it == m_pBeats->cend()) {
+        result.prevPosition = *it;
+        return result;
+    } else if (it == m_pBeats->cbegin()) {
+        result.nextPosition = *it;
+        return result;
+    }
+
+    if (*it == position) {
+        result.prevPosition = *it;
+        it++;
+        result.nextPosition = *it;
+        return result;
+    }
+
+    DEBUG_ASSERT(*it > position);
+    if (snapToNearBeats) {
+        const audio::FrameDiff_t beatLengthFrames = *it - *std::prev(it);
+        const double beatFraction = (*it - position) / beatLengthFrames;
+        DEBUG_ASSERT(beatFraction > 0 && beatFraction < 1);
+        if (beatFraction < kEpsilon) {
+            result.prevPosition = *it;
+            it++;
+            result.nextPosition = *it;
+            return result;
+        }
+    }
+
+    result.nextPosition = *it;
+    it--;
+    result.prevPosition = *it;
+    result.fractionOfBeat = (position - result.prevPosition) /
+            (result.nextPosition - result.prevPosition);
+    return result;
+}
+
+audio::FramePos BeatCursor::findNthBeat(audio::FramePos position, int n) {
+    if (n == 0) {
+        return audio::kInvalidFramePos;
+    }
+
+    auto it = seekIterator(position);
+    const bool searchForward = n > 0;
+    if (searchForward) {
+        n--;
+    } else if (*it == position) {
+        n++;
+    }
+
+    if (n != 0) {
+        it += n;
+    }
+
+    return *it;
+}
+
 audio::FramePos Beats::findNthBeat(audio::FramePos position, int n) const {
     if (n == 0) {
         return audio::kInvalidFramePos;
@@ -617,6 +719,7 @@ mixxx::Bpm Beats::getBpmAroundPosition(audio::FramePos position, int n) const {
 
 std::optional<BeatsPointer> Beats::tryTranslate(audio::FrameDiff_t offsetFrames) const {
     std::vector<BeatMarker> markers;
+    markers.reserve(m_markers.size());
     std::transform(m_markers.cbegin(),
             m_markers.cend(),
             std::back_inserter(markers),
@@ -21,6 +21,8 @@ namespace mixxx {
 class Beats;
 typedef std::shared_ptr<const Beats> BeatsPointer;
 
+class BeatCursor;
+
 /// A beat marker is denotes the border of a tempo section inside a track.
 class BeatMarker {
   public:
@@ -213,6 +215,13 @@ class Beats : private std::enable_shared_from_this<Beats> {
 
     ConstIterator iteratorFrom(audio::FramePos position) const;
 
+    /// Create a cursor for repeated beat queries at mostly-sequential
+    /// positions, e.g. once per engine callback. The cursor keeps this
+    /// (immutable) Beats instance alive via a BeatsPointer and caches the
+    /// iterator of the last query, so that subsequent queries for nearby
+    /// positions avoid re-running the marker search in `iteratorFrom()`.
+    BeatCursor createCursor() const;
+
     friend bool operator==(const Beats& lhs, const Beats& rhs) {
         return lhs.m_markers == rhs.m_markers &&
                 lhs.m_lastMarkerPosition == rhs.m_lastMarkerPosition &&
@@ -445,4 +454,59 @@ class Beats : private std::enable_shared_from_this<Beats> {
     const QString m_subVersion;
 };
 
+/// Cached lookup state for repeated beat queries, created via
+/// `Beats::createCursor()`.
+///
+/// The engine controls (BpmControl, LoopingControl, QuantizeControl) query
+/// the beat grid for almost-sequential positions on every callback. A cursor
+/// remembers the iterator of the last query and moves it incrementally as
+/// long as consecutive positions stay within a few beats of each other,
+/// falling back to a full `Beats::iteratorFrom()` lookup after larger jumps
+/// (seeks, loops). It also offers a batched prev/next/phase query so callers
+/// need only a single lookup per callback.
+///
+/// Like the iterators themselves, a cursor is not thread-safe; each consumer
+/// should create its own.
+class BeatCursor {
+  public:
+    /// Result of a batched `findPrevNextBeats()` query. `prevPosition` and
+    /// `nextPosition` match the out-parameters of
+    /// `Beats::findPrevNextBeats()`. `fractionOfBeat` is the relative
+    /// position of the queried position within [prevPosition, nextPosition)
+    /// and 0.0 if the position is (or snaps to) a beat.
+    struct PrevNextBeats {
+        audio::FramePos prevPosition;
+        audio::FramePos nextPosition;
+        double fractionOfBeat;
+
+        bool isValid() const {
+            return prevPosition.isValid() && nextPosition.isValid();
+        }
+    };
+
+    explicit BeatCursor(BeatsPointer pBeats)
+            : m_pBeats(std::move(pBeats)) {
+        DEBUG_ASSERT(m_pBeats);
+    }
+
+    const BeatsPointer& getBeats() const {
+        return m_pBeats;
+    }
+
+    /// Batched equivalent of `Beats::findPrevNextBeats()` that additionally
+    /// returns the fraction of the beat at the queried position.
+    PrevNextBeats findPrevNextBeats(audio::FramePos position, bool snapToNearBeats);
+
+    /// Equivalent of `Beats::findNthBeat()`, seeded from the cached iterator.
+    audio::FramePos findNthBeat(audio::FramePos position, int n);
+
+  private:
+    /// Move the cached iterator to the first beat at or after `position`,
+    /// matching the invariant of `Beats::iteratorFrom()`.
+    Beats::ConstIterator seekIterator(audio::FramePos position);
+
+    BeatsPointer m_pBeats;
+    std::optional<Beats::ConstIterator> m_it;
+};
+
 } // namespace mixxx
@@ -35,6 +35,17 @@ TrackRef createTrackRef(const Track& track) {
     return TrackRef::fromFileInfo(track.getFileInfo(), track.getId());
 }
 
+// Resolving the canonical location accesses the file system. Doing
+// this before acquiring the cache lock avoids stalling concurrent
+// resolvers behind file I/O for an unrelated track. The result is
+// cached inside the QFileInfo and reused by the lookup under the lock.
+inline void prefetchCanonicalLocation(
+        const mixxx::FileAccess& fileAccess) {
+    if (fileAccess.info().hasLocation()) {
+        fileAccess.info().canonicalLocation();
+    }
+}
+
 class EvictAndSaveFunctor {
   public:
     explicit EvictAndSaveFunctor(
@@ -70,6 +81,10 @@ GlobalTrackCacheLocker::GlobalTrackCacheLocker()
     lockCache();
 }
 
+GlobalTrackCacheLocker::GlobalTrackCacheLocker(DeferLock)
+        : m_pInstance(nullptr) {
+}
+
 GlobalTrackCacheLocker::GlobalTrackCacheLocker(
         GlobalTrackCacheLocker&& moveable)
         : m_pInstance(std::move(moveable.m_pInstance)) {
@@ -154,7 +169,10 @@ QSet<TrackId> GlobalTrackCacheLocker::getCachedTrackIds() const {
 GlobalTrackCacheResolver::GlobalTrackCacheResolver(
         mixxx::FileAccess fileAccess,
         bool temporary)
-        : m_lookupResult(GlobalTrackCacheLookupResult::None) {
+        : GlobalTrackCacheLocker(DeferLock{}),
+          m_lookupResult(GlobalTrackCacheLookupResult::None) {
+    prefetchCanonicalLocation(fileAccess);
+    lockCache();
     DEBUG_ASSERT(m_pInstance);
     if (temporary) {
         m_pInstance->resolveTemporary(this, std::move(fileAccess));
@@ -167,7 +185,10 @@ GlobalTrackCacheResolver::GlobalTrackCacheResolver(
 GlobalTrackCacheResolver::GlobalTrackCacheResolver(
         mixxx::FileAccess fileAccess,
         TrackId trackId)
-        : m_lookupResult(GlobalTrackCacheLookupResult::None) {
+        : GlobalTrackCacheLocker(DeferLock{}),
+          m_lookupResult(GlobalTrackCacheLookupResult::None) {
+    prefetchCanonicalLocation(fileAccess);
+    lockCache();
     DEBUG_ASSERT(m_pInstance);
     m_pInstance->resolve(this, std::move(fileAccess), std::move(trackId));
     m_pInstance->m_mutex.unlock();
@@ -283,10 +304,16 @@ void GlobalTrackCache::evictAndSaveCachedTrack(GlobalTrackCacheEntryPointer cach
                 [cacheEntryPtr = std::move(cacheEntryPtr)] {
                     s_pInstance->slotEvictAndSave(cacheEntryPtr);
                 },
-                // Qt will choose either a direct or a queued connection
-                // depending on the thread from which this method has
-                // been invoked!
-                Qt::AutoConnection);
+                // Always queued, even when invoked from the event loop
+                // thread of the cache instance. This defers the save and
+                // deletion work to a later event loop iteration, so that
+                // releasing the last track reference (e.g. while loading
+                // the next track into a deck) never performs database
+                // updates and file tag export inline while holding the
+                // cache lock. If the track is resolved again before the
+                // queued slot runs it is simply revived and the eviction
+                // is skipped.
+                Qt::QueuedConnection);
     } else {
         // After the singular instance has been destroyed we are
         // not able to save pending changes. The track is deleted
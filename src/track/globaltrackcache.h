@@ -114,10 +114,15 @@ public:
             const TrackRef& trackRef) const;
     QSet<TrackId> getCachedTrackIds() const;
 
-  private:
+  protected:
+    // Tag for constructing a locker that does not lock the cache
+    // immediately. Derived classes use this to perform file system
+    // access before acquiring the lock by calling lockCache().
+    struct DeferLock {};
+    explicit GlobalTrackCacheLocker(DeferLock);
+
     void lockCache();
 
-  protected:
     GlobalTrackCache* m_pInstance;
 };
 
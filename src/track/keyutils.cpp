@@ -4,6 +4,7 @@
 #include <QPair>
 #include <QRegularExpression>
 #include <QtDebug>
+#include <array>
 
 #include "preferences/keydetectionsettings.h"
 #include "util/color/colorpalette.h"
@@ -261,23 +262,69 @@ constexpr ScaleModeInfo s_scaleModeInfo[] = {
 // locrian to aeolian
 
 // Lancelot notation is OpenKey notation rotated counter-clockwise by 5.
+// Branch-free: the modulo wraps the 1-based number around the wheel.
 inline int openKeyNumberToLancelotNumber(const int okNumber)  {
-    int lancelotNumber = okNumber - 5;
-    if (lancelotNumber < 1) {
-        lancelotNumber += 12;
-    }
-    return lancelotNumber;
+    return (okNumber + 6) % 12 + 1;
 }
 
 // Lancelot notation is OpenKey notation rotated counter-clockwise by 5.
 inline int lancelotNumberToOpenKeyNumber(const int lancelotNumber)  {
-    int okNumber = lancelotNumber + 5;
-    if (okNumber > 12) {
-        okNumber -= 12;
-    }
-    return okNumber;
+    return (lancelotNumber + 4) % 12 + 1;
 }
 
+// Maps a ChromaticKey directly to its OpenKey number (0 for INVALID),
+// replacing the previous 24-way switch.
+constexpr int s_keyToOpenKeyNumbers[] = {
+        0,  // INVALID
+        1,  // C_MAJOR
+        8,  // D_FLAT_MAJOR
+        3,  // D_MAJOR
+        10, // E_FLAT_MAJOR
+        5,  // E_MAJOR
+        12, // F_MAJOR
+        7,  // F_SHARP_MAJOR
+        2,  // G_MAJOR
+        9,  // A_FLAT_MAJOR
+        4,  // A_MAJOR
+        11, // B_FLAT_MAJOR
+        6,  // B_MAJOR
+        10, // C_MINOR
+        5,  // C_SHARP_MINOR
+        12, // D_MINOR
+        7,  // E_FLAT_MINOR
+        2,  // E_MINOR
+        9,  // F_MINOR
+        4,  // F_SHARP_MINOR
+        11, // G_MINOR
+        6,  // G_SHARP_MINOR
+        1,  // A_MINOR
+        8,  // B_FLAT_MINOR
+        3,  // B_MINOR
+};
+
+// Ratio tables for semitoneChangeToPowerOf2. The semitone table holds
+// pow(2, s / 12) for whole semitones within +-2 octaves, the cent table
+// pow(2, c / 1200) for one fractional semitone at cent resolution. Both are
+// filled once at startup; a lookup plus linear interpolation between
+// neighboring cent entries has a relative error below 1e-7 (well under a
+// thousandth of a cent), while integer semitone changes hit table entries
+// exactly.
+constexpr int kSemitoneTableRange = 24;
+const std::array<double, 2 * kSemitoneTableRange + 1> s_semitoneRatios = [] {
+    std::array<double, 2 * kSemitoneTableRange + 1> table{};
+    for (int i = 0; i < static_cast<int>(table.size()); ++i) {
+        table[i] = pow(2.0, (i - kSemitoneTableRange) / 12.0);
+    }
+    return table;
+}();
+const std::array<double, 101> s_centRatios = [] {
+    std::array<double, 101> table{};
+    for (int i = 0; i < static_cast<int>(table.size()); ++i) {
+        table[i] = pow(2.0, i / 1200.0);
+    }
+    return table;
+}();
+
 } // namespace
 
 QMutex KeyUtils::s_notationMutex;
@@ -313,46 +360,26 @@ void KeyUtils::setNotation(const QMap<ChromaticKey, QString>& notation) {
 
 // static
 int KeyUtils::keyToOpenKeyNumber(mixxx::track::io::key::ChromaticKey key) {
-    switch (key) {
-    case mixxx::track::io::key::C_MAJOR:
-    case mixxx::track::io::key::A_MINOR:
-        return 1;
-    case mixxx::track::io::key::G_MAJOR:
-    case mixxx::track::io::key::E_MINOR:
-        return 2;
-    case mixxx::track::io::key::D_MAJOR:
-    case mixxx::track::io::key::B_MINOR:
-        return 3;
-    case mixxx::track::io::key::A_MAJOR:
-    case mixxx::track::io::key::F_SHARP_MINOR:
-        return 4;
-    case mixxx::track::io::key::E_MAJOR:
-    case mixxx::track::io::key::C_SHARP_MINOR:
-        return 5;
-    case mixxx::track::io::key::B_MAJOR:
-    case mixxx::track::io::key::G_SHARP_MINOR:
-        return 6;
-    case mixxx::track::io::key::F_SHARP_MAJOR:
-    case mixxx::track::io::key::E_FLAT_MINOR:
-        return 7;
-    case mixxx::track::io::key::D_FLAT_MAJOR:
-    case mixxx::track::io::key::B_FLAT_MINOR:
-        return 8;
-    case mixxx::track::io::key::A_FLAT_MAJOR:
-    case mixxx::track::io::key::F_MINOR:
-        return 9;
-    case mixxx::track::io::key::E_FLAT_MAJOR:
-    case mixxx::track::io::key::C_MINOR:
-        return 10;
-    case mixxx::track::io::key::B_FLAT_MAJOR:
-    case mixxx::track::io::key::G_MINOR:
-        return 11;
-    case mixxx::track::io::key::F_MAJOR:
-    case mixxx::track::io::key::D_MINOR:
-        return 12;
-    default:
+    if (!ChromaticKey_IsValid(key)) {
         return 0;
     }
+    return s_keyToOpenKeyNumbers[static_cast<int>(key)];
+}
+
+// static
+double KeyUtils::semitoneChangeToPowerOf2(const double& semitones) {
+    if (semitones < -kSemitoneTableRange || semitones > kSemitoneTableRange) {
+        // Out of table range (more than +-2 octaves), fall back to pow().
+        return octaveChangeToPowerOf2(semitones / 12);
+    }
+    const double wholeSemitones = floor(semitones);
+    const double cents = (semitones - wholeSemitones) * 100;
+    const int centIndex = static_cast<int>(cents);
+    const double centFrac = cents - centIndex;
+    const double centRatio = s_centRatios[centIndex] +
+            centFrac * (s_centRatios[centIndex + 1] - s_centRatios[centIndex]);
+    return s_semitoneRatios[static_cast<int>(wholeSemitones) + kSemitoneTableRange] *
+            centRatio;
 }
 
 // static
@@ -747,10 +774,35 @@ int KeyUtils::shortestStepsToCompatibleKey(
 
 QList<mixxx::track::io::key::ChromaticKey> KeyUtils::getCompatibleKeys(
         mixxx::track::io::key::ChromaticKey key) {
-    QList<mixxx::track::io::key::ChromaticKey> compatible;
     if (!ChromaticKey_IsValid(key) || key == mixxx::track::io::key::INVALID) {
-        return compatible;
+        return {};
     }
+    // The adjacency is tiny and immutable, so it is precomputed for all
+    // keys on first use. Callers like the fuzzy key search build a
+    // filter per query and per playing deck, which then only costs a
+    // lookup and a shared copy of the cached list.
+    static const auto s_compatibleKeys = [] {
+        std::array<QList<mixxx::track::io::key::ChromaticKey>,
+                mixxx::track::io::key::ChromaticKey_MAX + 1>
+                keys;
+        for (int i = mixxx::track::io::key::ChromaticKey_MIN;
+                i <= mixxx::track::io::key::ChromaticKey_MAX;
+                ++i) {
+            const auto chromaticKey = static_cast<ChromaticKey>(i);
+            if (chromaticKey != mixxx::track::io::key::INVALID) {
+                keys[i] = computeCompatibleKeys(chromaticKey);
+            }
+        }
+        return keys;
+    }();
+    return s_compatibleKeys[static_cast<int>(key)];
+}
+
+// static
+QList<mixxx::track::io::key::ChromaticKey> KeyUtils::computeCompatibleKeys(
+        mixxx::track::io::key::ChromaticKey key) {
+    QList<mixxx::track::io::key::ChromaticKey> compatible;
+    DEBUG_ASSERT(ChromaticKey_IsValid(key) && key != mixxx::track::io::key::INVALID);
 
     int openKeyNumber = KeyUtils::keyToOpenKeyNumber(key);
     // We know the key is in the set of valid values. Save whether or not the
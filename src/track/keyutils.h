@@ -117,9 +117,10 @@ class KeyUtils {
         return pow(2.0, octaveChange);
     }
 
-    static inline double semitoneChangeToPowerOf2(const double& semitones) {
-        return octaveChangeToPowerOf2(semitones / 12);
-    }
+    /// Returns pow(2, semitones / 12). Table-driven with cent interpolation
+    /// within +-2 octaves (see keyutils.cpp), so repeated calls on the engine
+    /// rate-update path avoid pow().
+    static double semitoneChangeToPowerOf2(const double& semitones);
 
     static inline double powerOf2ToOctaveChange(const double& power_of_2) {
         return log2(power_of_2);
@@ -142,6 +143,11 @@ class KeyUtils {
             const mixxx::track::io::key::ChromaticKey& key);
 
   private:
+    // Computes the Circle of Fifths adjacency of a single valid key.
+    // Only used to fill the table behind getCompatibleKeys().
+    static QList<mixxx::track::io::key::ChromaticKey> computeCompatibleKeys(
+            mixxx::track::io::key::ChromaticKey key);
+
     static QMutex s_notationMutex;
     static QMap<mixxx::track::io::key::ChromaticKey, QString> s_notation;
     static QMap<QString, mixxx::track::io::key::ChromaticKey> s_reverseNotation;
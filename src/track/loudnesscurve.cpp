@@ -0,0 +1,78 @@
+#include "track/loudnesscurve.h"
+
+#include <QDataStream>
+#include <QIODevice>
+
+#include "util/math.h"
+
+namespace {
+
+// Identifies the serialization format written by toByteArray().
+constexpr quint32 kSerializationMagic = 0x4d4c4331; // "MLC1"
+
+} // anonymous namespace
+
+namespace mixxx {
+
+//static
+const QString LoudnessCurve::kVersion = QStringLiteral("LoudnessCurve-1.0");
+
+LoudnessCurve::LoudnessCurve(
+        double intervalSeconds,
+        double integratedLufs,
+        QVector<float> shortTermLufs)
+        : m_intervalSeconds(intervalSeconds),
+          m_integratedLufs(integratedLufs),
+          m_shortTermLufs(std::move(shortTermLufs)) {
+}
+
+double LoudnessCurve::shortTermLufsAt(double seconds) const {
+    if (m_shortTermLufs.isEmpty() || m_intervalSeconds <= 0) {
+        return m_integratedLufs;
+    }
+    const double position = math_clamp(seconds / m_intervalSeconds,
+            0.0,
+            static_cast<double>(m_shortTermLufs.size() - 1));
+    const int index = static_cast<int>(position);
+    if (index >= m_shortTermLufs.size() - 1) {
+        return m_shortTermLufs.last();
+    }
+    const double frac = position - index;
+    return m_shortTermLufs[index] * (1.0 - frac) +
+            m_shortTermLufs[index + 1] * frac;
+}
+
+QByteArray LoudnessCurve::toByteArray() const {
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_15);
+    stream << kSerializationMagic
+           << m_intervalSeconds
+           << m_integratedLufs
+           << m_shortTermLufs;
+    return data;
+}
+
+//static
+ConstLoudnessCurvePointer LoudnessCurve::fromByteArray(const QByteArray& data) {
+    QDataStream stream(data);
+    stream.setVersion(QDataStream::Qt_5_15);
+    quint32 magic = 0;
+    double intervalSeconds = 0;
+    double integratedLufs = 0;
+    QVector<float> shortTermLufs;
+    stream >> magic;
+    if (magic != kSerializationMagic) {
+        return nullptr;
+    }
+    stream >> intervalSeconds >> integratedLufs >> shortTermLufs;
+    if (stream.status() != QDataStream::Ok ||
+            intervalSeconds <= 0 ||
+            shortTermLufs.isEmpty()) {
+        return nullptr;
+    }
+    return ConstLoudnessCurvePointer(new LoudnessCurve(
+            intervalSeconds, integratedLufs, std::move(shortTermLufs)));
+}
+
+} // namespace mixxx
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <QByteArray>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+
+namespace mixxx {
+
+class LoudnessCurve;
+typedef QSharedPointer<const LoudnessCurve> ConstLoudnessCurvePointer;
+
+// Short-term (EBU R128, 3 s window) loudness of a track, sampled at a fixed
+// interval by AnalyzerEbur128 and persisted in the analysis table. The curve
+// is immutable after construction and shared between the analyzer thread,
+// the Track object and the engine via ConstLoudnessCurvePointer.
+class LoudnessCurve final {
+  public:
+    // Version tag stored in the analysis table alongside the serialized
+    // curve so that outdated or incompatible curves are discarded on load.
+    static const QString kVersion;
+
+    LoudnessCurve(
+            double intervalSeconds,
+            double integratedLufs,
+            QVector<float> shortTermLufs);
+
+    // Spacing of the stored short-term loudness samples in seconds.
+    double intervalSeconds() const {
+        return m_intervalSeconds;
+    }
+    // Integrated (whole-track) loudness in LUFS, the reference the
+    // short-term values are compared against.
+    double integratedLufs() const {
+        return m_integratedLufs;
+    }
+    const QVector<float>& shortTermLufs() const {
+        return m_shortTermLufs;
+    }
+    bool isEmpty() const {
+        return m_shortTermLufs.isEmpty();
+    }
+
+    // Short-term loudness in LUFS at the given track position, linearly
+    // interpolated between the stored samples and clamped at both ends.
+    double shortTermLufsAt(double seconds) const;
+
+    QByteArray toByteArray() const;
+    // Returns a null pointer if the data is truncated or was written by an
+    // incompatible version.
+    static ConstLoudnessCurvePointer fromByteArray(const QByteArray& data);
+
+  private:
+    double m_intervalSeconds;
+    double m_integratedLufs;
+    QVector<float> m_shortTermLufs;
+};
+
+} // namespace mixxx
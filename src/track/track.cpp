@@ -91,6 +91,7 @@ Track::Track(
           m_record(trackId),
           m_bDirty(false),
           m_bMarkedForMetadataExport(false),
+          m_batchingCueUpdates(false),
           m_undoingBeatsChange(false) {
     if (kLogStats && kLogger.debugEnabled()) {
         long numberOfInstancesBefore = s_numberOfInstances.fetch_add(1);
@@ -180,6 +181,8 @@ void Track::replaceMetadataFromSource(
         importedMetadata.refTrackInfo().setKeyText(
                 m_record.getMetadata().getTrackInfo().getKeyText());
 
+        const auto oldMetadata = m_record.getMetadata();
+        const auto oldPlayCounter = m_record.getPlayCounter();
         const auto oldReplayGain =
                 m_record.getMetadata().getTrackInfo().getReplayGain();
         bool modified = m_record.replaceMetadataFromSource(
@@ -246,7 +249,7 @@ void Track::replaceMetadataFromSource(
             emit colorUpdated(*newColor);
         }
 
-        emitChangedSignalsForAllMetadata();
+        emitChangedSignalsForMetadata(oldMetadata, oldPlayCounter);
     }
 
     // TODO: Import Serato metadata within the locking scope and not
@@ -264,13 +267,15 @@ void Track::replaceMetadataFromSource(
 bool Track::mergeExtraMetadataFromSource(
         const mixxx::TrackMetadata& importedMetadata) {
     auto locked = lockMutex(&m_qMutex);
+    const auto oldMetadata = m_record.getMetadata();
+    const auto oldPlayCounter = m_record.getPlayCounter();
     if (!m_record.mergeExtraMetadataFromSource(importedMetadata)) {
         // Not modified
         return false;
     }
     markDirtyAndUnlock(&locked);
     // Modified
-    emitChangedSignalsForAllMetadata();
+    emitChangedSignalsForMetadata(oldMetadata, oldPlayCounter);
     return true;
 }
 
@@ -306,6 +311,8 @@ bool Track::replaceRecord(
         return false;
     }
 
+    const auto oldMetadata = m_record.getMetadata();
+    const auto oldPlayCounter = m_record.getPlayCounter();
     const auto oldReplayGain = m_record.getMetadata().getTrackInfo().getReplayGain();
     const auto oldColor = m_record.getColor();
     const auto oldRating = m_record.getRating();
@@ -345,7 +352,7 @@ bool Track::replaceRecord(
         emit ratingUpdated(newRating);
     }
 
-    emitChangedSignalsForAllMetadata();
+    emitChangedSignalsForMetadata(oldMetadata, oldPlayCounter);
     return true;
 }
 
@@ -521,23 +528,79 @@ void Track::emitBeatsAndBpmUpdated() {
     emit beatsUpdated();
 }
 
-void Track::emitChangedSignalsForAllMetadata() {
-    emit artistChanged(getArtist());
-    emit titleChanged(getTitle());
-    emit albumChanged(getAlbum());
-    emit albumArtistChanged(getAlbumArtist());
-    emit genreChanged(getGenre());
-    emit composerChanged(getComposer());
-    emit groupingChanged(getGrouping());
-    emit yearChanged(getYear());
-    emit trackNumberChanged(getTrackNumber());
-    emit trackTotalChanged(getTrackTotal());
-    emit commentChanged(getComment());
-    emit bpmChanged();
-    emit timesPlayedChanged();
-    emit durationChanged();
-    emit infoChanged();
-    emit keyChanged();
+void Track::emitChangedSignalsForMetadata(
+        const mixxx::TrackMetadata& oldMetadata,
+        const PlayCounter& oldPlayCounter) {
+    // Take a single snapshot of the new state instead of re-locking the
+    // mutex in every getter while emitting. Signals are only emitted for
+    // fields that actually changed. This avoids fanning out notification
+    // storms to the connected table models and widgets when metadata is
+    // re-imported for many tracks during a library scan but most fields
+    // are unmodified.
+    mixxx::TrackMetadata newMetadata;
+    PlayCounter newPlayCounter;
+    {
+        const auto locked = lockMutex(&m_qMutex);
+        newMetadata = m_record.getMetadata();
+        newPlayCounter = m_record.getPlayCounter();
+    }
+    const mixxx::TrackInfo& oldInfo = oldMetadata.getTrackInfo();
+    const mixxx::TrackInfo& newInfo = newMetadata.getTrackInfo();
+    const mixxx::AlbumInfo& oldAlbum = oldMetadata.getAlbumInfo();
+    const mixxx::AlbumInfo& newAlbum = newMetadata.getAlbumInfo();
+
+    bool titleOrArtistChanged = false;
+    if (oldInfo.getArtist() != newInfo.getArtist()) {
+        emit artistChanged(newInfo.getArtist());
+        titleOrArtistChanged = true;
+    }
+    if (oldInfo.getTitle() != newInfo.getTitle()) {
+        emit titleChanged(newInfo.getTitle());
+        titleOrArtistChanged = true;
+    }
+    if (oldAlbum.getTitle() != newAlbum.getTitle()) {
+        emit albumChanged(newAlbum.getTitle());
+    }
+    if (oldAlbum.getArtist() != newAlbum.getArtist()) {
+        emit albumArtistChanged(newAlbum.getArtist());
+    }
+    if (oldInfo.getGenre() != newInfo.getGenre()) {
+        emit genreChanged(newInfo.getGenre());
+    }
+    if (oldInfo.getComposer() != newInfo.getComposer()) {
+        emit composerChanged(newInfo.getComposer());
+    }
+    if (oldInfo.getGrouping() != newInfo.getGrouping()) {
+        emit groupingChanged(newInfo.getGrouping());
+    }
+    if (oldInfo.getYear() != newInfo.getYear()) {
+        emit yearChanged(newInfo.getYear());
+    }
+    if (oldInfo.getTrackNumber() != newInfo.getTrackNumber()) {
+        emit trackNumberChanged(newInfo.getTrackNumber());
+    }
+    if (oldInfo.getTrackTotal() != newInfo.getTrackTotal()) {
+        emit trackTotalChanged(newInfo.getTrackTotal());
+    }
+    if (oldInfo.getComment() != newInfo.getComment()) {
+        emit commentChanged(newInfo.getComment());
+    }
+    if (oldInfo.getBpm() != newInfo.getBpm()) {
+        emit bpmChanged();
+    }
+    if (oldPlayCounter != newPlayCounter) {
+        emit timesPlayedChanged();
+    }
+    if (oldMetadata.getStreamInfo().getDuration() !=
+            newMetadata.getStreamInfo().getDuration()) {
+        emit durationChanged();
+    }
+    if (titleOrArtistChanged) {
+        emit infoChanged();
+    }
+    if (oldInfo.getKeyText() != newInfo.getKeyText()) {
+        emit keyChanged();
+    }
 }
 
 bool Track::checkSourceSynchronized() const {
@@ -936,6 +999,15 @@ void Track::setWaveformSummary(ConstWaveformPointer pWaveform) {
     emit waveformSummaryUpdated();
 }
 
+mixxx::ConstLoudnessCurvePointer Track::getLoudnessCurve() const {
+    return m_loudnessCurve;
+}
+
+void Track::setLoudnessCurve(mixxx::ConstLoudnessCurvePointer pLoudnessCurve) {
+    m_loudnessCurve = pLoudnessCurve;
+    emit loudnessCurveUpdated();
+}
+
 void Track::setMainCuePosition(mixxx::audio::FramePos position) {
     auto locked = lockMutex(&m_qMutex);
 
@@ -982,11 +1054,14 @@ void Track::shiftCuePositionsMillis(double milliseconds) {
         return;
     }
     double frames = m_record.getStreamInfoFromSource()->getSignalInfo().millis2frames(milliseconds);
+    m_batchingCueUpdates = true;
     for (const CuePointer& pCue : std::as_const(m_cuePoints)) {
         pCue->shiftPositionFrames(frames);
     }
+    m_batchingCueUpdates = false;
 
     markDirtyAndUnlock(&locked);
+    emit cuesUpdated();
 }
 
 void Track::setHotcueIndicesSortedByPosition(HotcueSortMode sortMode) {
@@ -1041,6 +1116,7 @@ void Track::setHotcueIndicesSortedByPosition(HotcueSortMode sortMode) {
     }
 
     // Finally set new indices on hotcues
+    m_batchingCueUpdates = true;
     for (CuePointer& pCue : m_cuePoints) {
         if (pCue->getHotCue() == Cue::kNoHotCue ||
                 (pCue->getType() != mixxx::CueType::HotCue &&
@@ -1051,6 +1127,7 @@ void Track::setHotcueIndicesSortedByPosition(HotcueSortMode sortMode) {
         int newIndex = posIndexHash.take(pCue->getPosition());
         pCue->setHotCue(newIndex);
     }
+    m_batchingCueUpdates = false;
 
     markDirtyAndUnlock(&locked);
     emit cuesUpdated();
@@ -1066,6 +1143,14 @@ mixxx::audio::FramePos Track::getMainCuePosition() const {
 }
 
 void Track::slotCueUpdated() {
+    {
+        const auto locked = lockMutex(&m_qMutex);
+        if (m_batchingCueUpdates) {
+            // A batch operation is mutating multiple cues and will mark
+            // the track dirty and notify the listeners once when done.
+            return;
+        }
+    }
     markDirty();
     emit cuesUpdated();
 }
@@ -1200,12 +1285,15 @@ void Track::swapHotcues(int a, int b) {
     if (!pCueA && !pCueB) {
         return;
     }
+    m_batchingCueUpdates = true;
     if (pCueA) {
         pCueA->setHotCue(b);
     }
     if (pCueB) {
         pCueB->setHotCue(a);
     }
+    m_batchingCueUpdates = false;
+    markDirtyAndUnlock(&locked);
     emit cuesUpdated();
 }
 
@@ -1660,9 +1748,11 @@ bool Track::exportSeratoMetadata() {
     return true;
 }
 
-ExportTrackMetadataResult Track::exportMetadata(
+ExportTrackMetadataResult Track::prepareMetadataExport(
         const mixxx::MetadataSource& metadataSource,
-        const SyncTrackMetadataParams& syncParams) {
+        const SyncTrackMetadataParams& syncParams,
+        mixxx::TrackMetadata* pNormalizedMetadata) {
+    DEBUG_ASSERT(pNormalizedMetadata);
     // Locking shouldn't be necessary here, because this function will
     // be called after all references to the object have been dropped.
     // But it doesn't hurt much, so let's play it safe ;)
@@ -1738,7 +1828,7 @@ ExportTrackMetadataResult Track::exportMetadata(
     // The normalization has to be performed on a copy of the metadata.
     // Otherwise floating-point values like the bpm value might become
     // inconsistent with the actual value stored by the beat grid!
-    mixxx::TrackMetadata normalizedFromRecord;
+    mixxx::TrackMetadata& normalizedFromRecord = *pNormalizedMetadata;
     // Both resetMissingTagMetadata = false/true have the same effect
     constexpr auto resetMissingTagMetadata = false;
     if ((metadataSource.importTrackMetadataAndCoverImage(&importedFromFile,
@@ -1814,6 +1904,21 @@ ExportTrackMetadataResult Track::exportMetadata(
     kLogger.debug()
             << "New metadata (modified)"
             << normalizedFromRecord;
+    return ExportTrackMetadataResult::Succeeded;
+}
+
+ExportTrackMetadataResult Track::exportMetadata(
+        const mixxx::MetadataSource& metadataSource,
+        const SyncTrackMetadataParams& syncParams) {
+    mixxx::TrackMetadata normalizedFromRecord;
+    const auto prepareResult = prepareMetadataExport(
+            metadataSource,
+            syncParams,
+            &normalizedFromRecord);
+    if (prepareResult != ExportTrackMetadataResult::Succeeded) {
+        return prepareResult;
+    }
+    auto locked = lockMutex(&m_qMutex);
     const auto trackMetadataExported =
             metadataSource.exportTrackMetadata(normalizedFromRecord);
     switch (trackMetadataExported.first) {
@@ -11,6 +11,7 @@
 #include "track/beats.h"
 #include "track/cue.h"
 #include "track/cueinfoimporter.h"
+#include "track/loudnesscurve.h"
 #ifdef __STEM__
 #include "track/steminfo.h"
 #include "track/steminfoimporter.h"
@@ -290,6 +291,9 @@ class Track : public QObject {
     ConstWaveformPointer getWaveformSummary() const;
     void setWaveformSummary(ConstWaveformPointer pWaveform);
 
+    mixxx::ConstLoudnessCurvePointer getLoudnessCurve() const;
+    void setLoudnessCurve(mixxx::ConstLoudnessCurvePointer pLoudnessCurve);
+
     /// Get the track's main cue point
     mixxx::audio::FramePos getMainCuePosition() const;
     // Set the track's main cue point
@@ -475,6 +479,7 @@ class Track : public QObject {
 
     void waveformUpdated();
     void waveformSummaryUpdated();
+    void loudnessCurveUpdated();
     void coverArtUpdated();
     void beatsUpdated();
     void replayGainUpdated(mixxx::ReplayGain replayGain);
@@ -521,7 +526,9 @@ class Track : public QObject {
     void emitBeatsAndBpmUpdated();
 
     /// Emits a changed signal for each Q_PROPERTY
-    void emitChangedSignalsForAllMetadata();
+    void emitChangedSignalsForMetadata(
+            const mixxx::TrackMetadata& oldMetadata,
+            const PlayCounter& oldPlayCounter);
 
     /// Sets beats and returns a boolean to indicate if BPM/Beats were updated.
     /// Only supposed to be called while the caller guards this a lock.
@@ -581,6 +588,20 @@ class Track : public QObject {
 
     bool exportSeratoMetadata();
 
+    /// First phase of exportMetadata(): Decides whether the file tags
+    /// need to be (re-)written and prepares the normalized metadata
+    /// for export without touching the file.
+    ///
+    /// Returns Succeeded if *pNormalizedMetadata has been populated
+    /// and the file tags need to be written, Skipped if the file tags
+    /// are already in sync, and Failed otherwise. The actual file
+    /// write may then be performed independently of this object, e.g.
+    /// on a worker thread after the object has been destroyed.
+    ExportTrackMetadataResult prepareMetadataExport(
+            const mixxx::MetadataSource& metadataSource,
+            const SyncTrackMetadataParams& syncParams,
+            mixxx::TrackMetadata* pNormalizedMetadata);
+
     ExportTrackMetadataResult exportMetadata(
             const mixxx::MetadataSource& metadataSource,
             const SyncTrackMetadataParams& syncParams);
@@ -605,6 +626,11 @@ class Track : public QObject {
 
     // The list of cue points for the track
     QList<CuePointer> m_cuePoints;
+    // Set while a batch operation mutates multiple cues, so that
+    // slotCueUpdated() does not mark the track dirty and notify
+    // listeners once per cue. The batch operation emits a single
+    // cuesUpdated() when done.
+    bool m_batchingCueUpdates;
 
 #ifdef __STEM__
     // The list of stem info
@@ -621,6 +647,9 @@ class Track : public QObject {
     ConstWaveformPointer m_waveform;
     ConstWaveformPointer m_waveformSummary;
 
+    // Short-term loudness curve computed by AnalyzerEbur128
+    mixxx::ConstLoudnessCurvePointer m_loudnessCurve;
+
     mixxx::BeatsImporterPointer m_pBeatsImporterPending;
     std::unique_ptr<mixxx::CueInfoImporter> m_pCueInfoImporterPending;
 
@@ -1,5 +1,7 @@
 #include "track/trackinfo.h"
 
+#include "util/stringinterner.h"
+
 
 namespace mixxx {
 
@@ -42,6 +44,17 @@ bool TrackInfo::parseArtistTitleFromFileName(
     return modified;
 }
 
+void TrackInfo::internStrings() {
+    m_artist = StringInterner::intern(m_artist);
+    m_composer = StringInterner::intern(m_composer);
+    m_genre = StringInterner::intern(m_genre);
+    m_grouping = StringInterner::intern(m_grouping);
+    m_keyText = StringInterner::intern(m_keyText);
+    m_trackNumber = StringInterner::intern(m_trackNumber);
+    m_trackTotal = StringInterner::intern(m_trackTotal);
+    m_year = StringInterner::intern(m_year);
+}
+
 bool TrackInfo::compareEq(
         const TrackInfo& trackInfo,
         Bpm::Comparison cmpBpm) const {
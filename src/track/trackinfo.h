@@ -80,6 +80,12 @@ class TrackInfo final {
         m_replayGain.normalizeBeforeExport();
     }
 
+    // Deduplicates the string properties that typically only have few
+    // distinct values across a library by routing them through the
+    // shared StringInterner pool. Properties that are mostly unique
+    // per track like the title or comment are left untouched.
+    void internStrings();
+
     bool compareEq(
             const TrackInfo& trackInfo,
             Bpm::Comparison cmpBpm = Bpm::Comparison::Default) const;
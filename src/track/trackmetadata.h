@@ -37,6 +37,13 @@ class TrackMetadata final {
     // in file tags to account for rounding errors.
     void normalizeBeforeExport();
 
+    // Deduplicates low-cardinality string properties through the
+    // shared StringInterner pool.
+    void internStrings() {
+        refAlbumInfo().internStrings();
+        refTrackInfo().internStrings();
+    }
+
     // Returns true if the current metadata differs from the imported metadata
     // and needs to be exported. A result of false indicates that no export
     // is needed.
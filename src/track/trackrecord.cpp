@@ -206,6 +206,9 @@ bool TrackRecord::replaceMetadataFromSource(
     }
     bool modified = false;
     if (getMetadata() != importedMetadata) {
+        // Share the character data of low-cardinality string properties
+        // like artist, album, or genre among all resident tracks.
+        importedMetadata.internStrings();
         setMetadata(std::move(importedMetadata));
         modified = true;
     }
@@ -59,6 +59,7 @@ CmdlineArgs::CmdlineArgs()
           m_qml(false),
 #endif
           m_safeMode(false),
+          m_headless(false),
           m_useLegacyVuMeter(false),
           m_useLegacySpinny(false),
           m_debugAssertBreak(false),
@@ -193,6 +194,15 @@ bool CmdlineArgs::parse(const QStringList& arguments, CmdlineArgs::ParseMode mod
                             : QString());
     parser.addOption(startAutoDJ);
 
+    const QCommandLineOption headless(QStringLiteral("headless"),
+            forUserFeedback ? QCoreApplication::translate("CmdlineArgs",
+                                      "Runs Mixxx without the main window. The engine, "
+                                      "library, Auto DJ, effects, Live Broadcasting and "
+                                      "controllers stay fully functional; combine with "
+                                      "--start-autodj for unattended operation.")
+                            : QString());
+    parser.addOption(headless);
+
     const QCommandLineOption rescanLibrary(QStringLiteral("rescan-library"),
             forUserFeedback ? QCoreApplication::translate("CmdlineArgs",
                                       "Rescans the library when Mixxx is launched.")
@@ -230,7 +240,9 @@ bool CmdlineArgs::parse(const QStringList& arguments, CmdlineArgs::ParseMode mod
 
     const QCommandLineOption timelinePath(QStringLiteral("timeline-path"),
             forUserFeedback ? QCoreApplication::translate("CmdlineArgs",
-                                      "Path the debug statistics time line is written to")
+                                      "Path the debug statistics time line is "
+                                      "written to. A .json suffix selects the "
+                                      "chrome://tracing compatible format.")
                             : QString(),
             QStringLiteral("path"));
     QCommandLineOption timelinePathDeprecated(
@@ -442,6 +454,10 @@ bool CmdlineArgs::parse(const QStringList& arguments, CmdlineArgs::ParseMode mod
         m_startAutoDJ = true;
     }
 
+    if (parser.isSet(headless)) {
+        m_headless = true;
+    }
+
     if (parser.isSet(rescanLibrary)) {
         m_rescanLibrary = true;
     }
@@ -0,0 +1,108 @@
+#include "util/coalescingtimer.h"
+
+#include <algorithm>
+
+#include "moc_coalescingtimer.cpp"
+#include "util/assert.h"
+#include "util/thread_affinity.h"
+
+namespace mixxx {
+
+CoalescingTimerService* CoalescingTimerService::s_pInstance = nullptr;
+
+// static
+CoalescingTimerService* CoalescingTimerService::createInstance() {
+    VERIFY_OR_DEBUG_ASSERT(!s_pInstance) {
+        return s_pInstance;
+    }
+    s_pInstance = new CoalescingTimerService();
+    return s_pInstance;
+}
+
+// static
+void CoalescingTimerService::destroyInstance() {
+    delete s_pInstance;
+    s_pInstance = nullptr;
+}
+
+CoalescingTimerService::CoalescingTimerService()
+        : m_lastClientId(kInvalidClientId) {
+    m_timer.setSingleShot(true);
+    m_timer.setTimerType(Qt::CoarseTimer);
+    connect(&m_timer, &QTimer::timeout, this, &CoalescingTimerService::slotTimeout);
+    m_clock.start();
+}
+
+CoalescingTimerService::ClientId CoalescingTimerService::registerClient(
+        QObject* pContext,
+        int intervalMs,
+        int slackMs,
+        std::function<void()> callback) {
+    DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
+    VERIFY_OR_DEBUG_ASSERT(intervalMs > 0 && callback) {
+        return kInvalidClientId;
+    }
+    if (slackMs < 0) {
+        slackMs = 0;
+    }
+    const ClientId clientId = ++m_lastClientId;
+    m_clients.push_back(Client{
+            clientId,
+            intervalMs,
+            slackMs,
+            m_clock.elapsed() + intervalMs,
+            std::move(callback)});
+    if (pContext != nullptr) {
+        connect(pContext, &QObject::destroyed, this, [this, clientId]() {
+            unregisterClient(clientId);
+        });
+    }
+    reschedule();
+    return clientId;
+}
+
+void CoalescingTimerService::unregisterClient(ClientId clientId) {
+    DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
+    const auto it = std::find_if(m_clients.begin(),
+            m_clients.end(),
+            [clientId](const Client& client) {
+                return client.id == clientId;
+            });
+    if (it == m_clients.end()) {
+        return;
+    }
+    m_clients.erase(it);
+    reschedule();
+}
+
+void CoalescingTimerService::slotTimeout() {
+    DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
+    const qint64 nowMs = m_clock.elapsed();
+    // A client whose deadline falls within its slack of this wakeup runs
+    // now instead of triggering a separate wakeup of its own. Callbacks
+    // may unregister clients, so iterate by index.
+    for (std::size_t i = 0; i < m_clients.size(); ++i) {
+        if (m_clients[i].nextDueMs > nowMs + m_clients[i].slackMs) {
+            continue;
+        }
+        m_clients[i].nextDueMs = nowMs + m_clients[i].intervalMs;
+        m_clients[i].callback();
+    }
+    reschedule();
+}
+
+void CoalescingTimerService::reschedule() {
+    if (m_clients.empty()) {
+        m_timer.stop();
+        return;
+    }
+    const auto it = std::min_element(m_clients.begin(),
+            m_clients.end(),
+            [](const Client& lhs, const Client& rhs) {
+                return lhs.nextDueMs < rhs.nextDueMs;
+            });
+    const qint64 delayMs = it->nextDueMs - m_clock.elapsed();
+    m_timer.start(static_cast<int>(std::max<qint64>(delayMs, 0)));
+}
+
+} // namespace mixxx
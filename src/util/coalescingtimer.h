@@ -0,0 +1,75 @@
+#pragma once
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTimer>
+#include <functional>
+#include <vector>
+
+namespace mixxx {
+
+/// Shared timer for periodic GUI-thread work.
+///
+/// Every periodic QTimer wakes the process on its own schedule, so a handful
+/// of independent 250 ms to 1 s timers keeps an otherwise idle Mixxx waking
+/// up constantly, which hurts battery life on laptop gigs. This service runs
+/// a single timer and coalesces wakeups: each client declares its interval
+/// and how much slack it tolerates, and whenever the service wakes up for one
+/// client it also runs every other client that is due within its slack. The
+/// underlying timer uses Qt::CoarseTimer so the kernel may additionally align
+/// the wakeup with unrelated timers.
+///
+/// All registration and callbacks happen on the thread the service lives on
+/// (the GUI thread). Callbacks are invoked directly from the timer slot and
+/// must be cheap.
+class CoalescingTimerService : public QObject {
+    Q_OBJECT
+  public:
+    using ClientId = quint64;
+    static constexpr ClientId kInvalidClientId = 0;
+
+    static CoalescingTimerService* createInstance();
+    static void destroyInstance();
+    /// Returns nullptr when the service has not been created. Unlike
+    /// Singleton<T>::instance() this does not assert, because component
+    /// tests construct timer clients without the surrounding application;
+    /// callers fall back to a private QTimer in that case.
+    static CoalescingTimerService* instance() {
+        return s_pInstance;
+    }
+
+    /// Registers a periodic callback. slackMs is how early the callback may
+    /// fire so it can share a wakeup with another client; pass a quarter of
+    /// the interval for typical display work. The registration is dropped
+    /// automatically when pContext is destroyed.
+    ClientId registerClient(
+            QObject* pContext,
+            int intervalMs,
+            int slackMs,
+            std::function<void()> callback);
+    void unregisterClient(ClientId clientId);
+
+  private:
+    CoalescingTimerService();
+    ~CoalescingTimerService() override = default;
+
+    void slotTimeout();
+    void reschedule();
+
+    struct Client {
+        ClientId id;
+        int intervalMs;
+        int slackMs;
+        qint64 nextDueMs;
+        std::function<void()> callback;
+    };
+
+    QTimer m_timer;
+    QElapsedTimer m_clock;
+    ClientId m_lastClientId;
+    std::vector<Client> m_clients;
+
+    static CoalescingTimerService* s_pInstance;
+};
+
+} // namespace mixxx
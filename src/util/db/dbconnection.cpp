@@ -1,5 +1,6 @@
 #include <QSqlDriver>
 #include <QSqlError>
+#include <QSqlQuery>
 
 #ifdef __SQLITE3__
 #include <sqlite3.h>
@@ -232,7 +233,10 @@ void sqliteLikeUtf8(sqlite3_context* context,
 
 #endif // __SQLITE3__
 
-bool initDatabase(const QSqlDatabase& database, mixxx::StringCollator* pCollator) {
+bool initDatabase(
+        const QSqlDatabase& database,
+        mixxx::StringCollator* pCollator,
+        const DbConnection::Params& params) {
     DEBUG_ASSERT(database.isOpen());
 #ifdef __SQLITE3__
     QVariant v = database.driver()->handle();
@@ -304,9 +308,82 @@ bool initDatabase(const QSqlDatabase& database, mixxx::StringCollator* pCollator
                 << "Failed to install custom 3-arg LIKE function for SQLite3:"
                 << result;
     }
+
+    // Apply the SQLite tuning parameters. The journal mode is stored in the
+    // database file and carries over to subsequent connections, but mmap_size
+    // and cache_size only affect the connection at hand and therefore must be
+    // applied on every open().
+    if (!params.sqliteJournalMode.isEmpty()) {
+        const QByteArray journalModePragma =
+                QStringLiteral("PRAGMA journal_mode=%1;")
+                        .arg(params.sqliteJournalMode)
+                        .toUtf8();
+        result = sqlite3_exec(handle,
+                journalModePragma.constData(),
+                nullptr,
+                nullptr,
+                nullptr);
+        VERIFY_OR_DEBUG_ASSERT(result == SQLITE_OK) {
+            kLogger.warning()
+                    << "Failed to set journal mode"
+                    << params.sqliteJournalMode
+                    << "for SQLite3:"
+                    << result;
+        }
+        if (params.sqliteJournalMode.compare(
+                    QStringLiteral("WAL"), Qt::CaseInsensitive) == 0) {
+            // In WAL mode synchronous=NORMAL is durable except for power
+            // loss and avoids an fsync() after every transaction that
+            // synchronous=FULL (the default) would issue.
+            result = sqlite3_exec(handle,
+                    "PRAGMA synchronous=NORMAL;",
+                    nullptr,
+                    nullptr,
+                    nullptr);
+            VERIFY_OR_DEBUG_ASSERT(result == SQLITE_OK) {
+                kLogger.warning()
+                        << "Failed to set synchronous=NORMAL for SQLite3:"
+                        << result;
+            }
+        }
+    }
+    if (params.sqliteMmapSizeKb > 0) {
+        const QByteArray mmapSizePragma =
+                QStringLiteral("PRAGMA mmap_size=%1;")
+                        .arg(static_cast<qint64>(params.sqliteMmapSizeKb) * 1024)
+                        .toUtf8();
+        result = sqlite3_exec(handle,
+                mmapSizePragma.constData(),
+                nullptr,
+                nullptr,
+                nullptr);
+        VERIFY_OR_DEBUG_ASSERT(result == SQLITE_OK) {
+            kLogger.warning()
+                    << "Failed to set mmap_size for SQLite3:"
+                    << result;
+        }
+    }
+    if (params.sqliteCacheSizeKb > 0) {
+        // A negative value is interpreted as KiB instead of pages
+        const QByteArray cacheSizePragma =
+                QStringLiteral("PRAGMA cache_size=-%1;")
+                        .arg(params.sqliteCacheSizeKb)
+                        .toUtf8();
+        result = sqlite3_exec(handle,
+                cacheSizePragma.constData(),
+                nullptr,
+                nullptr,
+                nullptr);
+        VERIFY_OR_DEBUG_ASSERT(result == SQLITE_OK) {
+            kLogger.warning()
+                    << "Failed to set cache_size for SQLite3:"
+                    << result;
+        }
+    }
 #else
     Q_UNUSED(database);
     Q_UNUSED(pCollator);
+    Q_UNUSED(params);
 #endif // __SQLITE3__
     return true;
 }
@@ -316,13 +393,15 @@ bool initDatabase(const QSqlDatabase& database, mixxx::StringCollator* pCollator
 DbConnection::DbConnection(
         const Params& params,
         const QString& connectionName)
-    : m_sqlDatabase(createDatabase(params, connectionName)) {
+    : m_sqlDatabase(createDatabase(params, connectionName)),
+      m_params(params) {
 }
 
 DbConnection::DbConnection(
         const DbConnection& prototype,
         const QString& connectionName)
-    : m_sqlDatabase(cloneDatabase(prototype.m_sqlDatabase, connectionName)) {
+    : m_sqlDatabase(cloneDatabase(prototype.m_sqlDatabase, connectionName)),
+      m_params(prototype.m_params) {
 }
 
 DbConnection::~DbConnection() {
@@ -343,7 +422,7 @@ bool DbConnection::open() {
                 << m_sqlDatabase.lastError();
         return false; // abort
     }
-    if (!initDatabase(m_sqlDatabase, &m_collator)) {
+    if (!initDatabase(m_sqlDatabase, &m_collator, m_params)) {
         kLogger.warning()
                 << "Failed to initialize database connection"
                 << *this;
@@ -368,6 +447,20 @@ void DbConnection::close() {
                     << "Closing database connection:"
                     << *this;
         }
+        // Refresh the query planner statistics of tables whose stored
+        // statistics have become stale relative to the queries this
+        // connection actually ran. This is the recommended companion to
+        // the full ANALYZE after library scans and is usually a no-op.
+        // https://www.sqlite.org/pragma.html#pragma_optimize
+        if (m_sqlDatabase.driverName() == QStringLiteral("QSQLITE")) {
+            QSqlQuery query(m_sqlDatabase);
+            if (!query.exec(QStringLiteral("PRAGMA optimize"))) {
+                kLogger.warning()
+                        << "Failed to run PRAGMA optimize before closing"
+                        << "database connection:"
+                        << query.lastError();
+            }
+        }
         m_sqlDatabase.close();
     }
 }
@@ -29,6 +29,11 @@ class DbConnection final {
         QString filePath;
         QString userName;
         QString password;
+        // SQLite tuning that is applied to every connection opened with
+        // these parameters. Ignored by other database drivers.
+        QString sqliteJournalMode; // e.g. "WAL", empty = keep current mode
+        int sqliteMmapSizeKb = 0; // 0 = memory-mapped I/O disabled
+        int sqliteCacheSizeKb = 0; // 0 = SQLite default page cache
     };
 
     // All constructors are reserved for DbConnectionPool!!
@@ -62,6 +67,7 @@ class DbConnection final {
     DbConnection(const DbConnection&&) = delete;
 
     QSqlDatabase m_sqlDatabase;
+    Params m_params;
     mixxx::StringCollator m_collator;
 };
 
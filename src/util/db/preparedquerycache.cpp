@@ -0,0 +1,27 @@
+#include "util/db/preparedquerycache.h"
+
+namespace mixxx {
+
+QSqlQuery& PreparedQueryCache::prepared(
+        const QSqlDatabase& database,
+        const QString& statementText) {
+    if (m_connectionName != database.connectionName()) {
+        // The connection has changed, all cached statements
+        // are stale and must not be reused.
+        m_queries.clear();
+        m_connectionName = database.connectionName();
+    }
+    const auto [it, inserted] = m_queries.try_emplace(
+            statementText, database);
+    QSqlQuery& query = it->second;
+    if (inserted) {
+        query.prepare(statementText);
+    } else {
+        // Reset the statement for the next execution while
+        // keeping it prepared.
+        query.finish();
+    }
+    return query;
+}
+
+} // namespace mixxx
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QString>
+#include <map>
+
+namespace mixxx {
+
+/// Caches prepared QSqlQuery objects keyed by their statement text.
+///
+/// SQLite compiles every prepared statement into a query plan. Hot DAO
+/// paths that are invoked once per track during a library scan or deck
+/// load would otherwise re-prepare the very same statement thousands of
+/// times. Reusing the prepared statement only resets it between
+/// executions and avoids the repeated compilation.
+///
+/// The cache is bound to a single database connection and must only be
+/// used from the thread that owns this connection, just like the DAOs
+/// that embed it. If the cache is reused with a different connection,
+/// e.g. after re-initializing a DAO, all cached statements are discarded.
+///
+/// The returned query is shared between all callers that use the same
+/// statement text. Callers must not keep a reference across invocations
+/// of other functions that might execute the same statement.
+class PreparedQueryCache final {
+  public:
+    PreparedQueryCache() = default;
+
+    /// Returns a prepared query for the given statement text, reusing
+    /// a previously prepared statement if available. The returned query
+    /// is finished, i.e. ready for binding values and executing.
+    ///
+    /// Preparation failures are not handled here. They will resurface
+    /// when executing the returned query and should be logged by the
+    /// caller like for any plain QSqlQuery.
+    QSqlQuery& prepared(
+            const QSqlDatabase& database,
+            const QString& statementText);
+
+  private:
+    PreparedQueryCache(const PreparedQueryCache&) = delete;
+    PreparedQueryCache& operator=(const PreparedQueryCache&) = delete;
+
+    QString m_connectionName;
+    // std::map, because QSqlQuery is move-only and Qt containers
+    // require copyable values.
+    std::map<QString, QSqlQuery> m_queries;
+};
+
+} // namespace mixxx
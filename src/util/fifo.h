@@ -1,37 +1,90 @@
 #pragma once
 
-#include "pa_ringbuffer.h"
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <span>
+#include <vector>
 
 #include "util/class.h"
 #include "util/math.h"
 
+// Index type kept from the PortAudio ring buffer that this class wrapped
+// before, so that the many existing callers of the region API do not need
+// to change.
+typedef long ring_buffer_size_t;
+
+/// Lock-free single-producer/single-consumer FIFO.
+///
+/// This used to wrap PortAudio's pa_ringbuffer. It is now implemented
+/// directly so that the read and write cursors live on separate cache
+/// lines; in the PortAudio struct both indices shared one line, which
+/// made every put/get ping the line between the producer and consumer
+/// cores. Each side additionally keeps a cached copy of the opposite
+/// cursor on its own line and only re-reads the shared cursor when the
+/// cached value does not satisfy the request.
+///
+/// The cursors are monotonically increasing and wrapped with a mask on
+/// access. read()/write() transfer a whole batch of elements and publish
+/// the cursor once per call; the aquire/release region API allows
+/// in-place producing/consuming with a single publication per batch.
 template <class DataType>
 class FIFO {
+    static_assert(std::is_trivially_copyable_v<DataType>,
+            "FIFO elements are transferred with memcpy");
+
   public:
     explicit FIFO(int size)
-            : m_data(roundUpToPowerOf2(size)) {
-        // If we can't represent the next higher power of 2 then bail.
-        if (m_data.size() == 0) {
-            return;
-        }
-        PaUtil_InitializeRingBuffer(&m_ringBuffer,
-                static_cast<ring_buffer_size_t>(sizeof(DataType)),
-                static_cast<ring_buffer_size_t>(m_data.size()),
-                m_data.data());
+            : m_data(roundUpToPowerOf2(size)),
+              m_capacity(static_cast<ring_buffer_size_t>(m_data.size())),
+              m_writeIndex(0),
+              m_cachedReadIndex(0),
+              m_readIndex(0),
+              m_cachedWriteIndex(0) {
+        // If we can't represent the next higher power of 2 then the FIFO
+        // stays empty and rejects all reads and writes.
     }
     virtual ~FIFO() {
     }
     int readAvailable() const {
-        return PaUtil_GetRingBufferReadAvailable(&m_ringBuffer);
+        return static_cast<int>(
+                m_writeIndex.load(std::memory_order_acquire) -
+                m_readIndex.load(std::memory_order_acquire));
     }
     int writeAvailable() const {
-        return PaUtil_GetRingBufferWriteAvailable(&m_ringBuffer);
+        return static_cast<int>(m_capacity) - readAvailable();
     }
     int read(DataType* pData, int count) {
-        return PaUtil_ReadRingBuffer(&m_ringBuffer, pData, count);
+        DataType* dataPtr1;
+        DataType* dataPtr2;
+        ring_buffer_size_t size1;
+        ring_buffer_size_t size2;
+        const int readCount = aquireReadRegions(count,
+                &dataPtr1, &size1, &dataPtr2, &size2);
+        if (size1 > 0) {
+            std::memcpy(pData, dataPtr1, size1 * sizeof(DataType));
+        }
+        if (size2 > 0) {
+            std::memcpy(pData + size1, dataPtr2, size2 * sizeof(DataType));
+        }
+        releaseReadRegions(readCount);
+        return readCount;
     }
     int write(const DataType* pData, int count) {
-        return PaUtil_WriteRingBuffer(&m_ringBuffer, pData, count);
+        DataType* dataPtr1;
+        DataType* dataPtr2;
+        ring_buffer_size_t size1;
+        ring_buffer_size_t size2;
+        const int writeCount = aquireWriteRegions(count,
+                &dataPtr1, &size1, &dataPtr2, &size2);
+        if (size1 > 0) {
+            std::memcpy(dataPtr1, pData, size1 * sizeof(DataType));
+        }
+        if (size2 > 0) {
+            std::memcpy(dataPtr2, pData + size1, size2 * sizeof(DataType));
+        }
+        releaseWriteRegions(writeCount);
+        return writeCount;
     }
     void writeBlocking(const DataType* pData, int count) {
         int written = 0;
@@ -42,28 +95,108 @@ class FIFO {
     int aquireWriteRegions(int count,
             DataType** dataPtr1, ring_buffer_size_t* sizePtr1,
             DataType** dataPtr2, ring_buffer_size_t* sizePtr2) {
-        return PaUtil_GetRingBufferWriteRegions(&m_ringBuffer, count,
-                (void**)dataPtr1, sizePtr1, (void**)dataPtr2, sizePtr2);
+        const ring_buffer_size_t writeIndex =
+                m_writeIndex.load(std::memory_order_relaxed);
+        // Only re-read the shared read cursor when the cached value does
+        // not provide enough room.
+        if (m_capacity - (writeIndex - m_cachedReadIndex) <
+                static_cast<ring_buffer_size_t>(count)) {
+            m_cachedReadIndex = m_readIndex.load(std::memory_order_acquire);
+        }
+        const ring_buffer_size_t available =
+                m_capacity - (writeIndex - m_cachedReadIndex);
+        return acquireRegions(math_min<ring_buffer_size_t>(count, available),
+                writeIndex,
+                dataPtr1,
+                sizePtr1,
+                dataPtr2,
+                sizePtr2);
     }
     int releaseWriteRegions(int count) {
-        return PaUtil_AdvanceRingBufferWriteIndex(&m_ringBuffer, count);
+        m_writeIndex.store(
+                m_writeIndex.load(std::memory_order_relaxed) + count,
+                std::memory_order_release);
+        return count;
     }
     int aquireReadRegions(int count,
             DataType** dataPtr1, ring_buffer_size_t* sizePtr1,
             DataType** dataPtr2, ring_buffer_size_t* sizePtr2) {
-        return PaUtil_GetRingBufferReadRegions(&m_ringBuffer, count,
-                (void**)dataPtr1, sizePtr1, (void**)dataPtr2, sizePtr2);
+        const ring_buffer_size_t readIndex =
+                m_readIndex.load(std::memory_order_relaxed);
+        // Only re-read the shared write cursor when the cached value does
+        // not provide enough readable elements.
+        if (m_cachedWriteIndex - readIndex <
+                static_cast<ring_buffer_size_t>(count)) {
+            m_cachedWriteIndex = m_writeIndex.load(std::memory_order_acquire);
+        }
+        const ring_buffer_size_t available = m_cachedWriteIndex - readIndex;
+        return acquireRegions(math_min<ring_buffer_size_t>(count, available),
+                readIndex,
+                dataPtr1,
+                sizePtr1,
+                dataPtr2,
+                sizePtr2);
     }
     int releaseReadRegions(int count) {
-        return PaUtil_AdvanceRingBufferReadIndex(&m_ringBuffer, count);
+        m_readIndex.store(
+                m_readIndex.load(std::memory_order_relaxed) + count,
+                std::memory_order_release);
+        return count;
     }
     int flushReadData(int count) {
-        int flush = math_min(readAvailable(), count);
-        return PaUtil_AdvanceRingBufferReadIndex(&m_ringBuffer, flush);
+        const int flush = math_min(readAvailable(), count);
+        return releaseReadRegions(flush);
+    }
+    /// Returns a span over the contiguous readable elements at the front
+    /// of the FIFO without consuming them. May cover fewer elements than
+    /// readAvailable() when the readable range wraps around the end of
+    /// the ring. Consume the peeked elements with releaseReadRegions().
+    /// Must only be called from the consumer side.
+    std::span<const DataType> tryPeek() {
+        DataType* dataPtr1;
+        DataType* dataPtr2;
+        ring_buffer_size_t size1;
+        ring_buffer_size_t size2;
+        aquireReadRegions(static_cast<int>(m_capacity),
+                &dataPtr1, &size1, &dataPtr2, &size2);
+        return std::span<const DataType>(dataPtr1, size1);
     }
 
   private:
+    int acquireRegions(ring_buffer_size_t count,
+            ring_buffer_size_t cursor,
+            DataType** dataPtr1, ring_buffer_size_t* sizePtr1,
+            DataType** dataPtr2, ring_buffer_size_t* sizePtr2) {
+        const ring_buffer_size_t offset = cursor & (m_capacity - 1);
+        const ring_buffer_size_t firstSize =
+                math_min(count, m_capacity - offset);
+        *dataPtr1 = m_data.data() + offset;
+        *sizePtr1 = firstSize;
+        if (count > firstSize) {
+            *dataPtr2 = m_data.data();
+            *sizePtr2 = count - firstSize;
+        } else {
+            *dataPtr2 = nullptr;
+            *sizePtr2 = 0;
+        }
+        return static_cast<int>(count);
+    }
+
+    static constexpr std::size_t kCacheLineSize = 64;
+
+    // Read-only after construction, shared by both sides.
     std::vector<DataType> m_data;
-    PaUtilRingBuffer m_ringBuffer;
+    const ring_buffer_size_t m_capacity;
+
+    // Producer cache line: the shared write cursor plus the producer's
+    // cached view of the read cursor.
+    alignas(kCacheLineSize) std::atomic<ring_buffer_size_t> m_writeIndex;
+    ring_buffer_size_t m_cachedReadIndex;
+
+    // Consumer cache line: the shared read cursor plus the consumer's
+    // cached view of the write cursor.
+    alignas(kCacheLineSize) std::atomic<ring_buffer_size_t> m_readIndex;
+    ring_buffer_size_t m_cachedWriteIndex;
+
     DISALLOW_COPY_AND_ASSIGN(FIFO);
 };
@@ -0,0 +1,49 @@
+#include "util/hugepages.h"
+
+#include <QtGlobal>
+
+#ifdef Q_OS_LINUX
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdint>
+
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("HugePages");
+
+} // anonymous namespace
+#endif
+
+namespace mixxx {
+
+bool adviseHugePages(void* pData, std::size_t sizeInBytes) {
+#if defined(Q_OS_LINUX) && defined(MADV_HUGEPAGE)
+    // madvise() operates on whole pages, so the unaligned head and tail
+    // of the region are skipped. Only the huge page sized middle part
+    // of the region could be remapped by the kernel anyway.
+    const auto pageSize = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+    auto begin = reinterpret_cast<std::uintptr_t>(pData);
+    auto end = begin + sizeInBytes;
+    begin = (begin + pageSize - 1) & ~(pageSize - 1);
+    end &= ~(pageSize - 1);
+    if (begin >= end) {
+        return false;
+    }
+    if (madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE) != 0) {
+        // Not an error, e.g. the kernel may have been built without
+        // CONFIG_TRANSPARENT_HUGEPAGE.
+        kLogger.debug() << "madvise(MADV_HUGEPAGE) failed";
+        return false;
+    }
+    return true;
+#else
+    Q_UNUSED(pData);
+    Q_UNUSED(sizeInBytes);
+    return false;
+#endif
+}
+
+} // namespace mixxx
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+
+namespace mixxx {
+
+/// Advise the kernel to back a large, long-lived memory region with
+/// transparent huge pages to reduce TLB misses when accessing the
+/// region from real-time code.
+///
+/// This is a best-effort optimization: the advice only takes effect on
+/// Linux kernels with transparent huge page support and is silently
+/// ignored elsewhere. Returns true if the advice has been applied.
+bool adviseHugePages(void* pData, std::size_t sizeInBytes);
+
+} // namespace mixxx
@@ -0,0 +1,61 @@
+#include "util/ioprio.h"
+
+#include <QtGlobal>
+
+#ifdef Q_OS_LINUX
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("IoPriority");
+
+// The ioprio_set() syscall has no glibc wrapper, so the ABI
+// constants from <linux/ioprio.h> are replicated here. See
+// ioprio_set(2) for their documentation.
+constexpr int kIoprioWhoProcess = 1;
+constexpr int kIoprioClassShift = 13;
+constexpr int kIoprioClassRt = 1;
+constexpr int kIoprioClassBe = 2;
+constexpr int kIoprioClassIdle = 3;
+
+bool ioprioSetCurrentThread(int ioprioClass, int level) {
+    // pid 0 = the calling thread
+    return syscall(SYS_ioprio_set,
+                   kIoprioWhoProcess,
+                   0,
+                   (ioprioClass << kIoprioClassShift) | level) == 0;
+}
+
+} // anonymous namespace
+#endif
+
+namespace mixxx {
+
+bool setCurrentThreadIoPriority(IoPriorityClass ioPriorityClass) {
+#if defined(Q_OS_LINUX) && defined(SYS_ioprio_set)
+    switch (ioPriorityClass) {
+    case IoPriorityClass::Realtime:
+        if (ioprioSetCurrentThread(kIoprioClassRt, 0)) {
+            return true;
+        }
+        // The realtime class requires CAP_SYS_NICE or CAP_SYS_ADMIN.
+        // The highest best-effort level is available unprivileged and
+        // still wins over the default level of all other threads.
+        kLogger.debug()
+                << "Realtime I/O class not permitted,"
+                << "falling back to highest best-effort level";
+        return ioprioSetCurrentThread(kIoprioClassBe, 0);
+    case IoPriorityClass::Idle:
+        return ioprioSetCurrentThread(kIoprioClassIdle, 0);
+    }
+    return false;
+#else
+    Q_UNUSED(ioPriorityClass);
+    return false;
+#endif
+}
+
+} // namespace mixxx
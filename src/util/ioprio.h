@@ -0,0 +1,23 @@
+#pragma once
+
+namespace mixxx {
+
+/// I/O scheduling classes for block device requests issued by a
+/// thread, modeled after the Linux I/O priority classes known
+/// from ionice(1).
+enum class IoPriorityClass {
+    /// Served before any best-effort request. Falls back to the
+    /// highest best-effort level if the process lacks the required
+    /// privileges.
+    Realtime,
+    /// Only served when the block device is otherwise idle.
+    Idle,
+};
+
+/// Best-effort request to change the I/O scheduling class of the
+/// calling thread. Returns true if the request has been applied.
+/// Currently only implemented on Linux, a no-op that returns false
+/// on all other platforms.
+bool setCurrentThreadIoPriority(IoPriorityClass ioPriorityClass);
+
+} // namespace mixxx
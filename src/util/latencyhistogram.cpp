@@ -0,0 +1,62 @@
+#include "util/latencyhistogram.h"
+
+#include <QJsonArray>
+#include <algorithm>
+
+// static
+LatencyHistogram& LatencyHistogram::audioPath() {
+    static LatencyHistogram s_audioPathHistogram;
+    return s_audioPathHistogram;
+}
+
+void LatencyHistogram::record(double millis) {
+    if (millis < 0) {
+        return;
+    }
+    const int bucket = std::min(
+            static_cast<int>(millis / kBucketWidthMillis), kNumBuckets);
+    m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    const auto micros = static_cast<quint64>(millis * 1000.0);
+    m_sumMicros.fetch_add(micros, std::memory_order_relaxed);
+    quint64 maxMicros = m_maxMicros.load(std::memory_order_relaxed);
+    while (micros > maxMicros &&
+            !m_maxMicros.compare_exchange_weak(maxMicros,
+                    micros,
+                    std::memory_order_relaxed)) {
+    }
+}
+
+double LatencyHistogram::averageMillis() const {
+    const quint64 count = m_count.load(std::memory_order_relaxed);
+    if (count == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(m_sumMicros.load(std::memory_order_relaxed)) /
+            1000.0 / static_cast<double>(count);
+}
+
+double LatencyHistogram::maxMillis() const {
+    return static_cast<double>(
+                   m_maxMicros.load(std::memory_order_relaxed)) /
+            1000.0;
+}
+
+QJsonObject LatencyHistogram::toJson() const {
+    QJsonArray boundaries;
+    QJsonArray counts;
+    for (int i = 0; i <= kNumBuckets; ++i) {
+        // The upper boundary of the last (overflow) bucket is unbounded and
+        // reported as -1.
+        boundaries.append(i < kNumBuckets ? (i + 1) * kBucketWidthMillis : -1.0);
+        counts.append(static_cast<double>(
+                m_buckets[i].load(std::memory_order_relaxed)));
+    }
+    return QJsonObject{
+            {QStringLiteral("bucket_upper_bounds_ms"), boundaries},
+            {QStringLiteral("bucket_counts"), counts},
+            {QStringLiteral("count"), static_cast<double>(count())},
+            {QStringLiteral("average_ms"), averageMillis()},
+            {QStringLiteral("max_ms"), maxMillis()},
+    };
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <QJsonObject>
+#include <array>
+#include <atomic>
+
+/// Histogram of end-to-end audio path latencies, fed from the audio callback.
+///
+/// record() only performs relaxed atomic increments on preallocated counters,
+/// so it is safe to call from the real-time thread on every callback. Readers
+/// (the [App] ControlObjects and the /api/v1/latency REST endpoint) observe
+/// the counters without locking; a reader racing with a writer can see a
+/// histogram that is one sample out of date, which is fine for a dashboard.
+///
+/// The buckets cover 0 to 24 ms in 0.5 ms steps, bracketing the 12 ms
+/// end-to-end budget, plus one overflow bucket for everything slower.
+class LatencyHistogram {
+  public:
+    static constexpr int kNumBuckets = 48;
+    static constexpr double kBucketWidthMillis = 0.5;
+
+    /// The input-to-output histogram of the audio interface, fed by
+    /// SoundDevicePortAudio from the ADC/DAC timestamps of full duplex
+    /// callbacks. Call once from a non-real-time context (SoundManager does)
+    /// before the audio callback runs so that the one-time initialization
+    /// stays off the real-time path.
+    static LatencyHistogram& audioPath();
+
+    void record(double millis);
+
+    quint64 count() const {
+        return m_count.load(std::memory_order_relaxed);
+    }
+    double averageMillis() const;
+    double maxMillis() const;
+
+    /// JSON representation for the REST endpoint: bucket boundaries and
+    /// counts plus count/average/max summary values.
+    QJsonObject toJson() const;
+
+  private:
+    std::array<std::atomic<quint64>, kNumBuckets + 1> m_buckets{};
+    std::atomic<quint64> m_count{0};
+    std::atomic<quint64> m_sumMicros{0};
+    std::atomic<quint64> m_maxMicros{0};
+};
@@ -0,0 +1,169 @@
+#include "util/rtlogger.h"
+
+#include <QString>
+#include <utility>
+
+#include "moc_rtlogger.cpp"
+#include "util/compatibility/qmutex.h"
+
+namespace {
+
+// Per-thread queue depth. With the per-thread rate limit of
+// RtLogger::kMaxRecordsPerSecond and the 100 ms drain interval the queue can
+// never fill up in steady state.
+constexpr int kLogPipeSize = 1 << 8;
+
+// Length of the rate limiting window.
+constexpr qint64 kRateLimitWindowNanos = 1000000000; // 1 s
+
+// How long the logger thread sleeps between draining the queues.
+constexpr unsigned long kDrainIntervalMillis = 100;
+
+} // anonymous namespace
+
+// static
+bool RtLogger::s_bRtLoggerEnabled = false;
+
+RtLogPipe::RtLogPipe(RtLogger* pLogger)
+        : m_recordsThisWindow(0),
+          m_suppressedThisWindow(0),
+          m_pLogger(pLogger),
+          m_queue(kLogPipeSize) {
+}
+
+RtLogPipe::~RtLogPipe() {
+    if (m_pLogger) {
+        m_pLogger->onLogPipeDestroyed(this);
+    }
+}
+
+RtLogger::RtLogger()
+        : QThread(),
+          m_quit(0) {
+    s_bRtLoggerEnabled = true;
+    setObjectName("RtLogger");
+    m_startTime.start();
+    moveToThread(this);
+    start(QThread::LowPriority);
+}
+
+RtLogger::~RtLogger() {
+    s_bRtLoggerEnabled = false;
+    m_quit = 1;
+    m_logPipeCondition.wakeAll();
+    wait();
+}
+
+void RtLogger::write(RtLogRecord& record) {
+    RtLogPipe* pLogPipe = getLogPipeForThread();
+    if (!pLogPipe) {
+        return;
+    }
+    record.timeNanos = m_startTime.elapsed().toIntegerNanos();
+
+    // Rate limiting. The window state is only touched by the producing
+    // thread, so no synchronization is needed. The initial (stopped) timer
+    // value reports a huge elapsed time, which conveniently opens the first
+    // window right away.
+    if (pLogPipe->m_windowTimer.elapsed().toIntegerNanos() >= kRateLimitWindowNanos) {
+        if (pLogPipe->m_suppressedThisWindow > 0) {
+            RtLogRecord suppressed = {};
+            suppressed.timeNanos = record.timeNanos;
+            suppressed.type = QtWarningMsg;
+            suppressed.format =
+                    "RtLogger: suppressed %.0f records from this thread "
+                    "within the last second";
+            suppressed.numArgs = 1;
+            suppressed.args[0] = pLogPipe->m_suppressedThisWindow;
+            pLogPipe->enqueue(suppressed);
+        }
+        pLogPipe->m_windowTimer.start();
+        pLogPipe->m_recordsThisWindow = 0;
+        pLogPipe->m_suppressedThisWindow = 0;
+    }
+    if (pLogPipe->m_recordsThisWindow >= kMaxRecordsPerSecond) {
+        ++pLogPipe->m_suppressedThisWindow;
+        return;
+    }
+    ++pLogPipe->m_recordsThisWindow;
+
+    if (!pLogPipe->enqueue(record)) {
+        // Queue overflow; count the loss like a rate limited record.
+        ++pLogPipe->m_suppressedThisWindow;
+    }
+}
+
+RtLogPipe* RtLogger::getLogPipeForThread() {
+    if (m_threadLogPipes.hasLocalData()) {
+        return m_threadLogPipes.localData();
+    }
+    RtLogPipe* pResult = new RtLogPipe(this);
+    m_threadLogPipes.setLocalData(pResult);
+    const auto locker = lockMutex(&m_logPipeLock);
+    m_logPipes.push_back(pResult);
+    return pResult;
+}
+
+void RtLogger::onLogPipeDestroyed(RtLogPipe* pPipe) {
+    const auto locker = lockMutex(&m_logPipeLock);
+    processIncomingRecords();
+    m_logPipes.removeAll(pPipe);
+}
+
+void RtLogger::processIncomingRecords() {
+    RtLogRecord record;
+    for (RtLogPipe* pLogPipe : std::as_const(m_logPipes)) {
+        while (pLogPipe->dequeue(&record)) {
+            outputRecord(record);
+        }
+    }
+}
+
+void RtLogger::outputRecord(const RtLogRecord& record) {
+    // All the expensive parts of logging happen here, on the logger thread:
+    // formatting and the locking message handler installed by mixxx::Logging.
+    // Unused varargs are permitted, so always passing kMaxArgs arguments is
+    // safe regardless of how many conversions the format names.
+    const QString message = QString::asprintf(record.format,
+            record.args[0],
+            record.args[1],
+            record.args[2],
+            record.args[3]);
+    const double seconds = static_cast<double>(record.timeNanos) / 1e9;
+    switch (record.type) {
+    case QtDebugMsg:
+        qDebug("[RT +%.3fs] %s", seconds, qUtf8Printable(message));
+        break;
+    case QtInfoMsg:
+        qInfo("[RT +%.3fs] %s", seconds, qUtf8Printable(message));
+        break;
+    case QtWarningMsg:
+        qWarning("[RT +%.3fs] %s", seconds, qUtf8Printable(message));
+        break;
+    case QtCriticalMsg:
+    case QtFatalMsg:
+    default:
+        qCritical("[RT +%.3fs] %s", seconds, qUtf8Printable(message));
+        break;
+    }
+}
+
+void RtLogger::run() {
+    qDebug() << "RtLogger thread starting up.";
+    while (true) {
+        m_logPipeLock.lock();
+        // Producers never signal the condition (waking a wait condition
+        // locks), so drain on a fixed interval. The destructor wakes us for
+        // a prompt shutdown.
+        m_logPipeCondition.wait(&m_logPipeLock, kDrainIntervalMillis);
+        // Drain even when about to quit so that the final records of a
+        // session still reach the log.
+        processIncomingRecords();
+        m_logPipeLock.unlock();
+
+        if (m_quit.loadAcquire() == 1) {
+            qDebug() << "RtLogger thread shutting down.";
+            break;
+        }
+    }
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <QList>
+#include <QMutex>
+#include <QThread>
+#include <QThreadStorage>
+#include <QWaitCondition>
+#include <QtDebug>
+
+#include "rigtorp/SPSCQueue.h"
+#include "util/performancetimer.h"
+#include "util/singleton.h"
+
+class RtLogger;
+
+/// One fixed-size binary log record. The format string must be a string
+/// literal: it is stored by pointer and only dereferenced on the logger
+/// thread, long after the producer has returned. All arguments are passed
+/// as double, so the format may only use floating point conversions
+/// (%f, %g, ...).
+struct RtLogRecord {
+    static constexpr int kMaxArgs = 4;
+
+    qint64 timeNanos;
+    QtMsgType type;
+    const char* format;
+    int numArgs;
+    double args[kMaxArgs];
+};
+
+class RtLogPipe final {
+  public:
+    explicit RtLogPipe(RtLogger* pLogger);
+    ~RtLogPipe();
+
+    bool enqueue(const RtLogRecord& record) {
+        return m_queue.try_push(record);
+    }
+
+    bool dequeue(RtLogRecord* pRecord) {
+        auto pFront = m_queue.front();
+        if (!pFront) {
+            return false;
+        }
+        *pRecord = *pFront;
+        m_queue.pop();
+        return true;
+    }
+
+    // Rate limiting state. Only touched by the producing thread.
+    PerformanceTimer m_windowTimer;
+    int m_recordsThisWindow;
+    int m_suppressedThisWindow;
+
+  private:
+    RtLogger* m_pLogger;
+    rigtorp::SPSCQueue<RtLogRecord> m_queue;
+};
+
+/// Real-time-safe logging sink for engine-thread diagnostics.
+///
+/// The regular logging path (mixxx::Logging installs a Qt message handler)
+/// allocates and locks, so code running in the audio callback has to stay
+/// silent about anomalies or risk an xrun. RtLogger::logf() instead writes a
+/// fixed-size binary record into a wait-free per-thread SPSC queue; a
+/// low-priority logger thread drains the queues and performs the formatting
+/// and the actual (locking) log output there.
+///
+/// Writes are rate limited to kMaxRecordsPerSecond per producing thread;
+/// excess records are counted and reported as suppressed once per second, so
+/// a misbehaving callback cannot flood the queue or the log.
+///
+/// Mirroring StatsManager, the queue of a thread is created on its first
+/// logf() call. Have engine code emit one early record outside the
+/// time-critical path if that one-time allocation is a concern.
+class RtLogger : public QThread, public Singleton<RtLogger> {
+    Q_OBJECT
+  public:
+    RtLogger();
+    ~RtLogger() override;
+
+    static constexpr int kMaxRecordsPerSecond = 50;
+
+    static bool s_bRtLoggerEnabled;
+
+    /// Enqueues one record for deferred formatting and output. Wait-free and
+    /// allocation-free apart from the first call per thread. Drops the record
+    /// silently while no RtLogger instance exists.
+    template<typename... Args>
+    static void logf(QtMsgType type, const char* format, Args... args) {
+        static_assert(sizeof...(Args) <= RtLogRecord::kMaxArgs,
+                "RtLogRecord holds at most kMaxArgs arguments");
+        if (!s_bRtLoggerEnabled) {
+            return;
+        }
+        RtLogRecord record;
+        record.type = type;
+        record.format = format;
+        record.numArgs = sizeof...(Args);
+        const double unpacked[] = {0.0, static_cast<double>(args)...};
+        for (int i = 0; i < record.numArgs; ++i) {
+            record.args[i] = unpacked[i + 1];
+        }
+        for (int i = record.numArgs; i < RtLogRecord::kMaxArgs; ++i) {
+            record.args[i] = 0.0;
+        }
+        instance()->write(record);
+    }
+
+  protected:
+    void run() override;
+
+  private:
+    void write(RtLogRecord& record);
+    void processIncomingRecords();
+    void outputRecord(const RtLogRecord& record);
+    RtLogPipe* getLogPipeForThread();
+    void onLogPipeDestroyed(RtLogPipe* pPipe);
+
+    QAtomicInt m_quit;
+    PerformanceTimer m_startTime;
+    QWaitCondition m_logPipeCondition;
+    QMutex m_logPipeLock;
+    QList<RtLogPipe*> m_logPipes;
+    QThreadStorage<RtLogPipe*> m_threadLogPipes;
+
+    friend class RtLogPipe;
+};
@@ -5,6 +5,7 @@
 
 #include "engine/engine.h"
 #include "util/math.h"
+#include "util/samplesimd.h"
 
 #ifdef __WINDOWS__
 #include <QtGlobal>
@@ -121,10 +122,7 @@ void SampleUtil::applyGain(CSAMPLE* pBuffer, CSAMPLE_GAIN gain,
         return;
     }
 
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples; ++i) {
-        pBuffer[i] *= gain;
-    }
+    mixxx::samplesimd::dispatch().applyGain(pBuffer, gain, numSamples);
 }
 
 // static
@@ -138,23 +136,8 @@ void SampleUtil::applyRampingGain(CSAMPLE* pBuffer, CSAMPLE_GAIN old_gain,
         return;
     }
 
-    const CSAMPLE_GAIN gain_delta = (new_gain - old_gain)
-            / CSAMPLE_GAIN(numSamples / 2);
-    if (gain_delta != 0) {
-        const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
-        // note: LOOP VECTORIZED.
-        for (int i = 0; i < numSamples / 2; ++i) {
-            const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
-            // a loop counter i += 2 prevents vectorizing.
-            pBuffer[i * 2] *= gain;
-            pBuffer[i * 2 + 1] *= gain;
-        }
-    } else {
-        // note: LOOP VECTORIZED.
-        for (int i = 0; i < numSamples; ++i) {
-            pBuffer[i] *= old_gain;
-        }
-    }
+    mixxx::samplesimd::dispatch().applyRampingGain(
+            pBuffer, old_gain, new_gain, numSamples);
 }
 
 CSAMPLE SampleUtil::copyWithRampingNormalization(CSAMPLE* pDest,
@@ -249,10 +232,7 @@ void SampleUtil::addWithGain(CSAMPLE* M_RESTRICT pDest,
         return;
     }
 
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples; ++i) {
-        pDest[i] += pSrc[i] * gain;
-    }
+    mixxx::samplesimd::dispatch().addWithGain(pDest, pSrc, gain, numSamples);
 }
 
 void SampleUtil::addWithRampingGain(CSAMPLE* M_RESTRICT pDest,
@@ -263,22 +243,8 @@ void SampleUtil::addWithRampingGain(CSAMPLE* M_RESTRICT pDest,
         return;
     }
 
-    const CSAMPLE_GAIN gain_delta = (new_gain - old_gain)
-            / CSAMPLE_GAIN(numSamples / 2);
-    if (gain_delta != 0) {
-        const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
-        // note: LOOP VECTORIZED.
-        for (int i = 0; i < numSamples / 2; ++i) {
-            const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
-            pDest[i * 2] += pSrc[i * 2] * gain;
-            pDest[i * 2 + 1] += pSrc[i * 2 + 1] * gain;
-        }
-    } else {
-        // note: LOOP VECTORIZED.
-        for (int i = 0; i < numSamples; ++i) {
-            pDest[i] += pSrc[i] * old_gain;
-        }
-    }
+    mixxx::samplesimd::dispatch().addWithRampingGain(
+            pDest, pSrc, old_gain, new_gain, numSamples);
 }
 
 // static
@@ -323,6 +289,49 @@ void SampleUtil::add3WithGain(CSAMPLE* pDest,
     }
 }
 
+// static
+void SampleUtil::addBuffers(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* const* pSrcs, int numSrcs,
+        SINT numSamples) {
+    int src = 0;
+    for (; src + 4 <= numSrcs; src += 4) {
+        const CSAMPLE* M_RESTRICT pSrc1 = pSrcs[src];
+        const CSAMPLE* M_RESTRICT pSrc2 = pSrcs[src + 1];
+        const CSAMPLE* M_RESTRICT pSrc3 = pSrcs[src + 2];
+        const CSAMPLE* M_RESTRICT pSrc4 = pSrcs[src + 3];
+        // note: LOOP VECTORIZED.
+        for (SINT i = 0; i < numSamples; ++i) {
+            pDest[i] += pSrc1[i] + pSrc2[i] + pSrc3[i] + pSrc4[i];
+        }
+    }
+    switch (numSrcs - src) {
+    case 3: {
+        const CSAMPLE* M_RESTRICT pSrc1 = pSrcs[src];
+        const CSAMPLE* M_RESTRICT pSrc2 = pSrcs[src + 1];
+        const CSAMPLE* M_RESTRICT pSrc3 = pSrcs[src + 2];
+        // note: LOOP VECTORIZED.
+        for (SINT i = 0; i < numSamples; ++i) {
+            pDest[i] += pSrc1[i] + pSrc2[i] + pSrc3[i];
+        }
+        break;
+    }
+    case 2: {
+        const CSAMPLE* M_RESTRICT pSrc1 = pSrcs[src];
+        const CSAMPLE* M_RESTRICT pSrc2 = pSrcs[src + 1];
+        // note: LOOP VECTORIZED.
+        for (SINT i = 0; i < numSamples; ++i) {
+            pDest[i] += pSrc1[i] + pSrc2[i];
+        }
+        break;
+    }
+    case 1:
+        add(pDest, pSrcs[src], numSamples);
+        break;
+    default:
+        break;
+    }
+}
+
 // static
 void SampleUtil::copyWithGain(CSAMPLE* M_RESTRICT pDest,
         const CSAMPLE* M_RESTRICT pSrc,
@@ -336,14 +345,7 @@ void SampleUtil::copyWithGain(CSAMPLE* M_RESTRICT pDest,
         return;
     }
 
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples; ++i) {
-        pDest[i] = pSrc[i] * gain;
-    }
-
-    // OR! need to test which fares better
-    // copy(pDest, pSrc, iNumSamples);
-    // applyGain(pDest, gain);
+    mixxx::samplesimd::dispatch().copyWithGain(pDest, pSrc, gain, numSamples);
 }
 
 // static
@@ -361,26 +363,8 @@ void SampleUtil::copyWithRampingGain(CSAMPLE* M_RESTRICT pDest,
         return;
     }
 
-    const CSAMPLE_GAIN gain_delta = (new_gain - old_gain)
-            / CSAMPLE_GAIN(numSamples / 2);
-    if (gain_delta != 0) {
-        const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
-        // note: LOOP VECTORIZED only with "int i" (not SINT i).
-        for (int i = 0; i < numSamples / 2; ++i) {
-            const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
-            pDest[i * 2] = pSrc[i * 2] * gain;
-            pDest[i * 2 + 1] = pSrc[i * 2 + 1] * gain;
-        }
-    } else {
-        // note: LOOP VECTORIZED.
-        for (SINT i = 0; i < numSamples; ++i) {
-            pDest[i] = pSrc[i] * old_gain;
-        }
-    }
-
-    // OR! need to test which fares better
-    // copy(pDest, pSrc, iNumSamples);
-    // applyRampingGain(pDest, gain);
+    mixxx::samplesimd::dispatch().copyWithRampingGain(
+            pDest, pSrc, old_gain, new_gain, numSamples);
 }
 
 // static
@@ -412,6 +396,23 @@ void SampleUtil::convertFloat32ToS16(SAMPLE* pDest, const CSAMPLE* pSrc,
     }
 }
 
+// static
+void SampleUtil::convertFloat32ToS16WithGain(SAMPLE* pDest,
+        const CSAMPLE* pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    // Folding the gain into the conversion factor keeps this a single
+    // multiply-and-clamp pass, see convertFloat32ToS16 for the conversion
+    // convention.
+    const CSAMPLE kConversionFactor = SAMPLE_MINIMUM * -1.0f * gain;
+    // note: LOOP VECTORIZED only with "int i" (not SINT i).
+    for (int i = 0; i < numSamples; ++i) {
+        pDest[i] = static_cast<SAMPLE>(math_clamp(pSrc[i] * kConversionFactor,
+                static_cast<CSAMPLE>(SAMPLE_MINIMUM),
+                static_cast<CSAMPLE>(SAMPLE_MAXIMUM)));
+    }
+}
+
 // static
 SampleUtil::CLIP_STATUS SampleUtil::sumAbsPerChannel(CSAMPLE* pfAbsL,
         CSAMPLE* pfAbsR, const CSAMPLE* pBuffer, SINT numSamples) {
@@ -443,6 +444,24 @@ SampleUtil::CLIP_STATUS SampleUtil::sumAbsPerChannel(CSAMPLE* pfAbsL,
     return clipping;
 }
 
+// static
+void SampleUtil::maxAbsPerChannel(CSAMPLE* pMaxAbsL, CSAMPLE* pMaxAbsR,
+        const CSAMPLE* pBuffer, SINT numSamples) {
+    CSAMPLE maxAbsL = CSAMPLE_ZERO;
+    CSAMPLE maxAbsR = CSAMPLE_ZERO;
+
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples / 2; ++i) {
+        const CSAMPLE absl = fabs(pBuffer[i * 2]);
+        maxAbsL = absl > maxAbsL ? absl : maxAbsL;
+        const CSAMPLE absr = fabs(pBuffer[i * 2 + 1]);
+        maxAbsR = absr > maxAbsR ? absr : maxAbsR;
+    }
+
+    *pMaxAbsL = maxAbsL;
+    *pMaxAbsR = maxAbsR;
+}
+
 // static
 CSAMPLE SampleUtil::sumSquared(const CSAMPLE* pBuffer, SINT numSamples) {
     CSAMPLE sumSq = CSAMPLE_ZERO;
@@ -517,6 +536,84 @@ void SampleUtil::interleaveBuffer(CSAMPLE* M_RESTRICT pDest,
     }
 }
 
+// static
+void SampleUtil::interleaveClampStereoBuffers(CSAMPLE* pDest,
+        const CSAMPLE* const* pSrcs,
+        const int* pChannelBases,
+        int numSrcs,
+        int frameSize,
+        SINT numFrames) {
+    DEBUG_ASSERT(frameSize >= numSrcs * 2);
+    if (numSrcs * 2 < frameSize) {
+        // Some device channels have no source assigned and must be silenced.
+        // Since the stereo channel ranges of the sources do not overlap, a
+        // full cover needs no clearing at all and pDest is written exactly
+        // once below.
+        clear(pDest, numFrames * frameSize);
+    }
+    for (SINT i = 0; i < numFrames; ++i) {
+        CSAMPLE* pFrame = pDest + i * frameSize;
+        const SINT srcFrameBase = i * 2;
+        for (int s = 0; s < numSrcs; ++s) {
+            const CSAMPLE* pSrc = pSrcs[s] + srcFrameBase;
+            CSAMPLE* pOut = pFrame + pChannelBases[s];
+            pOut[0] = clampSample(pSrc[0]);
+            pOut[1] = clampSample(pSrc[1]);
+        }
+    }
+}
+
+// static
+void SampleUtil::linearResampleBuffer(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numDestFrames,
+        SINT numSrcFrames,
+        int channelCount) {
+    if (numDestFrames == numSrcFrames) {
+        copy(pDest, pSrc, numDestFrames * channelCount);
+        return;
+    }
+    DEBUG_ASSERT(numDestFrames > 1);
+    DEBUG_ASSERT(numSrcFrames > 1);
+    const double step = static_cast<double>(numSrcFrames - 1) /
+            static_cast<double>(numDestFrames - 1);
+    for (SINT i = 0; i < numDestFrames; ++i) {
+        const double srcPos = static_cast<double>(i) * step;
+        SINT srcFrame = static_cast<SINT>(srcPos);
+        if (srcFrame >= numSrcFrames - 1) {
+            // The very last frame has no successor to interpolate towards;
+            // clamping yields frac == 1.0 and returns it unchanged.
+            srcFrame = numSrcFrames - 2;
+        }
+        const CSAMPLE_GAIN frac =
+                static_cast<CSAMPLE_GAIN>(srcPos - static_cast<double>(srcFrame));
+        const CSAMPLE* pFrame0 = pSrc + srcFrame * channelCount;
+        const CSAMPLE* pFrame1 = pFrame0 + channelCount;
+        CSAMPLE* pOut = pDest + i * channelCount;
+        for (int ch = 0; ch < channelCount; ++ch) {
+            pOut[ch] = pFrame0[ch] + (pFrame1[ch] - pFrame0[ch]) * frac;
+        }
+    }
+}
+
+// static
+void SampleUtil::deinterleaveStereoBuffers(CSAMPLE* const* pDests,
+        const int* pChannelBases,
+        int numDests,
+        const CSAMPLE* pSrc,
+        int frameSize,
+        SINT numFrames) {
+    for (SINT i = 0; i < numFrames; ++i) {
+        const CSAMPLE* pFrame = pSrc + i * frameSize;
+        const SINT destFrameBase = i * 2;
+        for (int d = 0; d < numDests; ++d) {
+            CSAMPLE* pOut = pDests[d] + destFrameBase;
+            pOut[0] = pFrame[pChannelBases[d]];
+            pOut[1] = pFrame[pChannelBases[d] + 1];
+        }
+    }
+}
+
 // static
 void SampleUtil::deinterleaveBuffer(CSAMPLE* M_RESTRICT pDest1,
         CSAMPLE* M_RESTRICT pDest2,
@@ -896,6 +993,23 @@ void SampleUtil::copyOneStereoFromMulti(
     }
 }
 
+// static
+void SampleUtil::addOneStereoFromMultiWithGain(
+        CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numFrames,
+        mixxx::audio::ChannelCount numChannels,
+        int sourceChannel,
+        CSAMPLE_GAIN gain) {
+    DEBUG_ASSERT(numChannels > mixxx::audio::ChannelCount::stereo());
+    // forward loop
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numFrames; ++i) {
+        pDest[i * 2] += pSrc[i * numChannels + sourceChannel] * gain;
+        pDest[i * 2 + 1] += pSrc[i * numChannels + sourceChannel + 1] * gain;
+    }
+}
+
 // static
 void SampleUtil::insertStereoToMulti(
         CSAMPLE* M_RESTRICT pDest,
@@ -211,6 +211,13 @@ class SampleUtil {
             CSAMPLE_GAIN gain1, const CSAMPLE* pSrc2, CSAMPLE_GAIN gain2,
             const CSAMPLE* pSrc3, CSAMPLE_GAIN gain3, SINT numSamples);
 
+    // Add numSrcs source buffers to pDest. Processes four sources per pass
+    // over pDest, so mixing many channels reads and writes the destination
+    // buffer once per group of four sources instead of once per source.
+    static void addBuffers(CSAMPLE* pDest,
+            const CSAMPLE* const* pSrcs, int numSrcs,
+            SINT numSamples);
+
     // Convert and normalize a buffer of SAMPLEs in the range [-SAMPLE_MAX, SAMPLE_MAX]
     // to a buffer of CSAMPLEs in the range [-1.0, 1.0].
     static void convertS16ToFloat32(CSAMPLE* pDest, const SAMPLE* pSrc,
@@ -221,6 +228,12 @@ class SampleUtil {
     static void convertFloat32ToS16(SAMPLE* pDest, const CSAMPLE* pSrc,
             SINT numSamples);
 
+    // Like convertFloat32ToS16, but applies a gain in the same pass.
+    static void convertFloat32ToS16WithGain(SAMPLE* pDest,
+            const CSAMPLE* pSrc,
+            CSAMPLE_GAIN gain,
+            SINT numSamples);
+
     // For each pair of samples in pBuffer (l,r) -- stores the sum of the
     // absolute values of l in pfAbsL, and the sum of the absolute values of r
     // in pfAbsR.
@@ -228,6 +241,12 @@ class SampleUtil {
     static CLIP_STATUS sumAbsPerChannel(CSAMPLE* pfAbsL, CSAMPLE* pfAbsR,
             const CSAMPLE* pBuffer, SINT numSamples);
 
+    // For each pair of samples in pBuffer (l,r) -- stores the maximum of
+    // the absolute values of l in pMaxAbsL, and the maximum of the
+    // absolute values of r in pMaxAbsR.
+    static void maxAbsPerChannel(CSAMPLE* pMaxAbsL, CSAMPLE* pMaxAbsR,
+            const CSAMPLE* pBuffer, SINT numSamples);
+
     // Returns the sum of the squared values of the buffer.
     static CSAMPLE sumSquared(const CSAMPLE* pBuffer, SINT numSamples);
 
@@ -271,6 +290,31 @@ class SampleUtil {
             const CSAMPLE* pSrc,
             SINT numFrames);
 
+    // Compose interleaved sound device output frames of frameSize channels
+    // from numSrcs stereo source buffers in a single pass over pDest.
+    // pSrcs[i] is copied clamped to channels pChannelBases[i] and
+    // pChannelBases[i] + 1 of every frame. If the sources do not cover all
+    // frameSize channels, the remaining channels are cleared. The channel
+    // ranges of the sources must not overlap and pDest must not alias any
+    // source.
+    static void interleaveClampStereoBuffers(CSAMPLE* pDest,
+            const CSAMPLE* const* pSrcs,
+            const int* pChannelBases,
+            int numSrcs,
+            int frameSize,
+            SINT numFrames);
+
+    // Split interleaved sound device input frames of frameSize channels into
+    // numDests stereo destination buffers in a single pass over pSrc.
+    // Channels pChannelBases[i] and pChannelBases[i] + 1 of every frame are
+    // copied to pDests[i]. No destination may alias pSrc.
+    static void deinterleaveStereoBuffers(CSAMPLE* const* pDests,
+            const int* pChannelBases,
+            int numDests,
+            const CSAMPLE* pSrc,
+            int frameSize,
+            SINT numFrames);
+
     // Deinterleave the samples in pSrc alternately into pDest1, pDest2, etc ti
     // pDest8 (stem stereo). numFrames must be the number of samples in each
     // pDest*, and pSrc must have at least numFrames*8 samples. None of the
@@ -286,6 +330,19 @@ class SampleUtil {
             const CSAMPLE* pSrc,
             SINT numFrames);
 
+    // Linearly resample pSrc (numSrcFrames frames of channelCount channels)
+    // into pDest (numDestFrames frames). The first and last source frame map
+    // onto the first and last destination frame, so consecutive chunks
+    // resampled by +-1 frame stay continuous at the chunk boundaries. Used by
+    // the sound device drift correction to stretch a chunk instead of
+    // dropping or doubling a single frame outright, which produces an
+    // audible click. pDest and pSrc must not overlap.
+    static void linearResampleBuffer(CSAMPLE* pDest,
+            const CSAMPLE* pSrc,
+            SINT numDestFrames,
+            SINT numSrcFrames,
+            int channelCount);
+
     /// Crossfade two buffers together. All the buffers must be the same length.
     /// pDest is in one version the Out and in the other version the In buffer.
     static void linearCrossfadeBuffersOut(
@@ -411,6 +468,18 @@ class SampleUtil {
             mixxx::audio::ChannelCount numChannels,
             int channelOffset);
 
+    // Mixes (adds) one stereo channel pair out of interleaved multi-channel
+    // sample data in pSrc with numChannels >= 2 into the stereo buffer pDest,
+    // applying the given constant gain. The channel pair is selected like in
+    // copyOneStereoFromMulti(). pSrc must contain (numFrames * numChannels)
+    // samples, (numFrames * 2) samples of pDest will be updated.
+    static void addOneStereoFromMultiWithGain(CSAMPLE* pDest,
+            const CSAMPLE* pSrc,
+            SINT numFrames,
+            mixxx::audio::ChannelCount numChannels,
+            int sourceChannel,
+            CSAMPLE_GAIN gain);
+
     // reverses stereo sample in place
     static void reverse(CSAMPLE* pBuffer, SINT numSamples);
 
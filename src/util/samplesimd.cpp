@@ -0,0 +1,556 @@
+#include "util/samplesimd.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define SAMPLESIMD_X86_DISPATCH 1
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SAMPLESIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace mixxx {
+namespace samplesimd {
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Generic kernels
+//
+// These mirror the historic SampleUtil loops, including the "LOOP VECTORIZED"
+// index type quirks, so baseline builds keep the exact code the
+// autovectorizer is known to handle.
+// ---------------------------------------------------------------------------
+
+void applyGainGeneric(CSAMPLE* pBuffer, CSAMPLE_GAIN gain, SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pBuffer[i] *= gain;
+    }
+}
+
+void applyRampingGainGeneric(CSAMPLE* pBuffer,
+        CSAMPLE_GAIN old_gain,
+        CSAMPLE_GAIN new_gain,
+        SINT numSamples) {
+    const CSAMPLE_GAIN gain_delta = (new_gain - old_gain) /
+            CSAMPLE_GAIN(numSamples / 2);
+    if (gain_delta != 0) {
+        const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
+        // note: LOOP VECTORIZED.
+        for (int i = 0; i < numSamples / 2; ++i) {
+            const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
+            // a loop counter i += 2 prevents vectorizing.
+            pBuffer[i * 2] *= gain;
+            pBuffer[i * 2 + 1] *= gain;
+        }
+    } else {
+        // note: LOOP VECTORIZED.
+        for (int i = 0; i < numSamples; ++i) {
+            pBuffer[i] *= old_gain;
+        }
+    }
+}
+
+void addWithGainGeneric(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pDest[i] += pSrc[i] * gain;
+    }
+}
+
+void addWithRampingGainGeneric(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN old_gain,
+        CSAMPLE_GAIN new_gain,
+        SINT numSamples) {
+    const CSAMPLE_GAIN gain_delta = (new_gain - old_gain) /
+            CSAMPLE_GAIN(numSamples / 2);
+    if (gain_delta != 0) {
+        const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
+        // note: LOOP VECTORIZED.
+        for (int i = 0; i < numSamples / 2; ++i) {
+            const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
+            pDest[i * 2] += pSrc[i * 2] * gain;
+            pDest[i * 2 + 1] += pSrc[i * 2 + 1] * gain;
+        }
+    } else {
+        // note: LOOP VECTORIZED.
+        for (int i = 0; i < numSamples; ++i) {
+            pDest[i] += pSrc[i] * old_gain;
+        }
+    }
+}
+
+void copyWithGainGeneric(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pDest[i] = pSrc[i] * gain;
+    }
+}
+
+void copyWithRampingGainGeneric(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN old_gain,
+        CSAMPLE_GAIN new_gain,
+        SINT numSamples) {
+    const CSAMPLE_GAIN gain_delta = (new_gain - old_gain) /
+            CSAMPLE_GAIN(numSamples / 2);
+    if (gain_delta != 0) {
+        const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
+        // note: LOOP VECTORIZED only with "int i" (not SINT i).
+        for (int i = 0; i < numSamples / 2; ++i) {
+            const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
+            pDest[i * 2] = pSrc[i * 2] * gain;
+            pDest[i * 2 + 1] = pSrc[i * 2 + 1] * gain;
+        }
+    } else {
+        // note: LOOP VECTORIZED.
+        for (SINT i = 0; i < numSamples; ++i) {
+            pDest[i] = pSrc[i] * old_gain;
+        }
+    }
+}
+
+void downmixStereoToMonoDoubleGeneric(double* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numFrames) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numFrames; ++i) {
+        pDest[i] = (pSrc[i * 2] + pSrc[i * 2 + 1]) * 0.5;
+    }
+}
+
+void widenToDoubleGeneric(double* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pDest[i] = pSrc[i];
+    }
+}
+
+#ifdef SAMPLESIMD_X86_DISPATCH
+
+// ---------------------------------------------------------------------------
+// AVX2/FMA kernels
+//
+// Compiled via target attributes so the rest of the binary keeps the baseline
+// ISA; only ever called after __builtin_cpu_supports() confirmed support.
+// Unaligned loads are used since callers do not guarantee 32-byte alignment
+// (SampleUtil::alloc only aligns to 16 bytes on non-AVX builds) and incur no
+// penalty on AVX2-class CPUs for 32-byte-crossing accesses.
+//
+// The ramping kernels keep the per-frame-pair gain staircase of the scalar
+// code exactly: lane pair indices {0,0,1,1,2,2,3,3} advanced by 4 per
+// iteration, so left/right samples of a frame always get the identical gain.
+// ---------------------------------------------------------------------------
+
+__attribute__((target("avx2,fma"))) void applyGainAvx2(
+        CSAMPLE* pBuffer, CSAMPLE_GAIN gain, SINT numSamples) {
+    const __m256 vGain = _mm256_set1_ps(gain);
+    SINT i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        const __m256 v = _mm256_loadu_ps(pBuffer + i);
+        _mm256_storeu_ps(pBuffer + i, _mm256_mul_ps(v, vGain));
+    }
+    for (; i < numSamples; ++i) {
+        pBuffer[i] *= gain;
+    }
+}
+
+__attribute__((target("avx2,fma"))) void applyRampingGainAvx2(CSAMPLE* pBuffer,
+        CSAMPLE_GAIN old_gain,
+        CSAMPLE_GAIN new_gain,
+        SINT numSamples) {
+    const CSAMPLE_GAIN gain_delta = (new_gain - old_gain) /
+            CSAMPLE_GAIN(numSamples / 2);
+    if (gain_delta == 0) {
+        applyGainAvx2(pBuffer, old_gain, numSamples);
+        return;
+    }
+    const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
+    const __m256 vPairIdx = _mm256_set_ps(3, 3, 2, 2, 1, 1, 0, 0);
+    __m256 vGain = _mm256_fmadd_ps(vPairIdx,
+            _mm256_set1_ps(gain_delta),
+            _mm256_set1_ps(start_gain));
+    const __m256 vGainStep = _mm256_set1_ps(gain_delta * 4);
+    SINT i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        const __m256 v = _mm256_loadu_ps(pBuffer + i);
+        _mm256_storeu_ps(pBuffer + i, _mm256_mul_ps(v, vGain));
+        vGain = _mm256_add_ps(vGain, vGainStep);
+    }
+    for (; i < numSamples; ++i) {
+        pBuffer[i] *= start_gain + gain_delta * (i / 2);
+    }
+}
+
+__attribute__((target("avx2,fma"))) void addWithGainAvx2(
+        CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    const __m256 vGain = _mm256_set1_ps(gain);
+    SINT i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        const __m256 vDest = _mm256_loadu_ps(pDest + i);
+        const __m256 vSrc = _mm256_loadu_ps(pSrc + i);
+        _mm256_storeu_ps(pDest + i, _mm256_fmadd_ps(vSrc, vGain, vDest));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] += pSrc[i] * gain;
+    }
+}
+
+__attribute__((target("avx2,fma"))) void addWithRampingGainAvx2(
+        CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN old_gain,
+        CSAMPLE_GAIN new_gain,
+        SINT numSamples) {
+    const CSAMPLE_GAIN gain_delta = (new_gain - old_gain) /
+            CSAMPLE_GAIN(numSamples / 2);
+    if (gain_delta == 0) {
+        addWithGainAvx2(pDest, pSrc, old_gain, numSamples);
+        return;
+    }
+    const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
+    const __m256 vPairIdx = _mm256_set_ps(3, 3, 2, 2, 1, 1, 0, 0);
+    __m256 vGain = _mm256_fmadd_ps(vPairIdx,
+            _mm256_set1_ps(gain_delta),
+            _mm256_set1_ps(start_gain));
+    const __m256 vGainStep = _mm256_set1_ps(gain_delta * 4);
+    SINT i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        const __m256 vDest = _mm256_loadu_ps(pDest + i);
+        const __m256 vSrc = _mm256_loadu_ps(pSrc + i);
+        _mm256_storeu_ps(pDest + i, _mm256_fmadd_ps(vSrc, vGain, vDest));
+        vGain = _mm256_add_ps(vGain, vGainStep);
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] += pSrc[i] * (start_gain + gain_delta * (i / 2));
+    }
+}
+
+__attribute__((target("avx2,fma"))) void copyWithGainAvx2(
+        CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    const __m256 vGain = _mm256_set1_ps(gain);
+    SINT i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        const __m256 vSrc = _mm256_loadu_ps(pSrc + i);
+        _mm256_storeu_ps(pDest + i, _mm256_mul_ps(vSrc, vGain));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] = pSrc[i] * gain;
+    }
+}
+
+__attribute__((target("avx2,fma"))) void copyWithRampingGainAvx2(
+        CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN old_gain,
+        CSAMPLE_GAIN new_gain,
+        SINT numSamples) {
+    const CSAMPLE_GAIN gain_delta = (new_gain - old_gain) /
+            CSAMPLE_GAIN(numSamples / 2);
+    if (gain_delta == 0) {
+        copyWithGainAvx2(pDest, pSrc, old_gain, numSamples);
+        return;
+    }
+    const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
+    const __m256 vPairIdx = _mm256_set_ps(3, 3, 2, 2, 1, 1, 0, 0);
+    __m256 vGain = _mm256_fmadd_ps(vPairIdx,
+            _mm256_set1_ps(gain_delta),
+            _mm256_set1_ps(start_gain));
+    const __m256 vGainStep = _mm256_set1_ps(gain_delta * 4);
+    SINT i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        const __m256 vSrc = _mm256_loadu_ps(pSrc + i);
+        _mm256_storeu_ps(pDest + i, _mm256_mul_ps(vSrc, vGain));
+        vGain = _mm256_add_ps(vGain, vGainStep);
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] = pSrc[i] * (start_gain + gain_delta * (i / 2));
+    }
+}
+
+__attribute__((target("avx2,fma"))) void downmixStereoToMonoDoubleAvx2(
+        double* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numFrames) {
+    const __m256d vHalf = _mm256_set1_pd(0.5);
+    SINT i = 0;
+    for (; i + 4 <= numFrames; i += 4) {
+        // 8 floats = 4 interleaved frames f0..f3.
+        const __m256 v = _mm256_loadu_ps(pSrc + i * 2);
+        const __m256d vLo = _mm256_cvtps_pd(_mm256_castps256_ps128(v));
+        const __m256d vHi = _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1));
+        // hadd yields the frame sums in the order {f0, f2, f1, f3}.
+        const __m256d vSums = _mm256_permute4x64_pd(
+                _mm256_hadd_pd(vLo, vHi), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_pd(pDest + i, _mm256_mul_pd(vSums, vHalf));
+    }
+    for (; i < numFrames; ++i) {
+        pDest[i] = (pSrc[i * 2] + pSrc[i * 2 + 1]) * 0.5;
+    }
+}
+
+__attribute__((target("avx2,fma"))) void widenToDoubleAvx2(
+        double* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numSamples) {
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        _mm256_storeu_pd(pDest + i, _mm256_cvtps_pd(_mm_loadu_ps(pSrc + i)));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] = pSrc[i];
+    }
+}
+
+#endif // SAMPLESIMD_X86_DISPATCH
+
+#ifdef SAMPLESIMD_NEON
+
+// ---------------------------------------------------------------------------
+// NEON kernels
+//
+// NEON is part of the baseline ISA on AArch64, so these are selected
+// unconditionally there. The plain gain loops autovectorize fine; the
+// explicit kernels matter for the ramping staircase, which trips up the
+// autovectorizer on some compilers. Lane pair indices are {0,0,1,1} advanced
+// by 2 per iteration.
+// ---------------------------------------------------------------------------
+
+void applyGainNeon(CSAMPLE* pBuffer, CSAMPLE_GAIN gain, SINT numSamples) {
+    const float32x4_t vGain = vdupq_n_f32(gain);
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        vst1q_f32(pBuffer + i, vmulq_f32(vld1q_f32(pBuffer + i), vGain));
+    }
+    for (; i < numSamples; ++i) {
+        pBuffer[i] *= gain;
+    }
+}
+
+void applyRampingGainNeon(CSAMPLE* pBuffer,
+        CSAMPLE_GAIN old_gain,
+        CSAMPLE_GAIN new_gain,
+        SINT numSamples) {
+    const CSAMPLE_GAIN gain_delta = (new_gain - old_gain) /
+            CSAMPLE_GAIN(numSamples / 2);
+    if (gain_delta == 0) {
+        applyGainNeon(pBuffer, old_gain, numSamples);
+        return;
+    }
+    const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
+    const float32x4_t vPairIdx = {0, 0, 1, 1};
+    float32x4_t vGain = vmlaq_n_f32(vdupq_n_f32(start_gain), vPairIdx, gain_delta);
+    const float32x4_t vGainStep = vdupq_n_f32(gain_delta * 2);
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        vst1q_f32(pBuffer + i, vmulq_f32(vld1q_f32(pBuffer + i), vGain));
+        vGain = vaddq_f32(vGain, vGainStep);
+    }
+    for (; i < numSamples; ++i) {
+        pBuffer[i] *= start_gain + gain_delta * (i / 2);
+    }
+}
+
+void addWithGainNeon(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        vst1q_f32(pDest + i,
+                vmlaq_n_f32(vld1q_f32(pDest + i), vld1q_f32(pSrc + i), gain));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] += pSrc[i] * gain;
+    }
+}
+
+void addWithRampingGainNeon(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN old_gain,
+        CSAMPLE_GAIN new_gain,
+        SINT numSamples) {
+    const CSAMPLE_GAIN gain_delta = (new_gain - old_gain) /
+            CSAMPLE_GAIN(numSamples / 2);
+    if (gain_delta == 0) {
+        addWithGainNeon(pDest, pSrc, old_gain, numSamples);
+        return;
+    }
+    const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
+    const float32x4_t vPairIdx = {0, 0, 1, 1};
+    float32x4_t vGain = vmlaq_n_f32(vdupq_n_f32(start_gain), vPairIdx, gain_delta);
+    const float32x4_t vGainStep = vdupq_n_f32(gain_delta * 2);
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        vst1q_f32(pDest + i,
+                vmlaq_f32(vld1q_f32(pDest + i), vld1q_f32(pSrc + i), vGain));
+        vGain = vaddq_f32(vGain, vGainStep);
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] += pSrc[i] * (start_gain + gain_delta * (i / 2));
+    }
+}
+
+void copyWithGainNeon(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        vst1q_f32(pDest + i, vmulq_n_f32(vld1q_f32(pSrc + i), gain));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] = pSrc[i] * gain;
+    }
+}
+
+void copyWithRampingGainNeon(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN old_gain,
+        CSAMPLE_GAIN new_gain,
+        SINT numSamples) {
+    const CSAMPLE_GAIN gain_delta = (new_gain - old_gain) /
+            CSAMPLE_GAIN(numSamples / 2);
+    if (gain_delta == 0) {
+        copyWithGainNeon(pDest, pSrc, old_gain, numSamples);
+        return;
+    }
+    const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
+    const float32x4_t vPairIdx = {0, 0, 1, 1};
+    float32x4_t vGain = vmlaq_n_f32(vdupq_n_f32(start_gain), vPairIdx, gain_delta);
+    const float32x4_t vGainStep = vdupq_n_f32(gain_delta * 2);
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        vst1q_f32(pDest + i, vmulq_f32(vld1q_f32(pSrc + i), vGain));
+        vGain = vaddq_f32(vGain, vGainStep);
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] = pSrc[i] * (start_gain + gain_delta * (i / 2));
+    }
+}
+
+#ifdef __aarch64__
+
+// The double precision conversions need the float64x2 instructions that are
+// only part of AArch64; 32-bit NEON builds keep the generic loops.
+
+void downmixStereoToMonoDoubleNeon(double* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numFrames) {
+    SINT i = 0;
+    for (; i + 2 <= numFrames; i += 2) {
+        // 4 floats = 2 interleaved frames.
+        const float32x4_t v = vld1q_f32(pSrc + i * 2);
+        const float32x2_t vSums =
+                vpadd_f32(vget_low_f32(v), vget_high_f32(v));
+        vst1q_f64(pDest + i, vmulq_n_f64(vcvt_f64_f32(vSums), 0.5));
+    }
+    for (; i < numFrames; ++i) {
+        pDest[i] = (pSrc[i * 2] + pSrc[i * 2 + 1]) * 0.5;
+    }
+}
+
+void widenToDoubleNeon(double* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numSamples) {
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        const float32x4_t v = vld1q_f32(pSrc + i);
+        vst1q_f64(pDest + i, vcvt_f64_f32(vget_low_f32(v)));
+        vst1q_f64(pDest + i + 2, vcvt_high_f64_f32(v));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] = pSrc[i];
+    }
+}
+
+#endif // __aarch64__
+
+#endif // SAMPLESIMD_NEON
+
+struct NamedDispatchTable {
+    DispatchTable table;
+    const char* name;
+};
+
+NamedDispatchTable makeDispatchTable() {
+    NamedDispatchTable dispatch = {
+            {
+                    applyGainGeneric,
+                    applyRampingGainGeneric,
+                    addWithGainGeneric,
+                    addWithRampingGainGeneric,
+                    copyWithGainGeneric,
+                    copyWithRampingGainGeneric,
+                    downmixStereoToMonoDoubleGeneric,
+                    widenToDoubleGeneric,
+            },
+            "generic",
+    };
+#if defined(SAMPLESIMD_X86_DISPATCH)
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        dispatch.table = {
+                applyGainAvx2,
+                applyRampingGainAvx2,
+                addWithGainAvx2,
+                addWithRampingGainAvx2,
+                copyWithGainAvx2,
+                copyWithRampingGainAvx2,
+                downmixStereoToMonoDoubleAvx2,
+                widenToDoubleAvx2,
+        };
+        dispatch.name = "avx2";
+    }
+#elif defined(SAMPLESIMD_NEON)
+    dispatch.table = {
+            applyGainNeon,
+            applyRampingGainNeon,
+            addWithGainNeon,
+            addWithRampingGainNeon,
+            copyWithGainNeon,
+            copyWithRampingGainNeon,
+#ifdef __aarch64__
+            downmixStereoToMonoDoubleNeon,
+            widenToDoubleNeon,
+#else
+            downmixStereoToMonoDoubleGeneric,
+            widenToDoubleGeneric,
+#endif
+    };
+    dispatch.name = "neon";
+#endif
+    return dispatch;
+}
+
+const NamedDispatchTable& namedDispatch() {
+    static const NamedDispatchTable s_dispatch = makeDispatchTable();
+    return s_dispatch;
+}
+
+} // anonymous namespace
+
+const DispatchTable& dispatch() {
+    return namedDispatch().table;
+}
+
+const char* dispatchName() {
+    return namedDispatch().name;
+}
+
+} // namespace samplesimd
+} // namespace mixxx
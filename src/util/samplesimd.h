@@ -0,0 +1,81 @@
+#pragma once
+
+#include "util/platform.h"
+#include "util/types.h"
+
+// Runtime-dispatched SIMD kernels backing the hottest SampleUtil routines
+// (gain, ramping gain and mixing loops that dominate EngineMixer::process())
+// and the analyzer input conversion of DownmixAndOverlapHelper.
+//
+// The generic kernels are plain loops compiled with the baseline ISA and rely
+// on autovectorization, exactly like the historic SampleUtil implementations.
+// On x86-64 builds with GCC or Clang an AVX2/FMA variant of each kernel is
+// additionally compiled via function target attributes and selected once at
+// startup if the CPU supports it, similar to FFmpeg's cpudetect dispatch.
+// On AArch64 explicit NEON kernels are used unconditionally since NEON is
+// part of the baseline ISA there.
+//
+// AVX-512 kernels are deliberately not provided: at typical engine buffer
+// sizes the wider registers do not pay for the frequency licensing penalty
+// they trigger on most client CPUs.
+//
+// All kernels assume the special cases (unity/zero gain) have already been
+// peeled off by the SampleUtil wrappers and just run the loop.
+namespace mixxx {
+namespace samplesimd {
+
+typedef void (*ApplyGainFn)(CSAMPLE* pBuffer, CSAMPLE_GAIN gain, SINT numSamples);
+typedef void (*ApplyRampingGainFn)(CSAMPLE* pBuffer,
+        CSAMPLE_GAIN old_gain,
+        CSAMPLE_GAIN new_gain,
+        SINT numSamples);
+typedef void (*AddWithGainFn)(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples);
+typedef void (*AddWithRampingGainFn)(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN old_gain,
+        CSAMPLE_GAIN new_gain,
+        SINT numSamples);
+typedef void (*CopyWithGainFn)(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples);
+typedef void (*CopyWithRampingGainFn)(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN old_gain,
+        CSAMPLE_GAIN new_gain,
+        SINT numSamples);
+// Averages interleaved stereo frames into a mono signal widened to the
+// double precision the qm-dsp analyzers consume.
+typedef void (*DownmixStereoToMonoDoubleFn)(double* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numFrames);
+// Widens mono samples to double precision without downmixing.
+typedef void (*WidenToDoubleFn)(double* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numSamples);
+
+struct DispatchTable {
+    ApplyGainFn applyGain;
+    ApplyRampingGainFn applyRampingGain;
+    AddWithGainFn addWithGain;
+    AddWithRampingGainFn addWithRampingGain;
+    CopyWithGainFn copyWithGain;
+    CopyWithRampingGainFn copyWithRampingGain;
+    DownmixStereoToMonoDoubleFn downmixStereoToMonoDouble;
+    WidenToDoubleFn widenToDouble;
+};
+
+/// Returns the kernel table matching the CPU we are running on. The table is
+/// initialized on first use and constant afterwards, so callers may cache the
+/// reference.
+const DispatchTable& dispatch();
+
+/// Returns a short human readable name of the selected kernel set
+/// ("generic", "avx2" or "neon") for logging and the developer tools.
+const char* dispatchName();
+
+} // namespace samplesimd
+} // namespace mixxx
@@ -1,6 +1,9 @@
 #include "util/statsmanager.h"
 
 #include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QMetaType>
 #include <QTextStream>
 #include <QtDebug>
@@ -73,7 +76,14 @@ StatsManager::~StatsManager() {
     qDebug() << "=====================================";
 
     if (CmdlineArgs::Instance().getTimelineEnabled()) {
-        writeTimeline(CmdlineArgs::Instance().getTimelinePath());
+        const QString timelinePath = CmdlineArgs::Instance().getTimelinePath();
+        // A .json suffix selects the chrome://tracing compatible format
+        // instead of the plain-text timeline.
+        if (timelinePath.endsWith(QStringLiteral(".json"), Qt::CaseInsensitive)) {
+            writeChromeTrace(timelinePath);
+        } else {
+            writeTimeline(timelinePath);
+        }
     }
 }
 
@@ -162,6 +172,66 @@ void StatsManager::writeTimeline(const QString& filename) {
     timeline.close();
 }
 
+// Writes all recorded events in the Trace Event JSON format, which can be
+// loaded into chrome://tracing or https://ui.perfetto.dev to get a visual
+// timeline of the named phases recorded via Event::start()/Event::end().
+void StatsManager::writeChromeTrace(const QString& filename) {
+    QFile traceFile(filename);
+    if (!traceFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qDebug() << "Could not open trace file for writing:"
+                 << traceFile.fileName();
+        return;
+    }
+
+    if (m_events.isEmpty()) {
+        qDebug() << "No events recorded.";
+        return;
+    }
+
+    // Sort by time.
+    std::sort(m_events.begin(), m_events.end(), OrderByTime());
+
+    // StatReports carry no thread attribution, and begin/end pairs on a
+    // single track must nest properly, which spans recorded on different
+    // threads do not. Giving every tag its own track sidesteps both issues.
+    QMap<QString, int> trackByTag;
+    QJsonArray traceEvents;
+    for (const Event& event : std::as_const(m_events)) {
+        int track = trackByTag.value(event.m_tag, -1);
+        if (track == -1) {
+            track = trackByTag.size() + 1;
+            trackByTag.insert(event.m_tag, track);
+        }
+
+        QJsonObject traceEvent;
+        traceEvent.insert(QStringLiteral("name"), event.m_tag);
+        traceEvent.insert(QStringLiteral("pid"), 1);
+        traceEvent.insert(QStringLiteral("tid"), track);
+        // Trace timestamps are expected in microseconds.
+        traceEvent.insert(QStringLiteral("ts"),
+                static_cast<double>(event.m_time.toIntegerNanos()) / 1000.0);
+        switch (event.m_type) {
+        case Stat::EVENT_START:
+            traceEvent.insert(QStringLiteral("ph"), QStringLiteral("B"));
+            break;
+        case Stat::EVENT_END:
+            traceEvent.insert(QStringLiteral("ph"), QStringLiteral("E"));
+            break;
+        default:
+            // Instant event, visible as a thread-scoped marker.
+            traceEvent.insert(QStringLiteral("ph"), QStringLiteral("i"));
+            traceEvent.insert(QStringLiteral("s"), QStringLiteral("t"));
+            break;
+        }
+        traceEvents.append(traceEvent);
+    }
+
+    QJsonObject trace;
+    trace.insert(QStringLiteral("traceEvents"), traceEvents);
+    trace.insert(QStringLiteral("displayTimeUnit"), QStringLiteral("ms"));
+    traceFile.write(QJsonDocument(trace).toJson(QJsonDocument::Compact));
+}
+
 void StatsManager::onStatsPipeDestroyed(StatsPipe* pPipe) {
     const auto locker = lockMutex(&m_statsPipeLock);
     processIncomingStatReports();
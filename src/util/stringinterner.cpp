@@ -0,0 +1,52 @@
+#include "util/stringinterner.h"
+
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSet>
+
+#include "util/logger.h"
+
+namespace mixxx {
+
+namespace {
+
+const Logger kLogger("StringInterner");
+
+// Safety net against unbounded growth if callers accidentally intern
+// high-cardinality fields. The pool is simply dropped when reaching
+// this limit, already shared instances remain valid and shared.
+constexpr int kMaxPooledStrings = 1 << 16;
+
+QMutex s_mutex;
+QSet<QString> s_pool;
+
+} // anonymous namespace
+
+// static
+QString StringInterner::intern(const QString& value) {
+    if (value.isEmpty()) {
+        // Both null and empty strings are cheap literals in Qt
+        return value;
+    }
+    QMutexLocker locker(&s_mutex);
+    const auto it = s_pool.constFind(value);
+    if (it != s_pool.constEnd()) {
+        return *it;
+    }
+    if (s_pool.size() >= kMaxPooledStrings) {
+        kLogger.warning()
+                << "Discarding"
+                << s_pool.size()
+                << "pooled strings";
+        s_pool.clear();
+    }
+    return *s_pool.insert(value);
+}
+
+// static
+int StringInterner::count() {
+    QMutexLocker locker(&s_mutex);
+    return static_cast<int>(s_pool.size());
+}
+
+} // namespace mixxx
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <QString>
+
+namespace mixxx {
+
+/// Process-wide pool of deduplicated strings.
+///
+/// Many track metadata fields like artist, album, or genre only have
+/// a few thousand distinct values even in libraries with hundreds of
+/// thousands of tracks. Routing such fields through intern() makes all
+/// equal copies share the character data of a single pooled instance
+/// by exploiting the implicit sharing of QString. This both shrinks
+/// the resident memory footprint and enables the pointer-comparison
+/// fast path of QString equality comparisons during sorting.
+///
+/// Thread-safe. Do NOT intern fields that are mostly unique per track
+/// like the title or comment, because that would only grow the pool
+/// without any sharing.
+class StringInterner {
+  public:
+    StringInterner() = delete;
+
+    /// Return an instance equal to the given value that shares its
+    /// character data with all other interned copies of the same value.
+    /// Empty strings are returned as is without touching the pool.
+    static QString intern(const QString& value);
+
+    /// Number of distinct strings currently pooled.
+    /// Only needed for tests and diagnostics.
+    static int count();
+};
+
+} // namespace mixxx
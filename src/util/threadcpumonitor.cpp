@@ -0,0 +1,179 @@
+#include "util/threadcpumonitor.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QtDebug>
+#include <algorithm>
+
+#ifdef __LINUX__
+#include <unistd.h>
+#endif
+
+#include "control/controlobject.h"
+#include "moc_threadcpumonitor.cpp"
+#include "util/compatibility/qmutex.h"
+
+namespace {
+
+const QString kCpuUsageGroup = QStringLiteral("[CpuUsage]");
+
+} // anonymous namespace
+
+// static
+bool ThreadCpuMonitor::s_bThreadCpuMonitorEnabled = false;
+
+ThreadCpuMonitor::ThreadCpuMonitor()
+        : m_sampleCount(0),
+          m_lastSampleTimeMillis(0) {
+    s_bThreadCpuMonitorEnabled = true;
+    connect(&m_sampleTimer, &QTimer::timeout, this, &ThreadCpuMonitor::sample);
+    m_sampleTimer.start(kSampleIntervalMillis);
+    // Establish the tick baselines right away so the first periodic sample
+    // already reports usage instead of zeros.
+    sample();
+}
+
+ThreadCpuMonitor::~ThreadCpuMonitor() {
+    s_bThreadCpuMonitorEnabled = false;
+}
+
+// static
+void ThreadCpuMonitor::tagCurrentThread(const QString& subsystem) {
+    if (!s_bThreadCpuMonitorEnabled) {
+        return;
+    }
+#ifdef __LINUX__
+    instance()->tagThread(static_cast<qint64>(gettid()), subsystem);
+#else
+    Q_UNUSED(subsystem);
+#endif
+}
+
+void ThreadCpuMonitor::tagThread(qint64 threadId, const QString& subsystem) {
+    const auto locker = lockMutex(&m_mutex);
+    m_subsystemByThreadId.insert(threadId, subsystem);
+}
+
+void ThreadCpuMonitor::sample() {
+#ifdef __LINUX__
+    const qint64 nowMillis = QDateTime::currentMSecsSinceEpoch();
+
+    // Collect the accumulated CPU ticks of every thread of this process.
+    QHash<qint64, qint64> ticksByThreadId;
+    QHash<qint64, QString> commByThreadId;
+    const QDir taskDir(QStringLiteral("/proc/self/task"));
+    const QStringList threadIds = taskDir.entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+    for (const QString& threadIdString : threadIds) {
+        bool ok = false;
+        const qint64 threadId = threadIdString.toLongLong(&ok);
+        if (!ok) {
+            continue;
+        }
+        QFile statFile(taskDir.filePath(
+                threadIdString + QStringLiteral("/stat")));
+        if (!statFile.open(QIODevice::ReadOnly)) {
+            // The thread exited between listing and reading.
+            continue;
+        }
+        const QByteArray stat = statFile.readAll();
+        // The thread name (comm) is enclosed in parentheses and may itself
+        // contain spaces, so fields are counted from behind the last ')'.
+        const int commStart = stat.indexOf('(');
+        const int commEnd = stat.lastIndexOf(')');
+        if (commStart < 0 || commEnd <= commStart) {
+            continue;
+        }
+        const QList<QByteArray> fields = stat.mid(commEnd + 2).split(' ');
+        // utime and stime are the 14th and 15th field of
+        // /proc/self/task/<tid>/stat; pid and comm precede the split.
+        if (fields.size() < 13) {
+            continue;
+        }
+        ticksByThreadId.insert(threadId,
+                fields.at(11).toLongLong() + fields.at(12).toLongLong());
+        commByThreadId.insert(threadId,
+                QString::fromUtf8(stat.mid(
+                        commStart + 1, commEnd - commStart - 1)));
+    }
+
+    const long ticksPerSecond = sysconf(_SC_CLK_TCK);
+
+    const auto locker = lockMutex(&m_mutex);
+    const double elapsedSeconds = m_lastSampleTimeMillis > 0
+            ? (nowMillis - m_lastSampleTimeMillis) / 1000.0
+            : 0.0;
+    m_lastSampleTimeMillis = nowMillis;
+
+    QHash<QString, double> percentBySubsystem;
+    for (auto it = ticksByThreadId.constBegin();
+            it != ticksByThreadId.constEnd();
+            ++it) {
+        double percent = 0.0;
+        const qint64 lastTicks = m_lastTicksByThreadId.value(it.key(), -1);
+        if (lastTicks >= 0 && elapsedSeconds > 0 && ticksPerSecond > 0) {
+            percent = 100.0 * static_cast<double>(it.value() - lastTicks) /
+                    (static_cast<double>(ticksPerSecond) * elapsedSeconds);
+        }
+        const QString subsystem = m_subsystemByThreadId.value(
+                it.key(), commByThreadId.value(it.key()));
+        percentBySubsystem[subsystem] += percent;
+    }
+    // Replacing the whole hash forgets threads that exited since the last
+    // sample, so their ids can be recycled without inheriting stale ticks.
+    m_lastTicksByThreadId = ticksByThreadId;
+
+    const int slot = static_cast<int>(m_sampleCount % kHistorySize);
+    m_sampleTimesMillis[slot] = nowMillis;
+    // Subsystems whose threads all exited keep their history but record
+    // zero usage from now on.
+    for (auto it = m_historyBySubsystem.begin();
+            it != m_historyBySubsystem.end();
+            ++it) {
+        it.value().usagePercent[slot] = 0.0f;
+    }
+    for (auto it = percentBySubsystem.constBegin();
+            it != percentBySubsystem.constEnd();
+            ++it) {
+        SubsystemHistory& history = m_historyBySubsystem[it.key()];
+        if (!history.pControl) {
+            history.pControl = std::make_unique<ControlObject>(
+                    ConfigKey(kCpuUsageGroup, it.key()));
+        }
+        history.usagePercent[slot] = static_cast<float>(it.value());
+        history.pControl->set(it.value());
+    }
+    ++m_sampleCount;
+#endif
+}
+
+QJsonObject ThreadCpuMonitor::historyPayload() const {
+    const auto locker = lockMutex(&m_mutex);
+    const int numSamples = static_cast<int>(
+            std::min<qint64>(m_sampleCount, kHistorySize));
+    const qint64 begin = m_sampleCount - numSamples;
+
+    QJsonArray timestamps;
+    for (int i = 0; i < numSamples; ++i) {
+        timestamps.append(m_sampleTimesMillis[(begin + i) % kHistorySize]);
+    }
+
+    QJsonObject subsystems;
+    for (auto it = m_historyBySubsystem.constBegin();
+            it != m_historyBySubsystem.constEnd();
+            ++it) {
+        QJsonArray values;
+        for (int i = 0; i < numSamples; ++i) {
+            values.append(static_cast<double>(
+                    it.value().usagePercent[(begin + i) % kHistorySize]));
+        }
+        subsystems.insert(it.key(), values);
+    }
+
+    QJsonObject payload;
+    payload.insert(QStringLiteral("interval_ms"), kSampleIntervalMillis);
+    payload.insert(QStringLiteral("timestamps_ms"), timestamps);
+    payload.insert(QStringLiteral("subsystems"), subsystems);
+    return payload;
+}
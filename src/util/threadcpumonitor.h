@@ -0,0 +1,77 @@
+#pragma once
+
+#include <QHash>
+#include <QJsonObject>
+#include <QMutex>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <array>
+#include <memory>
+
+#include "util/singleton.h"
+
+class ControlObject;
+
+/// Continuous per-thread CPU accounting keyed to Mixxx subsystems.
+///
+/// Samples the CPU time of every thread of the process on a fixed interval
+/// and aggregates it per subsystem so that it is possible to tell after a
+/// show which part of Mixxx burned CPU when. Subsystems are identified by
+/// tagCurrentThread() calls from the long-lived threads (engine, analyzers,
+/// controllers, ...); untagged threads fall back to their native thread
+/// name. Results are exposed three ways:
+///
+///  - one ControlObject per subsystem, [CpuUsage],<subsystem>, holding the
+///    current usage in percent of one core (a subsystem with several busy
+///    threads can exceed 100),
+///  - a ring-buffered history of the last kHistorySize samples, and
+///  - historyPayload(), a JSON representation of that history served by the
+///    REST API under /api/v1/cpu.
+///
+/// Per-thread CPU times are read from /proc/self/task, so the sampling is
+/// only functional on Linux; on other platforms the monitor stays idle.
+/// StatsManager was not extended for this because it only exists in
+/// developer mode, while this accounting has to run during production use.
+class ThreadCpuMonitor : public QObject, public Singleton<ThreadCpuMonitor> {
+    Q_OBJECT
+  public:
+    ThreadCpuMonitor();
+    ~ThreadCpuMonitor() override;
+
+    static constexpr int kSampleIntervalMillis = 5000;
+    // 720 samples at 5 s each cover the last hour of a show.
+    static constexpr int kHistorySize = 720;
+
+    static bool s_bThreadCpuMonitorEnabled;
+
+    /// Associates the calling thread with the given subsystem name. Call
+    /// once from a long-lived thread, outside of any time-critical section
+    /// (the registration takes a lock). Safe to call when no monitor exists.
+    static void tagCurrentThread(const QString& subsystem);
+
+    /// JSON history for the REST endpoint. Thread safe.
+    QJsonObject historyPayload() const;
+
+  private slots:
+    void sample();
+
+  private:
+    struct SubsystemHistory {
+        std::array<float, kHistorySize> usagePercent{};
+        std::unique_ptr<ControlObject> pControl;
+    };
+
+    void tagThread(qint64 threadId, const QString& subsystem);
+
+    QTimer m_sampleTimer;
+
+    mutable QMutex m_mutex;
+    QHash<qint64, QString> m_subsystemByThreadId;
+    // CPU ticks consumed per thread at the previous sample.
+    QHash<qint64, qint64> m_lastTicksByThreadId;
+    QHash<QString, SubsystemHistory> m_historyBySubsystem;
+    std::array<qint64, kHistorySize> m_sampleTimesMillis{};
+    qint64 m_sampleCount;
+    qint64 m_lastSampleTimeMillis;
+};
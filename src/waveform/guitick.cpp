@@ -1,6 +1,7 @@
 #include "waveform/guitick.h"
 
 #include "control/controlobject.h"
+#include "widget/controlwidgetconnection.h"
 
 namespace {
 const QString kAppGroup = QStringLiteral("[App]");
@@ -20,6 +21,10 @@ GuiTick::GuiTick() {
 // this is called from WaveformWidgetFactory::render in the main thread with the
 // configured waveform frame rate
 void GuiTick::process() {
+    // Deliver the latest control values of this frame to the widgets
+    // of the skin with latest-value coalescing.
+    ControlParameterWidgetConnection::processFrameCoalescedUpdates();
+
     m_cpuTimeLastTick += m_cpuTimer.restart();
     double cpuTimeLastTickSeconds = m_cpuTimeLastTick.toDoubleSeconds();
     m_pCOGuiTickTime->set(cpuTimeLastTickSeconds);
@@ -89,6 +89,11 @@ bool WaveformRendererRGB::preprocessInner() {
     const double visualIncrementPerPixel =
             (lastVisualFrame - firstVisualFrame) / static_cast<double>(pixelLength);
 
+    // Aggregate over a downsampled level of the waveform when each pixel
+    // covers many visual frames, so the cost of this preprocessing loop is
+    // bounded independent of the zoom level, see Waveform::mipData().
+    const WaveformDataRow row = selectWaveformDataRow(waveform, visualIncrementPerPixel);
+
     // Per-band gain from the EQ knobs.
     float allGain(1.0), lowGain(1.0), midGain(1.0), highGain(1.0);
     // applyCompensation = false, as we scale to match filtered.all
@@ -137,12 +142,14 @@ bool WaveformRendererRGB::preprocessInner() {
     const double maxSamplingRange = visualIncrementPerPixel / 2.0;
 
     for (int pos = 0; pos < pixelLength; ++pos) {
-        const int visualFrameStart = std::lround(xVisualFrame - maxSamplingRange);
-        const int visualFrameStop = std::lround(xVisualFrame + maxSamplingRange);
+        const int visualFrameStart =
+                std::lround(xVisualFrame - maxSamplingRange) / row.frameFactor;
+        const int visualFrameStop =
+                std::lround(xVisualFrame + maxSamplingRange) / row.frameFactor;
 
         const int visualIndexStart = std::max(visualFrameStart * 2, 0);
         const int visualIndexStop =
-                std::min(std::max(visualFrameStop, visualFrameStart + 1) * 2, dataSize - 1);
+                std::min(std::max(visualFrameStop, visualFrameStart + 1) * 2, row.dataSize - 1);
 
         const float fpos = static_cast<float>(pos) * invDevicePixelRatio;
 
@@ -159,7 +166,7 @@ bool WaveformRendererRGB::preprocessInner() {
             int signalChn = splitLeftRight ? chn : 0;
             // data is interleaved left / right
             for (int i = visualIndexStart + chn; i < visualIndexStop + chn; i += 2) {
-                const WaveformData& waveformData = data[i];
+                const WaveformData& waveformData = row.data[i];
 
                 u8maxLow[signalChn] = math_max(u8maxLow[signalChn], waveformData.filtered.low);
                 u8maxMid[signalChn] = math_max(u8maxMid[signalChn], waveformData.filtered.mid);
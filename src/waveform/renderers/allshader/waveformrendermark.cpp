@@ -388,7 +388,10 @@ void allshader::WaveformRenderMark::update() {
                     m_waveformRenderer->transformSamplePositionInRendererWorld(
                             sampleEndPosition, positionType));
 
-            if (visible || currentMarkEndPos > 0.f) {
+            // Only draw the range if it intersects the visible span; a loop
+            // may lie entirely outside of it.
+            if (currentMarkEndPos > 0.f &&
+                    currentMarkPos < m_waveformRenderer->getLength()) {
                 if (pMark->isLoop()) {
                     // Reuse, or create new when needed
                     if (!pRangeChild) {
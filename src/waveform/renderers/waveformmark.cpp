@@ -1,5 +1,6 @@
 #include "waveformmark.h"
 
+#include <QCache>
 #include <QOpenGLTexture>
 #include <QPainterPath>
 #include <QStringLiteral>
@@ -17,6 +18,37 @@ namespace {
 // would count as hovering over the WaveformMark.
 constexpr float lineHoverPadding = 5.0;
 
+// Cache of rendered marker images, shared between all waveform widgets.
+// Marks that render identically - the intro/outro and loop markers of all
+// decks, or equally numbered and colored hotcues - produce the same image,
+// so we rasterize it once and hand out the implicitly shared QImage instead
+// of repeating the QPainter/SVG work for every deck and widget. Only used
+// from the GUI thread, like WImageStore.
+QCache<QString, QImage>& markImageCache() {
+    static QCache<QString, QImage> cache(256);
+    return cache;
+}
+
+// All inputs that determine the pixels of the image rendered by
+// WaveformMark::performImageGeneration() below, see its use there.
+QString markImageCacheKey(float devicePixelRatio,
+        const QString& text,
+        const QString& iconPath,
+        Qt::Alignment align,
+        float breadth,
+        int level,
+        const QColor& fillColor,
+        const QColor& borderColor,
+        const QColor& labelColor) {
+    return QString::number(devicePixelRatio) % QChar('|') % text %
+            QChar('|') % iconPath % QChar('|') %
+            QString::number(static_cast<int>(align)) % QChar('|') %
+            QString::number(breadth) % QChar('|') % QString::number(level) %
+            QChar('|') % QString::number(fillColor.rgba(), 16) % QChar('|') %
+            QString::number(borderColor.rgba(), 16) % QChar('|') %
+            QString::number(labelColor.rgba(), 16);
+}
+
 Qt::Alignment decodeAlignmentFlags(const QString& alignString, Qt::Alignment defaultFlags) {
     const QStringList stringFlags = alignString.toLower()
                                             .split('|',
@@ -519,6 +551,22 @@ QImage WaveformMark::performImageGeneration(float devicePixelRatio,
         return QImage{};
     }
 
+    // The geometry and offsets above are cheap to compute and have per-mark
+    // side effects, but the rasterization below only depends on these inputs
+    // and is shared between all marks that render identically.
+    const QString cacheKey = markImageCacheKey(devicePixelRatio,
+            useIcon ? QString() : text,
+            useIcon ? iconPath : QString(),
+            m_align,
+            m_breadth,
+            m_level,
+            fillColor(),
+            borderColor(),
+            labelColor());
+    if (const QImage* pCachedImage = markImageCache().object(cacheKey)) {
+        return *pCachedImage;
+    }
+
     QImage image{size, QImage::Format_ARGB32_Premultiplied};
     VERIFY_OR_DEBUG_ASSERT(!image.isNull()) {
         return image;
@@ -591,6 +639,8 @@ QImage WaveformMark::performImageGeneration(float devicePixelRatio,
 
     painter.end();
 
+    markImageCache().insert(cacheKey, new QImage(image));
+
     return image;
 }
 
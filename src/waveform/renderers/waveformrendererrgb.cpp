@@ -76,6 +76,11 @@ void WaveformRendererRGB::draw(
     // Represents the # of waveform data points per horizontal pixel.
     const double gain = (lastVisualIndex - firstVisualIndex) / length;
 
+    // When each pixel covers many visual frames (zoomed-out view of a long
+    // track), aggregate over a precomputed downsampled level of the waveform
+    // instead of scanning every frame.
+    const WaveformDataRow row = selectWaveformDataRow(pWaveform, gain / 2.0);
+
     // Per-band gain from the EQ knobs.
     float allGain(1.0), lowGain(1.0), midGain(1.0), highGain(1.0);
     getGains(&allGain, true, &lowGain, &midGain, &highGain);
@@ -113,9 +118,11 @@ void WaveformRendererRGB::draw(
         // to check +/- maxSamplingRange frames, not samples. To do this, divide
         // xVisualSampleIndex by 2. Since frames indices are integers, we round
         // to the nearest integer by adding 0.5 before casting to int.
-        int visualFrameStart = int(xVisualSampleIndex / 2.0 - maxSamplingRange + 0.5);
-        int visualFrameStop = int(xVisualSampleIndex / 2.0 + maxSamplingRange + 0.5);
-        const int lastVisualFrame = dataSize / 2 - 1;
+        int visualFrameStart = int(xVisualSampleIndex / 2.0 - maxSamplingRange + 0.5) /
+                row.frameFactor;
+        int visualFrameStop = int(xVisualSampleIndex / 2.0 + maxSamplingRange + 0.5) /
+                row.frameFactor;
+        const int lastVisualFrame = row.dataSize / 2 - 1;
 
         // We now know that some subset of [visualFrameStart, visualFrameStop]
         // lies within the valid range of visual frames. Clamp
@@ -133,9 +140,9 @@ void WaveformRendererRGB::draw(
         float maxAllNext = 0.;
 
         for (int i = visualIndexStart;
-             i >= 0 && i + 1 < dataSize && i + 1 <= visualIndexStop; i += 2) {
-            const WaveformData& waveformData = data[i];
-            const WaveformData& waveformDataNext = data[i + 1];
+             i >= 0 && i + 1 < row.dataSize && i + 1 <= visualIndexStop; i += 2) {
+            const WaveformData& waveformData = row.data[i];
+            const WaveformData& waveformDataNext = row.data[i + 1];
 
             maxLow  = math_max3(maxLow,  waveformData.filtered.low,  waveformDataNext.filtered.low);
             maxMid  = math_max3(maxMid,  waveformData.filtered.mid,  waveformDataNext.filtered.mid);
@@ -166,6 +166,26 @@ void WaveformRendererSignalBase::setup(const QDomNode& node,
     setHighVisualGain(pWaveformFactory->getVisualGain(BandIndex::High));
 }
 
+// static
+WaveformRendererSignalBase::WaveformDataRow
+WaveformRendererSignalBase::selectWaveformDataRow(
+        const ConstWaveformPointer& pWaveform, double framesPerPixel) {
+    WaveformDataRow row{pWaveform->data(), pWaveform->getDataSize(), 1};
+    for (int level = Waveform::kMipLevelCount - 1; level >= 0; --level) {
+        const int frameFactor = Waveform::mipFrameFactor(level);
+        if (framesPerPixel >= static_cast<double>(Waveform::kMipFactor) * frameFactor) {
+            const std::vector<WaveformData>* mipData = pWaveform->mipData(level);
+            if (mipData != nullptr) {
+                row.data = mipData->data();
+                row.dataSize = static_cast<int>(mipData->size());
+                row.frameFactor = frameFactor;
+            }
+            break;
+        }
+    }
+    return row;
+}
+
 void WaveformRendererSignalBase::getGains(float* pAllGain,
         bool applyCompensation,
         float* pLowGain,
@@ -55,6 +55,25 @@ class WaveformRendererSignalBase : public QObject, public WaveformRendererAbstra
             float* pMidGain,
             float* highGain);
 
+    // View on the waveform data at the resolution suitable for the current
+    // zoom level, see selectWaveformDataRow().
+    struct WaveformDataRow {
+        const WaveformData* data;
+        int dataSize;
+        // Number of full-resolution visual frames per frame of data.
+        int frameFactor;
+    };
+
+    // Returns the coarsest downsampled level of the waveform that still
+    // yields at least Waveform::kMipFactor frames per pixel, or the
+    // full-resolution data if no such level exists (or the levels are not
+    // available yet, see Waveform::mipData()). Aggregating over the
+    // returned row instead of the full-resolution data bounds the
+    // per-pixel sampling loops of the renderers independent of the zoom
+    // level. Frame indices have to be divided by frameFactor.
+    static WaveformDataRow selectWaveformDataRow(
+            const ConstWaveformPointer& pWaveform, double framesPerPixel);
+
   protected:
     std::unique_ptr<ControlProxy> m_pEQEnabled;
     std::unique_ptr<ControlProxy> m_pLowFilterControlObject;
@@ -54,7 +54,10 @@ void WaveformRenderMark::draw(QPainter* painter, QPaintEvent* /*event*/) {
                     const double currentMarkEndPoint =
                             m_waveformRenderer->transformSamplePositionInRendererWorld(
                                     sampleEndPosition);
-                    if (visible || currentMarkEndPoint > 0) {
+                    // Only draw the range if it intersects the visible span;
+                    // a loop may lie entirely outside of it.
+                    if (currentMarkEndPoint > 0 &&
+                            currentMarkPoint < m_waveformRenderer->getWidth()) {
                         QColor color = pMark->fillColor();
                         color.setAlphaF(0.4f);
 
@@ -100,7 +103,10 @@ void WaveformRenderMark::draw(QPainter* painter, QPaintEvent* /*event*/) {
                             m_waveformRenderer
                                     ->transformSamplePositionInRendererWorld(
                                             sampleEndPosition);
-                    if (currentMarkEndPoint < m_waveformRenderer->getHeight()) {
+                    // Only draw the range if it intersects the visible span;
+                    // a loop may lie entirely outside of it.
+                    if (currentMarkEndPoint > 0 &&
+                            currentMarkPoint < m_waveformRenderer->getHeight()) {
                         QColor color = pMark->fillColor();
                         color.setAlphaF(0.4f);
 
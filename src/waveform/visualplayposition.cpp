@@ -5,6 +5,18 @@
 #include "util/math.h"
 #include "waveform/isynctimeprovider.h"
 
+namespace {
+// Weight of the raw interpolated position when blending it with the
+// prediction from the previous frame. The remainder of the correction decays
+// within ~10 frames, fast enough to follow tempo changes but slow enough to
+// average out the audio callback scheduling jitter.
+constexpr double kJitterFilterRawWeight = 0.2;
+// Corrections larger than one audio buffer worth of position change cannot
+// be caused by timing jitter. Treat them as a seek, loop wrap or scratch
+// reversal and snap to the raw position instead of smoothing across it.
+constexpr double kMaxJitterBufferSteps = 1.0;
+} // namespace
+
 //static
 QMap<QString, QWeakPointer<VisualPlayPosition>> VisualPlayPosition::m_listVisualPlayPosition;
 PerformanceTimer VisualPlayPosition::m_timeInfoTime;
@@ -12,8 +24,12 @@ double VisualPlayPosition::m_dCallbackEntryToDacSecs = 0;
 
 VisualPlayPosition::VisualPlayPosition(const QString& key)
         : m_valid{false},
+          m_snapshotValid{false},
           m_key{key},
-          m_noTransport{false} {
+          m_noTransport{false},
+          m_jitterFilterValid{false},
+          m_lastSmoothedPlayPos{0.0},
+          m_smoothedCorrection{0.0} {
 }
 
 VisualPlayPosition::~VisualPlayPosition() {
@@ -153,12 +169,57 @@ double VisualPlayPosition::determinePlayPosInLoopBoundries(
     return interpolatedPlayPos;
 }
 
+double VisualPlayPosition::applyJitterFilter(
+        const VisualPlayPositionData& data,
+        double interpolatedPlayPos,
+        int syncIntervalTimeMicros) {
+    if (data.m_audioBufferMicroS == 0.0) {
+        m_jitterFilterValid = false;
+        return interpolatedPlayPos;
+    }
+    if (!m_jitterFilterValid) {
+        m_jitterFilterValid = true;
+        m_smoothedCorrection = 0.0;
+        m_lastSmoothedPlayPos = interpolatedPlayPos;
+        m_jitterFilterTimer.start();
+        return interpolatedPlayPos;
+    }
+    const double elapsedMicros = m_jitterFilterTimer.elapsed().toDoubleMicros();
+    if (elapsedMicros < syncIntervalTimeMicros / 2.0) {
+        // Another widget of the same deck rendering the same frame. Reuse the
+        // correction committed by the first caller instead of pulling the
+        // filter several times per frame.
+        return interpolatedPlayPos + m_smoothedCorrection;
+    }
+    // Predict where the position should be if playback had advanced at the
+    // engine rate since the last rendered frame. The raw interpolation
+    // deviates from this by the callback-entry scheduling jitter.
+    const double predicted = m_lastSmoothedPlayPos +
+            data.m_positionStep * elapsedMicros / data.m_audioBufferMicroS;
+    const double error = predicted - interpolatedPlayPos;
+    if (std::abs(error) >
+            std::abs(data.m_positionStep) * kMaxJitterBufferSteps) {
+        // Seek, loop wrap or scratch reversal. Snap instead of smoothing.
+        m_smoothedCorrection = 0.0;
+        m_lastSmoothedPlayPos = interpolatedPlayPos;
+        m_jitterFilterTimer.start();
+        return interpolatedPlayPos;
+    }
+    m_smoothedCorrection = error * (1.0 - kJitterFilterRawWeight);
+    const double smoothedPlayPos = interpolatedPlayPos + m_smoothedCorrection;
+    m_lastSmoothedPlayPos = smoothedPlayPos;
+    m_jitterFilterTimer.start();
+    return smoothedPlayPos;
+}
+
 double VisualPlayPosition::getAtNextVSync(VSyncTimeProvider* pSyncTimeProvider) {
-    if (m_valid.load()) {
-        const VisualPlayPositionData data = m_data.getValue();
+    if (m_snapshotValid) {
+        const VisualPlayPositionData& data = m_snapshotData;
         const double offset = calcOffsetAtNextVSync(pSyncTimeProvider, data);
 
-        return determinePlayPosInLoopBoundries(data, offset);
+        return applyJitterFilter(data,
+                determinePlayPosInLoopBoundries(data, offset),
+                pSyncTimeProvider->getSyncInterval().count());
     }
     return -1;
 }
@@ -167,11 +228,13 @@ void VisualPlayPosition::getPlaySlipAtNextVSync(
         VSyncTimeProvider* pSyncTimeProvider,
         double* pPlayPosition,
         double* pSlipPosition) {
-    if (m_valid.load()) {
-        const VisualPlayPositionData data = m_data.getValue();
+    if (m_snapshotValid) {
+        const VisualPlayPositionData& data = m_snapshotData;
         const double offset = calcOffsetAtNextVSync(pSyncTimeProvider, data);
 
-        double interpolatedPlayPos = determinePlayPosInLoopBoundries(data, offset);
+        double interpolatedPlayPos = applyJitterFilter(data,
+                determinePlayPosInLoopBoundries(data, offset),
+                pSyncTimeProvider->getSyncInterval().count());
         *pPlayPosition = interpolatedPlayPos;
 
         if (data.m_slipModeState == SlipModeState::Running) {
@@ -212,6 +275,23 @@ QSharedPointer<VisualPlayPosition> VisualPlayPosition::getVisualPlayPosition(con
     return vpp;
 }
 
+//static
+void VisualPlayPosition::captureVSyncSnapshots() {
+    for (const QWeakPointer<VisualPlayPosition>& weakVpp :
+            std::as_const(m_listVisualPlayPosition)) {
+        const QSharedPointer<VisualPlayPosition> vpp = weakVpp;
+        if (vpp.isNull()) {
+            continue;
+        }
+        vpp->m_snapshotValid = vpp->m_valid.load();
+        if (vpp->m_snapshotValid) {
+            // Single atomic read per deck and per frame; all widgets of all
+            // decks render from this snapshot until the next capture.
+            vpp->m_snapshotData = vpp->m_data.getValue();
+        }
+    }
+}
+
 //static
 void VisualPlayPosition::setCallbackEntryToDacSecs(double secs, const PerformanceTimer& time) {
     // the time is valid only just NOW, so measure the time from NOW for
@@ -84,6 +84,16 @@ class VisualPlayPosition : public QObject {
     // This is called by SoundDevicePortAudio just after the callback starts.
     static void setCallbackEntryToDacSecs(double secs, const PerformanceTimer& time);
 
+    // Copies the engine-published data of every deck into a frame-local
+    // snapshot in one pass. WaveformWidgetFactory calls this once at the start
+    // of each render frame; getAtNextVSync() and getPlaySlipAtNextVSync() then
+    // serve all widgets from the snapshot, so the waveforms and spinnies of
+    // all decks render one coherent engine state per frame instead of each
+    // widget re-reading the atomics at slightly different times.
+    // WARNING: Not thread safe. This function must only be called from the
+    // thread the widgets render on.
+    static void captureVSyncSnapshots();
+
     void setInvalid() {
         m_valid.store(false);
     };
@@ -94,10 +104,30 @@ class VisualPlayPosition : public QObject {
   private:
     double calcOffsetAtNextVSync(VSyncTimeProvider* pSyncTimeProvider,
             const VisualPlayPositionData& data);
+    // Filters the callback-entry timing jitter out of the interpolated play
+    // position by blending it with a prediction from the previous rendered
+    // frame. Keeps scrolling waveforms monotonic on displays that render
+    // several frames per audio callback (e.g. 240 Hz at a 23 ms buffer).
+    // Large discontinuities (seeks, loop wraps, scratch reversals) pass
+    // through unfiltered. Only called from the render thread.
+    double applyJitterFilter(const VisualPlayPositionData& data,
+            double interpolatedPlayPos,
+            int syncIntervalTimeMicros);
     ControlValueAtomic<VisualPlayPositionData> m_data;
     std::atomic<bool> m_valid;
+    // Frame-coherent copy of m_data taken by captureVSyncSnapshots(), only
+    // accessed from the render thread.
+    VisualPlayPositionData m_snapshotData;
+    bool m_snapshotValid;
     QString m_key;
     bool m_noTransport;
+    // Jitter filter state, only accessed from the render thread. The first
+    // getter called in a frame commits a new correction; further getters of
+    // the same frame reuse it so all widgets of a deck agree on the position.
+    bool m_jitterFilterValid;
+    double m_lastSmoothedPlayPos;
+    double m_smoothedCorrection;
+    PerformanceTimer m_jitterFilterTimer;
 
     static QMap<QString, QWeakPointer<VisualPlayPosition>> m_listVisualPlayPosition;
     // Time info from the Sound device, updated just after audio callback is called
@@ -2,6 +2,8 @@
 
 #include <QtDebug>
 
+#include <algorithm>
+
 #include "analyzer/constants.h"
 #include "engine/engine.h"
 #include "proto/waveform.pb.h"
@@ -73,6 +75,74 @@ Waveform::Waveform(
     setCompletion(0);
 }
 
+Waveform::Waveform(const Waveform& source, int maxVisualSamples)
+        : m_id(-1),
+          m_saveState(SaveState::SavePending),
+          m_dataSize(0),
+          m_visualSampleRate(0),
+          m_audioVisualRatio(0),
+          m_textureStride(1024),
+          m_completion(-1),
+          m_stemCount(source.m_stemCount) {
+    const int sourceFrames = source.getDataSize() / ChannelCount;
+    const int maxVisualFrames = maxVisualSamples / mixxx::kAnalysisChannels;
+    if (sourceFrames <= 0 || maxVisualFrames <= 0 ||
+            source.m_visualSampleRate <= 0 ||
+            source.getCompletion() != source.getDataSize()) {
+        assign(0);
+        setCompletion(0);
+        return;
+    }
+    const int summaryFrames = std::min(sourceFrames, maxVisualFrames);
+    m_visualSampleRate =
+            source.m_visualSampleRate * summaryFrames / sourceFrames;
+    m_audioVisualRatio =
+            source.m_audioVisualRatio * sourceFrames / summaryFrames;
+    assign(summaryFrames * ChannelCount);
+    // Average each band over the source frames a summary frame covers,
+    // mirroring WaveformStride::averageStore() at analysis time.
+    for (int frame = 0; frame < summaryFrames; ++frame) {
+        const int begin = static_cast<int>(
+                static_cast<double>(frame) * sourceFrames / summaryFrames);
+        const int end = std::max(begin + 1,
+                static_cast<int>(static_cast<double>(frame + 1) *
+                        sourceFrames / summaryFrames));
+        const int divisor = end - begin;
+        for (int channel = 0; channel < ChannelCount; ++channel) {
+            int sumAll = 0;
+            int sumLow = 0;
+            int sumMid = 0;
+            int sumHigh = 0;
+            int sumStems[mixxx::kMaxSupportedStems] = {};
+            for (int sourceFrame = begin; sourceFrame < end; ++sourceFrame) {
+                const WaveformData& sourceDatum =
+                        source.m_data[sourceFrame * ChannelCount + channel];
+                sumAll += sourceDatum.filtered.all;
+                sumLow += sourceDatum.filtered.low;
+                sumMid += sourceDatum.filtered.mid;
+                sumHigh += sourceDatum.filtered.high;
+                for (int stemIdx = 0; stemIdx < m_stemCount; ++stemIdx) {
+                    sumStems[stemIdx] += sourceDatum.stems[stemIdx];
+                }
+            }
+            WaveformData& datum = m_data[frame * ChannelCount + channel];
+            datum.filtered.all = static_cast<unsigned char>(
+                    (sumAll + divisor / 2) / divisor);
+            datum.filtered.low = static_cast<unsigned char>(
+                    (sumLow + divisor / 2) / divisor);
+            datum.filtered.mid = static_cast<unsigned char>(
+                    (sumMid + divisor / 2) / divisor);
+            datum.filtered.high = static_cast<unsigned char>(
+                    (sumHigh + divisor / 2) / divisor);
+            for (int stemIdx = 0; stemIdx < m_stemCount; ++stemIdx) {
+                datum.stems[stemIdx] = static_cast<unsigned char>(
+                        (sumStems[stemIdx] + divisor / 2) / divisor);
+            }
+        }
+    }
+    setCompletion(m_dataSize);
+}
+
 Waveform::~Waveform() {
 }
 
@@ -251,6 +321,56 @@ void Waveform::assign(int size) {
     m_saveState = SaveState::SavePending;
 }
 
+const std::vector<WaveformData>* Waveform::mipData(int level) const {
+    if (level < 0 || level >= kMipLevelCount) {
+        return nullptr;
+    }
+    if (!m_mipDataValid.loadAcquire()) {
+        const auto locker = lockMutex(&m_mutex);
+        if (!m_mipDataValid.loadRelaxed()) {
+            const int dataSize = getDataSize();
+            if (dataSize <= 0 || getCompletion() != dataSize) {
+                // Not completed yet. Levels built from a partial waveform
+                // would miss the frames analyzed afterwards, so renderers
+                // have to fall back to scanning m_data until the analysis
+                // is done.
+                return nullptr;
+            }
+            // Each level halves twice, i.e. takes the per-channel maximum
+            // of kMipFactor frames of the previous level.
+            const WaveformData* source = m_data.data();
+            int sourceFrames = dataSize / 2;
+            for (int l = 0; l < kMipLevelCount; ++l) {
+                const int mipFrames = (sourceFrames + kMipFactor - 1) / kMipFactor;
+                std::vector<WaveformData>& mip = m_mipData[l];
+                mip.assign(mipFrames * 2, {});
+                for (int frame = 0; frame < sourceFrames; ++frame) {
+                    for (int channel = 0; channel < ChannelCount; ++channel) {
+                        const WaveformData& datum = source[frame * 2 + channel];
+                        WaveformData& mipDatum = mip[(frame / kMipFactor) * 2 + channel];
+                        mipDatum.filtered.low = std::max(mipDatum.filtered.low,
+                                datum.filtered.low);
+                        mipDatum.filtered.mid = std::max(mipDatum.filtered.mid,
+                                datum.filtered.mid);
+                        mipDatum.filtered.high = std::max(mipDatum.filtered.high,
+                                datum.filtered.high);
+                        mipDatum.filtered.all = std::max(mipDatum.filtered.all,
+                                datum.filtered.all);
+                        for (int stemIdx = 0; stemIdx < m_stemCount; ++stemIdx) {
+                            mipDatum.stems[stemIdx] = std::max(mipDatum.stems[stemIdx],
+                                    datum.stems[stemIdx]);
+                        }
+                    }
+                }
+                source = mip.data();
+                sourceFrames = mipFrames;
+            }
+            m_mipDataValid.storeRelease(1);
+        }
+    }
+    return &m_mipData[level];
+}
+
 void Waveform::dump() const {
     qDebug() << "Waveform" << this
              << "size(" + QString::number(getDataSize()) + ")"
@@ -46,6 +46,11 @@ class Waveform {
             int desiredVisualSampleRate,
             int maxVisualSamples,
             int stemCount);
+    // Derives a lower-resolution waveform (an overview summary) from an
+    // already computed waveform by averaging its band data over each
+    // stride, like WaveformStride does during analysis. The source must be
+    // completed. See WaveformFactory::createWaveformSummaryFromWaveform().
+    Waveform(const Waveform& source, int maxVisualSamples);
 
     virtual ~Waveform();
 
@@ -137,6 +142,32 @@ class Waveform {
         return m_stemCount > 0;
     }
 
+    // Downsampled copies of the waveform data ("mipmap" levels). Level l
+    // holds the per-channel, per-band maximum of 4^(l+1) consecutive visual
+    // frames, i.e. 4x, 16x and 64x fewer frames than m_data. Renderers can
+    // aggregate over these levels instead of scanning every visual frame
+    // when a single pixel covers many frames (zoomed-out view of a long
+    // track). The layout matches m_data: two interleaved channel entries
+    // per frame.
+    static constexpr int kMipLevelCount = 3;
+    static constexpr int kMipFactor = 4;
+
+    // Returns the number of visual frames that one frame of the given
+    // level covers.
+    static constexpr int mipFrameFactor(int level) {
+        int factor = kMipFactor;
+        for (int i = 0; i < level; ++i) {
+            factor *= kMipFactor;
+        }
+        return factor;
+    }
+
+    // Returns the downsampled data of the given level (0 <= level <
+    // kMipLevelCount) or nullptr if the waveform is not completed yet.
+    // The levels are built lazily on first access; subsequent calls are
+    // lock-free.
+    const std::vector<WaveformData>* mipData(int level) const;
+
     void dump() const;
 
   private:
@@ -185,6 +216,12 @@ class Waveform {
     // The number of stem contained in waveform samples. 0 if not a stem waveform
     int m_stemCount;
 
+    // Lazily built from m_data once the waveform is completed, see mipData().
+    // The atomic flag allows lock-free reads after the levels have been
+    // published.
+    mutable std::vector<WaveformData> m_mipData[kMipLevelCount];
+    mutable QAtomicInt m_mipDataValid;
+
     mutable QMutex m_mutex;
 
     DISALLOW_COPY_AND_ASSIGN(Waveform);
@@ -11,6 +11,18 @@ Waveform* WaveformFactory::loadWaveformFromAnalysis(
     return pWaveform;
 }
 
+// static
+Waveform* WaveformFactory::createWaveformSummaryFromWaveform(
+        const Waveform& waveform) {
+    // Same visual resolution as AnalyzerWaveform uses when analyzing: two
+    // visual samples per pixel in a full width overview in full hd.
+    constexpr int summaryWaveformSamples = 2 * 1920;
+    Waveform* pSummary = new Waveform(waveform, summaryWaveformSamples);
+    pSummary->setVersion(currentWaveformSummaryVersion());
+    pSummary->setDescription(currentWaveformSummaryDescription());
+    return pSummary;
+}
+
 // static
 WaveformFactory::VersionClass WaveformFactory::waveformVersionToVersionClass(const QString& version) {
     if (version == WAVEFORM_CURRENT_VERSION) {
@@ -55,6 +55,11 @@ class WaveformFactory {
 
     static Waveform* loadWaveformFromAnalysis(
             const AnalysisDao::AnalysisInfo& analysis);
+    // Derives an overview summary from an already computed full-resolution
+    // waveform by averaging its band data, so a missing or discarded
+    // summary can be rebuilt without decoding the audio again. Version and
+    // description are set to the current summary version.
+    static Waveform* createWaveformSummaryFromWaveform(const Waveform& waveform);
     static VersionClass waveformVersionToVersionClass(const QString& version);
     static VersionClass waveformSummaryVersionToVersionClass(const QString& version);
     static QString currentWaveformVersion();
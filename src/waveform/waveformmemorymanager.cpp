@@ -0,0 +1,116 @@
+#include "waveform/waveformmemorymanager.h"
+
+#include <QtDebug>
+
+#include "control/controlobject.h"
+#include "moc_waveformmemorymanager.cpp"
+#include "track/track.h"
+#include "waveform/waveform.h"
+
+namespace {
+
+// Default combined budget for detailed waveforms of samplers and preview
+// decks. A detailed waveform of a typical track is a few MiB, so the
+// default accommodates a few dozen tracks before eviction starts.
+constexpr int kDefaultMemoryBudgetMb = 256;
+
+} // anonymous namespace
+
+WaveformMemoryManager::WaveformMemoryManager(UserSettingsPointer pConfig)
+        : m_memoryBudgetBytes(static_cast<qint64>(pConfig->getValue(
+                                      ConfigKey(QStringLiteral("[Waveform]"),
+                                              QStringLiteral("DetailedWaveformMemoryBudgetMB")),
+                                      kDefaultMemoryBudgetMb)) *
+                  1024 * 1024),
+          m_inEnforceBudget(false) {
+}
+
+void WaveformMemoryManager::submitTrack(const QString& group, TrackPointer pTrack) {
+    releaseGroup(group);
+    if (!pTrack) {
+        return;
+    }
+    Entry entry;
+    entry.pTrack = pTrack;
+    // The waveform is typically published by the analyzer some time after
+    // the track has been loaded, so account for it when that happens.
+    entry.updateConnection = connect(pTrack.get(),
+            &Track::waveformUpdated,
+            this,
+            &WaveformMemoryManager::enforceBudget);
+    m_entries.insert(group, entry);
+    m_lruGroups.append(group);
+    enforceBudget();
+}
+
+void WaveformMemoryManager::releaseGroup(const QString& group) {
+    auto it = m_entries.find(group);
+    if (it == m_entries.end()) {
+        return;
+    }
+    disconnect(it.value().updateConnection);
+    m_entries.erase(it);
+    m_lruGroups.removeOne(group);
+}
+
+void WaveformMemoryManager::setMemoryBudget(qint64 bytes) {
+    m_memoryBudgetBytes = bytes;
+    enforceBudget();
+}
+
+void WaveformMemoryManager::enforceBudget() {
+    if (m_inEnforceBudget || m_memoryBudgetBytes <= 0) {
+        return;
+    }
+    m_inEnforceBudget = true;
+
+    qint64 totalBytes = 0;
+    for (const QString& group : std::as_const(m_lruGroups)) {
+        totalBytes += waveformBytes(m_entries.value(group).pTrack.lock());
+    }
+
+    for (const QString& group : std::as_const(m_lruGroups)) {
+        if (totalBytes <= m_memoryBudgetBytes) {
+            break;
+        }
+        const TrackPointer pTrack = m_entries.value(group).pTrack.lock();
+        if (!pTrack) {
+            continue;
+        }
+        const ConstWaveformPointer pWaveform = pTrack->getWaveform();
+        if (!pWaveform) {
+            continue;
+        }
+        // Never discard analysis results that have not been written to
+        // the database yet; the waveform could not be restored.
+        if (pWaveform->saveState() != Waveform::SaveState::Saved) {
+            continue;
+        }
+        // Don't touch what is audible right now.
+        if (ControlObject::get(ConfigKey(group, QStringLiteral("play"))) > 0.0) {
+            continue;
+        }
+        const qint64 bytes = waveformBytes(pTrack);
+        pTrack->setWaveform(ConstWaveformPointer());
+        totalBytes -= bytes;
+        qDebug() << "WaveformMemoryManager: dropped detailed waveform of"
+                 << group << "to stay within" << m_memoryBudgetBytes << "bytes";
+    }
+
+    m_inEnforceBudget = false;
+}
+
+// static
+qint64 WaveformMemoryManager::waveformBytes(const TrackPointer& pTrack) {
+    if (!pTrack) {
+        return 0;
+    }
+    const ConstWaveformPointer pWaveform = pTrack->getWaveform();
+    if (!pWaveform) {
+        return 0;
+    }
+    const qint64 dataBytes = static_cast<qint64>(pWaveform->getTextureSize()) *
+            static_cast<qint64>(sizeof(WaveformData));
+    // The lazily built mip levels add about a third on top of the data.
+    return dataBytes + dataBytes / 3;
+}
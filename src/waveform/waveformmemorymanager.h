@@ -0,0 +1,63 @@
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QString>
+
+#include "preferences/usersettings.h"
+#include "track/track_decl.h"
+#include "util/singleton.h"
+
+/// Caps the total memory spent on detailed (full-resolution) waveforms of
+/// tracks loaded in players that never render them. Samplers and preview
+/// decks only show the overview, but loading a track into them still keeps
+/// the detailed waveform resident, which adds up to hundreds of megabytes
+/// with large sampler banks. Players register their tracks here and when
+/// the combined size exceeds the budget, the detailed waveform of the
+/// least recently loaded, non-playing track is dropped (the summary is
+/// kept). Dropping is transparent: the waveform is reloaded from the
+/// analysis database as soon as the track is loaded into a deck again.
+///
+/// Lives on the main thread; all methods must be called from there.
+class WaveformMemoryManager : public QObject, public Singleton<WaveformMemoryManager> {
+    Q_OBJECT
+  public:
+    /// Register or re-register the track loaded in the given player group
+    /// and enforce the budget. Passing a null track is equivalent to
+    /// releaseGroup().
+    void submitTrack(const QString& group, TrackPointer pTrack);
+    /// Forget the entry of the given player group, e.g. on eject.
+    void releaseGroup(const QString& group);
+
+    /// Budget for the combined size of all registered detailed waveforms.
+    /// A budget of 0 disables eviction.
+    void setMemoryBudget(qint64 bytes);
+    qint64 memoryBudgetBytes() const {
+        return m_memoryBudgetBytes;
+    }
+
+  protected:
+    WaveformMemoryManager(UserSettingsPointer pConfig);
+    ~WaveformMemoryManager() override = default;
+    friend class Singleton<WaveformMemoryManager>;
+
+  private:
+    struct Entry {
+        TrackWeakPointer pTrack;
+        // Re-runs budget enforcement when the analyzer publishes a
+        // waveform for the track after it has been registered.
+        QMetaObject::Connection updateConnection;
+    };
+
+    void enforceBudget();
+    static qint64 waveformBytes(const TrackPointer& pTrack);
+
+    qint64 m_memoryBudgetBytes;
+    // Guards against re-entrance: evicting emits Track::waveformUpdated,
+    // which is connected back to enforceBudget().
+    bool m_inEnforceBudget;
+    // Least recently (re-)submitted group first.
+    QList<QString> m_lruGroups;
+    QHash<QString, Entry> m_entries;
+};
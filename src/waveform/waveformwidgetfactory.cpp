@@ -27,6 +27,7 @@
 #include "util/timer.h"
 #include "waveform/guitick.h"
 #include "waveform/sharedglcontext.h"
+#include "waveform/visualplayposition.h"
 #include "waveform/visualsmanager.h"
 #include "waveform/vsyncthread.h"
 #ifdef MIXXX_USE_QOPENGL
@@ -77,6 +78,8 @@ const ConfigKey kDefaultZoomKey =
         ConfigKey(kWaveformGroup, QStringLiteral("DefaultZoom"));
 const ConfigKey kFrameRateKey =
         ConfigKey(kWaveformGroup, QStringLiteral("FrameRate"));
+const ConfigKey kFrameRenderBudgetMsKey =
+        ConfigKey(kWaveformGroup, QStringLiteral("FrameRenderBudgetMs"));
 const ConfigKey kVSyncKey = ConfigKey(kWaveformGroup, QStringLiteral("VSync"));
 
 ConfigKey visualGainKey(int index) {
@@ -120,6 +123,7 @@ WaveformWidgetFactory::WaveformWidgetFactory()
           m_config(nullptr),
           m_skipRender(false),
           m_frameRate(60),
+          m_renderFrameBudgetMicros(0),
           m_endOfTrackWarningTime(30),
           m_defaultZoom(WaveformWidgetRenderer::s_waveformDefaultZoom),
           m_zoomSync(true),
@@ -136,6 +140,7 @@ WaveformWidgetFactory::WaveformWidgetFactory()
           m_vsyncThread(nullptr),
           m_pGuiTick(nullptr),
           m_pVisualsManager(nullptr),
+          m_renderRoundRobin(0),
           m_frameCnt(0),
           m_actualFrameRate(0),
           m_playMarkerPosition(WaveformWidgetRenderer::s_defaultPlayMarkerPosition) {
@@ -365,6 +370,11 @@ bool WaveformWidgetFactory::setConfig(UserSettingsPointer config) {
 
     bool ok = false;
 
+    // Optional per-frame render budget in milliseconds. 0 (the default)
+    // keeps the previous behavior of rendering all visible waveforms on
+    // every vsync.
+    m_renderFrameBudgetMicros = m_config->getValue(kFrameRenderBudgetMsKey, 0) * 1000;
+
     int frameRate = m_config->getValue(kFrameRateKey, m_frameRate);
     m_frameRate = math_clamp(frameRate, 1, 120);
 
@@ -797,6 +807,10 @@ void WaveformWidgetFactory::renderSelf() {
             static_cast<int>(m_waveformWidgetHolders.size()));
 
     if (!m_skipRender) {
+        // Take one coherent snapshot of the engine-published play positions
+        // of all decks for this frame before any widget interpolates from it.
+        VisualPlayPosition::captureVSyncSnapshots();
+
         if (m_type) {   // no regular updates for an empty waveform
             // next rendered frame is displayed after next buffer swap and than after VSync
             QVarLengthArray<bool, 10> shouldRenderWaveforms(
@@ -820,14 +834,58 @@ void WaveformWidgetFactory::renderSelf() {
             // It may happen that there is an artificially delayed due to
             // anti tearing driver settings
             // all render commands are delayed until the swap from the previous run is executed
-            for (decltype(m_waveformWidgetHolders)::size_type i = 0;
-                    i < m_waveformWidgetHolders.size();
-                    i++) {
-                WaveformWidgetAbstract* pWaveformWidget = m_waveformWidgetHolders[i].m_waveformWidget;
-                if (!shouldRenderWaveforms[static_cast<int>(i)]) {
+
+            // Determine the render order. Widgets whose play position has
+            // advanced since their last rendered frame (playing or scrolling
+            // decks) come first, then the static ones, each group rotated
+            // round-robin so that no widget starves when the frame budget
+            // below defers some of them to following frames.
+            const std::size_t holderCount = m_waveformWidgetHolders.size();
+            m_renderCostEstimatesMicros.resize(holderCount, 0.0);
+            m_lastRenderedPlayPos.resize(holderCount, -1);
+            m_renderedInLastFrame.assign(holderCount, false);
+            QVarLengthArray<std::size_t, 10> renderOrder;
+            for (int pass = 0; pass < 2; ++pass) {
+                for (std::size_t n = 0; n < holderCount; ++n) {
+                    const std::size_t i = (m_renderRoundRobin + n) % holderCount;
+                    if (!shouldRenderWaveforms[static_cast<int>(i)]) {
+                        continue;
+                    }
+                    const bool moving = m_waveformWidgetHolders[i]
+                                                .m_waveformWidget->getPlayPosVSample() !=
+                            m_lastRenderedPlayPos[i];
+                    if (moving == (pass == 0)) {
+                        renderOrder.append(i);
+                    }
+                }
+            }
+            m_renderRoundRobin++;
+
+            double remainingBudgetMicros = static_cast<double>(m_renderFrameBudgetMicros);
+            for (qsizetype n = 0; n < renderOrder.size(); ++n) {
+                const std::size_t i = renderOrder[n];
+                if (m_renderFrameBudgetMicros > 0 && n > 0 &&
+                        m_renderCostEstimatesMicros[i] > remainingBudgetMicros) {
+                    // Over budget for this frame, deferred to a following
+                    // one. The first widget of the order is always rendered
+                    // to guarantee progress.
                     continue;
                 }
+                WaveformWidgetAbstract* pWaveformWidget =
+                        m_waveformWidgetHolders[i].m_waveformWidget;
+                PerformanceTimer renderTimer;
+                renderTimer.start();
                 pWaveformWidget->render();
+                const double elapsedMicros = renderTimer.elapsed().toDoubleMicros();
+                // Exponential moving average of the per-widget render cost,
+                // used to estimate whether the next widget still fits into
+                // the remaining budget.
+                m_renderCostEstimatesMicros[i] = m_renderCostEstimatesMicros[i] > 0.0
+                        ? m_renderCostEstimatesMicros[i] * 0.875 + elapsedMicros * 0.125
+                        : elapsedMicros;
+                remainingBudgetMicros -= elapsedMicros;
+                m_lastRenderedPlayPos[i] = pWaveformWidget->getPlayPosVSample();
+                m_renderedInLastFrame[i] = true;
                 //qDebug() << "render" << i << m_vsyncThread->elapsed();
             }
         }
@@ -875,8 +933,11 @@ void WaveformWidgetFactory::swapSelf() {
         if (m_type) {   // no regular updates for an empty waveform
             // Show rendered buffer from last render() run
             //qDebug() << "swap() start" << m_vsyncThread->elapsed();
-            for (const auto& holder : std::as_const(m_waveformWidgetHolders)) {
-                WaveformWidgetAbstract* pWaveformWidget = holder.m_waveformWidget;
+            for (decltype(m_waveformWidgetHolders)::size_type i = 0;
+                    i < m_waveformWidgetHolders.size();
+                    i++) {
+                WaveformWidgetAbstract* pWaveformWidget =
+                        m_waveformWidgetHolders[i].m_waveformWidget;
 
                 // Don't swap invalid / invisible widgets or widgets with an
                 // unexposed window. Prevents continuous log spew of
@@ -885,6 +946,12 @@ void WaveformWidgetFactory::swapSelf() {
                 if (!shouldRenderWaveform(pWaveformWidget)) {
                     continue;
                 }
+                // Don't swap widgets that the frame budget deferred in the
+                // last render() run, their back buffer still holds the
+                // frame before the currently displayed one.
+                if (i < m_renderedInLastFrame.size() && !m_renderedInLastFrame[i]) {
+                    continue;
+                }
                 WGLWidget* glw = pWaveformWidget->getGLWidget();
                 if (glw != nullptr) {
                     glw->makeCurrentIfNeeded();
@@ -311,6 +311,9 @@ class WaveformWidgetFactory : public QObject,
 
     bool m_skipRender;
     int m_frameRate;
+    // Per-frame render budget in microseconds, 0 = unlimited, i.e. all
+    // visible waveforms are rendered every frame. See renderSelf().
+    int m_renderFrameBudgetMicros;
     int m_endOfTrackWarningTime;
     double m_defaultZoom;
     bool m_zoomSync;
@@ -337,6 +340,15 @@ class WaveformWidgetFactory : public QObject,
     GuiTick* m_pGuiTick;  // not owned
     VisualsManager* m_pVisualsManager;  // not owned
 
+    // Frame-budget scheduling state, only touched by renderSelf(). The
+    // vectors are indexed like m_waveformWidgetHolders.
+    std::vector<double> m_renderCostEstimatesMicros;
+    std::vector<int> m_lastRenderedPlayPos;
+    // Widgets deferred by the frame budget must not swap their stale back
+    // buffer, see swapSelf().
+    std::vector<bool> m_renderedInLastFrame;
+    std::size_t m_renderRoundRobin;
+
     // TODO(#13245): Migrate the following methods to smart pointer.
     WaveformWidgetAbstract* createFilteredWaveformWidget(
             WWaveformViewer* viewer,
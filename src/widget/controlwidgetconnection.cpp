@@ -1,6 +1,8 @@
 #include "widget/controlwidgetconnection.h"
 
+#include <QList>
 #include <QStyle>
+#include <limits>
 #include <memory>
 
 #include "control/controlproxy.h"
@@ -30,6 +32,11 @@ QMetaProperty propertyFromWidget(const QWidget* pWidget, const QString& name) {
     return meta->property(id);
 }
 
+// All live parameter connections, polled once per rendered GUI frame.
+// Connections are created and destroyed with the skin and polled by
+// GuiTick, all on the main thread, so no locking is required.
+QList<ControlParameterWidgetConnection*> s_parameterConnections;
+
 } // namespace
 
 ControlWidgetConnection::ControlWidgetConnection(
@@ -40,11 +47,14 @@ ControlWidgetConnection::ControlWidgetConnection(
           m_pWidget(pBaseWidget),
           m_pControl(make_parented<ControlProxy>(key, this, ControlFlag::NoAssertIfMissing)),
           m_pValueTransformer(std::move(pTransformer)) {
-    m_pControl->connectValueChanged(this, &ControlWidgetConnection::slotControlValueChanged);
 }
 
 ControlWidgetConnection::~ControlWidgetConnection() = default;
 
+void ControlWidgetConnection::connectControlValueChanged() {
+    m_pControl->connectValueChanged(this, &ControlWidgetConnection::slotControlValueChanged);
+}
+
 void ControlWidgetConnection::setControlParameter(double parameter) {
     if (m_pValueTransformer != nullptr) {
         parameter = m_pValueTransformer->transformInverse(parameter);
@@ -76,13 +86,44 @@ ControlParameterWidgetConnection::ControlParameterWidgetConnection(
         EmitOption emitOption)
         : ControlWidgetConnection(pBaseWidget, key, std::move(pTransformer)),
           m_directionOption(directionOption),
-          m_emitOption(emitOption) {
+          m_emitOption(emitOption),
+          // NaN compares unequal to any value, so the first poll always
+          // pushes the initial value to the widget.
+          m_lastValue(std::numeric_limits<double>::quiet_NaN()) {
+    // Parameter connections receive their updates frame-coalesced from
+    // processFrameCoalescedUpdates() instead of connecting to the
+    // control's change signal, see the doc comment there.
+    s_parameterConnections.append(this);
 }
 
-ControlParameterWidgetConnection::~ControlParameterWidgetConnection() = default;
+ControlParameterWidgetConnection::~ControlParameterWidgetConnection() {
+    s_parameterConnections.removeOne(this);
+}
 
 void ControlParameterWidgetConnection::Init() {
-    slotControlValueChanged(m_pControl->get());
+    const double value = m_pControl->get();
+    m_lastValue = value;
+    slotControlValueChanged(value);
+}
+
+// static
+void ControlParameterWidgetConnection::processFrameCoalescedUpdates() {
+    for (ControlParameterWidgetConnection* pConnection :
+            std::as_const(s_parameterConnections)) {
+        pConnection->pollControlValue();
+    }
+}
+
+void ControlParameterWidgetConnection::pollControlValue() {
+    if (!(m_directionOption & DIR_TO_WIDGET)) {
+        return;
+    }
+    const double value = m_pControl->get();
+    if (value == m_lastValue) {
+        return;
+    }
+    m_lastValue = value;
+    slotControlValueChanged(value);
 }
 
 QString ControlParameterWidgetConnection::toDebugString() const {
@@ -134,6 +175,9 @@ ControlWidgetPropertyConnection::ControlWidgetPropertyConnection(
         : ControlWidgetConnection(pBaseWidget, key, std::move(pTransformer)),
           m_propertyName(propertyName),
           m_property(propertyFromWidget(pBaseWidget->toQWidget(), propertyName)) {
+    // Property writes (e.g. visible) restyle the widget tree and must
+    // not be skipped, so this connection stays signal-driven.
+    connectControlValueChanged();
     // Initial update to synchronize the property in all the sub widgets
     slotControlValueChanged(m_pControl->get());
 }
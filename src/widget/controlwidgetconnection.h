@@ -19,6 +19,11 @@ class ControlWidgetConnection : public QObject {
             std::unique_ptr<ValueTransformer> pTransformer);
     ~ControlWidgetConnection() override;
 
+    /// Connects the control's change signal to slotControlValueChanged().
+    /// Subclasses that receive updates per change call this once from
+    /// their constructor; frame-coalesced subclasses don't.
+    void connectControlValueChanged();
+
     double getControlParameter() const;
     double getControlParameterForValue(double value) const;
 
@@ -117,12 +122,26 @@ class ControlParameterWidgetConnection final : public ControlWidgetConnection {
     void setControlParameterDown(double v);
     void setControlParameterUp(double v);
 
+    /// Pushes the latest value of every registered connection to its
+    /// widget if it has changed since the last frame. Called once per
+    /// rendered GUI frame by GuiTick on the main thread. Widget-bound
+    /// updates are coalesced at frame granularity instead of delivering
+    /// one queued event per control change, because a widget can only
+    /// repaint once per frame anyway and engine-rate controls like the
+    /// VU meters would otherwise flood the GUI event loop.
+    static void processFrameCoalescedUpdates();
+
   private slots:
     void slotControlValueChanged(double value) override;
 
   private:
+    /// Applies the current control value if it has changed since the
+    /// last call.
+    void pollControlValue();
+
     DirectionOption m_directionOption;
     EmitOption m_emitOption;
+    double m_lastValue;
 };
 
 class ControlWidgetPropertyConnection final : public ControlWidgetConnection {
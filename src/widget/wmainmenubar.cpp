@@ -167,6 +167,20 @@ void WMainMenuBar::initialize() {
     pLibraryMenu->addAction(pLibraryExport);
 #endif
 
+    QString snapshotTitle = tr("Export Library S&napshot");
+    QString snapshotText =
+            tr("Export a copy of the library database and analysis data for "
+               "use on a backup machine");
+    auto* pLibrarySnapshot = new QAction(snapshotTitle, this);
+    pLibrarySnapshot->setStatusTip(snapshotText);
+    pLibrarySnapshot->setWhatsThis(buildWhatsThis(snapshotTitle, snapshotText));
+    pLibrarySnapshot->setCheckable(false);
+    connect(pLibrarySnapshot,
+            &QAction::triggered,
+            this,
+            &WMainMenuBar::exportLibrarySnapshot);
+    pLibraryMenu->addAction(pLibrarySnapshot);
+
     pLibraryMenu->addSeparator();
 
     QString searchHereTitle = tr("Search in Current View...");
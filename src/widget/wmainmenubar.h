@@ -67,6 +67,7 @@ class WMainMenuBar : public QMenuBar {
 #ifdef __ENGINEPRIME__
     void exportLibrary();
 #endif
+    void exportLibrarySnapshot();
     void searchInCurrentView();
     void searchInAllTracks();
     void showAutoDJ();
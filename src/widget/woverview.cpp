@@ -76,7 +76,8 @@ WOverview::WOverview(
                   QStringLiteral("track_samples")),
           m_playpositionControl(
                   m_group,
-                  QStringLiteral("playposition")) {
+                  QStringLiteral("playposition")),
+          m_layerCachesDirty(true) {
     m_endOfTrackControl = make_parented<ControlProxy>(
             m_group, QStringLiteral("end_of_track"), this, ControlFlag::NoAssertIfMissing);
     m_endOfTrackControl->connectValueChanged(this, &WOverview::onEndOfTrackChange);
@@ -364,6 +365,7 @@ void WOverview::slotTrackLoaded(TrackPointer pTrack) {
     if (m_pCurrentTrack) {
         updateCues(m_pCurrentTrack->getCuePoints());
     }
+    m_layerCachesDirty = true;
     update();
 }
 
@@ -407,12 +409,14 @@ void WOverview::slotLoadingTrack(TrackPointer pNewTrack, TrackPointer pOldTrack)
         m_pCurrentTrack.reset();
         m_pWaveform.clear();
     }
+    m_layerCachesDirty = true;
     update();
 }
 
 void WOverview::onEndOfTrackChange(double v) {
     //qDebug() << "WOverview::onEndOfTrackChange()" << v;
     m_endOfTrack = v > 0.0;
+    m_layerCachesDirty = true;
     update();
 }
 
@@ -421,6 +425,7 @@ void WOverview::onMarkChanged(double v) {
     //qDebug() << "WOverview::onMarkChanged()" << v;
     if (m_pCurrentTrack) {
         updateCues(m_pCurrentTrack->getCuePoints());
+        m_layerCachesDirty = true;
         update();
     }
 }
@@ -428,11 +433,13 @@ void WOverview::onMarkChanged(double v) {
 void WOverview::onMarkRangeChange(double v) {
     Q_UNUSED(v);
     //qDebug() << "WOverview::onMarkRangeChange()" << v;
+    m_layerCachesDirty = true;
     update();
 }
 
 void WOverview::onRateRatioChange(double v) {
     Q_UNUSED(v);
+    m_layerCachesDirty = true;
     update();
 }
 
@@ -467,10 +474,12 @@ void WOverview::slotTypeControlChanged(double v) {
 }
 
 void WOverview::slotMinuteMarkersChanged(bool /*unused*/) {
+    m_layerCachesDirty = true;
     update();
 }
 
 void WOverview::slotScalingChanged() {
+    m_layerCachesDirty = true;
     update();
 }
 
@@ -685,21 +694,21 @@ void WOverview::paintEvent(QPaintEvent* pEvent) {
     ScopedTimer t(QStringLiteral("WOverview::paintEvent"));
 
     QPainter painter(this);
-    painter.fillRect(rect(), m_backgroundColor);
 
-    if (!m_backgroundPixmap.isNull()) {
-        painter.drawPixmap(rect(), m_backgroundPixmap);
-    }
-
-    if (m_pCurrentTrack) {
-        // Refer to util/ScopePainter.h to understand the semantics of
-        // ScopePainter.
-        drawEndOfTrackBackground(&painter);
-        drawAxis(&painter);
-        drawWaveformPixmap(&painter);
+    // While the mouse interacts with the widget (hovered mark, dragged play
+    // position, time ruler) the marks and labels are drawn differently on
+    // every repaint, so the cached layers are bypassed. In the common case
+    // of an untouched overview only the played overlay, the pickup marker
+    // and the labels change with the play position, everything else is
+    // blitted from the two cached layers.
+    const bool useLayerCaches = m_pCurrentTrack && m_pHoveredMark.isNull() &&
+            !m_bLeftClickDragging && !m_bTimeRulerActive;
+
+    if (useLayerCaches) {
+        updateLayerCaches();
+        painter.drawPixmap(rect(), m_lowerLayerCache);
         drawPlayedOverlay(&painter);
-        drawMinuteMarkers(&painter);
-        drawPlayPosition(&painter);
+        painter.drawPixmap(rect(), m_upperLayerCache);
         drawEndOfTrackFrame(&painter);
         drawAnalyzerProgress(&painter);
 
@@ -709,12 +718,46 @@ void WOverview::paintEvent(QPaintEvent* pEvent) {
             const auto gain = static_cast<CSAMPLE_GAIN>(length() - 2) /
                     static_cast<CSAMPLE_GAIN>(trackSamples);
 
-            drawRangeMarks(&painter, offset, gain);
-            drawMarks(&painter, offset, gain);
             drawPickupPosition(&painter);
-            drawTimeRuler(&painter);
             drawMarkLabels(&painter, offset, gain);
         }
+    } else {
+        painter.fillRect(rect(), m_backgroundColor);
+
+        if (!m_backgroundPixmap.isNull()) {
+            painter.drawPixmap(rect(), m_backgroundPixmap);
+        }
+
+        if (m_pCurrentTrack) {
+            // Refer to util/ScopePainter.h to understand the semantics of
+            // ScopePainter.
+            drawEndOfTrackBackground(&painter);
+            drawAxis(&painter);
+            updateScaledWaveformImage();
+            drawWaveformPixmap(&painter);
+            drawPlayedOverlay(&painter);
+            drawMinuteMarkers(&painter);
+            drawPlayPosition(&painter);
+            drawEndOfTrackFrame(&painter);
+            drawAnalyzerProgress(&painter);
+
+            double trackSamples = getTrackSamples();
+            if (trackSamples > 0) {
+                const float offset = 1.0f;
+                const auto gain = static_cast<CSAMPLE_GAIN>(length() - 2) /
+                        static_cast<CSAMPLE_GAIN>(trackSamples);
+
+                drawRangeMarks(&painter, offset, gain);
+                drawMarks(&painter, offset, gain);
+                drawPickupPosition(&painter);
+                drawTimeRuler(&painter);
+                drawMarkLabels(&painter, offset, gain);
+            }
+            // The interactive draw path re-prerenders the mark labels with
+            // hover-dependent elision, so the cached marks layer has to be
+            // rebuilt when returning to the cached path.
+            m_layerCachesDirty = true;
+        }
     }
 
     if (m_bPassthroughEnabled) {
@@ -745,9 +788,9 @@ void WOverview::drawAxis(QPainter* pPainter) {
     }
 }
 
-void WOverview::drawWaveformPixmap(QPainter* pPainter) {
+bool WOverview::updateScaledWaveformImage() {
     if (m_waveformSourceImage.isNull()) {
-        return;
+        return false;
     }
 
     WaveformWidgetFactory* pWidgetFactory = WaveformWidgetFactory::instance();
@@ -793,11 +836,125 @@ void WOverview::drawWaveformPixmap(QPainter* pPainter) {
                 Qt::IgnoreAspectRatio,
                 Qt::SmoothTransformation);
         m_diffGain = diffGain;
+        return true;
+    }
+    return false;
+}
+
+void WOverview::updateScaledWaveformPart(int fromCompletion, int toCompletion) {
+    if (m_waveformImageScaled.isNull() ||
+            m_waveformSourceImage.isNull() ||
+            m_orientation == Qt::Vertical ||
+            m_pixmapDone) {
+        // Rescale the whole image on the next repaint. This is also done
+        // once the analysis has finished, to apply the normalization gain
+        // and to remove any filtering seams the incremental patches may
+        // have left.
+        m_waveformImageScaled = QImage();
+        m_diffGain = 0;
+        return;
+    }
+
+    // While the analysis is still running only the columns between the two
+    // completion points have changed. Rescaling the whole source image with
+    // smooth transformation on every analyzer progress update visibly lags
+    // behind bulk analysis, so redraw only the affected destination range
+    // of the cached scaled image.
+    const int sourceWidth = m_waveformSourceImage.width();
+    const int destWidth = m_waveformImageScaled.width();
+    if (sourceWidth <= 0 || destWidth <= 0) {
+        m_waveformImageScaled = QImage();
+        m_diffGain = 0;
+        return;
+    }
+
+    // Two data elements (left/right) per source image column. Pad the
+    // patched range by a few columns so that the smooth transformation has
+    // nearly the same filter context as a full rescale.
+    constexpr int kFilterPadding = 4;
+    const int srcFirst = math_clamp(fromCompletion / 2 - kFilterPadding, 0, sourceWidth);
+    const int srcLast = math_clamp(toCompletion / 2 + kFilterPadding, 0, sourceWidth);
+    if (srcLast <= srcFirst) {
+        return;
+    }
+
+    const int diffGain = static_cast<int>(m_diffGain);
+    const QRect sourceRect(srcFirst,
+            diffGain,
+            srcLast - srcFirst,
+            m_waveformSourceImage.height() - 2 * diffGain);
+    const double scale = static_cast<double>(destWidth) / sourceWidth;
+    const int destFirst = math_clamp(
+            static_cast<int>(std::floor(srcFirst * scale)), 0, destWidth);
+    const int destLast = math_clamp(
+            static_cast<int>(std::ceil(srcLast * scale)), 0, destWidth);
+    if (destLast <= destFirst) {
+        return;
     }
 
+    const QImage scaledPart = m_waveformSourceImage.copy(sourceRect)
+                                      .scaled(QSize(destLast - destFirst,
+                                                      m_waveformImageScaled.height()),
+                                              Qt::IgnoreAspectRatio,
+                                              Qt::SmoothTransformation);
+    QPainter painter(&m_waveformImageScaled);
+    painter.setCompositionMode(QPainter::CompositionMode_Source);
+    painter.drawImage(destFirst, 0, scaledPart);
+    // The static layer caches composite the scaled image, rebuild them on
+    // the next repaint.
+    m_layerCachesDirty = true;
+}
+
+void WOverview::drawWaveformPixmap(QPainter* pPainter) {
+    if (m_waveformImageScaled.isNull()) {
+        return;
+    }
     pPainter->drawImage(rect(), m_waveformImageScaled);
 }
 
+void WOverview::updateLayerCaches() {
+    // The scaled waveform image depends on the visual gain controls which
+    // are not connected to any invalidation signal, so check it on every
+    // repaint like the uncached path did.
+    const bool waveformImageChanged = updateScaledWaveformImage();
+    const QSize cacheSize = size() * m_devicePixelRatio;
+    if (!m_layerCachesDirty && !waveformImageChanged &&
+            m_lowerLayerCache.size() == cacheSize) {
+        return;
+    }
+
+    m_lowerLayerCache = QPixmap(cacheSize);
+    m_lowerLayerCache.setDevicePixelRatio(m_devicePixelRatio);
+    {
+        QPainter painter(&m_lowerLayerCache);
+        painter.fillRect(rect(), m_backgroundColor);
+        if (!m_backgroundPixmap.isNull()) {
+            painter.drawPixmap(rect(), m_backgroundPixmap);
+        }
+        drawEndOfTrackBackground(&painter);
+        drawAxis(&painter);
+        drawWaveformPixmap(&painter);
+    }
+
+    m_upperLayerCache = QPixmap(cacheSize);
+    m_upperLayerCache.setDevicePixelRatio(m_devicePixelRatio);
+    m_upperLayerCache.fill(Qt::transparent);
+    {
+        QPainter painter(&m_upperLayerCache);
+        drawMinuteMarkers(&painter);
+        double trackSamples = getTrackSamples();
+        if (trackSamples > 0) {
+            const float offset = 1.0f;
+            const auto gain = static_cast<CSAMPLE_GAIN>(length() - 2) /
+                    static_cast<CSAMPLE_GAIN>(trackSamples);
+            drawRangeMarks(&painter, offset, gain);
+            drawMarks(&painter, offset, gain);
+        }
+    }
+
+    m_layerCachesDirty = false;
+}
+
 void WOverview::drawMinuteMarkers(QPainter* pPainter) {
     if (!m_trackLoaded) {
         return;
@@ -1431,6 +1588,10 @@ bool WOverview::drawNextPixmapPart() {
             qWarning() << "Track duration has changed since last analysis"
                        << m_waveformSourceImage.width() << "!=" << dataSize / 2;
         }
+        // A stale scaled image of a previous analysis must not be patched
+        // incrementally, see updateScaledWaveformPart().
+        m_waveformImageScaled = QImage();
+        m_diffGain = 0;
     }
     DEBUG_ASSERT(!m_waveformSourceImage.isNull());
 
@@ -1466,6 +1627,7 @@ bool WOverview::drawNextPixmapPart() {
                 static_cast<float>(pWaveform->getAll(currentCompletion + 1)));
     }
 
+    const int previousCompletion = m_actualCompletion;
     if (m_type == OverviewType::Filtered) {
         waveformOverviewRenderer::drawWaveformPartLMH(
                 &painter,
@@ -1489,14 +1651,13 @@ bool WOverview::drawNextPixmapPart() {
                 m_signalColors);
     }
 
-    m_waveformImageScaled = QImage();
-    m_diffGain = 0;
-
     // Test if the complete waveform is done
     if (m_actualCompletion >= dataSize - 2) {
         m_pixmapDone = true;
     }
 
+    updateScaledWaveformPart(previousCompletion, m_actualCompletion);
+
     return true;
 }
 
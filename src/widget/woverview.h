@@ -99,6 +99,17 @@ class WOverview : public WWidget, public TrackDropTarget {
     void drawTimeRuler(QPainter* pPainter);
     void drawMarkLabels(QPainter* pPainter, const float offset, const float gain);
     void drawPassthroughOverlay(QPainter* pPainter);
+    // Rebuilds the cached static layers if they are marked dirty or the
+    // widget size changed, see paintEvent().
+    void updateLayerCaches();
+    // Updates m_waveformImageScaled for the current visual gain and widget
+    // size. Returns true if the image was rebuilt.
+    bool updateScaledWaveformImage();
+    // Patches only the source columns in [fromCompletion, toCompletion)
+    // into m_waveformImageScaled while the analysis is still running.
+    // Invalidates the scaled image for a full rescale on the next repaint
+    // when patching is not possible.
+    void updateScaledWaveformPart(int fromCompletion, int toCompletion);
     void paintText(const QString& text, QPainter* pPainter);
     double samplePositionToSeconds(double sample);
     inline int valueToPosition(double value) const {
@@ -207,6 +218,17 @@ class WOverview : public WWidget, public TrackDropTarget {
     WaveformMarkLabel m_timeRulerDistanceLabel;
 
 
+    // Cached static layers of paintEvent(). The lower layer holds
+    // everything painted below the played overlay (background, axis and
+    // waveform), the upper layer the minute markers, range marks and marks
+    // painted above it. Both only change on discrete events (track load,
+    // cue edits, rate change, resize, ...) while the widget repaints on
+    // every play position change, so they are rendered once and blitted
+    // per frame.
+    QPixmap m_lowerLayerCache;
+    QPixmap m_upperLayerCache;
+    bool m_layerCachesDirty;
+
     QPixmap m_backgroundPixmap;
     QString m_backgroundPixmapPath;
     QColor m_backgroundColor;
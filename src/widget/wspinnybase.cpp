@@ -30,6 +30,8 @@ WSpinnyBase::WSpinnyBase(
           WBaseWidget(this),
           m_group(group),
           m_pConfig(pConfig),
+          m_renderDirty(true),
+          m_renderedInLastFrame(false),
           m_pVisualPlayPos(VisualPlayPosition::getVisualPlayPosition(m_group)),
           m_pPlayPos(PollingControlProxy(m_group, QStringLiteral("playposition"))),
           m_pTrackSamples(PollingControlProxy(m_group, QStringLiteral("track_samples"))),
@@ -130,6 +132,7 @@ void WSpinnyBase::onVinylSignalQualityUpdate(const VinylSignalQualityReport& rep
 
     updateVinylSignalQualityImage(qual_color, report.scope);
     m_bDrawVinylSignalQuality = true;
+    m_renderDirty = true;
 #else
     Q_UNUSED(report);
 #endif
@@ -174,6 +177,7 @@ void WSpinnyBase::setup(const QDomNode& node,
                 this,
                 [this](double v) {
                     m_bShowCover = v > 0.0;
+                    m_renderDirty = true;
                 });
         m_bShowCover = m_pShowCoverProxy->get() > 0.0;
     } else {
@@ -226,6 +230,7 @@ void WSpinnyBase::setup(const QDomNode& node,
 void WSpinnyBase::setLoadedCover(const QPixmap& pixmap) {
     m_loadedCover = pixmap;
     m_loadedCoverScaled = scaleToSize(pixmap);
+    m_renderDirty = true;
 }
 
 void WSpinnyBase::slotLoadTrack(TrackPointer pTrack) {
@@ -303,8 +308,17 @@ void WSpinnyBase::paintEvent(QPaintEvent* e) {
     Q_UNUSED(e);
 }
 
+void WSpinnyBase::paintGL() {
+    // Called when the window needs repainting outside the render cycle,
+    // e.g. after being re-exposed. The presented frame may be gone, so
+    // redraw on the next vsync even if nothing changed.
+    // Note: WSpinnyGLSL overrides this and repaints immediately instead.
+    m_renderDirty = true;
+}
+
 void WSpinnyBase::render(VSyncThread* vSyncThread) {
     if (!shouldRender()) {
+        m_renderedInLastFrame = false;
         return;
     }
 
@@ -318,17 +332,34 @@ void WSpinnyBase::render(VSyncThread* vSyncThread) {
     if (m_dAngleCurrentPlaypos != m_dAngleLastPlaypos) {
         m_fAngle = static_cast<float>(calculateAngle(m_dAngleCurrentPlaypos));
         m_dAngleLastPlaypos = m_dAngleCurrentPlaypos;
+        m_renderDirty = true;
     }
 
     if (m_dGhostAngleCurrentPlaypos != m_dGhostAngleLastPlaypos) {
         m_fGhostAngle = static_cast<float>(calculateAngle(m_dGhostAngleCurrentPlaypos));
         m_dGhostAngleLastPlaypos = m_dGhostAngleCurrentPlaypos;
+        m_renderDirty = true;
     }
 
+    m_renderedInLastFrame = m_renderDirty;
+    if (!m_renderDirty) {
+        // Neither the angles nor the displayed content changed since the
+        // last frame, keep the presented image. This turns the spinnies
+        // of paused decks into no-ops instead of redrawing the same
+        // static image every vsync.
+        return;
+    }
+    m_renderDirty = false;
+
     draw();
 }
 
 void WSpinnyBase::swap() {
+    if (!m_renderedInLastFrame) {
+        // Nothing was drawn into the back buffer in the last render()
+        // call, don't present it.
+        return;
+    }
     if (!shouldRender()) {
         return;
     }
@@ -367,6 +398,7 @@ void WSpinnyBase::resizeEvent(QResizeEvent* event) {
     m_loadedCoverScaled = scaleToSize(m_loadedCover);
     m_fgImageScaled = scaleToSize(m_pFgImage);
     m_ghostImageScaled = scaleToSize(m_pGhostImage);
+    m_renderDirty = true;
 
     WGLWidget::resizeEvent(event);
 }
@@ -469,6 +501,7 @@ void WSpinnyBase::updateVinylControlSignalEnabled(double enabled) {
         return;
     }
     m_bSignalActive = enabled != 0;
+    m_renderDirty = true;
 
     if (m_bSignalActive && m_iVinylInput != -1) {
         m_pVCManager->addSignalQualityListener(this);
@@ -483,10 +516,12 @@ void WSpinnyBase::updateVinylControlSignalEnabled(double enabled) {
 
 void WSpinnyBase::updateVinylControlEnabled(double enabled) {
     m_bVinylActive = enabled != 0;
+    m_renderDirty = true;
 }
 
 void WSpinnyBase::updateSlipEnabled(double enabled) {
     m_bGhostPlayback = static_cast<bool>(enabled);
+    m_renderDirty = true;
 }
 
 void WSpinnyBase::mouseMoveEvent(QMouseEvent* e) {
@@ -612,6 +647,8 @@ void WSpinnyBase::showEvent(QShowEvent* event) {
         m_pVCManager->addSignalQualityListener(this);
     }
 #endif
+    // The previously presented frame is stale after the widget was hidden.
+    m_renderDirty = true;
     WGLWidget::showEvent(event);
 }
 
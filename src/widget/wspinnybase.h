@@ -71,6 +71,8 @@ class WSpinnyBase : public WGLWidget,
   protected:
     // QWidget:
     void paintEvent(QPaintEvent* /*unused*/) override;
+    // WGLWidget:
+    void paintGL() override;
     void mouseMoveEvent(QMouseEvent* e) override;
     void mousePressEvent(QMouseEvent* e) override;
     void mouseReleaseEvent(QMouseEvent* e) override;
@@ -101,6 +103,15 @@ class WSpinnyBase : public WGLWidget,
     const QString m_group;
     UserSettingsPointer m_pConfig;
 
+    // True if the widget content changed since the last draw() and the
+    // next frame needs to be rendered. While the deck is paused and
+    // nothing else changes, render() and swap() become no-ops instead
+    // of redrawing the same static image every vsync.
+    bool m_renderDirty;
+    // True if draw() ran in the last render() call, so that swap()
+    // only presents back buffers that were actually drawn into.
+    bool m_renderedInLastFrame;
+
   protected:
     std::shared_ptr<QImage> m_pBgImage;
     std::shared_ptr<QImage> m_pMaskImage;
@@ -9,6 +9,8 @@
 
 WTime::WTime(QWidget* parent)
         : WLabel(parent),
+          m_timerServiceClientId(
+                  mixxx::CoalescingTimerService::kInvalidClientId),
           m_sTimeFormat("h:mm AP"),
           m_interval(s_iMinuteInterval) {
     m_pTimer = new QTimer(this);
@@ -21,8 +23,20 @@ WTime::~WTime() {
 void WTime::setup(const QDomNode& node, const SkinContext& context) {
     WLabel::setup(node, context);
     setTimeFormat(node, context);
-    m_pTimer->start(m_interval);
-    connect(m_pTimer, &QTimer::timeout, this, &WTime::refreshTime);
+    if (auto* pTimerService = mixxx::CoalescingTimerService::instance()) {
+        // A clock display tolerates being refreshed a bit early, so let
+        // the shared timer piggyback the update onto other GUI wakeups.
+        m_timerServiceClientId = pTimerService->registerClient(
+                this,
+                m_interval,
+                m_interval / 4,
+                [this]() {
+                    refreshTime();
+                });
+    } else {
+        m_pTimer->start(m_interval);
+        connect(m_pTimer, &QTimer::timeout, this, &WTime::refreshTime);
+    }
     refreshTime();
 }
 
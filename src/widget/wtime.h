@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "util/coalescingtimer.h"
 #include "widget/wlabel.h"
 
 class WTime: public WLabel {
@@ -19,7 +20,9 @@ class WTime: public WLabel {
   private:
     void setTimeFormat(const QDomNode& node, const SkinContext& context);
 
+    // Fallback when no CoalescingTimerService has been created
     QTimer* m_pTimer;
+    mixxx::CoalescingTimerService::ClientId m_timerServiceClientId;
     QString m_sTimeFormat;
     // m_interval defines how often the time will be updated
     short m_interval;
@@ -2,6 +2,7 @@
 
 #include <QCheckBox>
 #include <QDialogButtonBox>
+#include <QHash>
 #include <QInputDialog>
 #include <QList>
 #include <QListWidget>
@@ -415,6 +416,13 @@ void WTrackMenu::createActions() {
                 this,
                 &WTrackMenu::slotExportMetadataIntoFileTags);
 
+        m_pUndoBatchEditAct =
+                make_parented<QAction>(tr("Undo Last Batch Edit"), m_pMetadataMenu);
+        connect(m_pUndoBatchEditAct,
+                &QAction::triggered,
+                this,
+                &WTrackMenu::slotUndoLastBatchEdit);
+
         m_updateInExternalTrackCollections.reserve(
                 m_pLibrary->trackCollectionManager()->externalCollections().size());
         for (auto* const pExternalTrackCollection :
@@ -683,6 +691,7 @@ void WTrackMenu::setupActions() {
         m_pMetadataMenu->addAction(m_pImportMetadataFromFileAct);
         m_pMetadataMenu->addAction(m_pImportMetadataFromMusicBrainzAct);
         m_pMetadataMenu->addAction(m_pExportMetadataAct);
+        m_pMetadataMenu->addAction(m_pUndoBatchEditAct);
 
         for (const auto& updateInExternalTrackCollection :
                 std::as_const(m_updateInExternalTrackCollections)) {
@@ -1111,6 +1120,7 @@ void WTrackMenu::updateMenus() {
 
     if (featureIsEnabled(Feature::Metadata)) {
         m_pImportMetadataFromMusicBrainzAct->setEnabled(singleTrackSelected);
+        m_pUndoBatchEditAct->setEnabled(!m_undoJournal.isEmpty());
 
         // We use the last selected track for the cover art context to be
         // consistent with selectionChanged above.
@@ -1371,15 +1381,61 @@ std::unique_ptr<mixxx::TrackPointerIterator> WTrackMenu::newTrackPointerIterator
     return nullptr;
 }
 
+namespace {
+
+// Captures the before-image of each track's database record just before
+// the wrapped operation modifies it. The journal is filled through a
+// pointer, following the mutable state pattern that the base class
+// documentation explicitly permits.
+class JournalBeforeImagesTrackPointerOperation : public mixxx::TrackPointerOperation {
+  public:
+    JournalBeforeImagesTrackPointerOperation(
+            const mixxx::TrackPointerOperation* pInnerOperation,
+            QList<mixxx::TrackRecord>* pJournal)
+            : m_pInnerOperation(pInnerOperation),
+              m_pJournal(pJournal) {
+        DEBUG_ASSERT(m_pInnerOperation);
+        DEBUG_ASSERT(m_pJournal);
+    }
+
+  private:
+    void doApply(
+            const TrackPointer& pTrack) const override {
+        m_pJournal->append(pTrack->getRecord());
+        m_pInnerOperation->apply(pTrack);
+    }
+
+    const mixxx::TrackPointerOperation* const m_pInnerOperation;
+    QList<mixxx::TrackRecord>* const m_pJournal;
+};
+
+} // anonymous namespace
+
 int WTrackMenu::applyTrackPointerOperation(
         const QString& progressLabelText,
         const mixxx::TrackPointerOperation* pTrackPointerOperation,
-        mixxx::ModalTrackBatchOperationProcessor::Mode operationMode) const {
+        mixxx::ModalTrackBatchOperationProcessor::Mode operationMode,
+        bool journalBeforeImages) const {
     const auto pTrackPointerIter = newTrackPointerIterator();
     if (!pTrackPointerIter) {
         // Empty, i.e. nothing to do
         return 0;
     }
+    if (journalBeforeImages) {
+        // Only the most recent journaled batch edit can be undone. If the
+        // batch is aborted halfway the journal contains exactly the tracks
+        // that have already been modified.
+        m_undoJournal.clear();
+        const auto journalingOperation = JournalBeforeImagesTrackPointerOperation(
+                pTrackPointerOperation, &m_undoJournal);
+        mixxx::ModalTrackBatchOperationProcessor modalOperation(
+                &journalingOperation,
+                operationMode);
+        return modalOperation.processTracks(
+                progressLabelText,
+                m_pLibrary->trackCollectionManager(),
+                pTrackPointerIter.get());
+    }
     mixxx::ModalTrackBatchOperationProcessor modalOperation(
             pTrackPointerOperation,
             operationMode);
@@ -1479,7 +1535,70 @@ void WTrackMenu::slotImportMetadataFromFileTags() {
             // Update the database to reflect the recent changes. This is
             // crucial for additional metadata like custom tags that are
             // directly fetched from the database for certain use cases!
+            mixxx::ModalTrackBatchOperationProcessor::Mode::ApplyAndSave,
+            /*journalBeforeImages*/ true);
+}
+
+namespace {
+
+class RestoreTrackRecordsTrackPointerOperation : public mixxx::TrackPointerOperation {
+  public:
+    explicit RestoreTrackRecordsTrackPointerOperation(
+            QHash<TrackId, mixxx::TrackRecord> beforeImages)
+            : m_beforeImages(std::move(beforeImages)) {
+    }
+
+  private:
+    void doApply(
+            const TrackPointer& pTrack) const override {
+        const auto it = m_beforeImages.constFind(pTrack->getId());
+        VERIFY_OR_DEBUG_ASSERT(it != m_beforeImages.constEnd()) {
+            return;
+        }
+        // Restore the before-image. The beats are not touched, journaled
+        // operations are restricted to record-only edits.
+        pTrack->replaceRecord(*it);
+    }
+
+    const QHash<TrackId, mixxx::TrackRecord> m_beforeImages;
+};
+
+} // anonymous namespace
+
+void WTrackMenu::slotUndoLastBatchEdit() {
+    if (m_undoJournal.isEmpty()) {
+        return;
+    }
+    QHash<TrackId, mixxx::TrackRecord> beforeImages;
+    beforeImages.reserve(m_undoJournal.size());
+    TrackPointerList tracks;
+    tracks.reserve(m_undoJournal.size());
+    for (const mixxx::TrackRecord& record : std::as_const(m_undoJournal)) {
+        const TrackPointer pTrack =
+                m_pLibrary->trackCollectionManager()->getTrackById(record.getId());
+        if (!pTrack) {
+            // The track has been purged since the edit, nothing to restore.
+            continue;
+        }
+        tracks.append(pTrack);
+        beforeImages.insert(record.getId(), record);
+    }
+    m_undoJournal.clear();
+    if (tracks.isEmpty()) {
+        return;
+    }
+    const auto progressLabelText =
+            tr("Undoing metadata edit of %n track(s)", "", tracks.size());
+    const auto trackOperator =
+            RestoreTrackRecordsTrackPointerOperation(std::move(beforeImages));
+    mixxx::TrackPointerListIterator trackPointerIter(tracks);
+    mixxx::ModalTrackBatchOperationProcessor modalOperation(
+            &trackOperator,
             mixxx::ModalTrackBatchOperationProcessor::Mode::ApplyAndSave);
+    modalOperation.processTracks(
+            progressLabelText,
+            m_pLibrary->trackCollectionManager(),
+            &trackPointerIter);
 }
 
 namespace {
@@ -1934,7 +2053,9 @@ void WTrackMenu::slotSetRating(int rating) {
             SetRatingTrackPointerOperation(rating);
     applyTrackPointerOperation(
             progressLabelText,
-            &trackOperator);
+            &trackOperator,
+            mixxx::ModalTrackBatchOperationProcessor::Mode::Apply,
+            /*journalBeforeImages*/ true);
 
     hide();
 }
@@ -1965,7 +2086,9 @@ void WTrackMenu::slotColorPicked(const mixxx::RgbColor::optional_t& color) {
             SetColorTrackPointerOperation(color);
     applyTrackPointerOperation(
             progressLabelText,
-            &trackOperator);
+            &trackOperator,
+            mixxx::ModalTrackBatchOperationProcessor::Mode::Apply,
+            /*journalBeforeImages*/ true);
 
     hide();
 }
@@ -2024,7 +2147,9 @@ void WTrackMenu::slotClearPlayCount() {
             ResetPlayCounterTrackPointerOperation();
     applyTrackPointerOperation(
             progressLabelText,
-            &trackOperator);
+            &trackOperator,
+            mixxx::ModalTrackBatchOperationProcessor::Mode::Apply,
+            /*journalBeforeImages*/ true);
 }
 
 namespace {
@@ -2073,7 +2198,9 @@ void WTrackMenu::slotClearRating() {
             ResetRatingTrackPointerOperation();
     applyTrackPointerOperation(
             progressLabelText,
-            &trackOperator);
+            &trackOperator,
+            mixxx::ModalTrackBatchOperationProcessor::Mode::Apply,
+            /*journalBeforeImages*/ true);
 }
 
 namespace {
@@ -2096,7 +2223,9 @@ void WTrackMenu::slotClearComment() {
             ClearCommentTrackPointerOperation();
     applyTrackPointerOperation(
             progressLabelText,
-            &trackOperator);
+            &trackOperator,
+            mixxx::ModalTrackBatchOperationProcessor::Mode::Apply,
+            /*journalBeforeImages*/ true);
 }
 
 namespace {
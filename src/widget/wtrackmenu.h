@@ -13,6 +13,7 @@
 #include "preferences/usersettings.h"
 #include "track/beats.h"
 #include "track/track_decl.h"
+#include "track/trackrecord.h"
 #include "track/trackref.h"
 #include "util/color/rgbcolor.h"
 #include "util/parented_ptr.h"
@@ -176,6 +177,7 @@ class WTrackMenu : public QMenu {
     void slotShowDlgTagFetcher();
     void slotImportMetadataFromFileTags();
     void slotExportMetadataIntoFileTags();
+    void slotUndoLastBatchEdit();
     void slotUpdateExternalTrackCollection(ExternalTrackCollection* externalTrackCollection);
 
     // Playlist and crate
@@ -216,11 +218,17 @@ class WTrackMenu : public QMenu {
     /// TO MODIFY the underlying m_pTrackModel during the iteration!!!
     /// This might happen not only directly but also indirectly by
     /// handling signals, e.g. TrackDAO::enforceModelUpdate().
+    /// If journalBeforeImages is set, the database record of every track is
+    /// captured into m_undoJournal before the operation modifies it, so the
+    /// whole batch edit can be reverted via slotUndoLastBatchEdit(). Only
+    /// pass it for operations whose effects are fully contained in the
+    /// TrackRecord; beats and cues are not covered.
     int applyTrackPointerOperation(
             const QString& progressLabelText,
             const mixxx::TrackPointerOperation* pTrackPointerOperation,
             mixxx::ModalTrackBatchOperationProcessor::Mode operationMode =
-                    mixxx::ModalTrackBatchOperationProcessor::Mode::Apply) const;
+                    mixxx::ModalTrackBatchOperationProcessor::Mode::Apply,
+            bool journalBeforeImages = false) const;
 
     bool isEmpty() const {
         return getTrackCount() == 0;
@@ -312,6 +320,9 @@ class WTrackMenu : public QMenu {
     // Save Track Metadata Action:
     parented_ptr<QAction> m_pExportMetadataAct;
 
+    // Revert the most recent journaled batch edit
+    parented_ptr<QAction> m_pUndoBatchEditAct;
+
     // Send to Auto-DJ Action
     parented_ptr<QAction> m_pAutoDJBottomAct;
     parented_ptr<QAction> m_pAutoDJTopAct;
@@ -396,6 +407,12 @@ class WTrackMenu : public QMenu {
     bool m_bPlaylistMenuLoaded;
     bool m_bCrateMenuLoaded;
 
+    // Before-images of the most recent journaled batch edit, in no
+    // particular order. Kept in memory only; a restart discards the
+    // undo history like it always has. Mutable because the journal is
+    // filled from the const applyTrackPointerOperation().
+    mutable QList<mixxx::TrackRecord> m_undoJournal;
+
     Features m_eActiveFeatures;
     const Features m_eTrackModelFeatures;
 
@@ -8,6 +8,7 @@
 #include <QUrl>
 
 #include "control/controlobject.h"
+#include "library/basetracktablemodel.h"
 #include "library/dao/trackschema.h"
 #include "library/library.h"
 #include "library/library_prefs.h"
@@ -15,6 +16,7 @@
 #include "library/searchqueryparser.h"
 #include "library/trackcollection.h"
 #include "library/trackcollectionmanager.h"
+#include "library/trackprefetcher.h"
 #include "mixer/playermanager.h"
 #include "moc_wtracktableview.cpp"
 #include "preferences/colorpalettesettings.h"
@@ -167,6 +169,9 @@ void WTrackTableView::slotGuiTick50ms(double /*unused*/) {
                     TrackPointer pTrack = pTrackModel->getTrack(indices.first());
                     if (pTrack) {
                         emit trackSelected(pTrack);
+                        // The selected track is a likely candidate for the
+                        // next deck load, warm it up in the background.
+                        mixxx::TrackPrefetcher::prefetch(pTrack);
                     }
                 }
             } else {
@@ -259,6 +264,19 @@ void WTrackTableView::loadTrackModel(QAbstractItemModel* pNewModel, bool restore
     setHorizontalHeader(tempHeader);
 
     setModel(pNewModel);
+
+    // Let the model skip expensive styling roles while the view is
+    // scrolling, analogous to the lazy-loading inhibition of the cover
+    // art and overview delegates below.
+    auto* pBaseTrackTableModel = qobject_cast<BaseTrackTableModel*>(pNewModel);
+    if (pBaseTrackTableModel) {
+        connect(this,
+                &WTrackTableView::onlyCachedCoversAndOverviews,
+                pBaseTrackTableModel,
+                &BaseTrackTableModel::slotInhibitExpensiveRoles,
+                Qt::UniqueConnection);
+    }
+
     setHorizontalHeader(pHeader);
     pHeader->setSectionsMovable(true);
     pHeader->setSectionsClickable(true);